@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Patent rights are not granted under this agreement. Patent rights are
+ *       available under FRAND terms.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX or PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * @copyright 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC).  All rights reserved.
+ */
+#include <config.h>
+
+#include <parc/algol/internal_parc_JSONString.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#  include <immintrin.h>
+#  define _PARCJSONString_AVX2 1
+#endif
+
+static inline bool
+_isSpecial(uint8_t c, bool solidus)
+{
+    return c < 0x20 || c == 0x7F || c == '"' || c == '\\' || (solidus && c == '/');
+}
+
+static size_t
+_parcJSONString_ScanScalar(size_t index, size_t length, const uint8_t bytes[length], bool solidus)
+{
+    while (index < length && !_isSpecial(bytes[index], solidus)) {
+        index++;
+    }
+    return index;
+}
+
+#if defined(__SSE2__)
+// A byte is below 0x20 exactly when min(byte, 0x1F) == byte, which avoids the signed comparison.
+static size_t
+_parcJSONString_ScanSSE2(size_t index, size_t length, const uint8_t bytes[length], bool solidus)
+{
+    const __m128i quote = _mm_set1_epi8('"');
+    const __m128i backslash = _mm_set1_epi8('\\');
+    const __m128i delete = _mm_set1_epi8(0x7F);
+    const __m128i control = _mm_set1_epi8(0x1F);
+    const __m128i slash = _mm_set1_epi8(solidus ? '/' : '"');
+
+    for (; index + 16 <= length; index += 16) {
+        __m128i chunk = _mm_loadu_si128((const __m128i *) &bytes[index]);
+        __m128i matches = _mm_or_si128(_mm_cmpeq_epi8(chunk, quote), _mm_cmpeq_epi8(chunk, backslash));
+        matches = _mm_or_si128(matches, _mm_cmpeq_epi8(chunk, delete));
+        matches = _mm_or_si128(matches, _mm_cmpeq_epi8(chunk, slash));
+        matches = _mm_or_si128(matches, _mm_cmpeq_epi8(_mm_min_epu8(chunk, control), chunk));
+        uint32_t mask = (uint32_t) _mm_movemask_epi8(matches);
+        if (mask != 0) {
+            return index + (size_t) __builtin_ctz(mask);
+        }
+    }
+    return index;
+}
+#endif
+
+#if defined(_PARCJSONString_AVX2)
+__attribute__((target("avx2")))
+static size_t
+_parcJSONString_ScanAVX2(size_t index, size_t length, const uint8_t bytes[length], bool solidus)
+{
+    const __m256i quote = _mm256_set1_epi8('"');
+    const __m256i backslash = _mm256_set1_epi8('\\');
+    const __m256i delete = _mm256_set1_epi8(0x7F);
+    const __m256i control = _mm256_set1_epi8(0x1F);
+    const __m256i slash = _mm256_set1_epi8(solidus ? '/' : '"');
+
+    for (; index + 32 <= length; index += 32) {
+        __m256i chunk = _mm256_loadu_si256((const __m256i *) &bytes[index]);
+        __m256i matches = _mm256_or_si256(_mm256_cmpeq_epi8(chunk, quote), _mm256_cmpeq_epi8(chunk, backslash));
+        matches = _mm256_or_si256(matches, _mm256_cmpeq_epi8(chunk, delete));
+        matches = _mm256_or_si256(matches, _mm256_cmpeq_epi8(chunk, slash));
+        matches = _mm256_or_si256(matches, _mm256_cmpeq_epi8(_mm256_min_epu8(chunk, control), chunk));
+        uint32_t mask = (uint32_t) _mm256_movemask_epi8(matches);
+        if (mask != 0) {
+            return index + (size_t) __builtin_ctz(mask);
+        }
+    }
+    return index;
+}
+
+static inline bool
+_useAVX2(void)
+{
+    return __builtin_cpu_supports("avx2");
+}
+#endif
+
+size_t
+internal_parcJSONString_Scan(size_t length, const uint8_t bytes[length], bool solidus)
+{
+    size_t index = 0;
+
+#if defined(_PARCJSONString_AVX2)
+    if (length >= 32 && _useAVX2()) {
+        index = _parcJSONString_ScanAVX2(index, length, bytes, solidus);
+        if (index + 32 <= length) {
+            return index;
+        }
+    }
+#endif
+#if defined(__SSE2__)
+    index = _parcJSONString_ScanSSE2(index, length, bytes, solidus);
+    if (index + 16 <= length) {
+        return index;
+    }
+#endif
+
+    return _parcJSONString_ScanScalar(index, length, bytes, solidus);
+}
+
+void
+internal_parcJSONString_Escape(PARCBufferComposer *composer, size_t length, const uint8_t bytes[length], bool solidus)
+{
+    size_t index = 0;
+    while (index < length) {
+        size_t special = index + internal_parcJSONString_Scan(length - index, &bytes[index], solidus);
+        if (special > index) {
+            parcBufferComposer_PutArray(composer, &bytes[index], special - index);
+        }
+        if (special == length) {
+            break;
+        }
+
+        uint8_t c = bytes[special];
+        if (c == '"') {
+            parcBufferComposer_PutString(composer, "\\\"");
+        } else if (c == '\b') {
+            parcBufferComposer_PutString(composer, "\\b");
+        } else if (c == '\f') {
+            parcBufferComposer_PutString(composer, "\\f");
+        } else if (c == '\n') {
+            parcBufferComposer_PutString(composer, "\\n");
+        } else if (c == '\r') {
+            parcBufferComposer_PutString(composer, "\\r");
+        } else if (c == '\t') {
+            parcBufferComposer_PutString(composer, "\\t");
+        } else if (c == '/') {
+            parcBufferComposer_PutString(composer, "\\/");
+        } else if (c == '\\') {
+            parcBufferComposer_PutString(composer, "\\\\");
+        } else {
+            parcBufferComposer_PutChar(composer, c);
+        }
+        index = special + 1;
+    }
+}
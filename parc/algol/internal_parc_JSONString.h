@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Patent rights are not granted under this agreement. Patent rights are
+ *       available under FRAND terms.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX or PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * @file internal_parc_JSONString.h
+ * @ingroup types
+ * @brief Scanning and escaping kernels for JSON string values.
+ *
+ * JSON string values are mostly plain runs of bytes that need neither escaping nor unescaping.
+ * These functions find the end of such a run 16 or 32 bytes at a time,
+ * so that the parser and the serializers can copy whole runs instead of handling one byte at a time.
+ *
+ * @copyright 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC).  All rights reserved.
+ */
+#ifndef libparc_internal_parc_JSONString_h
+#define libparc_internal_parc_JSONString_h
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <parc/algol/parc_BufferComposer.h>
+
+/**
+ * Find the first byte of a JSON string that is not plain text.
+ *
+ * The special bytes are the quotation mark, the reverse solidus, the control characters (0x00 - 0x1F and 0x7F)
+ * and, if @p solidus is true, the solidus '/'.
+ * On x86 processors supporting AVX2 this examines 32 bytes per step, otherwise 16 bytes with SSE2.
+ *
+ * @param [in] length The number of bytes in @p bytes.
+ * @param [in] bytes The bytes to scan.
+ * @param [in] solidus If true, the solidus '/' is also special.
+ *
+ * @return The index of the first special byte, or @p length if there is none.
+ *
+ * Example:
+ * @code
+ * {
+ *     const char *text = "abc\"def";
+ *     size_t index = internal_parcJSONString_Scan(strlen(text), (const uint8_t *) text, false);
+ *     // index is 3
+ * }
+ * @endcode
+ */
+size_t internal_parcJSONString_Scan(size_t length, const uint8_t bytes[length], bool solidus);
+
+/**
+ * Append the JSON escaped form of the given bytes to a `PARCBufferComposer`.
+ *
+ * The quotation mark, reverse solidus, backspace, form feed, newline, carriage return and tab are escaped,
+ * as is the solidus if @p solidus is true.
+ * All other bytes, including other control characters, are appended unchanged.
+ * The surrounding quotation marks are not appended.
+ *
+ * @param [in] composer The `PARCBufferComposer` to append to.
+ * @param [in] length The number of bytes in @p bytes.
+ * @param [in] bytes The bytes to escape.
+ * @param [in] solidus If true, escape the solidus '/' as "\/".
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCBufferComposer *composer = parcBufferComposer_Create();
+ *     internal_parcJSONString_Escape(composer, 5, (const uint8_t *) "a\"b/c", true);
+ *     // composer contains a\"b\/c
+ *     parcBufferComposer_Release(&composer);
+ * }
+ * @endcode
+ */
+void internal_parcJSONString_Escape(PARCBufferComposer *composer, size_t length, const uint8_t bytes[length], bool solidus);
+#endif // libparc_internal_parc_JSONString_h
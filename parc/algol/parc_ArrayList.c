@@ -34,6 +34,8 @@
 
 #include <stdbool.h>
 #include <string.h>
+#include <unistd.h>
+#include <pthread.h>
 
 #include <LongBow/runtime.h>
 
@@ -392,3 +394,297 @@ parcArrayList_Clear(PARCArrayList *array)
         parcArrayList_RemoveAndDestroyAtIndex(array, parcArrayList_Size(array) - 1);
     }
 }
+
+/*
+ * Partitions smaller than this are finished with an insertion sort.
+ */
+#define _PARCArrayList_InsertionSortThreshold 16
+
+/*
+ * The minimum number of elements each thread of a parallel sort is given.
+ * Below this the cost of creating a thread outweighs the work it does.
+ */
+#define _PARCArrayList_ParallelSortMinimumPartition 4096
+
+static inline void
+_parcArrayList_Swap(void **array, size_t a, size_t b)
+{
+    void *temp = array[a];
+    array[a] = array[b];
+    array[b] = temp;
+}
+
+static void
+_parcArrayList_InsertionSort(void **array, size_t length, PARCObjectCompare *compare)
+{
+    for (size_t i = 1; i < length; i++) {
+        void *element = array[i];
+        size_t j = i;
+        while (j > 0 && compare(element, array[j - 1]) < 0) {
+            array[j] = array[j - 1];
+            j--;
+        }
+        array[j] = element;
+    }
+}
+
+static void
+_parcArrayList_SiftDown(void **array, size_t root, size_t length, PARCObjectCompare *compare)
+{
+    for (size_t child = 2 * root + 1; child < length; child = 2 * root + 1) {
+        if (child + 1 < length && compare(array[child], array[child + 1]) < 0) {
+            child++;
+        }
+        if (compare(array[root], array[child]) >= 0) {
+            break;
+        }
+        _parcArrayList_Swap(array, root, child);
+        root = child;
+    }
+}
+
+static void
+_parcArrayList_HeapSort(void **array, size_t length, PARCObjectCompare *compare)
+{
+    for (size_t i = length / 2; i > 0; i--) {
+        _parcArrayList_SiftDown(array, i - 1, length, compare);
+    }
+    for (size_t end = length - 1; end > 0; end--) {
+        _parcArrayList_Swap(array, 0, end);
+        _parcArrayList_SiftDown(array, 0, end, compare);
+    }
+}
+
+/*
+ * Hoare partition around the median of the first, middle and last elements.
+ * Returns the index of the last element of the lower partition, which is always less than length - 1.
+ */
+static size_t
+_parcArrayList_Partition(void **array, size_t length, PARCObjectCompare *compare)
+{
+    size_t middle = (length - 1) / 2;
+
+    if (compare(array[middle], array[0]) < 0) {
+        _parcArrayList_Swap(array, middle, 0);
+    }
+    if (compare(array[length - 1], array[0]) < 0) {
+        _parcArrayList_Swap(array, length - 1, 0);
+    }
+    if (compare(array[length - 1], array[middle]) < 0) {
+        _parcArrayList_Swap(array, length - 1, middle);
+    }
+
+    void *pivot = array[middle];
+    size_t i = 0;
+    size_t j = length - 1;
+    for (;;) {
+        while (compare(array[i], pivot) < 0) {
+            i++;
+        }
+        while (compare(array[j], pivot) > 0) {
+            j--;
+        }
+        if (i >= j) {
+            return j;
+        }
+        _parcArrayList_Swap(array, i, j);
+        i++;
+        j--;
+    }
+}
+
+static void
+_parcArrayList_IntroSort(void **array, size_t length, size_t depthLimit, PARCObjectCompare *compare)
+{
+    while (length > _PARCArrayList_InsertionSortThreshold) {
+        if (depthLimit == 0) {
+            _parcArrayList_HeapSort(array, length, compare);
+            return;
+        }
+        depthLimit--;
+
+        size_t split = _parcArrayList_Partition(array, length, compare) + 1;
+
+        // Recurse into the smaller partition and loop on the larger to bound the stack depth.
+        if (split < length - split) {
+            _parcArrayList_IntroSort(array, split, depthLimit, compare);
+            array += split;
+            length -= split;
+        } else {
+            _parcArrayList_IntroSort(array + split, length - split, depthLimit, compare);
+            length = split;
+        }
+    }
+    _parcArrayList_InsertionSort(array, length, compare);
+}
+
+static void
+_parcArrayList_SortArray(void **array, size_t length, PARCObjectCompare *compare)
+{
+    size_t depthLimit = 0;
+    for (size_t n = length; n > 1; n >>= 1) {
+        depthLimit += 2;
+    }
+    _parcArrayList_IntroSort(array, length, depthLimit, compare);
+}
+
+void
+parcArrayList_Sort(PARCArrayList *array, PARCObjectCompare *compare)
+{
+    parcArrayList_OptionalAssertValid(array);
+    assertNotNull(compare, "The compare function must be a non-null pointer.");
+
+    if (array->numberOfElements > 1) {
+        _parcArrayList_SortArray(array->array, array->numberOfElements, compare);
+    }
+}
+
+typedef struct {
+    void **source;
+    void **destination;
+    size_t start;
+    size_t middle;
+    size_t end;
+    PARCObjectCompare *compare;
+} _PARCArrayListSortTask;
+
+static void *
+_parcArrayList_SortTask(void *arg)
+{
+    _PARCArrayListSortTask *task = arg;
+    _parcArrayList_SortArray(&task->source[task->start], task->end - task->start, task->compare);
+    return NULL;
+}
+
+static void *
+_parcArrayList_MergeTask(void *arg)
+{
+    _PARCArrayListSortTask *task = arg;
+
+    size_t left = task->start;
+    size_t right = task->middle;
+    size_t out = task->start;
+
+    while (left < task->middle && right < task->end) {
+        if (task->compare(task->source[right], task->source[left]) < 0) {
+            task->destination[out++] = task->source[right++];
+        } else {
+            task->destination[out++] = task->source[left++];
+        }
+    }
+    memcpy(&task->destination[out], &task->source[left], (task->middle - left) * sizeof(void *));
+    out += task->middle - left;
+    memcpy(&task->destination[out], &task->source[right], (task->end - right) * sizeof(void *));
+
+    return NULL;
+}
+
+/*
+ * Run each task on its own thread, the last one on the calling thread, and wait for them all.
+ * A task whose thread cannot be created is run on the calling thread instead.
+ */
+static void
+_parcArrayList_RunTasks(_PARCArrayListSortTask *tasks, size_t count, void *(*function)(void *))
+{
+    pthread_t *threads = parcMemory_Allocate(count * sizeof(pthread_t));
+    assertNotNull(threads, "parcMemory_Allocate(%zu) returned NULL", count * sizeof(pthread_t));
+    bool *started = parcMemory_AllocateAndClear(count * sizeof(bool));
+    assertNotNull(started, "parcMemory_AllocateAndClear(%zu) returned NULL", count * sizeof(bool));
+
+    for (size_t i = 0; i + 1 < count; i++) {
+        started[i] = (pthread_create(&threads[i], NULL, function, &tasks[i]) == 0);
+        if (!started[i]) {
+            function(&tasks[i]);
+        }
+    }
+    function(&tasks[count - 1]);
+
+    for (size_t i = 0; i + 1 < count; i++) {
+        if (started[i]) {
+            pthread_join(threads[i], NULL);
+        }
+    }
+
+    parcMemory_Deallocate((void **) &started);
+    parcMemory_Deallocate((void **) &threads);
+}
+
+void
+parcArrayList_ParallelSort(PARCArrayList *array, PARCObjectCompare *compare, size_t threadCount)
+{
+    parcArrayList_OptionalAssertValid(array);
+    assertNotNull(compare, "The compare function must be a non-null pointer.");
+
+    if (threadCount == 0) {
+        long processors = sysconf(_SC_NPROCESSORS_ONLN);
+        threadCount = (processors > 0) ? (size_t) processors : 1;
+    }
+
+    size_t length = array->numberOfElements;
+    size_t partitions = length / _PARCArrayList_ParallelSortMinimumPartition;
+    if (partitions > threadCount) {
+        partitions = threadCount;
+    }
+
+    if (partitions < 2) {
+        parcArrayList_Sort(array, compare);
+        return;
+    }
+
+    // Sort each partition independently.
+    size_t *bounds = parcMemory_Allocate((partitions + 1) * sizeof(size_t));
+    assertNotNull(bounds, "parcMemory_Allocate(%zu) returned NULL", (partitions + 1) * sizeof(size_t));
+    _PARCArrayListSortTask *tasks = parcMemory_Allocate(partitions * sizeof(_PARCArrayListSortTask));
+    assertNotNull(tasks, "parcMemory_Allocate(%zu) returned NULL", partitions * sizeof(_PARCArrayListSortTask));
+
+    for (size_t i = 0; i <= partitions; i++) {
+        bounds[i] = (length * i) / partitions;
+    }
+    for (size_t i = 0; i < partitions; i++) {
+        tasks[i] = (_PARCArrayListSortTask) {
+            .source = array->array, .start = bounds[i], .end = bounds[i + 1], .compare = compare
+        };
+    }
+    _parcArrayList_RunTasks(tasks, partitions, _parcArrayList_SortTask);
+
+    // Merge adjacent runs pairwise, in parallel, until a single run remains.
+    void **scratch = parcMemory_Allocate(length * sizeof(void *));
+    assertNotNull(scratch, "parcMemory_Allocate(%zu) returned NULL", length * sizeof(void *));
+
+    void **source = array->array;
+    void **destination = scratch;
+    size_t runs = partitions;
+    while (runs > 1) {
+        size_t merges = 0;
+        for (size_t i = 0; i + 1 < runs; i += 2) {
+            tasks[merges++] = (_PARCArrayListSortTask) {
+                .source = source, .destination = destination,
+                .start = bounds[i], .middle = bounds[i + 1], .end = bounds[i + 2], .compare = compare
+            };
+        }
+        if (runs % 2 == 1) {
+            size_t start = bounds[runs - 1];
+            memcpy(&destination[start], &source[start], (length - start) * sizeof(void *));
+        }
+        _parcArrayList_RunTasks(tasks, merges, _parcArrayList_MergeTask);
+
+        size_t newRuns = 0;
+        for (size_t i = 0; i < runs; i += 2) {
+            bounds[newRuns++] = bounds[i];
+        }
+        bounds[newRuns] = length;
+        runs = newRuns;
+
+        void **temp = source;
+        source = destination;
+        destination = temp;
+    }
+
+    if (source != array->array) {
+        memcpy(array->array, source, length * sizeof(void *));
+    }
+
+    parcMemory_Deallocate((void **) &scratch);
+    parcMemory_Deallocate((void **) &tasks);
+    parcMemory_Deallocate((void **) &bounds);
+}
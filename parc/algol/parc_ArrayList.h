@@ -41,6 +41,7 @@
 #include <stdint.h>
 #include <stdbool.h>
 
+#include <parc/algol/parc_Object.h>
 #include <parc/algol/parc_List.h>
 #include <parc/algol/parc_Iterator.h>
 
@@ -587,4 +588,58 @@ void *parcArrayList_Push(PARCArrayList *list, void *item);
  * @endcode
  */
 int parcArrayList_Search(PARCArrayList *list, void *element);
+
+/**
+ * Sort the elements of a `PARCArrayList` in place into ascending order.
+ *
+ * The sort is an introsort: a median-of-three quicksort that falls back to heapsort when
+ * the recursion gets too deep, finishing small partitions with an insertion sort.
+ * It runs in O(n log n) time in the worst case, uses no additional heap memory, and is not stable.
+ *
+ * @param [in,out] array A pointer to a valid `PARCArrayList` instance.
+ * @param [in] compare A function returning a signum comparison of two elements.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCArrayList *list = parcArrayList_Create((void (*)(void **))parcObject_Release);
+ *     ...
+ *     parcArrayList_Sort(list, parcObject_Compare);
+ *
+ *     parcArrayList_Destroy(&list);
+ * }
+ * @endcode
+ *
+ * @see parcArrayList_ParallelSort
+ */
+void parcArrayList_Sort(PARCArrayList *array, PARCObjectCompare *compare);
+
+/**
+ * Sort the elements of a `PARCArrayList` in place into ascending order using multiple threads.
+ *
+ * The list is divided into at most `threadCount` partitions which are sorted concurrently with
+ * {@link parcArrayList_Sort}, and the sorted partitions are then merged pairwise, also concurrently.
+ * Lists too small to benefit from more than one thread are sorted on the calling thread.
+ *
+ * The merge requires a temporary array of the same length as the list.
+ * The compare function is called concurrently from several threads and must be thread-safe.
+ *
+ * @param [in,out] array A pointer to a valid `PARCArrayList` instance.
+ * @param [in] compare A function returning a signum comparison of two elements.
+ * @param [in] threadCount The maximum number of threads to use, or 0 to use the number of online processors.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCArrayList *list = parcArrayList_Create((void (*)(void **))parcObject_Release);
+ *     ...
+ *     parcArrayList_ParallelSort(list, parcObject_Compare, 0);
+ *
+ *     parcArrayList_Destroy(&list);
+ * }
+ * @endcode
+ *
+ * @see parcArrayList_Sort
+ */
+void parcArrayList_ParallelSort(PARCArrayList *array, PARCObjectCompare *compare, size_t threadCount);
 #endif // libparc_parc_ArrayList_h
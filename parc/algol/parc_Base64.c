@@ -56,8 +56,15 @@
 
 #include <parc/algol/parc_Base64.h>
 #include <parc/algol/parc_Memory.h>
+#include <parc/algol/parc_Object.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#  include <immintrin.h>
+#  define _PARCBase64_SSSE3 1
+#endif
 
 const uint8_t base64code[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+const uint8_t base64urlcode[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
 const uint8_t pad = '=';
 
 const uint8_t invalid = '~';       // has ascii value 127, outside base64
@@ -84,120 +91,402 @@ const uint8_t decodeTable[256] = {
     '~',       '~', '~', '~', '~', '~', '~', '~', '~', '~', '~', '~', '~', '~', '~', '~'
 };
 
-#define min(a, b) ((a < b) ? a : b)
+// The same, for the URL and filename safe alphabet of RFC 4648, Section 5: '-' and '_' replace '+' and '/'.
+const uint8_t decodeURLTable[256] = {
+/*   0 */ '~', '~', '~', '~', '~', '~', '~', '~', '~', '~', '_', '~', '~', '_', '~', '~',
+/*  16 */ '~', '~', '~', '~', '~', '~', '~', '~', '~', '~', '~', '~', '~', '~', '~', '~',
+/*  32 */ '~', '~', '~', '~', '~', '~', '~', '~', '~', '~', '~', '~', '~', 62,  '~', '~',
+/*  48 */ 52,  53,  54,  55,  56,  57,  58,  59,  60,  61,  '~', '~', '~', '~', '~', '~',
+/*  64 */ '~', 0,   1,   2,   3,   4,   5,   6,   7,   8,   9,   10,  11,  12,  13,  14,
+/*  80 */ 15,  16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  '~', '~', '~', '~', 63,
+/*  96 */ '~', 26,  27,  28,  29,  30,  31,  32,  33,  34,  35,  36,  37,  38,  39,  40,
+/* 112 */ 41,  42,  43,  44,  45,  46,  47,  48,  49,  50,  51,  '~', '~', '~', '~', '~',
+/* 128 */ '~', '~', '~', '~', '~', '~', '~', '~', '~', '~', '~', '~', '~', '~', '~', '~',
+    '~',       '~', '~', '~', '~', '~', '~', '~', '~', '~', '~', '~', '~', '~', '~', '~',
+    '~',       '~', '~', '~', '~', '~', '~', '~', '~', '~', '~', '~', '~', '~', '~', '~',
+    '~',       '~', '~', '~', '~', '~', '~', '~', '~', '~', '~', '~', '~', '~', '~', '~',
+    '~',       '~', '~', '~', '~', '~', '~', '~', '~', '~', '~', '~', '~', '~', '~', '~',
+    '~',       '~', '~', '~', '~', '~', '~', '~', '~', '~', '~', '~', '~', '~', '~', '~',
+    '~',       '~', '~', '~', '~', '~', '~', '~', '~', '~', '~', '~', '~', '~', '~', '~',
+    '~',       '~', '~', '~', '~', '~', '~', '~', '~', '~', '~', '~', '~', '~', '~', '~'
+};
+
+/*
+ * An alphabet: the 64 symbols, the decode table, and whether encoded text is padded to whole quanta.
+ * The standard alphabet always pads; the URL-safe alphabet never pads, and accepts input with or without padding.
+ */
+typedef struct {
+    const uint8_t *code;
+    const uint8_t *decodeTable;
+    bool padded;
+} _PARCBase64Alphabet;
 
-/**
- * Encode the 3-byte quantum pointed to by <code>quantum</code> into 4 encoded characters.
- * It includes `padLength` of pad necessary at the end.
+static const _PARCBase64Alphabet _parcBase64_Standard = { .code = base64code, .decodeTable = decodeTable, .padded = true };
+static const _PARCBase64Alphabet _parcBase64_URL = { .code = base64urlcode, .decodeTable = decodeURLTable, .padded = false };
+
+/*
+ * The maximum length of the encoding of `length` bytes.
  */
-static void
-_encodeWithPad(PARCBufferComposer *output, const uint8_t *quantum, size_t padLength)
+static inline size_t
+_encodedLength(size_t length)
 {
-    assertTrue(padLength < 3, "Degenerate case -- should never pad all 3 bytes!");
-
-    unsigned index;
-
-    uint8_t paddedQuantum[] = { 0, 0, 0 };
-    memcpy(paddedQuantum, quantum, 3 - padLength);
-
-    for (index = 0; index < 4; index++) {
-        if (index + padLength < 4) {
-            /*
-             * The four base64 symbols fall in to these locations in the
-             * 3-byte input
-             *
-             * aaaaaabb | bbbbcccc | ccdddddd
-             *
-             * This switch statement, based on the "a" "b" "c" or "d" case
-             * extracts the corresponding 6 bits from its location in the
-             * byte aray.
-             */
-            int sixbit = 0;
-            switch (index) {
-                case 0: // aaaaaa
-                    sixbit = paddedQuantum[0] >> 2;
-                    break;
-
-                case 1: // bbbbbb
-                    sixbit = ((paddedQuantum[0] & 0x03) << 4) | (paddedQuantum[1] >> 4);
-                    break;
-
-                case 2: // cccccc
-                    sixbit = ((paddedQuantum[1] & 0x0F) << 2) | (paddedQuantum[2] >> 6);
-                    break;
-
-                case 3: // dddddd
-                    sixbit = paddedQuantum[2] & 0x3F;
-                    break;
-            }
-            uint8_t encodedChar = base64code[ sixbit ];
-            parcBufferComposer_PutUint8(output, encodedChar);
-        } else {
-            parcBufferComposer_PutUint8(output, pad);
+    return ((length + 2) / 3) * 4;
+}
+
+/*
+ * Encode the final 1 or 2 bytes of the plaintext, padding if the alphabet requires it.
+ * Return the number of characters written.
+ */
+static size_t
+_encodeTail(const _PARCBase64Alphabet *alphabet, uint8_t *output, const uint8_t *quantum, size_t length)
+{
+    assertTrue(length > 0 && length < 3, "Degenerate case -- the tail is 1 or 2 bytes, not %zu", length);
+
+    uint32_t word = (uint32_t) quantum[0] << 16;
+    if (length == 2) {
+        word |= (uint32_t) quantum[1] << 8;
+    }
+
+    size_t result = 0;
+    output[result++] = alphabet->code[word >> 18];
+    output[result++] = alphabet->code[(word >> 12) & 0x3F];
+    if (length == 2) {
+        output[result++] = alphabet->code[(word >> 6) & 0x3F];
+    }
+    if (alphabet->padded) {
+        while (result < 4) {
+            output[result++] = pad;
         }
     }
+    return result;
 }
 
-/**
- * Decode the 4-byte quantum of base64 to binary.
+/*
+ * Encode whole 3-byte quanta, four table lookups each. Return the number of input bytes consumed.
+ *
+ * The four base64 symbols fall in to these locations in the 3-byte input
+ *
+ * aaaaaabb | bbbbcccc | ccdddddd
  */
-static bool
-_decode(PARCBufferComposer *output, uint8_t *quantum)
+static size_t
+_encodeScalar(const _PARCBase64Alphabet *alphabet, uint8_t *output, size_t length, const uint8_t *input)
 {
-    uint8_t threebytes[3] = { 0, 0, 0 };
-    size_t length_to_append = 0;
+    const uint8_t *code = alphabet->code;
+    size_t offset = 0;
+    for (; offset + 3 <= length; offset += 3) {
+        uint32_t word = (uint32_t) input[offset] << 16 | (uint32_t) input[offset + 1] << 8 | input[offset + 2];
+        output[0] = code[word >> 18];
+        output[1] = code[(word >> 12) & 0x3F];
+        output[2] = code[(word >> 6) & 0x3F];
+        output[3] = code[word & 0x3F];
+        output += 4;
+    }
+    return offset;
+}
+
+/*
+ * Decode a 4-byte quantum of base64 (which may end in padding) to binary.
+ * Return the number of bytes written to `output`, or -1 if there is a non-base64 character.
+ *
+ * The four base64 symbols fall in to these locations in the final 3-byte output
+ *
+ * aaaaaabb | bbbbcccc | ccdddddd
+ */
+static int
+_decodeQuantum(const _PARCBase64Alphabet *alphabet, uint8_t *output, const uint8_t quantum[4])
+{
+    uint32_t word = 0;
+    int symbols = 0;
 
     for (int index = 0; index < 4; index++) {
         uint8_t c = quantum[index];
         if (c != pad) {
-            uint8_t value = decodeTable[c];
+            uint8_t value = alphabet->decodeTable[c];
 
             // if its a non-base64 character, bail out of here
-            if (value == invalid) {
-                return false;
+            if (value >= 64) {
+                return -1;
             }
+            word |= (uint32_t) value << (18 - 6 * index);
+            symbols = index + 1;
+        }
+    }
+
+    // One symbol finishes no bytes, two finish the first, three the second and four the third.
+    int result = (symbols > 0) ? symbols - 1 : 0;
+    for (int i = 0; i < result; i++) {
+        output[i] = (uint8_t) (word >> (16 - 8 * i));
+    }
+    return result;
+}
+
+/*
+ * Gather base64 characters from `array`, starting at `*offset`, into `quantum` until it holds 4,
+ * skipping CR and LF.
+ * Return the number of characters in `quantum`, which is fewer than 4 only at the end of the input,
+ * or -1 if there is a non-base64 character.
+ */
+static int
+_gatherQuantum(const _PARCBase64Alphabet *alphabet, uint8_t quantum[4], int count, size_t length, const uint8_t array[length], size_t *offset)
+{
+    while (count < 4 && *offset < length) {
+        uint8_t c = array[*offset];
+        uint8_t decoded = alphabet->decodeTable[c];
+
+        if (decoded < 64 || c == pad) {
+            quantum[count++] = c;
+        } else if (decoded != skip) {
+            return -1;
+        }
+        (*offset)++;
+    }
+    return count;
+}
+
+#if defined(_PARCBase64_SSSE3)
+/*
+ * 12 bytes of plaintext to 16 characters per step, after Wojciech Mula's SSSE3 base64 encoder:
+ * the bytes of each 3-byte group are spread over a 32-bit lane, the four 6-bit indices are isolated
+ * with two multiplies, and each index is mapped to its character by adding an offset chosen with a shuffle.
+ */
+__attribute__((target("ssse3")))
+static size_t
+_encodeSSSE3(const _PARCBase64Alphabet *alphabet, uint8_t *output, size_t length, const uint8_t *input)
+{
+    const __m128i spread = _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1);
+    const __m128i offsets = _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                                          '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                                          (char) (alphabet->code[62] - 62), (char) (alphabet->code[63] - 63),
+                                          'A', 0, 0);
+    size_t offset = 0;
+    for (; offset + 16 <= length; offset += 12) {
+        __m128i in = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *) &input[offset]), spread);
+
+        __m128i ac = _mm_mulhi_epu16(_mm_and_si128(in, _mm_set1_epi32(0x0FC0FC00)), _mm_set1_epi32(0x04000040));
+        __m128i bd = _mm_mullo_epi16(_mm_and_si128(in, _mm_set1_epi32(0x003F03F0)), _mm_set1_epi32(0x01000010));
+        __m128i indices = _mm_or_si128(ac, bd);
+
+        __m128i reduced = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+        __m128i upper = _mm_cmpgt_epi8(_mm_set1_epi8(26), indices);
+        reduced = _mm_or_si128(reduced, _mm_and_si128(upper, _mm_set1_epi8(13)));
+
+        __m128i characters = _mm_add_epi8(_mm_shuffle_epi8(offsets, reduced), indices);
+        _mm_storeu_si128((__m128i *) output, characters);
+        output += 16;
+    }
+    return offset;
+}
+
+static inline __m128i
+_inRange(__m128i c, char low, char high)
+{
+    return _mm_and_si128(_mm_cmpgt_epi8(c, _mm_set1_epi8(low - 1)), _mm_cmpgt_epi8(_mm_set1_epi8(high + 1), c));
+}
+
+/*
+ * 16 characters to 12 bytes per step, stopping at the first block that is not 16 base64 symbols
+ * (a line break, padding or an invalid character), which is left to the scalar decoder.
+ * Each step stores 16 bytes, so `output` must have 4 bytes to spare.
+ * Return the number of characters consumed.
+ */
+__attribute__((target("ssse3")))
+static size_t
+_decodeSSSE3(const _PARCBase64Alphabet *alphabet, uint8_t *output, size_t length, const uint8_t *input)
+{
+    const __m128i symbol62 = _mm_set1_epi8((char) alphabet->code[62]);
+    const __m128i symbol63 = _mm_set1_epi8((char) alphabet->code[63]);
+    const __m128i gather = _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+
+    size_t offset = 0;
+    for (; offset + 16 <= length; offset += 16) {
+        __m128i c = _mm_loadu_si128((const __m128i *) &input[offset]);
+
+        __m128i upper = _inRange(c, 'A', 'Z');
+        __m128i lower = _inRange(c, 'a', 'z');
+        __m128i digit = _inRange(c, '0', '9');
+        __m128i is62 = _mm_cmpeq_epi8(c, symbol62);
+        __m128i is63 = _mm_cmpeq_epi8(c, symbol63);
+
+        __m128i valid = _mm_or_si128(_mm_or_si128(upper, lower), _mm_or_si128(_mm_or_si128(digit, is62), is63));
+        if (_mm_movemask_epi8(valid) != 0xFFFF) {
+            break;
+        }
+
+        __m128i shift = _mm_or_si128(_mm_and_si128(upper, _mm_set1_epi8(-'A')),
+                                     _mm_and_si128(lower, _mm_set1_epi8(26 - 'a')));
+        shift = _mm_or_si128(shift, _mm_and_si128(digit, _mm_set1_epi8(52 - '0')));
+        shift = _mm_or_si128(shift, _mm_and_si128(is62, _mm_set1_epi8((char) (62 - alphabet->code[62]))));
+        shift = _mm_or_si128(shift, _mm_and_si128(is63, _mm_set1_epi8((char) (63 - alphabet->code[63]))));
+        __m128i values = _mm_add_epi8(c, shift);
+
+        // Join pairs of 6-bit values into 12 bits, then pairs of those into 24, and put the bytes in order.
+        __m128i pairs = _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+        __m128i words = _mm_madd_epi16(pairs, _mm_set1_epi32(0x00011000));
+        _mm_storeu_si128((__m128i *) output, _mm_shuffle_epi8(words, gather));
+        output += 12;
+    }
+    return offset;
+}
+
+static inline bool
+_useSSSE3(void)
+{
+    return __builtin_cpu_supports("ssse3");
+}
+#endif
+
+static size_t
+_encode(const _PARCBase64Alphabet *alphabet, uint8_t *output, size_t length, const uint8_t array[length])
+{
+    size_t offset = 0;
+    uint8_t *start = output;
+
+#if defined(_PARCBase64_SSSE3)
+    if (_useSSSE3()) {
+        offset = _encodeSSSE3(alphabet, output, length, array);
+        output += offset / 3 * 4;
+    }
+#endif
+    size_t consumed = _encodeScalar(alphabet, output, length - offset, &array[offset]);
+    output += consumed / 3 * 4;
+    offset += consumed;
+
+    if (offset < length) {
+        output += _encodeTail(alphabet, output, &array[offset], length - offset);
+    }
+    return (size_t) (output - start);
+}
+
+/*
+ * Decode `array` to `output`, which has room for `_decodedLength(length)` bytes.
+ * Characters of a final quantum cut short by the end of the input are left in `partial`.
+ * Return false if there is a non-base64 character.
+ */
+static bool
+_decodeRun(const _PARCBase64Alphabet *alphabet, uint8_t *output, size_t *outputLength,
+           size_t length, const uint8_t array[length], uint8_t partial[4], int *partialLength)
+{
+    const uint8_t *table = alphabet->decodeTable;
+    uint8_t *start = output;
+    size_t offset = 0;
+
+#if defined(_PARCBase64_SSSE3)
+    bool vector = _useSSSE3();
+#endif
+
+    *partialLength = 0;
 
-            /*
-             * The four base64 symbols fall in to these locations in the
-             * final 3-byte output
-             *
-             * aaaaaabb | bbbbcccc | ccdddddd
-             */
-            switch (index) {
-                case 0: // aaaaaa
-                    threebytes[0] |= value << 2;
-                    break;
-
-                case 1: // bbbbbb
-                    threebytes[0] |= (value & 0x30) >> 4;
-                    threebytes[1] |= (value & 0x0F) << 4;
-
-                    // we've finished threebytes[0]
-                    length_to_append = 1;
-                    break;
-
-                case 2: // cccccc
-                    threebytes[1] |= value >> 2;
-                    threebytes[2] |= (value & 0x03) << 6;
-
-                    // we've finished threebytes[1]
-                    length_to_append = 2;
-                    break;
-
-                case 3: // dddddd
-                    threebytes[2] |= value;
-
-                    // we've finished threebytes[2]
-                    length_to_append = 3;
-                    break;
+    while (offset < length) {
+#if defined(_PARCBase64_SSSE3)
+        if (vector && offset + 16 <= length) {
+            size_t consumed = _decodeSSSE3(alphabet, output, length - offset, &array[offset]);
+            output += consumed / 4 * 3;
+            offset += consumed;
+        }
+#endif
+        // A quantum of four symbols, the common case.
+        if (offset + 4 <= length) {
+            uint8_t a = table[array[offset]];
+            uint8_t b = table[array[offset + 1]];
+            uint8_t c = table[array[offset + 2]];
+            uint8_t d = table[array[offset + 3]];
+            if (((a | b | c | d) & 0xC0) == 0) {
+                uint32_t word = (uint32_t) a << 18 | (uint32_t) b << 12 | (uint32_t) c << 6 | d;
+                output[0] = (uint8_t) (word >> 16);
+                output[1] = (uint8_t) (word >> 8);
+                output[2] = (uint8_t) word;
+                output += 3;
+                offset += 4;
+                continue;
             }
         }
+
+        // Line breaks, padding, or the end of the input.
+        uint8_t quantum[4];
+        int count = _gatherQuantum(alphabet, quantum, 0, length, array, &offset);
+        if (count < 0) {
+            return false;
+        }
+        if (count < 4) {
+            memcpy(partial, quantum, (size_t) count);
+            *partialLength = count;
+            break;
+        }
+        int decoded = _decodeQuantum(alphabet, output, quantum);
+        if (decoded < 0) {
+            return false;
+        }
+        output += decoded;
     }
 
-    parcBufferComposer_PutArray(output, threebytes, length_to_append);
+    *outputLength = (size_t) (output - start);
     return true;
 }
 
+/*
+ * The maximum length of the decoding of `length` characters, with room for the vector decoder's wide stores.
+ */
+static inline size_t
+_decodedLength(size_t length)
+{
+    return (length / 4) * 3 + 3 + 4;
+}
+
+/*
+ * Decode the characters of an incomplete final quantum.
+ * Only an alphabet that does not require padding accepts them, and then only 2 or 3 of them.
+ */
+static int
+_decodePartial(const _PARCBase64Alphabet *alphabet, uint8_t *output, const uint8_t partial[4], int partialLength)
+{
+    if (partialLength == 0) {
+        return 0;
+    }
+    if (alphabet->padded || partialLength < 2) {
+        return -1;
+    }
+    uint8_t quantum[4] = { pad, pad, pad, pad };
+    memcpy(quantum, partial, (size_t) partialLength);
+    return _decodeQuantum(alphabet, output, quantum);
+}
+
+static PARCBufferComposer *
+_encodeArray(const _PARCBase64Alphabet *alphabet, PARCBufferComposer *output, size_t length, const uint8_t array[length])
+{
+    if (length > 0) {
+        uint8_t *space = parcBufferComposer_Reserve(output, _encodedLength(length));
+        if (space == NULL) {
+            return NULL;
+        }
+        parcBufferComposer_Commit(output, _encode(alphabet, space, length, array));
+    }
+    return output;
+}
+
+static PARCBufferComposer *
+_decodeArray(const _PARCBase64Alphabet *alphabet, PARCBufferComposer *output, size_t length, const uint8_t array[length])
+{
+    // Nothing is appended to the output unless all of the input decodes.
+    uint8_t *space = parcBufferComposer_Reserve(output, _decodedLength(length));
+    if (space == NULL) {
+        return NULL;
+    }
+
+    size_t decodedLength = 0;
+    uint8_t partial[4];
+    int partialLength;
+
+    if (!_decodeRun(alphabet, space, &decodedLength, length, array, partial, &partialLength)) {
+        return NULL;
+    }
+    int tail = _decodePartial(alphabet, &space[decodedLength], partial, partialLength);
+    if (tail < 0) {
+        return NULL;
+    }
+
+    return parcBufferComposer_Commit(output, decodedLength + (size_t) tail);
+}
+
 PARCBufferComposer *
 parcBase64_Encode(PARCBufferComposer *result, PARCBuffer *plainText)
 {
@@ -213,17 +502,7 @@ parcBase64_Encode(PARCBufferComposer *result, PARCBuffer *plainText)
 PARCBufferComposer *
 parcBase64_EncodeArray(PARCBufferComposer *output, size_t length, const uint8_t array[length])
 {
-    size_t offset = 0;
-
-    // Encode 3-byte tuples
-    while (offset < length) {
-        const uint8_t *quantum = array + offset;
-        size_t padLength = 3 - min(3, length - offset);
-        _encodeWithPad(output, quantum, padLength);
-        offset += 3;
-    }
-
-    return output;
+    return _encodeArray(&_parcBase64_Standard, output, length, array);
 }
 
 PARCBufferComposer *
@@ -248,56 +527,123 @@ parcBase64_DecodeString(PARCBufferComposer *output, const char *encodedString)
 PARCBufferComposer *
 parcBase64_DecodeArray(PARCBufferComposer *output, size_t length, const uint8_t array[length])
 {
-    size_t offset = 0;
-    bool success = true;
+    return _decodeArray(&_parcBase64_Standard, output, length, array);
+}
 
-    // if we need to rollback, this is where we go
-    PARCBuffer *outputBuffer = parcBufferComposer_GetBuffer(output);
-    size_t rewind_to = parcBuffer_Position(outputBuffer);
+PARCBufferComposer *
+parcBase64URL_Encode(PARCBufferComposer *output, PARCBuffer *plainText)
+{
+    size_t remaining = parcBuffer_Remaining(plainText);
+    return _encodeArray(&_parcBase64_URL, output, remaining, parcBuffer_Overlay(plainText, 0));
+}
 
-    while (offset < length && success) {
-        // filter out line feeds and carrage returns
-        // parse the input in 4-byte quantums
-        size_t index = 0;
-        uint8_t quantum[4];
+PARCBufferComposer *
+parcBase64URL_EncodeArray(PARCBufferComposer *output, size_t length, const uint8_t array[length])
+{
+    return _encodeArray(&_parcBase64_URL, output, length, array);
+}
 
-        // reset success at the start of each loop.  if we run out of input before
-        // we parse a full quantum, we'll fail the loop and rewind the output buffer.
-        success = false;
-
-        // 4 == quantum length for decode
-        while (index < 4 && offset < length) {
-            uint8_t c = array[offset];
-            uint8_t decoded = decodeTable[c];
-
-            if (decoded < 64 || c == pad) {
-                // this is an artifact from how the code was first written, so we
-                // pass the un-decoded character
-                quantum[index] = c;
-                index++;
-                offset++;
-                continue;
-            }
+PARCBufferComposer *
+parcBase64URL_Decode(PARCBufferComposer *output, PARCBuffer *encodedText)
+{
+    size_t remaining = parcBuffer_Remaining(encodedText);
+    const uint8_t *buffer = parcBuffer_Overlay(encodedText, remaining);
+    return _decodeArray(&_parcBase64_URL, output, remaining, buffer);
+}
 
-            if (decoded == skip) {
-                offset++;
-                continue;
-            }
+PARCBufferComposer *
+parcBase64URL_DecodeArray(PARCBufferComposer *output, size_t length, const uint8_t array[length])
+{
+    return _decodeArray(&_parcBase64_URL, output, length, array);
+}
 
-            if (decoded == invalid) {
-                break;
-            }
-        }
+struct parc_base64_decoder {
+    const _PARCBase64Alphabet *alphabet;
+
+    // The characters of a quantum split across calls to parcBase64Decoder_Update.
+    uint8_t pending[4];
+    int pendingLength;
+};
+
+parcObject_ExtendPARCObject(PARCBase64Decoder, NULL, NULL, NULL, NULL, NULL, NULL, NULL);
 
-        if (index == 4) {
-            success = _decode(output, quantum);
+parcObject_ImplementAcquire(parcBase64Decoder, PARCBase64Decoder);
+
+parcObject_ImplementRelease(parcBase64Decoder, PARCBase64Decoder);
+
+static PARCBase64Decoder *
+_parcBase64Decoder_Create(const _PARCBase64Alphabet *alphabet)
+{
+    PARCBase64Decoder *result = parcObject_CreateInstance(PARCBase64Decoder);
+    if (result != NULL) {
+        result->alphabet = alphabet;
+        result->pendingLength = 0;
+    }
+    return result;
+}
+
+PARCBase64Decoder *
+parcBase64Decoder_Create(void)
+{
+    return _parcBase64Decoder_Create(&_parcBase64_Standard);
+}
+
+PARCBase64Decoder *
+parcBase64Decoder_CreateURL(void)
+{
+    return _parcBase64Decoder_Create(&_parcBase64_URL);
+}
+
+PARCBufferComposer *
+parcBase64Decoder_Update(PARCBase64Decoder *decoder, PARCBufferComposer *output, size_t length, const uint8_t array[length])
+{
+    uint8_t *space = parcBufferComposer_Reserve(output, _decodedLength(length + (size_t) decoder->pendingLength));
+    if (space == NULL) {
+        return NULL;
+    }
+    size_t decodedLength = 0;
+    size_t offset = 0;
+
+    // First complete the quantum left over from the previous call.
+    if (decoder->pendingLength > 0) {
+        int count = _gatherQuantum(decoder->alphabet, decoder->pending, decoder->pendingLength, length, array, &offset);
+        if (count < 0) {
+            return NULL;
         }
+        if (count < 4) {
+            decoder->pendingLength = count;
+            return output;
+        }
+        int decoded = _decodeQuantum(decoder->alphabet, space, decoder->pending);
+        if (decoded < 0) {
+            return NULL;
+        }
+        decodedLength = (size_t) decoded;
+        decoder->pendingLength = 0;
     }
 
-    if (!success) {
-        parcBuffer_SetPosition(outputBuffer, rewind_to);
+    size_t runLength = 0;
+    if (!_decodeRun(decoder->alphabet, &space[decodedLength], &runLength, length - offset, &array[offset],
+                    decoder->pending, &decoder->pendingLength)) {
+        decoder->pendingLength = 0;
         return NULL;
     }
 
-    return output;
+    return parcBufferComposer_Commit(output, decodedLength + runLength);
+}
+
+PARCBufferComposer *
+parcBase64Decoder_Finish(PARCBase64Decoder *decoder, PARCBufferComposer *output)
+{
+    uint8_t *space = parcBufferComposer_Reserve(output, 3);
+    if (space == NULL) {
+        return NULL;
+    }
+
+    int decoded = _decodePartial(decoder->alphabet, space, decoder->pending, decoder->pendingLength);
+    decoder->pendingLength = 0;
+    if (decoded < 0) {
+        return NULL;
+    }
+    return parcBufferComposer_Commit(output, (size_t) decoded);
 }
@@ -46,6 +46,15 @@
  * ascii value 95, is we can detect it as outside base64.  Similarly, all the
  * invalid characters have the symbol "~", which is ascii 127.
  *
+ * Encoding and decoding write straight into space reserved in the output composer for the whole result.
+ * Where the processor has SSSE3 (detected at runtime) 12 bytes are encoded to, or decoded from, 16 characters per step;
+ * otherwise, and around line breaks and padding, each quantum is translated with table lookups.
+ *
+ * The `parcBase64URL_` functions use the URL and filename safe alphabet of RFC 4648, Section 5,
+ * in which '-' and '_' replace '+' and '/'. They do not pad their output, and accept input with or without padding.
+ *
+ * A `PARCBase64Decoder` decodes input that arrives in pieces, such as a large file read a block at a time.
+ *
  * @author Marc Mosko, Palo Alto Research Center (Xerox PARC)
  * @copyright 2013-2014, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC).  All rights reserved.
  */
@@ -139,4 +148,200 @@ PARCBufferComposer *parcBase64_DecodeString(PARCBufferComposer *output, const ch
  * @endcode
  */
 PARCBufferComposer *parcBase64_DecodeArray(PARCBufferComposer *output, size_t length, const uint8_t array[length]);
+
+/**
+ * Encode the plaintext buffer to unpadded base64url, as per RFC 4648, Section 5.
+ *
+ * @param [in,out] output The instance of {@link PARCBufferComposer} to which the encoded @p plainText is appended
+ * @param [in] plainText The text to encode and append to @p output
+ *
+ * @return  A pointer to the @p output, or NULL if memory could not be allocated.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCBufferComposer *composer = parcBase64URL_Encode(parcBufferComposer_Create(), keyId);
+ *     char *string = parcBufferComposer_ToString(composer);
+ * }
+ * @endcode
+ */
+PARCBufferComposer *parcBase64URL_Encode(PARCBufferComposer *output, PARCBuffer *plainText);
+
+/**
+ * Encode the array to unpadded base64url, as per RFC 4648, Section 5.
+ *
+ * @param [in,out] output The instance of {@link PARCBufferComposer} to which the encoded @p array is appended
+ * @param [in] length The length of the array to be encoded
+ * @param [in] array The array to be encoded and appended to @p output
+ *
+ * @return  A pointer to the @p output, or NULL if memory could not be allocated.
+ *
+ * Example:
+ * @code
+ * {
+ *     parcBase64URL_EncodeArray(composer, sizeof(digest), digest);
+ * }
+ * @endcode
+ */
+PARCBufferComposer *parcBase64URL_EncodeArray(PARCBufferComposer *output, size_t length, const uint8_t array[length]);
+
+/**
+ * Decode base64url @p encodedText, padded or not, and append the result to @p output.
+ *
+ * If the @p encodedText cannot be decoded, nothing is appended to @p output and the function returns NULL.
+ *
+ * @param [in,out] output The instance of {@link PARCBufferComposer} to which the decoded @p encodedText is appended
+ * @param [in] encodedText The text to be decoded and appended to @p output
+ *
+ * @return  A pointer to the @p output, or NULL if the @p encodedText cannot be decoded
+ *
+ * Example:
+ * @code
+ * {
+ *     if (parcBase64URL_Decode(composer, encodedText) == NULL) {
+ *         printf("Not base64url\n");
+ *     }
+ * }
+ * @endcode
+ */
+PARCBufferComposer *parcBase64URL_Decode(PARCBufferComposer *output, PARCBuffer *encodedText);
+
+/**
+ * Decode the base64url array, padded or not, and append the result to @p output.
+ *
+ * @param [in,out] output The instance of {@link PARCBufferComposer} to which the decoded @p array is appended
+ * @param [in] length The size of the array.
+ * @param [in] array The array to be decoded and appended to @p output
+ *
+ * @return  A pointer to the @p output, or NULL if the @p array cannot be decoded
+ *
+ * Example:
+ * @code
+ * {
+ *     parcBase64URL_DecodeArray(composer, strlen(string), (const uint8_t *) string);
+ * }
+ * @endcode
+ */
+PARCBufferComposer *parcBase64URL_DecodeArray(PARCBufferComposer *output, size_t length, const uint8_t array[length]);
+
+struct parc_base64_decoder;
+/**
+ * @typedef PARCBase64Decoder
+ * @brief Decodes base64 that arrives in pieces.
+ */
+typedef struct parc_base64_decoder PARCBase64Decoder;
+
+/**
+ * Create a `PARCBase64Decoder` for the standard, padded, alphabet.
+ *
+ * @return NULL Memory could not be allocated.
+ * @return non-NULL A pointer to a new `PARCBase64Decoder` instance.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCBase64Decoder *decoder = parcBase64Decoder_Create();
+ *
+ *     while ((length = read(fd, block, sizeof(block))) > 0) {
+ *         parcBase64Decoder_Update(decoder, output, length, block);
+ *     }
+ *     parcBase64Decoder_Finish(decoder, output);
+ *
+ *     parcBase64Decoder_Release(&decoder);
+ * }
+ * @endcode
+ */
+PARCBase64Decoder *parcBase64Decoder_Create(void);
+
+/**
+ * Create a `PARCBase64Decoder` for the URL and filename safe alphabet.
+ *
+ * @return NULL Memory could not be allocated.
+ * @return non-NULL A pointer to a new `PARCBase64Decoder` instance.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCBase64Decoder *decoder = parcBase64Decoder_CreateURL();
+ *     parcBase64Decoder_Release(&decoder);
+ * }
+ * @endcode
+ */
+PARCBase64Decoder *parcBase64Decoder_CreateURL(void);
+
+/**
+ * Increase the number of references to a `PARCBase64Decoder`.
+ *
+ * @param [in] decoder A pointer to a valid `PARCBase64Decoder` instance.
+ *
+ * @return The same value as @p decoder.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCBase64Decoder *reference = parcBase64Decoder_Acquire(decoder);
+ *     parcBase64Decoder_Release(&reference);
+ * }
+ * @endcode
+ */
+PARCBase64Decoder *parcBase64Decoder_Acquire(const PARCBase64Decoder *decoder);
+
+/**
+ * Release a previously acquired reference to the specified `PARCBase64Decoder`.
+ *
+ * @param [in,out] decoderPtr A pointer to a pointer to the instance to release, which is set to NULL.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCBase64Decoder *decoder = parcBase64Decoder_Create();
+ *     parcBase64Decoder_Release(&decoder);
+ * }
+ * @endcode
+ */
+void parcBase64Decoder_Release(PARCBase64Decoder **decoderPtr);
+
+/**
+ * Decode the next piece of the encoded text and append the result to @p output.
+ *
+ * The pieces may be split anywhere: a quantum cut short at the end of one piece is completed by the next.
+ * If the piece contains a non-base64 character nothing is appended to @p output for it, the function returns NULL,
+ * and the decoder starts again as if newly created.
+ *
+ * @param [in,out] decoder A pointer to a valid `PARCBase64Decoder` instance.
+ * @param [in,out] output The instance of {@link PARCBufferComposer} to which the decoded text is appended
+ * @param [in] length The size of the array.
+ * @param [in] array The next piece of the encoded text.
+ *
+ * @return  A pointer to the @p output, or NULL if the piece cannot be decoded
+ *
+ * Example:
+ * @code
+ * {
+ *     parcBase64Decoder_Update(decoder, output, length, block);
+ * }
+ * @endcode
+ */
+PARCBufferComposer *parcBase64Decoder_Update(PARCBase64Decoder *decoder, PARCBufferComposer *output, size_t length, const uint8_t array[length]);
+
+/**
+ * Finish decoding, appending the decoding of an unpadded final quantum, if the alphabet permits one, to @p output.
+ *
+ * The decoder may then be used for new encoded text.
+ *
+ * @param [in,out] decoder A pointer to a valid `PARCBase64Decoder` instance.
+ * @param [in,out] output The instance of {@link PARCBufferComposer} to which the decoded text is appended
+ *
+ * @return  A pointer to the @p output, or NULL if the encoded text ended with an incomplete quantum.
+ *
+ * Example:
+ * @code
+ * {
+ *     if (parcBase64Decoder_Finish(decoder, output) == NULL) {
+ *         printf("Truncated base64\n");
+ *     }
+ * }
+ * @endcode
+ */
+PARCBufferComposer *parcBase64Decoder_Finish(PARCBase64Decoder *decoder, PARCBufferComposer *output);
 #endif // libparc_parc_Base64_h
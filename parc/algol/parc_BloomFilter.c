@@ -0,0 +1,408 @@
+/*
+ * Copyright (c) 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Patent rights are not granted under this agreement. Patent rights are
+ *       available under FRAND terms.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX or PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * @copyright 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC).  All rights reserved.
+ */
+#include <config.h>
+
+#include <math.h>
+#include <string.h>
+
+#include <LongBow/runtime.h>
+
+#include <parc/algol/parc_BloomFilter.h>
+#include <parc/algol/parc_Object.h>
+#include <parc/algol/parc_Memory.h>
+#include <parc/algol/parc_Hash.h>
+
+// Each block is one 64 byte cache line.
+#define _PARCBloomFilter_BlockBitsLog2 9
+#define _PARCBloomFilter_BlockBits (1 << _PARCBloomFilter_BlockBitsLog2)
+#define _PARCBloomFilter_WordsPerBlock (_PARCBloomFilter_BlockBits / 64)
+#define _PARCBloomFilter_MaximumHashCount 32
+
+// The serialized form begins with "PBF1".
+#define _PARCBloomFilter_Magic 0x50424631
+
+struct PARCBloomFilter {
+    uint64_t *words;
+    size_t blockCount;
+    unsigned hashCount;
+    size_t count;
+};
+
+/*
+ * The 64-bit finalizer from MurmurHash3, so that every bit of the result depends on every bit of the input.
+ */
+static inline uint64_t
+_parcBloomFilter_Mix(uint64_t hash)
+{
+    hash ^= hash >> 33;
+    hash *= 0xFF51AFD7ED558CCDULL;
+    hash ^= hash >> 33;
+    hash *= 0xC4CEB9FE1A85EC53ULL;
+    hash ^= hash >> 33;
+    return hash;
+}
+
+/*
+ * The bit positions within a block, by double hashing (Kirsch and Mitzenmacher):
+ * the i-th position is h1 + i * h2, modulo the block size.
+ * h2 is odd, so the first `_PARCBloomFilter_BlockBits` positions are all distinct.
+ */
+typedef struct {
+    uint32_t h1;
+    uint32_t h2;
+} _PARCBloomFilterProbe;
+
+/*
+ * Select the element's block from the high 32 bits of the hash, and derive h1 and h2 from a second mix of it.
+ */
+static inline uint64_t *
+_parcBloomFilter_Block(const PARCBloomFilter *filter, uint64_t hash, _PARCBloomFilterProbe *probe)
+{
+    size_t block = (size_t) (((hash >> 32) * (uint64_t) filter->blockCount) >> 32);
+    uint64_t bits = _parcBloomFilter_Mix(hash + 0x9E3779B97F4A7C15ULL);
+    probe->h1 = (uint32_t) bits;
+    probe->h2 = (uint32_t) (bits >> 32) | 1;
+    return &filter->words[block * _PARCBloomFilter_WordsPerBlock];
+}
+
+static inline uint32_t
+_parcBloomFilter_NextBit(_PARCBloomFilterProbe *probe)
+{
+    uint32_t result = probe->h1 & (_PARCBloomFilter_BlockBits - 1);
+    probe->h1 += probe->h2;
+    return result;
+}
+
+static size_t
+_parcBloomFilter_WordCount(const PARCBloomFilter *filter)
+{
+    return filter->blockCount * _PARCBloomFilter_WordsPerBlock;
+}
+
+static void
+_parcBloomFilter_Finalize(PARCBloomFilter **instancePtr)
+{
+    assertNotNull(instancePtr, "Parameter must be a non-null pointer to a PARCBloomFilter pointer.");
+    PARCBloomFilter *filter = *instancePtr;
+
+    parcMemory_Deallocate((void **) &filter->words);
+}
+
+parcObject_ImplementAcquire(parcBloomFilter, PARCBloomFilter);
+
+parcObject_ImplementRelease(parcBloomFilter, PARCBloomFilter);
+
+parcObject_ExtendPARCObject(PARCBloomFilter, _parcBloomFilter_Finalize, parcBloomFilter_Copy, NULL, parcBloomFilter_Equals, NULL, NULL, NULL);
+
+void
+parcBloomFilter_AssertValid(const PARCBloomFilter *instance)
+{
+    assertTrue(parcBloomFilter_IsValid(instance),
+               "PARCBloomFilter is not valid.");
+}
+
+bool
+parcBloomFilter_IsValid(const PARCBloomFilter *instance)
+{
+    bool result = false;
+
+    if (instance != NULL) {
+        result = instance->words != NULL && instance->blockCount > 0
+                 && instance->hashCount > 0 && instance->hashCount <= _PARCBloomFilter_MaximumHashCount;
+    }
+
+    return result;
+}
+
+PARCBloomFilter *
+parcBloomFilter_CreateWithGeometry(size_t blockCount, unsigned hashCount)
+{
+    trapIllegalValueIf(blockCount == 0 || blockCount > UINT32_MAX, "The block count must be between 1 and %u", UINT32_MAX);
+    trapIllegalValueIf(hashCount == 0 || hashCount > _PARCBloomFilter_MaximumHashCount,
+                       "The hash count must be between 1 and %d", _PARCBloomFilter_MaximumHashCount);
+
+    PARCBloomFilter *result = parcObject_CreateInstance(PARCBloomFilter);
+
+    if (result != NULL) {
+        size_t length = blockCount * _PARCBloomFilter_BlockBits / 8;
+        void *words = NULL;
+        int failure = parcMemory_MemAlign(&words, _PARCBloomFilter_BlockBits / 8, length);
+        assertTrue(failure == 0, "parcMemory_MemAlign(%zu) failed: %d", length, failure);
+        memset(words, 0, length);
+
+        result->words = words;
+        result->blockCount = blockCount;
+        result->hashCount = hashCount;
+        result->count = 0;
+    }
+
+    return result;
+}
+
+static unsigned
+_parcBloomFilter_OptimalHashCount(double bitsPerElement)
+{
+    double hashes = round(bitsPerElement * M_LN2);
+    return (hashes < 1.0) ? 1 : (hashes > _PARCBloomFilter_MaximumHashCount) ? _PARCBloomFilter_MaximumHashCount : (unsigned) hashes;
+}
+
+/*
+ * The expected false positive rate of a blocked filter. The number of elements in a block is Poisson distributed,
+ * and a block holding j elements has the false positive rate of a classic 512-bit filter holding j elements.
+ */
+static double
+_parcBloomFilter_BlockedFalsePositiveRate(double bitsPerElement, unsigned hashCount)
+{
+    double lambda = _PARCBloomFilter_BlockBits / bitsPerElement;
+    double limit = lambda + 12 * sqrt(lambda) + 20;
+
+    double result = 0.0;
+    for (double j = 0; j <= limit; j++) {
+        double probability = exp(j * log(lambda) - lambda - lgamma(j + 1));
+        double blockRate = pow(1.0 - pow(1.0 - 1.0 / _PARCBloomFilter_BlockBits, hashCount * j), hashCount);
+        result += probability * blockRate;
+    }
+    return result;
+}
+
+PARCBloomFilter *
+parcBloomFilter_Create(size_t expectedElements, double falsePositiveRate)
+{
+    trapIllegalValueIf(expectedElements == 0, "The expected number of elements must be greater than zero.");
+    trapIllegalValueIf(!(falsePositiveRate > 0.0 && falsePositiveRate < 1.0),
+                       "The false positive rate must be between 0 and 1 exclusive, actual %f", falsePositiveRate);
+
+    double bitsPerElement = -log(falsePositiveRate) / (M_LN2 * M_LN2);
+    unsigned hashCount = _parcBloomFilter_OptimalHashCount(bitsPerElement);
+
+    for (int i = 0; i < 64 && _parcBloomFilter_BlockedFalsePositiveRate(bitsPerElement, hashCount) > falsePositiveRate; i++) {
+        bitsPerElement *= 1.05;
+        hashCount = _parcBloomFilter_OptimalHashCount(bitsPerElement);
+    }
+
+    size_t blockCount = (size_t) ceil(bitsPerElement * (double) expectedElements / _PARCBloomFilter_BlockBits);
+    if (blockCount == 0) {
+        blockCount = 1;
+    }
+
+    return parcBloomFilter_CreateWithGeometry(blockCount, hashCount);
+}
+
+PARCBloomFilter *
+parcBloomFilter_Copy(const PARCBloomFilter *original)
+{
+    parcBloomFilter_OptionalAssertValid(original);
+
+    PARCBloomFilter *result = parcBloomFilter_CreateWithGeometry(original->blockCount, original->hashCount);
+    if (result != NULL) {
+        memcpy(result->words, original->words, _parcBloomFilter_WordCount(original) * sizeof(uint64_t));
+        result->count = original->count;
+    }
+
+    return result;
+}
+
+bool
+parcBloomFilter_Equals(const PARCBloomFilter *x, const PARCBloomFilter *y)
+{
+    bool result = false;
+
+    if (x == y) {
+        result = true;
+    } else if (x == NULL || y == NULL) {
+        result = false;
+    } else if (x->blockCount == y->blockCount && x->hashCount == y->hashCount) {
+        result = memcmp(x->words, y->words, _parcBloomFilter_WordCount(x) * sizeof(uint64_t)) == 0;
+    }
+
+    return result;
+}
+
+void
+parcBloomFilter_AddHash(PARCBloomFilter *filter, uint64_t hash)
+{
+    parcBloomFilter_OptionalAssertValid(filter);
+
+    _PARCBloomFilterProbe probe;
+    uint64_t *block = _parcBloomFilter_Block(filter, _parcBloomFilter_Mix(hash), &probe);
+
+    for (unsigned i = 0; i < filter->hashCount; i++) {
+        uint32_t bit = _parcBloomFilter_NextBit(&probe);
+        block[bit / 64] |= 1ULL << (bit % 64);
+    }
+    filter->count++;
+}
+
+bool
+parcBloomFilter_ContainsHash(const PARCBloomFilter *filter, uint64_t hash)
+{
+    parcBloomFilter_OptionalAssertValid(filter);
+
+    _PARCBloomFilterProbe probe;
+    const uint64_t *block = _parcBloomFilter_Block(filter, _parcBloomFilter_Mix(hash), &probe);
+
+    for (unsigned i = 0; i < filter->hashCount; i++) {
+        uint32_t bit = _parcBloomFilter_NextBit(&probe);
+        if ((block[bit / 64] & (1ULL << (bit % 64))) == 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void
+parcBloomFilter_AddData(PARCBloomFilter *filter, const void *data, size_t length)
+{
+    parcBloomFilter_AddHash(filter, parcHash64_Data(data, length));
+}
+
+bool
+parcBloomFilter_ContainsData(const PARCBloomFilter *filter, const void *data, size_t length)
+{
+    return parcBloomFilter_ContainsHash(filter, parcHash64_Data(data, length));
+}
+
+void
+parcBloomFilter_AddBuffer(PARCBloomFilter *filter, const PARCBuffer *element)
+{
+    PARCBuffer *buffer = (PARCBuffer *) element;
+    parcBloomFilter_AddData(filter, parcBuffer_Overlay(buffer, 0), parcBuffer_Remaining(buffer));
+}
+
+bool
+parcBloomFilter_ContainsBuffer(const PARCBloomFilter *filter, const PARCBuffer *element)
+{
+    PARCBuffer *buffer = (PARCBuffer *) element;
+    return parcBloomFilter_ContainsData(filter, parcBuffer_Overlay(buffer, 0), parcBuffer_Remaining(buffer));
+}
+
+PARCBloomFilter *
+parcBloomFilter_Union(PARCBloomFilter *filter, const PARCBloomFilter *other)
+{
+    parcBloomFilter_OptionalAssertValid(filter);
+    parcBloomFilter_OptionalAssertValid(other);
+    trapIllegalValueIf(filter->blockCount != other->blockCount || filter->hashCount != other->hashCount,
+                       "Filters must have the same geometry: %zu blocks/%u hashes vs %zu blocks/%u hashes",
+                       filter->blockCount, filter->hashCount, other->blockCount, other->hashCount);
+
+    size_t wordCount = _parcBloomFilter_WordCount(filter);
+    for (size_t i = 0; i < wordCount; i++) {
+        filter->words[i] |= other->words[i];
+    }
+    filter->count += other->count;
+
+    return filter;
+}
+
+void
+parcBloomFilter_Clear(PARCBloomFilter *filter)
+{
+    parcBloomFilter_OptionalAssertValid(filter);
+
+    memset(filter->words, 0, _parcBloomFilter_WordCount(filter) * sizeof(uint64_t));
+    filter->count = 0;
+}
+
+size_t
+parcBloomFilter_Count(const PARCBloomFilter *filter)
+{
+    parcBloomFilter_OptionalAssertValid(filter);
+
+    return filter->count;
+}
+
+size_t
+parcBloomFilter_BitCount(const PARCBloomFilter *filter)
+{
+    parcBloomFilter_OptionalAssertValid(filter);
+
+    return filter->blockCount * _PARCBloomFilter_BlockBits;
+}
+
+unsigned
+parcBloomFilter_HashCount(const PARCBloomFilter *filter)
+{
+    parcBloomFilter_OptionalAssertValid(filter);
+
+    return filter->hashCount;
+}
+
+PARCBuffer *
+parcBloomFilter_ToBuffer(const PARCBloomFilter *filter)
+{
+    parcBloomFilter_OptionalAssertValid(filter);
+
+    size_t wordCount = _parcBloomFilter_WordCount(filter);
+    PARCBuffer *result = parcBuffer_Allocate(2 * sizeof(uint32_t) + 2 * sizeof(uint64_t) + wordCount * sizeof(uint64_t));
+
+    parcBuffer_PutUint32(result, _PARCBloomFilter_Magic);
+    parcBuffer_PutUint32(result, filter->hashCount);
+    parcBuffer_PutUint64(result, filter->blockCount);
+    parcBuffer_PutUint64(result, filter->count);
+    for (size_t i = 0; i < wordCount; i++) {
+        parcBuffer_PutUint64(result, filter->words[i]);
+    }
+
+    return parcBuffer_Flip(result);
+}
+
+PARCBloomFilter *
+parcBloomFilter_CreateFromBuffer(PARCBuffer *buffer)
+{
+    PARCBloomFilter *result = NULL;
+
+    size_t headerLength = 2 * sizeof(uint32_t) + 2 * sizeof(uint64_t);
+    if (parcBuffer_Remaining(buffer) >= headerLength) {
+        size_t start = parcBuffer_Position(buffer);
+
+        uint32_t magic = parcBuffer_GetUint32(buffer);
+        uint32_t hashCount = parcBuffer_GetUint32(buffer);
+        uint64_t blockCount = parcBuffer_GetUint64(buffer);
+        uint64_t count = parcBuffer_GetUint64(buffer);
+
+        bool valid = magic == _PARCBloomFilter_Magic
+                     && hashCount > 0 && hashCount <= _PARCBloomFilter_MaximumHashCount
+                     && blockCount > 0 && blockCount <= UINT32_MAX
+                     && parcBuffer_Remaining(buffer) / (_PARCBloomFilter_BlockBits / 8) >= blockCount;
+
+        if (valid) {
+            result = parcBloomFilter_CreateWithGeometry((size_t) blockCount, hashCount);
+            size_t wordCount = _parcBloomFilter_WordCount(result);
+            for (size_t i = 0; i < wordCount; i++) {
+                result->words[i] = parcBuffer_GetUint64(buffer);
+            }
+            result->count = (size_t) count;
+        } else {
+            parcBuffer_SetPosition(buffer, start);
+        }
+    }
+
+    return result;
+}
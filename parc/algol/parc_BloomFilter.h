@@ -0,0 +1,465 @@
+/*
+ * Copyright (c) 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Patent rights are not granted under this agreement. Patent rights are
+ *       available under FRAND terms.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX or PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * @file parc_BloomFilter.h
+ * @ingroup datastructures
+ * @brief A cache-blocked Bloom filter for probabilistic set membership.
+ *
+ * A `PARCBloomFilter` answers "definitely not present" or "probably present" for an element,
+ * using a fixed amount of memory regardless of the size of the elements.
+ * Elements cannot be removed; see `PARCCuckooFilter` for a filter that supports deletion.
+ *
+ * The filter is divided into 512-bit blocks, each the size of a cache line.
+ * An element's hash selects one block, and all of the element's bits are set within that block
+ * by double hashing (the i-th bit is h1 + i * h2), so adding or testing an element touches a single cache line.
+ * The price is a higher false positive rate than an unblocked filter of the same size,
+ * which `parcBloomFilter_Create` compensates for with extra bits.
+ *
+ * Filters with the same geometry may be combined with `parcBloomFilter_Union`,
+ * for example to merge the filters built by several workers,
+ * and may be serialized to and from a `PARCBuffer`.
+ *
+ * @copyright 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC).  All rights reserved.
+ */
+#ifndef libparc_parc_BloomFilter_h
+#define libparc_parc_BloomFilter_h
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <parc/algol/parc_Buffer.h>
+
+struct PARCBloomFilter;
+typedef struct PARCBloomFilter PARCBloomFilter;
+
+#ifdef PARCLibrary_DISABLE_VALIDATION
+#  define parcBloomFilter_OptionalAssertValid(_instance_)
+#else
+#  define parcBloomFilter_OptionalAssertValid(_instance_) parcBloomFilter_AssertValid(_instance_)
+#endif
+
+/**
+ * Create a `PARCBloomFilter` sized for the expected number of elements and the desired false positive rate.
+ *
+ * The number of bits starts from the classic `-n ln(p) / ln(2)^2` and is increased until the expected
+ * false positive rate of the blocked filter, whose blocks are unevenly loaded, is at most @p falsePositiveRate.
+ * The number of hash functions is `(bits / n) ln(2)`.
+ *
+ * @param [in] expectedElements The number of elements expected to be added. Must be greater than zero.
+ * @param [in] falsePositiveRate The desired false positive rate when the filter holds @p expectedElements, between 0 and 1 exclusive.
+ *
+ * @return non-NULL A pointer to a valid, empty PARCBloomFilter instance.
+ * @return NULL An error occurred.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCBloomFilter *filter = parcBloomFilter_Create(1000000, 0.01);
+ *
+ *     parcBloomFilter_Release(&filter);
+ * }
+ * @endcode
+ */
+PARCBloomFilter *parcBloomFilter_Create(size_t expectedElements, double falsePositiveRate);
+
+/**
+ * Create a `PARCBloomFilter` with an explicit geometry.
+ *
+ * @param [in] blockCount The number of 512-bit blocks. Must be greater than zero.
+ * @param [in] hashCount The number of bits set per element, between 1 and 32.
+ *
+ * @return non-NULL A pointer to a valid, empty PARCBloomFilter instance.
+ * @return NULL An error occurred.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCBloomFilter *filter = parcBloomFilter_CreateWithGeometry(1024, 7);
+ *
+ *     parcBloomFilter_Release(&filter);
+ * }
+ * @endcode
+ */
+PARCBloomFilter *parcBloomFilter_CreateWithGeometry(size_t blockCount, unsigned hashCount);
+
+/**
+ * Create a `PARCBloomFilter` from the serialized form produced by `parcBloomFilter_ToBuffer`.
+ *
+ * The serialized filter is read from the buffer's current position, which is advanced past it.
+ *
+ * @param [in,out] buffer A pointer to a valid PARCBuffer instance.
+ *
+ * @return non-NULL A pointer to a valid PARCBloomFilter instance.
+ * @return NULL The buffer does not contain a serialized PARCBloomFilter.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCBuffer *buffer = parcBloomFilter_ToBuffer(filter);
+ *
+ *     PARCBloomFilter *copy = parcBloomFilter_CreateFromBuffer(buffer);
+ *
+ *     parcBloomFilter_Release(&copy);
+ *     parcBuffer_Release(&buffer);
+ * }
+ * @endcode
+ */
+PARCBloomFilter *parcBloomFilter_CreateFromBuffer(PARCBuffer *buffer);
+
+/**
+ * Increase the number of references to a `PARCBloomFilter` instance.
+ *
+ * @param [in] instance A pointer to a valid PARCBloomFilter instance.
+ *
+ * @return The same value as @p instance.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCBloomFilter *a = parcBloomFilter_Create(1000, 0.01);
+ *
+ *     PARCBloomFilter *b = parcBloomFilter_Acquire(a);
+ *
+ *     parcBloomFilter_Release(&a);
+ *     parcBloomFilter_Release(&b);
+ * }
+ * @endcode
+ */
+PARCBloomFilter *parcBloomFilter_Acquire(const PARCBloomFilter *instance);
+
+/**
+ * Release a previously acquired reference to the given `PARCBloomFilter` instance,
+ * decrementing the reference count for the instance.
+ *
+ * The pointer to the instance is set to NULL as a side-effect of this function.
+ *
+ * @param [in,out] instancePtr A pointer to a pointer to the instance to release.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCBloomFilter *a = parcBloomFilter_Create(1000, 0.01);
+ *
+ *     parcBloomFilter_Release(&a);
+ * }
+ * @endcode
+ */
+void parcBloomFilter_Release(PARCBloomFilter **instancePtr);
+
+/**
+ * Create an independent copy of the given `PARCBloomFilter`.
+ *
+ * @param [in] original A pointer to a valid PARCBloomFilter instance.
+ *
+ * @return non-NULL A pointer to a new PARCBloomFilter instance equal to @p original.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCBloomFilter *copy = parcBloomFilter_Copy(filter);
+ *
+ *     parcBloomFilter_Release(&copy);
+ * }
+ * @endcode
+ */
+PARCBloomFilter *parcBloomFilter_Copy(const PARCBloomFilter *original);
+
+/**
+ * Determine if two `PARCBloomFilter` instances have the same geometry and the same bits set.
+ *
+ * @param [in] x A pointer to a PARCBloomFilter instance, or NULL.
+ * @param [in] y A pointer to a PARCBloomFilter instance, or NULL.
+ *
+ * @return true The filters are equal.
+ * @return false The filters are not equal.
+ *
+ * Example:
+ * @code
+ * {
+ *     if (parcBloomFilter_Equals(a, b)) {
+ *         ...
+ *     }
+ * }
+ * @endcode
+ */
+bool parcBloomFilter_Equals(const PARCBloomFilter *x, const PARCBloomFilter *y);
+
+/**
+ * Determine if an instance of `PARCBloomFilter` is valid.
+ *
+ * @param [in] instance A pointer to a PARCBloomFilter instance.
+ *
+ * @return true The instance is valid.
+ * @return false The instance is not valid.
+ *
+ * Example:
+ * @code
+ * {
+ *     if (parcBloomFilter_IsValid(filter)) {
+ *         ...
+ *     }
+ * }
+ * @endcode
+ */
+bool parcBloomFilter_IsValid(const PARCBloomFilter *instance);
+
+/**
+ * Assert that the given `PARCBloomFilter` instance is valid.
+ *
+ * @param [in] instance A pointer to a valid PARCBloomFilter instance.
+ *
+ * Example:
+ * @code
+ * {
+ *     parcBloomFilter_AssertValid(filter);
+ * }
+ * @endcode
+ */
+void parcBloomFilter_AssertValid(const PARCBloomFilter *instance);
+
+/**
+ * Add an element, identified by a 64-bit hash of it, to the filter.
+ *
+ * Use this when a good hash of the element is already at hand.
+ * The hash is remixed internally, so it need not be uniformly distributed in every bit.
+ *
+ * @param [in] filter A pointer to a valid PARCBloomFilter instance.
+ * @param [in] hash A 64-bit hash of the element.
+ *
+ * Example:
+ * @code
+ * {
+ *     parcBloomFilter_AddHash(filter, parcHash64_Int64(identifier));
+ * }
+ * @endcode
+ */
+void parcBloomFilter_AddHash(PARCBloomFilter *filter, uint64_t hash);
+
+/**
+ * Determine if an element, identified by a 64-bit hash of it, may be in the filter.
+ *
+ * @param [in] filter A pointer to a valid PARCBloomFilter instance.
+ * @param [in] hash A 64-bit hash of the element.
+ *
+ * @return true The element is probably in the filter.
+ * @return false The element is definitely not in the filter.
+ *
+ * Example:
+ * @code
+ * {
+ *     if (parcBloomFilter_ContainsHash(filter, parcHash64_Int64(identifier))) {
+ *         ...
+ *     }
+ * }
+ * @endcode
+ */
+bool parcBloomFilter_ContainsHash(const PARCBloomFilter *filter, uint64_t hash);
+
+/**
+ * Add an element, given as an array of bytes, to the filter.
+ *
+ * @param [in] filter A pointer to a valid PARCBloomFilter instance.
+ * @param [in] data A pointer to the bytes of the element.
+ * @param [in] length The number of bytes in the element.
+ *
+ * Example:
+ * @code
+ * {
+ *     parcBloomFilter_AddData(filter, "hello", 5);
+ * }
+ * @endcode
+ */
+void parcBloomFilter_AddData(PARCBloomFilter *filter, const void *data, size_t length);
+
+/**
+ * Determine if an element, given as an array of bytes, may be in the filter.
+ *
+ * @param [in] filter A pointer to a valid PARCBloomFilter instance.
+ * @param [in] data A pointer to the bytes of the element.
+ * @param [in] length The number of bytes in the element.
+ *
+ * @return true The element is probably in the filter.
+ * @return false The element is definitely not in the filter.
+ *
+ * Example:
+ * @code
+ * {
+ *     if (parcBloomFilter_ContainsData(filter, "hello", 5)) {
+ *         ...
+ *     }
+ * }
+ * @endcode
+ */
+bool parcBloomFilter_ContainsData(const PARCBloomFilter *filter, const void *data, size_t length);
+
+/**
+ * Add the remaining bytes of a `PARCBuffer` to the filter as an element.
+ *
+ * The position of the buffer is not changed.
+ *
+ * @param [in] filter A pointer to a valid PARCBloomFilter instance.
+ * @param [in] element A pointer to a valid PARCBuffer instance.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCBuffer *name = parcBuffer_WrapCString("lci:/a/b");
+ *     parcBloomFilter_AddBuffer(filter, name);
+ *     parcBuffer_Release(&name);
+ * }
+ * @endcode
+ */
+void parcBloomFilter_AddBuffer(PARCBloomFilter *filter, const PARCBuffer *element);
+
+/**
+ * Determine if the remaining bytes of a `PARCBuffer` may be an element of the filter.
+ *
+ * The position of the buffer is not changed.
+ *
+ * @param [in] filter A pointer to a valid PARCBloomFilter instance.
+ * @param [in] element A pointer to a valid PARCBuffer instance.
+ *
+ * @return true The element is probably in the filter.
+ * @return false The element is definitely not in the filter.
+ *
+ * Example:
+ * @code
+ * {
+ *     if (parcBloomFilter_ContainsBuffer(filter, name)) {
+ *         ...
+ *     }
+ * }
+ * @endcode
+ */
+bool parcBloomFilter_ContainsBuffer(const PARCBloomFilter *filter, const PARCBuffer *element);
+
+/**
+ * Add every element of @p other to @p filter by taking the bitwise OR of the two filters.
+ *
+ * The filters must have the same geometry, such as filters created with the same parameters.
+ *
+ * @param [in,out] filter A pointer to a valid PARCBloomFilter instance that receives the union.
+ * @param [in] other A pointer to a valid PARCBloomFilter instance with the same geometry as @p filter.
+ *
+ * @return The value of @p filter.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCBloomFilter *merged = parcBloomFilter_Create(1000000, 0.01);
+ *     for (int i = 0; i < workerCount; i++) {
+ *         parcBloomFilter_Union(merged, workerFilters[i]);
+ *     }
+ * }
+ * @endcode
+ */
+PARCBloomFilter *parcBloomFilter_Union(PARCBloomFilter *filter, const PARCBloomFilter *other);
+
+/**
+ * Remove all elements from the filter.
+ *
+ * @param [in,out] filter A pointer to a valid PARCBloomFilter instance.
+ *
+ * Example:
+ * @code
+ * {
+ *     parcBloomFilter_Clear(filter);
+ * }
+ * @endcode
+ */
+void parcBloomFilter_Clear(PARCBloomFilter *filter);
+
+/**
+ * Get the number of additions made to the filter, including additions merged by `parcBloomFilter_Union`.
+ *
+ * Adding the same element twice counts twice.
+ *
+ * @param [in] filter A pointer to a valid PARCBloomFilter instance.
+ *
+ * @return The number of additions.
+ *
+ * Example:
+ * @code
+ * {
+ *     size_t count = parcBloomFilter_Count(filter);
+ * }
+ * @endcode
+ */
+size_t parcBloomFilter_Count(const PARCBloomFilter *filter);
+
+/**
+ * Get the number of bits in the filter.
+ *
+ * @param [in] filter A pointer to a valid PARCBloomFilter instance.
+ *
+ * @return The number of bits, always a multiple of 512.
+ *
+ * Example:
+ * @code
+ * {
+ *     size_t bytes = parcBloomFilter_BitCount(filter) / 8;
+ * }
+ * @endcode
+ */
+size_t parcBloomFilter_BitCount(const PARCBloomFilter *filter);
+
+/**
+ * Get the number of bits set for each element.
+ *
+ * @param [in] filter A pointer to a valid PARCBloomFilter instance.
+ *
+ * @return The number of hash functions.
+ *
+ * Example:
+ * @code
+ * {
+ *     unsigned k = parcBloomFilter_HashCount(filter);
+ * }
+ * @endcode
+ */
+unsigned parcBloomFilter_HashCount(const PARCBloomFilter *filter);
+
+/**
+ * Serialize the filter into a new `PARCBuffer`.
+ *
+ * The returned buffer is flipped, ready to be read or written elsewhere.
+ *
+ * @param [in] filter A pointer to a valid PARCBloomFilter instance.
+ *
+ * @return non-NULL A pointer to a PARCBuffer containing the serialized filter, which the caller must release.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCBuffer *buffer = parcBloomFilter_ToBuffer(filter);
+ *     ...
+ *     parcBuffer_Release(&buffer);
+ * }
+ * @endcode
+ */
+PARCBuffer *parcBloomFilter_ToBuffer(const PARCBloomFilter *filter);
+#endif // libparc_parc_BloomFilter_h
@@ -30,6 +30,10 @@
  */
 #include <config.h>
 #include <ctype.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
 
 #include <LongBow/runtime.h>
 #include <LongBow/debugging.h>
@@ -61,6 +65,27 @@ struct parc_buffer {
      * If the mark is not defined then invoking the reset function causes a trap.
      */
     size_t mark;
+
+    /**
+     * If not NULL, the function given the backing PARCByteArray when this buffer is released, instead of releasing it.
+     */
+    PARCBufferRecycler *recycler;
+    void *recyclerContext;
+
+    /**
+     * If true, the content of this buffer may no longer be modified (see `parcBuffer_Freeze`).
+     * The position, limit and mark remain adjustable.
+     */
+    bool frozen;
+
+    /**
+     * For a frozen buffer, the hash code of the bytes between `hashPosition` and `hashLimit`.
+     * The cached value is valid only while the buffer's position and limit are those values.
+     * `hashPosition` is SIZE_MAX when nothing is cached.
+     */
+    PARCHashCode hashCode;
+    size_t hashPosition;
+    size_t hashLimit;
 };
 
 static inline void
@@ -82,12 +107,48 @@ _trapIfIndexExceedsLimit(const PARCBuffer *buffer, const size_t index)
                       parcBuffer_Limit(buffer), index);
 }
 
+static inline void
+_trapIfFrozen(const PARCBuffer *buffer)
+{
+    trapUnexpectedStateIf(buffer->frozen, "PARCBuffer@%p is frozen and its content cannot be modified", (void *) buffer);
+}
+
+static inline bool
+_hashCodeIsCached(const PARCBuffer *buffer)
+{
+    return buffer->hashPosition == buffer->position && buffer->hashLimit == buffer->limit;
+}
+
 static inline void
 _trapIfBufferUnderflow(const PARCBuffer *buffer, const size_t requiredRemaining)
 {
     _trapIfIndexExceedsLimit(buffer, buffer->position + requiredRemaining);
 }
 
+/*
+ * Trap unless an element of @p size bytes fits between @p index and the limit.
+ * Written as a subtraction so that an index near SIZE_MAX cannot wrap around.
+ */
+static inline void
+_trapIfElementExceedsLimit(const PARCBuffer *buffer, const size_t index, const size_t size)
+{
+    trapOutOfBoundsIf(buffer->limit < size || index > buffer->limit - size,
+                      "PARCBuffer limit at %zd, attempted to access %zd bytes at %zd",
+                      parcBuffer_Limit(buffer), size, index);
+}
+
+/*
+ * Trap unless @p count elements of @p size bytes fit in the remaining bytes.
+ * Written as a division so that a large count cannot wrap around.
+ */
+static inline void
+_trapIfElementsExceedRemaining(const PARCBuffer *buffer, const size_t count, const size_t size)
+{
+    trapOutOfBoundsIf(count > parcBuffer_Remaining(buffer) / size,
+                      "PARCBuffer has %zd bytes remaining, attempted to access %zd elements of %zd bytes",
+                      parcBuffer_Remaining(buffer), count, size);
+}
+
 static inline size_t
 _effectiveIndex(const PARCBuffer *buffer, const size_t index)
 {
@@ -100,6 +161,213 @@ _effectivePosition(const PARCBuffer *buffer)
     return buffer->arrayOffset + parcBuffer_Position(buffer);
 }
 
+/*
+ * The address of the byte at `index` (relative to the buffer's arrayOffset).
+ * Callers must have already checked that the bytes they touch are within the limit.
+ */
+static inline uint8_t *
+_parcBuffer_Address(const PARCBuffer *buffer, const size_t index)
+{
+    return parcByteArray_Array(buffer->array) + _effectiveIndex(buffer, index);
+}
+
+/*
+ * Multi-byte loads and stores at arbitrarily aligned addresses.
+ * The memcpy of a fixed-size value compiles to a single unaligned load or store,
+ * and the byte swap (when the host order differs) to a single bswap instruction.
+ */
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+#  define _toBigEndian16(_x_) (_x_)
+#  define _toBigEndian32(_x_) (_x_)
+#  define _toBigEndian64(_x_) (_x_)
+#  define _toLittleEndian16(_x_) __builtin_bswap16(_x_)
+#  define _toLittleEndian32(_x_) __builtin_bswap32(_x_)
+#  define _toLittleEndian64(_x_) __builtin_bswap64(_x_)
+#else
+#  define _toBigEndian16(_x_) __builtin_bswap16(_x_)
+#  define _toBigEndian32(_x_) __builtin_bswap32(_x_)
+#  define _toBigEndian64(_x_) __builtin_bswap64(_x_)
+#  define _toLittleEndian16(_x_) (_x_)
+#  define _toLittleEndian32(_x_) (_x_)
+#  define _toLittleEndian64(_x_) (_x_)
+#endif
+
+#define _parcBuffer_DefineLoadStore(_bits_) \
+    static inline uint ## _bits_ ## _t \
+    _loadBigEndian ## _bits_(const uint8_t * bytes) \
+    { \
+        uint ## _bits_ ## _t value; \
+        memcpy(&value, bytes, sizeof(value)); \
+        return _toBigEndian ## _bits_(value); \
+    } \
+    static inline uint ## _bits_ ## _t \
+    _loadLittleEndian ## _bits_(const uint8_t * bytes) \
+    { \
+        uint ## _bits_ ## _t value; \
+        memcpy(&value, bytes, sizeof(value)); \
+        return _toLittleEndian ## _bits_(value); \
+    } \
+    static inline void \
+    _storeBigEndian ## _bits_(uint8_t * bytes, uint ## _bits_ ## _t value) \
+    { \
+        value = _toBigEndian ## _bits_(value); \
+        memcpy(bytes, &value, sizeof(value)); \
+    } \
+    static inline void \
+    _storeLittleEndian ## _bits_(uint8_t * bytes, uint ## _bits_ ## _t value) \
+    { \
+        value = _toLittleEndian ## _bits_(value); \
+        memcpy(bytes, &value, sizeof(value)); \
+    }
+
+_parcBuffer_DefineLoadStore(16)
+_parcBuffer_DefineLoadStore(32)
+_parcBuffer_DefineLoadStore(64)
+
+/*
+ * A set of bytes, as a 256-bit membership bitmap, used to scan a run of bytes for the first member
+ * (or the first non-member).
+ *
+ * Where SSE2 or AVX2 is available and the set is small (the common case of whitespace or delimiters),
+ * 16 or 32 bytes are tested per step by comparing against each member in turn.
+ * Otherwise, and for the tail of a run, each byte is looked up in the bitmap.
+ */
+#define _PARCByteSet_MaxVectorMembers 8
+
+typedef struct {
+    uint64_t bitmap[4];
+    size_t memberCount;
+    uint8_t members[_PARCByteSet_MaxVectorMembers];
+} _PARCByteSet;
+
+static inline bool
+_parcByteSet_Contains(const _PARCByteSet *set, uint8_t byte)
+{
+    return (set->bitmap[byte >> 6] >> (byte & 63)) & 1;
+}
+
+static void
+_parcByteSet_Init(_PARCByteSet *set, size_t length, const uint8_t bytes[length])
+{
+    memset(set, 0, sizeof(*set));
+    for (size_t i = 0; i < length; i++) {
+        uint8_t byte = bytes[i];
+        if (!_parcByteSet_Contains(set, byte)) {
+            if (set->memberCount < _PARCByteSet_MaxVectorMembers) {
+                set->members[set->memberCount] = byte;
+            }
+            set->memberCount++;
+            set->bitmap[byte >> 6] |= UINT64_C(1) << (byte & 63);
+        }
+    }
+}
+
+static inline size_t
+_parcByteSet_ScanScalar(const _PARCByteSet *set, const uint8_t *bytes, size_t length, bool member)
+{
+    size_t i = 0;
+    for (; i + 4 <= length; i += 4) {
+        if (_parcByteSet_Contains(set, bytes[i]) == member) {
+            return i;
+        }
+        if (_parcByteSet_Contains(set, bytes[i + 1]) == member) {
+            return i + 1;
+        }
+        if (_parcByteSet_Contains(set, bytes[i + 2]) == member) {
+            return i + 2;
+        }
+        if (_parcByteSet_Contains(set, bytes[i + 3]) == member) {
+            return i + 3;
+        }
+    }
+    for (; i < length; i++) {
+        if (_parcByteSet_Contains(set, bytes[i]) == member) {
+            return i;
+        }
+    }
+    return length;
+}
+
+#if defined(__AVX2__)
+#  include <immintrin.h>
+
+static size_t
+_parcByteSet_ScanVector(const _PARCByteSet *set, const uint8_t *bytes, size_t length, bool member)
+{
+    __m256i needles[_PARCByteSet_MaxVectorMembers];
+    for (size_t m = 0; m < set->memberCount; m++) {
+        needles[m] = _mm256_set1_epi8((char) set->members[m]);
+    }
+
+    size_t i = 0;
+    for (; i + 32 <= length; i += 32) {
+        __m256i chunk = _mm256_loadu_si256((const __m256i *) &bytes[i]);
+        __m256i matches = _mm256_cmpeq_epi8(chunk, needles[0]);
+        for (size_t m = 1; m < set->memberCount; m++) {
+            matches = _mm256_or_si256(matches, _mm256_cmpeq_epi8(chunk, needles[m]));
+        }
+        uint32_t mask = (uint32_t) _mm256_movemask_epi8(matches);
+        if (!member) {
+            mask = ~mask;
+        }
+        if (mask != 0) {
+            return i + (size_t) __builtin_ctz(mask);
+        }
+    }
+    return i + _parcByteSet_ScanScalar(set, &bytes[i], length - i, member);
+}
+#elif defined(__SSE2__)
+#  include <emmintrin.h>
+
+static size_t
+_parcByteSet_ScanVector(const _PARCByteSet *set, const uint8_t *bytes, size_t length, bool member)
+{
+    __m128i needles[_PARCByteSet_MaxVectorMembers];
+    for (size_t m = 0; m < set->memberCount; m++) {
+        needles[m] = _mm_set1_epi8((char) set->members[m]);
+    }
+
+    size_t i = 0;
+    for (; i + 16 <= length; i += 16) {
+        __m128i chunk = _mm_loadu_si128((const __m128i *) &bytes[i]);
+        __m128i matches = _mm_cmpeq_epi8(chunk, needles[0]);
+        for (size_t m = 1; m < set->memberCount; m++) {
+            matches = _mm_or_si128(matches, _mm_cmpeq_epi8(chunk, needles[m]));
+        }
+        uint32_t mask = (uint32_t) _mm_movemask_epi8(matches);
+        if (!member) {
+            mask = ~mask & 0xFFFF;
+        }
+        if (mask != 0) {
+            return i + (size_t) __builtin_ctz(mask);
+        }
+    }
+    return i + _parcByteSet_ScanScalar(set, &bytes[i], length - i, member);
+}
+#else
+#  define _parcByteSet_ScanVector _parcByteSet_ScanScalar
+#endif
+
+/*
+ * Return the index of the first of `length` bytes whose membership in the set equals `member`,
+ * or `length` if there is none.
+ */
+static size_t
+_parcByteSet_Scan(const _PARCByteSet *set, const uint8_t *bytes, size_t length, bool member)
+{
+    if (set->memberCount == 0) {
+        return member ? length : 0;
+    }
+    if (member && set->memberCount == 1) {
+        const uint8_t *found = memchr(bytes, set->members[0], length);
+        return (found == NULL) ? length : (size_t) (found - bytes);
+    }
+    if (set->memberCount <= _PARCByteSet_MaxVectorMembers) {
+        return _parcByteSet_ScanVector(set, bytes, length, member);
+    }
+    return _parcByteSet_ScanScalar(set, bytes, length, member);
+}
+
 #ifdef PARCLibrary_DISABLE_VALIDATION
 #  define _optionalAssertInvariants(_instance_)
 #else
@@ -147,28 +415,67 @@ _digittoint(char digit)
     return result;
 }
 
-// This hexadecimal parsing code needs to be fixed - see FogBugz:3598
+static const char _hexDigits[] = "0123456789ABCDEF";
 
-static char *_hexDigitsUpper = "0123456789ABCDEF";
-static char *_hexDigitsLower = "0123456789abcdef";
+/*
+ * The value of each hexadecimal digit, upper or lower case. Every other character is 0xFF.
+ */
+static const uint8_t _hexDigitValue[256] = {
+/*   0 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+/*  16 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+/*  32 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+/*  48 */ 0,    1,    2,    3,    4,    5,    6,    7,    8,    9,    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+/*  64 */ 0xFF, 10,   11,   12,   13,   14,   15,   0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+/*  80 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+/*  96 */ 0xFF, 10,   11,   12,   13,   14,   15,   0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+/* 112 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+/* 128 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF,       0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF,       0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF,       0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF,       0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF,       0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF,       0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF,       0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
+};
 
-static inline char
-_fromHexDigit(char hexDigit)
-{
-    for (char i = 0; i < 16; i++) {
-        if (hexDigit == _hexDigitsLower[(int) i] || hexDigit == _hexDigitsUpper[(int) i]) {
-            return i;
-        }
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#  include <immintrin.h>
+
+/*
+ * 16 bytes to 32 hexadecimal digits per step: each nibble selects its digit with a byte shuffle.
+ * Return the number of bytes converted.
+ */
+__attribute__((target("ssse3")))
+static size_t
+_parcBuffer_ToHexSSSE3(char *output, size_t length, const uint8_t *bytes)
+{
+    const __m128i digits = _mm_loadu_si128((const __m128i *) _hexDigits);
+    const __m128i nibble = _mm_set1_epi8(0x0F);
+
+    size_t i = 0;
+    for (; i + 16 <= length; i += 16) {
+        __m128i in = _mm_loadu_si128((const __m128i *) &bytes[i]);
+        __m128i high = _mm_shuffle_epi8(digits, _mm_and_si128(_mm_srli_epi16(in, 4), nibble));
+        __m128i low = _mm_shuffle_epi8(digits, _mm_and_si128(in, nibble));
+        _mm_storeu_si128((__m128i *) &output[2 * i], _mm_unpacklo_epi8(high, low));
+        _mm_storeu_si128((__m128i *) &output[2 * i + 16], _mm_unpackhi_epi8(high, low));
     }
-    return -1;
+    return i;
 }
 
-static inline uint8_t
-_hexByte(const char *hexByte)
+static size_t
+_parcBuffer_ToHexVector(char *output, size_t length, const uint8_t *bytes)
 {
-    uint8_t result = (uint8_t) (_fromHexDigit(hexByte[0]) << 4) | _fromHexDigit(hexByte[1]);
-    return result;
+    return __builtin_cpu_supports("ssse3") ? _parcBuffer_ToHexSSSE3(output, length, bytes) : 0;
+}
+#else
+static size_t
+_parcBuffer_ToHexVector(char *output, size_t length, const uint8_t *bytes)
+{
+    return 0;
 }
+#endif
 
 static inline char *
 _parcBuffer_CheckValidity(const PARCBuffer *buffer)
@@ -247,7 +554,12 @@ _parcBuffer_Destructor(PARCBuffer **bufferPtr)
 {
     PARCBuffer *buffer = *bufferPtr;
 
-    parcByteArray_Release(&buffer->array);
+    if (buffer->recycler != NULL) {
+        buffer->recycler(buffer->recyclerContext, buffer->array);
+        buffer->array = NULL;
+    } else {
+        parcByteArray_Release(&buffer->array);
+    }
     return true;
 }
 
@@ -276,6 +588,14 @@ _parcBuffer_Init(PARCBuffer *result, PARCByteArray *array, size_t offset, size_t
     result->position = position;
     result->limit = limit;
     result->capacity = capacity;
+    result->recycler = NULL;
+    result->recyclerContext = NULL;
+    // A file mapping is read-only, so a buffer over one is frozen from the start.
+    // Unlike parcBuffer_Freeze, this does not compute the hash code, which would read the whole file.
+    result->frozen = parcByteArray_IsMapped(array);
+    result->hashCode = 0;
+    result->hashPosition = SIZE_MAX;
+    result->hashLimit = SIZE_MAX;
     _discardMark(result);
 
     parcBuffer_OptionalAssertValid(result);
@@ -358,10 +678,43 @@ parcBuffer_WrapByteArray(PARCByteArray *byteArray, size_t position, size_t limit
     return result;
 }
 
+PARCBuffer *
+parcBuffer_WrapRecyclableByteArray(PARCByteArray *byteArray, size_t capacity, PARCBufferRecycler *recycler, void *context)
+{
+    PARCBuffer *result = NULL;
+
+    if (capacity <= parcByteArray_Capacity(byteArray)) {
+        result = _parcBuffer_getInstance();
+
+        if (result != NULL) {
+            _parcBuffer_Init(result, byteArray, 0, 0, capacity, capacity);
+            result->recycler = recycler;
+            result->recyclerContext = context;
+        }
+    }
+
+    return result;
+}
+
 PARCBuffer *
 parcBuffer_Resize(PARCBuffer *buffer, size_t newCapacity)
 {
     parcBuffer_OptionalAssertValid(buffer);
+    _trapIfFrozen(buffer);
+
+    // When this buffer is the sole user of the whole backing array, grow or shrink it in place.
+    if (buffer->arrayOffset == 0 && buffer->capacity == parcByteArray_Capacity(buffer->array)) {
+        if (parcByteArray_Reallocate(buffer->array, newCapacity)) {
+            buffer->limit = _computeNewLimit(buffer->capacity, buffer->limit, newCapacity);
+            buffer->mark = _computeNewMark(buffer->mark, buffer->limit, newCapacity);
+            buffer->capacity = newCapacity;
+            buffer->position = (buffer->position < buffer->limit) ? buffer->position : buffer->limit;
+
+            parcBuffer_OptionalAssertValid(buffer);
+
+            return buffer;
+        }
+    }
 
     PARCByteArray *newArray = parcByteArray_Allocate(newCapacity);
     if (newArray == NULL) {
@@ -429,6 +782,35 @@ parcBuffer_WrapCString(char *string)
     return parcBuffer_Wrap(string, length, 0, length);
 }
 
+PARCBuffer *
+parcBuffer_MapFile(const char *pathName)
+{
+    PARCBuffer *result = NULL;
+
+    int fd = open(pathName, O_RDONLY);
+    if (fd >= 0) {
+        struct stat statbuf;
+        if (fstat(fd, &statbuf) == 0 && S_ISREG(statbuf.st_mode)) {
+            PARCByteArray *array = parcByteArray_MapFile(fd, 0, (size_t) statbuf.st_size);
+            if (array != NULL) {
+                result = parcBuffer_WrapByteArray(array, 0, parcByteArray_Capacity(array));
+                parcByteArray_Release(&array);
+            }
+        }
+        close(fd);
+    }
+
+    return result;
+}
+
+bool
+parcBuffer_Advise(const PARCBuffer *buffer, PARCByteArrayAdvice advice)
+{
+    parcBuffer_OptionalAssertValid(buffer);
+
+    return parcByteArray_Advise(buffer->array, _effectiveIndex(buffer, buffer->position), parcBuffer_Remaining(buffer), advice);
+}
+
 PARCBuffer *
 parcBuffer_AllocateCString(const char *string)
 {
@@ -452,9 +834,25 @@ parcBuffer_ParseHexString(const char *hexString)
         return NULL;
     }
 
-    PARCBuffer *result = parcBuffer_Allocate(length);
-    for (size_t i = 0; i < length; i += 2) {
-        parcBuffer_PutUint8(result, _hexByte(&hexString[i]));
+    PARCBuffer *result = parcBuffer_Allocate(length / 2);
+    if (result != NULL) {
+        const uint8_t *digits = (const uint8_t *) hexString;
+        uint8_t *bytes = parcBuffer_Overlay(result, 0);
+
+        // Any invalid digit sets the high bits of `invalid`.
+        uint8_t invalid = 0;
+        for (size_t i = 0; i < length / 2; i++) {
+            uint8_t high = _hexDigitValue[digits[2 * i]];
+            uint8_t low = _hexDigitValue[digits[2 * i + 1]];
+            invalid |= high | low;
+            bytes[i] = (uint8_t) (high << 4 | (low & 0x0F));
+        }
+
+        if (invalid & 0xF0) {
+            parcBuffer_Release(&result);
+        } else {
+            parcBuffer_SetPosition(result, length / 2);
+        }
     }
 
     return result;
@@ -503,6 +901,22 @@ parcBuffer_Equals(const PARCBuffer *x, const PARCBuffer *y)
         return false;
     }
 
+    if (parcBuffer_Remaining(x) != parcBuffer_Remaining(y)) {
+        return false;
+    }
+
+    // Two frozen buffers whose hash codes are known and differ cannot be equal.
+    if (x->frozen && y->frozen && _hashCodeIsCached(x) && _hashCodeIsCached(y)) {
+        if (x->hashCode != y->hashCode) {
+            return false;
+        }
+    }
+
+    // Views of the very same bytes (for example, a frozen buffer and its copy) are equal without comparing them.
+    if (x->array == y->array && _effectivePosition(x) == _effectivePosition(y)) {
+        return true;
+    }
+
     return (parcBuffer_Compare(x, y) == 0);
 }
 
@@ -564,6 +978,10 @@ parcBuffer_Duplicate(const PARCBuffer *original)
                          original->position,
                          parcBuffer_Limit(original),
                          original->capacity);
+        result->frozen = original->frozen;
+        result->hashCode = original->hashCode;
+        result->hashPosition = original->hashPosition;
+        result->hashLimit = original->hashLimit;
 
         _optionalAssertInvariants(result);
     }
@@ -581,6 +999,12 @@ parcBuffer_Slice(const PARCBuffer *original)
                          0,
                          parcBuffer_Limit(original) - parcBuffer_Position(original),
                          parcBuffer_Limit(original) - parcBuffer_Position(original));
+        result->frozen = original->frozen;
+        if (original->frozen && _hashCodeIsCached(original)) {
+            result->hashCode = original->hashCode;
+            result->hashPosition = 0;
+            result->hashLimit = result->limit;
+        }
 
         _optionalAssertInvariants(result);
     }
@@ -708,6 +1132,11 @@ parcBuffer_Copy(const PARCBuffer *original)
 {
     parcBuffer_OptionalAssertValid(original);
 
+    // The content of a frozen buffer never changes, so a copy can share it.
+    if (original->frozen) {
+        return parcBuffer_Duplicate(original);
+    }
+
     PARCBuffer *result = _parcBuffer_getInstance();
 
     if (result != NULL) {
@@ -789,38 +1218,143 @@ parcBuffer_GetBytes(PARCBuffer *buffer, size_t length, uint8_t array[length])
 uint16_t
 parcBuffer_GetUint16(PARCBuffer *buffer)
 {
-    uint8_t high = parcBuffer_GetUint8(buffer);
-    uint8_t low = parcBuffer_GetUint8(buffer);
-
-    uint16_t result = (high << 8) | low;
+    parcBuffer_OptionalAssertValid(buffer);
+    _trapIfBufferUnderflow(buffer, sizeof(uint16_t));
 
+    uint16_t result = _loadBigEndian16(_parcBuffer_Address(buffer, buffer->position));
+    buffer->position += sizeof(uint16_t);
     return result;
 }
 
 uint32_t
 parcBuffer_GetUint32(PARCBuffer *buffer)
 {
-    uint32_t result = 0;
-    for (int i = 0; i < sizeof(uint32_t); i++) {
-        result = result << 8 | parcBuffer_GetUint8(buffer);
-    }
+    parcBuffer_OptionalAssertValid(buffer);
+    _trapIfBufferUnderflow(buffer, sizeof(uint32_t));
+
+    uint32_t result = _loadBigEndian32(_parcBuffer_Address(buffer, buffer->position));
+    buffer->position += sizeof(uint32_t);
     return result;
 }
 
 uint64_t
 parcBuffer_GetUint64(PARCBuffer *buffer)
 {
-    uint64_t result = 0;
-    for (int i = 0; i < sizeof(uint64_t); i++) {
-        result = result << 8 | parcBuffer_GetUint8(buffer);
-    }
+    parcBuffer_OptionalAssertValid(buffer);
+    _trapIfBufferUnderflow(buffer, sizeof(uint64_t));
+
+    uint64_t result = _loadBigEndian64(_parcBuffer_Address(buffer, buffer->position));
+    buffer->position += sizeof(uint64_t);
+    return result;
+}
+
+uint16_t
+parcBuffer_GetUint16LE(PARCBuffer *buffer)
+{
+    parcBuffer_OptionalAssertValid(buffer);
+    _trapIfBufferUnderflow(buffer, sizeof(uint16_t));
+
+    uint16_t result = _loadLittleEndian16(_parcBuffer_Address(buffer, buffer->position));
+    buffer->position += sizeof(uint16_t);
+    return result;
+}
+
+uint32_t
+parcBuffer_GetUint32LE(PARCBuffer *buffer)
+{
+    parcBuffer_OptionalAssertValid(buffer);
+    _trapIfBufferUnderflow(buffer, sizeof(uint32_t));
+
+    uint32_t result = _loadLittleEndian32(_parcBuffer_Address(buffer, buffer->position));
+    buffer->position += sizeof(uint32_t);
+    return result;
+}
+
+uint64_t
+parcBuffer_GetUint64LE(PARCBuffer *buffer)
+{
+    parcBuffer_OptionalAssertValid(buffer);
+    _trapIfBufferUnderflow(buffer, sizeof(uint64_t));
+
+    uint64_t result = _loadLittleEndian64(_parcBuffer_Address(buffer, buffer->position));
+    buffer->position += sizeof(uint64_t);
     return result;
 }
 
+uint16_t
+parcBuffer_GetUint16AtIndex(const PARCBuffer *buffer, size_t index)
+{
+    parcBuffer_OptionalAssertValid(buffer);
+    _trapIfElementExceedsLimit(buffer, index, sizeof(uint16_t));
+
+    return _loadBigEndian16(_parcBuffer_Address(buffer, index));
+}
+
+uint32_t
+parcBuffer_GetUint32AtIndex(const PARCBuffer *buffer, size_t index)
+{
+    parcBuffer_OptionalAssertValid(buffer);
+    _trapIfElementExceedsLimit(buffer, index, sizeof(uint32_t));
+
+    return _loadBigEndian32(_parcBuffer_Address(buffer, index));
+}
+
+uint64_t
+parcBuffer_GetUint64AtIndex(const PARCBuffer *buffer, size_t index)
+{
+    parcBuffer_OptionalAssertValid(buffer);
+    _trapIfElementExceedsLimit(buffer, index, sizeof(uint64_t));
+
+    return _loadBigEndian64(_parcBuffer_Address(buffer, index));
+}
+
+PARCBuffer *
+parcBuffer_GetUint16Array(PARCBuffer *buffer, size_t count, uint16_t array[count])
+{
+    parcBuffer_OptionalAssertValid(buffer);
+    _trapIfElementsExceedRemaining(buffer, count, sizeof(uint16_t));
+
+    const uint8_t *bytes = _parcBuffer_Address(buffer, buffer->position);
+    for (size_t i = 0; i < count; i++) {
+        array[i] = _loadBigEndian16(&bytes[i * sizeof(uint16_t)]);
+    }
+    buffer->position += count * sizeof(uint16_t);
+    return buffer;
+}
+
+PARCBuffer *
+parcBuffer_GetUint32Array(PARCBuffer *buffer, size_t count, uint32_t array[count])
+{
+    parcBuffer_OptionalAssertValid(buffer);
+    _trapIfElementsExceedRemaining(buffer, count, sizeof(uint32_t));
+
+    const uint8_t *bytes = _parcBuffer_Address(buffer, buffer->position);
+    for (size_t i = 0; i < count; i++) {
+        array[i] = _loadBigEndian32(&bytes[i * sizeof(uint32_t)]);
+    }
+    buffer->position += count * sizeof(uint32_t);
+    return buffer;
+}
+
+PARCBuffer *
+parcBuffer_GetUint64Array(PARCBuffer *buffer, size_t count, uint64_t array[count])
+{
+    parcBuffer_OptionalAssertValid(buffer);
+    _trapIfElementsExceedRemaining(buffer, count, sizeof(uint64_t));
+
+    const uint8_t *bytes = _parcBuffer_Address(buffer, buffer->position);
+    for (size_t i = 0; i < count; i++) {
+        array[i] = _loadBigEndian64(&bytes[i * sizeof(uint64_t)]);
+    }
+    buffer->position += count * sizeof(uint64_t);
+    return buffer;
+}
+
 PARCBuffer *
 parcBuffer_PutUint8(PARCBuffer *buffer, uint8_t value)
 {
     parcBuffer_OptionalAssertValid(buffer);
+    _trapIfFrozen(buffer);
     assertTrue(parcBuffer_Remaining(buffer) >= 1,
                "Buffer overflow");
 
@@ -832,37 +1366,309 @@ parcBuffer_PutUint8(PARCBuffer *buffer, uint8_t value)
 PARCBuffer *
 parcBuffer_PutUint16(PARCBuffer *buffer, uint16_t value)
 {
+    parcBuffer_OptionalAssertValid(buffer);
+    _trapIfFrozen(buffer);
     assertTrue(parcBuffer_Remaining(buffer) >= sizeof(uint16_t),
                "Buffer overflow");
 
-    parcBuffer_PutUint8(buffer, (value >> 8) & 0xFF);
-    parcBuffer_PutUint8(buffer, value & 0xFF);
+    _storeBigEndian16(_parcBuffer_Address(buffer, buffer->position), value);
+    buffer->position += sizeof(uint16_t);
     return buffer;
 }
 
 PARCBuffer *
 parcBuffer_PutUint32(PARCBuffer *buffer, uint32_t value)
 {
+    parcBuffer_OptionalAssertValid(buffer);
+    _trapIfFrozen(buffer);
     assertTrue(parcBuffer_Remaining(buffer) >= sizeof(uint32_t),
                "Buffer overflow");
-    for (int i = sizeof(uint32_t) - 1; i > 0; i--) {
-        uint8_t b = value >> (i * 8) & 0xFF;
-        parcBuffer_PutUint8(buffer, b);
-    }
-    parcBuffer_PutUint8(buffer, value & 0xFF);
+
+    _storeBigEndian32(_parcBuffer_Address(buffer, buffer->position), value);
+    buffer->position += sizeof(uint32_t);
     return buffer;
 }
 
 PARCBuffer *
 parcBuffer_PutUint64(PARCBuffer *buffer, uint64_t value)
 {
+    parcBuffer_OptionalAssertValid(buffer);
+    _trapIfFrozen(buffer);
     assertTrue(parcBuffer_Remaining(buffer) >= sizeof(uint64_t),
                "Buffer overflow");
-    for (int i = sizeof(uint64_t) - 1; i > 0; i--) {
-        uint8_t b = value >> (i * 8) & 0xFF;
-        parcBuffer_PutUint8(buffer, b);
+
+    _storeBigEndian64(_parcBuffer_Address(buffer, buffer->position), value);
+    buffer->position += sizeof(uint64_t);
+    return buffer;
+}
+
+PARCBuffer *
+parcBuffer_PutUint16LE(PARCBuffer *buffer, uint16_t value)
+{
+    parcBuffer_OptionalAssertValid(buffer);
+    _trapIfFrozen(buffer);
+    assertTrue(parcBuffer_Remaining(buffer) >= sizeof(uint16_t),
+               "Buffer overflow");
+
+    _storeLittleEndian16(_parcBuffer_Address(buffer, buffer->position), value);
+    buffer->position += sizeof(uint16_t);
+    return buffer;
+}
+
+PARCBuffer *
+parcBuffer_PutUint32LE(PARCBuffer *buffer, uint32_t value)
+{
+    parcBuffer_OptionalAssertValid(buffer);
+    _trapIfFrozen(buffer);
+    assertTrue(parcBuffer_Remaining(buffer) >= sizeof(uint32_t),
+               "Buffer overflow");
+
+    _storeLittleEndian32(_parcBuffer_Address(buffer, buffer->position), value);
+    buffer->position += sizeof(uint32_t);
+    return buffer;
+}
+
+PARCBuffer *
+parcBuffer_PutUint64LE(PARCBuffer *buffer, uint64_t value)
+{
+    parcBuffer_OptionalAssertValid(buffer);
+    _trapIfFrozen(buffer);
+    assertTrue(parcBuffer_Remaining(buffer) >= sizeof(uint64_t),
+               "Buffer overflow");
+
+    _storeLittleEndian64(_parcBuffer_Address(buffer, buffer->position), value);
+    buffer->position += sizeof(uint64_t);
+    return buffer;
+}
+
+PARCBuffer *
+parcBuffer_PutUint16Array(PARCBuffer *buffer, size_t count, const uint16_t array[count])
+{
+    parcBuffer_OptionalAssertValid(buffer);
+    _trapIfFrozen(buffer);
+    _trapIfElementsExceedRemaining(buffer, count, sizeof(uint16_t));
+
+    uint8_t *bytes = _parcBuffer_Address(buffer, buffer->position);
+    for (size_t i = 0; i < count; i++) {
+        _storeBigEndian16(&bytes[i * sizeof(uint16_t)], array[i]);
     }
-    parcBuffer_PutUint8(buffer, value & 0xFF);
+    buffer->position += count * sizeof(uint16_t);
+    return buffer;
+}
+
+PARCBuffer *
+parcBuffer_PutUint32Array(PARCBuffer *buffer, size_t count, const uint32_t array[count])
+{
+    parcBuffer_OptionalAssertValid(buffer);
+    _trapIfFrozen(buffer);
+    _trapIfElementsExceedRemaining(buffer, count, sizeof(uint32_t));
+
+    uint8_t *bytes = _parcBuffer_Address(buffer, buffer->position);
+    for (size_t i = 0; i < count; i++) {
+        _storeBigEndian32(&bytes[i * sizeof(uint32_t)], array[i]);
+    }
+    buffer->position += count * sizeof(uint32_t);
+    return buffer;
+}
+
+PARCBuffer *
+parcBuffer_PutUint64Array(PARCBuffer *buffer, size_t count, const uint64_t array[count])
+{
+    parcBuffer_OptionalAssertValid(buffer);
+    _trapIfFrozen(buffer);
+    _trapIfElementsExceedRemaining(buffer, count, sizeof(uint64_t));
+
+    uint8_t *bytes = _parcBuffer_Address(buffer, buffer->position);
+    for (size_t i = 0; i < count; i++) {
+        _storeBigEndian64(&bytes[i * sizeof(uint64_t)], array[i]);
+    }
+    buffer->position += count * sizeof(uint64_t);
+    return buffer;
+}
+
+size_t
+parcBuffer_VarintLength(uint64_t value)
+{
+    // The number of significant bytes, at least one.
+    return (value == 0) ? 1 : (size_t) (64 - __builtin_clzll(value) + 7) / 8;
+}
+
+uint64_t
+parcBuffer_GetVarint(PARCBuffer *buffer, size_t length)
+{
+    parcBuffer_OptionalAssertValid(buffer);
+    trapIllegalValueIf(length > sizeof(uint64_t), "A varint is at most %zd bytes, not %zd", sizeof(uint64_t), length);
+    _trapIfBufferUnderflow(buffer, length);
+
+    uint64_t result = 0;
+    const uint8_t *bytes = _parcBuffer_Address(buffer, buffer->position);
+
+    if (length > 0 && parcBuffer_Remaining(buffer) >= sizeof(uint64_t)) {
+        // One load of the next 8 bytes, keeping the first `length` of them.
+        result = _loadBigEndian64(bytes) >> (64 - 8 * length);
+    } else {
+        for (size_t i = 0; i < length; i++) {
+            result = (result << 8) | bytes[i];
+        }
+    }
+    buffer->position += length;
+    return result;
+}
+
+PARCBuffer *
+parcBuffer_PutVarint(PARCBuffer *buffer, uint64_t value)
+{
+    parcBuffer_OptionalAssertValid(buffer);
+    _trapIfFrozen(buffer);
+    size_t length = parcBuffer_VarintLength(value);
+    assertTrue(parcBuffer_Remaining(buffer) >= length,
+               "Buffer overflow");
+
+    uint8_t encoded[sizeof(uint64_t)];
+    _storeBigEndian64(encoded, value << (64 - 8 * length));
+    memcpy(_parcBuffer_Address(buffer, buffer->position), encoded, length);
+    buffer->position += length;
+    return buffer;
+}
+
+/*
+ * LEB128: little-endian groups of 7 bits, each byte but the last having its high bit set.
+ * A 64-bit value takes at most 10 bytes.
+ */
+#define _parcLEB128_MaxLength 10
+
+size_t
+parcBuffer_LEB128Length(uint64_t value)
+{
+    return (value == 0) ? 1 : (size_t) (64 - __builtin_clzll(value) + 6) / 7;
+}
+
+/*
+ * Decode the LEB128 value at `bytes`, of which `available` bytes may be read,
+ * returning the number of bytes it occupies, or 0 if it is not terminated within `available` bytes
+ * or does not fit in 64 bits.
+ */
+static inline size_t
+_parcLEB128_Decode(const uint8_t *bytes, size_t available, uint64_t *value)
+{
+    if (available >= sizeof(uint64_t)) {
+        uint64_t word = _loadLittleEndian64(bytes);
+        uint64_t terminators = ~word & 0x8080808080808080ULL;
+        if (terminators != 0) {
+            // A value of up to 8 bytes: keep its bytes, drop the continuation bits and close the 7-bit groups up.
+            size_t length = (size_t) (__builtin_ctzll(terminators) + 1) / 8;
+            uint64_t x = word & 0x7F7F7F7F7F7F7F7FULL;
+            if (length < sizeof(uint64_t)) {
+                x &= (1ULL << (8 * length)) - 1;
+            }
+            x = ((x & 0x7F007F007F007F00ULL) >> 1) | (x & 0x007F007F007F007FULL);
+            x = ((x & 0x3FFF00003FFF0000ULL) >> 2) | (x & 0x00003FFF00003FFFULL);
+            x = ((x & 0x0FFFFFFF00000000ULL) >> 4) | (x & 0x000000000FFFFFFFULL);
+            *value = x;
+            return length;
+        }
+    }
+
+    uint64_t result = 0;
+    size_t limit = (available < _parcLEB128_MaxLength) ? available : _parcLEB128_MaxLength;
+    for (size_t i = 0; i < limit; i++) {
+        // The tenth byte holds only bit 63; any other payload bit would be shifted out.
+        if (i == _parcLEB128_MaxLength - 1 && (bytes[i] & 0x7F) > 0x01) {
+            return 0;
+        }
+        result |= (uint64_t) (bytes[i] & 0x7F) << (7 * i);
+        if ((bytes[i] & 0x80) == 0) {
+            *value = result;
+            return i + 1;
+        }
+    }
+    return 0;
+}
+
+static inline void
+_trapIfMalformedLEB128(const PARCBuffer *buffer, size_t length)
+{
+    trapIllegalValueIf(length == 0 && parcBuffer_Remaining(buffer) >= _parcLEB128_MaxLength,
+                       "PARCBuffer@%p: LEB128 value at %zd is longer than %d bytes or exceeds 64 bits",
+                       (void *) buffer, parcBuffer_Position(buffer), _parcLEB128_MaxLength);
+    _trapIfBufferUnderflow(buffer, (length == 0) ? parcBuffer_Remaining(buffer) + 1 : length);
+}
+
+uint64_t
+parcBuffer_GetLEB128(PARCBuffer *buffer)
+{
+    parcBuffer_OptionalAssertValid(buffer);
+
+    uint64_t result = 0;
+    size_t length = _parcLEB128_Decode(_parcBuffer_Address(buffer, buffer->position), parcBuffer_Remaining(buffer), &result);
+    _trapIfMalformedLEB128(buffer, length);
+
+    buffer->position += length;
+    return result;
+}
+
+PARCBuffer *
+parcBuffer_GetLEB128Array(PARCBuffer *buffer, size_t count, uint64_t array[count])
+{
+    parcBuffer_OptionalAssertValid(buffer);
+
+    const uint8_t *bytes = _parcBuffer_Address(buffer, buffer->position);
+    size_t remaining = parcBuffer_Remaining(buffer);
+    size_t offset = 0;
+    size_t i = 0;
+
+    while (i < count) {
+#if defined(__SSE2__)
+        // A run of 16 single-byte values, the common case for small lengths and counts, is widened in place.
+        if (count - i >= 16 && remaining - offset >= 16) {
+            __m128i chunk = _mm_loadu_si128((const __m128i *) &bytes[offset]);
+            if (_mm_movemask_epi8(chunk) == 0) {
+                __m128i zero = _mm_setzero_si128();
+                __m128i lo16 = _mm_unpacklo_epi8(chunk, zero);
+                __m128i hi16 = _mm_unpackhi_epi8(chunk, zero);
+                __m128i words[4] = {
+                    _mm_unpacklo_epi16(lo16, zero), _mm_unpackhi_epi16(lo16, zero),
+                    _mm_unpacklo_epi16(hi16, zero), _mm_unpackhi_epi16(hi16, zero)
+                };
+                for (int w = 0; w < 4; w++) {
+                    _mm_storeu_si128((__m128i *) &array[i + 4 * w], _mm_unpacklo_epi32(words[w], zero));
+                    _mm_storeu_si128((__m128i *) &array[i + 4 * w + 2], _mm_unpackhi_epi32(words[w], zero));
+                }
+                i += 16;
+                offset += 16;
+                continue;
+            }
+        }
+#endif
+        size_t length = _parcLEB128_Decode(&bytes[offset], remaining - offset, &array[i]);
+        if (length == 0) {
+            buffer->position += offset;
+            _trapIfMalformedLEB128(buffer, length);
+        }
+        offset += length;
+        i++;
+    }
+
+    buffer->position += offset;
+    return buffer;
+}
+
+PARCBuffer *
+parcBuffer_PutLEB128(PARCBuffer *buffer, uint64_t value)
+{
+    parcBuffer_OptionalAssertValid(buffer);
+    _trapIfFrozen(buffer);
+    size_t length = parcBuffer_LEB128Length(value);
+    assertTrue(parcBuffer_Remaining(buffer) >= length,
+               "Buffer overflow");
+
+    uint8_t *bytes = _parcBuffer_Address(buffer, buffer->position);
+    for (size_t i = 0; i < length - 1; i++) {
+        bytes[i] = (uint8_t) (value | 0x80);
+        value >>= 7;
+    }
+    bytes[length - 1] = (uint8_t) value;
+    buffer->position += length;
     return buffer;
 }
 
@@ -870,6 +1676,7 @@ PARCBuffer *
 parcBuffer_PutAtIndex(PARCBuffer *buffer, size_t index, uint8_t value)
 {
     parcBuffer_OptionalAssertValid(buffer);
+    _trapIfFrozen(buffer);
     assertTrue(_effectiveIndex(buffer, index) < parcBuffer_Limit(buffer), "Buffer overflow");
 
     parcByteArray_PutByte(buffer->array, _effectiveIndex(buffer, index), value);
@@ -880,6 +1687,7 @@ PARCBuffer *
 parcBuffer_PutArray(PARCBuffer *buffer, size_t arrayLength, const uint8_t array[arrayLength])
 {
     parcBuffer_OptionalAssertValid(buffer);
+    _trapIfFrozen(buffer);
     assertTrue(parcBuffer_Remaining(buffer) >= arrayLength,
                "Buffer overflow");
 
@@ -897,6 +1705,7 @@ PARCBuffer *
 parcBuffer_PutBuffer(PARCBuffer *result, const PARCBuffer *buffer)
 {
     parcBuffer_OptionalAssertValid(buffer);
+    _trapIfFrozen(result);
     assertTrue(parcBuffer_Remaining(result) >= parcBuffer_Remaining(buffer),
                "Buffer overflow. %zd bytes remaining, %zd required.", parcBuffer_Remaining(result), parcBuffer_Remaining(buffer));
 
@@ -909,24 +1718,80 @@ parcBuffer_PutBuffer(PARCBuffer *result, const PARCBuffer *buffer)
 PARCHashCode
 parcBuffer_HashCode(const PARCBuffer *buffer)
 {
+    if (buffer->frozen && _hashCodeIsCached(buffer)) {
+        return buffer->hashCode;
+    }
+
     PARCHashCode result = 0;
 
     size_t remaining = parcBuffer_Remaining(buffer);
     if (remaining > 0) {
         result = parcHashCode_Hash(parcBuffer_Overlay((PARCBuffer *) buffer, 0), parcBuffer_Remaining(buffer));
     }
+
+    if (buffer->frozen) {
+        // The cache is not part of the buffer's observable state.
+        PARCBuffer *mutable = (PARCBuffer *) buffer;
+        mutable->hashCode = result;
+        mutable->hashPosition = buffer->position;
+        mutable->hashLimit = buffer->limit;
+    }
     return result;
 }
 
+PARCBuffer *
+parcBuffer_Freeze(PARCBuffer *buffer)
+{
+    parcBuffer_OptionalAssertValid(buffer);
+
+    if (!buffer->frozen) {
+        buffer->frozen = true;
+        parcBuffer_HashCode(buffer);
+    }
+    return buffer;
+}
+
+bool
+parcBuffer_IsFrozen(const PARCBuffer *buffer)
+{
+    parcBuffer_OptionalAssertValid(buffer);
+
+    return buffer->frozen;
+}
+
 size_t
 parcBuffer_FindUint8(const PARCBuffer *buffer, uint8_t byte)
 {
-    for (size_t i = parcBuffer_Position(buffer); i < parcBuffer_Limit(buffer); i++) {
-        if (parcBuffer_GetAtIndex(buffer, i) == byte) {
-            return i;
-        }
+    return parcBuffer_FindByte(buffer, byte);
+}
+
+size_t
+parcBuffer_FindByte(const PARCBuffer *buffer, uint8_t byte)
+{
+    parcBuffer_OptionalAssertValid(buffer);
+
+    size_t result = SIZE_MAX;
+
+    const uint8_t *start = _parcBuffer_Address(buffer, buffer->position);
+    const uint8_t *found = memchr(start, byte, parcBuffer_Remaining(buffer));
+    if (found != NULL) {
+        result = buffer->position + (size_t) (found - start);
     }
-    return SIZE_MAX;
+    return result;
+}
+
+size_t
+parcBuffer_FindAny(const PARCBuffer *buffer, size_t length, const uint8_t bytes[length])
+{
+    parcBuffer_OptionalAssertValid(buffer);
+
+    _PARCByteSet set;
+    _parcByteSet_Init(&set, length, bytes);
+
+    size_t remaining = parcBuffer_Remaining(buffer);
+    size_t index = _parcByteSet_Scan(&set, _parcBuffer_Address(buffer, buffer->position), remaining, true);
+
+    return (index < remaining) ? buffer->position + index : SIZE_MAX;
 }
 
 char *
@@ -961,12 +1826,6 @@ parcBuffer_Display(const PARCBuffer *buffer, int indentation)
 }
 
 // Given a value, return the low nibble as a hex character.
-static char
-_toHexDigit(const char value)
-{
-    return "0123456789ABCDEF"[value & 0xF];
-}
-
 char *
 parcBuffer_ToHexString(const PARCBuffer *buffer)
 {
@@ -977,46 +1836,61 @@ parcBuffer_ToHexString(const PARCBuffer *buffer)
     size_t length = parcBuffer_Remaining(buffer);
     // Hopefully length is less than (2^(sizeof(size_t)*8) / 2)
 
-    char *result = parcMemory_AllocateAndClear((length * 2) + 1);
-    assertNotNull(result, "parcMemory_AllocateAndClear(%zu) returned NULL", (length * 2) + 1);
+    char *result = parcMemory_Allocate((length * 2) + 1);
+    assertNotNull(result, "parcMemory_Allocate(%zu) returned NULL", (length * 2) + 1);
 
-    for (size_t i = 0; i < length; i++) {
-        unsigned char byte = parcBuffer_GetAtIndex(buffer, i);
-        result[i * 2] = _toHexDigit(byte >> 4);
-        result[i * 2 + 1] = _toHexDigit(byte);
+    const uint8_t *bytes = parcBuffer_Overlay((PARCBuffer *) buffer, 0);
+    for (size_t i = _parcBuffer_ToHexVector(result, length, bytes); i < length; i++) {
+        result[i * 2] = _hexDigits[bytes[i] >> 4];
+        result[i * 2 + 1] = _hexDigits[bytes[i] & 0x0F];
     }
     result[length * 2] = 0;
 
     return result;
 }
 
+/*
+ * Advance the buffer's position to the first byte whose membership in the given set equals `member`,
+ * returning true if such a byte was found before the limit.
+ */
+static bool
+_parcBuffer_SkipWhile(PARCBuffer *buffer, size_t length, const uint8_t bytes[length], bool member)
+{
+    size_t remaining = parcBuffer_Remaining(buffer);
+    if (remaining == 0) {
+        return false;
+    }
+
+    const uint8_t *start = _parcBuffer_Address(buffer, buffer->position);
+
+    // Most calls (e.g. skipping whitespace between JSON tokens) stop at the first byte.
+    if ((memchr(bytes, start[0], length) != NULL) == member) {
+        return true;
+    }
+
+    _PARCByteSet set;
+    _parcByteSet_Init(&set, length, bytes);
+
+    size_t index = 1 + _parcByteSet_Scan(&set, start + 1, remaining - 1, member);
+    buffer->position += index;
+
+    return index < remaining;
+}
+
 bool
 parcBuffer_SkipOver(PARCBuffer *buffer, size_t length, const uint8_t bytesToSkipOver[length])
 {
-    while (parcBuffer_Remaining(buffer) > 0) {
-        uint8_t character = parcBuffer_GetUint8(buffer);
-        if (memchr(bytesToSkipOver, character, length) == NULL) {
-            parcBuffer_SetPosition(buffer, parcBuffer_Position(buffer) - 1);
-            return true;
-        }
-    }
-    return false;
+    parcBuffer_OptionalAssertValid(buffer);
+
+    return _parcBuffer_SkipWhile(buffer, length, bytesToSkipOver, false);
 }
 
 bool
 parcBuffer_SkipTo(PARCBuffer *buffer, size_t length, const uint8_t bytesToSkipTo[length])
 {
-    bool result = false;
+    parcBuffer_OptionalAssertValid(buffer);
 
-    while (parcBuffer_Remaining(buffer) > 0) {
-        uint8_t character = parcBuffer_GetUint8(buffer);
-        if (memchr(bytesToSkipTo, character, length) != NULL) {
-            parcBuffer_SetPosition(buffer, parcBuffer_Position(buffer) - 1);
-            result = true;
-            break;
-        }
-    }
-    return result;
+    return _parcBuffer_SkipWhile(buffer, length, bytesToSkipTo, true);
 }
 
 uint8_t
@@ -118,7 +118,12 @@
  * Both `Put` and `Get` operations have a full compliment of intrinsic data types that operate on data at
  * relative positions in the buffer.
  *
- * The function {@link parcBuffer_GetAtIndex} provides absolute index access to the buffer for bytes.
+ * The function {@link parcBuffer_GetAtIndex} provides absolute index access to the buffer for bytes,
+ * and {@link parcBuffer_GetUint16AtIndex}, {@link parcBuffer_GetUint32AtIndex} and {@link parcBuffer_GetUint64AtIndex}
+ * for network-order multi-byte values.
+ *
+ * Multi-byte values are big-endian (network order) unless the function name ends in `LE`.
+ * The `Array` variants transfer a run of values with a single bounds check.
  *
  * * {@link parcBuffer_PutUint8},
  * * {@link parcBuffer_PutUint16},
@@ -304,6 +309,52 @@ PARCBuffer *parcBuffer_Wrap(void *array, size_t arrayLength, size_t position, si
  */
 PARCBuffer *parcBuffer_WrapByteArray(PARCByteArray *byteArray, size_t position, size_t limit);
 
+/**
+ * A function given the backing `PARCByteArray` of a recyclable `PARCBuffer` when the buffer is released.
+ *
+ * The function receives the buffer's reference to the array and must either keep it or release it.
+ * Other references to the array, such as those held by slices of the buffer, may still exist.
+ *
+ * @param [in] context The context given to {@link parcBuffer_WrapRecyclableByteArray}.
+ * @param [in] byteArray The buffer's reference to its backing `PARCByteArray`.
+ *
+ * @see parcBuffer_WrapRecyclableByteArray
+ */
+typedef void (PARCBufferRecycler)(void *context, PARCByteArray *byteArray);
+
+/**
+ * Create a new instance of `PARCBuffer` backed by the given {@link PARCByteArray},
+ * which is handed to @p recycler instead of being released when the buffer is released.
+ *
+ * This is the mechanism by which a pool, such as `PARCBufferPool`, reuses the storage of released buffers.
+ * The new buffer takes over the caller's reference to @p byteArray; no new reference is acquired.
+ * If NULL is returned, the caller keeps its reference.
+ *
+ * The new buffer's capacity and limit will be @p capacity, its position will be 0, and its mark will be undefined.
+ * Buffers derived from it, such as slices and duplicates, share the array but are not recyclable themselves.
+ *
+ * @param [in] byteArray A pointer to a `PARCByteArray` instance.
+ * @param [in] capacity The capacity of the buffer, which must be less than or equal to the PARCByteArray's capacity.
+ * @param [in] recycler The function given the array when the buffer is released.
+ * @param [in] context A value passed to @p recycler.
+ *
+ * @return A `PARCBuffer` pointer, or NULL if @p capacity exceeds the capacity of @p byteArray.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCByteArray *array = parcByteArray_Allocate(2048);
+ *
+ *     PARCBuffer *buffer = parcBuffer_WrapRecyclableByteArray(array, 1500, _returnToFreeList, freeList);
+ *
+ *     parcBuffer_Release(&buffer); // _returnToFreeList(freeList, array) is called
+ * }
+ * @endcode
+ *
+ * @see parcBufferPool_GetBuffer
+ */
+PARCBuffer *parcBuffer_WrapRecyclableByteArray(PARCByteArray *byteArray, size_t capacity, PARCBufferRecycler *recycler, void *context);
+
 /**
  * Create a new instance of `PARCBuffer` wrapping the given null-terminated C string as its value.
  *
@@ -330,6 +381,67 @@ PARCBuffer *parcBuffer_WrapByteArray(PARCByteArray *byteArray, size_t position,
  */
 PARCBuffer *parcBuffer_WrapCString(char *string);
 
+/**
+ * Create a new `PARCBuffer` over the contents of a file mapped into memory.
+ *
+ * Unlike reading the file into an allocated buffer,
+ * nothing is read or copied until the bytes are accessed.
+ * The backing `PARCByteArray` is a read-only mapping of the file (see {@link parcByteArray_MapFile}),
+ * and the buffer is frozen (see {@link parcBuffer_Freeze}): modifying its content traps.
+ * Its hash code is computed when it is first needed, not when the file is mapped.
+ * Slices and duplicates of the buffer share the mapping,
+ * which is removed when the last of them is released.
+ *
+ * The new buffer's position is zero and its limit and capacity are the size of the file.
+ *
+ * @param [in] pathName The name of the file to map.
+ *
+ * @return NULL The file could not be opened or mapped.
+ * @return non-NULL A pointer to a `PARCBuffer` instance which must be released via {@link parcBuffer_Release()}.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCBuffer *content = parcBuffer_MapFile("content.bin");
+ *     parcBuffer_Advise(content, PARCByteArrayAdvice_Sequential);
+ *
+ *     // use content as needed
+ *
+ *     parcBuffer_Release(&content);
+ * }
+ * @endcode
+ *
+ * @see parcBuffer_Advise
+ * @see parcFileInputStream_Map
+ */
+PARCBuffer *parcBuffer_MapFile(const char *pathName);
+
+/**
+ * Advise the operating system how the remaining bytes of the given `PARCBuffer` will be accessed.
+ *
+ * This is meaningful for buffers created by {@link parcBuffer_MapFile} and their slices,
+ * and does nothing for buffers backed by allocated memory.
+ *
+ * @param [in] buffer A pointer to a valid `PARCBuffer` instance.
+ * @param [in] advice The expected access pattern of the bytes from the position to the limit.
+ *
+ * @return true The advice was accepted, or the buffer is not backed by a file mapping.
+ * @return false The operating system rejected the advice.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCBuffer *content = parcBuffer_MapFile("content.bin");
+ *     parcBuffer_Advise(content, PARCByteArrayAdvice_WillNeed);
+ *
+ *     parcBuffer_Release(&content);
+ * }
+ * @endcode
+ *
+ * @see parcByteArray_Advise
+ */
+bool parcBuffer_Advise(const PARCBuffer *buffer, PARCByteArrayAdvice advice);
+
 /**
  * Create a new instance of a `PARCBuffer` copying the given null-terminated C string as its value.
  *
@@ -383,10 +495,12 @@ PARCBuffer *parcBuffer_CreateFromArray(const void *bytes, size_t length);
  *   The hex string must be null-terminated so parsing is deterministic and correct.
  *   The hex string parameter is not modified in any way.
  *   The hex string must be an even length greater than zero.
+ *   The digits may be upper or lower case.
+ *   The new buffer's position is at the end of the parsed bytes, so it is ready to be flipped.
  *
  * @param [in] hexString The hex string to parse.
  *
- * @return NULL The string could not be parsed
+ * @return NULL The string could not be parsed: it is of odd length or contains a character that is not a hexadecimal digit
  * @return A new `PARCElasticBuffer` instance.
  *
  * Example:
@@ -666,6 +780,9 @@ PARCByteArray *parcBuffer_Array(const PARCBuffer *buffer);
  *
  * A new buffer is created as a complete copy of the original.
  *
+ * If the original buffer is frozen (see {@link parcBuffer_Freeze}) its content can never change,
+ * so the copy is a frozen duplicate sharing the same content and is made without copying any bytes.
+ *
  * @param [in] buffer A pointer to a `PARCBuffer` instance.
  *
  * @return NULL Memory could not be allocated.
@@ -695,6 +812,7 @@ PARCBuffer *parcBuffer_Copy(const PARCBuffer *buffer);
  * however the two buffers' position, limit, and mark values will be independent.
  *
  * The new buffer's capacity, limit, position, and mark values will be identical to those of the original buffer.
+ * If the original buffer is frozen, so is the new buffer.
  *
  * @param [in] original The orignal PARCBuffer instance that will be duplicated.
  *
@@ -1179,6 +1297,207 @@ uint32_t parcBuffer_GetUint32(PARCBuffer *buffer);
  */
 uint64_t parcBuffer_GetUint64(PARCBuffer *buffer);
 
+/**
+ * Read the unsigned 16-bit value in little-endian order at the buffer's current position,
+ * and then increment the position by 2.
+ *
+ * @param [in,out] buffer The pointer to the instance of `PARCBuffer` containing the value.
+ *
+ * @return The `uint16_t` at the buffer's current position.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCBuffer *buffer = parcBuffer_Allocate(10);
+ *     parcBuffer_PutUint16LE(buffer, 0x1234);
+ *     parcBuffer_Flip(buffer);
+ *     uint16_t actual = parcBuffer_GetUint16LE(buffer);
+ * }
+ * @endcode
+ *
+ * @see parcBuffer_GetUint16
+ */
+uint16_t parcBuffer_GetUint16LE(PARCBuffer *buffer);
+
+/**
+ * Read the unsigned 32-bit value in little-endian order at the buffer's current position,
+ * and then increment the position by 4.
+ *
+ * @param [in,out] buffer The pointer to the instance of `PARCBuffer` containing the value.
+ *
+ * @return The `uint32_t` at the buffer's current position.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCBuffer *buffer = parcBuffer_Allocate(10);
+ *     parcBuffer_PutUint32LE(buffer, 0x1234);
+ *     parcBuffer_Flip(buffer);
+ *     uint32_t actual = parcBuffer_GetUint32LE(buffer);
+ * }
+ * @endcode
+ *
+ * @see parcBuffer_GetUint32
+ */
+uint32_t parcBuffer_GetUint32LE(PARCBuffer *buffer);
+
+/**
+ * Read the unsigned 64-bit value in little-endian order at the buffer's current position,
+ * and then increment the position by 8.
+ *
+ * @param [in,out] buffer The pointer to the instance of `PARCBuffer` containing the value.
+ *
+ * @return The `uint64_t` at the buffer's current position.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCBuffer *buffer = parcBuffer_Allocate(10);
+ *     parcBuffer_PutUint64LE(buffer, 0x1234);
+ *     parcBuffer_Flip(buffer);
+ *     uint64_t actual = parcBuffer_GetUint64LE(buffer);
+ * }
+ * @endcode
+ *
+ * @see parcBuffer_GetUint64
+ */
+uint64_t parcBuffer_GetUint64LE(PARCBuffer *buffer);
+
+/**
+ * Read the unsigned 16-bit value in network order at the given absolute index.
+ *
+ * The buffer's position is unchanged.
+ *
+ * @param [in] buffer The pointer to the instance of `PARCBuffer` containing the value.
+ * @param [in] index The index, relative to the start of the buffer, of the first byte of the value.
+ *
+ * @return The `uint16_t` at `index`.
+ *
+ * @throws LongBowTrapOutOfBounds if `index + 2` exceeds the buffer's limit.
+ *
+ * Example:
+ * @code
+ * {
+ *     uint16_t packetLength = parcBuffer_GetUint16AtIndex(buffer, 2);
+ * }
+ * @endcode
+ *
+ * @see parcBuffer_GetAtIndex
+ */
+uint16_t parcBuffer_GetUint16AtIndex(const PARCBuffer *buffer, size_t index);
+
+/**
+ * Read the unsigned 32-bit value in network order at the given absolute index.
+ *
+ * The buffer's position is unchanged.
+ *
+ * @param [in] buffer The pointer to the instance of `PARCBuffer` containing the value.
+ * @param [in] index The index, relative to the start of the buffer, of the first byte of the value.
+ *
+ * @return The `uint32_t` at `index`.
+ *
+ * @throws LongBowTrapOutOfBounds if `index + 4` exceeds the buffer's limit.
+ *
+ * Example:
+ * @code
+ * {
+ *     uint32_t packetLength = parcBuffer_GetUint32AtIndex(buffer, 2);
+ * }
+ * @endcode
+ *
+ * @see parcBuffer_GetAtIndex
+ */
+uint32_t parcBuffer_GetUint32AtIndex(const PARCBuffer *buffer, size_t index);
+
+/**
+ * Read the unsigned 64-bit value in network order at the given absolute index.
+ *
+ * The buffer's position is unchanged.
+ *
+ * @param [in] buffer The pointer to the instance of `PARCBuffer` containing the value.
+ * @param [in] index The index, relative to the start of the buffer, of the first byte of the value.
+ *
+ * @return The `uint64_t` at `index`.
+ *
+ * @throws LongBowTrapOutOfBounds if `index + 8` exceeds the buffer's limit.
+ *
+ * Example:
+ * @code
+ * {
+ *     uint64_t packetLength = parcBuffer_GetUint64AtIndex(buffer, 2);
+ * }
+ * @endcode
+ *
+ * @see parcBuffer_GetAtIndex
+ */
+uint64_t parcBuffer_GetUint64AtIndex(const PARCBuffer *buffer, size_t index);
+
+/**
+ * Read `count` unsigned 16-bit values in network order into `array`,
+ * and then increment the position by `count * 2`.
+ *
+ * @param [in,out] buffer The pointer to the instance of `PARCBuffer` containing the values.
+ * @param [in] count The number of values to read.
+ * @param [out] array The array to receive the values.
+ *
+ * @return The given `PARCBuffer`.
+ *
+ * @throws LongBowTrapOutOfBounds if fewer than `count * 2` bytes remain.
+ *
+ * Example:
+ * @code
+ * {
+ *     uint16_t values[4];
+ *     parcBuffer_GetUint16Array(buffer, 4, values);
+ * }
+ * @endcode
+ */
+PARCBuffer *parcBuffer_GetUint16Array(PARCBuffer *buffer, size_t count, uint16_t array[count]);
+
+/**
+ * Read `count` unsigned 32-bit values in network order into `array`,
+ * and then increment the position by `count * 4`.
+ *
+ * @param [in,out] buffer The pointer to the instance of `PARCBuffer` containing the values.
+ * @param [in] count The number of values to read.
+ * @param [out] array The array to receive the values.
+ *
+ * @return The given `PARCBuffer`.
+ *
+ * @throws LongBowTrapOutOfBounds if fewer than `count * 4` bytes remain.
+ *
+ * Example:
+ * @code
+ * {
+ *     uint32_t values[4];
+ *     parcBuffer_GetUint32Array(buffer, 4, values);
+ * }
+ * @endcode
+ */
+PARCBuffer *parcBuffer_GetUint32Array(PARCBuffer *buffer, size_t count, uint32_t array[count]);
+
+/**
+ * Read `count` unsigned 64-bit values in network order into `array`,
+ * and then increment the position by `count * 8`.
+ *
+ * @param [in,out] buffer The pointer to the instance of `PARCBuffer` containing the values.
+ * @param [in] count The number of values to read.
+ * @param [out] array The array to receive the values.
+ *
+ * @return The given `PARCBuffer`.
+ *
+ * @throws LongBowTrapOutOfBounds if fewer than `count * 8` bytes remain.
+ *
+ * Example:
+ * @code
+ * {
+ *     uint64_t values[4];
+ *     parcBuffer_GetUint64Array(buffer, 4, values);
+ * }
+ * @endcode
+ */
+PARCBuffer *parcBuffer_GetUint64Array(PARCBuffer *buffer, size_t count, uint64_t array[count]);
+
 /**
  * Read an array of length bytes from the given PARCBuffer, copying them to an array.
  *
@@ -1289,6 +1608,286 @@ PARCBuffer *parcBuffer_PutUint32(PARCBuffer *buffer, uint32_t value);
  */
 PARCBuffer *parcBuffer_PutUint64(PARCBuffer *buffer, uint64_t value);
 
+/**
+ * Insert an unsigned 16-bit value into the given `PARCBuffer` at the current position,
+ * in little-endian order.
+ *
+ * Advance the current position by 2.
+ *
+ * @param [in,out] buffer A pointer to the `PARCBuffer` instance.
+ * @param [in] value The value to be inserted
+ * @return The `PARCBuffer`
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCBuffer *buffer = parcBuffer_Allocate(10);
+ *     parcBuffer_PutUint16LE(buffer, 0x1234);
+ * }
+ * @endcode
+ */
+PARCBuffer *parcBuffer_PutUint16LE(PARCBuffer *buffer, uint16_t value);
+
+/**
+ * Insert an unsigned 32-bit value into the given `PARCBuffer` at the current position,
+ * in little-endian order.
+ *
+ * Advance the current position by 4.
+ *
+ * @param [in,out] buffer A pointer to the `PARCBuffer` instance.
+ * @param [in] value The value to be inserted
+ * @return The `PARCBuffer`
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCBuffer *buffer = parcBuffer_Allocate(10);
+ *     parcBuffer_PutUint32LE(buffer, 0x1234);
+ * }
+ * @endcode
+ */
+PARCBuffer *parcBuffer_PutUint32LE(PARCBuffer *buffer, uint32_t value);
+
+/**
+ * Insert an unsigned 64-bit value into the given `PARCBuffer` at the current position,
+ * in little-endian order.
+ *
+ * Advance the current position by 8.
+ *
+ * @param [in,out] buffer A pointer to the `PARCBuffer` instance.
+ * @param [in] value The value to be inserted
+ * @return The `PARCBuffer`
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCBuffer *buffer = parcBuffer_Allocate(10);
+ *     parcBuffer_PutUint64LE(buffer, 0x1234);
+ * }
+ * @endcode
+ */
+PARCBuffer *parcBuffer_PutUint64LE(PARCBuffer *buffer, uint64_t value);
+
+/**
+ * Insert `count` unsigned 16-bit values into the given `PARCBuffer` at the current position,
+ * in big-endian, network-byte-order.
+ *
+ * Advance the current position by `count * 2`.
+ *
+ * @param [in,out] buffer A pointer to the `PARCBuffer` instance.
+ * @param [in] count The number of values to insert.
+ * @param [in] array The values to be inserted.
+ * @return The `PARCBuffer`
+ *
+ * Example:
+ * @code
+ * {
+ *     uint16_t values[] = { 1, 2, 3, 4 };
+ *     parcBuffer_PutUint16Array(buffer, 4, values);
+ * }
+ * @endcode
+ */
+PARCBuffer *parcBuffer_PutUint16Array(PARCBuffer *buffer, size_t count, const uint16_t array[count]);
+
+/**
+ * Insert `count` unsigned 32-bit values into the given `PARCBuffer` at the current position,
+ * in big-endian, network-byte-order.
+ *
+ * Advance the current position by `count * 4`.
+ *
+ * @param [in,out] buffer A pointer to the `PARCBuffer` instance.
+ * @param [in] count The number of values to insert.
+ * @param [in] array The values to be inserted.
+ * @return The `PARCBuffer`
+ *
+ * Example:
+ * @code
+ * {
+ *     uint32_t values[] = { 1, 2, 3, 4 };
+ *     parcBuffer_PutUint32Array(buffer, 4, values);
+ * }
+ * @endcode
+ */
+PARCBuffer *parcBuffer_PutUint32Array(PARCBuffer *buffer, size_t count, const uint32_t array[count]);
+
+/**
+ * Insert `count` unsigned 64-bit values into the given `PARCBuffer` at the current position,
+ * in big-endian, network-byte-order.
+ *
+ * Advance the current position by `count * 8`.
+ *
+ * @param [in,out] buffer A pointer to the `PARCBuffer` instance.
+ * @param [in] count The number of values to insert.
+ * @param [in] array The values to be inserted.
+ * @return The `PARCBuffer`
+ *
+ * Example:
+ * @code
+ * {
+ *     uint64_t values[] = { 1, 2, 3, 4 };
+ *     parcBuffer_PutUint64Array(buffer, 4, values);
+ * }
+ * @endcode
+ */
+PARCBuffer *parcBuffer_PutUint64Array(PARCBuffer *buffer, size_t count, const uint64_t array[count]);
+
+/**
+ * Return the minimal number of bytes needed to encode `value` as a big-endian variable length integer.
+ *
+ * This is the number of significant bytes of `value`, between 1 and 8.
+ *
+ * @param [in] value The value to be encoded.
+ *
+ * @return The number of bytes {@link parcBuffer_PutVarint} will write for `value`.
+ *
+ * Example:
+ * @code
+ * {
+ *     size_t length = parcBuffer_VarintLength(1500); // 2
+ * }
+ * @endcode
+ */
+size_t parcBuffer_VarintLength(uint64_t value);
+
+/**
+ * Read a `length` byte big-endian unsigned integer from the given `PARCBuffer`
+ * and increment the position by `length`.
+ *
+ * This is the encoding of TLV lengths and numeric fields: the value's significant bytes in network order.
+ * Unlike `parcVarint_DecodeBuffer` no `PARCVarint` is allocated.
+ *
+ * @param [in,out] buffer The pointer to the instance of `PARCBuffer` containing the value.
+ * @param [in] length The number of bytes of the value, from 0 to 8.
+ *
+ * @return The value.
+ *
+ * @throws LongBowTrapIllegalValue if `length` is greater than 8.
+ * @throws LongBowTrapOutOfBounds if fewer than `length` bytes remain.
+ *
+ * Example:
+ * @code
+ * {
+ *     uint16_t type = parcBuffer_GetUint16(buffer);
+ *     uint16_t length = parcBuffer_GetUint16(buffer);
+ *     uint64_t value = parcBuffer_GetVarint(buffer, length);
+ * }
+ * @endcode
+ *
+ * @see parcBuffer_PutVarint
+ */
+uint64_t parcBuffer_GetVarint(PARCBuffer *buffer, size_t length);
+
+/**
+ * Write `value` into the given `PARCBuffer` at the current position as a big-endian unsigned integer
+ * of the minimal length, and advance the position by that length.
+ *
+ * @param [in,out] buffer A pointer to the `PARCBuffer` instance.
+ * @param [in] value The value to be written.
+ *
+ * @return The given `PARCBuffer`.
+ *
+ * Example:
+ * @code
+ * {
+ *     parcBuffer_PutUint16(buffer, type);
+ *     parcBuffer_PutUint16(buffer, (uint16_t) parcBuffer_VarintLength(value));
+ *     parcBuffer_PutVarint(buffer, value);
+ * }
+ * @endcode
+ *
+ * @see parcBuffer_VarintLength
+ * @see parcBuffer_GetVarint
+ */
+PARCBuffer *parcBuffer_PutVarint(PARCBuffer *buffer, uint64_t value);
+
+/**
+ * Return the number of bytes needed to encode `value` in LEB128, between 1 and 10.
+ *
+ * @param [in] value The value to be encoded.
+ *
+ * @return The number of bytes {@link parcBuffer_PutLEB128} will write for `value`.
+ *
+ * Example:
+ * @code
+ * {
+ *     size_t length = parcBuffer_LEB128Length(300); // 2
+ * }
+ * @endcode
+ */
+size_t parcBuffer_LEB128Length(uint64_t value);
+
+/**
+ * Read an unsigned LEB128 value from the given `PARCBuffer` and advance the position past it.
+ *
+ * LEB128 encodes a value as little-endian groups of 7 bits, one per byte,
+ * in which every byte but the last has its high bit set.
+ *
+ * @param [in,out] buffer The pointer to the instance of `PARCBuffer` containing the value.
+ *
+ * @return The value.
+ *
+ * @throws LongBowTrapOutOfBounds if the buffer ends before the value does.
+ * @throws LongBowTrapIllegalValue if the value is longer than 10 bytes or does not fit in 64 bits.
+ *
+ * Example:
+ * @code
+ * {
+ *     uint64_t value = parcBuffer_GetLEB128(buffer);
+ * }
+ * @endcode
+ *
+ * @see parcBuffer_PutLEB128
+ */
+uint64_t parcBuffer_GetLEB128(PARCBuffer *buffer);
+
+/**
+ * Read `count` consecutive unsigned LEB128 values from the given `PARCBuffer` into `array`,
+ * and advance the position past them.
+ *
+ * This is equivalent to, and considerably faster than, calling {@link parcBuffer_GetLEB128} `count` times:
+ * values of up to 8 bytes are decoded without a loop over their bytes,
+ * and runs of single-byte values are decoded many at a time.
+ *
+ * @param [in,out] buffer The pointer to the instance of `PARCBuffer` containing the values.
+ * @param [in] count The number of values to read.
+ * @param [out] array The array to receive the values.
+ *
+ * @return The given `PARCBuffer`.
+ *
+ * @throws LongBowTrapOutOfBounds if the buffer ends before the last value does.
+ * @throws LongBowTrapIllegalValue if a value is longer than 10 bytes or does not fit in 64 bits.
+ *
+ * Example:
+ * @code
+ * {
+ *     uint64_t values[4];
+ *     parcBuffer_GetLEB128Array(buffer, 4, values);
+ * }
+ * @endcode
+ */
+PARCBuffer *parcBuffer_GetLEB128Array(PARCBuffer *buffer, size_t count, uint64_t array[count]);
+
+/**
+ * Write `value` into the given `PARCBuffer` at the current position in unsigned LEB128,
+ * and advance the position by its length.
+ *
+ * @param [in,out] buffer A pointer to the `PARCBuffer` instance.
+ * @param [in] value The value to be written.
+ *
+ * @return The given `PARCBuffer`.
+ *
+ * Example:
+ * @code
+ * {
+ *     parcBuffer_PutLEB128(buffer, 300);
+ * }
+ * @endcode
+ *
+ * @see parcBuffer_LEB128Length
+ * @see parcBuffer_GetLEB128
+ */
+PARCBuffer *parcBuffer_PutLEB128(PARCBuffer *buffer, uint64_t value);
+
 /**
  * Insert unsigned 8-bit value to the given `PARCBuffer` at given index.
  *
@@ -1389,6 +1988,8 @@ PARCBuffer *parcBuffer_PutBuffer(PARCBuffer *buffer, const PARCBuffer *source);
  *
  * Because `PARCBuffer` hash codes are content-dependent, be careful when using them as keys in `PARCHashMap`
  * and other similar data structures unless it is known that their contents will not change.
+ * Freezing a buffer (see {@link parcBuffer_Freeze}) guarantees that, and its hash code is then computed only once
+ * for each position and limit.
  *
  * The general contract of `HashCode` is:
  *
@@ -1422,6 +2023,65 @@ PARCBuffer *parcBuffer_PutBuffer(PARCBuffer *buffer, const PARCBuffer *source);
  */
 PARCHashCode parcBuffer_HashCode(const PARCBuffer *buffer);
 
+/**
+ * Make the content of the given `PARCBuffer` immutable.
+ *
+ * After this, every function that modifies the content of the buffer
+ * (the `parcBuffer_Put` functions, `parcBuffer_Resize`, and so on) traps.
+ * The position, limit and mark may still be changed.
+ * Duplicates and slices of a frozen buffer are frozen too.
+ *
+ * In exchange, a frozen buffer caches its hash code,
+ * `parcBuffer_Equals` returns false without comparing any bytes when two frozen buffers' hash codes differ,
+ * and `parcBuffer_Copy` shares the content instead of copying it.
+ * This makes frozen buffers cheap keys for `PARCHashMap`, `PARCHashCodeTable` and `PARCTreeRedBlack`.
+ *
+ * Writing through a pointer from `parcBuffer_Overlay` or the backing `PARCByteArray` is not detected and must not be done.
+ * Other buffers that already share the content (made with `parcBuffer_Duplicate` or `parcBuffer_Slice`
+ * before the freeze) are not frozen by this call.
+ *
+ * @param [in,out] buffer A pointer to a valid `PARCBuffer` instance.
+ *
+ * @return The given `PARCBuffer`.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCBuffer *key = parcBuffer_Freeze(parcBuffer_AllocateCString("name"));
+ *
+ *     parcHashMap_Put(map, key, value);
+ *
+ *     parcBuffer_Release(&key);
+ * }
+ * @endcode
+ *
+ * @see parcBuffer_IsFrozen
+ */
+PARCBuffer *parcBuffer_Freeze(PARCBuffer *buffer);
+
+/**
+ * Determine if the content of the given `PARCBuffer` is immutable.
+ *
+ * @param [in] buffer A pointer to a valid `PARCBuffer` instance.
+ *
+ * @return true The buffer is frozen.
+ * @return false The content of the buffer may be modified.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCBuffer *buffer = parcBuffer_Freeze(parcBuffer_Allocate(10));
+ *
+ *     assertTrue(parcBuffer_IsFrozen(buffer), "Expected a frozen buffer");
+ *
+ *     parcBuffer_Release(&buffer);
+ * }
+ * @endcode
+ *
+ * @see parcBuffer_Freeze
+ */
+bool parcBuffer_IsFrozen(const PARCBuffer *buffer);
+
 /**
  * Return the position of the first `uint8_t` value that matches the given byte.
  *
@@ -1450,6 +2110,58 @@ PARCHashCode parcBuffer_HashCode(const PARCBuffer *buffer);
  */
 size_t parcBuffer_FindUint8(const PARCBuffer *buffer, uint8_t byte);
 
+/**
+ * Return the index of the first byte, between the current position and the limit, equal to `byte`.
+ *
+ * The buffer's position is unchanged.
+ *
+ * @param [in] buffer A pointer to a `PARCBuffer` instance.
+ * @param [in] byte The byte to search for within the buffer.
+ *
+ * @return The index of the first byte equal to `byte`, or `SIZE_MAX` (<stdint.h>) if there is none.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCBuffer *buffer = parcBuffer_WrapCString("name=value");
+ *
+ *     size_t equals = parcBuffer_FindByte(buffer, '=');
+ *
+ *     // equals is 4.
+ * }
+ * @endcode
+ *
+ * @see parcBuffer_FindAny
+ */
+size_t parcBuffer_FindByte(const PARCBuffer *buffer, uint8_t byte);
+
+/**
+ * Return the index of the first byte, between the current position and the limit, that is any of the given bytes.
+ *
+ * The buffer's position is unchanged.
+ * Small sets of bytes are searched 16 or 32 bytes at a time where SSE2 or AVX2 is available.
+ *
+ * @param [in] buffer A pointer to a `PARCBuffer` instance.
+ * @param [in] length The number of bytes in @p bytes.
+ * @param [in] bytes The bytes to search for.
+ *
+ * @return The index of the first byte in @p bytes, or `SIZE_MAX` (<stdint.h>) if there is none.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCBuffer *buffer = parcBuffer_WrapCString("{\"name\":1}");
+ *
+ *     size_t delimiter = parcBuffer_FindAny(buffer, 3, (uint8_t *) ",:}");
+ *
+ *     // delimiter is 7.
+ * }
+ * @endcode
+ *
+ * @see parcBuffer_SkipTo
+ */
+size_t parcBuffer_FindAny(const PARCBuffer *buffer, size_t length, const uint8_t bytes[length]);
+
 /**
  * Produce a null-terminated string representation of the specified `PARCBuffer`
  * from the current position to the limit.
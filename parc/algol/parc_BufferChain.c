@@ -0,0 +1,382 @@
+/*
+ * Copyright (c) 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Patent rights are not granted under this agreement. Patent rights are
+ *       available under FRAND terms.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX or PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * @copyright 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC).  All rights reserved.
+ */
+#include <config.h>
+
+#include <string.h>
+
+#include <LongBow/runtime.h>
+
+#include <parc/algol/parc_BufferChain.h>
+#include <parc/algol/parc_Memory.h>
+#include <parc/algol/parc_DisplayIndented.h>
+
+#define _PARCBufferChain_InitialCapacity 4
+
+struct PARCBufferChain {
+    // The segments are segments[start] to segments[start + count - 1],
+    // leaving room at the front of the array for prepends.
+    PARCBuffer **segments;
+    size_t start;
+    size_t count;
+    size_t capacity;
+    size_t length;
+};
+
+static void
+_parcBufferChain_Finalize(PARCBufferChain **instancePtr)
+{
+    PARCBufferChain *chain = *instancePtr;
+
+    for (size_t i = 0; i < chain->count; i++) {
+        parcBuffer_Release(&chain->segments[chain->start + i]);
+    }
+    if (chain->segments != NULL) {
+        parcMemory_Deallocate(&chain->segments);
+    }
+}
+
+parcObject_ImplementAcquire(parcBufferChain, PARCBufferChain);
+
+parcObject_ImplementRelease(parcBufferChain, PARCBufferChain);
+
+parcObject_ExtendPARCObject(PARCBufferChain, _parcBufferChain_Finalize, NULL, NULL, parcBufferChain_Equals, NULL, NULL, NULL);
+
+/*
+ * Ensure there is room for one more segment at the front (if `atFront`) or the back of the segment array,
+ * re-centring the segments when the array is reallocated.
+ */
+static void
+_parcBufferChain_EnsureRoom(PARCBufferChain *chain, bool atFront)
+{
+    bool hasRoom = atFront ? (chain->start > 0) : (chain->start + chain->count < chain->capacity);
+
+    if (!hasRoom) {
+        size_t capacity = (chain->count + 1) * 2;
+        if (capacity < _PARCBufferChain_InitialCapacity) {
+            capacity = _PARCBufferChain_InitialCapacity;
+        }
+        PARCBuffer **segments = parcMemory_Allocate(capacity * sizeof(PARCBuffer *));
+        assertNotNull(segments, "parcMemory_Allocate(%zu) returned NULL", capacity * sizeof(PARCBuffer *));
+
+        size_t start = (capacity - chain->count) / 2;
+        if (chain->count > 0) {
+            memcpy(&segments[start], &chain->segments[chain->start], chain->count * sizeof(PARCBuffer *));
+        }
+        if (chain->segments != NULL) {
+            parcMemory_Deallocate(&chain->segments);
+        }
+        chain->segments = segments;
+        chain->start = start;
+        chain->capacity = capacity;
+    }
+}
+
+static void
+_parcBufferChain_AddSegment(PARCBufferChain *chain, PARCBuffer *segment, bool atFront)
+{
+    _parcBufferChain_EnsureRoom(chain, atFront);
+
+    if (atFront) {
+        chain->start--;
+        chain->segments[chain->start] = segment;
+    } else {
+        chain->segments[chain->start + chain->count] = segment;
+    }
+    chain->count++;
+    chain->length += parcBuffer_Remaining(segment);
+}
+
+void
+parcBufferChain_AssertValid(const PARCBufferChain *instance)
+{
+    assertTrue(parcBufferChain_IsValid(instance),
+               "PARCBufferChain is not valid.");
+}
+
+bool
+parcBufferChain_IsValid(const PARCBufferChain *instance)
+{
+    bool result = false;
+
+    if (instance != NULL) {
+        result = (instance->start + instance->count <= instance->capacity);
+    }
+
+    return result;
+}
+
+PARCBufferChain *
+parcBufferChain_Create(void)
+{
+    PARCBufferChain *result = parcObject_CreateInstance(PARCBufferChain);
+    if (result != NULL) {
+        result->segments = NULL;
+        result->start = 0;
+        result->count = 0;
+        result->capacity = 0;
+        result->length = 0;
+    }
+    return result;
+}
+
+PARCBufferChain *
+parcBufferChain_Append(PARCBufferChain *chain, const PARCBuffer *buffer)
+{
+    parcBufferChain_OptionalAssertValid(chain);
+    parcBuffer_OptionalAssertValid(buffer);
+
+    if (parcBuffer_HasRemaining(buffer)) {
+        _parcBufferChain_AddSegment(chain, parcBuffer_Slice(buffer), false);
+    }
+    return chain;
+}
+
+PARCBufferChain *
+parcBufferChain_Prepend(PARCBufferChain *chain, const PARCBuffer *buffer)
+{
+    parcBufferChain_OptionalAssertValid(chain);
+    parcBuffer_OptionalAssertValid(buffer);
+
+    if (parcBuffer_HasRemaining(buffer)) {
+        _parcBufferChain_AddSegment(chain, parcBuffer_Slice(buffer), true);
+    }
+    return chain;
+}
+
+PARCBufferChain *
+parcBufferChain_AppendChain(PARCBufferChain *chain, const PARCBufferChain *other)
+{
+    parcBufferChain_OptionalAssertValid(chain);
+    parcBufferChain_OptionalAssertValid(other);
+
+    // Take a snapshot of the count so that appending a chain to itself terminates.
+    size_t count = other->count;
+    for (size_t i = 0; i < count; i++) {
+        _parcBufferChain_AddSegment(chain, parcBuffer_Slice(other->segments[other->start + i]), false);
+    }
+    return chain;
+}
+
+size_t
+parcBufferChain_Length(const PARCBufferChain *chain)
+{
+    parcBufferChain_OptionalAssertValid(chain);
+
+    return chain->length;
+}
+
+size_t
+parcBufferChain_GetSegmentCount(const PARCBufferChain *chain)
+{
+    parcBufferChain_OptionalAssertValid(chain);
+
+    return chain->count;
+}
+
+PARCBuffer *
+parcBufferChain_GetSegment(const PARCBufferChain *chain, size_t index)
+{
+    parcBufferChain_OptionalAssertValid(chain);
+    trapOutOfBoundsIf(index >= chain->count, "Index %zu exceeds the segment count %zu", index, chain->count);
+
+    return chain->segments[chain->start + index];
+}
+
+PARCBufferChain *
+parcBufferChain_Slice(const PARCBufferChain *chain, size_t offset, size_t length)
+{
+    parcBufferChain_OptionalAssertValid(chain);
+    trapOutOfBoundsIf(offset > chain->length || length > chain->length - offset,
+                      "Slice [%zu, %zu) exceeds the chain length %zu", offset, offset + length, chain->length);
+
+    PARCBufferChain *result = parcBufferChain_Create();
+
+    for (size_t i = 0; i < chain->count && length > 0; i++) {
+        PARCBuffer *segment = chain->segments[chain->start + i];
+        size_t remaining = parcBuffer_Remaining(segment);
+
+        if (offset >= remaining) {
+            offset -= remaining;
+        } else {
+            size_t take = remaining - offset;
+            if (take > length) {
+                take = length;
+            }
+            PARCBuffer *slice = parcBuffer_Slice(segment);
+            parcBuffer_SetPosition(slice, offset);
+            parcBuffer_SetLimit(slice, offset + take);
+            _parcBufferChain_AddSegment(result, slice, false);
+
+            offset = 0;
+            length -= take;
+        }
+    }
+
+    return result;
+}
+
+PARCBufferChain *
+parcBufferChain_Consume(PARCBufferChain *chain, size_t length)
+{
+    parcBufferChain_OptionalAssertValid(chain);
+    trapOutOfBoundsIf(length > chain->length, "Cannot consume %zu bytes of a chain of length %zu", length, chain->length);
+
+    chain->length -= length;
+
+    while (length > 0) {
+        PARCBuffer *segment = chain->segments[chain->start];
+        size_t remaining = parcBuffer_Remaining(segment);
+
+        if (length >= remaining) {
+            parcBuffer_Release(&chain->segments[chain->start]);
+            chain->start++;
+            chain->count--;
+            length -= remaining;
+        } else {
+            parcBuffer_SetPosition(segment, parcBuffer_Position(segment) + length);
+            length = 0;
+        }
+    }
+
+    return chain;
+}
+
+size_t
+parcBufferChain_GetIOVec(const PARCBufferChain *chain, size_t count, struct iovec iov[count])
+{
+    parcBufferChain_OptionalAssertValid(chain);
+
+    size_t result = (chain->count < count) ? chain->count : count;
+
+    for (size_t i = 0; i < result; i++) {
+        PARCBuffer *segment = chain->segments[chain->start + i];
+        iov[i].iov_base = parcBuffer_Overlay(segment, 0);
+        iov[i].iov_len = parcBuffer_Remaining(segment);
+    }
+
+    return result;
+}
+
+PARCBuffer *
+parcBufferChain_ToBuffer(const PARCBufferChain *chain)
+{
+    parcBufferChain_OptionalAssertValid(chain);
+
+    PARCBuffer *result = parcBuffer_Allocate(chain->length);
+    for (size_t i = 0; i < chain->count; i++) {
+        parcBuffer_PutBuffer(result, chain->segments[chain->start + i]);
+    }
+    return parcBuffer_Flip(result);
+}
+
+bool
+parcBufferChain_Equals(const PARCBufferChain *x, const PARCBufferChain *y)
+{
+    if (x == y) {
+        return true;
+    }
+    if (x == NULL || y == NULL) {
+        return false;
+    }
+    if (x->length != y->length) {
+        return false;
+    }
+
+    // Walk both chains in step, comparing the overlapping parts of their current segments.
+    size_t xIndex = 0, xOffset = 0;
+    size_t yIndex = 0, yOffset = 0;
+    size_t remaining = x->length;
+
+    while (remaining > 0) {
+        PARCBuffer *xSegment = x->segments[x->start + xIndex];
+        PARCBuffer *ySegment = y->segments[y->start + yIndex];
+        size_t xAvailable = parcBuffer_Remaining(xSegment) - xOffset;
+        size_t yAvailable = parcBuffer_Remaining(ySegment) - yOffset;
+        size_t length = (xAvailable < yAvailable) ? xAvailable : yAvailable;
+
+        const uint8_t *xBytes = parcBuffer_Overlay(xSegment, 0);
+        const uint8_t *yBytes = parcBuffer_Overlay(ySegment, 0);
+        if (memcmp(xBytes + xOffset, yBytes + yOffset, length) != 0) {
+            return false;
+        }
+
+        remaining -= length;
+        xOffset += length;
+        yOffset += length;
+        if (xOffset == parcBuffer_Remaining(xSegment)) {
+            xIndex++;
+            xOffset = 0;
+        }
+        if (yOffset == parcBuffer_Remaining(ySegment)) {
+            yIndex++;
+            yOffset = 0;
+        }
+    }
+
+    return true;
+}
+
+PARCCursor
+parcBufferChain_Cursor(const PARCBufferChain *chain)
+{
+    parcBufferChain_OptionalAssertValid(chain);
+
+    PARCCursor result = { .collection = chain, .position = NULL, .index = 0 };
+    return result;
+}
+
+bool
+parcBufferChain_CursorHasNext(const PARCCursor *cursor)
+{
+    const PARCBufferChain *chain = cursor->collection;
+    return cursor->index < chain->count;
+}
+
+PARCBuffer *
+parcBufferChain_CursorNext(PARCCursor *cursor)
+{
+    const PARCBufferChain *chain = cursor->collection;
+    trapOutOfBoundsIf(cursor->index >= chain->count, "No more segments.");
+
+    PARCBuffer *result = chain->segments[chain->start + cursor->index];
+    cursor->index++;
+    return result;
+}
+
+void
+parcBufferChain_Display(const PARCBufferChain *instance, int indentation)
+{
+    parcDisplayIndented_PrintLine(indentation, "PARCBufferChain@%p {", instance);
+    parcDisplayIndented_PrintLine(indentation + 1, ".length=%zu, .segments=%zu", instance->length, instance->count);
+    for (size_t i = 0; i < instance->count; i++) {
+        parcBuffer_Display(instance->segments[instance->start + i], indentation + 1);
+    }
+    parcDisplayIndented_PrintLine(indentation, "}");
+}
@@ -0,0 +1,376 @@
+/*
+ * Copyright (c) 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Patent rights are not granted under this agreement. Patent rights are
+ *       available under FRAND terms.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX or PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * @file parc_BufferChain.h
+ * @ingroup memory
+ * @brief An ordered list of `PARCBuffer` segments that together form one logical sequence of bytes.
+ *
+ * A `PARCBufferChain` composes a message from existing buffers without copying them:
+ * appending or prepending a `PARCBuffer` adds a slice of its remaining bytes that shares the
+ * buffer's underlying `PARCByteArray`.
+ * The chain may be sliced, iterated segment by segment, and written to a file descriptor
+ * with a single `writev(2)` via {@link parcBufferChain_GetIOVec}, `parcFileOutputStream_WriteBufferChain`,
+ * `parcOutputStream_WriteBufferChain` or `parcEventQueue_WriteBufferChain`.
+ *
+ * Because segments share storage with the buffers they were made from,
+ * modifying the content of those buffers modifies the content of the chain.
+ * Positions and limits are independent.
+ *
+ * A `PARCBufferChain` is not thread-safe.
+ *
+ * @copyright 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC).  All rights reserved.
+ */
+#ifndef libparc_parc_BufferChain_h
+#define libparc_parc_BufferChain_h
+
+#include <stdbool.h>
+#include <sys/uio.h>
+
+#include <parc/algol/parc_Buffer.h>
+#include <parc/algol/parc_Iterator.h>
+
+struct PARCBufferChain;
+typedef struct PARCBufferChain PARCBufferChain;
+
+#ifdef PARCLibrary_DISABLE_VALIDATION
+#  define parcBufferChain_OptionalAssertValid(_instance_)
+#else
+#  define parcBufferChain_OptionalAssertValid(_instance_) parcBufferChain_AssertValid(_instance_)
+#endif
+
+/**
+ * Create an empty `PARCBufferChain`.
+ *
+ * @return non-NULL A pointer to a valid `PARCBufferChain` instance.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCBufferChain *chain = parcBufferChain_Create();
+ *
+ *     parcBufferChain_Release(&chain);
+ * }
+ * @endcode
+ */
+PARCBufferChain *parcBufferChain_Create(void);
+
+/**
+ * Increase the number of references to a `PARCBufferChain` instance.
+ *
+ * @param [in] instance A pointer to a valid `PARCBufferChain` instance.
+ *
+ * @return The same value as @p instance.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCBufferChain *a = parcBufferChain_Create();
+ *
+ *     PARCBufferChain *b = parcBufferChain_Acquire(a);
+ *
+ *     parcBufferChain_Release(&a);
+ *     parcBufferChain_Release(&b);
+ * }
+ * @endcode
+ */
+PARCBufferChain *parcBufferChain_Acquire(const PARCBufferChain *instance);
+
+/**
+ * Release a previously acquired reference to the given `PARCBufferChain` instance,
+ * decrementing the reference count for the instance.
+ *
+ * The pointer to the instance is set to NULL as a side-effect of this function.
+ *
+ * If the invocation causes the last reference to the instance to be released,
+ * the instance is deallocated and its references to its segments are released.
+ *
+ * @param [in,out] instancePtr A pointer to a pointer to the instance to release.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCBufferChain *chain = parcBufferChain_Create();
+ *
+ *     parcBufferChain_Release(&chain);
+ * }
+ * @endcode
+ */
+void parcBufferChain_Release(PARCBufferChain **instancePtr);
+
+/**
+ * Determine if an instance of `PARCBufferChain` is valid.
+ *
+ * @param [in] instance A pointer to a `PARCBufferChain` instance.
+ *
+ * @return true The instance is valid.
+ * @return false The instance is not valid.
+ */
+bool parcBufferChain_IsValid(const PARCBufferChain *instance);
+
+/**
+ * Assert that the given `PARCBufferChain` instance is valid.
+ *
+ * @param [in] instance A pointer to a valid `PARCBufferChain` instance.
+ */
+void parcBufferChain_AssertValid(const PARCBufferChain *instance);
+
+/**
+ * Append the remaining bytes of the given `PARCBuffer` to the end of the chain, without copying them.
+ *
+ * The chain holds a slice of @p buffer, so subsequent changes to the position or limit of @p buffer
+ * do not affect the chain. A buffer with no remaining bytes is ignored.
+ *
+ * @param [in,out] chain A pointer to a valid `PARCBufferChain` instance.
+ * @param [in] buffer A pointer to a valid `PARCBuffer` instance.
+ *
+ * @return The given `PARCBufferChain`.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCBufferChain *chain = parcBufferChain_Create();
+ *     parcBufferChain_Append(chain, header);
+ *     parcBufferChain_Append(chain, payload);
+ *     parcBufferChain_Append(chain, signature);
+ * }
+ * @endcode
+ */
+PARCBufferChain *parcBufferChain_Append(PARCBufferChain *chain, const PARCBuffer *buffer);
+
+/**
+ * Insert the remaining bytes of the given `PARCBuffer` at the start of the chain, without copying them.
+ *
+ * @param [in,out] chain A pointer to a valid `PARCBufferChain` instance.
+ * @param [in] buffer A pointer to a valid `PARCBuffer` instance.
+ *
+ * @return The given `PARCBufferChain`.
+ *
+ * Example:
+ * @code
+ * {
+ *     parcBufferChain_Prepend(chain, fixedHeader);
+ * }
+ * @endcode
+ */
+PARCBufferChain *parcBufferChain_Prepend(PARCBufferChain *chain, const PARCBuffer *buffer);
+
+/**
+ * Append every segment of @p other to the end of @p chain, without copying the bytes.
+ *
+ * @param [in,out] chain A pointer to a valid `PARCBufferChain` instance.
+ * @param [in] other A pointer to a valid `PARCBufferChain` instance.
+ *
+ * @return The given `PARCBufferChain`.
+ */
+PARCBufferChain *parcBufferChain_AppendChain(PARCBufferChain *chain, const PARCBufferChain *other);
+
+/**
+ * Get the total number of bytes in the chain.
+ *
+ * @param [in] chain A pointer to a valid `PARCBufferChain` instance.
+ *
+ * @return The sum of the remaining bytes of every segment.
+ */
+size_t parcBufferChain_Length(const PARCBufferChain *chain);
+
+/**
+ * Get the number of segments in the chain.
+ *
+ * @param [in] chain A pointer to a valid `PARCBufferChain` instance.
+ *
+ * @return The number of segments.
+ */
+size_t parcBufferChain_GetSegmentCount(const PARCBufferChain *chain);
+
+/**
+ * Get the segment at the given index.
+ *
+ * The result is owned by the chain and must not be released by the caller,
+ * nor have its position or limit modified.
+ *
+ * @param [in] chain A pointer to a valid `PARCBufferChain` instance.
+ * @param [in] index The index of the segment.
+ *
+ * @return The segment at @p index.
+ *
+ * @throws LongBowTrapOutOfBounds if @p index is not less than the number of segments.
+ */
+PARCBuffer *parcBufferChain_GetSegment(const PARCBufferChain *chain, size_t index);
+
+/**
+ * Create a new chain containing @p length bytes of the given chain, starting at byte @p offset.
+ *
+ * The bytes are not copied: the segments of the result are slices of the segments of @p chain.
+ *
+ * @param [in] chain A pointer to a valid `PARCBufferChain` instance.
+ * @param [in] offset The offset of the first byte of the result.
+ * @param [in] length The number of bytes in the result.
+ *
+ * @return A new `PARCBufferChain` that must be released via {@link parcBufferChain_Release}.
+ *
+ * @throws LongBowTrapOutOfBounds if `offset + length` exceeds the length of the chain.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCBufferChain *payload = parcBufferChain_Slice(message, headerLength, payloadLength);
+ * }
+ * @endcode
+ */
+PARCBufferChain *parcBufferChain_Slice(const PARCBufferChain *chain, size_t offset, size_t length);
+
+/**
+ * Discard the first @p length bytes of the chain.
+ *
+ * Segments that are wholly consumed are removed, and the position of a partially consumed segment is advanced.
+ * This is typically used after a partial `writev(2)`.
+ *
+ * @param [in,out] chain A pointer to a valid `PARCBufferChain` instance.
+ * @param [in] length The number of bytes to discard.
+ *
+ * @return The given `PARCBufferChain`.
+ *
+ * @throws LongBowTrapOutOfBounds if @p length exceeds the length of the chain.
+ */
+PARCBufferChain *parcBufferChain_Consume(PARCBufferChain *chain, size_t length);
+
+/**
+ * Fill an array of `struct iovec` describing the segments of the chain, for use with `writev(2)`.
+ *
+ * @param [in] chain A pointer to a valid `PARCBufferChain` instance.
+ * @param [in] count The number of elements in @p iov.
+ * @param [out] iov The array to fill.
+ *
+ * @return The number of elements of @p iov filled, which is the lesser of @p count and the number of segments.
+ *
+ * Example:
+ * @code
+ * {
+ *     struct iovec iov[16];
+ *     int iovcnt = (int) parcBufferChain_GetIOVec(chain, 16, iov);
+ *     ssize_t written = writev(fd, iov, iovcnt);
+ * }
+ * @endcode
+ */
+size_t parcBufferChain_GetIOVec(const PARCBufferChain *chain, size_t count, struct iovec iov[count]);
+
+/**
+ * Copy the bytes of the chain into a single new contiguous `PARCBuffer`.
+ *
+ * @param [in] chain A pointer to a valid `PARCBufferChain` instance.
+ *
+ * @return A new `PARCBuffer`, positioned at 0 with its limit at the length of the chain,
+ *         that must be released via {@link parcBuffer_Release}.
+ */
+PARCBuffer *parcBufferChain_ToBuffer(const PARCBufferChain *chain);
+
+/**
+ * Determine if two `PARCBufferChain` instances contain the same sequence of bytes,
+ * regardless of how the bytes are divided into segments.
+ *
+ * @param [in] x A pointer to a `PARCBufferChain` instance.
+ * @param [in] y A pointer to a `PARCBufferChain` instance.
+ *
+ * @return true The chains contain the same bytes, or are both NULL.
+ * @return false The chains differ.
+ */
+bool parcBufferChain_Equals(const PARCBufferChain *x, const PARCBufferChain *y);
+
+/**
+ * Create a `PARCCursor` positioned before the first segment of the given chain.
+ *
+ * The chain must not be modified while the cursor is in use.
+ *
+ * @param [in] chain A pointer to a valid `PARCBufferChain`.
+ *
+ * @return A `PARCCursor` for use with {@link parcBufferChain_CursorHasNext} and {@link parcBufferChain_CursorNext}.
+ *
+ * Example:
+ * @code
+ * {
+ *    PARCCursor cursor = parcBufferChain_Cursor(chain);
+ *
+ *    while (parcBufferChain_CursorHasNext(&cursor)) {
+ *        PARCBuffer *segment = parcBufferChain_CursorNext(&cursor);
+ *    }
+ * }
+ * @endcode
+ */
+PARCCursor parcBufferChain_Cursor(const PARCBufferChain *chain);
+
+/**
+ * Return true if a call to {@link parcBufferChain_CursorNext} would return a segment.
+ *
+ * @param [in] cursor A pointer to a `PARCCursor` initialised by {@link parcBufferChain_Cursor}.
+ *
+ * @return true There are more segments.
+ * @return false There are no more segments.
+ */
+bool parcBufferChain_CursorHasNext(const PARCCursor *cursor);
+
+/**
+ * Advance the cursor and return the next segment of the chain.
+ *
+ * The result is owned by the chain.
+ *
+ * @param [in,out] cursor A pointer to a `PARCCursor` initialised by {@link parcBufferChain_Cursor}.
+ *
+ * @return The next segment.
+ *
+ * @throws LongBowTrapOutOfBounds if there are no more segments.
+ */
+PARCBuffer *parcBufferChain_CursorNext(PARCCursor *cursor);
+
+/**
+ * Execute the following statement once for each segment of the given `PARCBufferChain`,
+ * assigning each segment in turn to the variable @p _segment_.
+ *
+ * @param [in] _chain_ A pointer to a valid `PARCBufferChain`.
+ * @param [out] _segment_ A `PARCBuffer *` lvalue that is assigned each segment in turn.
+ *
+ * Example:
+ * @code
+ * {
+ *    PARCBuffer *segment;
+ *    parcBufferChain_ForEach(chain, segment) {
+ *        parcBuffer_Display(segment, 0);
+ *    }
+ * }
+ * @endcode
+ */
+#define parcBufferChain_ForEach(_chain_, _segment_) \
+    for (PARCCursor _parcCursor = parcBufferChain_Cursor(_chain_); \
+         parcBufferChain_CursorHasNext(&_parcCursor) && ((_segment_ = parcBufferChain_CursorNext(&_parcCursor)), true); )
+
+/**
+ * Print a human readable representation of the given `PARCBufferChain`.
+ *
+ * @param [in] instance A pointer to the instance to display.
+ * @param [in] indentation The level of indentation to use to pretty-print the output.
+ */
+void parcBufferChain_Display(const PARCBufferChain *instance, int indentation);
+#endif // libparc_parc_BufferChain_h
@@ -41,7 +41,7 @@
 
 #include <parc/algol/parc_BufferChunker.h>
 
-PARCChunkerInterface *PARCBufferChunkerAsBunker = &(PARCChunkerInterface) {
+PARCChunkerInterface *PARCBufferChunkerAsChunker = &(PARCChunkerInterface) {
     .ForwardIterator = (void *(*)(const void *))parcBufferChunker_ForwardIterator,
     .ReverseIterator = (void *(*)(const void *))parcBufferChunker_ReverseIterator,
     .Release = (void (*)(void **))parcBufferChunker_Release
@@ -131,7 +131,7 @@ _advanceStateForward(PARCBufferChunker *chunker, _ChunkerState *state)
 {
     state->position += state->nextChunkSize;
 
-    size_t remaining = parcBuffer_Remaining(chunker->data);
+    size_t remaining = parcBuffer_Limit(chunker->data) - state->position;
 
     if (remaining == 0) {
         state->atEnd = true;
@@ -176,9 +176,12 @@ _ccnxChunker_NextFromBuffer(PARCBufferChunker *chunker, _ChunkerState *state)
 {
     size_t chunkSize = state->nextChunkSize;
 
+    // Leave the data's position as it was, so that later iterators start from the same place.
+    size_t originalPosition = parcBuffer_Position(chunker->data);
     parcBuffer_SetPosition(chunker->data, state->position);
     PARCBuffer *slice = parcBuffer_CreateFromArray(parcBuffer_Overlay(chunker->data, chunkSize), chunkSize);
     slice = parcBuffer_Flip(slice);
+    parcBuffer_SetPosition(chunker->data, originalPosition);
 
     _advanceState(chunker, state);
 
@@ -36,15 +36,20 @@
 #include <stdlib.h>
 #include <stdarg.h>
 #include <stdio.h>
+#include <string.h>
 
 #include <parc/algol/parc_Memory.h>
 #include <parc/algol/parc_Object.h>
 #include <parc/algol/parc_BufferComposer.h>
 #include <parc/algol/parc_Buffer.h>
+#include <parc/algol/parc_BufferChain.h>
 
 struct parc_buffer_composer {
     size_t incrementHeuristic;
     PARCBuffer *buffer;
+
+    // Rope mode only: the filled (flipped) segments that precede `buffer`.
+    PARCBufferChain *rope;
 };
 
 static void
@@ -56,6 +61,9 @@ _finalize(PARCBufferComposer **bufferPtr)
         if (composer->buffer != NULL) {
             parcBuffer_Release(&composer->buffer);
         }
+        if (composer->rope != NULL) {
+            parcBufferChain_Release(&composer->rope);
+        }
     }
 }
 
@@ -64,7 +72,38 @@ parcObject_ExtendPARCObject(PARCBufferComposer, _finalize, NULL, NULL, parcBuffe
 static PARCBufferComposer *
 _create(void)
 {
-    return parcObject_CreateInstance(PARCBufferComposer);
+    PARCBufferComposer *result = parcObject_CreateInstance(PARCBufferComposer);
+    if (result != NULL) {
+        result->buffer = NULL;
+        result->rope = NULL;
+    }
+    return result;
+}
+
+/**
+ * In rope mode, retire the current segment to the rope and start a new one
+ * large enough to hold at least `required` bytes.
+ *
+ * Nothing already written is copied.
+ */
+static PARCBufferComposer *
+_nextSegment(PARCBufferComposer *composer, size_t required)
+{
+    size_t segmentSize = composer->incrementHeuristic;
+    if (segmentSize < required) {
+        segmentSize = required;
+    }
+
+    PARCBuffer *segment = parcBuffer_Allocate(segmentSize);
+    if (segment == NULL) {
+        return NULL;
+    }
+
+    parcBufferChain_Append(composer->rope, parcBuffer_Flip(composer->buffer));
+    parcBuffer_Release(&composer->buffer);
+    composer->buffer = segment;
+
+    return composer;
 }
 
 /**
@@ -74,33 +113,67 @@ _create(void)
  * of the underlying `PARCBuffer` is less than the required number of bytes,
  * the underlying PARCBuffer is expanded with sufficient space to accomodate the required number of bytes.
  *
- * The position, limit, and mark remain unchanged.
- * The capacity is increased.
+ * The capacity at least doubles on each expansion, and the backing array is reallocated in place where possible,
+ * so composing n bytes with many small writes costs O(n) copying in total.
+ * In rope mode a new segment is started instead and nothing is copied.
+ *
+ * The position and mark remain unchanged.
+ * The capacity is increased and the limit is set to the new capacity.
  */
 static PARCBufferComposer *
 _ensureRemaining(PARCBufferComposer *composer, size_t required)
 {
     parcBufferComposer_OptionalAssertValid(composer);
 
-    size_t remainingCapacity = parcBuffer_Capacity(composer->buffer) - parcBuffer_Position(composer->buffer);
+    size_t capacity = parcBuffer_Capacity(composer->buffer);
+    size_t position = parcBuffer_Position(composer->buffer);
 
-    if (remainingCapacity < required) {
-        size_t incrementAmount = required;
-        if (incrementAmount < composer->incrementHeuristic) {
-            incrementAmount = composer->incrementHeuristic;
+    if (capacity - position < required) {
+        if (composer->rope != NULL) {
+            return _nextSegment(composer, required);
         }
-        size_t newCapacity = parcBuffer_Capacity(composer->buffer) + incrementAmount;
 
-        PARCBuffer *newBuffer = parcBuffer_Allocate(newCapacity);
-        parcBuffer_Flip(composer->buffer);
-        parcBuffer_PutBuffer(newBuffer, composer->buffer);
-        parcBuffer_Release(&composer->buffer);
-        composer->buffer = newBuffer;
+        size_t increment = (capacity > composer->incrementHeuristic) ? capacity : composer->incrementHeuristic;
+        size_t newCapacity = capacity + increment;
+        if (newCapacity < position + required) {
+            newCapacity = position + required;
+        }
+
+        if (parcBuffer_Resize(composer->buffer, newCapacity) == NULL) {
+            return NULL;
+        }
+        parcBuffer_SetLimit(composer->buffer, newCapacity);
     }
 
     return composer;
 }
 
+/**
+ * In rope mode, gather the rope and the current segment into a single contiguous buffer,
+ * leaving the composer as though it had been written without rope mode.
+ */
+static void
+_coalesce(PARCBufferComposer *composer)
+{
+    if (composer->rope != NULL && parcBufferChain_GetSegmentCount(composer->rope) > 0) {
+        size_t position = parcBuffer_Position(composer->buffer);
+        size_t length = parcBufferChain_Length(composer->rope) + position;
+
+        PARCBuffer *buffer = parcBuffer_Allocate(length + composer->incrementHeuristic);
+        PARCCursor cursor = parcBufferChain_Cursor(composer->rope);
+        while (parcBufferChain_CursorHasNext(&cursor)) {
+            parcBuffer_PutBuffer(buffer, parcBufferChain_CursorNext(&cursor));
+        }
+        parcBuffer_PutArray(buffer, position, parcBuffer_Overlay(parcBuffer_Rewind(composer->buffer), 0));
+
+        parcBuffer_Release(&composer->buffer);
+        composer->buffer = buffer;
+
+        parcBufferChain_Release(&composer->rope);
+        composer->rope = parcBufferChain_Create();
+    }
+}
+
 void
 parcBufferComposer_AssertValid(const PARCBufferComposer *composer)
 {
@@ -129,6 +202,19 @@ parcBufferComposer_Allocate(size_t size)
     return result;
 }
 
+PARCBufferComposer *
+parcBufferComposer_CreateRope(size_t segmentSize)
+{
+    PARCBufferComposer *result = parcBufferComposer_Allocate(segmentSize);
+    if (result != NULL) {
+        result->rope = parcBufferChain_Create();
+        if (result->rope == NULL) {
+            parcBufferComposer_Release(&result);
+        }
+    }
+    return result;
+}
+
 parcObject_ImplementAcquire(parcBufferComposer, PARCBufferComposer);
 
 parcObject_ImplementRelease(parcBufferComposer, PARCBufferComposer);
@@ -143,6 +229,9 @@ parcBufferComposer_Equals(const PARCBufferComposer *x, const PARCBufferComposer
         return false;
     }
 
+    _coalesce((PARCBufferComposer *) x);
+    _coalesce((PARCBufferComposer *) y);
+
     if (x->incrementHeuristic == y->incrementHeuristic) {
         if (parcBuffer_Equals(x->buffer, y->buffer)) {
             return true;
@@ -165,6 +254,24 @@ parcBufferComposer_PutArray(PARCBufferComposer *composer, const unsigned char *b
     return composer;
 }
 
+void *
+parcBufferComposer_Reserve(PARCBufferComposer *composer, size_t length)
+{
+    if (_ensureRemaining(composer, length) == NULL) {
+        return NULL;
+    }
+    return parcBuffer_Overlay(composer->buffer, 0);
+}
+
+PARCBufferComposer *
+parcBufferComposer_Commit(PARCBufferComposer *composer, size_t length)
+{
+    parcBufferComposer_OptionalAssertValid(composer);
+
+    parcBuffer_SetPosition(composer->buffer, parcBuffer_Position(composer->buffer) + length);
+    return composer;
+}
+
 PARCBufferComposer *
 parcBufferComposer_PutChar(PARCBufferComposer *composer, char val)
 {
@@ -229,16 +336,7 @@ parcBufferComposer_PutBuffer(PARCBufferComposer *composer, const PARCBuffer *sou
 PARCBufferComposer *
 parcBufferComposer_PutString(PARCBufferComposer *composer, const char *string)
 {
-    PARCBuffer *wrapper = parcBuffer_AllocateCString(string);
-
-    composer = _ensureRemaining(composer, parcBuffer_Remaining(wrapper));
-    if (composer != NULL) {
-        parcBuffer_PutBuffer(composer->buffer, wrapper);
-    }
-
-    parcBuffer_Release(&wrapper);
-
-    return composer;
+    return parcBufferComposer_PutArray(composer, (const unsigned char *) string, strlen(string));
 }
 
 PARCBufferComposer *
@@ -259,15 +357,31 @@ parcBufferComposer_PutStrings(PARCBufferComposer *composer, ...)
 PARCBufferComposer *
 parcBufferComposer_Format(PARCBufferComposer *composer, const char *format, ...)
 {
+    // Format directly into the remaining space, growing and formatting again only if it does not fit.
     va_list ap;
     va_start(ap, format);
-    char *cString;
-    ssize_t written = vasprintf(&cString, format, ap);
-    assertTrue(written >= 0, "Got error from vasprintf");
+    va_list retry;
+    va_copy(retry, ap);
+
+    size_t remaining = parcBuffer_Capacity(composer->buffer) - parcBuffer_Position(composer->buffer);
+    char *destination = (remaining > 0) ? (char *) parcBuffer_Overlay(composer->buffer, 0) : NULL;
+    int written = vsnprintf(destination, remaining, format, ap);
     va_end(ap);
+    assertTrue(written >= 0, "Got error from vsnprintf");
+
+    if ((size_t) written >= remaining) {
+        // vsnprintf always writes a terminating nul, so reserve room for it.
+        composer = _ensureRemaining(composer, (size_t) written + 1);
+        if (composer != NULL) {
+            destination = (char *) parcBuffer_Overlay(composer->buffer, 0);
+            vsnprintf(destination, (size_t) written + 1, format, retry);
+        }
+    }
+    va_end(retry);
 
-    parcBufferComposer_PutString(composer, cString);
-    free(cString);
+    if (composer != NULL) {
+        parcBuffer_SetPosition(composer->buffer, parcBuffer_Position(composer->buffer) + (size_t) written);
+    }
 
     return composer;
 }
@@ -275,24 +389,40 @@ parcBufferComposer_Format(PARCBufferComposer *composer, const char *format, ...)
 PARCBuffer *
 parcBufferComposer_GetBuffer(const PARCBufferComposer *composer)
 {
+    _coalesce((PARCBufferComposer *) composer);
     return composer->buffer;
 }
 
 PARCBuffer *
 parcBufferComposer_CreateBuffer(PARCBufferComposer *composer)
 {
+    _coalesce(composer);
     return parcBuffer_Duplicate(composer->buffer);
 }
 
 PARCBuffer *
 parcBufferComposer_ProduceBuffer(PARCBufferComposer *composer)
 {
+    _coalesce(composer);
     return parcBuffer_Acquire(parcBuffer_Flip(composer->buffer));
 }
 
+PARCBufferChain *
+parcBufferComposer_ProduceBufferChain(PARCBufferComposer *composer)
+{
+    PARCBufferChain *result = parcBufferChain_Create();
+    if (composer->rope != NULL) {
+        parcBufferChain_AppendChain(result, composer->rope);
+    }
+    parcBufferChain_Append(result, parcBuffer_Flip(composer->buffer));
+
+    return result;
+}
+
 char *
 parcBufferComposer_ToString(PARCBufferComposer *composer)
 {
+    _coalesce(composer);
     PARCBuffer *buffer = parcBuffer_Flip(parcBuffer_Duplicate(composer->buffer));
 
     char *result = parcBuffer_ToString(buffer);
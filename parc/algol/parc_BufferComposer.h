@@ -34,6 +34,11 @@
  * purpose buffer in that all native types may be added to the buffer. When finished, the user can finalize
  * the composer and produce a flipped `PARCBuffer` instance.
  *
+ * The composer grows geometrically, so composing a large buffer from many small writes costs
+ * time linear in its final length.
+ * A composer created in rope mode never moves what it has written: it fills a sequence of segments,
+ * which {@link parcBufferComposer_ProduceBufferChain} returns as a `PARCBufferChain` without copying.
+ *
  * @author Glenn Scott, Christopher A. Wood, Palo Alto Research Center (Xerox PARC)
  * @copyright 2013-2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC).  All rights reserved.
  */
@@ -51,6 +56,9 @@
 struct parc_buffer_composer;
 typedef struct parc_buffer_composer PARCBufferComposer;
 
+// parc_Object.h reaches this header through parc_JSON.h, before parc_BufferChain.h can be included.
+struct PARCBufferChain;
+
 /**
  * Create an empty (zero-length) `PARCBufferComposer`.
  *
@@ -91,6 +99,37 @@ PARCBufferComposer *parcBufferComposer_Create(void);
  */
 PARCBufferComposer *parcBufferComposer_Allocate(size_t length);
 
+/**
+ * Create an empty `PARCBufferComposer` in rope mode.
+ *
+ * A rope-mode composer writes into a sequence of segments of (at least) `segmentSize` bytes
+ * rather than one contiguous buffer, so it never copies what it has already written when it grows.
+ * The segments are gathered into a single `PARCBuffer` only when one is asked for,
+ * by {@link parcBufferComposer_GetBuffer}, {@link parcBufferComposer_ProduceBuffer} and the like.
+ * {@link parcBufferComposer_ProduceBufferChain} returns the segments themselves.
+ *
+ * @param [in] segmentSize The size of each segment, at least `sizeof(void *)`.
+ *
+ * @return NULL Memory could not be allocated.
+ * @return non-NULL A pointer to the new `PARCBufferComposer`.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCBufferComposer *composer = parcBufferComposer_CreateRope(4096);
+ *
+ *     parcBufferComposer_PutString(composer, "Hello, World!");
+ *     PARCBufferChain *chain = parcBufferComposer_ProduceBufferChain(composer);
+ *
+ *     parcBufferChain_Release(&chain);
+ *     parcBufferComposer_Release(&composer);
+ * }
+ * @endcode
+ *
+ * @see parcBufferComposer_ProduceBufferChain
+ */
+PARCBufferComposer *parcBufferComposer_CreateRope(size_t segmentSize);
+
 /**
  * Assert that an instance of `PARCBufferComposer` is valid.
  *
@@ -222,6 +261,55 @@ bool parcBufferComposer_Equals(const PARCBufferComposer *x, const PARCBufferComp
  */
 PARCBufferComposer *parcBufferComposer_PutArray(PARCBufferComposer *composer, const unsigned char *bytes, size_t length);
 
+/**
+ * Make room for at least `length` bytes at the end of the given `PARCBufferComposer`,
+ * and return a pointer to that space so it can be written directly.
+ *
+ * Nothing is appended until {@link parcBufferComposer_Commit} is called with the number of bytes actually written.
+ * The pointer is valid until the next call on the composer.
+ * This lets an encoder write its output in place, sized once for the worst case,
+ * instead of appending it a byte at a time.
+ *
+ * @param [in,out] composer A pointer to the PARCBufferComposer to receive the data.
+ * @param [in] length The number of bytes to make room for.
+ *
+ * @return NULL Memory could not be allocated, and the composer is unmodified.
+ * @return non-NULL A pointer to at least `length` writable bytes.
+ *
+ * Example:
+ * @code
+ * {
+ *     uint8_t *space = parcBufferComposer_Reserve(composer, 2 * length);
+ *     size_t written = encode(space, length, array);
+ *     parcBufferComposer_Commit(composer, written);
+ * }
+ * @endcode
+ *
+ * @see parcBufferComposer_Commit
+ */
+void *parcBufferComposer_Reserve(PARCBufferComposer *composer, size_t length);
+
+/**
+ * Append `length` bytes previously written into the space returned by {@link parcBufferComposer_Reserve}.
+ *
+ * @param [in,out] composer A pointer to the PARCBufferComposer.
+ * @param [in] length The number of bytes written, no more than were reserved.
+ *
+ * @return The value of the parameter @p composer.
+ *
+ * Example:
+ * @code
+ * {
+ *     uint8_t *space = parcBufferComposer_Reserve(composer, 2 * length);
+ *     size_t written = encode(space, length, array);
+ *     parcBufferComposer_Commit(composer, written);
+ * }
+ * @endcode
+ *
+ * @see parcBufferComposer_Reserve
+ */
+PARCBufferComposer *parcBufferComposer_Commit(PARCBufferComposer *composer, size_t length);
+
 /**
  * Append a single char to the given `PARCBufferComposer` at the current position.
  *
@@ -553,6 +641,39 @@ PARCBuffer *parcBufferComposer_CreateBuffer(PARCBufferComposer *composer);
  */
 PARCBuffer *parcBufferComposer_ProduceBuffer(PARCBufferComposer *composer);
 
+/**
+ * Finalize this `PARCBufferComposer` and return its contents as a {@link PARCBufferChain}.
+ *
+ * The chain references the composer's storage and nothing is copied.
+ * For a composer in rope mode the chain has one segment per filled segment,
+ * otherwise it has a single segment.
+ * As with {@link parcBufferComposer_ProduceBuffer}, no more writes should be made to this instance.
+ *
+ * The result must be freed by the caller via {@link parcBufferChain_Release}.
+ *
+ * @param [in] composer A pointer to a `PARCBufferComposer` instance.
+ *
+ * @return A pointer to a new `PARCBufferChain` holding the composed bytes.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCBufferComposer *composer = parcBufferComposer_CreateRope(4096);
+ *     parcBufferComposer_PutString(composer, "Hello, World!");
+ *
+ *     PARCBufferChain *chain = parcBufferComposer_ProduceBufferChain(composer);
+ *     parcBufferComposer_Release(&composer);
+ *
+ *     // write the chain with parcFileOutputStream_WriteBufferChain, for example
+ *
+ *     parcBufferChain_Release(&chain);
+ * }
+ * @endcode
+ *
+ * @see parcBufferComposer_CreateRope
+ */
+struct PARCBufferChain *parcBufferComposer_ProduceBufferChain(PARCBufferComposer *composer);
+
 /**
  * Produce a null-terminated string containing the characters from 0 to the current
  * position of the given `PARCBufferComposer`.
@@ -0,0 +1,567 @@
+/*
+ * Copyright (c) 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Patent rights are not granted under this agreement. Patent rights are
+ *       available under FRAND terms.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX or PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * @copyright 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC).  All rights reserved.
+ */
+#include <config.h>
+
+#include <inttypes.h>
+#include <pthread.h>
+
+#include <LongBow/runtime.h>
+
+#include <parc/algol/parc_BufferPool.h>
+#include <parc/algol/parc_Object.h>
+#include <parc/algol/parc_Memory.h>
+#include <parc/algol/parc_DisplayIndented.h>
+
+/**
+ * A thread cache holds at most this many bytes of free arrays in each size class,
+ * but never fewer than the minimum nor more than the maximum number of arrays.
+ */
+#define _PARCBufferPool_ThreadCacheBytes (256 * 1024)
+#define _PARCBufferPool_ThreadCacheMinimum 4
+#define _PARCBufferPool_ThreadCacheMaximum 64
+
+typedef struct {
+    PARCByteArray **arrays;
+    size_t count;
+    size_t capacity;
+} _PARCBufferPoolFreeList;
+
+/**
+ * A thread's cache of free arrays and its statistics.
+ *
+ * Only the owning thread modifies a cache, except when the pool is destroyed.
+ * Other threads read the statistics without synchronisation, which is why the statistics are approximate.
+ */
+typedef struct parc_buffer_pool_cache {
+    struct parc_buffer_pool_cache *previous;
+    struct parc_buffer_pool_cache *next;
+
+    PARCBufferPool *pool;
+    _PARCBufferPoolFreeList *classes;
+
+    uint64_t requests;
+    uint64_t misses;
+    uint64_t discards;
+    uint64_t gets;
+    uint64_t recycles;
+} _PARCBufferPoolCache;
+
+struct PARCBufferPool {
+    pthread_mutex_t mutex;
+    pthread_key_t key;
+
+    size_t minimumSize;
+    size_t maximumSize;
+    unsigned minimumShift;
+    size_t classCount;
+
+    // The free lists shared between threads, one per size class.
+    _PARCBufferPoolFreeList *shared;
+
+    // The caches of the threads using the pool.
+    _PARCBufferPoolCache *caches;
+
+    // The statistics of threads that have exited.
+    uint64_t requests;
+    uint64_t misses;
+    uint64_t discards;
+    uint64_t gets;
+    uint64_t recycles;
+};
+
+static unsigned
+_parcBufferPool_CeilingLog2(size_t value)
+{
+    unsigned result = 0;
+    while (((size_t) 1 << result) < value) {
+        result++;
+    }
+    return result;
+}
+
+static size_t
+_parcBufferPool_ClassSize(const PARCBufferPool *pool, size_t index)
+{
+    return pool->minimumSize << index;
+}
+
+/**
+ * The index of the smallest size class that holds the given capacity, which is at most the maximum size.
+ */
+static size_t
+_parcBufferPool_ClassIndex(const PARCBufferPool *pool, size_t capacity)
+{
+    size_t result = 0;
+    if (capacity > pool->minimumSize) {
+        result = _parcBufferPool_CeilingLog2(capacity) - pool->minimumShift;
+    }
+    return result;
+}
+
+static void
+_parcBufferPool_FreeListInit(_PARCBufferPoolFreeList *list, size_t capacity)
+{
+    list->arrays = parcMemory_Allocate(capacity * sizeof(PARCByteArray *));
+    assertNotNull(list->arrays, "parcMemory_Allocate(%zu) returned NULL", capacity * sizeof(PARCByteArray *));
+    list->count = 0;
+    list->capacity = capacity;
+}
+
+/**
+ * Release every array in the list, returning how many there were.
+ */
+static size_t
+_parcBufferPool_FreeListDrain(_PARCBufferPoolFreeList *list)
+{
+    size_t result = list->count;
+    while (list->count > 0) {
+        parcByteArray_Release(&list->arrays[--list->count]);
+    }
+    return result;
+}
+
+static void
+_parcBufferPool_FreeListFini(_PARCBufferPoolFreeList *list)
+{
+    _parcBufferPool_FreeListDrain(list);
+    parcMemory_Deallocate((void **) &list->arrays);
+}
+
+/**
+ * Move arrays from one list to another until @p source holds @p keep arrays or @p destination is full.
+ * Returns the number of arrays moved.
+ */
+static size_t
+_parcBufferPool_Transfer(_PARCBufferPoolFreeList *destination, _PARCBufferPoolFreeList *source, size_t keep)
+{
+    size_t result = 0;
+    while (source->count > keep && destination->count < destination->capacity) {
+        destination->arrays[destination->count++] = source->arrays[--source->count];
+        result++;
+    }
+    return result;
+}
+
+/**
+ * Give all of a cache's arrays to the shared free lists, releasing those that do not fit.
+ * The caller holds the mutex.
+ */
+static void
+_parcBufferPool_FlushCache(PARCBufferPool *pool, _PARCBufferPoolCache *cache)
+{
+    for (size_t i = 0; i < pool->classCount; i++) {
+        _parcBufferPool_Transfer(&pool->shared[i], &cache->classes[i], 0);
+        cache->discards += _parcBufferPool_FreeListDrain(&cache->classes[i]);
+    }
+}
+
+static void
+_parcBufferPool_DestroyCache(PARCBufferPool *pool, _PARCBufferPoolCache *cache)
+{
+    if (cache->previous != NULL) {
+        cache->previous->next = cache->next;
+    } else {
+        pool->caches = cache->next;
+    }
+    if (cache->next != NULL) {
+        cache->next->previous = cache->previous;
+    }
+
+    pool->requests += cache->requests;
+    pool->misses += cache->misses;
+    pool->discards += cache->discards;
+    pool->gets += cache->gets;
+    pool->recycles += cache->recycles;
+
+    for (size_t i = 0; i < pool->classCount; i++) {
+        _parcBufferPool_FreeListFini(&cache->classes[i]);
+    }
+    parcMemory_Deallocate((void **) &cache->classes);
+    parcMemory_Deallocate((void **) &cache);
+}
+
+/**
+ * Called when a thread that has used the pool exits: its free arrays go back to the shared free lists.
+ */
+static void
+_parcBufferPool_ThreadExit(void *value)
+{
+    _PARCBufferPoolCache *cache = value;
+    PARCBufferPool *pool = cache->pool;
+
+    pthread_mutex_lock(&pool->mutex);
+    _parcBufferPool_FlushCache(pool, cache);
+    _parcBufferPool_DestroyCache(pool, cache);
+    pthread_mutex_unlock(&pool->mutex);
+}
+
+static _PARCBufferPoolCache *
+_parcBufferPool_CreateCache(PARCBufferPool *pool)
+{
+    _PARCBufferPoolCache *result = parcMemory_AllocateAndClear(sizeof(_PARCBufferPoolCache));
+    assertNotNull(result, "parcMemory_AllocateAndClear(%zu) returned NULL", sizeof(_PARCBufferPoolCache));
+
+    result->pool = pool;
+    result->classes = parcMemory_Allocate(pool->classCount * sizeof(_PARCBufferPoolFreeList));
+    assertNotNull(result->classes, "parcMemory_Allocate(%zu) returned NULL", pool->classCount * sizeof(_PARCBufferPoolFreeList));
+
+    for (size_t i = 0; i < pool->classCount; i++) {
+        size_t capacity = _PARCBufferPool_ThreadCacheBytes / _parcBufferPool_ClassSize(pool, i);
+        if (capacity < _PARCBufferPool_ThreadCacheMinimum) {
+            capacity = _PARCBufferPool_ThreadCacheMinimum;
+        } else if (capacity > _PARCBufferPool_ThreadCacheMaximum) {
+            capacity = _PARCBufferPool_ThreadCacheMaximum;
+        }
+        _parcBufferPool_FreeListInit(&result->classes[i], capacity);
+    }
+
+    pthread_mutex_lock(&pool->mutex);
+    result->previous = NULL;
+    result->next = pool->caches;
+    if (pool->caches != NULL) {
+        pool->caches->previous = result;
+    }
+    pool->caches = result;
+    pthread_mutex_unlock(&pool->mutex);
+
+    pthread_setspecific(pool->key, result);
+
+    return result;
+}
+
+static inline _PARCBufferPoolCache *
+_parcBufferPool_GetCache(PARCBufferPool *pool)
+{
+    _PARCBufferPoolCache *result = pthread_getspecific(pool->key);
+    if (result == NULL) {
+        result = _parcBufferPool_CreateCache(pool);
+    }
+    return result;
+}
+
+static void
+_parcBufferPool_Finalize(PARCBufferPool **instancePtr)
+{
+    assertNotNull(instancePtr, "Parameter must be a non-null pointer to a PARCBufferPool pointer.");
+    PARCBufferPool *pool = *instancePtr;
+
+    // No thread exit may run the destructor for this pool from now on.
+    pthread_key_delete(pool->key);
+
+    while (pool->caches != NULL) {
+        _parcBufferPool_DestroyCache(pool, pool->caches);
+    }
+
+    for (size_t i = 0; i < pool->classCount; i++) {
+        _parcBufferPool_FreeListFini(&pool->shared[i]);
+    }
+    parcMemory_Deallocate((void **) &pool->shared);
+    pthread_mutex_destroy(&pool->mutex);
+}
+
+parcObject_ImplementAcquire(parcBufferPool, PARCBufferPool);
+
+parcObject_ImplementRelease(parcBufferPool, PARCBufferPool);
+
+parcObject_ExtendPARCObject(PARCBufferPool, _parcBufferPool_Finalize, NULL, NULL, NULL, NULL, NULL, NULL);
+
+void
+parcBufferPool_AssertValid(const PARCBufferPool *instance)
+{
+    assertTrue(parcBufferPool_IsValid(instance),
+               "PARCBufferPool is not valid.");
+}
+
+bool
+parcBufferPool_IsValid(const PARCBufferPool *instance)
+{
+    bool result = false;
+
+    if (instance != NULL) {
+        result = instance->shared != NULL && instance->classCount > 0;
+    }
+
+    return result;
+}
+
+PARCBufferPool *
+parcBufferPool_Create(size_t minimumSize, size_t maximumSize, size_t limit)
+{
+    trapIllegalValueIf(minimumSize == 0, "The minimum size must be greater than zero.");
+    trapIllegalValueIf(maximumSize < minimumSize, "The maximum size (%zu) must be at least the minimum size (%zu).", maximumSize, minimumSize);
+
+    // Each pool has its own thread-specific key, of which a process has at most PTHREAD_KEYS_MAX.
+    pthread_key_t key;
+    if (pthread_key_create(&key, _parcBufferPool_ThreadExit) != 0) {
+        return NULL;
+    }
+
+    PARCBufferPool *result = parcObject_CreateInstance(PARCBufferPool);
+
+    if (result == NULL) {
+        pthread_key_delete(key);
+    } else {
+        pthread_mutex_init(&result->mutex, NULL);
+        result->key = key;
+
+        result->minimumShift = _parcBufferPool_CeilingLog2(minimumSize);
+        result->minimumSize = (size_t) 1 << result->minimumShift;
+        result->classCount = _parcBufferPool_CeilingLog2(maximumSize) - result->minimumShift + 1;
+        result->maximumSize = _parcBufferPool_ClassSize(result, result->classCount - 1);
+
+        result->shared = parcMemory_Allocate(result->classCount * sizeof(_PARCBufferPoolFreeList));
+        assertNotNull(result->shared, "parcMemory_Allocate(%zu) returned NULL", result->classCount * sizeof(_PARCBufferPoolFreeList));
+        for (size_t i = 0; i < result->classCount; i++) {
+            _parcBufferPool_FreeListInit(&result->shared[i], limit);
+        }
+
+        result->caches = NULL;
+        result->requests = 0;
+        result->misses = 0;
+        result->discards = 0;
+        result->gets = 0;
+        result->recycles = 0;
+    }
+
+    return result;
+}
+
+/**
+ * The PARCBufferRecycler of pooled buffers: keep the array in the releasing thread's cache if it can be reused.
+ */
+static void
+_parcBufferPool_Recycle(void *context, PARCByteArray *array)
+{
+    PARCBufferPool *pool = context;
+    _PARCBufferPoolCache *cache = _parcBufferPool_GetCache(pool);
+
+    cache->recycles++;
+
+    // A slice may still be using the array, or the buffer may have been resized in place.
+    size_t capacity = parcByteArray_Capacity(array);
+    size_t index = _parcBufferPool_ClassIndex(pool, capacity);
+    bool reusable = capacity <= pool->maximumSize
+                    && capacity == _parcBufferPool_ClassSize(pool, index)
+                    && parcObject_GetReferenceCount(array) == 1;
+
+    if (reusable) {
+        _PARCBufferPoolFreeList *local = &cache->classes[index];
+        if (local->count == local->capacity) {
+            // Give half of the cache to the shared free list, so the next few releases and gets are local again.
+            pthread_mutex_lock(&pool->mutex);
+            _parcBufferPool_Transfer(&pool->shared[index], local, local->capacity / 2);
+            pthread_mutex_unlock(&pool->mutex);
+        }
+        if (local->count < local->capacity) {
+            local->arrays[local->count++] = array;
+            array = NULL;
+        }
+    }
+
+    if (array != NULL) {
+        cache->discards++;
+        parcByteArray_Release(&array);
+    }
+
+    parcBufferPool_Release(&pool);
+}
+
+PARCBuffer *
+parcBufferPool_GetBuffer(PARCBufferPool *pool, size_t capacity)
+{
+    parcBufferPool_OptionalAssertValid(pool);
+
+    _PARCBufferPoolCache *cache = _parcBufferPool_GetCache(pool);
+    cache->requests++;
+
+    if (capacity > pool->maximumSize) {
+        cache->misses++;
+        return parcBuffer_Allocate(capacity);
+    }
+
+    size_t index = _parcBufferPool_ClassIndex(pool, capacity);
+    _PARCBufferPoolFreeList *local = &cache->classes[index];
+
+    if (local->count == 0) {
+        // Take up to half a cache's worth from the shared free list.
+        pthread_mutex_lock(&pool->mutex);
+        _PARCBufferPoolFreeList *shared = &pool->shared[index];
+        size_t keep = (shared->count > local->capacity / 2) ? shared->count - local->capacity / 2 : 0;
+        _parcBufferPool_Transfer(local, shared, keep);
+        pthread_mutex_unlock(&pool->mutex);
+    }
+
+    PARCByteArray *array;
+    if (local->count > 0) {
+        array = local->arrays[--local->count];
+    } else {
+        cache->misses++;
+        array = parcByteArray_Allocate(_parcBufferPool_ClassSize(pool, index));
+        if (array == NULL) {
+            return NULL;
+        }
+    }
+
+    PARCBuffer *result = parcBuffer_WrapRecyclableByteArray(array, capacity, _parcBufferPool_Recycle, parcBufferPool_Acquire(pool));
+    if (result != NULL) {
+        cache->gets++;
+    } else {
+        parcByteArray_Release(&array);
+        parcBufferPool_Release(&pool);
+    }
+
+    return result;
+}
+
+size_t
+parcBufferPool_Drain(PARCBufferPool *pool)
+{
+    parcBufferPool_OptionalAssertValid(pool);
+
+    size_t result = 0;
+
+    _PARCBufferPoolCache *cache = pthread_getspecific(pool->key);
+    if (cache != NULL) {
+        for (size_t i = 0; i < pool->classCount; i++) {
+            result += _parcBufferPool_FreeListDrain(&cache->classes[i]);
+        }
+    }
+
+    pthread_mutex_lock(&pool->mutex);
+    for (size_t i = 0; i < pool->classCount; i++) {
+        result += _parcBufferPool_FreeListDrain(&pool->shared[i]);
+    }
+    pthread_mutex_unlock(&pool->mutex);
+
+    return result;
+}
+
+/**
+ * The statistics summed over the exited threads and every thread cache.
+ */
+typedef struct {
+    uint64_t requests;
+    uint64_t misses;
+    uint64_t discards;
+    uint64_t gets;
+    uint64_t recycles;
+    size_t pooled;
+} _PARCBufferPoolTotals;
+
+static _PARCBufferPoolTotals
+_parcBufferPool_Totals(const PARCBufferPool *instance)
+{
+    PARCBufferPool *pool = (PARCBufferPool *) instance;
+    _PARCBufferPoolTotals result;
+
+    pthread_mutex_lock(&pool->mutex);
+    result.requests = pool->requests;
+    result.misses = pool->misses;
+    result.discards = pool->discards;
+    result.gets = pool->gets;
+    result.recycles = pool->recycles;
+    result.pooled = 0;
+    for (size_t i = 0; i < pool->classCount; i++) {
+        result.pooled += pool->shared[i].count;
+    }
+    for (_PARCBufferPoolCache *cache = pool->caches; cache != NULL; cache = cache->next) {
+        result.requests += cache->requests;
+        result.misses += cache->misses;
+        result.discards += cache->discards;
+        result.gets += cache->gets;
+        result.recycles += cache->recycles;
+        for (size_t i = 0; i < pool->classCount; i++) {
+            result.pooled += cache->classes[i].count;
+        }
+    }
+    pthread_mutex_unlock(&pool->mutex);
+
+    return result;
+}
+
+void
+parcBufferPool_Display(const PARCBufferPool *instance, int indentation)
+{
+    _PARCBufferPoolTotals totals = _parcBufferPool_Totals(instance);
+    double missRate = (totals.requests == 0) ? 0.0 : (double) totals.misses / (double) totals.requests;
+
+    PARCBufferPool *pool = (PARCBufferPool *) instance;
+    parcDisplayIndented_PrintLine(indentation, "PARCBufferPool@%p {", instance);
+    parcDisplayIndented_PrintLine(indentation + 1, ".minimumSize=%zu, .maximumSize=%zu, .classes=%zu",
+                                  pool->minimumSize, pool->maximumSize, pool->classCount);
+    parcDisplayIndented_PrintLine(indentation + 1, ".requests=%" PRIu64 ", .misses=%" PRIu64 " (%.1f%%), .discards=%" PRIu64,
+                                  totals.requests, totals.misses, missRate * 100.0, totals.discards);
+    parcDisplayIndented_PrintLine(indentation + 1, ".outstanding=%" PRIu64 ", .pooled=%zu",
+                                  totals.gets - totals.recycles, totals.pooled);
+
+    pthread_mutex_lock(&pool->mutex);
+    for (size_t i = 0; i < pool->classCount; i++) {
+        size_t cached = 0;
+        for (_PARCBufferPoolCache *cache = pool->caches; cache != NULL; cache = cache->next) {
+            cached += cache->classes[i].count;
+        }
+        parcDisplayIndented_PrintLine(indentation + 1, "[%zu] .size=%zu, .shared=%zu/%zu, .cached=%zu",
+                                      i, _parcBufferPool_ClassSize(pool, i), pool->shared[i].count, pool->shared[i].capacity, cached);
+    }
+    pthread_mutex_unlock(&pool->mutex);
+
+    parcDisplayIndented_PrintLine(indentation, "}");
+}
+
+uint64_t
+parcBufferPool_GetRequests(const PARCBufferPool *pool)
+{
+    return _parcBufferPool_Totals(pool).requests;
+}
+
+uint64_t
+parcBufferPool_GetMisses(const PARCBufferPool *pool)
+{
+    return _parcBufferPool_Totals(pool).misses;
+}
+
+uint64_t
+parcBufferPool_GetDiscards(const PARCBufferPool *pool)
+{
+    return _parcBufferPool_Totals(pool).discards;
+}
+
+size_t
+parcBufferPool_GetOutstanding(const PARCBufferPool *pool)
+{
+    _PARCBufferPoolTotals totals = _parcBufferPool_Totals(pool);
+    return (size_t) (totals.gets - totals.recycles);
+}
+
+size_t
+parcBufferPool_GetPooled(const PARCBufferPool *pool)
+{
+    return _parcBufferPool_Totals(pool).pooled;
+}
@@ -0,0 +1,322 @@
+/*
+ * Copyright (c) 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Patent rights are not granted under this agreement. Patent rights are
+ *       available under FRAND terms.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX or PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * @file parc_BufferPool.h
+ * @ingroup memory
+ * @brief A thread-safe pool of recycled `PARCBuffer` storage in a range of size classes.
+ *
+ * `parcBuffer_Allocate` makes three allocations: the `PARCBuffer`, its `PARCByteArray`, and the array's storage,
+ * which is also cleared. At packet rates this dominates the cost of receiving a packet.
+ * A `PARCBufferPool` keeps the `PARCByteArray` (and its storage) of a released pooled buffer and reuses it
+ * for the next buffer of the same size class, so getting a pooled buffer allocates only the `PARCBuffer` itself.
+ *
+ * The size classes are the powers of two from the pool's minimum size up to its maximum size.
+ * A request is served from the smallest class that holds it. A request larger than the maximum size
+ * is served by `parcBuffer_Allocate` and is never pooled.
+ *
+ * Each thread has a small cache of free arrays per class, so most gets and releases take no lock.
+ * A thread cache that is empty takes a batch of arrays from the pool's shared free list,
+ * and one that is full gives a batch back. The shared free list holds at most the pool's limit of arrays per class;
+ * arrays beyond that are freed.
+ *
+ * A pooled buffer behaves exactly like any other `PARCBuffer`, except that its content is not cleared
+ * and its storage returns to the pool when its last reference is released.
+ * If slices or duplicates of the buffer still share its storage at that time, the storage is not reused
+ * but simply freed when they are released.
+ * Every pooled buffer holds a reference to its pool, so the pool remains valid until all of its buffers are released.
+ *
+ * The pool counts requests, misses (requests that had to allocate new storage) and discards
+ * (released storage that could not be kept), and reports how many buffers are outstanding and how many
+ * free arrays it holds.
+ *
+ * @copyright 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC).  All rights reserved.
+ */
+#ifndef libparc_parc_BufferPool_h
+#define libparc_parc_BufferPool_h
+
+#include <stdbool.h>
+#include <stdint.h>
+
+struct PARCBufferPool;
+typedef struct PARCBufferPool PARCBufferPool;
+
+#include <parc/algol/parc_Buffer.h>
+
+#ifdef PARCLibrary_DISABLE_VALIDATION
+#  define parcBufferPool_OptionalAssertValid(_instance_)
+#else
+#  define parcBufferPool_OptionalAssertValid(_instance_) parcBufferPool_AssertValid(_instance_)
+#endif
+
+/**
+ * Create an empty `PARCBufferPool`.
+ *
+ * The minimum and maximum sizes are rounded up to powers of two.
+ *
+ * Each pool uses one thread-specific data key for its thread caches until it is destroyed.
+ * A process has at most `PTHREAD_KEYS_MAX` such keys (at least 128), shared with the rest of the program,
+ * so a pool is meant to be long-lived and shared rather than created per connection or per task.
+ * Creating a pool when no key is available returns NULL.
+ *
+ * @param [in] minimumSize The size of the smallest size class, which must be greater than zero.
+ * @param [in] maximumSize The size of the largest size class, which must be at least @p minimumSize.
+ * @param [in] limit The largest number of free arrays the pool shares between threads in each size class.
+ *
+ * @return non-NULL A pointer to a valid PARCBufferPool instance.
+ * @return NULL An error occurred, or no thread-specific data key was available.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCBufferPool *pool = parcBufferPool_Create(64, 65536, 1024);
+ *
+ *     parcBufferPool_Release(&pool);
+ * }
+ * @endcode
+ */
+PARCBufferPool *parcBufferPool_Create(size_t minimumSize, size_t maximumSize, size_t limit);
+
+/**
+ * Increase the number of references to a `PARCBufferPool` instance.
+ *
+ * @param [in] instance A pointer to a valid PARCBufferPool instance.
+ *
+ * @return The same value as @p instance.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCBufferPool *a = parcBufferPool_Create(64, 65536, 1024);
+ *
+ *     PARCBufferPool *b = parcBufferPool_Acquire(a);
+ *
+ *     parcBufferPool_Release(&a);
+ *     parcBufferPool_Release(&b);
+ * }
+ * @endcode
+ */
+PARCBufferPool *parcBufferPool_Acquire(const PARCBufferPool *instance);
+
+/**
+ * Release a previously acquired reference to the given `PARCBufferPool` instance,
+ * decrementing the reference count for the instance.
+ *
+ * Outstanding pooled buffers hold their own references, so the pool is destroyed only when they have been released too.
+ * When the pool is destroyed no other thread may still be using it.
+ *
+ * The pointer to the instance is set to NULL as a side-effect of this function.
+ *
+ * @param [in,out] instancePtr A pointer to a pointer to the instance to release.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCBufferPool *a = parcBufferPool_Create(64, 65536, 1024);
+ *
+ *     parcBufferPool_Release(&a);
+ * }
+ * @endcode
+ */
+void parcBufferPool_Release(PARCBufferPool **instancePtr);
+
+/**
+ * Determine if an instance of `PARCBufferPool` is valid.
+ *
+ * @param [in] instance A pointer to a PARCBufferPool instance.
+ *
+ * @return true The instance is valid.
+ * @return false The instance is not valid.
+ *
+ * Example:
+ * @code
+ * {
+ *     if (parcBufferPool_IsValid(pool)) {
+ *         ...
+ *     }
+ * }
+ * @endcode
+ */
+bool parcBufferPool_IsValid(const PARCBufferPool *instance);
+
+/**
+ * Assert that the given `PARCBufferPool` instance is valid.
+ *
+ * @param [in] instance A pointer to a PARCBufferPool instance.
+ *
+ * Example:
+ * @code
+ * {
+ *     parcBufferPool_AssertValid(pool);
+ * }
+ * @endcode
+ */
+void parcBufferPool_AssertValid(const PARCBufferPool *instance);
+
+/**
+ * Print a human readable representation of the given `PARCBufferPool`, including the statistics of each size class.
+ *
+ * @param [in] instance A pointer to a valid PARCBufferPool instance.
+ * @param [in] indentation The indentation level to use for printing.
+ *
+ * Example:
+ * @code
+ * {
+ *     parcBufferPool_Display(pool, 0);
+ * }
+ * @endcode
+ */
+void parcBufferPool_Display(const PARCBufferPool *instance, int indentation);
+
+/**
+ * Get a buffer with the given capacity from the pool.
+ *
+ * The buffer's position is 0 and its limit and capacity are @p capacity.
+ * Unlike `parcBuffer_Allocate`, the content of the buffer is not cleared.
+ *
+ * @param [in] pool A pointer to a valid PARCBufferPool instance.
+ * @param [in] capacity The capacity of the buffer.
+ *
+ * @return non-NULL A pointer to a PARCBuffer, which the caller must release.
+ * @return NULL Memory could not be allocated.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCBuffer *buffer = parcBufferPool_GetBuffer(pool, 1500);
+ *     ...
+ *     parcBuffer_Release(&buffer); // the storage returns to the pool
+ * }
+ * @endcode
+ */
+PARCBuffer *parcBufferPool_GetBuffer(PARCBufferPool *pool, size_t capacity);
+
+/**
+ * Free all of the arrays held by the pool's shared free lists and by the calling thread's cache.
+ *
+ * The caches of other threads are not affected.
+ *
+ * @param [in,out] pool A pointer to a valid PARCBufferPool instance.
+ *
+ * @return The number of arrays freed.
+ *
+ * Example:
+ * @code
+ * {
+ *     size_t freed = parcBufferPool_Drain(pool);
+ * }
+ * @endcode
+ */
+size_t parcBufferPool_Drain(PARCBufferPool *pool);
+
+/**
+ * Get the number of buffers requested from the pool.
+ *
+ * Requests larger than the maximum size are included.
+ * While other threads are using the pool, the statistics are approximate.
+ *
+ * @param [in] pool A pointer to a valid PARCBufferPool instance.
+ *
+ * @return The number of buffers requested.
+ *
+ * Example:
+ * @code
+ * {
+ *     uint64_t requests = parcBufferPool_GetRequests(pool);
+ * }
+ * @endcode
+ */
+uint64_t parcBufferPool_GetRequests(const PARCBufferPool *pool);
+
+/**
+ * Get the number of requests that could not reuse pooled storage and had to allocate.
+ *
+ * Requests larger than the maximum size are always misses.
+ *
+ * @param [in] pool A pointer to a valid PARCBufferPool instance.
+ *
+ * @return The number of requests that allocated new storage.
+ *
+ * Example:
+ * @code
+ * {
+ *     double missRate = (double) parcBufferPool_GetMisses(pool) / parcBufferPool_GetRequests(pool);
+ * }
+ * @endcode
+ */
+uint64_t parcBufferPool_GetMisses(const PARCBufferPool *pool);
+
+/**
+ * Get the number of released pooled buffers whose storage could not be kept.
+ *
+ * Storage is discarded when the pool already holds its limit of free arrays,
+ * when it is still shared with a slice or duplicate of the buffer, or when the buffer was resized.
+ *
+ * @param [in] pool A pointer to a valid PARCBufferPool instance.
+ *
+ * @return The number of discarded arrays.
+ *
+ * Example:
+ * @code
+ * {
+ *     uint64_t discards = parcBufferPool_GetDiscards(pool);
+ * }
+ * @endcode
+ */
+uint64_t parcBufferPool_GetDiscards(const PARCBufferPool *pool);
+
+/**
+ * Get the number of pooled buffers that have been got from the pool and not yet released.
+ *
+ * @param [in] pool A pointer to a valid PARCBufferPool instance.
+ *
+ * @return The number of outstanding pooled buffers.
+ *
+ * Example:
+ * @code
+ * {
+ *     size_t outstanding = parcBufferPool_GetOutstanding(pool);
+ * }
+ * @endcode
+ */
+size_t parcBufferPool_GetOutstanding(const PARCBufferPool *pool);
+
+/**
+ * Get the number of free arrays held by the pool, in its shared free lists and in all of the thread caches.
+ *
+ * @param [in] pool A pointer to a valid PARCBufferPool instance.
+ *
+ * @return The number of free arrays held by the pool.
+ *
+ * Example:
+ * @code
+ * {
+ *     size_t pooled = parcBufferPool_GetPooled(pool);
+ * }
+ * @endcode
+ */
+size_t parcBufferPool_GetPooled(const PARCBufferPool *pool);
+#endif // libparc_parc_BufferPool_h
@@ -0,0 +1,254 @@
+/*
+ * Copyright (c) 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Patent rights are not granted under this agreement. Patent rights are
+ *       available under FRAND terms.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX or PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * @author Glenn Scott, Palo Alto Research Center (Xerox PARC)
+ * @copyright 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC).  All rights reserved.
+ */
+#include <config.h>
+
+#include <string.h>
+
+#include <LongBow/runtime.h>
+
+#include <parc/algol/parc_BufferView.h>
+#include <parc/algol/parc_Memory.h>
+
+static inline const uint8_t *
+_address(const PARCBufferView *view)
+{
+    return &view->array[view->offset + view->position];
+}
+
+static inline void
+_trapIfUnderflow(const PARCBufferView *view, size_t required)
+{
+    trapOutOfBoundsIf(required > view->length - view->position,
+                      "PARCBufferView has %zd bytes remaining, %zd required", view->length - view->position, required);
+}
+
+PARCBufferView
+parcBufferView_Wrap(const void *array, size_t offset, size_t length)
+{
+    assertTrue(length == 0 || array != NULL, "If the array is NULL, then length MUST be zero.");
+
+    PARCBufferView result = { .array = array, .offset = offset, .length = length, .position = 0 };
+    return result;
+}
+
+PARCBufferView
+parcBufferView_WrapCString(const char *string)
+{
+    return parcBufferView_Wrap(string, 0, strlen(string));
+}
+
+PARCBufferView
+parcBufferView_FromBuffer(const PARCBuffer *buffer)
+{
+    size_t remaining = parcBuffer_Remaining(buffer);
+    if (remaining == 0) {
+        return parcBufferView_Wrap(NULL, 0, 0);
+    }
+    return parcBufferView_Wrap(parcBuffer_Overlay((PARCBuffer *) buffer, 0), 0, remaining);
+}
+
+PARCBufferView
+parcBufferView_Slice(PARCBufferView *view, size_t length)
+{
+    _trapIfUnderflow(view, length);
+
+    PARCBufferView result = parcBufferView_Wrap(view->array, view->offset + view->position, length);
+    view->position += length;
+    return result;
+}
+
+size_t
+parcBufferView_Remaining(const PARCBufferView *view)
+{
+    return view->length - view->position;
+}
+
+bool
+parcBufferView_HasRemaining(const PARCBufferView *view)
+{
+    return view->position < view->length;
+}
+
+size_t
+parcBufferView_Position(const PARCBufferView *view)
+{
+    return view->position;
+}
+
+PARCBufferView *
+parcBufferView_SetPosition(PARCBufferView *view, size_t position)
+{
+    trapOutOfBoundsIf(position > view->length, "PARCBufferView length is %zd, attempted to set the position to %zd",
+                      view->length, position);
+    view->position = position;
+    return view;
+}
+
+const uint8_t *
+parcBufferView_Overlay(PARCBufferView *view, size_t length)
+{
+    _trapIfUnderflow(view, length);
+
+    const uint8_t *result = _address(view);
+    view->position += length;
+    return result;
+}
+
+uint8_t
+parcBufferView_GetUint8(PARCBufferView *view)
+{
+    return *parcBufferView_Overlay(view, sizeof(uint8_t));
+}
+
+uint16_t
+parcBufferView_GetUint16(PARCBufferView *view)
+{
+    const uint8_t *bytes = parcBufferView_Overlay(view, sizeof(uint16_t));
+    return (uint16_t) (bytes[0] << 8 | bytes[1]);
+}
+
+uint32_t
+parcBufferView_GetUint32(PARCBufferView *view)
+{
+    const uint8_t *bytes = parcBufferView_Overlay(view, sizeof(uint32_t));
+    return (uint32_t) bytes[0] << 24 | (uint32_t) bytes[1] << 16 | (uint32_t) bytes[2] << 8 | bytes[3];
+}
+
+uint64_t
+parcBufferView_GetUint64(PARCBufferView *view)
+{
+    uint64_t high = parcBufferView_GetUint32(view);
+    return high << 32 | parcBufferView_GetUint32(view);
+}
+
+/*
+ * Compare `length` bytes at `bytes` with the remaining bytes of `view`, in the order of `parcBuffer_Compare`.
+ */
+static int
+_compare(const PARCBufferView *view, size_t length, const uint8_t *bytes)
+{
+    size_t remaining = parcBufferView_Remaining(view);
+    size_t count = (remaining < length) ? remaining : length;
+
+    int result = 0;
+    if (count > 0) {
+        result = memcmp(_address(view), bytes, count);
+    }
+    if (result == 0) {
+        if (remaining > length) {
+            result = +1;
+        } else if (remaining < length) {
+            result = -1;
+        }
+    }
+    return result;
+}
+
+bool
+parcBufferView_Equals(const PARCBufferView *x, const PARCBufferView *y)
+{
+    if (parcBufferView_Remaining(x) != parcBufferView_Remaining(y)) {
+        return false;
+    }
+    return _compare(x, parcBufferView_Remaining(y), _address(y)) == 0;
+}
+
+bool
+parcBufferView_EqualsBuffer(const PARCBufferView *view, const PARCBuffer *buffer)
+{
+    if (buffer == NULL || parcBufferView_Remaining(view) != parcBuffer_Remaining(buffer)) {
+        return false;
+    }
+    return parcBufferView_CompareBuffer(view, buffer) == 0;
+}
+
+int
+parcBufferView_Compare(const PARCBufferView *x, const PARCBufferView *y)
+{
+    return _compare(x, parcBufferView_Remaining(y), _address(y));
+}
+
+int
+parcBufferView_CompareBuffer(const PARCBufferView *view, const PARCBuffer *buffer)
+{
+    if (buffer == NULL) {
+        return +1;
+    }
+
+    size_t length = parcBuffer_Remaining(buffer);
+    if (length == 0) {
+        return _compare(view, 0, NULL);
+    }
+    return _compare(view, length, parcBuffer_Overlay((PARCBuffer *) buffer, 0));
+}
+
+PARCHashCode
+parcBufferView_HashCode(const PARCBufferView *view)
+{
+    PARCHashCode result = 0;
+
+    size_t remaining = parcBufferView_Remaining(view);
+    if (remaining > 0) {
+        result = parcHashCode_Hash(_address(view), remaining);
+    }
+    return result;
+}
+
+PARCBuffer *
+parcBufferView_PutInto(const PARCBufferView *view, PARCBuffer *buffer)
+{
+    return parcBuffer_PutArray(buffer, parcBufferView_Remaining(view), _address(view));
+}
+
+PARCBuffer *
+parcBufferView_ToBuffer(const PARCBufferView *view)
+{
+    PARCBuffer *result = parcBuffer_Allocate(parcBufferView_Remaining(view));
+    if (result != NULL) {
+        parcBuffer_Flip(parcBufferView_PutInto(view, result));
+    }
+    return result;
+}
+
+char *
+parcBufferView_ToString(const PARCBufferView *view)
+{
+    size_t remaining = parcBufferView_Remaining(view);
+
+    char *result = parcMemory_Allocate(remaining + 1);
+    if (result != NULL) {
+        if (remaining > 0) {
+            memcpy(result, _address(view), remaining);
+        }
+        result[remaining] = 0;
+    }
+    return result;
+}
@@ -0,0 +1,454 @@
+/*
+ * Copyright (c) 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Patent rights are not granted under this agreement. Patent rights are
+ *       available under FRAND terms.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX or PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * @file parc_BufferView.h
+ * @ingroup memory
+ * @brief A read-only window on a range of memory that lives on the stack.
+ *
+ * A `PARCBufferView` is a plain value: it is not a `PARCObject`, has no reference count and needs no release.
+ * It is meant for the short-lived wrappings that otherwise cost a `PARCBuffer` and its `PARCByteArray`,
+ * such as wrapping a C string only to compare it with a buffer, or slicing a buffer only to parse a field.
+ *
+ * Like a `PARCBuffer`, a view has a position; the bytes from the position to the end of the view are its
+ * remaining bytes, and those are what it compares, hashes and copies. A view's hash code is the same as the hash code
+ * of a `PARCBuffer` with the same remaining bytes, so a view can be used to look up buffer-keyed entries.
+ *
+ * A view does not own the memory it refers to. When the bytes must outlive that memory, copy them to a
+ * `PARCBuffer` with `parcBufferView_ToBuffer`.
+ *
+ * @copyright 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC).  All rights reserved.
+ */
+#ifndef libparc_parc_BufferView_h
+#define libparc_parc_BufferView_h
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+
+#include <parc/algol/parc_Buffer.h>
+#include <parc/algol/parc_HashCode.h>
+
+/**
+ * The fields are public so that a view can be declared on the stack; use the functions below to work with them.
+ */
+typedef struct parc_buffer_view {
+    const uint8_t *array;
+    size_t offset;       // The index within `array` of the first byte of the view.
+    size_t length;       // The number of bytes in the view.
+    size_t position;     // The index, relative to `offset`, of the next byte to be read.
+} PARCBufferView;
+
+/**
+ * Create a view of @p length bytes of @p array, starting at @p offset.
+ *
+ * @param [in] array A pointer to memory that remains valid while the view is used.
+ * @param [in] offset The index within @p array of the first byte of the view.
+ * @param [in] length The number of bytes in the view.
+ *
+ * @return A view positioned at its first byte.
+ *
+ * Example:
+ * @code
+ * {
+ *     uint8_t array[] = { 1, 2, 3, 4 };
+ *     PARCBufferView view = parcBufferView_Wrap(array, 1, 2); // The bytes 2 and 3.
+ * }
+ * @endcode
+ */
+PARCBufferView parcBufferView_Wrap(const void *array, size_t offset, size_t length);
+
+/**
+ * Create a view of the characters of the nul-terminated C string @p string, not including the terminating nul.
+ *
+ * @param [in] string A pointer to a nul-terminated C string that remains valid while the view is used.
+ *
+ * @return A view positioned at the first character.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCBufferView view = parcBufferView_WrapCString("Hello World");
+ *
+ *     bool same = parcBufferView_EqualsBuffer(&view, buffer);
+ * }
+ * @endcode
+ */
+PARCBufferView parcBufferView_WrapCString(const char *string);
+
+/**
+ * Create a view of the remaining bytes of @p buffer.
+ *
+ * The view is valid while @p buffer is neither released nor resized, and it sees any later changes to those bytes.
+ * Moving the view's position does not change the position of @p buffer.
+ *
+ * @param [in] buffer A pointer to a valid PARCBuffer instance.
+ *
+ * @return A view positioned at the first remaining byte of @p buffer.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCBufferView view = parcBufferView_FromBuffer(buffer);
+ *     uint16_t type = parcBufferView_GetUint16(&view);
+ * }
+ * @endcode
+ */
+PARCBufferView parcBufferView_FromBuffer(const PARCBuffer *buffer);
+
+/**
+ * Create a view of the next @p length remaining bytes of @p view and advance the position of @p view past them.
+ *
+ * @param [in,out] view A pointer to a valid PARCBufferView.
+ * @param [in] length The number of bytes in the new view, which must not exceed the remaining bytes of @p view.
+ *
+ * @return A view of the bytes, positioned at its first byte.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCBufferView packet = parcBufferView_FromBuffer(buffer);
+ *     uint16_t length = parcBufferView_GetUint16(&packet);
+ *     PARCBufferView value = parcBufferView_Slice(&packet, length);
+ * }
+ * @endcode
+ */
+PARCBufferView parcBufferView_Slice(PARCBufferView *view, size_t length);
+
+/**
+ * Return the number of bytes between the position and the end of the view.
+ *
+ * @param [in] view A pointer to a valid PARCBufferView.
+ *
+ * @return The number of remaining bytes.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCBufferView view = parcBufferView_WrapCString("abc");
+ *     size_t remaining = parcBufferView_Remaining(&view); // 3
+ * }
+ * @endcode
+ */
+size_t parcBufferView_Remaining(const PARCBufferView *view);
+
+/**
+ * Return true if there are bytes between the position and the end of the view.
+ *
+ * @param [in] view A pointer to a valid PARCBufferView.
+ *
+ * @return true There is at least one remaining byte.
+ * @return false The position is at the end of the view.
+ *
+ * Example:
+ * @code
+ * {
+ *     while (parcBufferView_HasRemaining(&view)) {
+ *         uint8_t byte = parcBufferView_GetUint8(&view);
+ *     }
+ * }
+ * @endcode
+ */
+bool parcBufferView_HasRemaining(const PARCBufferView *view);
+
+/**
+ * Return the position of the view.
+ *
+ * @param [in] view A pointer to a valid PARCBufferView.
+ *
+ * @return The index, relative to the start of the view, of the next byte to be read.
+ *
+ * Example:
+ * @code
+ * {
+ *     size_t position = parcBufferView_Position(&view);
+ * }
+ * @endcode
+ */
+size_t parcBufferView_Position(const PARCBufferView *view);
+
+/**
+ * Set the position of the view.
+ *
+ * @param [in,out] view A pointer to a valid PARCBufferView.
+ * @param [in] position The new position, which must not exceed the length of the view.
+ *
+ * @return The value of @p view.
+ *
+ * Example:
+ * @code
+ * {
+ *     parcBufferView_SetPosition(&view, 0);
+ * }
+ * @endcode
+ */
+PARCBufferView *parcBufferView_SetPosition(PARCBufferView *view, size_t position);
+
+/**
+ * Return a pointer to the remaining bytes of the view and advance the position by @p length.
+ *
+ * @param [in,out] view A pointer to a valid PARCBufferView.
+ * @param [in] length The number of bytes to advance, which must not exceed the remaining bytes.
+ *
+ * @return A pointer to the byte at the position the view had before the call.
+ *
+ * Example:
+ * @code
+ * {
+ *     const uint8_t *bytes = parcBufferView_Overlay(&view, 4);
+ * }
+ * @endcode
+ */
+const uint8_t *parcBufferView_Overlay(PARCBufferView *view, size_t length);
+
+/**
+ * Read the byte at the position of the view and advance the position by one.
+ *
+ * @param [in,out] view A pointer to a valid PARCBufferView with at least one remaining byte.
+ *
+ * @return The byte.
+ *
+ * Example:
+ * @code
+ * {
+ *     uint8_t type = parcBufferView_GetUint8(&view);
+ * }
+ * @endcode
+ */
+uint8_t parcBufferView_GetUint8(PARCBufferView *view);
+
+/**
+ * Read a big-endian 16-bit value at the position of the view and advance the position past it.
+ *
+ * @param [in,out] view A pointer to a valid PARCBufferView with at least two remaining bytes.
+ *
+ * @return The value.
+ *
+ * Example:
+ * @code
+ * {
+ *     uint16_t length = parcBufferView_GetUint16(&view);
+ * }
+ * @endcode
+ */
+uint16_t parcBufferView_GetUint16(PARCBufferView *view);
+
+/**
+ * Read a big-endian 32-bit value at the position of the view and advance the position past it.
+ *
+ * @param [in,out] view A pointer to a valid PARCBufferView with at least four remaining bytes.
+ *
+ * @return The value.
+ *
+ * Example:
+ * @code
+ * {
+ *     uint32_t value = parcBufferView_GetUint32(&view);
+ * }
+ * @endcode
+ */
+uint32_t parcBufferView_GetUint32(PARCBufferView *view);
+
+/**
+ * Read a big-endian 64-bit value at the position of the view and advance the position past it.
+ *
+ * @param [in,out] view A pointer to a valid PARCBufferView with at least eight remaining bytes.
+ *
+ * @return The value.
+ *
+ * Example:
+ * @code
+ * {
+ *     uint64_t value = parcBufferView_GetUint64(&view);
+ * }
+ * @endcode
+ */
+uint64_t parcBufferView_GetUint64(PARCBufferView *view);
+
+/**
+ * Determine if the remaining bytes of two views are equal.
+ *
+ * @param [in] x A pointer to a valid PARCBufferView.
+ * @param [in] y A pointer to a valid PARCBufferView.
+ *
+ * @return true The remaining bytes are equal.
+ * @return false The remaining bytes differ.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCBufferView x = parcBufferView_WrapCString("abc");
+ *     PARCBufferView y = parcBufferView_WrapCString("abc");
+ *
+ *     bool equal = parcBufferView_Equals(&x, &y); // true
+ * }
+ * @endcode
+ */
+bool parcBufferView_Equals(const PARCBufferView *x, const PARCBufferView *y);
+
+/**
+ * Determine if the remaining bytes of a view are equal to the remaining bytes of a `PARCBuffer`.
+ *
+ * This is the same as `parcBuffer_Equals` with a buffer wrapping the view's bytes.
+ *
+ * @param [in] view A pointer to a valid PARCBufferView.
+ * @param [in] buffer A pointer to a valid PARCBuffer instance, or NULL.
+ *
+ * @return true The remaining bytes are equal.
+ * @return false The remaining bytes differ, or @p buffer is NULL.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCBufferView view = parcBufferView_WrapCString("name");
+ *
+ *     if (parcBufferView_EqualsBuffer(&view, parcJSONPair_GetName(pair))) {
+ *         ...
+ *     }
+ * }
+ * @endcode
+ */
+bool parcBufferView_EqualsBuffer(const PARCBufferView *view, const PARCBuffer *buffer);
+
+/**
+ * Compare the remaining bytes of two views lexicographically.
+ *
+ * A view that is a prefix of the other is the lesser.
+ *
+ * @param [in] x A pointer to a valid PARCBufferView.
+ * @param [in] y A pointer to a valid PARCBufferView.
+ *
+ * @return < 0 @p x is less than @p y.
+ * @return 0 @p x is equal to @p y.
+ * @return > 0 @p x is greater than @p y.
+ *
+ * Example:
+ * @code
+ * {
+ *     int order = parcBufferView_Compare(&x, &y);
+ * }
+ * @endcode
+ */
+int parcBufferView_Compare(const PARCBufferView *x, const PARCBufferView *y);
+
+/**
+ * Compare the remaining bytes of a view with the remaining bytes of a `PARCBuffer`, in the order of `parcBuffer_Compare`.
+ *
+ * @param [in] view A pointer to a valid PARCBufferView.
+ * @param [in] buffer A pointer to a valid PARCBuffer instance, or NULL, which is less than every view.
+ *
+ * @return < 0 @p view is less than @p buffer.
+ * @return 0 @p view is equal to @p buffer.
+ * @return > 0 @p view is greater than @p buffer.
+ *
+ * Example:
+ * @code
+ * {
+ *     int order = parcBufferView_CompareBuffer(&view, buffer);
+ * }
+ * @endcode
+ */
+int parcBufferView_CompareBuffer(const PARCBufferView *view, const PARCBuffer *buffer);
+
+/**
+ * Return the hash code of the remaining bytes of the view.
+ *
+ * The result is equal to `parcBuffer_HashCode` of a buffer with the same remaining bytes.
+ *
+ * @param [in] view A pointer to a valid PARCBufferView.
+ *
+ * @return The hash code.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCHashCode hashCode = parcBufferView_HashCode(&view);
+ * }
+ * @endcode
+ */
+PARCHashCode parcBufferView_HashCode(const PARCBufferView *view);
+
+/**
+ * Copy the remaining bytes of the view into @p buffer at its position, and advance the position of @p buffer.
+ *
+ * This is the counterpart of `parcBuffer_PutBuffer`. The position of the view is unchanged.
+ *
+ * @param [in] view A pointer to a valid PARCBufferView.
+ * @param [in,out] buffer A pointer to a valid PARCBuffer instance with room for the remaining bytes of @p view.
+ *
+ * @return The value of @p buffer.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCBufferView view = parcBufferView_WrapCString("Hello");
+ *     PARCBuffer *buffer = parcBuffer_Allocate(5);
+ *     parcBufferView_PutInto(&view, buffer);
+ * }
+ * @endcode
+ */
+PARCBuffer *parcBufferView_PutInto(const PARCBufferView *view, PARCBuffer *buffer);
+
+/**
+ * Create a `PARCBuffer` holding a copy of the remaining bytes of the view.
+ *
+ * Use this when the bytes must outlive the memory the view refers to.
+ *
+ * @param [in] view A pointer to a valid PARCBufferView.
+ *
+ * @return non-NULL A pointer to a PARCBuffer, positioned at 0 with its limit at the number of bytes copied.
+ * @return NULL Memory could not be allocated.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCBuffer *buffer = parcBufferView_ToBuffer(&view);
+ *
+ *     parcBuffer_Release(&buffer);
+ * }
+ * @endcode
+ */
+PARCBuffer *parcBufferView_ToBuffer(const PARCBufferView *view);
+
+/**
+ * Create a nul-terminated C string holding a copy of the remaining bytes of the view.
+ *
+ * @param [in] view A pointer to a valid PARCBufferView.
+ *
+ * @return non-NULL A pointer to a nul-terminated string that must be deallocated via `parcMemory_Deallocate`.
+ * @return NULL Memory could not be allocated.
+ *
+ * Example:
+ * @code
+ * {
+ *     char *string = parcBufferView_ToString(&view);
+ *
+ *     parcMemory_Deallocate(&string);
+ * }
+ * @endcode
+ */
+char *parcBufferView_ToString(const PARCBufferView *view);
+#endif // libparc_parc_BufferView_h
@@ -0,0 +1,351 @@
+/*
+ * Copyright (c) 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Patent rights are not granted under this agreement. Patent rights are
+ *       available under FRAND terms.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX or PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * @copyright 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC).  All rights reserved.
+ */
+#include <config.h>
+
+#include <errno.h>
+#include <pthread.h>
+#include <sys/time.h>
+
+#include <LongBow/runtime.h>
+
+#include <parc/algol/parc_Object.h>
+#include <parc/algol/parc_Memory.h>
+#include <parc/algol/parc_Time.h>
+#include <parc/algol/parc_BufferChain.h>
+#include <parc/algol/parc_BufferedOutputStream.h>
+
+PARCOutputStreamInterface *PARCBufferedOutputStreamAsPARCOutputStream = &(PARCOutputStreamInterface) {
+    .Acquire = (PARCOutputStream * (*)(PARCOutputStream *))parcBufferedOutputStream_Acquire,
+    .Release = (void (*)(PARCOutputStream **))parcBufferedOutputStream_Release,
+    .Write = (size_t (*)(PARCOutputStream *, PARCBuffer *))parcBufferedOutputStream_Write,
+    .Flush = (bool (*)(PARCOutputStream *))parcBufferedOutputStream_Flush
+};
+
+/*
+ * Writers copy into `active`, whose position is the number of bytes it holds.
+ *
+ * Without a background thread, a writer that fills `active` writes it to the underlying stream itself,
+ * holding the mutex so that writes reach the underlying stream in order.
+ *
+ * With a background thread, a writer that fills `active` waits until `flushing` is empty, swaps the two buffers,
+ * and wakes the thread, which writes `flushing` without the mutex held. So writers block only when the
+ * thread is still writing the previous buffer.
+ */
+struct PARCBufferedOutputStream {
+    PARCOutputStream *output;
+    size_t capacity;
+    uint64_t maximumDelay;  // Microseconds, or 0 for no limit.
+    bool background;
+
+    pthread_mutex_t mutex;
+    pthread_cond_t flushRequested;  // Signalled when `flushing` is filled, `active` gets its first byte, or the stream is stopping.
+    pthread_cond_t flushDone;       // Signalled when the background thread has emptied `flushing`.
+
+    PARCBuffer *active;
+    uint64_t activeSince;   // When the first byte held by `active` was written.
+
+    PARCBuffer *flushing;
+    bool flushPending;      // `flushing` holds bytes the background thread has yet to write.
+
+    bool failed;            // A write to the underlying stream failed since the last flush.
+    bool stopping;
+    pthread_t flusher;
+};
+
+/*
+ * Write the bytes held by `buffer` (from 0 to its position) to the underlying stream and empty it.
+ */
+static void
+_parcBufferedOutputStream_WriteHeld(PARCBufferedOutputStream *stream, PARCBuffer *buffer, bool *failed)
+{
+    if (parcBuffer_Position(buffer) > 0) {
+        parcBuffer_Flip(buffer);
+        parcOutputStream_Write(stream->output, buffer);
+        if (parcBuffer_HasRemaining(buffer)) {
+            *failed = true;
+        }
+    }
+    parcBuffer_Clear(buffer);
+}
+
+/*
+ * Wait until the background thread has written `flushing`. The mutex must be held.
+ */
+static void
+_parcBufferedOutputStream_WaitForFlusher(PARCBufferedOutputStream *stream)
+{
+    while (stream->flushPending) {
+        pthread_cond_wait(&stream->flushDone, &stream->mutex);
+    }
+}
+
+/*
+ * Pass the bytes in `active` on to the underlying stream: directly, or by handing them to the background thread.
+ * The mutex must be held.
+ */
+static void
+_parcBufferedOutputStream_FlushActive(PARCBufferedOutputStream *stream)
+{
+    if (parcBuffer_Position(stream->active) == 0) {
+        return;
+    }
+
+    if (stream->background) {
+        _parcBufferedOutputStream_WaitForFlusher(stream);
+        PARCBuffer *full = stream->active;
+        stream->active = stream->flushing;
+        stream->flushing = full;
+        stream->flushPending = true;
+        pthread_cond_broadcast(&stream->flushRequested);
+    } else {
+        _parcBufferedOutputStream_WriteHeld(stream, stream->active, &stream->failed);
+    }
+}
+
+static void *
+_parcBufferedOutputStream_Flusher(void *arg)
+{
+    PARCBufferedOutputStream *stream = arg;
+
+    pthread_mutex_lock(&stream->mutex);
+    while (true) {
+        if (stream->flushPending) {
+            bool failed = false;
+            pthread_mutex_unlock(&stream->mutex);
+            _parcBufferedOutputStream_WriteHeld(stream, stream->flushing, &failed);
+            pthread_mutex_lock(&stream->mutex);
+
+            stream->failed |= failed;
+            stream->flushPending = false;
+            pthread_cond_broadcast(&stream->flushDone);
+            continue;
+        }
+        if (stream->stopping) {
+            break;
+        }
+
+        if (stream->maximumDelay > 0 && parcBuffer_Position(stream->active) > 0) {
+            uint64_t deadline = stream->activeSince + stream->maximumDelay;
+            if (parcTime_NowMicroseconds() >= deadline) {
+                _parcBufferedOutputStream_FlushActive(stream);
+            } else {
+                struct timespec time = { .tv_sec = deadline / 1000000, .tv_nsec = (deadline % 1000000) * 1000 };
+                pthread_cond_timedwait(&stream->flushRequested, &stream->mutex, &time);
+            }
+        } else {
+            pthread_cond_wait(&stream->flushRequested, &stream->mutex);
+        }
+    }
+    pthread_mutex_unlock(&stream->mutex);
+
+    return NULL;
+}
+
+static void
+_parcBufferedOutputStream_Finalize(PARCBufferedOutputStream **instancePtr)
+{
+    assertNotNull(instancePtr, "Parameter must be a non-null pointer to a PARCBufferedOutputStream pointer.");
+    PARCBufferedOutputStream *stream = *instancePtr;
+
+    parcBufferedOutputStream_Flush(stream);
+
+    if (stream->background) {
+        pthread_mutex_lock(&stream->mutex);
+        stream->stopping = true;
+        pthread_cond_broadcast(&stream->flushRequested);
+        pthread_mutex_unlock(&stream->mutex);
+        pthread_join(stream->flusher, NULL);
+    }
+
+    parcBuffer_Release(&stream->active);
+    if (stream->flushing != NULL) {
+        parcBuffer_Release(&stream->flushing);
+    }
+    parcOutputStream_Release(&stream->output);
+
+    pthread_cond_destroy(&stream->flushDone);
+    pthread_cond_destroy(&stream->flushRequested);
+    pthread_mutex_destroy(&stream->mutex);
+}
+
+parcObject_ImplementAcquire(parcBufferedOutputStream, PARCBufferedOutputStream);
+
+parcObject_ImplementRelease(parcBufferedOutputStream, PARCBufferedOutputStream);
+
+parcObject_ExtendPARCObject(PARCBufferedOutputStream, _parcBufferedOutputStream_Finalize, NULL, NULL, NULL, NULL, NULL, NULL);
+
+bool
+parcBufferedOutputStream_IsValid(const PARCBufferedOutputStream *instance)
+{
+    bool result = false;
+
+    if (instance != NULL) {
+        result = instance->output != NULL && instance->active != NULL;
+    }
+
+    return result;
+}
+
+void
+parcBufferedOutputStream_AssertValid(const PARCBufferedOutputStream *instance)
+{
+    assertTrue(parcBufferedOutputStream_IsValid(instance),
+               "PARCBufferedOutputStream is not valid.");
+}
+
+PARCBufferedOutputStream *
+parcBufferedOutputStream_Create(PARCOutputStream *output, size_t capacity, uint64_t maximumDelay, bool background)
+{
+    assertNotNull(output, "Parameter output must be a non-null PARCOutputStream pointer.");
+    trapIllegalValueIf(capacity == 0, "The capacity must be greater than zero");
+
+    PARCBufferedOutputStream *result = parcObject_CreateInstance(PARCBufferedOutputStream);
+    if (result == NULL) {
+        return NULL;
+    }
+
+    result->output = parcOutputStream_Acquire(output);
+    result->capacity = capacity;
+    result->maximumDelay = maximumDelay;
+    result->background = background;
+
+    pthread_mutex_init(&result->mutex, NULL);
+    pthread_cond_init(&result->flushRequested, NULL);
+    pthread_cond_init(&result->flushDone, NULL);
+
+    result->active = parcBuffer_Allocate(capacity);
+    result->activeSince = 0;
+    result->flushing = background ? parcBuffer_Allocate(capacity) : NULL;
+    result->flushPending = false;
+    result->failed = false;
+    result->stopping = false;
+
+    if (background && pthread_create(&result->flusher, NULL, _parcBufferedOutputStream_Flusher, result) != 0) {
+        result->background = false;
+    }
+
+    return result;
+}
+
+PARCOutputStream *
+parcBufferedOutputStream_AsOutputStream(PARCBufferedOutputStream *stream)
+{
+    return parcOutputStream_Create(parcBufferedOutputStream_Acquire(stream), PARCBufferedOutputStreamAsPARCOutputStream);
+}
+
+size_t
+parcBufferedOutputStream_Write(PARCBufferedOutputStream *stream, PARCBuffer *buffer)
+{
+    parcBufferedOutputStream_OptionalAssertValid(stream);
+
+    size_t length = parcBuffer_Remaining(buffer);
+    if (length == 0) {
+        return 0;
+    }
+
+    pthread_mutex_lock(&stream->mutex);
+
+    if (length >= stream->capacity) {
+        // Too large to be worth copying: write the held bytes and this buffer together.
+        if (stream->background) {
+            _parcBufferedOutputStream_WaitForFlusher(stream);
+        }
+        PARCBufferChain *chain = parcBufferChain_Create();
+        if (parcBuffer_Position(stream->active) > 0) {
+            parcBufferChain_Append(chain, parcBuffer_Flip(stream->active));
+        }
+        parcBufferChain_Append(chain, buffer);
+
+        size_t expected = parcBufferChain_Length(chain);
+        if (parcOutputStream_WriteBufferChain(stream->output, chain) != expected) {
+            stream->failed = true;
+        }
+        parcBufferChain_Release(&chain);
+
+        parcBuffer_Clear(stream->active);
+        parcBuffer_SetPosition(buffer, parcBuffer_Limit(buffer));
+    } else {
+        if (length > parcBuffer_Remaining(stream->active)) {
+            _parcBufferedOutputStream_FlushActive(stream);
+        }
+
+        uint64_t now = (stream->maximumDelay > 0) ? parcTime_NowMicroseconds() : 0;
+        if (parcBuffer_Position(stream->active) == 0) {
+            stream->activeSince = now;
+            if (stream->background && stream->maximumDelay > 0) {
+                pthread_cond_broadcast(&stream->flushRequested);
+            }
+        }
+        parcBuffer_PutArray(stream->active, length, parcBuffer_Overlay(buffer, length));
+
+        if (!stream->background && stream->maximumDelay > 0 && now - stream->activeSince >= stream->maximumDelay) {
+            _parcBufferedOutputStream_FlushActive(stream);
+        }
+    }
+
+    pthread_mutex_unlock(&stream->mutex);
+
+    return length;
+}
+
+bool
+parcBufferedOutputStream_Flush(PARCBufferedOutputStream *stream)
+{
+    parcBufferedOutputStream_OptionalAssertValid(stream);
+
+    pthread_mutex_lock(&stream->mutex);
+
+    _parcBufferedOutputStream_FlushActive(stream);
+    if (stream->background) {
+        _parcBufferedOutputStream_WaitForFlusher(stream);
+    }
+    bool result = !stream->failed;
+    stream->failed = false;
+
+    pthread_mutex_unlock(&stream->mutex);
+
+    return parcOutputStream_Flush(stream->output) && result;
+}
+
+size_t
+parcBufferedOutputStream_Pending(const PARCBufferedOutputStream *stream)
+{
+    parcBufferedOutputStream_OptionalAssertValid(stream);
+
+    PARCBufferedOutputStream *mutable = (PARCBufferedOutputStream *) stream;
+    pthread_mutex_lock(&mutable->mutex);
+    size_t result = parcBuffer_Position(stream->active);
+    if (stream->flushPending) {
+        result += parcBuffer_Position(stream->flushing);
+    }
+    pthread_mutex_unlock(&mutable->mutex);
+
+    return result;
+}
@@ -0,0 +1,246 @@
+/*
+ * Copyright (c) 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Patent rights are not granted under this agreement. Patent rights are
+ *       available under FRAND terms.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX or PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * @file parc_BufferedOutputStream.h
+ * @ingroup inputoutput
+ * @brief An output stream that collects small writes into a buffer and passes them on to another stream together.
+ *
+ * Writing many small records (log lines, exported records) straight to a `PARCFileOutputStream` costs a
+ * write(2) system call for each. A `PARCBufferedOutputStream` copies small writes into a buffer and writes the
+ * buffer to the underlying stream when it is full, when its oldest byte has been held for longer than a
+ * given delay, or when the stream is flushed (see `parcOutputStream_Flush`).
+ * A write at least as large as the buffer is not copied: it is passed on together with any buffered bytes
+ * as one `PARCBufferChain`, which a `PARCFileOutputStream` writes with a single writev(2).
+ *
+ * Optionally, the stream has two buffers and a background thread: while the thread writes one buffer to the
+ * underlying stream, writers fill the other. The thread also enforces the maximum delay when no writes arrive.
+ * Without it the delay is checked only when the stream is written to.
+ *
+ * A `PARCBufferedOutputStream` may be written to from any number of threads. Each write is kept contiguous.
+ * Releasing the last reference flushes the stream.
+ *
+ * @copyright 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC).  All rights reserved.
+ */
+#ifndef libparc_parc_BufferedOutputStream_h
+#define libparc_parc_BufferedOutputStream_h
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <parc/algol/parc_Buffer.h>
+#include <parc/algol/parc_OutputStream.h>
+
+struct PARCBufferedOutputStream;
+typedef struct PARCBufferedOutputStream PARCBufferedOutputStream;
+
+/**
+ * The mapping of a `PARCBufferedOutputStream` to the generic `PARCOutputStream`.
+ */
+extern PARCOutputStreamInterface *PARCBufferedOutputStreamAsPARCOutputStream;
+
+#ifdef PARCLibrary_DISABLE_VALIDATION
+#  define parcBufferedOutputStream_OptionalAssertValid(_instance_)
+#else
+#  define parcBufferedOutputStream_OptionalAssertValid(_instance_) parcBufferedOutputStream_AssertValid(_instance_)
+#endif
+
+/**
+ * Create a `PARCBufferedOutputStream` that writes to the given `PARCOutputStream`.
+ *
+ * @param [in] output A pointer to a valid `PARCOutputStream`. The buffered stream acquires a reference to it.
+ * @param [in] capacity The size of the buffer in bytes, which must be greater than zero.
+ * @param [in] maximumDelay The longest time, in microseconds, that a byte is held before it is written,
+ *                          or 0 to write only when the buffer is full or the stream is flushed.
+ * @param [in] background If true, the stream is double-buffered and written by a background thread.
+ *
+ * @return non-NULL A pointer to a valid PARCBufferedOutputStream instance.
+ * @return NULL An error occurred.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCFileOutputStream *file = parcFileOutputStream_Create(fd);
+ *     PARCOutputStream *fileOutput = parcFileOutputStream_AsOutputStream(file);
+ *
+ *     PARCBufferedOutputStream *buffered = parcBufferedOutputStream_Create(fileOutput, 65536, 100000, true);
+ *     PARCOutputStream *output = parcBufferedOutputStream_AsOutputStream(buffered);
+ *
+ *     parcOutputStream_WriteCString(output, "Hello World\n");
+ *
+ *     parcOutputStream_Release(&output);
+ *     parcBufferedOutputStream_Release(&buffered);
+ *     parcOutputStream_Release(&fileOutput);
+ *     parcFileOutputStream_Release(&file);
+ * }
+ * @endcode
+ */
+PARCBufferedOutputStream *parcBufferedOutputStream_Create(PARCOutputStream *output, size_t capacity, uint64_t maximumDelay, bool background);
+
+/**
+ * Convert an instance of `PARCBufferedOutputStream` to a `PARCOutputStream`.
+ *
+ * @param [in] stream A pointer to a valid PARCBufferedOutputStream instance.
+ *
+ * @return A new `PARCOutputStream` that writes to @p stream, which must be released by the caller.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCOutputStream *output = parcBufferedOutputStream_AsOutputStream(buffered);
+ *
+ *     parcOutputStream_Release(&output);
+ * }
+ * @endcode
+ */
+PARCOutputStream *parcBufferedOutputStream_AsOutputStream(PARCBufferedOutputStream *stream);
+
+/**
+ * Increase the number of references to a `PARCBufferedOutputStream` instance.
+ *
+ * @param [in] instance A pointer to a valid PARCBufferedOutputStream instance.
+ *
+ * @return The same value as @p instance.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCBufferedOutputStream *b = parcBufferedOutputStream_Acquire(a);
+ *
+ *     parcBufferedOutputStream_Release(&b);
+ * }
+ * @endcode
+ */
+PARCBufferedOutputStream *parcBufferedOutputStream_Acquire(const PARCBufferedOutputStream *instance);
+
+/**
+ * Release a previously acquired reference to the given `PARCBufferedOutputStream` instance,
+ * decrementing the reference count for the instance.
+ *
+ * The pointer to the instance is set to NULL as a side-effect of this function.
+ *
+ * If the invocation causes the last reference to the instance to be released,
+ * the buffered bytes are written, the background thread (if any) is stopped, and the instance is deallocated.
+ *
+ * @param [in,out] instancePtr A pointer to a pointer to the instance to release.
+ *
+ * Example:
+ * @code
+ * {
+ *     parcBufferedOutputStream_Release(&buffered);
+ * }
+ * @endcode
+ */
+void parcBufferedOutputStream_Release(PARCBufferedOutputStream **instancePtr);
+
+/**
+ * Determine if an instance of `PARCBufferedOutputStream` is valid.
+ *
+ * @param [in] instance A pointer to a `PARCBufferedOutputStream` instance.
+ *
+ * @return true The instance is valid.
+ * @return false The instance is not valid.
+ *
+ * Example:
+ * @code
+ * {
+ *     if (parcBufferedOutputStream_IsValid(buffered)) {
+ *         printf("Instance is valid.\n");
+ *     }
+ * }
+ * @endcode
+ */
+bool parcBufferedOutputStream_IsValid(const PARCBufferedOutputStream *instance);
+
+/**
+ * Assert that the given `PARCBufferedOutputStream` instance is valid.
+ *
+ * @param [in] instance A pointer to a valid PARCBufferedOutputStream instance.
+ *
+ * Example:
+ * @code
+ * {
+ *     parcBufferedOutputStream_AssertValid(buffered);
+ * }
+ * @endcode
+ */
+void parcBufferedOutputStream_AssertValid(const PARCBufferedOutputStream *instance);
+
+/**
+ * Write the remaining bytes of a `PARCBuffer` to the stream.
+ *
+ * The position of @p buffer is set to its limit as a side-effect.
+ *
+ * @param [in] stream A pointer to a valid PARCBufferedOutputStream instance.
+ * @param [in,out] buffer A pointer to the `PARCBuffer` whose remaining bytes are written.
+ *
+ * @return The number of bytes accepted.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCBuffer *line = parcBuffer_WrapCString("Hello World\n");
+ *     parcBufferedOutputStream_Write(buffered, line);
+ *     parcBuffer_Release(&line);
+ * }
+ * @endcode
+ */
+size_t parcBufferedOutputStream_Write(PARCBufferedOutputStream *stream, PARCBuffer *buffer);
+
+/**
+ * Write every buffered byte to the underlying stream, and flush the underlying stream.
+ *
+ * @param [in] stream A pointer to a valid PARCBufferedOutputStream instance.
+ *
+ * @return true Every byte written to @p stream has been written to the underlying stream.
+ * @return false A write to the underlying stream failed, now or since the stream was last flushed.
+ *
+ * Example:
+ * @code
+ * {
+ *     parcBufferedOutputStream_Flush(buffered);
+ * }
+ * @endcode
+ */
+bool parcBufferedOutputStream_Flush(PARCBufferedOutputStream *stream);
+
+/**
+ * Return the number of bytes that have been written to the stream but not yet to the underlying stream.
+ *
+ * @param [in] stream A pointer to a valid PARCBufferedOutputStream instance.
+ *
+ * @return The number of bytes held.
+ *
+ * Example:
+ * @code
+ * {
+ *     size_t held = parcBufferedOutputStream_Pending(buffered);
+ * }
+ * @endcode
+ */
+size_t parcBufferedOutputStream_Pending(const PARCBufferedOutputStream *stream);
+#endif // libparc_parc_BufferedOutputStream_h
@@ -33,6 +33,8 @@
 #include <stdio.h>
 #include <ctype.h>
 #include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
 
 #include <LongBow/runtime.h>
 
@@ -46,6 +48,10 @@ struct parc_byte_array {
     uint8_t *array;
     size_t length;
     void (*freeFunction)(void **);
+
+    // Non-NULL only for a file mapping: the page aligned start and length of the mapped region.
+    void *mapping;
+    size_t mappingLength;
 };
 #define MAGIC 0x0ddba11c1a55e5
 
@@ -55,11 +61,21 @@ _trapIfOutOfBounds(const PARCByteArray *array, const size_t index)
     trapOutOfBoundsIf(index >= array->length, "parcByteArray index %zd exceeds the length %zd", index, array->length);
 }
 
+static inline void
+_trapIfMapped(const PARCByteArray *array)
+{
+    trapUnexpectedStateIf(array->mapping != NULL, "PARCByteArray@%p is a read-only file mapping and cannot be modified", (void *) array);
+}
+
 static bool
 _parcByteArray_Destructor(PARCByteArray **byteArrayPtr)
 {
     PARCByteArray *byteArray = *byteArrayPtr;
 
+    if (byteArray->mapping != NULL) {
+        munmap(byteArray->mapping, byteArray->mappingLength);
+    }
+
     if (byteArray->freeFunction != NULL) {
         if (byteArray->array != NULL) {
             byteArray->freeFunction((void **) &(byteArray->array));
@@ -113,6 +129,8 @@ parcByteArray_Allocate(const size_t length)
         result->array = array;
         result->length = length;
         result->freeFunction = parcMemory_DeallocateImpl;
+        result->mapping = NULL;
+        result->mappingLength = 0;
         return result;
     } else {
         parcMemory_Deallocate(&array);
@@ -129,12 +147,101 @@ parcByteArray_Wrap(const size_t length, uint8_t array[length])
             result->array = array;
             result->length = length;
             result->freeFunction = NULL;
+            result->mapping = NULL;
+            result->mappingLength = 0;
             return result;
         }
     }
     return NULL;
 }
 
+PARCByteArray *
+parcByteArray_MapFile(int fileDescriptor, size_t offset, size_t length)
+{
+    if (length == 0) {
+        return parcByteArray_Allocate(0);
+    }
+
+    // mmap requires a page aligned offset, so map from the start of the page containing `offset`.
+    size_t pageSize = (size_t) sysconf(_SC_PAGESIZE);
+    size_t slack = offset % pageSize;
+
+    void *mapping = mmap(NULL, length + slack, PROT_READ, MAP_PRIVATE, fileDescriptor, (off_t) (offset - slack));
+    if (mapping == MAP_FAILED) {
+        return NULL;
+    }
+
+    PARCByteArray *result = parcObject_CreateInstance(PARCByteArray);
+    if (result == NULL) {
+        munmap(mapping, length + slack);
+        return NULL;
+    }
+
+    result->array = (uint8_t *) mapping + slack;
+    result->length = length;
+    result->freeFunction = NULL;
+    result->mapping = mapping;
+    result->mappingLength = length + slack;
+
+    return result;
+}
+
+bool
+parcByteArray_IsMapped(const PARCByteArray *byteArray)
+{
+    parcByteArray_OptionalAssertValid(byteArray);
+
+    return byteArray->mapping != NULL;
+}
+
+static int
+_parcByteArray_AdviceToMadvise(PARCByteArrayAdvice advice)
+{
+    switch (advice) {
+        case PARCByteArrayAdvice_Sequential:
+            return MADV_SEQUENTIAL;
+        case PARCByteArrayAdvice_Random:
+            return MADV_RANDOM;
+        case PARCByteArrayAdvice_WillNeed:
+            return MADV_WILLNEED;
+        case PARCByteArrayAdvice_DontNeed:
+            return MADV_DONTNEED;
+        case PARCByteArrayAdvice_Normal:
+        default:
+            return MADV_NORMAL;
+    }
+}
+
+bool
+parcByteArray_Advise(const PARCByteArray *byteArray, size_t index, size_t length, PARCByteArrayAdvice advice)
+{
+    parcByteArray_OptionalAssertValid(byteArray);
+    trapOutOfBoundsIf(index + length > byteArray->length,
+                      "parcByteArray range [%zd, %zd) exceeds the length %zd", index, index + length, byteArray->length);
+
+    if (byteArray->mapping == NULL || length == 0) {
+        return true;
+    }
+
+    // madvise requires a page aligned address.
+    // Advice to discard pages applies only to the whole pages inside the range, so that bytes outside it
+    // (which other slices of the array may be using) are never dropped; any other advice covers the pages the range touches.
+    uintptr_t pageSize = (uintptr_t) sysconf(_SC_PAGESIZE);
+    uintptr_t start = (uintptr_t) &byteArray->array[index];
+    uintptr_t end = start + length;
+    if (advice == PARCByteArrayAdvice_DontNeed) {
+        start = (start + pageSize - 1) - ((start + pageSize - 1) % pageSize);
+        end = end - (end % pageSize);
+        if (start >= end) {
+            return true;
+        }
+    } else {
+        start = start - (start % pageSize);
+    }
+
+    return madvise((void *) start, end - start, _parcByteArray_AdviceToMadvise(advice)) == 0;
+}
+
 parcObject_ImplementAcquire(parcByteArray, PARCByteArray);
 
 parcObject_ImplementRelease(parcByteArray, PARCByteArray);
@@ -161,10 +268,37 @@ parcByteArray_Capacity(const PARCByteArray *byteArray)
     return byteArray->length;
 }
 
+bool
+parcByteArray_Reallocate(PARCByteArray *byteArray, size_t newLength)
+{
+    parcByteArray_OptionalAssertValid(byteArray);
+
+    if (byteArray->freeFunction != parcMemory_DeallocateImpl || parcObject_GetReferenceCount(byteArray) != 1) {
+        return false;
+    }
+    if (newLength == 0) {
+        return false;
+    }
+
+    uint8_t *array = parcMemory_Reallocate(byteArray->array, newLength);
+    if (array == NULL) {
+        return false;
+    }
+
+    if (newLength > byteArray->length) {
+        memset(&array[byteArray->length], 0, newLength - byteArray->length);
+    }
+    byteArray->array = array;
+    byteArray->length = newLength;
+
+    return true;
+}
+
 PARCByteArray *
 parcByteArray_PutByte(PARCByteArray *result, size_t index, uint8_t byte)
 {
     parcByteArray_OptionalAssertValid(result);
+    _trapIfMapped(result);
     _trapIfOutOfBounds(result, index);
 
     result->array[index] = byte;
@@ -225,6 +359,7 @@ PARCByteArray *
 parcByteArray_PutBytes(PARCByteArray *result, size_t offset, size_t length, const uint8_t source[length])
 {
     parcByteArray_OptionalAssertValid(result);
+    _trapIfMapped(result);
     trapOutOfBoundsIf(offset > result->length,
                       "The offset (%zd) exeeds the length (%zd) of the PARCByteArray.", offset, result->length);
 
@@ -253,6 +388,7 @@ PARCByteArray *
 parcByteArray_ArrayCopy(PARCByteArray *destination, size_t destOffset, const PARCByteArray *source, size_t srcOffset, size_t length)
 {
     parcByteArray_OptionalAssertValid(destination);
+    _trapIfMapped(destination);
     parcByteArray_OptionalAssertValid(source);
 
     memcpy(&destination->array[destOffset], &source->array[srcOffset], length);
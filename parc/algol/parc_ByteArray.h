@@ -68,14 +68,17 @@
  * Instances of `PARCByteArray` are created either by dynamically allocating the byte array,
  * via `parcByteArray_Allocate()`,
  * or by wrapping a static `uint8_t` array,
- * via `parcByteArray_Wrap()`.
+ * via `parcByteArray_Wrap()`,
+ * or by mapping a region of a file into memory,
+ * via `parcByteArray_MapFile()`.
  *
  * New references to an existing instance of `PARCByteArray` are created via `parcByteArray_Acquire()`.
  *
  * A `PARCByteArray` reference is released via `parcByteArray_Release`.
  * Only the last invocation will deallocated the `PARCByteArray`.
  * If the `PARCByteArray` references dynamically allocated memory,
- * that memory is freed with the `PARCByteArray` when the last reference is released.
+ * that memory is freed with the `PARCByteArray` when the last reference is released,
+ * and if it references a file mapping, the mapping is removed.
  *
  * @author Glenn Scott, Palo Alto Research Center (Xerox PARC)
  * @copyright 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC).  All rights reserved.
@@ -102,6 +105,19 @@ struct parc_byte_array;
  */
 typedef struct parc_byte_array PARCByteArray;
 
+/**
+ * Hints about how the memory of a `PARCByteArray` will be accessed.
+ *
+ * @see parcByteArray_Advise
+ */
+typedef enum {
+    PARCByteArrayAdvice_Normal,     /**< No particular access pattern. */
+    PARCByteArrayAdvice_Sequential, /**< Bytes will be accessed in increasing order, so read ahead aggressively. */
+    PARCByteArrayAdvice_Random,     /**< Bytes will be accessed in random order, so do not read ahead. */
+    PARCByteArrayAdvice_WillNeed,   /**< Bytes will be accessed soon, so start reading them in now. */
+    PARCByteArrayAdvice_DontNeed    /**< Bytes will not be accessed soon, so their pages may be reclaimed. */
+} PARCByteArrayAdvice;
+
 /**
  * Assert that an instance of `PARCByteArray` is valid.
  *
@@ -172,6 +188,92 @@ PARCByteArray *parcByteArray_Allocate(const size_t capacity);
  */
 PARCByteArray *parcByteArray_Wrap(size_t capacity, uint8_t array[capacity]);
 
+/**
+ * Create a `PARCByteArray` over a region of a file mapped into memory.
+ *
+ * Nothing is read until the bytes are accessed, and pages are read in by the operating system on demand.
+ * The mapping is read-only: the `parcByteArray_Put` functions and `parcByteArray_ArrayCopy` trap
+ * when given a mapped `PARCByteArray`, and nothing is ever written to the file.
+ * The mapping remains valid after `fileDescriptor` is closed,
+ * and is removed when the last reference to the `PARCByteArray` is released.
+ *
+ * The file must not be truncated while it is mapped.
+ *
+ * @param [in] fileDescriptor A file descriptor open for reading.
+ * @param [in] offset The offset in the file of the first byte of the region. It need not be page aligned.
+ * @param [in] length The length of the region.
+ *
+ * @return NULL The region could not be mapped.
+ * @return non-NULL A pointer to a `PARCByteArray` instance which must be released via {@link parcByteArray_Release()}.
+ *
+ * Example:
+ * @code
+ * {
+ *     int fd = open("content.bin", O_RDONLY);
+ *     struct stat statbuf;
+ *     fstat(fd, &statbuf);
+ *
+ *     PARCByteArray *byteArray = parcByteArray_MapFile(fd, 0, statbuf.st_size);
+ *     close(fd);
+ *
+ *     parcByteArray_Release(&byteArray);
+ * }
+ * @endcode
+ *
+ * @see parcByteArray_Advise
+ */
+PARCByteArray *parcByteArray_MapFile(int fileDescriptor, size_t offset, size_t length);
+
+/**
+ * Determine if a `PARCByteArray` is backed by a file mapping.
+ *
+ * @param [in] byteArray A pointer to a valid `PARCByteArray` instance.
+ *
+ * @return true The `PARCByteArray` was created by {@link parcByteArray_MapFile}.
+ * @return false The `PARCByteArray` is backed by allocated or wrapped memory.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCByteArray *byteArray = parcByteArray_Allocate(10);
+ *
+ *     bool mapped = parcByteArray_IsMapped(byteArray); // false
+ *
+ *     parcByteArray_Release(&byteArray);
+ * }
+ * @endcode
+ */
+bool parcByteArray_IsMapped(const PARCByteArray *byteArray);
+
+/**
+ * Advise the operating system how a range of a file-mapped `PARCByteArray` will be accessed.
+ *
+ * The advice is only a hint and has no effect on the contents of the array.
+ * `PARCByteArrayAdvice_DontNeed` applies only to the whole pages inside the range,
+ * while other advice applies to every page the range touches.
+ * For a `PARCByteArray` that is not backed by a file mapping this function does nothing.
+ *
+ * @param [in] byteArray A pointer to a valid `PARCByteArray` instance.
+ * @param [in] index The index of the first byte of the range.
+ * @param [in] length The number of bytes in the range.
+ * @param [in] advice The expected access pattern.
+ *
+ * @return true The advice was accepted, or the `PARCByteArray` is not a file mapping.
+ * @return false The operating system rejected the advice.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCByteArray *byteArray = parcByteArray_MapFile(fd, 0, length);
+ *
+ *     parcByteArray_Advise(byteArray, 0, length, PARCByteArrayAdvice_Sequential);
+ *
+ *     parcByteArray_Release(&byteArray);
+ * }
+ * @endcode
+ */
+bool parcByteArray_Advise(const PARCByteArray *byteArray, size_t index, size_t length, PARCByteArrayAdvice advice);
+
 /**
  * Returns the pointer to the `uint8_t` array that backs this `PARCByteArray`.
  *
@@ -449,6 +551,34 @@ PARCByteArray *parcByteArray_ArrayCopy(PARCByteArray *destination, size_t destOf
  */
 size_t parcByteArray_Capacity(const PARCByteArray *byteArray);
 
+/**
+ * Change the capacity of a `PARCByteArray` in place.
+ *
+ * Only a `PARCByteArray` that owns its backing store (one created by `parcByteArray_Allocate`)
+ * and is referenced exactly once can be resized this way,
+ * because the backing store may move and any outstanding pointer to it would be left dangling.
+ * Bytes added to the end of the array are zero.
+ *
+ * @param [in,out] byteArray A pointer to a valid `PARCByteArray` instance.
+ * @param [in] newLength The new capacity of the array.
+ *
+ * @return true The backing store was resized.
+ * @return false The array cannot be resized in place, or memory could not be allocated. The array is unchanged.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCByteArray *byteArray = parcByteArray_Allocate(10);
+ *
+ *     if (parcByteArray_Reallocate(byteArray, 20)) {
+ *         // parcByteArray_Capacity(byteArray) == 20
+ *     }
+ *     parcByteArray_Release(&byteArray);
+ * }
+ * @endcode
+ */
+bool parcByteArray_Reallocate(PARCByteArray *byteArray, size_t newLength);
+
 /**
  * Create a copy of an existing `PARCByteArray`.
  *
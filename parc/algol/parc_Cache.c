@@ -0,0 +1,455 @@
+/*
+ * Copyright (c) 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Patent rights are not granted under this agreement. Patent rights are
+ *       available under FRAND terms.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX or PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * @copyright 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC).  All rights reserved.
+ */
+#include <config.h>
+
+#include <inttypes.h>
+
+#include <LongBow/runtime.h>
+
+#include <parc/algol/parc_Cache.h>
+#include <parc/algol/parc_Memory.h>
+#include <parc/algol/parc_DisplayIndented.h>
+
+typedef struct parc_cache_entry {
+    PARCObject *key;
+    PARCObject *value;
+    PARCHashCode hashCode;
+
+    // The clock time at which the entry expires, or 0 if it never does.
+    uint64_t expiration;
+
+    // The CLOCK second chance bit, set when the entry is read.
+    bool referenced;
+
+    // The next entry in the same hash bucket.
+    struct parc_cache_entry *chain;
+
+    // The neighbours of this entry in the CLOCK ring.
+    struct parc_cache_entry *previous;
+    struct parc_cache_entry *next;
+} _PARCCacheEntry;
+
+struct PARCCache {
+    size_t capacity;
+    size_t size;
+    size_t bucketMask;
+    _PARCCacheEntry **buckets;
+    _PARCCacheEntry *hand;
+    PARCClock *clock;
+
+    PARCCacheEvictionCallback *evictionCallback;
+    void *evictionContext;
+
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t evictions;
+    uint64_t expirations;
+};
+
+static inline size_t
+_parcCache_BucketIndex(const PARCCache *cache, PARCHashCode hashCode)
+{
+    return (size_t) hashCode & cache->bucketMask;
+}
+
+static _PARCCacheEntry *
+_parcCache_Find(const PARCCache *cache, const PARCObject *key, PARCHashCode hashCode)
+{
+    _PARCCacheEntry *entry = cache->buckets[_parcCache_BucketIndex(cache, hashCode)];
+    while (entry != NULL) {
+        if (entry->hashCode == hashCode && parcObject_Equals(entry->key, key)) {
+            break;
+        }
+        entry = entry->chain;
+    }
+    return entry;
+}
+
+static bool
+_parcCache_IsExpired(const PARCCache *cache, const _PARCCacheEntry *entry)
+{
+    return entry->expiration != 0 && parcClock_GetTime(cache->clock) >= entry->expiration;
+}
+
+/*
+ * Remove the entry from its hash bucket and the CLOCK ring, advancing the hand past it if necessary.
+ */
+static void
+_parcCache_Unlink(PARCCache *cache, _PARCCacheEntry *entry)
+{
+    _PARCCacheEntry **link = &cache->buckets[_parcCache_BucketIndex(cache, entry->hashCode)];
+    while (*link != entry) {
+        link = &(*link)->chain;
+    }
+    *link = entry->chain;
+
+    if (entry->next == entry) {
+        cache->hand = NULL;
+    } else {
+        if (cache->hand == entry) {
+            cache->hand = entry->next;
+        }
+        entry->previous->next = entry->next;
+        entry->next->previous = entry->previous;
+    }
+
+    cache->size--;
+}
+
+/*
+ * Link the entry into its hash bucket, and into the CLOCK ring immediately behind the hand
+ * so that it is the last entry the hand will consider.
+ */
+static void
+_parcCache_Link(PARCCache *cache, _PARCCacheEntry *entry)
+{
+    size_t index = _parcCache_BucketIndex(cache, entry->hashCode);
+    entry->chain = cache->buckets[index];
+    cache->buckets[index] = entry;
+
+    if (cache->hand == NULL) {
+        entry->previous = entry;
+        entry->next = entry;
+        cache->hand = entry;
+    } else {
+        entry->next = cache->hand;
+        entry->previous = cache->hand->previous;
+        entry->previous->next = entry;
+        cache->hand->previous = entry;
+    }
+
+    cache->size++;
+}
+
+static void
+_parcCache_ReleaseEntryContents(_PARCCacheEntry *entry)
+{
+    parcObject_Release(&entry->key);
+    parcObject_Release(&entry->value);
+}
+
+static void
+_parcCache_Evict(PARCCache *cache, _PARCCacheEntry *entry, PARCCacheEvictionReason reason)
+{
+    if (reason == PARCCacheEvictionReason_Expired) {
+        cache->expirations++;
+    } else {
+        cache->evictions++;
+    }
+
+    if (cache->evictionCallback != NULL) {
+        cache->evictionCallback(entry->key, entry->value, reason, cache->evictionContext);
+    }
+
+    _parcCache_Unlink(cache, entry);
+    _parcCache_ReleaseEntryContents(entry);
+}
+
+/*
+ * Advance the clock hand to a victim, evict it, and return its (now empty) entry for reuse.
+ * Each referenced entry the hand passes loses its second chance, so this terminates within two sweeps.
+ */
+static _PARCCacheEntry *
+_parcCache_EvictOne(PARCCache *cache)
+{
+    for (;;) {
+        _PARCCacheEntry *candidate = cache->hand;
+
+        if (_parcCache_IsExpired(cache, candidate)) {
+            _parcCache_Evict(cache, candidate, PARCCacheEvictionReason_Expired);
+            return candidate;
+        }
+        if (!candidate->referenced) {
+            _parcCache_Evict(cache, candidate, PARCCacheEvictionReason_Capacity);
+            return candidate;
+        }
+        candidate->referenced = false;
+        cache->hand = candidate->next;
+    }
+}
+
+static void
+_parcCache_RemoveAll(PARCCache *cache)
+{
+    while (cache->hand != NULL) {
+        _PARCCacheEntry *entry = cache->hand;
+        _parcCache_Unlink(cache, entry);
+        _parcCache_ReleaseEntryContents(entry);
+        parcMemory_Deallocate((void **) &entry);
+    }
+}
+
+static void
+_parcCache_Finalize(PARCCache **instancePtr)
+{
+    assertNotNull(instancePtr, "Parameter must be a non-null pointer to a PARCCache pointer.");
+    PARCCache *cache = *instancePtr;
+
+    _parcCache_RemoveAll(cache);
+    parcMemory_Deallocate((void **) &cache->buckets);
+    parcClock_Release(&cache->clock);
+}
+
+parcObject_ImplementAcquire(parcCache, PARCCache);
+
+parcObject_ImplementRelease(parcCache, PARCCache);
+
+parcObject_ExtendPARCObject(PARCCache, _parcCache_Finalize, NULL, NULL, NULL, NULL, NULL, NULL);
+
+void
+parcCache_AssertValid(const PARCCache *instance)
+{
+    assertTrue(parcCache_IsValid(instance),
+               "PARCCache is not valid.");
+}
+
+bool
+parcCache_IsValid(const PARCCache *instance)
+{
+    bool result = false;
+
+    if (instance != NULL) {
+        if (instance->size <= instance->capacity && instance->buckets != NULL && instance->clock != NULL) {
+            result = (instance->size == 0) == (instance->hand == NULL);
+        }
+    }
+
+    return result;
+}
+
+PARCCache *
+parcCache_CreateWithClock(size_t capacity, const PARCClock *clock)
+{
+    trapIllegalValueIf(capacity == 0, "The capacity of a PARCCache must be greater than zero.");
+    assertNotNull(clock, "Parameter clock must be a non-null pointer to a PARCClock.");
+
+    PARCCache *result = parcObject_CreateInstance(PARCCache);
+
+    if (result != NULL) {
+        // Size the index so that a full cache has a load factor of at most one.
+        size_t bucketCount = 1;
+        while (bucketCount < capacity) {
+            bucketCount <<= 1;
+        }
+
+        result->buckets = parcMemory_AllocateAndClear(bucketCount * sizeof(_PARCCacheEntry *));
+        assertNotNull(result->buckets, "parcMemory_AllocateAndClear(%zu) returned NULL", bucketCount * sizeof(_PARCCacheEntry *));
+        result->bucketMask = bucketCount - 1;
+        result->capacity = capacity;
+        result->size = 0;
+        result->hand = NULL;
+        result->clock = parcClock_Acquire(clock);
+        result->evictionCallback = NULL;
+        result->evictionContext = NULL;
+        result->hits = 0;
+        result->misses = 0;
+        result->evictions = 0;
+        result->expirations = 0;
+    }
+
+    return result;
+}
+
+PARCCache *
+parcCache_Create(size_t capacity)
+{
+    PARCClock *clock = parcClock_Monotonic();
+    PARCCache *result = parcCache_CreateWithClock(capacity, clock);
+    parcClock_Release(&clock);
+
+    return result;
+}
+
+void
+parcCache_Display(const PARCCache *instance, int indentation)
+{
+    parcDisplayIndented_PrintLine(indentation, "PARCCache@%p {", instance);
+    parcDisplayIndented_PrintLine(indentation + 1, ".size=%zu, .capacity=%zu", instance->size, instance->capacity);
+    parcDisplayIndented_PrintLine(indentation + 1, ".hits=%" PRIu64 ", .misses=%" PRIu64 ", .evictions=%" PRIu64 ", .expirations=%" PRIu64,
+                                  instance->hits, instance->misses, instance->evictions, instance->expirations);
+    parcDisplayIndented_PrintLine(indentation, "}");
+}
+
+void
+parcCache_SetEvictionCallback(PARCCache *cache, PARCCacheEvictionCallback *callback, void *context)
+{
+    parcCache_OptionalAssertValid(cache);
+
+    cache->evictionCallback = callback;
+    cache->evictionContext = context;
+}
+
+PARCCache *
+parcCache_PutWithTimeToLive(PARCCache *cache, const PARCObject *key, const PARCObject *value, uint64_t timeToLive)
+{
+    parcCache_OptionalAssertValid(cache);
+    assertNotNull(key, "The key must be a non-null pointer to a PARCObject.");
+    assertNotNull(value, "The value must be a non-null pointer to a PARCObject.");
+
+    uint64_t expiration = 0;
+    if (timeToLive != 0) {
+        // A very large lifetime, such as UINT64_MAX, must not wrap around into the past.
+        uint64_t now = parcClock_GetTime(cache->clock);
+        expiration = (timeToLive < UINT64_MAX - 1 - now) ? now + timeToLive : UINT64_MAX - 1;
+    }
+    PARCHashCode hashCode = parcObject_HashCode(key);
+
+    _PARCCacheEntry *entry = _parcCache_Find(cache, key, hashCode);
+    if (entry != NULL) {
+        PARCObject *oldValue = entry->value;
+        entry->value = parcObject_Acquire(value);
+        parcObject_Release(&oldValue);
+        entry->expiration = expiration;
+        entry->referenced = true;
+    } else {
+        if (cache->size == cache->capacity) {
+            entry = _parcCache_EvictOne(cache);
+        } else {
+            entry = parcMemory_Allocate(sizeof(_PARCCacheEntry));
+            assertNotNull(entry, "parcMemory_Allocate(%zu) returned NULL", sizeof(_PARCCacheEntry));
+        }
+
+        entry->key = parcObject_Acquire(key);
+        entry->value = parcObject_Acquire(value);
+        entry->hashCode = hashCode;
+        entry->expiration = expiration;
+        entry->referenced = false;
+        _parcCache_Link(cache, entry);
+    }
+
+    return cache;
+}
+
+PARCCache *
+parcCache_Put(PARCCache *cache, const PARCObject *key, const PARCObject *value)
+{
+    return parcCache_PutWithTimeToLive(cache, key, value, 0);
+}
+
+const PARCObject *
+parcCache_Get(PARCCache *cache, const PARCObject *key)
+{
+    parcCache_OptionalAssertValid(cache);
+
+    const PARCObject *result = NULL;
+
+    _PARCCacheEntry *entry = _parcCache_Find(cache, key, parcObject_HashCode(key));
+    if (entry != NULL) {
+        if (_parcCache_IsExpired(cache, entry)) {
+            _parcCache_Evict(cache, entry, PARCCacheEvictionReason_Expired);
+            parcMemory_Deallocate((void **) &entry);
+        } else {
+            entry->referenced = true;
+            result = entry->value;
+        }
+    }
+
+    if (result != NULL) {
+        cache->hits++;
+    } else {
+        cache->misses++;
+    }
+
+    return result;
+}
+
+bool
+parcCache_Remove(PARCCache *cache, const PARCObject *key)
+{
+    parcCache_OptionalAssertValid(cache);
+
+    bool result = false;
+
+    _PARCCacheEntry *entry = _parcCache_Find(cache, key, parcObject_HashCode(key));
+    if (entry != NULL) {
+        _parcCache_Unlink(cache, entry);
+        _parcCache_ReleaseEntryContents(entry);
+        parcMemory_Deallocate((void **) &entry);
+        result = true;
+    }
+
+    return result;
+}
+
+void
+parcCache_Clear(PARCCache *cache)
+{
+    parcCache_OptionalAssertValid(cache);
+
+    _parcCache_RemoveAll(cache);
+}
+
+size_t
+parcCache_Size(const PARCCache *cache)
+{
+    parcCache_OptionalAssertValid(cache);
+
+    return cache->size;
+}
+
+size_t
+parcCache_Capacity(const PARCCache *cache)
+{
+    parcCache_OptionalAssertValid(cache);
+
+    return cache->capacity;
+}
+
+uint64_t
+parcCache_GetHits(const PARCCache *cache)
+{
+    parcCache_OptionalAssertValid(cache);
+
+    return cache->hits;
+}
+
+uint64_t
+parcCache_GetMisses(const PARCCache *cache)
+{
+    parcCache_OptionalAssertValid(cache);
+
+    return cache->misses;
+}
+
+uint64_t
+parcCache_GetEvictions(const PARCCache *cache)
+{
+    parcCache_OptionalAssertValid(cache);
+
+    return cache->evictions;
+}
+
+uint64_t
+parcCache_GetExpirations(const PARCCache *cache)
+{
+    parcCache_OptionalAssertValid(cache);
+
+    return cache->expirations;
+}
@@ -0,0 +1,511 @@
+/*
+ * Copyright (c) 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Patent rights are not granted under this agreement. Patent rights are
+ *       available under FRAND terms.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX or PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * @file parc_Cache.h
+ * @ingroup datastructures
+ * @brief A bounded key/value cache with CLOCK eviction and optional per-entry time-to-live.
+ *
+ * A `PARCCache` holds at most a fixed number of entries.
+ * When a new entry is put into a full cache, an existing entry is evicted using the CLOCK
+ * (second chance) policy: entries are kept in a ring swept by a clock hand, each entry
+ * carries a referenced bit that is set when the entry is read, and the hand evicts the first
+ * entry it finds whose bit is clear, clearing the bits it passes over.
+ * This approximates least-recently-used eviction with O(1) amortised cost and
+ * without reordering a list on every read.
+ *
+ * Entries may be given a time-to-live, measured in the units of the cache's `PARCClock`
+ * (milliseconds for `parcClock_Monotonic()`).
+ * Expired entries are never returned and are removed when they are next looked up.
+ * Eviction does not search for expired entries: the clock hand still sweeps in order,
+ * but an expired entry it reaches is evicted even if its referenced bit is set.
+ * Supplying `parcClock_Counter()` or a custom clock makes expiry deterministic for testing.
+ *
+ * Lookup, insertion, removal and eviction are all O(1) (amortised for eviction).
+ *
+ * A `PARCCache` is not thread-safe, see `PARCConcurrentCache` for a lock-striped variant.
+ *
+ * @copyright 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC).  All rights reserved.
+ */
+#ifndef libparc_parc_Cache_h
+#define libparc_parc_Cache_h
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <parc/algol/parc_Object.h>
+#include <parc/algol/parc_Clock.h>
+
+struct PARCCache;
+typedef struct PARCCache PARCCache;
+
+#ifdef PARCLibrary_DISABLE_VALIDATION
+#  define parcCache_OptionalAssertValid(_instance_)
+#else
+#  define parcCache_OptionalAssertValid(_instance_) parcCache_AssertValid(_instance_)
+#endif
+
+/**
+ * @typedef PARCCacheEvictionReason
+ * @brief The reason an entry was evicted from a `PARCCache`.
+ */
+typedef enum {
+    PARCCacheEvictionReason_Capacity, /**< The entry was evicted to make room for a new entry. */
+    PARCCacheEvictionReason_Expired   /**< The entry's time-to-live elapsed. */
+} PARCCacheEvictionReason;
+
+/**
+ * A function called when an entry is evicted from a `PARCCache`.
+ *
+ * The callback is invoked before the cache releases its references to the key and value.
+ * It is not invoked for entries removed by `parcCache_Remove`, replaced by a subsequent put,
+ * or discarded by `parcCache_Clear` or when the cache is released.
+ * The callback must not modify the cache.
+ *
+ * @param [in] key The key of the evicted entry.
+ * @param [in] value The value of the evicted entry.
+ * @param [in] reason Why the entry was evicted.
+ * @param [in] context The context pointer given to `parcCache_SetEvictionCallback`.
+ */
+typedef void (PARCCacheEvictionCallback)(const PARCObject *key, const PARCObject *value, PARCCacheEvictionReason reason, void *context);
+
+/**
+ * Create a `PARCCache` holding at most @p capacity entries, with time-to-live measured by `parcClock_Monotonic()`.
+ *
+ * @param [in] capacity The maximum number of entries. Must be greater than zero.
+ *
+ * @return non-NULL A pointer to a valid PARCCache instance.
+ * @return NULL An error occurred.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCCache *cache = parcCache_Create(1000);
+ *
+ *     parcCache_Release(&cache);
+ * }
+ * @endcode
+ */
+PARCCache *parcCache_Create(size_t capacity);
+
+/**
+ * Create a `PARCCache` holding at most @p capacity entries, with time-to-live measured by the given `PARCClock`.
+ *
+ * The cache acquires its own reference to the clock.
+ *
+ * @param [in] capacity The maximum number of entries. Must be greater than zero.
+ * @param [in] clock A pointer to a valid PARCClock instance.
+ *
+ * @return non-NULL A pointer to a valid PARCCache instance.
+ * @return NULL An error occurred.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCClock *clock = parcClock_Counter();
+ *     PARCCache *cache = parcCache_CreateWithClock(1000, clock);
+ *     parcClock_Release(&clock);
+ *
+ *     parcCache_Release(&cache);
+ * }
+ * @endcode
+ */
+PARCCache *parcCache_CreateWithClock(size_t capacity, const PARCClock *clock);
+
+/**
+ * Increase the number of references to a `PARCCache` instance.
+ *
+ * Note that a new `PARCCache` is not created,
+ * only that the given `PARCCache` reference count is incremented.
+ * Discard the reference by invoking `parcCache_Release`.
+ *
+ * @param [in] instance A pointer to a valid PARCCache instance.
+ *
+ * @return The same value as @p instance.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCCache *a = parcCache_Create(10);
+ *
+ *     PARCCache *b = parcCache_Acquire(a);
+ *
+ *     parcCache_Release(&a);
+ *     parcCache_Release(&b);
+ * }
+ * @endcode
+ */
+PARCCache *parcCache_Acquire(const PARCCache *instance);
+
+/**
+ * Release a previously acquired reference to the given `PARCCache` instance,
+ * decrementing the reference count for the instance.
+ *
+ * The pointer to the instance is set to NULL as a side-effect of this function.
+ *
+ * If the invocation causes the last reference to the instance to be released,
+ * the instance is deallocated and the references it holds to its keys and values are released.
+ *
+ * @param [in,out] instancePtr A pointer to a pointer to the instance to release.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCCache *a = parcCache_Create(10);
+ *
+ *     parcCache_Release(&a);
+ * }
+ * @endcode
+ */
+void parcCache_Release(PARCCache **instancePtr);
+
+/**
+ * Determine if an instance of `PARCCache` is valid.
+ *
+ * @param [in] instance A pointer to a PARCCache instance.
+ *
+ * @return true The instance is valid.
+ * @return false The instance is not valid.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCCache *a = parcCache_Create(10);
+ *
+ *     if (parcCache_IsValid(a)) {
+ *         printf("Instance is valid.\n");
+ *     }
+ *
+ *     parcCache_Release(&a);
+ * }
+ * @endcode
+ */
+bool parcCache_IsValid(const PARCCache *instance);
+
+/**
+ * Assert that the given `PARCCache` instance is valid.
+ *
+ * @param [in] instance A pointer to a valid PARCCache instance.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCCache *a = parcCache_Create(10);
+ *
+ *     parcCache_AssertValid(a);
+ *
+ *     parcCache_Release(&a);
+ * }
+ * @endcode
+ */
+void parcCache_AssertValid(const PARCCache *instance);
+
+/**
+ * Print a human readable representation of the given `PARCCache`.
+ *
+ * @param [in] instance A pointer to a valid PARCCache instance.
+ * @param [in] indentation The indentation level to use for printing.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCCache *a = parcCache_Create(10);
+ *
+ *     parcCache_Display(a, 0);
+ *
+ *     parcCache_Release(&a);
+ * }
+ * @endcode
+ */
+void parcCache_Display(const PARCCache *instance, int indentation);
+
+/**
+ * Set the function to call when an entry is evicted.
+ *
+ * @param [in] cache A pointer to a valid PARCCache instance.
+ * @param [in] callback The function to call, or NULL to disable the callback.
+ * @param [in] context An opaque pointer passed to every invocation of @p callback.
+ *
+ * Example:
+ * @code
+ * {
+ *     static void
+ *     _evicted(const PARCObject *key, const PARCObject *value, PARCCacheEvictionReason reason, void *context)
+ *     {
+ *         ...
+ *     }
+ *
+ *     PARCCache *cache = parcCache_Create(10);
+ *     parcCache_SetEvictionCallback(cache, _evicted, NULL);
+ *
+ *     parcCache_Release(&cache);
+ * }
+ * @endcode
+ */
+void parcCache_SetEvictionCallback(PARCCache *cache, PARCCacheEvictionCallback *callback, void *context);
+
+/**
+ * Associate the specified value with the specified key in the given `PARCCache`, with no time-to-live.
+ *
+ * If the cache already contains an entry for the key, the value is replaced.
+ * Otherwise, if the cache is full, an existing entry is evicted to make room.
+ * The cache acquires references to both the key and the value.
+ *
+ * @param [in] cache A pointer to a valid PARCCache instance.
+ * @param [in] key A pointer to a valid PARCObject to use as the key.
+ * @param [in] value A pointer to a valid PARCObject to use as the value.
+ *
+ * @return The value of @p cache.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCCache *cache = parcCache_Create(10);
+ *     PARCBuffer *key = parcBuffer_WrapCString("key");
+ *     PARCBuffer *value = parcBuffer_WrapCString("value");
+ *
+ *     parcCache_Put(cache, key, value);
+ *
+ *     parcBuffer_Release(&value);
+ *     parcBuffer_Release(&key);
+ *     parcCache_Release(&cache);
+ * }
+ * @endcode
+ */
+PARCCache *parcCache_Put(PARCCache *cache, const PARCObject *key, const PARCObject *value);
+
+/**
+ * Associate the specified value with the specified key in the given `PARCCache`,
+ * expiring after @p timeToLive units of the cache's `PARCClock`.
+ *
+ * Otherwise the same as `parcCache_Put`.
+ * A @p timeToLive of zero means the entry never expires.
+ * A @p timeToLive that would expire beyond the range of the clock, such as `UINT64_MAX`,
+ * expires at the clock reading `UINT64_MAX - 1`.
+ *
+ * @param [in] cache A pointer to a valid PARCCache instance.
+ * @param [in] key A pointer to a valid PARCObject to use as the key.
+ * @param [in] value A pointer to a valid PARCObject to use as the value.
+ * @param [in] timeToLive The lifetime of the entry in clock units, or zero for no expiry.
+ *
+ * @return The value of @p cache.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCCache *cache = parcCache_Create(10);
+ *     PARCBuffer *key = parcBuffer_WrapCString("key");
+ *     PARCBuffer *value = parcBuffer_WrapCString("value");
+ *
+ *     // Expire the entry after 5 seconds.
+ *     parcCache_PutWithTimeToLive(cache, key, value, 5000);
+ *
+ *     parcBuffer_Release(&value);
+ *     parcBuffer_Release(&key);
+ *     parcCache_Release(&cache);
+ * }
+ * @endcode
+ */
+PARCCache *parcCache_PutWithTimeToLive(PARCCache *cache, const PARCObject *key, const PARCObject *value, uint64_t timeToLive);
+
+/**
+ * Get the value associated with the given key.
+ *
+ * A successful lookup marks the entry as recently used and counts as a hit.
+ * A lookup of an absent or expired key counts as a miss; an expired entry is evicted.
+ *
+ * The returned value is not acquired on behalf of the caller and is valid only until the
+ * cache is next modified. Acquire it if it is to be kept longer.
+ *
+ * @param [in] cache A pointer to a valid PARCCache instance.
+ * @param [in] key A pointer to a valid PARCObject.
+ *
+ * @return non-NULL The value associated with @p key.
+ * @return NULL The cache has no unexpired entry for @p key.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCCache *cache = parcCache_Create(10);
+ *     ...
+ *     const PARCBuffer *value = parcCache_Get(cache, key);
+ *
+ *     parcCache_Release(&cache);
+ * }
+ * @endcode
+ */
+const PARCObject *parcCache_Get(PARCCache *cache, const PARCObject *key);
+
+/**
+ * Remove the entry for the given key, if present.
+ *
+ * The eviction callback is not invoked.
+ *
+ * @param [in] cache A pointer to a valid PARCCache instance.
+ * @param [in] key A pointer to a valid PARCObject.
+ *
+ * @return true An entry for @p key was removed.
+ * @return false The cache has no entry for @p key.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCCache *cache = parcCache_Create(10);
+ *     ...
+ *     parcCache_Remove(cache, key);
+ *
+ *     parcCache_Release(&cache);
+ * }
+ * @endcode
+ */
+bool parcCache_Remove(PARCCache *cache, const PARCObject *key);
+
+/**
+ * Remove all entries from the given `PARCCache`.
+ *
+ * The eviction callback is not invoked and the statistics counters are not reset.
+ *
+ * @param [in] cache A pointer to a valid PARCCache instance.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCCache *cache = parcCache_Create(10);
+ *     ...
+ *     parcCache_Clear(cache);
+ *
+ *     parcCache_Release(&cache);
+ * }
+ * @endcode
+ */
+void parcCache_Clear(PARCCache *cache);
+
+/**
+ * Get the number of entries in the given `PARCCache`.
+ *
+ * Expired entries that have not yet been evicted are included in the count.
+ *
+ * @param [in] cache A pointer to a valid PARCCache instance.
+ *
+ * @return The number of entries.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCCache *cache = parcCache_Create(10);
+ *     size_t size = parcCache_Size(cache);
+ *
+ *     parcCache_Release(&cache);
+ * }
+ * @endcode
+ */
+size_t parcCache_Size(const PARCCache *cache);
+
+/**
+ * Get the maximum number of entries the given `PARCCache` can hold.
+ *
+ * @param [in] cache A pointer to a valid PARCCache instance.
+ *
+ * @return The capacity of the cache.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCCache *cache = parcCache_Create(10);
+ *     size_t capacity = parcCache_Capacity(cache); // 10
+ *
+ *     parcCache_Release(&cache);
+ * }
+ * @endcode
+ */
+size_t parcCache_Capacity(const PARCCache *cache);
+
+/**
+ * Get the number of lookups that found an unexpired entry.
+ *
+ * @param [in] cache A pointer to a valid PARCCache instance.
+ *
+ * @return The number of hits since the cache was created.
+ *
+ * Example:
+ * @code
+ * {
+ *     uint64_t hits = parcCache_GetHits(cache);
+ *     uint64_t misses = parcCache_GetMisses(cache);
+ *     double ratio = (double) hits / (hits + misses);
+ * }
+ * @endcode
+ */
+uint64_t parcCache_GetHits(const PARCCache *cache);
+
+/**
+ * Get the number of lookups that did not find an unexpired entry.
+ *
+ * @param [in] cache A pointer to a valid PARCCache instance.
+ *
+ * @return The number of misses since the cache was created.
+ *
+ * Example:
+ * @code
+ * {
+ *     uint64_t misses = parcCache_GetMisses(cache);
+ * }
+ * @endcode
+ */
+uint64_t parcCache_GetMisses(const PARCCache *cache);
+
+/**
+ * Get the number of entries evicted to make room for new entries.
+ *
+ * @param [in] cache A pointer to a valid PARCCache instance.
+ *
+ * @return The number of capacity evictions since the cache was created.
+ *
+ * Example:
+ * @code
+ * {
+ *     uint64_t evictions = parcCache_GetEvictions(cache);
+ * }
+ * @endcode
+ */
+uint64_t parcCache_GetEvictions(const PARCCache *cache);
+
+/**
+ * Get the number of entries evicted because their time-to-live elapsed.
+ *
+ * @param [in] cache A pointer to a valid PARCCache instance.
+ *
+ * @return The number of expirations since the cache was created.
+ *
+ * Example:
+ * @code
+ * {
+ *     uint64_t expirations = parcCache_GetExpirations(cache);
+ * }
+ * @endcode
+ */
+uint64_t parcCache_GetExpirations(const PARCCache *cache);
+#endif // libparc_parc_Cache_h
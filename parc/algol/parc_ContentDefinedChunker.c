@@ -0,0 +1,489 @@
+/*
+ * Copyright (c) 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Patent rights are not granted under this agreement. Patent rights are
+ *       available under FRAND terms.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX or PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * @copyright 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC).  All rights reserved.
+ */
+
+#include <config.h>
+
+#include <stdio.h>
+#include <string.h>
+
+#include <LongBow/runtime.h>
+
+#include <parc/algol/parc_Object.h>
+#include <parc/algol/parc_Buffer.h>
+#include <parc/algol/parc_Memory.h>
+
+#include <parc/algol/parc_RandomAccessFile.h>
+
+#include <parc/algol/parc_ContentDefinedChunker.h>
+
+PARCChunkerInterface *PARCContentDefinedChunkerAsChunker = &(PARCChunkerInterface) {
+    .ForwardIterator = (void *(*)(const void *))parcContentDefinedChunker_ForwardIterator,
+    .ReverseIterator = (void *(*)(const void *))parcContentDefinedChunker_ReverseIterator,
+    .Release = (void (*)(void **))parcContentDefinedChunker_Release
+};
+
+/**
+ * The gear table: a fixed pseudo-random 64-bit value for each byte value.
+ *
+ * The values are the first 256 outputs of a splitmix64 generator.
+ * They must never change, or the chunk boundaries (and so the digests) of all existing data would change.
+ */
+static const uint64_t _parcContentDefinedChunker_Gear[256] = {
+    0x5f642f87d5e23888ULL, 0x5a4d78533d034cb5ULL, 0x8a85ffdaea35a5a6ULL, 0xad002edb4259d53aULL,
+    0x807b1f5869c624bcULL, 0x1e2ac6b725fc033eULL, 0x3071c63893f2dcbdULL, 0x82642fea4a219753ULL,
+    0x0dca4f660c8165f2ULL, 0x7dc96cfcca651d33ULL, 0x20302015e7ad3ab7ULL, 0x2433d25f79ed09f7ULL,
+    0xf6fd75307b9b5a1fULL, 0x314a56d600a7bf15ULL, 0x2e7114a8d011ff74ULL, 0x59326cafa9c6bca2ULL,
+    0x0b07fedeabb1cf18ULL, 0xf305e429d8126c86ULL, 0x8a216bd197388ddcULL, 0xdfdc83d46229a7c9ULL,
+    0x64b116f64300632fULL, 0x345484c9171441c0ULL, 0x283145dbd9131c5fULL, 0xaf17e16adbcaf21bULL,
+    0xa8fbc88d3c6db08bULL, 0x314c8894998cdc83ULL, 0x1a2684383c431b1bULL, 0x29ea1e35023a0671ULL,
+    0xa680d453f6c0c923ULL, 0x65366c0aed9158d3ULL, 0x73d995bbece4d2a5ULL, 0xee9b17bd2f99e98cULL,
+    0x3d5a57b308c6cc0bULL, 0x741f8515528b695cULL, 0x46bd6fd9741170a1ULL, 0x474b1629b9855c09ULL,
+    0x0aafaaadc93e2d70ULL, 0x353966464d0d4b12ULL, 0x0cee4ae1e1f5a8a3ULL, 0x626892b1029520afULL,
+    0x1c19bf55f5c06968ULL, 0x5bf2f36d4501622dULL, 0x0e898ed4c334a358ULL, 0x764deaae308e9e66ULL,
+    0xef5efe7a2f9aafd3ULL, 0x896a1fe235e76223ULL, 0x93638f2b5640144fULL, 0x5b16dffb7005b134ULL,
+    0x12e54f447ef28c42ULL, 0x226188553c801138ULL, 0xa4880f3fc7723e1eULL, 0xcfc0ff38225563ecULL,
+    0x9c29fb351537b552ULL, 0x5ec35fe1ae64c530ULL, 0x67a67263e286b298ULL, 0x9fdf347e3631ca75ULL,
+    0x4533f819afa13940ULL, 0xe5511520cc45bc1bULL, 0xaa43343d8bc213b1ULL, 0x363312c07429c977ULL,
+    0x31fadfbd6eb253a6ULL, 0x14eac10437bada5bULL, 0x931e46602ba6cd14ULL, 0xde9978ab0e5ee602ULL,
+    0x9997d9e6f72b55edULL, 0x183777519a434e64ULL, 0x5a6ef73daccf5121ULL, 0xe36307d9041db677ULL,
+    0x84854ef6d4ceeff4ULL, 0xd789d676c116c817ULL, 0xd51602fbdb292e99ULL, 0x3b83e79f27cd0b24ULL,
+    0x3462f1ecff5ff6bdULL, 0x1e2422e381c93ccbULL, 0x1a376719d5861a17ULL, 0x4b8c9290eb7501d7ULL,
+    0x02a72fec12a0fe45ULL, 0x9b533eb80704454eULL, 0x346994b4d8e23dc0ULL, 0x0b1f8a23556d25dcULL,
+    0x6aa8fbc1e8a8085cULL, 0x147feb2a14f8e91aULL, 0x763b1a6d23a3fb46ULL, 0xc5e69301788f496fULL,
+    0x08d1f05a3b118fb0ULL, 0x708f9221af313b85ULL, 0x1ccd5dfb71336389ULL, 0x86631b435f39e702ULL,
+    0xe1296f6a1282967fULL, 0xc5d115ccf1f0ec70ULL, 0x36dcda504c0da598ULL, 0xd2cd4f8e5078c7c4ULL,
+    0x6d88390c9b2c09f6ULL, 0xef4d19db3bd7ffd2ULL, 0x82280be3e7eabda9ULL, 0x59372b4b5a7b36fbULL,
+    0x06b5fc6f9d869428ULL, 0x6922c7f6b72387e8ULL, 0x068b5cef40ebc6d7ULL, 0x30da1d9216c17949ULL,
+    0xf93a0e15cbf22e7dULL, 0x3e282fc715564c74ULL, 0x74fcc91b82686d59ULL, 0xf5eeaefefba8417fULL,
+    0xeb111035109eee15ULL, 0x6848c3e3a83d1bfeULL, 0xdfc07b6fa7b17b65ULL, 0xf1b217ddb79e1e66ULL,
+    0x3e314b5f27c1e674ULL, 0x497e49f36fad93c6ULL, 0xe699d2ecf45b91acULL, 0x631f28d980199b1dULL,
+    0x9df2fdc4afa197a0ULL, 0x53d72716d31762dcULL, 0x65e9063100e0c3e4ULL, 0xee8a91d5b8fe17dbULL,
+    0x3009e6ceb7d7d14eULL, 0x4447ffa82e1074ffULL, 0x97995ed9e39e3fecULL, 0x2b3d548b9e6890aaULL,
+    0xb4b7223f6a7d219bULL, 0x785bce211615400cULL, 0xbf9838f2ddba254dULL, 0x2676e634cf063fdbULL,
+    0x598246199e2e645eULL, 0x92150ece417b508aULL, 0x45e144b6d4c3bec7ULL, 0x765e4340f30ca2dbULL,
+    0x680b16e59c23d2f2ULL, 0x642f16a6ed1a925bULL, 0xac2e00a95f6cfad3ULL, 0x9ea2eb6d6ae34d06ULL,
+    0xd94c27acb8bf25a1ULL, 0x01694ea5c13e0ff5ULL, 0xc242469ed31ff094ULL, 0xb152100a45626a4aULL,
+    0xb6f0935d419aeecbULL, 0x21d90b25fd7455b4ULL, 0x3743b1d992207adeULL, 0xe8b1e8f05c8b279eULL,
+    0xb7b7d090c2c2dd6bULL, 0x688869cf33ce800dULL, 0xee78e6431f8d1100ULL, 0x66f1c7f40fc5a153ULL,
+    0x4ac1390a7fdd257aULL, 0xbaed9afa1d12f131ULL, 0xd07112f4d2771985ULL, 0x5deb86c538b729c4ULL,
+    0xf7f9a5d41760804cULL, 0xe0790415e317eb9fULL, 0x892278b218ff3117ULL, 0xccecedd92a8a371cULL,
+    0xa893ca3096320291ULL, 0xa97bd7eadf30faaeULL, 0xce0358a0e5e1cb6cULL, 0xdc5b7690d44a8d25ULL,
+    0xce52ee49564de1ebULL, 0xdd2f9f65c8283dcdULL, 0xb6b1f5cab4fb0831ULL, 0x63ae4022386f241bULL,
+    0x1fe388d3a7d94937ULL, 0x0418a59748195e9cULL, 0xcf922306312202f7ULL, 0xdd149886d26aff33ULL,
+    0xcb6d2d6650720f33ULL, 0x81c732927bcc55b3ULL, 0x546b8e66bb87b182ULL, 0x711f091edc33d7edULL,
+    0xb474957c388cae7dULL, 0xa8423ceced91377aULL, 0x0cf3b1cfe1087565ULL, 0x34701807e0b1b6e7ULL,
+    0x2becf07fa693beecULL, 0x7fec92b40f6b05f2ULL, 0xdae64a959c4cf565ULL, 0x22f64d59c085afd2ULL,
+    0x696102fde20887feULL, 0x306908400116c977ULL, 0x643a067cc252c8afULL, 0xd23b8945a6048df4ULL,
+    0xf907cd8124074c7cULL, 0xe2400bec6b49814cULL, 0x875277589020f014ULL, 0xff85c9a80b5a091aULL,
+    0x71e661d78330cfffULL, 0x38fcd7afe6cce018ULL, 0xd85df877adc7be30ULL, 0xf68e5c00bcb3828dULL,
+    0x742fb00fdb230f21ULL, 0x4c07938876b1b1b9ULL, 0x8861541b05e45235ULL, 0x66d14b30bd5e3840ULL,
+    0xa1b43547a9c6acaeULL, 0x29d4cc0b13c08cfaULL, 0x265fa55ddf58acd2ULL, 0xc9047bdeb660afb8ULL,
+    0xc5d407330e2d4798ULL, 0x1786cb6991bdf46eULL, 0x838379be6af8f25bULL, 0x9c10bf246f16db88ULL,
+    0x5302d6f2be1027edULL, 0x92a0ed15a3f2386dULL, 0x5c72f04961b2e339ULL, 0xbd941dab9973adeaULL,
+    0x4147f32c818da294ULL, 0x53570c49a3b74f41ULL, 0x6ca289654f696abfULL, 0x407b9091079c5cfbULL,
+    0xce4c4f04c2dec151ULL, 0x382d7c2b68686b39ULL, 0x25cc4b054300a16aULL, 0x5d43b2c773db3e15ULL,
+    0x9ee191b98e71633bULL, 0xb89801620fb98820ULL, 0xc6d74a027dc4fd34ULL, 0xa270241c21622e6cULL,
+    0x6a426bbf5a392779ULL, 0xf0d5eead878ccd1dULL, 0x9c3feaeafe06fa16ULL, 0x203300643ebddc56ULL,
+    0xd24289c3198936e2ULL, 0x96d3a400061de48fULL, 0x32e5f0796ace206aULL, 0xf6126e29af2cde04ULL,
+    0x3cf7d0b16cace5d2ULL, 0xfd2c1ef4268e3e84ULL, 0xd7baea2f03e67c5eULL, 0x0f5c7a6e1ba408d9ULL,
+    0xcd69a62c33c3c36cULL, 0x39666c8d6d29d06eULL, 0xa189fbcc6d52167dULL, 0xa3baac8ec484337eULL,
+    0x2767e2ce358ddb55ULL, 0xff6100e3b2cb1977ULL, 0x634b44a8581fdcc6ULL, 0x05feb21331f75b32ULL,
+    0xd033648cc830aab9ULL, 0xc8b654eaee3c2dc7ULL, 0x897ee7184cc4eb97ULL, 0xd5ae3693ca31339cULL,
+    0xcbd6d300cb602ebbULL, 0x52aab75628915823ULL, 0x08fc0b9905b0aefeULL, 0xd592e98cd5047bbfULL,
+    0xf24c77482540ed9cULL, 0xad069b96f0819fcbULL, 0x7423cda5cc2df2f6ULL, 0x646d7ee814e11cc3ULL,
+    0xd6109a09b2466ce5ULL, 0x6aef7b145345d23aULL, 0x4a71934f12a287d8ULL, 0xf4d65906846a9eacULL,
+    0x61a81314d756d746ULL, 0x4ed80b07626821f4ULL, 0xb4ddec2ef1033e23ULL, 0xe4e58b71ac31c125ULL,
+};
+
+struct _parc_chunker_state {
+    int direction;
+    bool atEnd;
+
+    // Forward: the offset of the next chunk.
+    size_t position;
+
+    // Reverse: the offsets of the ends of all the chunks, and the index of the next chunk.
+    size_t *boundaries;
+    size_t boundaryCount;
+    size_t index;
+};
+
+typedef struct _parc_chunker_state _ChunkerState;
+
+struct parc_content_defined_chunker {
+    size_t minimumSize;
+    size_t averageSize;
+    size_t maximumSize;
+
+    // A boundary is where the hash has all the bits of the mask clear.
+    // The small-chunk mask has more bits and is used before the average size is reached.
+    uint64_t smallMask;
+    uint64_t largeMask;
+
+    // The data to be chunked, a slice whose position is the start of the data. Chunks are slices of it.
+    PARCBuffer *data;
+    const uint8_t *bytes;
+    size_t length;
+
+    // The current element of the iterator
+    PARCBuffer *currentElement;
+};
+
+static void
+_destroy(PARCContentDefinedChunker **chunkerP)
+{
+    if ((*chunkerP)->data != NULL) {
+        parcBuffer_Release(&(*chunkerP)->data);
+    }
+
+    if ((*chunkerP)->currentElement != NULL) {
+        parcBuffer_Release(&(*chunkerP)->currentElement);
+    }
+}
+
+/**
+ * A mask with the given number of bits set, at the top of the word.
+ *
+ * Each step shifts the hash left by one, so the top bits are those that depend on the most (the last 64) bytes.
+ */
+static uint64_t
+_mask(unsigned bits)
+{
+    return ~UINT64_C(0) << (64 - bits);
+}
+
+size_t
+parcContentDefinedChunker_FindBoundary(const PARCContentDefinedChunker *chunker, const uint8_t *data, size_t length)
+{
+    if (length <= chunker->minimumSize) {
+        return length;
+    }
+
+    size_t end = (length < chunker->maximumSize) ? length : chunker->maximumSize;
+    size_t normal = (end < chunker->averageSize) ? end : chunker->averageSize;
+
+    const uint64_t *gear = _parcContentDefinedChunker_Gear;
+    uint64_t smallMask = chunker->smallMask;
+    uint64_t largeMask = chunker->largeMask;
+    uint64_t hash = 0;
+
+    // No boundary can fall within the minimum size, so the hash starts there rather than at the beginning.
+    size_t i = chunker->minimumSize;
+
+    // Two bytes per iteration, checking the boundary after each.
+    for (; i + 1 < normal; i += 2) {
+        hash = (hash << 1) + gear[data[i]];
+        if ((hash & smallMask) == 0) {
+            return i + 1;
+        }
+        hash = (hash << 1) + gear[data[i + 1]];
+        if ((hash & smallMask) == 0) {
+            return i + 2;
+        }
+    }
+    for (; i < normal; i++) {
+        hash = (hash << 1) + gear[data[i]];
+        if ((hash & smallMask) == 0) {
+            return i + 1;
+        }
+    }
+
+    for (; i + 1 < end; i += 2) {
+        hash = (hash << 1) + gear[data[i]];
+        if ((hash & largeMask) == 0) {
+            return i + 1;
+        }
+        hash = (hash << 1) + gear[data[i + 1]];
+        if ((hash & largeMask) == 0) {
+            return i + 2;
+        }
+    }
+    for (; i < end; i++) {
+        hash = (hash << 1) + gear[data[i]];
+        if ((hash & largeMask) == 0) {
+            return i + 1;
+        }
+    }
+
+    return end;
+}
+
+static void *
+_InitForward(PARCContentDefinedChunker *chunker)
+{
+    _ChunkerState *state = parcMemory_Allocate(sizeof(_ChunkerState));
+
+    state->direction = 0;
+    state->position = 0;
+    state->atEnd = (chunker->length == 0);
+    state->boundaries = NULL;
+    state->boundaryCount = 0;
+    state->index = 0;
+
+    parcBuffer_Advise(chunker->data, PARCByteArrayAdvice_Sequential);
+
+    return state;
+}
+
+static void *
+_InitReverse(PARCContentDefinedChunker *chunker)
+{
+    _ChunkerState *state = parcMemory_Allocate(sizeof(_ChunkerState));
+
+    state->direction = 1;
+    state->position = 0;
+    state->atEnd = (chunker->length == 0);
+
+    // There can be no more chunks than fit at the minimum size, plus the short last chunk.
+    size_t capacity = chunker->length / chunker->minimumSize + 1;
+    state->boundaries = parcMemory_Allocate(capacity * sizeof(size_t));
+    state->boundaryCount = 0;
+
+    parcBuffer_Advise(chunker->data, PARCByteArrayAdvice_Sequential);
+
+    size_t offset = 0;
+    while (offset < chunker->length) {
+        offset += parcContentDefinedChunker_FindBoundary(chunker, &chunker->bytes[offset], chunker->length - offset);
+        state->boundaries[state->boundaryCount++] = offset;
+    }
+    state->index = state->boundaryCount;
+
+    return state;
+}
+
+static bool
+_parcChunker_HasNext(PARCContentDefinedChunker *chunker, void *voidstate)
+{
+    _ChunkerState *state = (_ChunkerState *) voidstate;
+    return !state->atEnd;
+}
+
+/**
+ * Return a new buffer that is a slice of the region [offset, offset + length) of the chunker's data.
+ */
+static PARCBuffer *
+_sliceRegion(PARCContentDefinedChunker *chunker, size_t offset, size_t length)
+{
+    parcBuffer_SetPosition(chunker->data, offset);
+    parcBuffer_SetLimit(chunker->data, offset + length);
+
+    PARCBuffer *result = parcBuffer_Slice(chunker->data);
+    parcBuffer_Clear(chunker->data);
+
+    return result;
+}
+
+static PARCBuffer *
+_nextForward(PARCContentDefinedChunker *chunker, _ChunkerState *state)
+{
+    size_t offset = state->position;
+    size_t length = parcContentDefinedChunker_FindBoundary(chunker, &chunker->bytes[offset], chunker->length - offset);
+
+    state->position += length;
+    state->atEnd = (state->position == chunker->length);
+
+    return _sliceRegion(chunker, offset, length);
+}
+
+static PARCBuffer *
+_nextReverse(PARCContentDefinedChunker *chunker, _ChunkerState *state)
+{
+    state->index--;
+    size_t end = state->boundaries[state->index];
+    size_t start = (state->index == 0) ? 0 : state->boundaries[state->index - 1];
+
+    state->atEnd = (state->index == 0);
+
+    return _sliceRegion(chunker, start, end - start);
+}
+
+static void *
+_parcChunker_Next(PARCContentDefinedChunker *chunker, void *voidstate)
+{
+    _ChunkerState *state = (_ChunkerState *) voidstate;
+
+    if (chunker->currentElement != NULL) {
+        parcBuffer_Release(&chunker->currentElement);
+    }
+
+    PARCBuffer *buffer;
+    if (state->direction == 0) {
+        buffer = _nextForward(chunker, state);
+    } else {
+        buffer = _nextReverse(chunker, state);
+    }
+
+    // The caller owns the returned element, the chunker keeps a reference until the next call.
+    chunker->currentElement = parcBuffer_Acquire(buffer);
+
+    return state;
+}
+
+static void
+_parcChunker_RemoveAt(PARCContentDefinedChunker *chunker, void **state)
+{
+    // pass
+}
+
+static void *
+_parcChunker_GetElement(PARCContentDefinedChunker *chunker, void *state)
+{
+    return chunker->currentElement;
+}
+
+static void
+_parcChunker_Finish(PARCContentDefinedChunker *chunker, void *state)
+{
+    _ChunkerState *thestate = (_ChunkerState *) state;
+    if (thestate->boundaries != NULL) {
+        parcMemory_Deallocate(&thestate->boundaries);
+    }
+    parcMemory_Deallocate(&thestate);
+}
+
+static void
+_parcChunker_AssertValid(const void *state)
+{
+    // pass
+}
+
+parcObject_ExtendPARCObject(PARCContentDefinedChunker, _destroy, NULL, NULL, NULL, NULL, NULL, NULL);
+parcObject_ImplementAcquire(parcContentDefinedChunker, PARCContentDefinedChunker);
+parcObject_ImplementRelease(parcContentDefinedChunker, PARCContentDefinedChunker);
+
+/**
+ * Create a chunker for the given data, taking ownership of the reference to it.
+ */
+static PARCContentDefinedChunker *
+_create(PARCBuffer *data, size_t minimumSize, size_t averageSize, size_t maximumSize)
+{
+    trapIllegalValueIf(minimumSize == 0, "The minimum size must be greater than zero.");
+    trapIllegalValueIf(averageSize < 64, "The average size must be at least 64.");
+    trapIllegalValueIf(minimumSize > averageSize || averageSize > maximumSize,
+                       "The sizes must satisfy minimum (%zu) <= average (%zu) <= maximum (%zu).",
+                       minimumSize, averageSize, maximumSize);
+
+    PARCContentDefinedChunker *chunker = parcObject_CreateInstance(PARCContentDefinedChunker);
+
+    if (chunker != NULL) {
+        unsigned bits = 0;
+        while ((averageSize >> (bits + 1)) != 0) {
+            bits++;
+        }
+
+        chunker->minimumSize = minimumSize;
+        chunker->averageSize = (size_t) 1 << bits;
+        chunker->maximumSize = maximumSize;
+        chunker->smallMask = _mask(bits + 2);
+        chunker->largeMask = _mask(bits - 2);
+        chunker->data = data;
+        chunker->length = parcBuffer_Remaining(data);
+        chunker->bytes = (chunker->length > 0) ? parcBuffer_Overlay(data, 0) : NULL;
+        chunker->currentElement = NULL;
+    } else {
+        parcBuffer_Release(&data);
+    }
+
+    return chunker;
+}
+
+PARCContentDefinedChunker *
+parcContentDefinedChunker_Create(PARCBuffer *data, size_t minimumSize, size_t averageSize, size_t maximumSize)
+{
+    return _create(parcBuffer_Slice(data), minimumSize, averageSize, maximumSize);
+}
+
+/**
+ * Read the whole of a file that could not be mapped, such as a pipe or a special file.
+ */
+static PARCBuffer *
+_readFile(PARCFile *file)
+{
+    PARCBuffer *result = NULL;
+
+    PARCRandomAccessFile *fhandle = parcRandomAccessFile_Open(file);
+    if (fhandle != NULL) {
+        result = parcBuffer_Allocate(parcFile_GetFileSize(file));
+        parcRandomAccessFile_Read(fhandle, result);
+        parcBuffer_Flip(result);
+        parcRandomAccessFile_Release(&fhandle);
+    }
+
+    return result;
+}
+
+PARCContentDefinedChunker *
+parcContentDefinedChunker_CreateFromFile(PARCFile *file, size_t minimumSize, size_t averageSize, size_t maximumSize)
+{
+    char *fileName = parcFile_ToString(file);
+    PARCBuffer *data = parcBuffer_MapFile(fileName);
+    parcMemory_Deallocate((void **) &fileName);
+
+    if (data == NULL) {
+        data = _readFile(file);
+    }
+
+    PARCContentDefinedChunker *result = NULL;
+    if (data != NULL) {
+        result = _create(data, minimumSize, averageSize, maximumSize);
+    }
+
+    return result;
+}
+
+PARCIterator *
+parcContentDefinedChunker_ForwardIterator(const PARCContentDefinedChunker *chunker)
+{
+    PARCIterator *iterator = parcIterator_Create((void *) chunker,
+                                                 (void *(*)(PARCObject *))_InitForward,
+                                                 (bool (*)(PARCObject *, void *))_parcChunker_HasNext,
+                                                 (void *(*)(PARCObject *, void *))_parcChunker_Next,
+                                                 (void (*)(PARCObject *, void **))_parcChunker_RemoveAt,
+                                                 (void *(*)(PARCObject *, void *))_parcChunker_GetElement,
+                                                 (void (*)(PARCObject *, void *))_parcChunker_Finish,
+                                                 (void (*)(const void *))_parcChunker_AssertValid);
+
+    return iterator;
+}
+
+PARCIterator *
+parcContentDefinedChunker_ReverseIterator(const PARCContentDefinedChunker *chunker)
+{
+    PARCIterator *iterator = parcIterator_Create((void *) chunker,
+                                                 (void *(*)(PARCObject *))_InitReverse,
+                                                 (bool (*)(PARCObject *, void *))_parcChunker_HasNext,
+                                                 (void *(*)(PARCObject *, void *))_parcChunker_Next,
+                                                 (void (*)(PARCObject *, void **))_parcChunker_RemoveAt,
+                                                 (void *(*)(PARCObject *, void *))_parcChunker_GetElement,
+                                                 (void (*)(PARCObject *, void *))_parcChunker_Finish,
+                                                 (void (*)(const void *))_parcChunker_AssertValid);
+
+    return iterator;
+}
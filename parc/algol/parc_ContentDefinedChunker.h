@@ -0,0 +1,240 @@
+/*
+ * Copyright (c) 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Patent rights are not granted under this agreement. Patent rights are
+ *       available under FRAND terms.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX or PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * @file parc_ContentDefinedChunker.h
+ * @ingroup ContentObject
+ * @brief A ContentDefinedChunker is a chunker that places chunk boundaries by the content of the data.
+ *
+ * The `PARCBufferChunker` and `PARCFileChunker` cut chunks at fixed offsets,
+ * so inserting or removing a single byte near the start of the data changes every chunk that follows it.
+ * A `PARCContentDefinedChunker` instead runs a rolling (gear) hash over the data and
+ * cuts a chunk wherever the hash matches a mask, as in the FastCDC algorithm.
+ * A boundary depends only on the bytes just before it, so an edit changes only the chunks around it
+ * and the rest of the chunks, and their digests, are unchanged.
+ *
+ * Every chunk is at least the minimum size and at most the maximum size, except that the last chunk may be shorter.
+ * Chunk sizes cluster around the average size: a stricter mask is used before the average size is reached
+ * and a looser one after it (normalized chunking).
+ *
+ * Chunks are slices of the chunked data, and a file is memory-mapped where possible,
+ * so producing a chunk copies no data.
+ *
+ * @copyright 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC).  All rights reserved.
+ */
+#ifndef libparc_parc_ContentDefinedChunker_h
+#define libparc_parc_ContentDefinedChunker_h
+
+#include <config.h>
+
+#include <parc/algol/parc_Chunker.h>
+#include <parc/algol/parc_Buffer.h>
+#include <parc/algol/parc_File.h>
+
+struct parc_content_defined_chunker;
+/**
+ * @typedef PARCContentDefinedChunker
+ * @brief A chunker that places chunk boundaries by the content of the data.
+ */
+typedef struct parc_content_defined_chunker PARCContentDefinedChunker;
+
+/**
+ * The mapping of a `PARCContentDefinedChunker` to the generic `PARCChunker`.
+ */
+extern PARCChunkerInterface *PARCContentDefinedChunkerAsChunker;
+
+/**
+ * Create a new chunker to segment the data between the position and the limit of a `PARCBuffer`.
+ *
+ * The average size is rounded down to a power of two.
+ * The sizes must satisfy `0 < minimumSize <= averageSize <= maximumSize` and `averageSize` must be at least 64.
+ *
+ * The chunker takes its own reference to the data. The position and limit of @p data are not modified.
+ *
+ * @param [in] data A `PARCBuffer` holding the data to chunk.
+ * @param [in] minimumSize The smallest size of a chunk other than the last chunk.
+ * @param [in] averageSize The desired average size of a chunk.
+ * @param [in] maximumSize The largest size of a chunk.
+ *
+ * @retval PARCContentDefinedChunker A newly allocated `PARCContentDefinedChunker`
+ * @retval NULL An error occurred.
+ *
+ * Example
+ * @code
+ * {
+ *     PARCBuffer *dataToChunk = ...
+ *     PARCContentDefinedChunker *chunker = parcContentDefinedChunker_Create(dataToChunk, 2048, 8192, 65536);
+ * }
+ * @endcode
+ */
+PARCContentDefinedChunker *parcContentDefinedChunker_Create(PARCBuffer *data, size_t minimumSize, size_t averageSize, size_t maximumSize);
+
+/**
+ * Create a new chunker to segment the content of a file.
+ *
+ * The file is memory-mapped if possible, otherwise it is read into memory.
+ * The chunker segments the content of the file as it was when the chunker was created.
+ *
+ * @param [in] file A `PARCFile` from which the data will be read.
+ * @param [in] minimumSize The smallest size of a chunk other than the last chunk.
+ * @param [in] averageSize The desired average size of a chunk.
+ * @param [in] maximumSize The largest size of a chunk.
+ *
+ * @retval PARCContentDefinedChunker A newly allocated `PARCContentDefinedChunker`
+ * @retval NULL The file could not be read.
+ *
+ * Example
+ * @code
+ * {
+ *     PARCFile *file = parcFile_Create("/tmp/file_to_chunk");
+ *     PARCContentDefinedChunker *chunker = parcContentDefinedChunker_CreateFromFile(file, 2048, 8192, 65536);
+ *     parcFile_Release(&file);
+ * }
+ * @endcode
+ */
+PARCContentDefinedChunker *parcContentDefinedChunker_CreateFromFile(PARCFile *file, size_t minimumSize, size_t averageSize, size_t maximumSize);
+
+/**
+ * Increase the number of references to a `PARCContentDefinedChunker` instance.
+ *
+ * Note that new `PARCContentDefinedChunker` is not created,
+ * only that the given `PARCContentDefinedChunker` reference count is incremented.
+ * Discard the reference by invoking {@link parcContentDefinedChunker_Release}.
+ *
+ * @param [in] chunker A pointer to the original `PARCContentDefinedChunker`.
+ * @return The value of the input parameter @p chunker.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCContentDefinedChunker *original = parcContentDefinedChunker_Create(...);
+ *
+ *     PARCContentDefinedChunker *reference = parcContentDefinedChunker_Acquire(original);
+ *
+ *     parcContentDefinedChunker_Release(&original);
+ *     parcContentDefinedChunker_Release(&reference);
+ * }
+ * @endcode
+ *
+ * @see parcContentDefinedChunker_Release
+ */
+PARCContentDefinedChunker *parcContentDefinedChunker_Acquire(const PARCContentDefinedChunker *chunker);
+
+/**
+ * Release a previously acquired reference to the specified instance,
+ * decrementing the reference count for the instance.
+ *
+ * The pointer to the instance is set to NULL as a side-effect of this function.
+ *
+ * If the invocation causes the last reference to the instance to be released,
+ * the instance is deallocated and the instance's implementation will perform
+ * additional cleanup and release other privately held references.
+ *
+ * @param [in,out] chunkerP A pointer to a pointer to the instance to release.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCContentDefinedChunker *chunker = parcContentDefinedChunker_Create(...);
+ *
+ *     parcContentDefinedChunker_Release(&chunker);
+ * }
+ * @endcode
+ */
+void parcContentDefinedChunker_Release(PARCContentDefinedChunker **chunkerP);
+
+/**
+ * Return the length of the first chunk of the given data.
+ *
+ * This is the boundary search used by the iterators, exposed for callers that manage their own data.
+ *
+ * @param [in] chunker A `PARCContentDefinedChunker` instance.
+ * @param [in] data A pointer to the data.
+ * @param [in] length The number of bytes at @p data.
+ *
+ * @return The length of the first chunk, which is @p length if @p length is no greater than the minimum size.
+ *
+ * Example
+ * @code
+ * {
+ *     size_t offset = 0;
+ *     while (offset < length) {
+ *         size_t chunkLength = parcContentDefinedChunker_FindBoundary(chunker, &data[offset], length - offset);
+ *         ...
+ *         offset += chunkLength;
+ *     }
+ * }
+ * @endcode
+ */
+size_t parcContentDefinedChunker_FindBoundary(const PARCContentDefinedChunker *chunker, const uint8_t *data, size_t length);
+
+/**
+ * Return an iterator to traverse the chunks of the underlying data in sequential order.
+ *
+ * Each element is a `PARCBuffer` slice of the data, which the caller must release.
+ * A chunker supports one active iterator at a time.
+ *
+ * @param [in] chunker A `PARCContentDefinedChunker` instance.
+ *
+ * @return a `PARCIterator` that traverses the chunks of the underlying data.
+ *
+ * Example
+ * @code
+ * {
+ *     PARCContentDefinedChunker *chunker = parcContentDefinedChunker_Create(dataToChunk, 2048, 8192, 65536);
+ *
+ *     PARCIterator *itr = parcContentDefinedChunker_ForwardIterator(chunker);
+ *
+ *     // use the iterator to traverse the chunker
+ * }
+ * @endcode
+ */
+PARCIterator *parcContentDefinedChunker_ForwardIterator(const PARCContentDefinedChunker *chunker);
+
+/**
+ * Return an iterator to traverse the chunks of the underlying data in reverse order.
+ *
+ * The chunks are the same as those of the forward iterator, in the opposite order.
+ * Because boundaries can only be found from the start of the data, creating the iterator
+ * finds all of the boundaries up front.
+ *
+ * @param [in] chunker A `PARCContentDefinedChunker` instance.
+ *
+ * @return a `PARCIterator` that traverses the chunks of the underlying data.
+ *
+ * Example
+ * @code
+ * {
+ *     PARCContentDefinedChunker *chunker = parcContentDefinedChunker_Create(dataToChunk, 2048, 8192, 65536);
+ *
+ *     PARCIterator *itr = parcContentDefinedChunker_ReverseIterator(chunker);
+ *
+ *     // use the iterator to traverse the chunker
+ * }
+ * @endcode
+ */
+PARCIterator *parcContentDefinedChunker_ReverseIterator(const PARCContentDefinedChunker *chunker);
+#endif // libparc_parc_ContentDefinedChunker_h
@@ -0,0 +1,521 @@
+/*
+ * Copyright (c) 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Patent rights are not granted under this agreement. Patent rights are
+ *       available under FRAND terms.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX or PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * @copyright 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC).  All rights reserved.
+ */
+#include <config.h>
+
+#include <string.h>
+
+#include <LongBow/runtime.h>
+
+#include <parc/algol/parc_CuckooFilter.h>
+#include <parc/algol/parc_Object.h>
+#include <parc/algol/parc_Memory.h>
+#include <parc/algol/parc_Hash.h>
+
+#define _PARCCuckooFilter_SlotsPerBucket 4
+#define _PARCCuckooFilter_MaximumKicks 500
+
+// An empty slot holds the fingerprint 0, so no element may have that fingerprint.
+#define _PARCCuckooFilter_EmptySlot 0
+
+// The serialized form begins with "PCF1".
+#define _PARCCuckooFilter_Magic 0x50434631
+
+struct PARCCuckooFilter {
+    uint16_t *slots;
+    size_t bucketMask;
+    size_t count;
+
+    // Pseudo-random state for choosing which fingerprint to displace.
+    uint64_t random;
+
+    // A fingerprint that could not be placed when the filter became full.
+    bool hasVictim;
+    uint16_t victimFingerprint;
+    size_t victimBucket;
+};
+
+static inline uint64_t
+_parcCuckooFilter_Mix(uint64_t hash)
+{
+    hash ^= hash >> 33;
+    hash *= 0xFF51AFD7ED558CCDULL;
+    hash ^= hash >> 33;
+    hash *= 0xC4CEB9FE1A85EC53ULL;
+    hash ^= hash >> 33;
+    return hash;
+}
+
+static inline uint16_t
+_parcCuckooFilter_Fingerprint(uint64_t mixed)
+{
+    uint16_t result = (uint16_t) (mixed >> 48);
+    return (result == _PARCCuckooFilter_EmptySlot) ? 1 : result;
+}
+
+/*
+ * The alternate bucket depends only on the current bucket and the fingerprint,
+ * so a fingerprint can be moved between its two buckets without knowing the original element.
+ */
+static inline size_t
+_parcCuckooFilter_AlternateBucket(const PARCCuckooFilter *filter, size_t bucket, uint16_t fingerprint)
+{
+    return (bucket ^ (size_t) (fingerprint * 0x5BD1E995U)) & filter->bucketMask;
+}
+
+static inline uint16_t *
+_parcCuckooFilter_Bucket(const PARCCuckooFilter *filter, size_t bucket)
+{
+    return &filter->slots[bucket * _PARCCuckooFilter_SlotsPerBucket];
+}
+
+static size_t
+_parcCuckooFilter_SlotCount(const PARCCuckooFilter *filter)
+{
+    return (filter->bucketMask + 1) * _PARCCuckooFilter_SlotsPerBucket;
+}
+
+static bool
+_parcCuckooFilter_BucketInsert(PARCCuckooFilter *filter, size_t bucket, uint16_t fingerprint)
+{
+    uint16_t *slots = _parcCuckooFilter_Bucket(filter, bucket);
+    for (int i = 0; i < _PARCCuckooFilter_SlotsPerBucket; i++) {
+        if (slots[i] == _PARCCuckooFilter_EmptySlot) {
+            slots[i] = fingerprint;
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool
+_parcCuckooFilter_BucketContains(const PARCCuckooFilter *filter, size_t bucket, uint16_t fingerprint)
+{
+    const uint16_t *slots = _parcCuckooFilter_Bucket(filter, bucket);
+    return slots[0] == fingerprint || slots[1] == fingerprint || slots[2] == fingerprint || slots[3] == fingerprint;
+}
+
+static bool
+_parcCuckooFilter_BucketRemove(PARCCuckooFilter *filter, size_t bucket, uint16_t fingerprint)
+{
+    uint16_t *slots = _parcCuckooFilter_Bucket(filter, bucket);
+    for (int i = 0; i < _PARCCuckooFilter_SlotsPerBucket; i++) {
+        if (slots[i] == fingerprint) {
+            slots[i] = _PARCCuckooFilter_EmptySlot;
+            return true;
+        }
+    }
+    return false;
+}
+
+static inline uint64_t
+_parcCuckooFilter_NextRandom(PARCCuckooFilter *filter)
+{
+    // xorshift64
+    filter->random ^= filter->random << 13;
+    filter->random ^= filter->random >> 7;
+    filter->random ^= filter->random << 17;
+    return filter->random;
+}
+
+/*
+ * Place a fingerprint in the given bucket or its alternate, displacing other fingerprints to their
+ * alternate buckets as needed. If no place is found, the last displaced fingerprint becomes the victim.
+ */
+static bool
+_parcCuckooFilter_Insert(PARCCuckooFilter *filter, size_t bucket, uint16_t fingerprint)
+{
+    if (filter->hasVictim) {
+        return false;
+    }
+
+    size_t alternate = _parcCuckooFilter_AlternateBucket(filter, bucket, fingerprint);
+    if (_parcCuckooFilter_BucketInsert(filter, bucket, fingerprint) || _parcCuckooFilter_BucketInsert(filter, alternate, fingerprint)) {
+        filter->count++;
+        return true;
+    }
+
+    size_t current = (_parcCuckooFilter_NextRandom(filter) & 1) ? bucket : alternate;
+    for (int kick = 0; kick < _PARCCuckooFilter_MaximumKicks; kick++) {
+        uint16_t *slots = _parcCuckooFilter_Bucket(filter, current);
+        int slot = (int) (_parcCuckooFilter_NextRandom(filter) % _PARCCuckooFilter_SlotsPerBucket);
+
+        uint16_t displaced = slots[slot];
+        slots[slot] = fingerprint;
+        fingerprint = displaced;
+
+        current = _parcCuckooFilter_AlternateBucket(filter, current, fingerprint);
+        if (_parcCuckooFilter_BucketInsert(filter, current, fingerprint)) {
+            filter->count++;
+            return true;
+        }
+    }
+
+    // The new element was placed, but the displaced fingerprint was not. Keep it so it still matches.
+    filter->hasVictim = true;
+    filter->victimFingerprint = fingerprint;
+    filter->victimBucket = current;
+    filter->count++;
+    return true;
+}
+
+static void
+_parcCuckooFilter_Finalize(PARCCuckooFilter **instancePtr)
+{
+    assertNotNull(instancePtr, "Parameter must be a non-null pointer to a PARCCuckooFilter pointer.");
+    PARCCuckooFilter *filter = *instancePtr;
+
+    parcMemory_Deallocate((void **) &filter->slots);
+}
+
+parcObject_ImplementAcquire(parcCuckooFilter, PARCCuckooFilter);
+
+parcObject_ImplementRelease(parcCuckooFilter, PARCCuckooFilter);
+
+parcObject_ExtendPARCObject(PARCCuckooFilter, _parcCuckooFilter_Finalize, parcCuckooFilter_Copy, NULL, parcCuckooFilter_Equals, NULL, NULL, NULL);
+
+void
+parcCuckooFilter_AssertValid(const PARCCuckooFilter *instance)
+{
+    assertTrue(parcCuckooFilter_IsValid(instance),
+               "PARCCuckooFilter is not valid.");
+}
+
+bool
+parcCuckooFilter_IsValid(const PARCCuckooFilter *instance)
+{
+    bool result = false;
+
+    if (instance != NULL) {
+        result = instance->slots != NULL && ((instance->bucketMask + 1) & instance->bucketMask) == 0;
+    }
+
+    return result;
+}
+
+static PARCCuckooFilter *
+_parcCuckooFilter_CreateWithBuckets(size_t bucketCount)
+{
+    PARCCuckooFilter *result = parcObject_CreateInstance(PARCCuckooFilter);
+
+    if (result != NULL) {
+        size_t length = bucketCount * _PARCCuckooFilter_SlotsPerBucket * sizeof(uint16_t);
+        result->slots = parcMemory_AllocateAndClear(length);
+        assertNotNull(result->slots, "parcMemory_AllocateAndClear(%zu) returned NULL", length);
+        result->bucketMask = bucketCount - 1;
+        result->count = 0;
+        result->random = 0x2545F4914F6CDD1DULL;
+        result->hasVictim = false;
+        result->victimFingerprint = _PARCCuckooFilter_EmptySlot;
+        result->victimBucket = 0;
+    }
+
+    return result;
+}
+
+PARCCuckooFilter *
+parcCuckooFilter_Create(size_t expectedElements)
+{
+    trapIllegalValueIf(expectedElements == 0, "The expected number of elements must be greater than zero.");
+
+    // Leave headroom for the 95% load at which insertions start to fail.
+    size_t required = (size_t) ((double) expectedElements / (_PARCCuckooFilter_SlotsPerBucket * 0.95)) + 1;
+    size_t bucketCount = 1;
+    while (bucketCount < required) {
+        bucketCount <<= 1;
+    }
+
+    return _parcCuckooFilter_CreateWithBuckets(bucketCount);
+}
+
+PARCCuckooFilter *
+parcCuckooFilter_Copy(const PARCCuckooFilter *original)
+{
+    parcCuckooFilter_OptionalAssertValid(original);
+
+    PARCCuckooFilter *result = _parcCuckooFilter_CreateWithBuckets(original->bucketMask + 1);
+    if (result != NULL) {
+        memcpy(result->slots, original->slots, _parcCuckooFilter_SlotCount(original) * sizeof(uint16_t));
+        result->count = original->count;
+        result->random = original->random;
+        result->hasVictim = original->hasVictim;
+        result->victimFingerprint = original->victimFingerprint;
+        result->victimBucket = original->victimBucket;
+    }
+
+    return result;
+}
+
+bool
+parcCuckooFilter_Equals(const PARCCuckooFilter *x, const PARCCuckooFilter *y)
+{
+    bool result = false;
+
+    if (x == y) {
+        result = true;
+    } else if (x == NULL || y == NULL) {
+        result = false;
+    } else if (x->bucketMask == y->bucketMask && x->count == y->count && x->hasVictim == y->hasVictim) {
+        if (!x->hasVictim || (x->victimFingerprint == y->victimFingerprint && x->victimBucket == y->victimBucket)) {
+            result = memcmp(x->slots, y->slots, _parcCuckooFilter_SlotCount(x) * sizeof(uint16_t)) == 0;
+        }
+    }
+
+    return result;
+}
+
+bool
+parcCuckooFilter_AddHash(PARCCuckooFilter *filter, uint64_t hash)
+{
+    parcCuckooFilter_OptionalAssertValid(filter);
+
+    uint64_t mixed = _parcCuckooFilter_Mix(hash);
+    return _parcCuckooFilter_Insert(filter, (size_t) mixed & filter->bucketMask, _parcCuckooFilter_Fingerprint(mixed));
+}
+
+bool
+parcCuckooFilter_ContainsHash(const PARCCuckooFilter *filter, uint64_t hash)
+{
+    parcCuckooFilter_OptionalAssertValid(filter);
+
+    uint64_t mixed = _parcCuckooFilter_Mix(hash);
+    uint16_t fingerprint = _parcCuckooFilter_Fingerprint(mixed);
+    size_t bucket = (size_t) mixed & filter->bucketMask;
+    size_t alternate = _parcCuckooFilter_AlternateBucket(filter, bucket, fingerprint);
+
+    bool result = _parcCuckooFilter_BucketContains(filter, bucket, fingerprint)
+                  || _parcCuckooFilter_BucketContains(filter, alternate, fingerprint);
+
+    if (!result && filter->hasVictim && filter->victimFingerprint == fingerprint) {
+        result = filter->victimBucket == bucket || filter->victimBucket == alternate;
+    }
+
+    return result;
+}
+
+bool
+parcCuckooFilter_RemoveHash(PARCCuckooFilter *filter, uint64_t hash)
+{
+    parcCuckooFilter_OptionalAssertValid(filter);
+
+    uint64_t mixed = _parcCuckooFilter_Mix(hash);
+    uint16_t fingerprint = _parcCuckooFilter_Fingerprint(mixed);
+    size_t bucket = (size_t) mixed & filter->bucketMask;
+    size_t alternate = _parcCuckooFilter_AlternateBucket(filter, bucket, fingerprint);
+
+    bool result = false;
+
+    if (_parcCuckooFilter_BucketRemove(filter, bucket, fingerprint) || _parcCuckooFilter_BucketRemove(filter, alternate, fingerprint)) {
+        result = true;
+    } else if (filter->hasVictim && filter->victimFingerprint == fingerprint
+               && (filter->victimBucket == bucket || filter->victimBucket == alternate)) {
+        filter->hasVictim = false;
+        filter->count--;
+        return true;
+    }
+
+    if (result) {
+        filter->count--;
+
+        // There is now room, so try to place the victim again.
+        if (filter->hasVictim) {
+            filter->hasVictim = false;
+            filter->count--;
+            _parcCuckooFilter_Insert(filter, filter->victimBucket, filter->victimFingerprint);
+        }
+    }
+
+    return result;
+}
+
+bool
+parcCuckooFilter_AddData(PARCCuckooFilter *filter, const void *data, size_t length)
+{
+    return parcCuckooFilter_AddHash(filter, parcHash64_Data(data, length));
+}
+
+bool
+parcCuckooFilter_ContainsData(const PARCCuckooFilter *filter, const void *data, size_t length)
+{
+    return parcCuckooFilter_ContainsHash(filter, parcHash64_Data(data, length));
+}
+
+bool
+parcCuckooFilter_RemoveData(PARCCuckooFilter *filter, const void *data, size_t length)
+{
+    return parcCuckooFilter_RemoveHash(filter, parcHash64_Data(data, length));
+}
+
+bool
+parcCuckooFilter_AddBuffer(PARCCuckooFilter *filter, const PARCBuffer *element)
+{
+    PARCBuffer *buffer = (PARCBuffer *) element;
+    return parcCuckooFilter_AddData(filter, parcBuffer_Overlay(buffer, 0), parcBuffer_Remaining(buffer));
+}
+
+bool
+parcCuckooFilter_ContainsBuffer(const PARCCuckooFilter *filter, const PARCBuffer *element)
+{
+    PARCBuffer *buffer = (PARCBuffer *) element;
+    return parcCuckooFilter_ContainsData(filter, parcBuffer_Overlay(buffer, 0), parcBuffer_Remaining(buffer));
+}
+
+bool
+parcCuckooFilter_RemoveBuffer(PARCCuckooFilter *filter, const PARCBuffer *element)
+{
+    PARCBuffer *buffer = (PARCBuffer *) element;
+    return parcCuckooFilter_RemoveData(filter, parcBuffer_Overlay(buffer, 0), parcBuffer_Remaining(buffer));
+}
+
+bool
+parcCuckooFilter_Union(PARCCuckooFilter *filter, const PARCCuckooFilter *other)
+{
+    parcCuckooFilter_OptionalAssertValid(filter);
+    parcCuckooFilter_OptionalAssertValid(other);
+    trapIllegalValueIf(filter->bucketMask != other->bucketMask,
+                       "Filters must have the same number of buckets: %zu vs %zu", filter->bucketMask + 1, other->bucketMask + 1);
+
+    // Keep the receiver's state, so that a union that does not fit leaves it unchanged.
+    size_t slotBytes = _parcCuckooFilter_SlotCount(filter) * sizeof(uint16_t);
+    uint16_t *savedSlots = parcMemory_Allocate(slotBytes);
+    assertNotNull(savedSlots, "parcMemory_Allocate(%zu) returned NULL", slotBytes);
+    memcpy(savedSlots, filter->slots, slotBytes);
+    PARCCuckooFilter saved = *filter;
+
+    // Each fingerprint goes into the same bucket it occupies in the other filter, which is one of its two candidates.
+    bool result = true;
+    size_t bucketCount = other->bucketMask + 1;
+    for (size_t bucket = 0; bucket < bucketCount && result; bucket++) {
+        const uint16_t *slots = _parcCuckooFilter_Bucket(other, bucket);
+        for (int i = 0; i < _PARCCuckooFilter_SlotsPerBucket && result; i++) {
+            if (slots[i] != _PARCCuckooFilter_EmptySlot) {
+                result = _parcCuckooFilter_Insert(filter, bucket, slots[i]);
+            }
+        }
+    }
+    if (result && other->hasVictim) {
+        result = _parcCuckooFilter_Insert(filter, other->victimBucket, other->victimFingerprint);
+    }
+
+    if (!result) {
+        memcpy(saved.slots, savedSlots, slotBytes);
+        *filter = saved;
+    }
+    parcMemory_Deallocate((void **) &savedSlots);
+
+    return result;
+}
+
+void
+parcCuckooFilter_Clear(PARCCuckooFilter *filter)
+{
+    parcCuckooFilter_OptionalAssertValid(filter);
+
+    memset(filter->slots, 0, _parcCuckooFilter_SlotCount(filter) * sizeof(uint16_t));
+    filter->count = 0;
+    filter->hasVictim = false;
+}
+
+size_t
+parcCuckooFilter_Count(const PARCCuckooFilter *filter)
+{
+    parcCuckooFilter_OptionalAssertValid(filter);
+
+    return filter->count;
+}
+
+size_t
+parcCuckooFilter_Capacity(const PARCCuckooFilter *filter)
+{
+    parcCuckooFilter_OptionalAssertValid(filter);
+
+    return _parcCuckooFilter_SlotCount(filter);
+}
+
+PARCBuffer *
+parcCuckooFilter_ToBuffer(const PARCCuckooFilter *filter)
+{
+    parcCuckooFilter_OptionalAssertValid(filter);
+
+    size_t slotCount = _parcCuckooFilter_SlotCount(filter);
+    PARCBuffer *result = parcBuffer_Allocate(2 * sizeof(uint32_t) + 3 * sizeof(uint64_t) + sizeof(uint16_t)
+                                             + slotCount * sizeof(uint16_t));
+
+    parcBuffer_PutUint32(result, _PARCCuckooFilter_Magic);
+    parcBuffer_PutUint32(result, filter->hasVictim ? 1 : 0);
+    parcBuffer_PutUint64(result, filter->bucketMask + 1);
+    parcBuffer_PutUint64(result, filter->count);
+    parcBuffer_PutUint64(result, filter->victimBucket);
+    parcBuffer_PutUint16(result, filter->victimFingerprint);
+    for (size_t i = 0; i < slotCount; i++) {
+        parcBuffer_PutUint16(result, filter->slots[i]);
+    }
+
+    return parcBuffer_Flip(result);
+}
+
+PARCCuckooFilter *
+parcCuckooFilter_CreateFromBuffer(PARCBuffer *buffer)
+{
+    PARCCuckooFilter *result = NULL;
+
+    size_t headerLength = 2 * sizeof(uint32_t) + 3 * sizeof(uint64_t) + sizeof(uint16_t);
+    if (parcBuffer_Remaining(buffer) >= headerLength) {
+        size_t start = parcBuffer_Position(buffer);
+
+        uint32_t magic = parcBuffer_GetUint32(buffer);
+        uint32_t hasVictim = parcBuffer_GetUint32(buffer);
+        uint64_t bucketCount = parcBuffer_GetUint64(buffer);
+        uint64_t count = parcBuffer_GetUint64(buffer);
+        uint64_t victimBucket = parcBuffer_GetUint64(buffer);
+        uint16_t victimFingerprint = parcBuffer_GetUint16(buffer);
+
+        bool valid = magic == _PARCCuckooFilter_Magic
+                     && hasVictim <= 1
+                     && bucketCount > 0 && (bucketCount & (bucketCount - 1)) == 0
+                     && victimBucket < bucketCount
+                     && parcBuffer_Remaining(buffer) / (_PARCCuckooFilter_SlotsPerBucket * sizeof(uint16_t)) >= bucketCount;
+
+        if (valid) {
+            result = _parcCuckooFilter_CreateWithBuckets((size_t) bucketCount);
+            size_t slotCount = _parcCuckooFilter_SlotCount(result);
+            for (size_t i = 0; i < slotCount; i++) {
+                result->slots[i] = parcBuffer_GetUint16(buffer);
+            }
+            result->count = (size_t) count;
+            result->hasVictim = hasVictim == 1;
+            result->victimBucket = (size_t) victimBucket;
+            result->victimFingerprint = victimFingerprint;
+        } else {
+            parcBuffer_SetPosition(buffer, start);
+        }
+    }
+
+    return result;
+}
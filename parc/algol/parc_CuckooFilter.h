@@ -0,0 +1,495 @@
+/*
+ * Copyright (c) 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Patent rights are not granted under this agreement. Patent rights are
+ *       available under FRAND terms.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX or PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * @file parc_CuckooFilter.h
+ * @ingroup datastructures
+ * @brief A cuckoo filter for probabilistic set membership with deletion.
+ *
+ * A `PARCCuckooFilter` stores a 16-bit fingerprint of each element in one of two candidate buckets
+ * of four slots, chosen by partial-key cuckoo hashing.
+ * Like a Bloom filter it answers "definitely not present" or "probably present",
+ * but an element can also be removed, provided it was previously added.
+ *
+ * The false positive rate is about 8 / 65536 (0.012%) at any load, and a filter can be filled
+ * to roughly 95% of its slots before an insertion fails.
+ *
+ * Adding the same element more than once stores a fingerprint for each addition,
+ * and each must be removed separately. At most eight copies of an element can be stored.
+ *
+ * Filters with the same number of buckets may be combined with `parcCuckooFilter_Union`,
+ * and may be serialized to and from a `PARCBuffer`.
+ *
+ * @copyright 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC).  All rights reserved.
+ */
+#ifndef libparc_parc_CuckooFilter_h
+#define libparc_parc_CuckooFilter_h
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <parc/algol/parc_Buffer.h>
+
+struct PARCCuckooFilter;
+typedef struct PARCCuckooFilter PARCCuckooFilter;
+
+#ifdef PARCLibrary_DISABLE_VALIDATION
+#  define parcCuckooFilter_OptionalAssertValid(_instance_)
+#else
+#  define parcCuckooFilter_OptionalAssertValid(_instance_) parcCuckooFilter_AssertValid(_instance_)
+#endif
+
+/**
+ * Create a `PARCCuckooFilter` with room for at least the expected number of elements.
+ *
+ * The number of buckets is a power of two, so the capacity may be up to twice that requested.
+ *
+ * @param [in] expectedElements The number of elements expected to be added. Must be greater than zero.
+ *
+ * @return non-NULL A pointer to a valid, empty PARCCuckooFilter instance.
+ * @return NULL An error occurred.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCCuckooFilter *filter = parcCuckooFilter_Create(1000000);
+ *
+ *     parcCuckooFilter_Release(&filter);
+ * }
+ * @endcode
+ */
+PARCCuckooFilter *parcCuckooFilter_Create(size_t expectedElements);
+
+/**
+ * Create a `PARCCuckooFilter` from the serialized form produced by `parcCuckooFilter_ToBuffer`.
+ *
+ * The serialized filter is read from the buffer's current position, which is advanced past it.
+ *
+ * @param [in,out] buffer A pointer to a valid PARCBuffer instance.
+ *
+ * @return non-NULL A pointer to a valid PARCCuckooFilter instance.
+ * @return NULL The buffer does not contain a serialized PARCCuckooFilter.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCBuffer *buffer = parcCuckooFilter_ToBuffer(filter);
+ *
+ *     PARCCuckooFilter *copy = parcCuckooFilter_CreateFromBuffer(buffer);
+ *
+ *     parcCuckooFilter_Release(&copy);
+ *     parcBuffer_Release(&buffer);
+ * }
+ * @endcode
+ */
+PARCCuckooFilter *parcCuckooFilter_CreateFromBuffer(PARCBuffer *buffer);
+
+/**
+ * Increase the number of references to a `PARCCuckooFilter` instance.
+ *
+ * @param [in] instance A pointer to a valid PARCCuckooFilter instance.
+ *
+ * @return The same value as @p instance.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCCuckooFilter *a = parcCuckooFilter_Create(1000);
+ *
+ *     PARCCuckooFilter *b = parcCuckooFilter_Acquire(a);
+ *
+ *     parcCuckooFilter_Release(&a);
+ *     parcCuckooFilter_Release(&b);
+ * }
+ * @endcode
+ */
+PARCCuckooFilter *parcCuckooFilter_Acquire(const PARCCuckooFilter *instance);
+
+/**
+ * Release a previously acquired reference to the given `PARCCuckooFilter` instance,
+ * decrementing the reference count for the instance.
+ *
+ * The pointer to the instance is set to NULL as a side-effect of this function.
+ *
+ * @param [in,out] instancePtr A pointer to a pointer to the instance to release.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCCuckooFilter *a = parcCuckooFilter_Create(1000);
+ *
+ *     parcCuckooFilter_Release(&a);
+ * }
+ * @endcode
+ */
+void parcCuckooFilter_Release(PARCCuckooFilter **instancePtr);
+
+/**
+ * Create an independent copy of the given `PARCCuckooFilter`.
+ *
+ * @param [in] original A pointer to a valid PARCCuckooFilter instance.
+ *
+ * @return non-NULL A pointer to a new PARCCuckooFilter instance equal to @p original.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCCuckooFilter *copy = parcCuckooFilter_Copy(filter);
+ *
+ *     parcCuckooFilter_Release(&copy);
+ * }
+ * @endcode
+ */
+PARCCuckooFilter *parcCuckooFilter_Copy(const PARCCuckooFilter *original);
+
+/**
+ * Determine if two `PARCCuckooFilter` instances have the same buckets and the same contents.
+ *
+ * @param [in] x A pointer to a PARCCuckooFilter instance, or NULL.
+ * @param [in] y A pointer to a PARCCuckooFilter instance, or NULL.
+ *
+ * @return true The filters are equal.
+ * @return false The filters are not equal.
+ *
+ * Example:
+ * @code
+ * {
+ *     if (parcCuckooFilter_Equals(a, b)) {
+ *         ...
+ *     }
+ * }
+ * @endcode
+ */
+bool parcCuckooFilter_Equals(const PARCCuckooFilter *x, const PARCCuckooFilter *y);
+
+/**
+ * Determine if an instance of `PARCCuckooFilter` is valid.
+ *
+ * @param [in] instance A pointer to a PARCCuckooFilter instance.
+ *
+ * @return true The instance is valid.
+ * @return false The instance is not valid.
+ *
+ * Example:
+ * @code
+ * {
+ *     if (parcCuckooFilter_IsValid(filter)) {
+ *         ...
+ *     }
+ * }
+ * @endcode
+ */
+bool parcCuckooFilter_IsValid(const PARCCuckooFilter *instance);
+
+/**
+ * Assert that the given `PARCCuckooFilter` instance is valid.
+ *
+ * @param [in] instance A pointer to a valid PARCCuckooFilter instance.
+ *
+ * Example:
+ * @code
+ * {
+ *     parcCuckooFilter_AssertValid(filter);
+ * }
+ * @endcode
+ */
+void parcCuckooFilter_AssertValid(const PARCCuckooFilter *instance);
+
+/**
+ * Add an element, identified by a 64-bit hash of it, to the filter.
+ *
+ * If the filter is too full to place the element, the element is still remembered
+ * (so there are no false negatives) but the filter accepts no further additions until
+ * elements are removed.
+ *
+ * @param [in] filter A pointer to a valid PARCCuckooFilter instance.
+ * @param [in] hash A 64-bit hash of the element.
+ *
+ * @return true The element was added.
+ * @return false The filter is full and the element was not added.
+ *
+ * Example:
+ * @code
+ * {
+ *     if (!parcCuckooFilter_AddHash(filter, parcHash64_Int64(identifier))) {
+ *         // The filter is full.
+ *     }
+ * }
+ * @endcode
+ */
+bool parcCuckooFilter_AddHash(PARCCuckooFilter *filter, uint64_t hash);
+
+/**
+ * Determine if an element, identified by a 64-bit hash of it, may be in the filter.
+ *
+ * @param [in] filter A pointer to a valid PARCCuckooFilter instance.
+ * @param [in] hash A 64-bit hash of the element.
+ *
+ * @return true The element is probably in the filter.
+ * @return false The element is definitely not in the filter.
+ *
+ * Example:
+ * @code
+ * {
+ *     if (parcCuckooFilter_ContainsHash(filter, parcHash64_Int64(identifier))) {
+ *         ...
+ *     }
+ * }
+ * @endcode
+ */
+bool parcCuckooFilter_ContainsHash(const PARCCuckooFilter *filter, uint64_t hash);
+
+/**
+ * Remove one copy of an element, identified by a 64-bit hash of it, from the filter.
+ *
+ * Only remove elements that are known to have been added,
+ * otherwise an element sharing a fingerprint and bucket with it may be removed instead.
+ *
+ * @param [in] filter A pointer to a valid PARCCuckooFilter instance.
+ * @param [in] hash A 64-bit hash of the element.
+ *
+ * @return true A copy of the element was removed.
+ * @return false The element was not in the filter.
+ *
+ * Example:
+ * @code
+ * {
+ *     parcCuckooFilter_RemoveHash(filter, parcHash64_Int64(identifier));
+ * }
+ * @endcode
+ */
+bool parcCuckooFilter_RemoveHash(PARCCuckooFilter *filter, uint64_t hash);
+
+/**
+ * Add an element, given as an array of bytes, to the filter.
+ *
+ * @param [in] filter A pointer to a valid PARCCuckooFilter instance.
+ * @param [in] data A pointer to the bytes of the element.
+ * @param [in] length The number of bytes in the element.
+ *
+ * @return true The element was added.
+ * @return false The filter is full and the element was not added.
+ *
+ * Example:
+ * @code
+ * {
+ *     parcCuckooFilter_AddData(filter, "hello", 5);
+ * }
+ * @endcode
+ */
+bool parcCuckooFilter_AddData(PARCCuckooFilter *filter, const void *data, size_t length);
+
+/**
+ * Determine if an element, given as an array of bytes, may be in the filter.
+ *
+ * @param [in] filter A pointer to a valid PARCCuckooFilter instance.
+ * @param [in] data A pointer to the bytes of the element.
+ * @param [in] length The number of bytes in the element.
+ *
+ * @return true The element is probably in the filter.
+ * @return false The element is definitely not in the filter.
+ *
+ * Example:
+ * @code
+ * {
+ *     if (parcCuckooFilter_ContainsData(filter, "hello", 5)) {
+ *         ...
+ *     }
+ * }
+ * @endcode
+ */
+bool parcCuckooFilter_ContainsData(const PARCCuckooFilter *filter, const void *data, size_t length);
+
+/**
+ * Remove one copy of an element, given as an array of bytes, from the filter.
+ *
+ * @param [in] filter A pointer to a valid PARCCuckooFilter instance.
+ * @param [in] data A pointer to the bytes of the element.
+ * @param [in] length The number of bytes in the element.
+ *
+ * @return true A copy of the element was removed.
+ * @return false The element was not in the filter.
+ *
+ * Example:
+ * @code
+ * {
+ *     parcCuckooFilter_RemoveData(filter, "hello", 5);
+ * }
+ * @endcode
+ */
+bool parcCuckooFilter_RemoveData(PARCCuckooFilter *filter, const void *data, size_t length);
+
+/**
+ * Add the remaining bytes of a `PARCBuffer` to the filter as an element.
+ *
+ * The position of the buffer is not changed.
+ *
+ * @param [in] filter A pointer to a valid PARCCuckooFilter instance.
+ * @param [in] element A pointer to a valid PARCBuffer instance.
+ *
+ * @return true The element was added.
+ * @return false The filter is full and the element was not added.
+ *
+ * Example:
+ * @code
+ * {
+ *     parcCuckooFilter_AddBuffer(filter, name);
+ * }
+ * @endcode
+ */
+bool parcCuckooFilter_AddBuffer(PARCCuckooFilter *filter, const PARCBuffer *element);
+
+/**
+ * Determine if the remaining bytes of a `PARCBuffer` may be an element of the filter.
+ *
+ * The position of the buffer is not changed.
+ *
+ * @param [in] filter A pointer to a valid PARCCuckooFilter instance.
+ * @param [in] element A pointer to a valid PARCBuffer instance.
+ *
+ * @return true The element is probably in the filter.
+ * @return false The element is definitely not in the filter.
+ *
+ * Example:
+ * @code
+ * {
+ *     if (parcCuckooFilter_ContainsBuffer(filter, name)) {
+ *         ...
+ *     }
+ * }
+ * @endcode
+ */
+bool parcCuckooFilter_ContainsBuffer(const PARCCuckooFilter *filter, const PARCBuffer *element);
+
+/**
+ * Remove one copy of the remaining bytes of a `PARCBuffer` from the filter.
+ *
+ * The position of the buffer is not changed.
+ *
+ * @param [in] filter A pointer to a valid PARCCuckooFilter instance.
+ * @param [in] element A pointer to a valid PARCBuffer instance.
+ *
+ * @return true A copy of the element was removed.
+ * @return false The element was not in the filter.
+ *
+ * Example:
+ * @code
+ * {
+ *     parcCuckooFilter_RemoveBuffer(filter, name);
+ * }
+ * @endcode
+ */
+bool parcCuckooFilter_RemoveBuffer(PARCCuckooFilter *filter, const PARCBuffer *element);
+
+/**
+ * Add every element of @p other to @p filter.
+ *
+ * The filters must have the same capacity, such as filters created with the same parameters.
+ * The union is all or nothing: if @p filter would become full, it is left unchanged.
+ *
+ * @param [in,out] filter A pointer to a valid PARCCuckooFilter instance that receives the union.
+ * @param [in] other A pointer to a valid PARCCuckooFilter instance with the same capacity as @p filter.
+ *
+ * @return true Every element of @p other was added.
+ * @return false @p filter does not have room for the elements of @p other, and is unchanged.
+ *
+ * Example:
+ * @code
+ * {
+ *     for (int i = 0; i < workerCount; i++) {
+ *         parcCuckooFilter_Union(merged, workerFilters[i]);
+ *     }
+ * }
+ * @endcode
+ */
+bool parcCuckooFilter_Union(PARCCuckooFilter *filter, const PARCCuckooFilter *other);
+
+/**
+ * Remove all elements from the filter.
+ *
+ * @param [in,out] filter A pointer to a valid PARCCuckooFilter instance.
+ *
+ * Example:
+ * @code
+ * {
+ *     parcCuckooFilter_Clear(filter);
+ * }
+ * @endcode
+ */
+void parcCuckooFilter_Clear(PARCCuckooFilter *filter);
+
+/**
+ * Get the number of elements in the filter.
+ *
+ * @param [in] filter A pointer to a valid PARCCuckooFilter instance.
+ *
+ * @return The number of elements.
+ *
+ * Example:
+ * @code
+ * {
+ *     size_t count = parcCuckooFilter_Count(filter);
+ * }
+ * @endcode
+ */
+size_t parcCuckooFilter_Count(const PARCCuckooFilter *filter);
+
+/**
+ * Get the number of fingerprint slots in the filter.
+ *
+ * @param [in] filter A pointer to a valid PARCCuckooFilter instance.
+ *
+ * @return The number of slots. Insertions may begin to fail at about 95% of this.
+ *
+ * Example:
+ * @code
+ * {
+ *     double load = (double) parcCuckooFilter_Count(filter) / parcCuckooFilter_Capacity(filter);
+ * }
+ * @endcode
+ */
+size_t parcCuckooFilter_Capacity(const PARCCuckooFilter *filter);
+
+/**
+ * Serialize the filter into a new `PARCBuffer`.
+ *
+ * The returned buffer is flipped, ready to be read or written elsewhere.
+ *
+ * @param [in] filter A pointer to a valid PARCCuckooFilter instance.
+ *
+ * @return non-NULL A pointer to a PARCBuffer containing the serialized filter, which the caller must release.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCBuffer *buffer = parcCuckooFilter_ToBuffer(filter);
+ *     ...
+ *     parcBuffer_Release(&buffer);
+ * }
+ * @endcode
+ */
+PARCBuffer *parcCuckooFilter_ToBuffer(const PARCCuckooFilter *filter);
+#endif // libparc_parc_CuckooFilter_h
@@ -222,6 +222,42 @@ parcDeque_Iterator(PARCDeque *deque)
     return iterator;
 }
 
+PARCCursor
+parcDeque_Cursor(const PARCDeque *deque)
+{
+    PARCCursor result = { .collection = deque, .position = NULL, .index = 0 };
+    return result;
+}
+
+bool
+parcDeque_CursorHasNext(const PARCCursor *cursor)
+{
+    const struct parc_deque_node *node = cursor->position;
+
+    if (node == NULL) {
+        return ((const PARCDeque *) cursor->collection)->head != NULL;
+    }
+    return node->next != NULL;
+}
+
+void *
+parcDeque_CursorNext(PARCCursor *cursor)
+{
+    struct parc_deque_node *node = cursor->position;
+
+    if (node == NULL) {
+        node = ((const PARCDeque *) cursor->collection)->head;
+    } else {
+        node = node->next;
+    }
+    trapOutOfBoundsIf(node == NULL, "No more elements.");
+
+    cursor->position = node;
+    cursor->index++;
+
+    return node->element;
+}
+
 PARCDeque *
 parcDeque_Create(void)
 {
@@ -73,6 +73,71 @@ PARCDeque *parcDeque_Create(void);
 
 PARCIterator *parcDeque_Iterator(PARCDeque *deque);
 
+/**
+ * Create a `PARCCursor` positioned before the first element of the given `PARCDeque`.
+ *
+ * The cursor is returned by value and requires no allocation or release.
+ * The deque must not be modified while the cursor is in use.
+ *
+ * @param [in] deque A pointer to a valid `PARCDeque`.
+ *
+ * @return A `PARCCursor` for use with {@link parcDeque_CursorHasNext} and {@link parcDeque_CursorNext}.
+ *
+ * Example:
+ * @code
+ * {
+ *    PARCCursor cursor = parcDeque_Cursor(deque);
+ *
+ *    while (parcDeque_CursorHasNext(&cursor)) {
+ *        void *element = parcDeque_CursorNext(&cursor);
+ *    }
+ * }
+ * @endcode
+ */
+PARCCursor parcDeque_Cursor(const PARCDeque *deque);
+
+/**
+ * Return true if a call to {@link parcDeque_CursorNext} would return an element.
+ *
+ * @param [in] cursor A pointer to a `PARCCursor` initialised by {@link parcDeque_Cursor}.
+ *
+ * @return true There are more elements.
+ * @return false There are no more elements.
+ */
+bool parcDeque_CursorHasNext(const PARCCursor *cursor);
+
+/**
+ * Advance the cursor and return the next element of the deque, starting from the head.
+ *
+ * If there are no remaining elements, this function induces a trapOutOfBounds.
+ *
+ * @param [in,out] cursor A pointer to a `PARCCursor` initialised by {@link parcDeque_Cursor}.
+ *
+ * @return The next element of the deque.
+ */
+void *parcDeque_CursorNext(PARCCursor *cursor);
+
+/**
+ * Execute the following statement once for each element of the given `PARCDeque`, from head to tail,
+ * assigning each element in turn to the variable @p _element_.
+ *
+ * @param [in] _deque_ A pointer to a valid `PARCDeque`.
+ * @param [out] _element_ An lvalue that is assigned each element in turn.
+ *
+ * Example:
+ * @code
+ * {
+ *    void *element;
+ *    parcDeque_ForEach(deque, element) {
+ *        printf("%p\n", element);
+ *    }
+ * }
+ * @endcode
+ */
+#define parcDeque_ForEach(_deque_, _element_) \
+    for (PARCCursor _parcCursor = parcDeque_Cursor(_deque_); \
+         parcDeque_CursorHasNext(&_parcCursor) && ((_element_ = parcDeque_CursorNext(&_parcCursor)), true); )
+
 /**
  * Create a PARCDeque instance that uses the {@link PARCObjectDescriptor} providing functions for element equality and copy function.
  *
@@ -156,6 +156,32 @@ parcEventBuffer_ReadIntoBuffer(PARCEventBuffer *source, PARCEventBuffer *destina
     return evbuffer_remove_buffer(source->evbuffer, destination->evbuffer, length);
 }
 
+PARCBuffer *
+parcEventBuffer_ReadIntoPooledBuffer(PARCEventBuffer *eventBuffer, PARCBufferPool *pool, size_t length)
+{
+    parcEventBuffer_OptionalAssertValid(eventBuffer);
+
+    size_t available = evbuffer_get_length(eventBuffer->evbuffer);
+    if (length > available) {
+        length = available;
+    }
+    if (length == 0) {
+        return NULL;
+    }
+
+    PARCBuffer *result = parcBufferPool_GetBuffer(pool, length);
+    if (result != NULL) {
+        int nread = evbuffer_remove(eventBuffer->evbuffer, parcBuffer_Overlay(result, 0), length);
+        if (nread < 0) {
+            parcBuffer_Release(&result);
+        } else {
+            parcBuffer_SetLimit(result, nread);
+        }
+    }
+
+    return result;
+}
+
 int
 parcEventBuffer_Read(PARCEventBuffer *readBuffer, void *data, size_t length)
 {
@@ -235,6 +261,71 @@ parcEventBuffer_Append(PARCEventBuffer *parcEventBuffer, void *data, size_t leng
     return evbuffer_add(parcEventBuffer->evbuffer, data, length);
 }
 
+/*
+ * Called by libevent when it no longer refers to the bytes of a buffer added by parcEventBuffer_AppendBufferReference.
+ */
+static void
+_parcEventBuffer_ReleaseBufferReference(const void *data, size_t length, void *extra)
+{
+    PARCBuffer *buffer = extra;
+    parcBuffer_Release(&buffer);
+}
+
+int
+parcEventBuffer_AppendBufferReference(PARCEventBuffer *parcEventBuffer, const PARCBuffer *buffer)
+{
+    parcEventBuffer_OptionalAssertValid(parcEventBuffer);
+    assertNotNull(buffer, "parcEventBuffer_AppendBufferReference was passed a null buffer\n");
+
+    size_t length = parcBuffer_Remaining(buffer);
+    if (length == 0) {
+        return 0;
+    }
+
+    PARCBuffer *reference = parcBuffer_Acquire(buffer);
+    int result = evbuffer_add_reference(parcEventBuffer->evbuffer, parcBuffer_Overlay(reference, 0), length,
+                                        _parcEventBuffer_ReleaseBufferReference, reference);
+    if (result != 0) {
+        parcBuffer_Release(&reference);
+    }
+    return result;
+}
+
+size_t
+parcEventBuffer_PeekAsBuffers(PARCEventBuffer *parcEventBuffer, size_t length, size_t count, PARCBuffer *buffers[count])
+{
+    parcEventBuffer_OptionalAssertValid(parcEventBuffer);
+
+    size_t available = evbuffer_get_length(parcEventBuffer->evbuffer);
+    if (length > available) {
+        length = available;
+    }
+
+    struct evbuffer_ptr position;
+    evbuffer_ptr_set(parcEventBuffer->evbuffer, &position, 0, EVBUFFER_PTR_SET);
+
+    size_t result = 0;
+    while (length > 0 && result < count) {
+        struct evbuffer_iovec extent;
+        if (evbuffer_peek(parcEventBuffer->evbuffer, (ev_ssize_t) length, &position, &extent, 1) < 1) {
+            break;
+        }
+
+        size_t extentLength = (extent.iov_len < length) ? extent.iov_len : length;
+        buffers[result] = parcBuffer_Wrap(extent.iov_base, extentLength, 0, extentLength);
+        if (buffers[result] == NULL) {
+            break;
+        }
+        result++;
+
+        length -= extentLength;
+        if (length > 0) {
+            evbuffer_ptr_set(parcEventBuffer->evbuffer, &position, extentLength, EVBUFFER_PTR_ADD);
+        }
+    }
+    return result;
+}
+
 int
 parcEventBuffer_Prepend(PARCEventBuffer *readBuffer, void *data, size_t length)
 {
@@ -41,6 +41,7 @@
 #define libparc_parc_EventBuffer_h
 
 #include <parc/algol/parc_EventQueue.h>
+#include <parc/algol/parc_BufferPool.h>
 
 #ifdef PARCLibrary_DISABLE_VALIDATION
 #  define parcEventBuffer_OptionalAssertValid(_instance_)
@@ -284,6 +285,64 @@ int parcEventBuffer_AppendBuffer(PARCEventBuffer *source, PARCEventBuffer *desti
  */
 int parcEventBuffer_Append(PARCEventBuffer *parcEventBuffer, void *sourceData, size_t length);
 
+/**
+ * Append the remaining bytes of a `PARCBuffer` to a parcEventBuffer without copying them.
+ *
+ * The event buffer refers to the bytes of @p buffer and holds a reference to it, which is released when
+ * the event buffer has finished with the bytes (normally once they have been written to the socket).
+ * The bytes must not be modified until then; a frozen buffer (see `parcBuffer_Freeze`) guarantees this.
+ * The position of @p buffer is unchanged.
+ *
+ * @param [in] parcEventBuffer - The buffer to write into
+ * @param [in] buffer - The buffer whose remaining bytes are to be appended
+ * @returns 0 on success, -1 on failure
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCEventBuffer *output = parcEventBuffer_GetQueueBufferOutput(queue);
+ *     parcEventBuffer_AppendBufferReference(output, packet);
+ *     parcBuffer_Release(&packet);
+ *     parcEventBuffer_Destroy(&output);
+ * }
+ * @endcode
+ *
+ */
+int parcEventBuffer_AppendBufferReference(PARCEventBuffer *parcEventBuffer, const PARCBuffer *buffer);
+
+/**
+ * Expose the first @p length bytes of a parcEventBuffer as `PARCBuffer` instances, without copying or removing them.
+ *
+ * An event buffer keeps its data in a sequence of contiguous segments. Each returned buffer wraps one of them,
+ * in order, and the last is limited so that the buffers hold at most @p length bytes in total.
+ * At most @p count buffers are returned, so fewer than @p length bytes are exposed if the data spans more segments.
+ *
+ * The returned buffers refer to the event buffer's storage: they are valid only until the event buffer is next
+ * drained, read from or otherwise modified. Copy a buffer (`parcBuffer_Copy`) to keep its bytes longer.
+ * Each returned buffer must be released by the caller.
+ *
+ * @param [in] parcEventBuffer - The buffer to peek into
+ * @param [in] length - The largest number of bytes to expose
+ * @param [in] count - The number of elements of @p buffers
+ * @param [out] buffers - The array to receive the buffers
+ * @returns The number of buffers stored in @p buffers
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCBuffer *segments[4];
+ *     size_t count = parcEventBuffer_PeekAsBuffers(input, packetLength, 4, segments);
+ *     for (size_t i = 0; i < count; i++) {
+ *         ...
+ *         parcBuffer_Release(&segments[i]);
+ *     }
+ *     parcEventBuffer_Read(input, NULL, packetLength);
+ * }
+ * @endcode
+ *
+ */
+size_t parcEventBuffer_PeekAsBuffers(PARCEventBuffer *parcEventBuffer, size_t length, size_t count, PARCBuffer *buffers[count]);
+
 /**
  * Prepend data to the associated parcEventBuffer
  *
@@ -320,6 +379,29 @@ int parcEventBuffer_Prepend(PARCEventBuffer *parcEventBuffer, void *sourceData,
  */
 int parcEventBuffer_ReadIntoBuffer(PARCEventBuffer *sourceEventBuffer, PARCEventBuffer *destinationEventBuffer, size_t length);
 
+/**
+ * Remove up to @p length bytes from the front of the event buffer into a buffer from the given pool.
+ *
+ * The data is copied once, directly from the event buffer into the pooled buffer's storage.
+ * The returned buffer's position is 0 and its limit is the number of bytes read.
+ *
+ * @param [in] parcEventBuffer - The buffer to read from
+ * @param [in] pool - The pool from which to get the buffer
+ * @param [in] length - The largest number of bytes to read
+ * @returns A `PARCBuffer` from @p pool, which the caller must release, or NULL if the event buffer is empty
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCBuffer *packet = parcEventBuffer_ReadIntoPooledBuffer(parcEventBuffer, pool, packetLength);
+ *     ...
+ *     parcBuffer_Release(&packet);
+ * }
+ * @endcode
+ *
+ */
+PARCBuffer *parcEventBuffer_ReadIntoPooledBuffer(PARCEventBuffer *parcEventBuffer, PARCBufferPool *pool, size_t length);
+
 /**
  * Read a text line terminated by an optional carriage return, followed by a single linefeed
  *
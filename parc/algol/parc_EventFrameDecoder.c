@@ -0,0 +1,292 @@
+/*
+ * Copyright (c) 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Patent rights are not granted under this agreement. Patent rights are
+ *       available under FRAND terms.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX or PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * @copyright 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC).  All rights reserved.
+ */
+#include <config.h>
+
+#include <LongBow/runtime.h>
+
+#include <parc/algol/parc_Memory.h>
+#include <parc/algol/parc_EventFrameDecoder.h>
+
+#include <event2/buffer.h>
+
+struct PARCEventFrameDecoder {
+    PARCEventFrameDecoderConfig config;
+
+    PARCEventFrameDecoder_FrameCallback *frameCallback;
+    PARCEventFrameDecoder_ErrorCallback *errorCallback;
+    PARCEventQueue_EventCallback *eventCallback;
+    void *userData;
+
+    PARCEventFrameDecoderError error;
+    uint64_t frameCount;
+};
+
+static bool
+_parcEventFrameDecoder_IsValidFieldLength(size_t length)
+{
+    return length == 1 || length == 2 || length == 4;
+}
+
+static uint32_t
+_parcEventFrameDecoder_GetField(const uint8_t *bytes, size_t length, PARCEventFrameDecoderByteOrder byteOrder)
+{
+    uint32_t result = 0;
+    if (byteOrder == PARCEventFrameDecoderByteOrder_BigEndian) {
+        for (size_t i = 0; i < length; i++) {
+            result = (result << 8) | bytes[i];
+        }
+    } else {
+        for (size_t i = length; i > 0; i--) {
+            result = (result << 8) | bytes[i - 1];
+        }
+    }
+    return result;
+}
+
+/*
+ * Make a PARCBuffer of the frame at the given position of the input, whose contiguous extent is given:
+ * a wrapper of the input's own memory if the frame lies in one segment, otherwise a copy.
+ */
+static PARCBuffer *
+_parcEventFrameDecoder_Slice(PARCEventFrameDecoder *decoder, struct evbuffer *input, struct evbuffer_ptr *position,
+                             const struct evbuffer_iovec *extent, size_t frameLength)
+{
+    PARCBuffer *result = NULL;
+
+    if (extent->iov_len >= frameLength) {
+        result = parcBuffer_Wrap(extent->iov_base, frameLength, decoder->config.headerLength, frameLength);
+    } else {
+        result = parcBuffer_Allocate(frameLength);
+        evbuffer_copyout_from(input, position, parcBuffer_Overlay(result, 0), frameLength);
+        parcBuffer_SetPosition(result, decoder->config.headerLength);
+    }
+    return result;
+}
+
+static void
+_parcEventFrameDecoder_Fail(PARCEventFrameDecoder *decoder, PARCEventFrameDecoderError error)
+{
+    decoder->error = error;
+    if (decoder->errorCallback != NULL) {
+        decoder->errorCallback(decoder, error, decoder->userData);
+    }
+}
+
+static void
+_parcEventFrameDecoder_ReadCallback(PARCEventQueue *queue, PARCEventType type, void *decoder)
+{
+    parcEventFrameDecoder_Decode(decoder, queue);
+}
+
+static void
+_parcEventFrameDecoder_EventCallback(PARCEventQueue *queue, PARCEventQueueEventType type, void *decoder)
+{
+    PARCEventFrameDecoder *frameDecoder = decoder;
+    frameDecoder->eventCallback(queue, type, frameDecoder->userData);
+}
+
+PARCEventFrameDecoder *
+parcEventFrameDecoder_Create(const PARCEventFrameDecoderConfig *config,
+                             PARCEventFrameDecoder_FrameCallback *frameCallback,
+                             PARCEventFrameDecoder_ErrorCallback *errorCallback,
+                             void *userData)
+{
+    assertNotNull(config, "Parameter config must be a non-null pointer to a PARCEventFrameDecoderConfig");
+    assertNotNull(frameCallback, "Parameter frameCallback must be non-null");
+    trapIllegalValueIf(config->headerLength == 0 || config->headerLength > PARCEventFrameDecoder_MaximumHeaderLength,
+                       "The header length must be between 1 and %d", PARCEventFrameDecoder_MaximumHeaderLength);
+    trapIllegalValueIf(!_parcEventFrameDecoder_IsValidFieldLength(config->lengthLength),
+                       "The length field must be 1, 2 or 4 bytes long");
+    trapIllegalValueIf(config->lengthOffset + config->lengthLength > config->headerLength,
+                       "The length field must lie within the header");
+    trapIllegalValueIf(config->typeLength != 0 && !_parcEventFrameDecoder_IsValidFieldLength(config->typeLength),
+                       "The type field must be 0, 1, 2 or 4 bytes long");
+    trapIllegalValueIf(config->typeOffset + config->typeLength > config->headerLength,
+                       "The type field must lie within the header");
+    trapIllegalValueIf(config->maximumFrameLength < config->headerLength,
+                       "The maximum frame length must be at least the header length");
+
+    PARCEventFrameDecoder *result = parcMemory_AllocateAndClear(sizeof(PARCEventFrameDecoder));
+    assertNotNull(result, "parcMemory_AllocateAndClear(%zu) returned NULL", sizeof(PARCEventFrameDecoder));
+
+    result->config = *config;
+    result->frameCallback = frameCallback;
+    result->errorCallback = errorCallback;
+    result->eventCallback = NULL;
+    result->userData = userData;
+    result->error = PARCEventFrameDecoderError_None;
+    result->frameCount = 0;
+
+    return result;
+}
+
+void
+parcEventFrameDecoder_Destroy(PARCEventFrameDecoder **decoderPtr)
+{
+    assertNotNull(decoderPtr, "Parameter must be a non-null pointer to a PARCEventFrameDecoder pointer.");
+    parcEventFrameDecoder_OptionalAssertValid(*decoderPtr);
+
+    parcMemory_Deallocate((void **) decoderPtr);
+}
+
+bool
+parcEventFrameDecoder_IsValid(const PARCEventFrameDecoder *decoder)
+{
+    bool result = false;
+
+    if (decoder != NULL) {
+        result = decoder->frameCallback != NULL && decoder->config.headerLength > 0;
+    }
+
+    return result;
+}
+
+void
+parcEventFrameDecoder_AssertValid(const PARCEventFrameDecoder *decoder)
+{
+    assertTrue(parcEventFrameDecoder_IsValid(decoder), "PARCEventFrameDecoder is not valid.");
+}
+
+void
+parcEventFrameDecoder_Attach(PARCEventFrameDecoder *decoder, PARCEventQueue *queue,
+                             PARCEventQueue_EventCallback *eventCallback)
+{
+    parcEventFrameDecoder_OptionalAssertValid(decoder);
+
+    decoder->eventCallback = eventCallback;
+    parcEventQueue_SetCallbacks(queue, _parcEventFrameDecoder_ReadCallback, NULL,
+                                (eventCallback != NULL) ? _parcEventFrameDecoder_EventCallback : NULL, decoder);
+    parcEventQueue_SetWatermark(queue, PARCEventType_Read, decoder->config.headerLength, 0);
+    parcEventQueue_Enable(queue, PARCEventType_Read);
+}
+
+size_t
+parcEventFrameDecoder_Decode(PARCEventFrameDecoder *decoder, PARCEventQueue *queue)
+{
+    parcEventFrameDecoder_OptionalAssertValid(decoder);
+
+    const PARCEventFrameDecoderConfig *config = &decoder->config;
+    struct evbuffer *input = internal_parcEventQueue_GetEvInputBuffer(queue);
+
+    if (decoder->error != PARCEventFrameDecoderError_None) {
+        // Once a header is out of bounds the frame boundaries are lost, so nothing more can be decoded.
+        evbuffer_drain(input, evbuffer_get_length(input));
+        return 0;
+    }
+
+    size_t result = 0;
+    PARCEventFrameDecoderError error = PARCEventFrameDecoderError_None;
+    bool batchFilled = true;
+    while (batchFilled && error == PARCEventFrameDecoderError_None) {
+        size_t available = evbuffer_get_length(input);
+        size_t consumed = 0;
+        size_t count = 0;
+        PARCEventFrame frames[PARCEventFrameDecoder_BatchSize];
+
+        struct evbuffer_ptr position;
+        evbuffer_ptr_set(input, &position, 0, EVBUFFER_PTR_SET);
+
+        // Collect the complete frames at the front of the input without removing anything,
+        // so that the frames wrapped in place stay valid until they have been dispatched.
+        while (count < PARCEventFrameDecoder_BatchSize && available - consumed >= config->headerLength) {
+            // Read the header in place unless it is split between segments.
+            struct evbuffer_iovec extent;
+            evbuffer_peek(input, (ev_ssize_t) config->headerLength, &position, &extent, 1);
+            uint8_t headerCopy[PARCEventFrameDecoder_MaximumHeaderLength];
+            const uint8_t *header = extent.iov_base;
+            if (extent.iov_len < config->headerLength) {
+                evbuffer_copyout_from(input, &position, headerCopy, config->headerLength);
+                header = headerCopy;
+            }
+
+            uint64_t frameLength = _parcEventFrameDecoder_GetField(&header[config->lengthOffset], config->lengthLength,
+                                                                   config->byteOrder);
+            if (!config->lengthIncludesHeader) {
+                frameLength += config->headerLength;
+            }
+            if (frameLength < config->headerLength) {
+                error = PARCEventFrameDecoderError_FrameTooShort;
+                break;
+            }
+            if (frameLength > config->maximumFrameLength) {
+                error = PARCEventFrameDecoderError_FrameTooLong;
+                break;
+            }
+            if (available - consumed < frameLength) {
+                break;
+            }
+
+            frames[count].type = (config->typeLength == 0) ? 0 :
+                                 _parcEventFrameDecoder_GetField(&header[config->typeOffset], config->typeLength,
+                                                                 config->byteOrder);
+            frames[count].buffer = _parcEventFrameDecoder_Slice(decoder, input, &position, &extent, frameLength);
+            count++;
+            consumed += frameLength;
+            if (consumed < available) {
+                evbuffer_ptr_set(input, &position, frameLength, EVBUFFER_PTR_ADD);
+            }
+        }
+
+        if (count > 0) {
+            decoder->frameCount += count;
+            decoder->frameCallback(decoder, count, frames, decoder->userData);
+            for (size_t i = 0; i < count; i++) {
+                parcBuffer_Release(&frames[i].buffer);
+            }
+            evbuffer_drain(input, consumed);
+            result += count;
+        }
+        batchFilled = (count == PARCEventFrameDecoder_BatchSize);
+    }
+
+    // The frames before a bad header have been dispatched; the bad header and everything after it are dropped.
+    if (error != PARCEventFrameDecoderError_None) {
+        evbuffer_drain(input, evbuffer_get_length(input));
+        _parcEventFrameDecoder_Fail(decoder, error);
+    }
+
+    return result;
+}
+
+PARCEventFrameDecoderError
+parcEventFrameDecoder_GetError(const PARCEventFrameDecoder *decoder)
+{
+    parcEventFrameDecoder_OptionalAssertValid(decoder);
+
+    return decoder->error;
+}
+
+uint64_t
+parcEventFrameDecoder_GetFrameCount(const PARCEventFrameDecoder *decoder)
+{
+    parcEventFrameDecoder_OptionalAssertValid(decoder);
+
+    return decoder->frameCount;
+}
@@ -0,0 +1,273 @@
+/*
+ * Copyright (c) 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Patent rights are not granted under this agreement. Patent rights are
+ *       available under FRAND terms.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX or PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * @file parc_EventFrameDecoder.h
+ * @ingroup events
+ * @brief Split the input of a `PARCEventQueue` into length-prefixed frames.
+ *
+ * Many protocols send type-length-value frames: a fixed-size header holding a length field,
+ * and often a type field, followed by the frame's payload.
+ * A `PARCEventFrameDecoder` is configured with the layout of the header and the largest permitted frame.
+ * It finds every complete frame in a queue's input and passes them to a callback in batches,
+ * one call for up to `PARCEventFrameDecoder_BatchSize` frames, before removing them from the input.
+ *
+ * Each frame is given to the callback as a `PARCBuffer` spanning the whole frame, header included,
+ * with its position set to the start of the payload.
+ * A frame held in one contiguous segment of the input is wrapped in place, without copying;
+ * only a frame that spans segments is copied into a buffer of its own.
+ * Frames whose length field is out of bounds put the decoder in a failed state:
+ * the error callback is called once and all later input is discarded.
+ *
+ * @copyright 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC).  All rights reserved.
+ */
+#ifndef libparc_parc_EventFrameDecoder_h
+#define libparc_parc_EventFrameDecoder_h
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <parc/algol/parc_Buffer.h>
+#include <parc/algol/parc_EventQueue.h>
+
+#ifdef PARCLibrary_DISABLE_VALIDATION
+#  define parcEventFrameDecoder_OptionalAssertValid(_instance_)
+#else
+#  define parcEventFrameDecoder_OptionalAssertValid(_instance_) parcEventFrameDecoder_AssertValid(_instance_)
+#endif
+
+/**
+ * The largest header length a `PARCEventFrameDecoder` supports.
+ */
+#define PARCEventFrameDecoder_MaximumHeaderLength 64
+
+/**
+ * The largest number of frames passed to one call of a `PARCEventFrameDecoder_FrameCallback`.
+ */
+#define PARCEventFrameDecoder_BatchSize 64
+
+/**
+ * @typedef PARCEventFrameDecoder
+ * @brief Splits the input of a `PARCEventQueue` into frames
+ */
+struct PARCEventFrameDecoder;
+typedef struct PARCEventFrameDecoder PARCEventFrameDecoder;
+
+/**
+ * @typedef PARCEventFrameDecoderByteOrder
+ * @brief The byte order of the type and length fields of a frame header
+ */
+typedef enum {
+    PARCEventFrameDecoderByteOrder_BigEndian = 0,
+    PARCEventFrameDecoderByteOrder_LittleEndian = 1
+} PARCEventFrameDecoderByteOrder;
+
+/**
+ * @typedef PARCEventFrameDecoderError
+ * @brief The reason a `PARCEventFrameDecoder` failed
+ */
+typedef enum {
+    PARCEventFrameDecoderError_None = 0,
+    PARCEventFrameDecoderError_FrameTooShort = 1,    // The frame length is shorter than the header.
+    PARCEventFrameDecoderError_FrameTooLong = 2      // The frame length exceeds the maximum frame length.
+} PARCEventFrameDecoderError;
+
+/**
+ * @typedef PARCEventFrameDecoderConfig
+ * @brief The layout of a frame header and the limits on frame length
+ *
+ * The type and length fields are unsigned integers of 1, 2 or 4 bytes at the given offsets in the header.
+ * A `typeLength` of 0 means the header has no type field, and every frame has type 0.
+ */
+typedef struct {
+    size_t headerLength;                        // The number of bytes in a frame header.
+    size_t typeOffset;
+    size_t typeLength;                          // 0, 1, 2 or 4.
+    size_t lengthOffset;
+    size_t lengthLength;                        // 1, 2 or 4.
+    PARCEventFrameDecoderByteOrder byteOrder;
+    bool lengthIncludesHeader;                  // The length field counts the whole frame rather than the payload.
+    size_t maximumFrameLength;                  // The largest permitted frame, header included.
+} PARCEventFrameDecoderConfig;
+
+/**
+ * @typedef PARCEventFrame
+ * @brief A frame found by a `PARCEventFrameDecoder`
+ */
+typedef struct {
+    uint32_t type;
+    PARCBuffer *buffer;     // The whole frame, positioned at the start of the payload.
+} PARCEventFrame;
+
+/**
+ * @typedef PARCEventFrameDecoder_FrameCallback
+ * @brief Called with a batch of one or more consecutive frames
+ *
+ * The frames' buffers may refer to the queue's input: they are valid only until the callback returns,
+ * and must be copied (`parcBuffer_Copy`) to be kept longer. They are released by the decoder.
+ */
+typedef void (PARCEventFrameDecoder_FrameCallback)(PARCEventFrameDecoder *decoder, size_t count,
+                                                   const PARCEventFrame frames[count], void *userData);
+
+/**
+ * @typedef PARCEventFrameDecoder_ErrorCallback
+ * @brief Called once, when a `PARCEventFrameDecoder` fails
+ */
+typedef void (PARCEventFrameDecoder_ErrorCallback)(PARCEventFrameDecoder *decoder, PARCEventFrameDecoderError error,
+                                                   void *userData);
+
+/**
+ * Create a `PARCEventFrameDecoder`.
+ *
+ * @param [in] config A pointer to the frame layout, which is copied.
+ * @param [in] frameCallback The function called with each batch of frames.
+ * @param [in] errorCallback The function called if the decoder fails, or NULL.
+ * @param [in] userData A pointer passed to the callbacks.
+ *
+ * @returns A pointer to a new `PARCEventFrameDecoder`, which must be destroyed by `parcEventFrameDecoder_Destroy`.
+ *
+ * @throws LongBowTrapIllegalValue The configuration is not valid.
+ *
+ * Example:
+ * @code
+ * {
+ *     // A 1-byte type, a 1-byte version and a 2-byte big-endian payload length.
+ *     PARCEventFrameDecoderConfig config = {
+ *         .headerLength = 4,
+ *         .typeOffset = 0, .typeLength = 1,
+ *         .lengthOffset = 2, .lengthLength = 2,
+ *         .byteOrder = PARCEventFrameDecoderByteOrder_BigEndian,
+ *         .lengthIncludesHeader = false,
+ *         .maximumFrameLength = 8192
+ *     };
+ *     PARCEventFrameDecoder *decoder = parcEventFrameDecoder_Create(&config, onFrames, onError, connection);
+ * }
+ * @endcode
+ */
+PARCEventFrameDecoder *parcEventFrameDecoder_Create(const PARCEventFrameDecoderConfig *config,
+                                                    PARCEventFrameDecoder_FrameCallback *frameCallback,
+                                                    PARCEventFrameDecoder_ErrorCallback *errorCallback,
+                                                    void *userData);
+
+/**
+ * Destroy a `PARCEventFrameDecoder`.
+ *
+ * A queue to which the decoder is attached must be destroyed, or given other callbacks, first.
+ *
+ * @param [in,out] decoderPtr The address of the pointer to the decoder, which is set to NULL.
+ *
+ * Example:
+ * @code
+ * {
+ *     parcEventFrameDecoder_Destroy(&decoder);
+ * }
+ * @endcode
+ */
+void parcEventFrameDecoder_Destroy(PARCEventFrameDecoder **decoderPtr);
+
+/**
+ * Determine if an instance of `PARCEventFrameDecoder` is valid.
+ *
+ * @param [in] decoder A pointer to a `PARCEventFrameDecoder` instance.
+ *
+ * @return true The instance is valid.
+ * @return false The instance is not valid.
+ */
+bool parcEventFrameDecoder_IsValid(const PARCEventFrameDecoder *decoder);
+
+/**
+ * Assert that the given `PARCEventFrameDecoder` instance is valid.
+ *
+ * @param [in] decoder A pointer to a valid `PARCEventFrameDecoder` instance.
+ */
+void parcEventFrameDecoder_AssertValid(const PARCEventFrameDecoder *decoder);
+
+/**
+ * Make the decoder the reader of a `PARCEventQueue`.
+ *
+ * The decoder becomes the queue's read callback, and decodes its input whenever data arrives.
+ * The queue's read low watermark is set to the header length, so the decoder is not woken for less than a header.
+ * The queue's write callback is cleared, and its event callback is set to @p eventCallback,
+ * which is called with the decoder's user data.
+ *
+ * The callbacks must not destroy the queue or the decoder; defer that to after the scheduler returns.
+ *
+ * @param [in] decoder A pointer to a valid `PARCEventFrameDecoder` instance.
+ * @param [in] queue The queue whose input is decoded.
+ * @param [in] eventCallback The function called with the queue's events, or NULL.
+ *
+ * Example:
+ * @code
+ * {
+ *     parcEventFrameDecoder_Attach(decoder, queue, onQueueEvent);
+ *     parcEventScheduler_Start(scheduler, PARCEventSchedulerDispatchType_Blocking);
+ * }
+ * @endcode
+ */
+void parcEventFrameDecoder_Attach(PARCEventFrameDecoder *decoder, PARCEventQueue *queue,
+                                  PARCEventQueue_EventCallback *eventCallback);
+
+/**
+ * Pass every complete frame in the queue's input to the frame callback, then remove them from the input.
+ *
+ * Use this from a read callback of your own rather than `parcEventFrameDecoder_Attach` when the queue
+ * needs other handling too. An incomplete frame at the end of the input is left for a later call.
+ *
+ * @param [in] decoder A pointer to a valid `PARCEventFrameDecoder` instance.
+ * @param [in] queue The queue whose input is decoded.
+ *
+ * @returns The number of frames passed to the frame callback.
+ *
+ * Example:
+ * @code
+ * void
+ * onRead(PARCEventQueue *queue, PARCEventType type, void *connection)
+ * {
+ *     parcEventFrameDecoder_Decode(((Connection *) connection)->decoder, queue);
+ * }
+ * @endcode
+ */
+size_t parcEventFrameDecoder_Decode(PARCEventFrameDecoder *decoder, PARCEventQueue *queue);
+
+/**
+ * Get the reason the decoder failed.
+ *
+ * @param [in] decoder A pointer to a valid `PARCEventFrameDecoder` instance.
+ *
+ * @returns `PARCEventFrameDecoderError_None` if the decoder has not failed, otherwise the reason it failed.
+ */
+PARCEventFrameDecoderError parcEventFrameDecoder_GetError(const PARCEventFrameDecoder *decoder);
+
+/**
+ * Get the number of frames passed to the frame callback so far.
+ *
+ * @param [in] decoder A pointer to a valid `PARCEventFrameDecoder` instance.
+ *
+ * @returns The number of frames decoded.
+ */
+uint64_t parcEventFrameDecoder_GetFrameCount(const PARCEventFrameDecoder *decoder);
+#endif // libparc_parc_EventFrameDecoder_h
@@ -30,6 +30,7 @@
  */
 #include <config.h>
 #include <errno.h>
+#include <sys/stat.h>
 
 #include <LongBow/runtime.h>
 
@@ -261,6 +262,82 @@ parcEventQueue_Write(PARCEventQueue *parcEventQueue, void *data, size_t dataLeng
     return bufferevent_write(parcEventQueue->buffereventBuffer, data, dataLength);
 }
 
+static void
+_parcEventQueue_ReleaseSegment(const void *data, size_t length, void *segment)
+{
+    parcBuffer_Release((PARCBuffer **) &segment);
+}
+
+int
+parcEventQueue_WriteBufferChain(PARCEventQueue *parcEventQueue, const PARCBufferChain *chain)
+{
+    // Stage the segments in a separate evbuffer and move them to the output in one step,
+    // so that a failure part way through leaves nothing of the chain queued for the peer.
+    struct evbuffer *staging = evbuffer_new();
+    if (staging == NULL) {
+        return -1;
+    }
+
+    int result = 0;
+
+    PARCBuffer *segment;
+    parcBufferChain_ForEach(chain, segment) {
+        if (parcBuffer_HasRemaining(segment)) {
+            PARCBuffer *reference = parcBuffer_Acquire(segment);
+            if (evbuffer_add_reference(staging, parcBuffer_Overlay(reference, 0), parcBuffer_Remaining(reference),
+                                       _parcEventQueue_ReleaseSegment, reference) != 0) {
+                parcBuffer_Release(&reference);
+                result = -1;
+                break;
+            }
+        }
+    }
+
+    if (result == 0) {
+        // Moving the chains does not copy the segments, and is atomic with respect to other writers of the queue.
+        result = bufferevent_write_buffer(parcEventQueue->buffereventBuffer, staging);
+    }
+
+    // Releases the references to any segments that were not moved to the output.
+    evbuffer_free(staging);
+    return result;
+}
+
+static void
+_parcEventQueue_ReleaseFile(struct evbuffer_file_segment const *segment, int flags, void *file)
+{
+    parcRandomAccessFile_Release((PARCRandomAccessFile **) &file);
+}
+
+int
+parcEventQueue_WriteFile(PARCEventQueue *parcEventQueue, const PARCRandomAccessFile *file, uint64_t offset, size_t length)
+{
+    if (length == 0) {
+        return 0;
+    }
+
+    // A range past the end of the file would never finish draining.
+    int fd = parcRandomAccessFile_GetFileDescriptor(file);
+    struct stat statbuf;
+    if (fstat(fd, &statbuf) != 0 || offset + length > (uint64_t) statbuf.st_size) {
+        return -1;
+    }
+
+    // Without EVBUF_FS_CLOSE_ON_FREE the descriptor stays owned by the file, which the segment keeps open.
+    struct evbuffer_file_segment *segment = evbuffer_file_segment_new(fd, (ev_off_t) offset, (ev_off_t) length, 0);
+    if (segment == NULL) {
+        return -1;
+    }
+    evbuffer_file_segment_add_cleanup_cb(segment, _parcEventQueue_ReleaseFile, parcRandomAccessFile_Acquire(file));
+
+    struct evbuffer *output = bufferevent_get_output(parcEventQueue->buffereventBuffer);
+    int result = evbuffer_add_file_segment(output, segment, 0, (ev_off_t) length);
+
+    // The output buffer holds its own reference to the segment while any of it remains unwritten.
+    evbuffer_file_segment_free(segment);
+    return result;
+}
+
 int
 parcEventQueue_SetPriority(PARCEventQueue *eventQueue, PARCEventPriority priority)
 {
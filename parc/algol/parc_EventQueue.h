@@ -44,6 +44,8 @@
 #include <sys/socket.h>
 
 #include <parc/algol/parc_Event.h>
+#include <parc/algol/parc_BufferChain.h>
+#include <parc/algol/parc_RandomAccessFile.h>
 
 /**
  * Current implementation based on top of libevent2
@@ -364,6 +366,67 @@ int parcEventQueue_Read(PARCEventQueue *queue, void *data, size_t dataLength);
  */
 int parcEventQueue_Write(PARCEventQueue *queue, void *data, size_t dataLength);
 
+/**
+ * Add the contents of a `PARCBufferChain` to the queue output without copying them.
+ *
+ * Each segment is added to the output by reference and held until the queue has written it,
+ * so the queue's socket is written with `writev(2)` directly from the segments' memory.
+ * The segments are added atomically with respect to other writers of the queue:
+ * on failure none of them are added, so the peer never receives part of the chain.
+ * The chain itself is unchanged and may be released immediately.
+ *
+ * @param [in] queue instance to add to
+ * @param [in] chain A pointer to a valid `PARCBufferChain`.
+ * @returns 0 on success, -1 on failure
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCBufferChain *message = parcBufferChain_Create();
+ *     parcBufferChain_Append(message, header);
+ *     parcBufferChain_Append(message, payload);
+ *
+ *     int result = parcEventQueue_WriteBufferChain(queue, message);
+ *
+ *     parcBufferChain_Release(&message);
+ * }
+ * @endcode
+ */
+int parcEventQueue_WriteBufferChain(PARCEventQueue *queue, const PARCBufferChain *chain);
+
+/**
+ * Add @p length bytes at @p offset in a file to the queue output without reading them into memory.
+ *
+ * The range is queued as a file segment. When the queue writes to a socket, it transfers the segment
+ * with `sendfile(2)` where the platform supports it, so the bytes go from the page cache to the socket
+ * without being copied through user space. A partial write leaves the rest of the segment queued,
+ * and the queue resumes it by itself when the scheduler reports the socket writable again.
+ * Queues that do not drain to a descriptor, such as those of a connected pair, read the range into memory instead.
+ *
+ * The queue acquires a reference to the file and releases it once the range has been written.
+ * The file must stay open, and the range must not be truncated, until then.
+ *
+ * @param [in] queue instance to add to
+ * @param [in] file A pointer to a valid, open `PARCRandomAccessFile`.
+ * @param [in] offset The offset in the file of the first byte to write.
+ * @param [in] length The number of bytes to write.
+ * @returns 0 on success, -1 on failure, including a range that extends past the end of the file
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCRandomAccessFile *handle = parcRandomAccessFile_Open(file);
+ *
+ *     int result = parcEventQueue_WriteFile(queue, handle, 0, parcFile_GetFileSize(file));
+ *
+ *     parcRandomAccessFile_Release(&handle);
+ * }
+ * @endcode
+ *
+ * @see parcRandomAccessFile_SendAt
+ */
+int parcEventQueue_WriteFile(PARCEventQueue *queue, const PARCRandomAccessFile *file, uint64_t offset, size_t length);
+
 /**
  * Attach an launch a socket on a queue
  *
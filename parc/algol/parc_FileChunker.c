@@ -31,6 +31,7 @@
 
 #include <config.h>
 
+#include <errno.h>
 #include <stdio.h>
 #include <string.h>
 #include <sys/time.h>
@@ -43,7 +44,7 @@
 
 #include <parc/algol/parc_FileChunker.h>
 
-PARCChunkerInterface *PARCFileChunkerAsBunker = &(PARCChunkerInterface) {
+PARCChunkerInterface *PARCFileChunkerAsChunker = &(PARCChunkerInterface) {
     .ForwardIterator = (void *(*)(const void *))parcFileChunker_ForwardIterator,
     .ReverseIterator = (void *(*)(const void *))parcFileChunker_ReverseIterator,
     .Release = (void (*)(void **))parcFileChunker_Release
@@ -68,10 +69,29 @@ struct parc_buffer_chunker {
     PARCFile *file;
     PARCRandomAccessFile *fhandle;
 
+    // The whole file mapped into memory, or NULL if it could not be mapped.
+    // Chunks are slices of the mapping.
+    PARCBuffer *mapping;
+
+    // Otherwise, the most recently read window of the file, and the file offset of its first byte.
+    // Chunks are slices of the window.
+    PARCBuffer *window;
+    size_t windowStart;
+
     // The current element of the iterator
     PARCBuffer *currentElement;
 };
 
+/**
+ * When the file cannot be mapped, it is read this many bytes (rounded up to a whole number of chunks) at a time.
+ */
+static const size_t _parcFileChunker_WindowSize = 1024 * 1024;
+
+/**
+ * Whether to try mapping the file at all. The tests clear this to exercise the windowed read path.
+ */
+static bool _parcFileChunker_MapFiles = true;
+
 static void
 _destroy(PARCFileChunker **chunkerP)
 {
@@ -83,11 +103,45 @@ _destroy(PARCFileChunker **chunkerP)
         parcFile_Release(&(*chunkerP)->file);
     }
 
+    if ((*chunkerP)->mapping != NULL) {
+        parcBuffer_Release(&(*chunkerP)->mapping);
+    }
+
+    if ((*chunkerP)->window != NULL) {
+        parcBuffer_Release(&(*chunkerP)->window);
+    }
+
     if ((*chunkerP)->currentElement != NULL) {
         parcBuffer_Release(&(*chunkerP)->currentElement);
     }
 }
 
+/**
+ * Map the file, or re-map it if its size has changed since it was last mapped.
+ * If the file cannot be mapped, chunks will be read through a window instead.
+ */
+static void
+_mapFile(PARCFileChunker *chunker, size_t totalSize, PARCByteArrayAdvice advice)
+{
+    if (chunker->mapping != NULL && parcBuffer_Capacity(chunker->mapping) != totalSize) {
+        parcBuffer_Release(&chunker->mapping);
+    }
+
+    if (chunker->mapping == NULL && _parcFileChunker_MapFiles) {
+        char *fileName = parcFile_ToString(chunker->file);
+        chunker->mapping = parcBuffer_MapFile(fileName);
+        parcMemory_Deallocate((void **) &fileName);
+
+        if (chunker->mapping != NULL && parcBuffer_Capacity(chunker->mapping) != totalSize) {
+            parcBuffer_Release(&chunker->mapping);
+        }
+    }
+
+    if (chunker->mapping != NULL) {
+        parcBuffer_Advise(parcBuffer_Clear(chunker->mapping), advice);
+    }
+}
+
 static void *
 _InitForward(PARCFileChunker *chunker)
 {
@@ -99,6 +153,8 @@ _InitForward(PARCFileChunker *chunker)
     state->atEnd = false;
     state->totalSize = parcFile_GetFileSize(chunker->file);
 
+    _mapFile(chunker, state->totalSize, PARCByteArrayAdvice_Sequential);
+
     if (state->totalSize < chunker->chunkSize) {
         state->position = 0;
         state->nextChunkSize = state->totalSize;
@@ -120,6 +176,9 @@ _InitReverse(PARCFileChunker *chunker)
     state->atEnd = false;
     state->totalSize = parcFile_GetFileSize(chunker->file);
 
+    // The kernel reads ahead only in the forward direction, so leave the default policy for reverse iteration.
+    _mapFile(chunker, state->totalSize, PARCByteArrayAdvice_Normal);
+
     if (state->totalSize < chunker->chunkSize) {
         state->position = 0;
         state->nextChunkSize = state->totalSize;
@@ -182,16 +241,79 @@ _advanceState(PARCFileChunker *chunker, _ChunkerState *state)
     }
 }
 
+/**
+ * Return a new buffer that is a slice of the region [offset, offset + length) of the given buffer.
+ */
+static PARCBuffer *
+_sliceRegion(PARCBuffer *buffer, size_t offset, size_t length)
+{
+    parcBuffer_Clear(buffer);
+    parcBuffer_SetPosition(buffer, offset);
+    parcBuffer_SetLimit(buffer, offset + length);
+
+    return parcBuffer_Slice(buffer);
+}
+
+/**
+ * Ensure the window holds the chunk at [position, position + chunkSize) of the file.
+ *
+ * A new window covers as many of the following (forward) or preceding (reverse) chunks as fit,
+ * so the file is read with one seek and read per window rather than per chunk.
+ * The window's storage is reused when no chunk sliced from it is still referenced.
+ */
+static void
+_fillWindow(PARCFileChunker *chunker, _ChunkerState *state, size_t chunkSize)
+{
+    if (chunker->window != NULL
+        && state->position >= chunker->windowStart
+        && state->position + chunkSize <= chunker->windowStart + parcBuffer_Capacity(chunker->window)) {
+        return;
+    }
+
+    size_t windowSize = ((_parcFileChunker_WindowSize + chunker->chunkSize - 1) / chunker->chunkSize) * chunker->chunkSize;
+
+    size_t windowStart = state->position;
+    if (state->direction != 0) {
+        size_t end = state->position + chunkSize;
+        windowStart = (end > windowSize) ? end - windowSize : 0;
+    }
+    size_t windowLength = state->totalSize - windowStart;
+    if (windowLength > windowSize) {
+        windowLength = windowSize;
+    }
+
+    if (chunker->window != NULL
+        && parcObject_GetReferenceCount(parcBuffer_Array(chunker->window)) == 1
+        && parcBuffer_Capacity(chunker->window) == windowLength) {
+        parcBuffer_Clear(chunker->window);
+    } else {
+        if (chunker->window != NULL) {
+            parcBuffer_Release(&chunker->window);
+        }
+        chunker->window = parcBuffer_Allocate(windowLength);
+    }
+
+    // A window that is not completely filled would serve zeros or stale bytes as chunk data,
+    // for example if the file was truncated after the iterator was created.
+    ssize_t nread = parcRandomAccessFile_ReadAt(chunker->fhandle, chunker->window, windowStart);
+    trapUnrecoverableStateIf(nread != (ssize_t) windowLength,
+                             "Read %zd of the %zu bytes at offset %zu of the file: %s",
+                             nread, windowLength, windowStart, nread < 0 ? strerror(errno) : "unexpected end of file");
+    chunker->windowStart = windowStart;
+}
+
 static void *
 _parcChunker_NextFromBuffer(PARCFileChunker *chunker, _ChunkerState *state)
 {
     size_t chunkSize = state->nextChunkSize;
 
-    parcRandomAccessFile_Seek(chunker->fhandle, state->position, PARCRandomAccessFilePosition_Start);
-
-    PARCBuffer *slice = parcBuffer_Allocate(chunkSize);
-    parcRandomAccessFile_Read(chunker->fhandle, slice);
-    slice = parcBuffer_Flip(slice);
+    PARCBuffer *slice;
+    if (chunker->mapping != NULL) {
+        slice = _sliceRegion(chunker->mapping, state->position, chunkSize);
+    } else {
+        _fillWindow(chunker, state, chunkSize);
+        slice = _sliceRegion(chunker->window, state->position - chunker->windowStart, chunkSize);
+    }
 
     _advanceState(chunker, state);
 
@@ -201,11 +323,13 @@ _parcChunker_NextFromBuffer(PARCFileChunker *chunker, _ChunkerState *state)
 static void *
 _parcChunker_Next(PARCFileChunker *chunker, void *state)
 {
-    PARCBuffer *buffer = _parcChunker_NextFromBuffer(chunker, state);
-
+    // Drop the previous element first, so that the window it was sliced from can be reused.
     if (chunker->currentElement != NULL) {
         parcBuffer_Release(&chunker->currentElement);
     }
+
+    PARCBuffer *buffer = _parcChunker_NextFromBuffer(chunker, state);
+
     if (buffer != NULL) {
         chunker->currentElement = parcBuffer_Acquire(buffer);
     }
@@ -251,6 +375,9 @@ parcFileChunker_Create(PARCFile *file, size_t chunkSize)
         chunker->chunkSize = chunkSize;
         chunker->file = parcFile_Acquire(file);
         chunker->fhandle = parcRandomAccessFile_Open(chunker->file);
+        chunker->mapping = NULL;
+        chunker->window = NULL;
+        chunker->windowStart = 0;
         chunker->currentElement = NULL;
     }
 
@@ -170,6 +170,7 @@ bool parcFileChunker_Equals(const PARCFileChunker *chunkerA, const PARCFileChunk
  *
  * This function can only be called once per chunker instance since the iterator
  * will mutate internal state of the chunker.
+ * Getting the next chunk traps if the file cannot be read, for example because it was truncated.
  *
  * @param [in] chunker A `PARCFileChunker` instance.
  *
@@ -194,6 +195,7 @@ PARCIterator *parcFileChunker_ForwardIterator(const PARCFileChunker *chunker);
  *
  * This function can only be called once per chunker instance since the iterator
  * will mutate internal state of the chunker.
+ * Getting the next chunk traps if the file cannot be read, for example because it was truncated.
  *
  * @param [in] chunker A `PARCFileChunker` instance.
  *
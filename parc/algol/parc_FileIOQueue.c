@@ -0,0 +1,381 @@
+/*
+ * Copyright (c) 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Patent rights are not granted under this agreement. Patent rights are
+ *       available under FRAND terms.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX or PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * @copyright 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC).  All rights reserved.
+ */
+#include <config.h>
+
+#include <errno.h>
+#include <string.h>
+#include <pthread.h>
+
+#include <LongBow/runtime.h>
+
+#include <parc/algol/parc_Object.h>
+#include <parc/algol/parc_Memory.h>
+#include <parc/algol/parc_FileIOQueue.h>
+
+/*
+ * A first-in first-out queue of fixed-size entries in a circular array that grows as needed.
+ */
+typedef struct {
+    uint8_t *entries;
+    size_t elementSize;
+    size_t head;
+    size_t count;
+    size_t capacity;
+} _PARCFileIOQueueRing;
+
+/*
+ * Grow the ring, if necessary, so that it can hold `required` entries without growing again.
+ */
+static bool
+_parcFileIOQueueRing_Reserve(_PARCFileIOQueueRing *ring, size_t required)
+{
+    if (required <= ring->capacity) {
+        return true;
+    }
+
+    size_t capacity = (ring->capacity == 0) ? 16 : ring->capacity;
+    while (capacity < required) {
+        capacity *= 2;
+    }
+
+    uint8_t *entries = parcMemory_Allocate(capacity * ring->elementSize);
+    if (entries == NULL) {
+        return false;
+    }
+    for (size_t i = 0; i < ring->count; i++) {
+        size_t index = (ring->head + i) % ring->capacity;
+        memcpy(&entries[i * ring->elementSize], &ring->entries[index * ring->elementSize], ring->elementSize);
+    }
+    if (ring->entries != NULL) {
+        parcMemory_Deallocate(&ring->entries);
+    }
+
+    ring->entries = entries;
+    ring->head = 0;
+    ring->capacity = capacity;
+    return true;
+}
+
+static void
+_parcFileIOQueueRing_Push(_PARCFileIOQueueRing *ring, const void *entry)
+{
+    size_t index = (ring->head + ring->count) % ring->capacity;
+    memcpy(&ring->entries[index * ring->elementSize], entry, ring->elementSize);
+    ring->count++;
+}
+
+static void
+_parcFileIOQueueRing_Pop(_PARCFileIOQueueRing *ring, void *entry)
+{
+    memcpy(entry, &ring->entries[ring->head * ring->elementSize], ring->elementSize);
+    ring->head = (ring->head + 1) % ring->capacity;
+    ring->count--;
+}
+
+/*
+ * Requests are queued in `pending` until a worker takes one. The worker performs it without the mutex held,
+ * and queues its completion in `completed`.
+ *
+ * Submitting requests reserves room in `completed` for all the outstanding requests,
+ * so a worker never has to grow it (and so can never fail to store a completion).
+ */
+struct PARCFileIOQueue {
+    pthread_mutex_t mutex;
+    pthread_cond_t workAvailable;       // Signalled when requests are submitted, or the queue is stopping.
+    pthread_cond_t completionAvailable; // Signalled when a worker stores a completion.
+
+    _PARCFileIOQueueRing pending;   // PARCFileIORequest
+    _PARCFileIOQueueRing completed; // PARCFileIOCompletion
+    size_t outstanding;             // Submitted and not yet reaped.
+    bool stopping;
+
+    PARCNotifier *notifier;
+
+    pthread_t *workers;
+    size_t threadCount;
+};
+
+static void
+_parcFileIOQueue_Perform(const PARCFileIORequest *request, PARCFileIOCompletion *completion)
+{
+    completion->operation = request->operation;
+    completion->offset = request->offset;
+    completion->context = request->context;
+    completion->error = 0;
+
+    if (request->operation == PARCFileIOOperation_Read) {
+        if (request->buffer == NULL) {
+            completion->buffer = parcBuffer_Allocate(request->length);
+            completion->result = parcRandomAccessFile_ReadAt(request->file, completion->buffer, request->offset);
+            parcBuffer_Flip(completion->buffer);
+        } else {
+            completion->buffer = request->buffer;
+            completion->result = parcRandomAccessFile_ReadAt(request->file, completion->buffer, request->offset);
+        }
+    } else {
+        completion->buffer = request->buffer;
+        completion->result = parcRandomAccessFile_WriteAt(request->file, completion->buffer, request->offset);
+    }
+
+    if (completion->result < 0) {
+        completion->error = errno;
+    }
+}
+
+static void *
+_parcFileIOQueue_Worker(void *arg)
+{
+    PARCFileIOQueue *queue = arg;
+
+    pthread_mutex_lock(&queue->mutex);
+    while (true) {
+        while (!queue->stopping && queue->pending.count == 0) {
+            pthread_cond_wait(&queue->workAvailable, &queue->mutex);
+        }
+        if (queue->stopping) {
+            break;
+        }
+
+        PARCFileIORequest request;
+        _parcFileIOQueueRing_Pop(&queue->pending, &request);
+        pthread_mutex_unlock(&queue->mutex);
+
+        PARCFileIOCompletion completion;
+        _parcFileIOQueue_Perform(&request, &completion);
+        parcRandomAccessFile_Release(&request.file);
+
+        pthread_mutex_lock(&queue->mutex);
+        _parcFileIOQueueRing_Push(&queue->completed, &completion);
+        pthread_cond_broadcast(&queue->completionAvailable);
+
+        if (queue->notifier != NULL) {
+            pthread_mutex_unlock(&queue->mutex);
+            parcNotifier_Notify(queue->notifier);
+            pthread_mutex_lock(&queue->mutex);
+        }
+    }
+    pthread_mutex_unlock(&queue->mutex);
+
+    return NULL;
+}
+
+static void
+_parcFileIOQueue_Finalize(PARCFileIOQueue **instancePtr)
+{
+    assertNotNull(instancePtr, "Parameter must be a non-null pointer to a PARCFileIOQueue pointer.");
+    PARCFileIOQueue *queue = *instancePtr;
+
+    pthread_mutex_lock(&queue->mutex);
+    queue->stopping = true;
+    pthread_cond_broadcast(&queue->workAvailable);
+    pthread_mutex_unlock(&queue->mutex);
+
+    for (size_t i = 0; i < queue->threadCount; i++) {
+        pthread_join(queue->workers[i], NULL);
+    }
+    parcMemory_Deallocate(&queue->workers);
+
+    while (queue->pending.count > 0) {
+        PARCFileIORequest request;
+        _parcFileIOQueueRing_Pop(&queue->pending, &request);
+        parcRandomAccessFile_Release(&request.file);
+        if (request.buffer != NULL) {
+            parcBuffer_Release(&request.buffer);
+        }
+    }
+    while (queue->completed.count > 0) {
+        PARCFileIOCompletion completion;
+        _parcFileIOQueueRing_Pop(&queue->completed, &completion);
+        parcBuffer_Release(&completion.buffer);
+    }
+    if (queue->pending.entries != NULL) {
+        parcMemory_Deallocate(&queue->pending.entries);
+    }
+    if (queue->completed.entries != NULL) {
+        parcMemory_Deallocate(&queue->completed.entries);
+    }
+
+    if (queue->notifier != NULL) {
+        parcNotifier_Release(&queue->notifier);
+    }
+
+    pthread_cond_destroy(&queue->completionAvailable);
+    pthread_cond_destroy(&queue->workAvailable);
+    pthread_mutex_destroy(&queue->mutex);
+}
+
+parcObject_ImplementAcquire(parcFileIOQueue, PARCFileIOQueue);
+
+parcObject_ImplementRelease(parcFileIOQueue, PARCFileIOQueue);
+
+parcObject_ExtendPARCObject(PARCFileIOQueue, _parcFileIOQueue_Finalize, NULL, NULL, NULL, NULL, NULL, NULL);
+
+bool
+parcFileIOQueue_IsValid(const PARCFileIOQueue *instance)
+{
+    bool result = false;
+
+    if (instance != NULL) {
+        result = instance->threadCount > 0;
+    }
+
+    return result;
+}
+
+void
+parcFileIOQueue_AssertValid(const PARCFileIOQueue *instance)
+{
+    assertTrue(parcFileIOQueue_IsValid(instance),
+               "PARCFileIOQueue is not valid.");
+}
+
+PARCFileIOQueue *
+parcFileIOQueue_Create(size_t threadCount, PARCNotifier *notifier)
+{
+    trapIllegalValueIf(threadCount == 0, "The number of threads must be at least 1");
+
+    PARCFileIOQueue *result = parcObject_CreateInstance(PARCFileIOQueue);
+    if (result == NULL) {
+        return NULL;
+    }
+
+    pthread_mutex_init(&result->mutex, NULL);
+    pthread_cond_init(&result->workAvailable, NULL);
+    pthread_cond_init(&result->completionAvailable, NULL);
+
+    result->pending = (_PARCFileIOQueueRing) { .entries = NULL, .elementSize = sizeof(PARCFileIORequest) };
+    result->completed = (_PARCFileIOQueueRing) { .entries = NULL, .elementSize = sizeof(PARCFileIOCompletion) };
+    result->outstanding = 0;
+    result->stopping = false;
+    result->notifier = (notifier == NULL) ? NULL : parcNotifier_Acquire(notifier);
+
+    result->workers = parcMemory_AllocateAndClear(threadCount * sizeof(pthread_t));
+    result->threadCount = 0;
+    for (size_t i = 0; i < threadCount; i++) {
+        if (pthread_create(&result->workers[i], NULL, _parcFileIOQueue_Worker, result) != 0) {
+            break;
+        }
+        result->threadCount++;
+    }
+
+    if (result->threadCount == 0) {
+        parcFileIOQueue_Release(&result);
+    }
+
+    return result;
+}
+
+size_t
+parcFileIOQueue_Submit(PARCFileIOQueue *queue, size_t count, const PARCFileIORequest requests[count])
+{
+    parcFileIOQueue_OptionalAssertValid(queue);
+
+    for (size_t i = 0; i < count; i++) {
+        assertNotNull(requests[i].file, "Request %zu has no file", i);
+        assertTrue(requests[i].operation == PARCFileIOOperation_Read || requests[i].buffer != NULL,
+                   "Write request %zu has no buffer", i);
+    }
+
+    pthread_mutex_lock(&queue->mutex);
+
+    size_t result = count;
+    while (result > 0) {
+        if (_parcFileIOQueueRing_Reserve(&queue->pending, queue->pending.count + result)
+            && _parcFileIOQueueRing_Reserve(&queue->completed, queue->outstanding + result)) {
+            break;
+        }
+        result /= 2;
+    }
+
+    for (size_t i = 0; i < result; i++) {
+        PARCFileIORequest request = requests[i];
+        request.file = parcRandomAccessFile_Acquire(request.file);
+        if (request.buffer != NULL) {
+            request.buffer = parcBuffer_Acquire(request.buffer);
+        }
+        _parcFileIOQueueRing_Push(&queue->pending, &request);
+    }
+    queue->outstanding += result;
+
+    // Wake no more workers than there are requests for.
+    size_t wake = (result < queue->threadCount) ? result : queue->threadCount;
+    for (size_t i = 0; i < wake; i++) {
+        pthread_cond_signal(&queue->workAvailable);
+    }
+    pthread_mutex_unlock(&queue->mutex);
+
+    return result;
+}
+
+size_t
+parcFileIOQueue_Wait(PARCFileIOQueue *queue, size_t minimum, size_t count, PARCFileIOCompletion completions[count])
+{
+    parcFileIOQueue_OptionalAssertValid(queue);
+    trapIllegalValueIf(minimum > count, "Cannot wait for %zu completions with room for %zu", minimum, count);
+
+    pthread_mutex_lock(&queue->mutex);
+
+    if (minimum > queue->outstanding) {
+        minimum = queue->outstanding;
+    }
+    while (queue->completed.count < minimum) {
+        pthread_cond_wait(&queue->completionAvailable, &queue->mutex);
+    }
+
+    size_t result = 0;
+    while (result < count && queue->completed.count > 0) {
+        _parcFileIOQueueRing_Pop(&queue->completed, &completions[result]);
+        result++;
+    }
+    queue->outstanding -= result;
+
+    pthread_mutex_unlock(&queue->mutex);
+
+    return result;
+}
+
+size_t
+parcFileIOQueue_Reap(PARCFileIOQueue *queue, size_t count, PARCFileIOCompletion completions[count])
+{
+    return parcFileIOQueue_Wait(queue, 0, count, completions);
+}
+
+size_t
+parcFileIOQueue_Outstanding(const PARCFileIOQueue *queue)
+{
+    parcFileIOQueue_OptionalAssertValid(queue);
+
+    PARCFileIOQueue *mutable = (PARCFileIOQueue *) queue;
+    pthread_mutex_lock(&mutable->mutex);
+    size_t result = queue->outstanding;
+    pthread_mutex_unlock(&mutable->mutex);
+
+    return result;
+}
@@ -0,0 +1,308 @@
+/*
+ * Copyright (c) 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Patent rights are not granted under this agreement. Patent rights are
+ *       available under FRAND terms.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX or PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * @file parc_FileIOQueue.h
+ * @ingroup inputoutput
+ * @brief Asynchronous, batched positional reads and writes of `PARCRandomAccessFile` instances.
+ *
+ * A `PARCFileIOQueue` performs positional reads and writes (see `parcRandomAccessFile_ReadAt` and
+ * `parcRandomAccessFile_WriteAt`) on a set of worker threads, so that many requests, for one file or many,
+ * are in progress at once. Requests are submitted in batches, each batch with a single lock and wake-up,
+ * and their completions are collected, in the order they finish, with `parcFileIOQueue_Reap` or `parcFileIOQueue_Wait`.
+ *
+ * A queue may be given a `PARCNotifier`, which it notifies whenever a completion becomes available.
+ * An event loop can watch `parcNotifier_Socket` with a `PARCEvent` on its `PARCEventScheduler` and reap completions
+ * when the socket is readable, pausing the notifier while it does so (see `parcNotifier_PauseEvents`).
+ *
+ * Releasing the last reference to a queue waits for the requests being performed to finish and discards the rest,
+ * along with any completions not yet reaped.
+ *
+ * @copyright 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC).  All rights reserved.
+ */
+#ifndef libparc_parc_FileIOQueue_h
+#define libparc_parc_FileIOQueue_h
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <sys/types.h>
+
+#include <parc/algol/parc_Buffer.h>
+#include <parc/algol/parc_RandomAccessFile.h>
+#include <parc/concurrent/parc_Notifier.h>
+
+struct PARCFileIOQueue;
+typedef struct PARCFileIOQueue PARCFileIOQueue;
+
+typedef enum {
+    PARCFileIOOperation_Read,
+    PARCFileIOOperation_Write
+} PARCFileIOOperation;
+
+/**
+ * A request to read or write part of a file.
+ *
+ * For a read, `buffer` is either NULL, in which case the queue allocates a buffer of `length` bytes,
+ * or a buffer whose remaining bytes are to be filled (and `length` is ignored).
+ * For a write, the remaining bytes of `buffer` are written, and `length` is ignored.
+ *
+ * The queue acquires references to `file` and `buffer` for as long as the request is outstanding.
+ */
+typedef struct parc_file_io_request {
+    PARCFileIOOperation operation;
+    PARCRandomAccessFile *file;
+    uint64_t offset;
+    size_t length;
+    PARCBuffer *buffer;
+    void *context;      // Returned unchanged in the completion.
+} PARCFileIORequest;
+
+/**
+ * The outcome of a request.
+ *
+ * `buffer` is a reference that the caller must release. For a read into a buffer allocated by the queue,
+ * it holds the bytes read from position 0; otherwise it is the request's buffer, its position advanced
+ * past the bytes transferred.
+ */
+typedef struct parc_file_io_completion {
+    PARCFileIOOperation operation;
+    uint64_t offset;
+    PARCBuffer *buffer;
+    ssize_t result;     // The number of bytes transferred, or -1.
+    int error;          // The value of `errno` when `result` is -1, otherwise 0.
+    void *context;
+} PARCFileIOCompletion;
+
+#ifdef PARCLibrary_DISABLE_VALIDATION
+#  define parcFileIOQueue_OptionalAssertValid(_instance_)
+#else
+#  define parcFileIOQueue_OptionalAssertValid(_instance_) parcFileIOQueue_AssertValid(_instance_)
+#endif
+
+/**
+ * Create a `PARCFileIOQueue` with the given number of worker threads.
+ *
+ * @param [in] threadCount The number of worker threads, which must be at least 1.
+ * @param [in] notifier A pointer to a valid `PARCNotifier` to notify of completions, or NULL.
+ *
+ * @return non-NULL A pointer to a valid PARCFileIOQueue instance.
+ * @return NULL An error occurred.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCFileIOQueue *queue = parcFileIOQueue_Create(8, NULL);
+ *
+ *     parcFileIOQueue_Release(&queue);
+ * }
+ * @endcode
+ */
+PARCFileIOQueue *parcFileIOQueue_Create(size_t threadCount, PARCNotifier *notifier);
+
+/**
+ * Increase the number of references to a `PARCFileIOQueue` instance.
+ *
+ * @param [in] instance A pointer to a valid PARCFileIOQueue instance.
+ *
+ * @return The same value as @p instance.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCFileIOQueue *a = parcFileIOQueue_Create(8, NULL);
+ *
+ *     PARCFileIOQueue *b = parcFileIOQueue_Acquire(a);
+ *
+ *     parcFileIOQueue_Release(&a);
+ *     parcFileIOQueue_Release(&b);
+ * }
+ * @endcode
+ */
+PARCFileIOQueue *parcFileIOQueue_Acquire(const PARCFileIOQueue *instance);
+
+/**
+ * Release a previously acquired reference to the given `PARCFileIOQueue` instance,
+ * decrementing the reference count for the instance.
+ *
+ * The pointer to the instance is set to NULL as a side-effect of this function.
+ *
+ * If the invocation causes the last reference to the instance to be released,
+ * the queue waits for its worker threads to finish the requests they are performing,
+ * and releases the remaining requests and unreaped completions.
+ *
+ * @param [in,out] instancePtr A pointer to a pointer to the instance to release.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCFileIOQueue *queue = parcFileIOQueue_Create(8, NULL);
+ *
+ *     parcFileIOQueue_Release(&queue);
+ * }
+ * @endcode
+ */
+void parcFileIOQueue_Release(PARCFileIOQueue **instancePtr);
+
+/**
+ * Determine if an instance of `PARCFileIOQueue` is valid.
+ *
+ * @param [in] instance A pointer to a `PARCFileIOQueue` instance.
+ *
+ * @return true The instance is valid.
+ * @return false The instance is not valid.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCFileIOQueue *queue = parcFileIOQueue_Create(8, NULL);
+ *
+ *     if (parcFileIOQueue_IsValid(queue)) {
+ *         printf("Instance is valid.\n");
+ *     }
+ *
+ *     parcFileIOQueue_Release(&queue);
+ * }
+ * @endcode
+ */
+bool parcFileIOQueue_IsValid(const PARCFileIOQueue *instance);
+
+/**
+ * Assert that the given `PARCFileIOQueue` instance is valid.
+ *
+ * @param [in] instance A pointer to a valid PARCFileIOQueue instance.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCFileIOQueue *queue = parcFileIOQueue_Create(8, NULL);
+ *
+ *     parcFileIOQueue_AssertValid(queue);
+ *
+ *     parcFileIOQueue_Release(&queue);
+ * }
+ * @endcode
+ */
+void parcFileIOQueue_AssertValid(const PARCFileIOQueue *instance);
+
+/**
+ * Submit a batch of requests.
+ *
+ * The requests are performed in no particular order, possibly at the same time, so requests that overlap
+ * in the same file must not be submitted together if their order matters.
+ *
+ * @param [in] queue A pointer to a valid PARCFileIOQueue instance.
+ * @param [in] count The number of requests.
+ * @param [in] requests The requests. The array may be reused as soon as this function returns.
+ *
+ * @return The number of requests submitted, which is less than @p count only if memory could not be allocated.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCFileIORequest requests[64];
+ *     for (size_t i = 0; i < 64; i++) {
+ *         requests[i] = (PARCFileIORequest) {
+ *             .operation = PARCFileIOOperation_Read, .file = file, .offset = i * 4096, .length = 4096
+ *         };
+ *     }
+ *     parcFileIOQueue_Submit(queue, 64, requests);
+ * }
+ * @endcode
+ */
+size_t parcFileIOQueue_Submit(PARCFileIOQueue *queue, size_t count, const PARCFileIORequest requests[count]);
+
+/**
+ * Take up to @p count available completions, without waiting.
+ *
+ * @param [in] queue A pointer to a valid PARCFileIOQueue instance.
+ * @param [in] count The number of elements of @p completions.
+ * @param [out] completions The array to receive the completions.
+ *
+ * @return The number of completions stored in @p completions.
+ *
+ * Example:
+ * @code
+ * {
+ *     // Called when parcNotifier_Socket(notifier) is readable.
+ *     parcNotifier_PauseEvents(notifier);
+ *
+ *     PARCFileIOCompletion completions[64];
+ *     size_t count;
+ *     while ((count = parcFileIOQueue_Reap(queue, 64, completions)) > 0) {
+ *         for (size_t i = 0; i < count; i++) {
+ *             ...
+ *             parcBuffer_Release(&completions[i].buffer);
+ *         }
+ *     }
+ *
+ *     parcNotifier_StartEvents(notifier);
+ * }
+ * @endcode
+ */
+size_t parcFileIOQueue_Reap(PARCFileIOQueue *queue, size_t count, PARCFileIOCompletion completions[count]);
+
+/**
+ * Take up to @p count completions, waiting until at least @p minimum are available.
+ *
+ * The wait ends early if fewer than @p minimum requests remain outstanding.
+ *
+ * @param [in] queue A pointer to a valid PARCFileIOQueue instance.
+ * @param [in] minimum The number of completions to wait for, which must not exceed @p count.
+ * @param [in] count The number of elements of @p completions.
+ * @param [out] completions The array to receive the completions.
+ *
+ * @return The number of completions stored in @p completions.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCFileIOCompletion completions[64];
+ *     size_t count = parcFileIOQueue_Wait(queue, 1, 64, completions);
+ * }
+ * @endcode
+ */
+size_t parcFileIOQueue_Wait(PARCFileIOQueue *queue, size_t minimum, size_t count, PARCFileIOCompletion completions[count]);
+
+/**
+ * Return the number of requests submitted whose completions have not yet been taken.
+ *
+ * @param [in] queue A pointer to a valid PARCFileIOQueue instance.
+ *
+ * @return The number of outstanding requests.
+ *
+ * Example:
+ * @code
+ * {
+ *     while (parcFileIOQueue_Outstanding(queue) > 0) {
+ *         size_t count = parcFileIOQueue_Wait(queue, 1, 64, completions);
+ *         ...
+ *     }
+ * }
+ * @endcode
+ */
+size_t parcFileIOQueue_Outstanding(const PARCFileIOQueue *queue);
+#endif // libparc_parc_FileIOQueue_h
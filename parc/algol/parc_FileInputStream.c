@@ -30,6 +30,7 @@
  */
 #include <config.h>
 
+#include <errno.h>
 #include <fcntl.h>
 #include <stdio.h>
 #include <sys/types.h>
@@ -102,12 +103,37 @@ parcFileInputStream_Read(PARCFileInputStream *inputStream, PARCBuffer *buffer)
     while (parcBuffer_HasRemaining(buffer)) {
         void *buf = parcBuffer_Overlay(buffer, 0);
         ssize_t nread = read(inputStream->fd, buf, parcBuffer_Remaining(buffer));
-        if (nread < 0) {
+        if (nread < 0 && errno == EINTR) {
+            continue;
+        }
+        if (nread <= 0) {
+            // End of file or an error: the buffer cannot be filled.
             break;
         }
         parcBuffer_SetPosition(buffer, parcBuffer_Position(buffer) + nread);
     }
-    return parcBuffer_HasRemaining(buffer);
+    return !parcBuffer_HasRemaining(buffer);
+}
+
+PARCBuffer *
+parcFileInputStream_ReadIntoPooledBuffer(PARCFileInputStream *inputStream, PARCBufferPool *pool, size_t length)
+{
+    PARCBuffer *result = parcBufferPool_GetBuffer(pool, length);
+
+    if (result != NULL) {
+        ssize_t nread;
+        do {
+            nread = read(inputStream->fd, parcBuffer_Overlay(result, 0), length);
+        } while (nread < 0 && errno == EINTR);
+
+        if (nread <= 0) {
+            parcBuffer_Release(&result);
+        } else {
+            parcBuffer_SetLimit(result, nread);
+        }
+    }
+
+    return result;
 }
 
 PARCBuffer *
@@ -126,3 +152,21 @@ parcFileInputStream_ReadFile(PARCFileInputStream *inputStream)
 
     return result;
 }
+
+PARCBuffer *
+parcFileInputStream_Map(PARCFileInputStream *inputStream)
+{
+    PARCBuffer *result = NULL;
+
+    struct stat statbuf;
+
+    if (fstat(inputStream->fd, &statbuf) == 0 && S_ISREG(statbuf.st_mode)) {
+        PARCByteArray *array = parcByteArray_MapFile(inputStream->fd, 0, (size_t) statbuf.st_size);
+        if (array != NULL) {
+            result = parcBuffer_WrapByteArray(array, 0, parcByteArray_Capacity(array));
+            parcByteArray_Release(&array);
+        }
+    }
+
+    return result;
+}
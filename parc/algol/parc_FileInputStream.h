@@ -41,6 +41,7 @@
 
 #include <parc/algol/parc_File.h>
 #include <parc/algol/parc_Buffer.h>
+#include <parc/algol/parc_BufferPool.h>
 #include <parc/algol/parc_InputStream.h>
 
 struct parc_file_input_stream;
@@ -60,7 +61,7 @@ typedef struct parc_file_input_stream PARCFileInputStream;
  * <#example#>
  * @endcode
  */
-PARCInputStreamInterface *PARCFileInputStreamAsPARCInputStream;
+extern PARCInputStreamInterface *PARCFileInputStreamAsPARCInputStream;
 
 /**
  * Create a `PARCFileInputStream` instance.
@@ -134,7 +135,8 @@ void parcFileInputStream_Release(PARCFileInputStream **inputStreamPtr);
 /**
  * Read a `PARCFileInputStream` into a {@link PARCBuffer}.
  *
- * The contents of the `PARCBuffer` are filled from the current position to the limit.
+ * The contents of the `PARCBuffer` are filled from the current position to the limit,
+ * or until the end of the file or an error.
  * When this function returns, the position is set to the end of the last successfully read byte of data.
  *
  * @param [in] inputStream The `PARCInputStream` to read.
@@ -164,6 +166,33 @@ void parcFileInputStream_Release(PARCFileInputStream **inputStreamPtr);
  */
 bool parcFileInputStream_Read(PARCFileInputStream *inputStream, PARCBuffer *buffer);
 
+/**
+ * Read up to @p length bytes from a `PARCFileInputStream` into a buffer from the given pool.
+ *
+ * This performs a single read, so fewer than @p length bytes may be returned,
+ * as is usual for a datagram, a pipe, or a socket.
+ * The returned buffer's position is 0 and its limit is the number of bytes read.
+ *
+ * @param [in] inputStream The `PARCFileInputStream` to read.
+ * @param [in] pool The `PARCBufferPool` from which to get the buffer.
+ * @param [in] length The largest number of bytes to read.
+ *
+ * @return non-NULL A `PARCBuffer` from @p pool, which the caller must release.
+ * @return NULL The end of the file was reached, or an error occurred.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCBuffer *buffer;
+ *     while ((buffer = parcFileInputStream_ReadIntoPooledBuffer(stream, pool, 2048)) != NULL) {
+ *         ...
+ *         parcBuffer_Release(&buffer);
+ *     }
+ * }
+ * @endcode
+ */
+PARCBuffer *parcFileInputStream_ReadIntoPooledBuffer(PARCFileInputStream *inputStream, PARCBufferPool *pool, size_t length);
+
 /**
  * Read the content of a `PARCFileInputStream` into a {@link PARCBuffer}.
  *
@@ -180,4 +209,37 @@ bool parcFileInputStream_Read(PARCFileInputStream *inputStream, PARCBuffer *buff
  * @endcode
  */
 PARCBuffer *parcFileInputStream_ReadFile(PARCFileInputStream *inputStream);
+
+/**
+ * Map the entire contents of the file underlying the given `PARCFileInputStream` into a new `PARCBuffer`.
+ *
+ * This is an alternative to {@link parcFileInputStream_ReadFile} for large files:
+ * no memory is allocated for the contents and nothing is read until the bytes are accessed.
+ * The result is unaffected by the stream's current read offset and remains valid after the stream is released.
+ * The mapping is read-only and the result is frozen; see {@link parcBuffer_MapFile} for the properties of the mapping.
+ *
+ * @param [in] inputStream A pointer to a valid `PARCFileInputStream` instance.
+ *
+ * @return NULL The file could not be mapped, for example because it is a pipe or socket.
+ * @return non-NULL A pointer to a `PARCBuffer` with position 0 and limit the size of the file.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCFile *file = parcFile_Create("content.bin");
+ *     PARCFileInputStream *stream = parcFileInputStream_Open(file);
+ *
+ *     PARCBuffer *content = parcFileInputStream_Map(stream);
+ *     parcFileInputStream_Release(&stream);
+ *
+ *     // use content as needed
+ *
+ *     parcBuffer_Release(&content);
+ *     parcFile_Release(&file);
+ * }
+ * @endcode
+ *
+ * @see parcBuffer_MapFile
+ */
+PARCBuffer *parcFileInputStream_Map(PARCFileInputStream *inputStream);
 #endif // libparc_parc_FileInputStream_h
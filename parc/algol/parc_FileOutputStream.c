@@ -30,8 +30,11 @@
  */
 #include <config.h>
 
+#include <errno.h>
+#include <limits.h>
 #include <stdio.h>
 #include <unistd.h>
+#include <sys/uio.h>
 
 #include <LongBow/runtime.h>
 
@@ -41,7 +44,8 @@
 PARCOutputStreamInterface *PARCFileOutputStreamAsPARCInputStream = &(PARCOutputStreamInterface) {
     .Acquire = (PARCOutputStream * (*)(PARCOutputStream *))parcFileOutputStream_Acquire,
     .Release = (void (*)(PARCOutputStream **))parcFileOutputStream_Release,
-    .Write = (size_t (*)(PARCOutputStream *, PARCBuffer *))parcFileOutputStream_Write
+    .Write = (size_t (*)(PARCOutputStream *, PARCBuffer *))parcFileOutputStream_Write,
+    .WriteBufferChain = (size_t (*)(PARCOutputStream *, PARCBufferChain *))parcFileOutputStream_WriteBufferChain
 };
 
 struct parc_file_output_stream {
@@ -96,3 +100,29 @@ parcFileOutputStream_Write(PARCFileOutputStream *outputStream, PARCBuffer *buffe
 
     return parcBuffer_HasRemaining(buffer) == false;
 }
+
+#ifndef IOV_MAX
+#  define IOV_MAX 1024
+#endif
+
+size_t
+parcFileOutputStream_WriteBufferChain(PARCFileOutputStream *outputStream, PARCBufferChain *chain)
+{
+    struct iovec iov[64 < IOV_MAX ? 64 : IOV_MAX];
+    size_t result = 0;
+
+    while (parcBufferChain_Length(chain) > 0) {
+        int iovcnt = (int) parcBufferChain_GetIOVec(chain, sizeof(iov) / sizeof(iov[0]), iov);
+        ssize_t nwritten = writev(outputStream->fd, iov, iovcnt);
+        if (nwritten == -1) {
+            if (errno == EINTR) {
+                continue;
+            }
+            break;
+        }
+        parcBufferChain_Consume(chain, (size_t) nwritten);
+        result += (size_t) nwritten;
+    }
+
+    return result;
+}
@@ -152,4 +152,34 @@ void parcFileOutputStream_Release(PARCFileOutputStream **streamPtr);
  * @endcode
  */
 bool parcFileOutputStream_Write(PARCFileOutputStream *outputStream, PARCBuffer *buffer);
+
+/**
+ * Write the contents of the given `PARCBufferChain` to the output stream with `writev(2)`,
+ * without copying the segments into a contiguous buffer.
+ *
+ * Partial writes are resumed until every byte has been written or an error occurs.
+ * The chain is consumed as a side-effect: the bytes written are removed from it.
+ *
+ * @param [in] outputStream A pointer to a valid `PARCFileOutputStream`.
+ * @param [in,out] chain A pointer to a valid `PARCBufferChain`.
+ *
+ * @return The number of bytes written. This is less than the original length of the chain only if an error occurred.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCFileOutputStream *stream = parcFileOutputStream_Create(open("/tmp/file", O_CREAT | O_WRONLY | O_TRUNC, 0600));
+ *
+ *     PARCBufferChain *message = parcBufferChain_Create();
+ *     parcBufferChain_Append(message, header);
+ *     parcBufferChain_Append(message, payload);
+ *
+ *     parcFileOutputStream_WriteBufferChain(stream, message);
+ *
+ *     parcBufferChain_Release(&message);
+ *     parcFileOutputStream_Release(&stream);
+ * }
+ * @endcode
+ */
+size_t parcFileOutputStream_WriteBufferChain(PARCFileOutputStream *outputStream, PARCBufferChain *chain);
 #endif // libparc_parc_FileOutputStream_h
@@ -97,7 +97,7 @@ parcHash64_Data_Cumulative(const void *data, size_t len, uint64_t lastValue)
     // Standard FNV 64-bit prime: see http://www.isthe.com/chongo/tech/comp/fnv/#FNV-param
     const uint64_t fnv1a_prime = 0x00000100000001B3ULL;
     uint64_t hash = lastValue;
-    const char *chardata = data;
+    const uint8_t *chardata = data;
 
     for (size_t i = 0; i < len; i++) {
         hash = hash ^ chardata[i];
@@ -134,7 +134,7 @@ parcHash32_Data_Cumulative(const void *data, size_t len, uint32_t lastValue)
     const uint32_t fnv1a_prime = 0x01000193;
     uint32_t hash = lastValue;
 
-    const char *chardata = data;
+    const uint8_t *chardata = data;
 
     for (size_t i = 0; i < len; i++) {
         hash = hash ^ chardata[i];
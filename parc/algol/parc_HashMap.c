@@ -103,16 +103,56 @@ _parcHashMap_GetEntry(const PARCHashMap *hashMap, const PARCObject *key)
 
     _PARCHashMapEntry *result = NULL;
 
-    PARCIterator *iterator = parcLinkedList_CreateIterator(hashMap->buckets[bucket]);
-
-    while (parcIterator_HasNext(iterator)) {
-        _PARCHashMapEntry *entry = parcIterator_Next(iterator);
+    _PARCHashMapEntry *entry;
+    parcLinkedList_ForEach(hashMap->buckets[bucket], entry) {
         if (parcObject_Equals(key, entry->key)) {
             result = entry;
             break;
         }
     }
-    parcIterator_Release(&iterator);
+
+    return result;
+}
+
+/*
+ * The cursor index is the current bucket and the position is the cursor position within that bucket's list.
+ * The cursor is kept settled: either the current bucket has an entry after the position,
+ * or the index is the capacity and the traversal is complete. So each bucket is examined once.
+ */
+static void
+_parcHashMap_CursorSettle(PARCCursor *cursor)
+{
+    const PARCHashMap *hashMap = cursor->collection;
+
+    if (cursor->index < hashMap->capacity) {
+        PARCCursor bucketCursor = parcLinkedList_Cursor(hashMap->buckets[cursor->index]);
+        bucketCursor.position = cursor->position;
+
+        if (parcLinkedList_CursorHasNext(&bucketCursor) == false) {
+            size_t bucket = cursor->index + 1;
+            while (bucket < hashMap->capacity && parcLinkedList_IsEmpty(hashMap->buckets[bucket])) {
+                bucket++;
+            }
+            cursor->index = bucket;
+            cursor->position = NULL;
+        }
+    }
+}
+
+static _PARCHashMapEntry *
+_parcHashMap_CursorNextEntry(PARCCursor *cursor)
+{
+    const PARCHashMap *hashMap = cursor->collection;
+
+    trapOutOfBoundsIf(cursor->index >= hashMap->capacity, "No more elements.");
+
+    PARCCursor bucketCursor = parcLinkedList_Cursor(hashMap->buckets[cursor->index]);
+    bucketCursor.position = cursor->position;
+
+    _PARCHashMapEntry *result = parcLinkedList_CursorNext(&bucketCursor);
+    cursor->position = bucketCursor.position;
+
+    _parcHashMap_CursorSettle(cursor);
 
     return result;
 }
@@ -124,19 +164,25 @@ static parcObject_ImplementRelease(_parcHashMapEntry, _PARCHashMapEntry);
 parcObject_ExtendPARCObject(_PARCHashMapEntry, _parcHashMapEntry_Finalize, NULL, NULL, _parcHashMapEntry_Equals, NULL, _parcHashMapEntry_HashCode, NULL);
 
 static _PARCHashMapEntry *
-_parcHashMapEntry_Create(const PARCObject *key, const PARCObject *value)
+_parcHashMapEntry_CreateWithKey(const PARCObject *key, const PARCObject *value, bool shareKey)
 {
     parcObject_OptionalAssertValid(key);
     parcObject_OptionalAssertValid(value);
 
     _PARCHashMapEntry *result = parcObject_CreateInstance(_PARCHashMapEntry);
 
-    result->key = parcObject_Copy(key);
+    result->key = shareKey ? parcObject_Acquire(key) : parcObject_Copy(key);
     result->value = parcObject_Acquire(value);
 
     return result;
 }
 
+static inline _PARCHashMapEntry *
+_parcHashMapEntry_Create(const PARCObject *key, const PARCObject *value)
+{
+    return _parcHashMapEntry_CreateWithKey(key, value, false);
+}
+
 static void
 _parcHashMap_Finalize(PARCHashMap **instancePtr)
 {
@@ -218,18 +264,16 @@ parcHashMap_Display(const PARCHashMap *hashMap, int indentation)
 {
     parcDisplayIndented_PrintLine(indentation, "PARCHashMap@%p {", hashMap);
 
-    PARCIterator *iterator = parcHashMap_CreateKeyIterator((PARCHashMap *) hashMap);
+    PARCCursor cursor = parcHashMap_Cursor(hashMap);
 
-    while (parcIterator_HasNext(iterator)) {
-        PARCObject *keyObject = parcIterator_Next(iterator);
-        const PARCObject *valueObject = parcHashMap_Get(hashMap, keyObject);
-        char *key = parcObject_ToString(keyObject);
-        char *value = parcObject_ToString(valueObject);
+    while (parcHashMap_CursorHasNext(&cursor)) {
+        _PARCHashMapEntry *entry = _parcHashMap_CursorNextEntry(&cursor);
+        char *key = parcObject_ToString(entry->key);
+        char *value = parcObject_ToString(entry->value);
         parcDisplayIndented_PrintLine(indentation + 1, "%s -> %s", key, value);
         parcMemory_Deallocate(&key);
         parcMemory_Deallocate(&value);
     }
-    parcIterator_Release(&iterator);
 
     parcDisplayIndented_PrintLine(indentation, "}");
 }
@@ -292,14 +336,11 @@ parcHashMap_IsValid(const PARCHashMap *map)
                     result = false;
                     break;
                 }
-                PARCIterator *iterator = parcLinkedList_CreateIterator(map->buckets[i]);
-                while (parcIterator_HasNext(iterator)) {
-                    _PARCHashMapEntry *entry = parcIterator_Next(iterator);
+                _PARCHashMapEntry *entry;
+                parcLinkedList_ForEach(map->buckets[i], entry) {
                     parcObject_IsValid(entry->key);
                     parcObject_IsValid(entry->value);
                 }
-
-                parcIterator_Release(&iterator);
             }
         }
     }
@@ -314,13 +355,12 @@ parcHashMap_ToJSON(const PARCHashMap *hashMap)
 
     PARCJSON *result = parcJSON_Create();
 
-    PARCIterator *iterator = parcHashMap_CreateKeyIterator((PARCHashMap *) hashMap);
+    PARCCursor cursor = parcHashMap_Cursor(hashMap);
 
-    while (parcIterator_HasNext(iterator)) {
-        PARCObject *keyObject = parcIterator_Next(iterator);
-        const PARCObject *valueObject = parcHashMap_Get(hashMap, keyObject);
-        char *key = parcObject_ToString(keyObject);
-        PARCJSON *value = parcObject_ToJSON(valueObject);
+    while (parcHashMap_CursorHasNext(&cursor)) {
+        _PARCHashMapEntry *entry = _parcHashMap_CursorNextEntry(&cursor);
+        char *key = parcObject_ToString(entry->key);
+        PARCJSON *value = parcObject_ToJSON(entry->value);
 
         parcJSON_AddObject(result, key, value);
 
@@ -328,29 +368,23 @@ parcHashMap_ToJSON(const PARCHashMap *hashMap)
         parcJSON_Release(&value);
     }
 
-    parcIterator_Release(&iterator);
-
-
     return result;
 }
 
 PARCBufferComposer *
 parcHashMap_BuildString(const PARCHashMap *hashMap, PARCBufferComposer *composer)
 {
-    PARCIterator *iterator = parcHashMap_CreateKeyIterator((PARCHashMap *) hashMap);
+    PARCCursor cursor = parcHashMap_Cursor(hashMap);
 
-    while (parcIterator_HasNext(iterator)) {
-        PARCObject *keyObject = parcIterator_Next(iterator);
-        const PARCObject *valueObject = parcHashMap_Get(hashMap, keyObject);
-        char *key = parcObject_ToString(keyObject);
-        char *value = parcObject_ToString(valueObject);
+    while (parcHashMap_CursorHasNext(&cursor)) {
+        _PARCHashMapEntry *entry = _parcHashMap_CursorNextEntry(&cursor);
+        char *key = parcObject_ToString(entry->key);
+        char *value = parcObject_ToString(entry->value);
         parcBufferComposer_Format(composer, "%s -> %s\n", key, value);
         parcMemory_Deallocate(&key);
         parcMemory_Deallocate(&value);
     }
 
-    parcIterator_Release(&iterator);
-
     return composer;
 }
 
@@ -410,8 +444,8 @@ parcHashMap_Remove(PARCHashMap *hashMap, const PARCObject *key)
     return result;
 }
 
-PARCHashMap *
-parcHashMap_Put(PARCHashMap *hashMap, const PARCObject *key, const PARCObject *value)
+static PARCHashMap *
+_parcHashMap_Put(PARCHashMap *hashMap, const PARCObject *key, const PARCObject *value, bool shareKey)
 {
     _PARCHashMapEntry *entry = _parcHashMap_GetEntry(hashMap, key);
 
@@ -421,7 +455,7 @@ parcHashMap_Put(PARCHashMap *hashMap, const PARCObject *key, const PARCObject *v
             entry->value = parcObject_Acquire(value);
         }
     } else {
-        entry = _parcHashMapEntry_Create(key, value);
+        entry = _parcHashMapEntry_CreateWithKey(key, value, shareKey);
 
         PARCHashCode keyHash = parcObject_HashCode(key);
         int bucket = keyHash % hashMap->capacity;
@@ -434,6 +468,18 @@ parcHashMap_Put(PARCHashMap *hashMap, const PARCObject *key, const PARCObject *v
     return hashMap;
 }
 
+PARCHashMap *
+parcHashMap_Put(PARCHashMap *hashMap, const PARCObject *key, const PARCObject *value)
+{
+    return _parcHashMap_Put(hashMap, key, value, false);
+}
+
+PARCHashMap *
+parcHashMap_PutShared(PARCHashMap *hashMap, const PARCObject *key, const PARCObject *value)
+{
+    return _parcHashMap_Put(hashMap, key, value, true);
+}
+
 const PARCObject *
 parcHashMap_Get(const PARCHashMap *hashMap, const PARCObject *key)
 {
@@ -563,3 +609,46 @@ parcHashMap_CreateKeyIterator(PARCHashMap *hashMap)
 
     return iterator;
 }
+
+PARCCursor
+parcHashMap_Cursor(const PARCHashMap *hashMap)
+{
+    parcHashMap_OptionalAssertValid(hashMap);
+
+    PARCCursor result = { .collection = hashMap, .position = NULL, .index = 0 };
+    _parcHashMap_CursorSettle(&result);
+    return result;
+}
+
+bool
+parcHashMap_CursorHasNext(const PARCCursor *cursor)
+{
+    const PARCHashMap *hashMap = cursor->collection;
+
+    return cursor->index < hashMap->capacity;
+}
+
+void
+parcHashMap_CursorNext(PARCCursor *cursor, PARCObject **keyPtr, PARCObject **valuePtr)
+{
+    _PARCHashMapEntry *entry = _parcHashMap_CursorNextEntry(cursor);
+
+    if (keyPtr != NULL) {
+        *keyPtr = entry->key;
+    }
+    if (valuePtr != NULL) {
+        *valuePtr = entry->value;
+    }
+}
+
+PARCObject *
+parcHashMap_CursorNextKey(PARCCursor *cursor)
+{
+    return _parcHashMap_CursorNextEntry(cursor)->key;
+}
+
+PARCObject *
+parcHashMap_CursorNextValue(PARCCursor *cursor)
+{
+    return _parcHashMap_CursorNextEntry(cursor)->value;
+}
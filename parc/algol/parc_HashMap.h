@@ -488,6 +488,30 @@ parcObject_ImplementIsLocked(parcHashMap, PARCHashMap);
  */
 PARCHashMap *parcHashMap_Put(PARCHashMap *hashMap, const PARCObject *key, const PARCObject *value);
 
+/**
+ * Associate `value` with `key`, retaining a reference to `key` rather than a copy of it.
+ *
+ * This behaves like {@link parcHashMap_Put} except that a new entry acquires `key` instead of copying it,
+ * so many maps may share one canonical key instance (see `PARCInternPool`).
+ * The caller must not modify `key` after it has been put.
+ *
+ * @param [in] hashMap A pointer to a valid PARCHashMap instance.
+ * @param [in] key A pointer to a valid PARCObject that will not be modified.
+ * @param [in] value A pointer to a valid PARCObject.
+ *
+ * @return The given `PARCHashMap`.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCBuffer *key = parcInternPool_InternBuffer(pool, name);
+ *     parcHashMap_PutShared(hashMap, key, value);
+ *     parcBuffer_Release(&key);
+ * }
+ * @endcode
+ */
+PARCHashMap *parcHashMap_PutShared(PARCHashMap *hashMap, const PARCObject *key, const PARCObject *value);
+
 /**
  * Returns the value to which the specified key is mapped,
  * or null if this map contains no mapping for the key.
@@ -607,4 +631,117 @@ PARCIterator *parcHashMap_CreateValueIterator(PARCHashMap *hashMap);
  * @endcode
  */
 PARCIterator *parcHashMap_CreateKeyIterator(PARCHashMap *hashMap);
+
+/**
+ * Create a `PARCCursor` positioned before the first entry of the given `PARCHashMap`.
+ *
+ * The cursor is returned by value and requires no allocation or release.
+ * The map must not be modified while the cursor is in use.
+ * Entries are visited in an unspecified order.
+ *
+ * @param [in] hashMap A pointer to a valid `PARCHashMap`.
+ *
+ * @return A `PARCCursor` for use with {@link parcHashMap_CursorHasNext}, {@link parcHashMap_CursorNext},
+ *         {@link parcHashMap_CursorNextKey} and {@link parcHashMap_CursorNextValue}.
+ *
+ * Example:
+ * @code
+ * {
+ *    PARCCursor cursor = parcHashMap_Cursor(hashMap);
+ *
+ *    while (parcHashMap_CursorHasNext(&cursor)) {
+ *        PARCObject *key = parcHashMap_CursorNextKey(&cursor);
+ *    }
+ * }
+ * @endcode
+ */
+PARCCursor parcHashMap_Cursor(const PARCHashMap *hashMap);
+
+/**
+ * Return true if a call to one of the `parcHashMap_CursorNext` functions would return an element.
+ *
+ * @param [in] cursor A pointer to a `PARCCursor` initialised by {@link parcHashMap_Cursor}.
+ *
+ * @return true There are more entries.
+ * @return false There are no more entries.
+ */
+bool parcHashMap_CursorHasNext(const PARCCursor *cursor);
+
+/**
+ * Advance the cursor to the next entry and return both its key and its value.
+ *
+ * If there are no remaining entries, this function induces a trapOutOfBounds.
+ *
+ * @param [in,out] cursor A pointer to a `PARCCursor` initialised by {@link parcHashMap_Cursor}.
+ * @param [out] keyPtr If not NULL, set to the key of the next entry.
+ * @param [out] valuePtr If not NULL, set to the value of the next entry.
+ *
+ * Example:
+ * @code
+ * {
+ *    PARCCursor cursor = parcHashMap_Cursor(hashMap);
+ *
+ *    while (parcHashMap_CursorHasNext(&cursor)) {
+ *        PARCObject *key;
+ *        PARCObject *value;
+ *        parcHashMap_CursorNext(&cursor, &key, &value);
+ *    }
+ * }
+ * @endcode
+ */
+void parcHashMap_CursorNext(PARCCursor *cursor, PARCObject **keyPtr, PARCObject **valuePtr);
+
+/**
+ * Advance the cursor to the next entry and return its key.
+ *
+ * If there are no remaining entries, this function induces a trapOutOfBounds.
+ *
+ * @param [in,out] cursor A pointer to a `PARCCursor` initialised by {@link parcHashMap_Cursor}.
+ *
+ * @return The key of the next entry.
+ */
+PARCObject *parcHashMap_CursorNextKey(PARCCursor *cursor);
+
+/**
+ * Advance the cursor to the next entry and return its value.
+ *
+ * If there are no remaining entries, this function induces a trapOutOfBounds.
+ *
+ * @param [in,out] cursor A pointer to a `PARCCursor` initialised by {@link parcHashMap_Cursor}.
+ *
+ * @return The value of the next entry.
+ */
+PARCObject *parcHashMap_CursorNextValue(PARCCursor *cursor);
+
+/**
+ * Execute the following statement once for each key in the given `PARCHashMap`,
+ * assigning each key in turn to the variable @p _key_.
+ *
+ * @param [in] _hashMap_ A pointer to a valid `PARCHashMap`.
+ * @param [out] _key_ An lvalue that is assigned each key in turn.
+ *
+ * Example:
+ * @code
+ * {
+ *    PARCBuffer *key;
+ *    parcHashMap_ForEachKey(hashMap, key) {
+ *        parcBuffer_Display(key, 0);
+ *    }
+ * }
+ * @endcode
+ */
+#define parcHashMap_ForEachKey(_hashMap_, _key_) \
+    for (PARCCursor _parcCursor = parcHashMap_Cursor(_hashMap_); \
+         parcHashMap_CursorHasNext(&_parcCursor) && ((_key_ = parcHashMap_CursorNextKey(&_parcCursor)), true); )
+
+/**
+ * Execute the following statement once for each value in the given `PARCHashMap`,
+ * assigning each value in turn to the variable @p _value_.
+ *
+ * @param [in] _hashMap_ A pointer to a valid `PARCHashMap`.
+ * @param [out] _value_ An lvalue that is assigned each value in turn.
+ */
+#define parcHashMap_ForEachValue(_hashMap_, _value_) \
+    for (PARCCursor _parcCursor = parcHashMap_Cursor(_hashMap_); \
+         parcHashMap_CursorHasNext(&_parcCursor) && ((_value_ = parcHashMap_CursorNextValue(&_parcCursor)), true); )
 #endif
@@ -0,0 +1,380 @@
+/*
+ * Copyright (c) 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Patent rights are not granted under this agreement. Patent rights are
+ *       available under FRAND terms.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX or PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * @copyright 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC).  All rights reserved.
+ */
+#include <config.h>
+
+#include <inttypes.h>
+#include <string.h>
+#include <pthread.h>
+
+#include <LongBow/runtime.h>
+
+#include <parc/algol/parc_InternPool.h>
+#include <parc/algol/parc_Object.h>
+#include <parc/algol/parc_Memory.h>
+#include <parc/algol/parc_DisplayIndented.h>
+
+typedef enum {
+    _PARCInternPoolKind_String,
+    _PARCInternPoolKind_Buffer
+} _PARCInternPoolKind;
+
+typedef struct parc_intern_pool_entry {
+    // The canonical instance, either a PARCString or a PARCBuffer.
+    PARCObject *instance;
+    _PARCInternPoolKind kind;
+
+    // The content of the canonical instance, which never changes.
+    const void *bytes;
+    size_t length;
+    PARCHashCode hashCode;
+
+    // The next entry in the same hash bucket.
+    struct parc_intern_pool_entry *chain;
+} _PARCInternPoolEntry;
+
+struct PARCInternPool {
+    pthread_mutex_t mutex;
+
+    _PARCInternPoolEntry **buckets;
+    size_t bucketMask;
+    size_t size;
+
+    uint64_t lookups;
+    uint64_t hits;
+    uint64_t bytesSaved;
+};
+
+#define _PARCInternPool_InitialBucketCount 64
+
+static void
+_parcInternPool_ReleaseInstance(_PARCInternPoolEntry *entry)
+{
+    if (entry->kind == _PARCInternPoolKind_String) {
+        PARCString *string = entry->instance;
+        parcString_Release(&string);
+    } else {
+        PARCBuffer *buffer = entry->instance;
+        parcBuffer_Release(&buffer);
+    }
+}
+
+static void
+_parcInternPool_Finalize(PARCInternPool **instancePtr)
+{
+    assertNotNull(instancePtr, "Parameter must be a non-null pointer to a PARCInternPool pointer.");
+    PARCInternPool *pool = *instancePtr;
+
+    for (size_t i = 0; i <= pool->bucketMask; i++) {
+        _PARCInternPoolEntry *entry = pool->buckets[i];
+        while (entry != NULL) {
+            _PARCInternPoolEntry *next = entry->chain;
+            _parcInternPool_ReleaseInstance(entry);
+            parcMemory_Deallocate((void **) &entry);
+            entry = next;
+        }
+    }
+    parcMemory_Deallocate((void **) &pool->buckets);
+    pthread_mutex_destroy(&pool->mutex);
+}
+
+parcObject_ImplementAcquire(parcInternPool, PARCInternPool);
+
+parcObject_ImplementRelease(parcInternPool, PARCInternPool);
+
+parcObject_ExtendPARCObject(PARCInternPool, _parcInternPool_Finalize, NULL, NULL, NULL, NULL, NULL, NULL);
+
+void
+parcInternPool_AssertValid(const PARCInternPool *instance)
+{
+    assertTrue(parcInternPool_IsValid(instance),
+               "PARCInternPool is not valid.");
+}
+
+bool
+parcInternPool_IsValid(const PARCInternPool *instance)
+{
+    bool result = false;
+
+    if (instance != NULL) {
+        result = instance->buckets != NULL;
+    }
+
+    return result;
+}
+
+PARCInternPool *
+parcInternPool_Create(void)
+{
+    PARCInternPool *result = parcObject_CreateInstance(PARCInternPool);
+
+    if (result != NULL) {
+        pthread_mutex_init(&result->mutex, NULL);
+        size_t length = _PARCInternPool_InitialBucketCount * sizeof(_PARCInternPoolEntry *);
+        result->buckets = parcMemory_AllocateAndClear(length);
+        assertNotNull(result->buckets, "parcMemory_AllocateAndClear(%zu) returned NULL", length);
+        result->bucketMask = _PARCInternPool_InitialBucketCount - 1;
+        result->size = 0;
+        result->lookups = 0;
+        result->hits = 0;
+        result->bytesSaved = 0;
+    }
+
+    return result;
+}
+
+void
+parcInternPool_Display(const PARCInternPool *instance, int indentation)
+{
+    PARCInternPool *pool = (PARCInternPool *) instance;
+
+    pthread_mutex_lock(&pool->mutex);
+    double hitRate = (pool->lookups == 0) ? 0.0 : (double) pool->hits / (double) pool->lookups;
+    parcDisplayIndented_PrintLine(indentation, "PARCInternPool@%p {", instance);
+    parcDisplayIndented_PrintLine(indentation + 1, ".size=%zu, .buckets=%zu", pool->size, pool->bucketMask + 1);
+    parcDisplayIndented_PrintLine(indentation + 1, ".lookups=%" PRIu64 ", .hits=%" PRIu64 " (%.1f%%), .bytesSaved=%" PRIu64,
+                                  pool->lookups, pool->hits, hitRate * 100.0, pool->bytesSaved);
+    parcDisplayIndented_PrintLine(indentation, "}");
+    pthread_mutex_unlock(&pool->mutex);
+}
+
+/*
+ * Double the number of buckets, keeping the load factor at most one. The caller holds the mutex.
+ */
+static void
+_parcInternPool_Grow(PARCInternPool *pool)
+{
+    size_t bucketCount = (pool->bucketMask + 1) * 2;
+    _PARCInternPoolEntry **buckets = parcMemory_AllocateAndClear(bucketCount * sizeof(_PARCInternPoolEntry *));
+    assertNotNull(buckets, "parcMemory_AllocateAndClear(%zu) returned NULL", bucketCount * sizeof(_PARCInternPoolEntry *));
+
+    for (size_t i = 0; i <= pool->bucketMask; i++) {
+        _PARCInternPoolEntry *entry = pool->buckets[i];
+        while (entry != NULL) {
+            _PARCInternPoolEntry *next = entry->chain;
+            size_t index = (size_t) entry->hashCode & (bucketCount - 1);
+            entry->chain = buckets[index];
+            buckets[index] = entry;
+            entry = next;
+        }
+    }
+
+    parcMemory_Deallocate((void **) &pool->buckets);
+    pool->buckets = buckets;
+    pool->bucketMask = bucketCount - 1;
+}
+
+/*
+ * Find the canonical instance with the given content, or add one made by the given function.
+ * The result is an acquired reference.
+ */
+static PARCObject *
+_parcInternPool_Intern(PARCInternPool *pool, _PARCInternPoolKind kind, const void *bytes, size_t length,
+                       PARCObject *(*create)(const void *context), const void *context)
+{
+    parcInternPool_OptionalAssertValid(pool);
+
+    PARCHashCode hashCode = parcHashCode_Hash((const uint8_t *) bytes, length);
+    PARCObject *result = NULL;
+
+    pthread_mutex_lock(&pool->mutex);
+    pool->lookups++;
+
+    for (_PARCInternPoolEntry *entry = pool->buckets[(size_t) hashCode & pool->bucketMask]; entry != NULL; entry = entry->chain) {
+        if (entry->hashCode == hashCode && entry->kind == kind && entry->length == length
+            && memcmp(entry->bytes, bytes, length) == 0) {
+            result = parcObject_Acquire(entry->instance);
+            pool->hits++;
+            pool->bytesSaved += length;
+            break;
+        }
+    }
+
+    if (result == NULL) {
+        _PARCInternPoolEntry *entry = parcMemory_Allocate(sizeof(_PARCInternPoolEntry));
+        assertNotNull(entry, "parcMemory_Allocate(%zu) returned NULL", sizeof(_PARCInternPoolEntry));
+
+        entry->instance = create(context);
+        entry->kind = kind;
+        if (kind == _PARCInternPoolKind_String) {
+            entry->bytes = parcString_GetString(entry->instance);
+        } else {
+            entry->bytes = parcBuffer_Overlay(entry->instance, 0);
+        }
+        entry->length = length;
+        entry->hashCode = hashCode;
+
+        if (pool->size >= pool->bucketMask + 1) {
+            _parcInternPool_Grow(pool);
+        }
+        size_t index = (size_t) hashCode & pool->bucketMask;
+        entry->chain = pool->buckets[index];
+        pool->buckets[index] = entry;
+        pool->size++;
+
+        result = parcObject_Acquire(entry->instance);
+    }
+
+    pthread_mutex_unlock(&pool->mutex);
+
+    return result;
+}
+
+static PARCObject *
+_parcInternPool_CreateString(const void *context)
+{
+    return parcString_Create(context);
+}
+
+static PARCObject *
+_parcInternPool_AcquireString(const void *context)
+{
+    return parcString_Acquire(context);
+}
+
+static PARCObject *
+_parcInternPool_CopyBuffer(const void *context)
+{
+    PARCBuffer *buffer = (PARCBuffer *) context;
+    size_t length = parcBuffer_Remaining(buffer);
+
+    // Follow the content with a nul byte beyond the limit, as parcBuffer_AllocateCString does,
+    // so that interned names can still be used as C strings.
+    PARCBuffer *result = parcBuffer_Allocate(length + 1);
+    parcBuffer_PutArray(result, length, parcBuffer_Overlay(buffer, 0));
+    parcBuffer_PutUint8(result, 0);
+    parcBuffer_SetPosition(result, length);
+
+    // The canonical buffer is shared by every holder, so its content must never change.
+    // Freezing it makes any attempt trap, and caches its hash code.
+    return parcBuffer_Freeze(parcBuffer_Flip(result));
+}
+
+PARCString *
+parcInternPool_InternCString(PARCInternPool *pool, const char *string)
+{
+    assertNotNull(string, "The string must be a non-null pointer to a nul-terminated C string.");
+
+    return _parcInternPool_Intern(pool, _PARCInternPoolKind_String, string, strlen(string), _parcInternPool_CreateString, string);
+}
+
+PARCString *
+parcInternPool_InternString(PARCInternPool *pool, const PARCString *string)
+{
+    parcString_OptionalAssertValid(string);
+
+    const char *chars = parcString_GetString(string);
+    return _parcInternPool_Intern(pool, _PARCInternPoolKind_String, chars, strlen(chars), _parcInternPool_AcquireString, string);
+}
+
+PARCBuffer *
+parcInternPool_InternBuffer(PARCInternPool *pool, const PARCBuffer *buffer)
+{
+    parcBuffer_OptionalAssertValid(buffer);
+
+    PARCBuffer *source = (PARCBuffer *) buffer;
+    return _parcInternPool_Intern(pool, _PARCInternPoolKind_Buffer, parcBuffer_Overlay(source, 0), parcBuffer_Remaining(source),
+                                  _parcInternPool_CopyBuffer, buffer);
+}
+
+size_t
+parcInternPool_Purge(PARCInternPool *pool)
+{
+    parcInternPool_OptionalAssertValid(pool);
+
+    size_t result = 0;
+
+    pthread_mutex_lock(&pool->mutex);
+    for (size_t i = 0; i <= pool->bucketMask; i++) {
+        _PARCInternPoolEntry **link = &pool->buckets[i];
+        while (*link != NULL) {
+            _PARCInternPoolEntry *entry = *link;
+            if (parcObject_GetReferenceCount(entry->instance) == 1) {
+                *link = entry->chain;
+                _parcInternPool_ReleaseInstance(entry);
+                parcMemory_Deallocate((void **) &entry);
+                pool->size--;
+                result++;
+            } else {
+                link = &entry->chain;
+            }
+        }
+    }
+    pthread_mutex_unlock(&pool->mutex);
+
+    return result;
+}
+
+size_t
+parcInternPool_Size(const PARCInternPool *pool)
+{
+    parcInternPool_OptionalAssertValid(pool);
+
+    pthread_mutex_lock((pthread_mutex_t *) &pool->mutex);
+    size_t result = pool->size;
+    pthread_mutex_unlock((pthread_mutex_t *) &pool->mutex);
+
+    return result;
+}
+
+uint64_t
+parcInternPool_GetLookups(const PARCInternPool *pool)
+{
+    parcInternPool_OptionalAssertValid(pool);
+
+    pthread_mutex_lock((pthread_mutex_t *) &pool->mutex);
+    uint64_t result = pool->lookups;
+    pthread_mutex_unlock((pthread_mutex_t *) &pool->mutex);
+
+    return result;
+}
+
+uint64_t
+parcInternPool_GetHits(const PARCInternPool *pool)
+{
+    parcInternPool_OptionalAssertValid(pool);
+
+    pthread_mutex_lock((pthread_mutex_t *) &pool->mutex);
+    uint64_t result = pool->hits;
+    pthread_mutex_unlock((pthread_mutex_t *) &pool->mutex);
+
+    return result;
+}
+
+uint64_t
+parcInternPool_GetBytesSaved(const PARCInternPool *pool)
+{
+    parcInternPool_OptionalAssertValid(pool);
+
+    pthread_mutex_lock((pthread_mutex_t *) &pool->mutex);
+    uint64_t result = pool->bytesSaved;
+    pthread_mutex_unlock((pthread_mutex_t *) &pool->mutex);
+
+    return result;
+}
@@ -0,0 +1,336 @@
+/*
+ * Copyright (c) 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Patent rights are not granted under this agreement. Patent rights are
+ *       available under FRAND terms.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX or PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * @file parc_InternPool.h
+ * @ingroup datastructures
+ * @brief A thread-safe pool of canonical, immutable strings and buffers.
+ *
+ * The same names (URI segments, JSON member names, property keys, host and application names)
+ * are often created again and again as separate `PARCString` or `PARCBuffer` instances.
+ * A `PARCInternPool` maps each distinct sequence of bytes to a single canonical instance,
+ * so that repeated names share one allocation and two interned instances with the same content
+ * are the same pointer. Comparing interned instances is then a pointer comparison.
+ *
+ * The pool holds a reference to each canonical instance and returns an additional reference to the caller.
+ * Canonical instances must not be modified.
+ * Canonical buffers are frozen (see `parcBuffer_Freeze`), so modifying their content traps
+ * and their hash codes are computed once.
+ * Instances that are no longer referenced outside the pool are dropped by `parcInternPool_Purge`
+ * and when the pool itself is released.
+ *
+ * The pool keeps statistics of the number of lookups, the number that found an existing instance,
+ * and the number of content bytes that did not have to be allocated again as a result.
+ *
+ * All functions may be called concurrently from multiple threads.
+ *
+ * @copyright 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC).  All rights reserved.
+ */
+#ifndef libparc_parc_InternPool_h
+#define libparc_parc_InternPool_h
+
+#include <stdbool.h>
+#include <stdint.h>
+
+struct PARCInternPool;
+typedef struct PARCInternPool PARCInternPool;
+
+#include <parc/algol/parc_Buffer.h>
+#include <parc/algol/parc_String.h>
+
+#ifdef PARCLibrary_DISABLE_VALIDATION
+#  define parcInternPool_OptionalAssertValid(_instance_)
+#else
+#  define parcInternPool_OptionalAssertValid(_instance_) parcInternPool_AssertValid(_instance_)
+#endif
+
+/**
+ * Create an empty `PARCInternPool`.
+ *
+ * @return non-NULL A pointer to a valid PARCInternPool instance.
+ * @return NULL An error occurred.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCInternPool *pool = parcInternPool_Create();
+ *
+ *     parcInternPool_Release(&pool);
+ * }
+ * @endcode
+ */
+PARCInternPool *parcInternPool_Create(void);
+
+/**
+ * Increase the number of references to a `PARCInternPool` instance.
+ *
+ * @param [in] instance A pointer to a valid PARCInternPool instance.
+ *
+ * @return The same value as @p instance.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCInternPool *a = parcInternPool_Create();
+ *
+ *     PARCInternPool *b = parcInternPool_Acquire(a);
+ *
+ *     parcInternPool_Release(&a);
+ *     parcInternPool_Release(&b);
+ * }
+ * @endcode
+ */
+PARCInternPool *parcInternPool_Acquire(const PARCInternPool *instance);
+
+/**
+ * Release a previously acquired reference to the given `PARCInternPool` instance,
+ * decrementing the reference count for the instance.
+ *
+ * When the last reference is released, the pool releases its references to the canonical instances.
+ * Instances still referenced elsewhere remain valid.
+ *
+ * The pointer to the instance is set to NULL as a side-effect of this function.
+ *
+ * @param [in,out] instancePtr A pointer to a pointer to the instance to release.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCInternPool *a = parcInternPool_Create();
+ *
+ *     parcInternPool_Release(&a);
+ * }
+ * @endcode
+ */
+void parcInternPool_Release(PARCInternPool **instancePtr);
+
+/**
+ * Determine if an instance of `PARCInternPool` is valid.
+ *
+ * @param [in] instance A pointer to a PARCInternPool instance.
+ *
+ * @return true The instance is valid.
+ * @return false The instance is not valid.
+ *
+ * Example:
+ * @code
+ * {
+ *     if (parcInternPool_IsValid(pool)) {
+ *         ...
+ *     }
+ * }
+ * @endcode
+ */
+bool parcInternPool_IsValid(const PARCInternPool *instance);
+
+/**
+ * Assert that the given `PARCInternPool` instance is valid.
+ *
+ * @param [in] instance A pointer to a valid PARCInternPool instance.
+ *
+ * Example:
+ * @code
+ * {
+ *     parcInternPool_AssertValid(pool);
+ * }
+ * @endcode
+ */
+void parcInternPool_AssertValid(const PARCInternPool *instance);
+
+/**
+ * Print a human readable representation of the given `PARCInternPool`, including its statistics.
+ *
+ * @param [in] instance A pointer to a valid PARCInternPool instance.
+ * @param [in] indentation The indentation level to use for printing.
+ *
+ * Example:
+ * @code
+ * {
+ *     parcInternPool_Display(pool, 0);
+ * }
+ * @endcode
+ */
+void parcInternPool_Display(const PARCInternPool *instance, int indentation);
+
+/**
+ * Get the canonical `PARCString` with the same content as the given nul-terminated C string.
+ *
+ * @param [in] pool A pointer to a valid PARCInternPool instance.
+ * @param [in] string A pointer to a nul-terminated C string.
+ *
+ * @return non-NULL A pointer to the canonical PARCString, which the caller must release.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCString *a = parcInternPool_InternCString(pool, "lci:/parc");
+ *     PARCString *b = parcInternPool_InternCString(pool, "lci:/parc");
+ *
+ *     // a == b
+ *
+ *     parcString_Release(&a);
+ *     parcString_Release(&b);
+ * }
+ * @endcode
+ */
+PARCString *parcInternPool_InternCString(PARCInternPool *pool, const char *string);
+
+/**
+ * Get the canonical `PARCString` with the same content as the given `PARCString`.
+ *
+ * If the pool has no string with this content, @p string itself becomes the canonical instance.
+ *
+ * @param [in] pool A pointer to a valid PARCInternPool instance.
+ * @param [in] string A pointer to a valid PARCString instance.
+ *
+ * @return non-NULL A pointer to the canonical PARCString, which the caller must release.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCString *name = parcString_Create("host");
+ *     PARCString *canonical = parcInternPool_InternString(pool, name);
+ *     parcString_Release(&name);
+ *     ...
+ *     parcString_Release(&canonical);
+ * }
+ * @endcode
+ */
+PARCString *parcInternPool_InternString(PARCInternPool *pool, const PARCString *string);
+
+/**
+ * Get the canonical `PARCBuffer` with the same content as the remaining bytes of the given `PARCBuffer`.
+ *
+ * If the pool has no buffer with this content, a new buffer holding a copy of the remaining bytes
+ * becomes the canonical instance, so later changes to @p buffer do not affect it.
+ * The canonical buffer's position is 0 and its limit is its length.
+ * It is frozen (see `parcBuffer_Freeze`): modifying its content traps, and its hash code is cached.
+ * Its position and limit are shared by every holder and must not be changed.
+ * Its content is followed by a nul byte beyond the limit, so a name without embedded nul bytes
+ * may be used as a C string via `parcBuffer_Overlay`.
+ * The position of @p buffer is not changed.
+ *
+ * @param [in] pool A pointer to a valid PARCInternPool instance.
+ * @param [in] buffer A pointer to a valid PARCBuffer instance.
+ *
+ * @return non-NULL A pointer to the canonical PARCBuffer, which the caller must release.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCBuffer *name = parcBuffer_WrapCString("segment");
+ *     PARCBuffer *canonical = parcInternPool_InternBuffer(pool, name);
+ *     parcBuffer_Release(&name);
+ *     ...
+ *     parcBuffer_Release(&canonical);
+ * }
+ * @endcode
+ */
+PARCBuffer *parcInternPool_InternBuffer(PARCInternPool *pool, const PARCBuffer *buffer);
+
+/**
+ * Drop every canonical instance that is referenced only by the pool.
+ *
+ * @param [in,out] pool A pointer to a valid PARCInternPool instance.
+ *
+ * @return The number of instances dropped.
+ *
+ * Example:
+ * @code
+ * {
+ *     size_t dropped = parcInternPool_Purge(pool);
+ * }
+ * @endcode
+ */
+size_t parcInternPool_Purge(PARCInternPool *pool);
+
+/**
+ * Get the number of canonical instances held by the pool.
+ *
+ * @param [in] pool A pointer to a valid PARCInternPool instance.
+ *
+ * @return The number of canonical instances.
+ *
+ * Example:
+ * @code
+ * {
+ *     size_t size = parcInternPool_Size(pool);
+ * }
+ * @endcode
+ */
+size_t parcInternPool_Size(const PARCInternPool *pool);
+
+/**
+ * Get the number of intern requests made of the pool.
+ *
+ * @param [in] pool A pointer to a valid PARCInternPool instance.
+ *
+ * @return The number of intern requests.
+ *
+ * Example:
+ * @code
+ * {
+ *     uint64_t lookups = parcInternPool_GetLookups(pool);
+ * }
+ * @endcode
+ */
+uint64_t parcInternPool_GetLookups(const PARCInternPool *pool);
+
+/**
+ * Get the number of intern requests that returned an existing canonical instance.
+ *
+ * @param [in] pool A pointer to a valid PARCInternPool instance.
+ *
+ * @return The number of intern requests that found an existing instance.
+ *
+ * Example:
+ * @code
+ * {
+ *     double hitRate = (double) parcInternPool_GetHits(pool) / parcInternPool_GetLookups(pool);
+ * }
+ * @endcode
+ */
+uint64_t parcInternPool_GetHits(const PARCInternPool *pool);
+
+/**
+ * Get the number of content bytes that requests returning an existing instance did not need to store again.
+ *
+ * This counts the content of the strings and buffers only, not the per-instance overhead,
+ * so the actual saving is somewhat larger.
+ *
+ * @param [in] pool A pointer to a valid PARCInternPool instance.
+ *
+ * @return The number of content bytes saved.
+ *
+ * Example:
+ * @code
+ * {
+ *     printf("saved %" PRIu64 " bytes\n", parcInternPool_GetBytesSaved(pool));
+ * }
+ * @endcode
+ */
+uint64_t parcInternPool_GetBytesSaved(const PARCInternPool *pool);
+#endif // libparc_parc_InternPool_h
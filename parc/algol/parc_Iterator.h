@@ -59,6 +59,37 @@
 struct parc_iterator;
 typedef struct parc_iterator PARCIterator;
 
+/**
+ * @typedef PARCCursor
+ * @brief A caller-allocated position in a traversal of a collection.
+ *
+ * Unlike a `PARCIterator`, a `PARCCursor` is not a `PARCObject`.
+ * It is intended to be placed on the stack and initialised by a collection specific function,
+ * for example {@link parcLinkedList_Cursor}, and then advanced by that collection's
+ * `CursorHasNext` and `CursorNext` functions.
+ * A traversal with a `PARCCursor` performs no allocations and makes no indirect function calls.
+ *
+ * The cursor does not hold a reference to the collection.
+ * The collection must not be released or modified while a traversal is in progress.
+ *
+ * The fields are private to the collection implementation and must not be used by the caller.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCCursor cursor = parcLinkedList_Cursor(list);
+ *     while (parcLinkedList_CursorHasNext(&cursor)) {
+ *         PARCObject *object = parcLinkedList_CursorNext(&cursor);
+ *     }
+ * }
+ * @endcode
+ */
+typedef struct parc_cursor {
+    const void *collection;
+    void *position;
+    size_t index;
+} PARCCursor;
+
 /**
  * Create a new instance of `PARCIterator`
  *
@@ -44,6 +44,7 @@
 #include <parc/algol/parc_DisplayIndented.h>
 #include <parc/algol/parc_Object.h>
 #include <parc/algol/parc_Buffer.h>
+#include <parc/algol/parc_BufferView.h>
 #include <parc/algol/parc_Memory.h>
 #include <parc/algol/parc_List.h>
 #include <parc/algol/parc_ArrayList.h>
@@ -202,15 +203,14 @@ parcJSON_GetPairByName(const PARCJSON *json, const char *name)
 {
     PARCJSONPair *result = NULL;
 
-    PARCBuffer *nameBuffer = parcBuffer_Wrap((uint8_t *) name, strlen(name), 0, strlen(name));
+    PARCBufferView nameView = parcBufferView_WrapCString(name);
     for (size_t index = 0; index < parcList_Size(json->members); index++) {
         PARCJSONPair *pair = parcList_GetAtIndex(json->members, index);
-        if (parcBuffer_Equals(nameBuffer, parcJSONPair_GetName(pair))) {
+        if (parcBufferView_EqualsBuffer(&nameView, parcJSONPair_GetName(pair))) {
             result = pair;
             break;
         }
     }
-    parcBuffer_Release(&nameBuffer);
     return result;
 }
 
@@ -327,6 +327,12 @@ parcJSON_ParseString(const char *string)
 
 PARCJSON *
 parcJSON_ParseBuffer(PARCBuffer *buffer)
+{
+    return parcJSON_ParseBufferWithInternPool(buffer, NULL);
+}
+
+PARCJSON *
+parcJSON_ParseBufferWithInternPool(PARCBuffer *buffer, PARCInternPool *pool)
 {
     PARCJSON *result = NULL;
 
@@ -335,6 +341,7 @@ parcJSON_ParseBuffer(PARCBuffer *buffer)
     // This function is not going to modify the input string, so the 'const' promise will be kept.
 
     PARCJSONParser *parser = parcJSONParser_Create(buffer);
+    parcJSONParser_SetInternPool(parser, pool);
 
     char firstCharacter = parcJSONParser_PeekNextChar(parser);
     if (firstCharacter == '{') {
@@ -57,6 +57,7 @@ typedef struct parc_json PARCJSON;
 
 #include <parc/algol/parc_JSONPair.h>
 #include <parc/algol/parc_JSONValue.h>
+#include <parc/algol/parc_InternPool.h>
 
 /**
  * Create a new JSON object.
@@ -329,6 +330,31 @@ PARCJSON *parcJSON_ParseString(const char *string);
  */
 PARCJSON *parcJSON_ParseBuffer(PARCBuffer *buffer);
 
+/**
+ * Parse a `PARCBuffer` into a `PARCJSON` instance, interning the names of its members in a `PARCInternPool`.
+ *
+ * Many documents with the same member names, parsed with the same pool, share one copy of each name.
+ *
+ * @param [in] buffer A pointer to a valid PARCBuffer instance.
+ * @param [in] pool A pointer to a valid PARCInternPool instance.
+ *
+ * @return A pointer to a `PARCJSON` instance with one reference, or NULL if an error occurred.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCInternPool *pool = parcInternPool_Create();
+ *     PARCBuffer *buffer = parcBuffer_WrapCString("{ \"key\" : 1 }");
+ *     PARCJSON *json = parcJSON_ParseBufferWithInternPool(buffer, pool);
+ *
+ *     parcBuffer_Release(&buffer);
+ *     parcJSON_Release(&json);
+ *     parcInternPool_Release(&pool);
+ * }
+ * @endcode
+ */
+PARCJSON *parcJSON_ParseBufferWithInternPool(PARCBuffer *buffer, PARCInternPool *pool);
+
 /**
  * Produce a null-terminated string representation of the specified instance.
  *
@@ -51,6 +51,7 @@
 #include <parc/algol/parc_List.h>
 #include <parc/algol/parc_ArrayList.h>
 #include <parc/algol/parc_BufferComposer.h>
+#include <parc/algol/internal_parc_JSONString.h>
 
 struct parcJSONPair {
     PARCBuffer *name;
@@ -233,8 +234,10 @@ parcJSONPair_BuildString(const PARCJSONPair *pair, PARCBufferComposer *composer,
 {
     parcBufferComposer_PutUint8(composer, '"');
 
-    parcBufferComposer_PutBuffer(composer, pair->name);
-    parcBuffer_Rewind(pair->name);
+    size_t length = parcBuffer_Remaining(pair->name);
+    if (length > 0) {
+        internal_parcJSONString_Escape(composer, length, parcBuffer_Overlay(pair->name, 0), !compact);
+    }
     if (compact) {
         parcBufferComposer_PutString(composer, "\":");
     } else {
@@ -266,6 +269,12 @@ parcJSONPair_Parser(PARCJSONParser *parser)
 
     // This makes an unnecessary copy.  I think this could just be a buffer slice.
     PARCBuffer *name = parcJSONParser_ParseString(parser);
+    PARCInternPool *pool = parcJSONParser_GetInternPool(parser);
+    if (name != NULL && pool != NULL) {
+        PARCBuffer *interned = parcInternPool_InternBuffer(pool, name);
+        parcBuffer_Release(&name);
+        name = interned;
+    }
     char c = parcJSONParser_NextChar(parser);
     if (c == ':') {
         PARCJSONValue *value = parcJSONValue_Parser(parser);
@@ -39,10 +39,13 @@
 
 #include <parc/algol/parc_BufferComposer.h>
 #include <parc/algol/parc_Object.h>
+#include <parc/algol/parc_UTF8.h>
+#include <parc/algol/internal_parc_JSONString.h>
 
 struct parc_buffer_parser {
     char *ignore;
     PARCBuffer *buffer;
+    PARCInternPool *internPool;
 };
 
 static PARCBuffer *
@@ -56,6 +59,9 @@ _destroyPARCBufferParser(PARCJSONParser **instancePtr)
 {
     PARCJSONParser *parser = *instancePtr;
     parcBuffer_Release(&parser->buffer);
+    if (parser->internPool != NULL) {
+        parcInternPool_Release(&parser->internPool);
+    }
 }
 
 parcObject_ExtendPARCObject(PARCJSONParser, _destroyPARCBufferParser, NULL, NULL, NULL, NULL, NULL, NULL);
@@ -66,9 +72,29 @@ parcJSONParser_Create(PARCBuffer *buffer)
     PARCJSONParser *result = parcObject_CreateInstance(PARCJSONParser);
     result->ignore = " \t\n";
     result->buffer = parcBuffer_Acquire(buffer);
+    result->internPool = NULL;
     return result;
 }
 
+void
+parcJSONParser_SetInternPool(PARCJSONParser *parser, PARCInternPool *pool)
+{
+    parcJSONParser_OptionalAssertValid(parser);
+
+    if (parser->internPool != NULL) {
+        parcInternPool_Release(&parser->internPool);
+    }
+    parser->internPool = (pool == NULL) ? NULL : parcInternPool_Acquire(pool);
+}
+
+PARCInternPool *
+parcJSONParser_GetInternPool(const PARCJSONParser *parser)
+{
+    parcJSONParser_OptionalAssertValid(parser);
+
+    return parser->internPool;
+}
+
 void
 parcJSONParser_AssertValid(const PARCJSONParser *parser)
 {
@@ -144,51 +170,90 @@ parcJSONParser_RequireString(PARCJSONParser *parser, const char *string)
     return true;
 }
 
+static uint8_t
+_parcJSONParser_Unescape(uint8_t c)
+{
+    if (c == '"') {
+        // this special character passes directly into the composed string.
+    } else if (c == '\\') {
+        // this special character passes directly into the composed string.
+    } else if (c == '/') {
+        // this special character passes directly into the composed string.
+    } else if (c == 'b') {
+        c = '\b';
+    } else if (c == 'f') {
+        c = '\f';
+    } else if (c == 'n') {
+        c = '\n';
+    } else if (c == 'r') {
+        c = '\r';
+    } else if (c == 't') {
+        c = '\t';
+    } else if (c == 'u') {
+        // Not supporting unicode at this point.
+        trapNotImplemented("Unicode is not supported.");
+    }
+    return c;
+}
+
 PARCBuffer *
 parcJSONParser_ParseString(PARCJSONParser *parser)
 {
     PARCBuffer *result = NULL;
 
     PARCBuffer *buffer = _getBuffer(parser);
-    if (parcBuffer_GetUint8(buffer) == '"') { // skip the initial '"' character starting the string.
-        PARCBufferComposer *composer = parcBufferComposer_Create();
+    if (parcBuffer_GetUint8(buffer) == '"' && parcBuffer_HasRemaining(buffer)) { // skip the initial '"' character starting the string.
+        size_t length = parcBuffer_Remaining(buffer);
+        const uint8_t *bytes = parcBuffer_Overlay(buffer, 0);
+
+        // Copy whole runs of plain bytes between the special characters.
+        // A string without escapes, the common case, is copied directly without a composer.
+        PARCBufferComposer *composer = NULL;
+        size_t index = 0;
+        while (index < length) {
+            size_t special = index + internal_parcJSONString_Scan(length - index, &bytes[index], false);
+            if (special == length) {
+                // !! Syntax Error: the string is not terminated.
+                index = length;
+                break;
+            }
 
-        while (parcBuffer_Remaining(buffer)) {
-            uint8_t c = parcBuffer_GetUint8(buffer);
+            uint8_t c = bytes[special];
             if (c == '"') {
                 // This is the only successful way to exit this while loop.
-                result = parcBufferComposer_ProduceBuffer(composer);
+                if (composer == NULL) {
+                    result = parcBuffer_Flip(parcBuffer_CreateFromArray(&bytes[index], special - index));
+                } else {
+                    parcBufferComposer_PutArray(composer, &bytes[index], special - index);
+                    result = parcBufferComposer_ProduceBuffer(composer);
+                }
+                index = special + 1;
                 break;
-            } else if (c == '\\') {
-                c = parcBuffer_GetUint8(buffer);
-                if (c == '"') {
-                    // this special character passes directly into the composed string.
-                } else if (c == '\\') {
-                    // this special character passes directly into the composed string.
-                } else if (c == '/') {
-                    // this special character passes directly into the composed string.
-                } else if (c == 'b') {
-                    c = '\b';
-                } else if (c == 'f') {
-                    c = '\f';
-                } else if (c == 'n') {
-                    c = '\n';
-                } else if (c == 'r') {
-                    c = '\r';
-                } else if (c == 't') {
-                    c = '\t';
-                } else if (c == 'u') {
-                    // Not supporting unicode at this point.
-                    trapNotImplemented("Unicode is not supported.");
+            } else if (c == '\\' && special + 1 < length) {
+                if (composer == NULL) {
+                    composer = parcBufferComposer_Create();
                 }
-            } else if (iscntrl(c)) {
-                // !! Syntax Error.
+                parcBufferComposer_PutArray(composer, &bytes[index], special - index);
+                parcBufferComposer_PutChar(composer, _parcJSONParser_Unescape(bytes[special + 1]));
+                index = special + 2;
+            } else {
+                // !! Syntax Error: a control character, or a '\\' ending the input.
+                index = special + 1;
                 break;
             }
-            parcBufferComposer_PutChar(composer, c);
+        }
+        parcBuffer_SetPosition(buffer, parcBuffer_Position(buffer) + index);
+
+        if (composer != NULL) {
+            parcBufferComposer_Release(&composer);
         }
 
-        parcBufferComposer_Release(&composer);
+        if (result != NULL && parcBuffer_HasRemaining(result)) {
+            if (!parcUTF8_IsValid(parcBuffer_Remaining(result), parcBuffer_Overlay(result, 0))) {
+                // !! Syntax Error: the string is not valid UTF-8.
+                parcBuffer_Release(&result);
+            }
+        }
     }
     return result;
 }
@@ -52,6 +52,8 @@
 struct parc_buffer_parser;
 typedef struct parc_buffer_parser PARCJSONParser;
 
+#include <parc/algol/parc_InternPool.h>
+
 /**
  * Create a new `PARCJSONParser`.
  *
@@ -73,6 +75,44 @@ typedef struct parc_buffer_parser PARCJSONParser;
  */
 PARCJSONParser *parcJSONParser_Create(PARCBuffer *buffer);
 
+/**
+ * Intern the names of the JSON pairs parsed by the given `PARCJSONParser` in a `PARCInternPool`.
+ *
+ * Documents parsed with the same pool share a single copy of each member name,
+ * and equal names compare as equal pointers.
+ *
+ * @param [in,out] parser A pointer to a valid `PARCJSONParser`.
+ * @param [in] pool A pointer to a valid `PARCInternPool`, or NULL to stop interning.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCJSONParser *parser = parcJSONParser_Create(buffer);
+ *     parcJSONParser_SetInternPool(parser, pool);
+ *     ...
+ *     parcJSONParser_Release(&parser);
+ * }
+ * @endcode
+ */
+void parcJSONParser_SetInternPool(PARCJSONParser *parser, PARCInternPool *pool);
+
+/**
+ * Get the `PARCInternPool` in which the given `PARCJSONParser` interns pair names.
+ *
+ * @param [in] parser A pointer to a valid `PARCJSONParser`.
+ *
+ * @return non-NULL A pointer to the PARCInternPool.
+ * @return NULL The parser does not intern pair names.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCInternPool *pool = parcJSONParser_GetInternPool(parser);
+ * }
+ * @endcode
+ */
+PARCInternPool *parcJSONParser_GetInternPool(const PARCJSONParser *parser);
+
 /**
  * Assert that an instance of `PARCJSONParser` is valid.
  *
@@ -43,6 +43,7 @@
 
 #include <parc/algol/parc_DisplayIndented.h>
 #include <parc/algol/parc_Object.h>
+#include <parc/algol/internal_parc_JSONString.h>
 
 typedef enum {
     PARCJSONValueType_Boolean,
@@ -878,30 +879,12 @@ _buildStringString(const PARCJSONValue *value, PARCBufferComposer *composer, boo
 {
     parcBufferComposer_PutChar(composer, '"');
 
-    while (parcBuffer_Remaining(value->value.string)) {
-        uint8_t c = parcBuffer_GetUint8(value->value.string);
-        if (c == '"') {
-            parcBufferComposer_PutString(composer, "\\\"");
-        } else if (c == '\b') {
-            parcBufferComposer_PutString(composer, "\\b");
-        } else if (c == '\f') {
-            parcBufferComposer_PutString(composer, "\\f");
-        } else if (c == '\n') {
-            parcBufferComposer_PutString(composer, "\\n");
-        } else if (c == '\r') {
-            parcBufferComposer_PutString(composer, "\\r");
-        } else if (c == '\t') {
-            parcBufferComposer_PutString(composer, "\\t");
-        } else if ((c == '/') && !compact) {
-            parcBufferComposer_PutString(composer, "\\/");
-        } else if (c == '\\') {
-            parcBufferComposer_PutString(composer, "\\\\");
-        } else {
-            parcBufferComposer_PutChar(composer, c);
-        }
+    PARCBuffer *string = value->value.string;
+    size_t length = parcBuffer_Remaining(string);
+    if (length > 0) {
+        internal_parcJSONString_Escape(composer, length, parcBuffer_Overlay(string, 0), !compact);
     }
 
-    parcBuffer_Rewind(value->value.string);
     parcBufferComposer_PutChar(composer, '"');
 
     return composer;
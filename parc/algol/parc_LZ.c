@@ -0,0 +1,413 @@
+/*
+ * Copyright (c) 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Patent rights are not granted under this agreement. Patent rights are
+ *       available under FRAND terms.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX or PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * @copyright 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC).  All rights reserved.
+ */
+#include <config.h>
+
+#include <string.h>
+
+#include <LongBow/runtime.h>
+
+#include <parc/algol/parc_Object.h>
+#include <parc/algol/parc_Memory.h>
+#include <parc/algol/parc_LZ.h>
+
+#define _MinimumMatch 4
+#define _MaximumOffset 65535
+
+// Matches are only searched for while at least this many bytes remain, so the 4 byte hash load stays in bounds.
+#define _SearchLimit 8
+
+#define _HashLog 16
+#define _HashSize (1 << _HashLog)
+#define _ChainSize (_MaximumOffset + 1)
+
+/*
+ * `head` maps the hash of the 4 bytes at a position to the last position with that hash,
+ * and `chain` maps a position (modulo 64 KiB) to the distance back to the previous position with the same hash.
+ *
+ * Positions are stored offset by `base`, which is advanced past every block compressed.
+ * An entry less than `base` belongs to an earlier block and is ignored, so the tables never need clearing
+ * until `base` would overflow.
+ */
+struct PARCLZCompressor {
+    int level;
+    size_t searchDepth;
+    uint32_t base;
+    uint32_t *head;
+    uint16_t *chain;
+};
+
+static inline uint32_t
+_parcLZ_Load32(const uint8_t *p)
+{
+    uint32_t result;
+    memcpy(&result, p, sizeof(result));
+    return result;
+}
+
+static inline uint32_t
+_parcLZ_Hash(const uint8_t *p)
+{
+    return (_parcLZ_Load32(p) * 2654435761U) >> (32 - _HashLog);
+}
+
+/*
+ * Count the bytes, up to `limit`, that are equal at `a` and `b`.
+ */
+static inline size_t
+_parcLZ_MatchLength(const uint8_t *a, const uint8_t *b, size_t limit)
+{
+    size_t result = 0;
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    while (result + sizeof(uint64_t) <= limit) {
+        uint64_t x, y;
+        memcpy(&x, a + result, sizeof(x));
+        memcpy(&y, b + result, sizeof(y));
+        if (x != y) {
+            return result + (__builtin_ctzll(x ^ y) >> 3);
+        }
+        result += sizeof(uint64_t);
+    }
+#endif
+    while (result < limit && a[result] == b[result]) {
+        result++;
+    }
+    return result;
+}
+
+static inline uint8_t *
+_parcLZ_PutLength(uint8_t *op, size_t length)
+{
+    while (length >= 255) {
+        *op++ = 255;
+        length -= 255;
+    }
+    *op++ = (uint8_t) length;
+    return op;
+}
+
+/*
+ * Write a sequence of `literalLength` literals starting at `literals`,
+ * followed by a match of `matchLength` bytes at `offset` if `matchLength` is not 0.
+ * Return NULL if the sequence does not fit before `oend`.
+ */
+static uint8_t *
+_parcLZ_PutSequence(uint8_t *op, const uint8_t *oend, const uint8_t *literals, size_t literalLength,
+                    size_t offset, size_t matchLength)
+{
+    size_t worstCase = 1 + (literalLength / 255 + 1) + literalLength + 2 + (matchLength / 255 + 1);
+    if (worstCase > (size_t) (oend - op)) {
+        return NULL;
+    }
+
+    uint8_t *token = op++;
+    if (literalLength >= 15) {
+        *token = 15 << 4;
+        op = _parcLZ_PutLength(op, literalLength - 15);
+    } else {
+        *token = (uint8_t) (literalLength << 4);
+    }
+    memcpy(op, literals, literalLength);
+    op += literalLength;
+
+    if (matchLength > 0) {
+        *op++ = (uint8_t) offset;
+        *op++ = (uint8_t) (offset >> 8);
+
+        size_t code = matchLength - _MinimumMatch;
+        if (code >= 15) {
+            *token |= 15;
+            op = _parcLZ_PutLength(op, code - 15);
+        } else {
+            *token |= (uint8_t) code;
+        }
+    }
+    return op;
+}
+
+static void
+_parcLZCompressor_Finalize(PARCLZCompressor **instancePtr)
+{
+    assertNotNull(instancePtr, "Parameter must be a non-null pointer to a PARCLZCompressor pointer.");
+    PARCLZCompressor *compressor = *instancePtr;
+
+    parcMemory_Deallocate(&compressor->head);
+    parcMemory_Deallocate(&compressor->chain);
+}
+
+parcObject_ImplementAcquire(parcLZCompressor, PARCLZCompressor);
+
+parcObject_ImplementRelease(parcLZCompressor, PARCLZCompressor);
+
+parcObject_ExtendPARCObject(PARCLZCompressor, _parcLZCompressor_Finalize, NULL, NULL, NULL, NULL, NULL, NULL);
+
+bool
+parcLZCompressor_IsValid(const PARCLZCompressor *instance)
+{
+    bool result = false;
+
+    if (instance != NULL) {
+        result = instance->level >= PARCLZ_LevelFastest && instance->level <= PARCLZ_LevelBest
+                 && instance->head != NULL && instance->chain != NULL;
+    }
+
+    return result;
+}
+
+void
+parcLZCompressor_AssertValid(const PARCLZCompressor *instance)
+{
+    assertTrue(parcLZCompressor_IsValid(instance),
+               "PARCLZCompressor is not valid.");
+}
+
+PARCLZCompressor *
+parcLZCompressor_Create(int level)
+{
+    trapIllegalValueIf(level < PARCLZ_LevelFastest || level > PARCLZ_LevelBest,
+                       "The level must be from %d to %d, not %d", PARCLZ_LevelFastest, PARCLZ_LevelBest, level);
+
+    PARCLZCompressor *result = parcObject_CreateInstance(PARCLZCompressor);
+    if (result == NULL) {
+        return NULL;
+    }
+
+    result->level = level;
+    result->searchDepth = (size_t) 1 << (level - 1);
+    result->base = 1;
+    result->head = parcMemory_AllocateAndClear(_HashSize * sizeof(uint32_t));
+    result->chain = parcMemory_AllocateAndClear(_ChainSize * sizeof(uint16_t));
+
+    return result;
+}
+
+int
+parcLZCompressor_GetLevel(const PARCLZCompressor *compressor)
+{
+    parcLZCompressor_OptionalAssertValid(compressor);
+
+    return compressor->level;
+}
+
+size_t
+parcLZ_CompressBound(size_t length)
+{
+    return length + length / 255 + 16;
+}
+
+static inline void
+_parcLZCompressor_Insert(PARCLZCompressor *compressor, const uint8_t *input, size_t position)
+{
+    uint32_t hash = _parcLZ_Hash(input + position);
+    if (compressor->searchDepth > 1) {
+        uint32_t previous = compressor->head[hash];
+        size_t distance = position - (size_t) (previous - compressor->base);
+        compressor->chain[position & _MaximumOffset] =
+            (previous >= compressor->base && distance <= _MaximumOffset) ? (uint16_t) distance : 0;
+    }
+    compressor->head[hash] = compressor->base + (uint32_t) position;
+}
+
+size_t
+parcLZCompressor_Compress(PARCLZCompressor *compressor, size_t length, const uint8_t input[length],
+                          size_t capacity, uint8_t output[capacity])
+{
+    parcLZCompressor_OptionalAssertValid(compressor);
+    trapIllegalValueIf(length >= UINT32_MAX / 2, "Cannot compress a block of %zu bytes", length);
+
+    if (length > UINT32_MAX - compressor->base) {
+        memset(compressor->head, 0, _HashSize * sizeof(uint32_t));
+        compressor->base = 1;
+    }
+
+    uint8_t *op = output;
+    const uint8_t *oend = output + capacity;
+    size_t anchor = 0;
+    size_t position = 0;
+    bool everyPosition = compressor->level > PARCLZ_LevelFastest;
+    // At level 1, the search skips ahead further the longer it has gone without finding a match.
+    unsigned skipShift = everyPosition ? 10 : 6;
+
+    while (length >= _SearchLimit && position <= length - _SearchLimit) {
+        uint32_t hash = _parcLZ_Hash(input + position);
+        uint32_t candidate = compressor->head[hash];
+        _parcLZCompressor_Insert(compressor, input, position);
+
+        size_t bestLength = 0;
+        size_t bestOffset = 0;
+        for (size_t depth = 0; depth < compressor->searchDepth && candidate >= compressor->base; depth++) {
+            size_t match = candidate - compressor->base;
+            size_t offset = position - match;
+            if (offset == 0 || offset > _MaximumOffset) {
+                break;
+            }
+            if (_parcLZ_Load32(input + match) == _parcLZ_Load32(input + position)) {
+                size_t matchLength = _parcLZ_MatchLength(input + match, input + position, length - position);
+                if (matchLength > bestLength) {
+                    bestLength = matchLength;
+                    bestOffset = offset;
+                    if (position + matchLength == length) {
+                        break;
+                    }
+                }
+            }
+            uint16_t distance = compressor->chain[match & _MaximumOffset];
+            if (distance == 0) {
+                break;
+            }
+            candidate -= distance;
+        }
+
+        if (bestLength < _MinimumMatch) {
+            position += 1 + ((position - anchor) >> skipShift);
+            continue;
+        }
+
+        // Extend the match backwards over bytes that would otherwise be literals.
+        size_t start = position;
+        while (start > anchor && start > bestOffset && input[start - 1] == input[start - 1 - bestOffset]) {
+            start--;
+            bestLength++;
+        }
+
+        op = _parcLZ_PutSequence(op, oend, input + anchor, start - anchor, bestOffset, bestLength);
+        if (op == NULL) {
+            return 0;
+        }
+
+        size_t end = start + bestLength;
+        if (everyPosition) {
+            for (size_t p = position + 1; p < end && p <= length - _SearchLimit; p++) {
+                _parcLZCompressor_Insert(compressor, input, p);
+            }
+        } else if (end >= 2 && end - 2 > position && end - 2 <= length - _SearchLimit) {
+            _parcLZCompressor_Insert(compressor, input, end - 2);
+        }
+        position = end;
+        anchor = end;
+    }
+
+    op = _parcLZ_PutSequence(op, oend, input + anchor, length - anchor, 0, 0);
+    if (op == NULL) {
+        return 0;
+    }
+
+    compressor->base += (uint32_t) length;
+
+    return (size_t) (op - output);
+}
+
+/*
+ * Read the extra bytes of a length encoded as 15 in a token. Return false if the input ends first.
+ */
+static inline bool
+_parcLZ_GetLength(const uint8_t **ipPtr, const uint8_t *iend, size_t *length)
+{
+    const uint8_t *ip = *ipPtr;
+    uint8_t byte;
+    do {
+        if (ip >= iend) {
+            return false;
+        }
+        byte = *ip++;
+        *length += byte;
+    } while (byte == 255);
+    *ipPtr = ip;
+    return true;
+}
+
+size_t
+parcLZ_Decompress(size_t length, const uint8_t input[length], size_t capacity, uint8_t output[capacity])
+{
+    const uint8_t *ip = input;
+    const uint8_t *iend = input + length;
+    uint8_t *op = output;
+    uint8_t *oend = output + capacity;
+
+    while (ip < iend) {
+        uint8_t token = *ip++;
+
+        size_t literalLength = token >> 4;
+        if (literalLength == 15 && !_parcLZ_GetLength(&ip, iend, &literalLength)) {
+            return SIZE_MAX;
+        }
+        if (literalLength > (size_t) (iend - ip) || literalLength > (size_t) (oend - op)) {
+            return SIZE_MAX;
+        }
+        if (literalLength <= 16 && iend - ip >= 16 && oend - op >= 16) {
+            memcpy(op, ip, 16);
+        } else {
+            memcpy(op, ip, literalLength);
+        }
+        ip += literalLength;
+        op += literalLength;
+
+        if (ip == iend) {
+            // The last sequence has no match.
+            break;
+        }
+
+        if (iend - ip < 2) {
+            return SIZE_MAX;
+        }
+        size_t offset = ip[0] | ((size_t) ip[1] << 8);
+        ip += 2;
+        if (offset == 0 || offset > (size_t) (op - output)) {
+            return SIZE_MAX;
+        }
+
+        size_t matchLength = token & 15;
+        if (matchLength == 15 && !_parcLZ_GetLength(&ip, iend, &matchLength)) {
+            return SIZE_MAX;
+        }
+        matchLength += _MinimumMatch;
+        if (matchLength > (size_t) (oend - op)) {
+            return SIZE_MAX;
+        }
+
+        const uint8_t *match = op - offset;
+        if (offset >= sizeof(uint64_t) && (size_t) (oend - op) >= matchLength + sizeof(uint64_t)) {
+            // The copy may overrun the match by up to 7 bytes, all within the output.
+            uint8_t *end = op + matchLength;
+            while (op < end) {
+                memcpy(op, match, sizeof(uint64_t));
+                op += sizeof(uint64_t);
+                match += sizeof(uint64_t);
+            }
+            op = end;
+        } else {
+            for (size_t i = 0; i < matchLength; i++) {
+                op[i] = match[i];
+            }
+            op += matchLength;
+        }
+    }
+
+    return (size_t) (op - output);
+}
@@ -0,0 +1,252 @@
+/*
+ * Copyright (c) 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Patent rights are not granted under this agreement. Patent rights are
+ *       available under FRAND terms.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX or PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * @file parc_LZ.h
+ * @ingroup inputoutput
+ * @brief A fast LZ77 compressor and decompressor for blocks of bytes.
+ *
+ * The compressed format is a sequence of (literals, match) pairs in the style of LZ4:
+ * each sequence is a token byte whose high four bits hold the number of literal bytes and whose low four bits
+ * hold the match length less 4, with 15 in either meaning that more length bytes follow (each adding up to 255);
+ * then the literal bytes; then the match offset as two little-endian bytes (1 to 65535);
+ * then any more match length bytes. The last sequence has literals only.
+ *
+ * A block is compressed without reference to any other, so blocks may be decompressed independently and in parallel.
+ * Decompression checks every length and offset against the input and output, so malformed input is
+ * reported as an error and never read or written out of bounds.
+ *
+ * A `PARCLZCompressor` holds the hash tables used to find matches, and reuses them from block to block without clearing them.
+ * Its level, from 1 to 9, trades speed for compression: level 1 looks at one earlier position for each match
+ * and skips ahead quickly through incompressible data; each higher level searches twice as many.
+ *
+ * @see PARCLZOutputStream
+ * @see PARCLZInputStream
+ *
+ * @copyright 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC).  All rights reserved.
+ */
+#ifndef libparc_parc_LZ_h
+#define libparc_parc_LZ_h
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * The fastest compression level.
+ */
+#define PARCLZ_LevelFastest 1
+
+/**
+ * The default compression level.
+ */
+#define PARCLZ_LevelDefault 3
+
+/**
+ * The compression level that compresses best.
+ */
+#define PARCLZ_LevelBest 9
+
+/**
+ * The framed stream format written by `PARCLZOutputStream` and read by `PARCLZInputStream`.
+ *
+ * A stream begins with the 4 bytes of `PARCLZ_StreamMagic`, followed by any number of blocks, and ends with a
+ * 4 byte zero word. Each block is a 12 byte header of three big-endian 32 bit words, followed by its payload:
+ *
+ *   - The payload length. If `PARCLZ_FrameStored` is set, the payload is the block's bytes uncompressed.
+ *   - The length of the block's bytes uncompressed, at most `PARCLZ_MaximumBlockSize`.
+ *   - The CRC32C of the block's bytes uncompressed.
+ *
+ * Every block is compressed independently, so a reader may locate the blocks from their headers
+ * and decompress them in parallel.
+ */
+#define PARCLZ_StreamMagic "PLZ1"
+#define PARCLZ_FrameHeaderLength 12
+#define PARCLZ_FrameStored 0x80000000U
+#define PARCLZ_MaximumBlockSize (16 * 1024 * 1024)
+
+struct PARCLZCompressor;
+typedef struct PARCLZCompressor PARCLZCompressor;
+
+#ifdef PARCLibrary_DISABLE_VALIDATION
+#  define parcLZCompressor_OptionalAssertValid(_instance_)
+#else
+#  define parcLZCompressor_OptionalAssertValid(_instance_) parcLZCompressor_AssertValid(_instance_)
+#endif
+
+/**
+ * Get the largest size that @p length bytes may have when compressed.
+ *
+ * An output array of this size is always large enough for {@link parcLZCompressor_Compress}.
+ *
+ * @param [in] length The number of bytes to be compressed.
+ *
+ * @return The largest size of the compressed bytes.
+ */
+size_t parcLZ_CompressBound(size_t length);
+
+/**
+ * Decompress a block of bytes compressed by {@link parcLZCompressor_Compress}.
+ *
+ * @param [in] length The number of compressed bytes.
+ * @param [in] input The compressed bytes.
+ * @param [in] capacity The size of @p output.
+ * @param [out] output The array to hold the decompressed bytes.
+ *
+ * @return The number of decompressed bytes.
+ * @return SIZE_MAX The input is malformed, or decompresses to more than @p capacity bytes.
+ *
+ * Example:
+ * @code
+ * {
+ *     uint8_t original[4096];
+ *     size_t length = parcLZ_Decompress(compressedLength, compressed, sizeof(original), original);
+ *     if (length == SIZE_MAX) {
+ *         // the input is malformed
+ *     }
+ * }
+ * @endcode
+ */
+size_t parcLZ_Decompress(size_t length, const uint8_t input[length], size_t capacity, uint8_t output[capacity]);
+
+/**
+ * Create a `PARCLZCompressor` that compresses at the given level.
+ *
+ * @param [in] level The compression level, from `PARCLZ_LevelFastest` (1) to `PARCLZ_LevelBest` (9).
+ *
+ * @return non-NULL A pointer to a valid `PARCLZCompressor` instance.
+ * @return NULL Memory could not be allocated.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCLZCompressor *compressor = parcLZCompressor_Create(PARCLZ_LevelDefault);
+ *
+ *     parcLZCompressor_Release(&compressor);
+ * }
+ * @endcode
+ */
+PARCLZCompressor *parcLZCompressor_Create(int level);
+
+/**
+ * Increase the number of references to a `PARCLZCompressor` instance.
+ *
+ * Note that a new `PARCLZCompressor` is not created,
+ * only that the given `PARCLZCompressor` reference count is incremented.
+ * Discard the reference by invoking `parcLZCompressor_Release`.
+ *
+ * @param [in] instance A pointer to a valid `PARCLZCompressor` instance.
+ *
+ * @return The same value as @p instance.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCLZCompressor *a = parcLZCompressor_Create(PARCLZ_LevelDefault);
+ *
+ *     PARCLZCompressor *b = parcLZCompressor_Acquire(a);
+ *
+ *     parcLZCompressor_Release(&a);
+ *     parcLZCompressor_Release(&b);
+ * }
+ * @endcode
+ */
+PARCLZCompressor *parcLZCompressor_Acquire(const PARCLZCompressor *instance);
+
+/**
+ * Release a previously acquired reference to the given `PARCLZCompressor` instance,
+ * decrementing the reference count for the instance.
+ *
+ * The pointer to the instance is set to NULL as a side-effect of this function.
+ *
+ * If the invocation causes the last reference to the instance to be released,
+ * the instance is deallocated.
+ *
+ * @param [in,out] instancePtr A pointer to a pointer to the instance to release.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCLZCompressor *compressor = parcLZCompressor_Create(PARCLZ_LevelDefault);
+ *
+ *     parcLZCompressor_Release(&compressor);
+ * }
+ * @endcode
+ */
+void parcLZCompressor_Release(PARCLZCompressor **instancePtr);
+
+/**
+ * Determine if an instance of `PARCLZCompressor` is valid.
+ *
+ * @param [in] instance A pointer to a `PARCLZCompressor` instance.
+ *
+ * @return true The instance is valid.
+ * @return false The instance is not valid.
+ */
+bool parcLZCompressor_IsValid(const PARCLZCompressor *instance);
+
+/**
+ * Assert that the given `PARCLZCompressor` instance is valid.
+ *
+ * @param [in] instance A pointer to a valid `PARCLZCompressor` instance.
+ */
+void parcLZCompressor_AssertValid(const PARCLZCompressor *instance);
+
+/**
+ * Get the compression level of the given `PARCLZCompressor`.
+ *
+ * @param [in] compressor A pointer to a valid `PARCLZCompressor` instance.
+ *
+ * @return The compression level, from 1 to 9.
+ */
+int parcLZCompressor_GetLevel(const PARCLZCompressor *compressor);
+
+/**
+ * Compress a block of bytes.
+ *
+ * A `PARCLZCompressor` must not be used by more than one thread at a time.
+ *
+ * @param [in] compressor A pointer to a valid `PARCLZCompressor` instance.
+ * @param [in] length The number of bytes to compress.
+ * @param [in] input The bytes to compress.
+ * @param [in] capacity The size of @p output.
+ * @param [out] output The array to hold the compressed bytes.
+ *
+ * @return The number of compressed bytes.
+ * @return 0 The compressed bytes do not fit in @p capacity bytes (which never happens if it is at least
+ *           `parcLZ_CompressBound(length)`).
+ *
+ * Example:
+ * @code
+ * {
+ *     uint8_t compressed[parcLZ_CompressBound(length)];
+ *     size_t compressedLength = parcLZCompressor_Compress(compressor, length, input, sizeof(compressed), compressed);
+ * }
+ * @endcode
+ */
+size_t parcLZCompressor_Compress(PARCLZCompressor *compressor, size_t length, const uint8_t input[length],
+                                 size_t capacity, uint8_t output[capacity]);
+#endif // libparc_parc_LZ_h
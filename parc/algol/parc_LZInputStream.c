@@ -0,0 +1,273 @@
+/*
+ * Copyright (c) 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Patent rights are not granted under this agreement. Patent rights are
+ *       available under FRAND terms.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX or PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * @copyright 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC).  All rights reserved.
+ */
+#include <config.h>
+
+#include <string.h>
+
+#include <LongBow/runtime.h>
+
+#include <parc/algol/parc_Object.h>
+#include <parc/algol/parc_Memory.h>
+#include <parc/algol/parc_LZInputStream.h>
+
+#include <parc/security/parc_CryptoHasher.h>
+
+PARCInputStreamInterface *PARCLZInputStreamAsPARCInputStream = &(PARCInputStreamInterface) {
+    .Acquire = (PARCInputStream * (*)(const PARCInputStream *))parcLZInputStream_Acquire,
+    .Release = (void (*)(PARCInputStream **))parcLZInputStream_Release,
+    .Read = (size_t (*)(PARCInputStream *, PARCBuffer *))parcLZInputStream_Read
+};
+
+struct PARCLZInputStream {
+    PARCInputStream *input;
+    PARCCryptoHasher *hasher;
+
+    PARCBuffer *header;
+    PARCBuffer *payload;   // Grown to fit the largest payload read so far.
+    PARCBuffer *block;     // The current block's bytes not yet read, from the position to the limit.
+
+    bool started;          // The stream magic has been read.
+    bool finished;         // The end of the stream has been read.
+    bool corrupted;
+};
+
+static uint32_t
+_parcLZInputStream_GetUint32(const uint8_t *array)
+{
+    return ((uint32_t) array[0] << 24) | ((uint32_t) array[1] << 16) | ((uint32_t) array[2] << 8) | array[3];
+}
+
+/*
+ * Read exactly `length` bytes into `buffer`, from position 0, and return a pointer to them,
+ * or NULL if the input ends first.
+ */
+static const uint8_t *
+_parcLZInputStream_ReadFully(PARCLZInputStream *stream, PARCBuffer *buffer, size_t length)
+{
+    parcBuffer_SetLimit(parcBuffer_Clear(buffer), length);
+    while (parcBuffer_HasRemaining(buffer)) {
+        size_t position = parcBuffer_Position(buffer);
+        parcInputStream_Read(stream->input, buffer);
+        if (parcBuffer_Position(buffer) == position) {
+            return NULL;
+        }
+    }
+    return parcBuffer_Overlay(parcBuffer_Flip(buffer), 0);
+}
+
+/*
+ * Make sure that `*bufferPtr` has at least `capacity` bytes.
+ */
+static void
+_parcLZInputStream_Reserve(PARCBuffer **bufferPtr, size_t capacity)
+{
+    if (parcBuffer_Capacity(*bufferPtr) < capacity) {
+        parcBuffer_Release(bufferPtr);
+        *bufferPtr = parcBuffer_Allocate(capacity);
+    }
+}
+
+static bool
+_parcLZInputStream_ChecksumMatches(PARCLZInputStream *stream, size_t length, const uint8_t *bytes, uint32_t expected)
+{
+    parcCryptoHasher_Init(stream->hasher);
+    parcCryptoHasher_UpdateBytes(stream->hasher, bytes, length);
+    PARCCryptoHash *hash = parcCryptoHasher_Finalize(stream->hasher);
+    bool result = parcBuffer_GetUint32(parcCryptoHash_GetDigest(hash)) == expected;
+    parcCryptoHash_Release(&hash);
+    return result;
+}
+
+static bool
+_parcLZInputStream_Corrupted(PARCLZInputStream *stream)
+{
+    stream->corrupted = true;
+    parcBuffer_SetLimit(parcBuffer_SetPosition(stream->block, 0), 0);
+    return false;
+}
+
+/*
+ * Read, decompress and check the next block.
+ * Return false if there is no next block, setting `finished` or `corrupted`.
+ */
+static bool
+_parcLZInputStream_ReadBlock(PARCLZInputStream *stream)
+{
+    if (!stream->started) {
+        const uint8_t *magic = _parcLZInputStream_ReadFully(stream, stream->header, 4);
+        if (magic == NULL || memcmp(magic, PARCLZ_StreamMagic, 4) != 0) {
+            return _parcLZInputStream_Corrupted(stream);
+        }
+        stream->started = true;
+    }
+
+    const uint8_t *header = _parcLZInputStream_ReadFully(stream, stream->header, 4);
+    if (header == NULL) {
+        return _parcLZInputStream_Corrupted(stream);
+    }
+    uint32_t payloadWord = _parcLZInputStream_GetUint32(header);
+    if (payloadWord == 0) {
+        stream->finished = true;
+        return false;
+    }
+
+    header = _parcLZInputStream_ReadFully(stream, stream->header, PARCLZ_FrameHeaderLength - 4);
+    if (header == NULL) {
+        return _parcLZInputStream_Corrupted(stream);
+    }
+    bool stored = (payloadWord & PARCLZ_FrameStored) != 0;
+    size_t payloadLength = payloadWord & ~PARCLZ_FrameStored;
+    size_t length = _parcLZInputStream_GetUint32(header);
+    uint32_t checksum = _parcLZInputStream_GetUint32(header + 4);
+
+    if (length == 0 || length > PARCLZ_MaximumBlockSize || payloadLength > parcLZ_CompressBound(length)
+        || (stored && payloadLength != length)) {
+        return _parcLZInputStream_Corrupted(stream);
+    }
+
+    _parcLZInputStream_Reserve(&stream->payload, payloadLength);
+    const uint8_t *payload = _parcLZInputStream_ReadFully(stream, stream->payload, payloadLength);
+    if (payload == NULL) {
+        return _parcLZInputStream_Corrupted(stream);
+    }
+
+    _parcLZInputStream_Reserve(&stream->block, length);
+    parcBuffer_Clear(stream->block);
+    uint8_t *bytes = parcBuffer_Overlay(stream->block, 0);
+    if (stored) {
+        memcpy(bytes, payload, length);
+    } else if (parcLZ_Decompress(payloadLength, payload, length, bytes) != length) {
+        return _parcLZInputStream_Corrupted(stream);
+    }
+    if (!_parcLZInputStream_ChecksumMatches(stream, length, bytes, checksum)) {
+        return _parcLZInputStream_Corrupted(stream);
+    }
+    parcBuffer_SetLimit(stream->block, length);
+
+    return true;
+}
+
+static void
+_parcLZInputStream_Finalize(PARCLZInputStream **instancePtr)
+{
+    assertNotNull(instancePtr, "Parameter must be a non-null pointer to a PARCLZInputStream pointer.");
+    PARCLZInputStream *stream = *instancePtr;
+
+    parcBuffer_Release(&stream->block);
+    parcBuffer_Release(&stream->payload);
+    parcBuffer_Release(&stream->header);
+    parcCryptoHasher_Release(&stream->hasher);
+    parcInputStream_Release(&stream->input);
+}
+
+parcObject_ImplementAcquire(parcLZInputStream, PARCLZInputStream);
+
+parcObject_ImplementRelease(parcLZInputStream, PARCLZInputStream);
+
+parcObject_ExtendPARCObject(PARCLZInputStream, _parcLZInputStream_Finalize, NULL, NULL, NULL, NULL, NULL, NULL);
+
+bool
+parcLZInputStream_IsValid(const PARCLZInputStream *instance)
+{
+    bool result = false;
+
+    if (instance != NULL) {
+        result = instance->input != NULL && instance->block != NULL;
+    }
+
+    return result;
+}
+
+void
+parcLZInputStream_AssertValid(const PARCLZInputStream *instance)
+{
+    assertTrue(parcLZInputStream_IsValid(instance),
+               "PARCLZInputStream is not valid.");
+}
+
+PARCLZInputStream *
+parcLZInputStream_Create(PARCInputStream *input)
+{
+    assertNotNull(input, "Parameter input must be a non-null PARCInputStream pointer.");
+
+    PARCLZInputStream *result = parcObject_CreateInstance(PARCLZInputStream);
+    if (result == NULL) {
+        return NULL;
+    }
+
+    result->input = parcInputStream_Acquire(input);
+    result->hasher = parcCryptoHasher_Create(PARC_HASH_CRC32C);
+    result->header = parcBuffer_Allocate(PARCLZ_FrameHeaderLength);
+    result->payload = parcBuffer_Allocate(0);
+    result->block = parcBuffer_Flip(parcBuffer_Allocate(0));
+    result->started = false;
+    result->finished = false;
+    result->corrupted = false;
+
+    return result;
+}
+
+PARCInputStream *
+parcLZInputStream_AsInputStream(PARCLZInputStream *stream)
+{
+    return parcInputStream(parcLZInputStream_Acquire(stream), PARCLZInputStreamAsPARCInputStream);
+}
+
+size_t
+parcLZInputStream_Read(PARCLZInputStream *stream, PARCBuffer *buffer)
+{
+    parcLZInputStream_OptionalAssertValid(stream);
+
+    size_t result = 0;
+
+    while (parcBuffer_HasRemaining(buffer)) {
+        if (!parcBuffer_HasRemaining(stream->block)) {
+            if (stream->finished || stream->corrupted || !_parcLZInputStream_ReadBlock(stream)) {
+                break;
+            }
+        }
+        size_t length = parcBuffer_Remaining(buffer);
+        if (length > parcBuffer_Remaining(stream->block)) {
+            length = parcBuffer_Remaining(stream->block);
+        }
+        parcBuffer_PutArray(buffer, length, parcBuffer_Overlay(stream->block, length));
+        result += length;
+    }
+
+    return result;
+}
+
+bool
+parcLZInputStream_IsCorrupted(const PARCLZInputStream *stream)
+{
+    parcLZInputStream_OptionalAssertValid(stream);
+
+    return stream->corrupted;
+}
@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Patent rights are not granted under this agreement. Patent rights are
+ *       available under FRAND terms.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX or PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * @file parc_LZInputStream.h
+ * @ingroup inputoutput
+ * @brief An input stream that reads and decompresses a stream written by a `PARCLZOutputStream`.
+ *
+ * A `PARCLZInputStream` reads the framed format described in parc_LZ.h from an underlying `PARCInputStream`
+ * one block at a time, decompresses each block and checks its CRC32C with a `PARCCryptoHasher`.
+ *
+ * If the input is malformed, a block fails its checksum, or the input ends before the end of the stream,
+ * the stream returns no more bytes and {@link parcLZInputStream_IsCorrupted} returns true.
+ * The bytes of a block are never returned until the whole block has been checked.
+ *
+ * @see PARCLZOutputStream
+ *
+ * @copyright 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC).  All rights reserved.
+ */
+#ifndef libparc_parc_LZInputStream_h
+#define libparc_parc_LZInputStream_h
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include <parc/algol/parc_Buffer.h>
+#include <parc/algol/parc_InputStream.h>
+#include <parc/algol/parc_LZ.h>
+
+struct PARCLZInputStream;
+typedef struct PARCLZInputStream PARCLZInputStream;
+
+/**
+ * The mapping of a `PARCLZInputStream` to the generic `PARCInputStream`.
+ */
+extern PARCInputStreamInterface *PARCLZInputStreamAsPARCInputStream;
+
+#ifdef PARCLibrary_DISABLE_VALIDATION
+#  define parcLZInputStream_OptionalAssertValid(_instance_)
+#else
+#  define parcLZInputStream_OptionalAssertValid(_instance_) parcLZInputStream_AssertValid(_instance_)
+#endif
+
+/**
+ * Create a `PARCLZInputStream` that reads compressed blocks from the given `PARCInputStream`.
+ *
+ * @param [in] input A pointer to a valid `PARCInputStream`. The stream acquires a reference to it.
+ *
+ * @return non-NULL A pointer to a valid `PARCLZInputStream` instance.
+ * @return NULL Memory could not be allocated.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCFileInputStream *fileInput = parcFileInputStream_Create(fd);
+ *     PARCInputStream *input = parcInputStream(fileInput, PARCFileInputStreamAsPARCInputStream);
+ *
+ *     PARCLZInputStream *decompressed = parcLZInputStream_Create(input);
+ *     parcInputStream_Release(&input);
+ *
+ *     PARCBuffer *buffer = parcBuffer_Allocate(4096);
+ *     while (parcLZInputStream_Read(decompressed, parcBuffer_Clear(buffer)) > 0) {
+ *         parcBuffer_Flip(buffer);
+ *         // use the buffer
+ *     }
+ *     if (parcLZInputStream_IsCorrupted(decompressed)) {
+ *         // the input was not a complete, intact stream
+ *     }
+ *
+ *     parcBuffer_Release(&buffer);
+ *     parcLZInputStream_Release(&decompressed);
+ * }
+ * @endcode
+ */
+PARCLZInputStream *parcLZInputStream_Create(PARCInputStream *input);
+
+/**
+ * Create a `PARCInputStream` that reads from the given `PARCLZInputStream`.
+ *
+ * @param [in] stream A pointer to a valid `PARCLZInputStream`. The new stream acquires a reference to it.
+ *
+ * @return non-NULL A pointer to a valid `PARCInputStream`.
+ * @return NULL Memory could not be allocated.
+ */
+PARCInputStream *parcLZInputStream_AsInputStream(PARCLZInputStream *stream);
+
+/**
+ * Increase the number of references to a `PARCLZInputStream` instance.
+ *
+ * Note that a new `PARCLZInputStream` is not created,
+ * only that the given `PARCLZInputStream` reference count is incremented.
+ * Discard the reference by invoking `parcLZInputStream_Release`.
+ *
+ * @param [in] instance A pointer to a valid `PARCLZInputStream` instance.
+ *
+ * @return The same value as @p instance.
+ */
+PARCLZInputStream *parcLZInputStream_Acquire(const PARCLZInputStream *instance);
+
+/**
+ * Release a previously acquired reference to the given `PARCLZInputStream` instance,
+ * decrementing the reference count for the instance.
+ *
+ * The pointer to the instance is set to NULL as a side-effect of this function.
+ *
+ * @param [in,out] instancePtr A pointer to a pointer to the instance to release.
+ */
+void parcLZInputStream_Release(PARCLZInputStream **instancePtr);
+
+/**
+ * Determine if an instance of `PARCLZInputStream` is valid.
+ *
+ * @param [in] instance A pointer to a `PARCLZInputStream` instance.
+ *
+ * @return true The instance is valid.
+ * @return false The instance is not valid.
+ */
+bool parcLZInputStream_IsValid(const PARCLZInputStream *instance);
+
+/**
+ * Assert that the given `PARCLZInputStream` instance is valid.
+ *
+ * @param [in] instance A pointer to a valid `PARCLZInputStream` instance.
+ */
+void parcLZInputStream_AssertValid(const PARCLZInputStream *instance);
+
+/**
+ * Read decompressed bytes into the given `PARCBuffer`, from its position to its limit.
+ *
+ * The buffer is filled unless the end of the stream is reached, or the input is corrupted.
+ * The buffer's position is advanced past the bytes read.
+ *
+ * @param [in] stream A pointer to a valid `PARCLZInputStream` instance.
+ * @param [in] buffer A pointer to a valid `PARCBuffer` instance.
+ *
+ * @return The number of bytes read, which is 0 at the end of the stream.
+ */
+size_t parcLZInputStream_Read(PARCLZInputStream *stream, PARCBuffer *buffer);
+
+/**
+ * Determine if the input of the given `PARCLZInputStream` was found to be corrupted.
+ *
+ * @param [in] stream A pointer to a valid `PARCLZInputStream` instance.
+ *
+ * @return true The input is malformed, a block failed its checksum, or the input ended before the end of the stream.
+ * @return false No corruption has been found in the input read so far.
+ */
+bool parcLZInputStream_IsCorrupted(const PARCLZInputStream *stream);
+#endif // libparc_parc_LZInputStream_h
@@ -0,0 +1,238 @@
+/*
+ * Copyright (c) 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Patent rights are not granted under this agreement. Patent rights are
+ *       available under FRAND terms.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX or PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * @copyright 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC).  All rights reserved.
+ */
+#include <config.h>
+
+#include <string.h>
+
+#include <LongBow/runtime.h>
+
+#include <parc/algol/parc_Object.h>
+#include <parc/algol/parc_Memory.h>
+#include <parc/algol/parc_LZOutputStream.h>
+
+#include <parc/security/parc_CryptoHasher.h>
+
+PARCOutputStreamInterface *PARCLZOutputStreamAsPARCOutputStream = &(PARCOutputStreamInterface) {
+    .Acquire = (PARCOutputStream * (*)(PARCOutputStream *))parcLZOutputStream_Acquire,
+    .Release = (void (*)(PARCOutputStream **))parcLZOutputStream_Release,
+    .Write = (size_t (*)(PARCOutputStream *, PARCBuffer *))parcLZOutputStream_Write,
+    .Flush = (bool (*)(PARCOutputStream *))parcLZOutputStream_Flush
+};
+
+struct PARCLZOutputStream {
+    PARCOutputStream *output;
+    PARCLZCompressor *compressor;
+    PARCCryptoHasher *hasher;
+
+    PARCBuffer *block;  // The bytes of the current block, from 0 to the position.
+    PARCBuffer *frame;  // Large enough for the stream magic and the largest frame.
+    bool started;       // The stream magic has been written.
+    bool failed;        // A write to the underlying stream failed since the last flush.
+};
+
+static void
+_parcLZOutputStream_PutUint32(uint8_t *array, uint32_t value)
+{
+    array[0] = (uint8_t) (value >> 24);
+    array[1] = (uint8_t) (value >> 16);
+    array[2] = (uint8_t) (value >> 8);
+    array[3] = (uint8_t) value;
+}
+
+static uint32_t
+_parcLZOutputStream_Checksum(PARCLZOutputStream *stream, size_t length, const uint8_t *bytes)
+{
+    parcCryptoHasher_Init(stream->hasher);
+    parcCryptoHasher_UpdateBytes(stream->hasher, bytes, length);
+    PARCCryptoHash *hash = parcCryptoHasher_Finalize(stream->hasher);
+    uint32_t result = parcBuffer_GetUint32(parcCryptoHash_GetDigest(hash));
+    parcCryptoHash_Release(&hash);
+    return result;
+}
+
+static void
+_parcLZOutputStream_WriteFrame(PARCLZOutputStream *stream)
+{
+    parcBuffer_Flip(stream->frame);
+    parcOutputStream_Write(stream->output, stream->frame);
+    if (parcBuffer_HasRemaining(stream->frame)) {
+        stream->failed = true;
+    }
+    parcBuffer_Clear(stream->frame);
+}
+
+static void
+_parcLZOutputStream_PutMagic(PARCLZOutputStream *stream)
+{
+    if (!stream->started) {
+        parcBuffer_PutArray(stream->frame, 4, (const uint8_t *) PARCLZ_StreamMagic);
+        stream->started = true;
+    }
+}
+
+/*
+ * Compress the current block and write it to the underlying stream as one frame.
+ */
+static void
+_parcLZOutputStream_WriteBlock(PARCLZOutputStream *stream)
+{
+    size_t length = parcBuffer_Position(stream->block);
+    if (length == 0) {
+        return;
+    }
+    const uint8_t *bytes = parcBuffer_Overlay(parcBuffer_Flip(stream->block), 0);
+
+    _parcLZOutputStream_PutMagic(stream);
+    uint8_t *header = parcBuffer_Overlay(stream->frame, PARCLZ_FrameHeaderLength);
+    uint8_t *payload = parcBuffer_Overlay(stream->frame, 0);
+
+    uint32_t payloadWord;
+    size_t payloadLength = parcLZCompressor_Compress(stream->compressor, length, bytes, parcBuffer_Remaining(stream->frame), payload);
+    if (payloadLength == 0 || payloadLength >= length) {
+        memcpy(payload, bytes, length);
+        payloadLength = length;
+        payloadWord = (uint32_t) length | PARCLZ_FrameStored;
+    } else {
+        payloadWord = (uint32_t) payloadLength;
+    }
+    _parcLZOutputStream_PutUint32(header, payloadWord);
+    _parcLZOutputStream_PutUint32(header + 4, (uint32_t) length);
+    _parcLZOutputStream_PutUint32(header + 8, _parcLZOutputStream_Checksum(stream, length, bytes));
+    parcBuffer_SetPosition(stream->frame, parcBuffer_Position(stream->frame) + payloadLength);
+
+    _parcLZOutputStream_WriteFrame(stream);
+    parcBuffer_Clear(stream->block);
+}
+
+static void
+_parcLZOutputStream_Finalize(PARCLZOutputStream **instancePtr)
+{
+    assertNotNull(instancePtr, "Parameter must be a non-null pointer to a PARCLZOutputStream pointer.");
+    PARCLZOutputStream *stream = *instancePtr;
+
+    _parcLZOutputStream_WriteBlock(stream);
+    _parcLZOutputStream_PutMagic(stream);
+    parcBuffer_PutUint32(stream->frame, 0);
+    _parcLZOutputStream_WriteFrame(stream);
+
+    parcBuffer_Release(&stream->frame);
+    parcBuffer_Release(&stream->block);
+    parcCryptoHasher_Release(&stream->hasher);
+    parcLZCompressor_Release(&stream->compressor);
+    parcOutputStream_Release(&stream->output);
+}
+
+parcObject_ImplementAcquire(parcLZOutputStream, PARCLZOutputStream);
+
+parcObject_ImplementRelease(parcLZOutputStream, PARCLZOutputStream);
+
+parcObject_ExtendPARCObject(PARCLZOutputStream, _parcLZOutputStream_Finalize, NULL, NULL, NULL, NULL, NULL, NULL);
+
+bool
+parcLZOutputStream_IsValid(const PARCLZOutputStream *instance)
+{
+    bool result = false;
+
+    if (instance != NULL) {
+        result = instance->output != NULL && instance->block != NULL && instance->frame != NULL;
+    }
+
+    return result;
+}
+
+void
+parcLZOutputStream_AssertValid(const PARCLZOutputStream *instance)
+{
+    assertTrue(parcLZOutputStream_IsValid(instance),
+               "PARCLZOutputStream is not valid.");
+}
+
+PARCLZOutputStream *
+parcLZOutputStream_Create(PARCOutputStream *output, int level, size_t blockSize)
+{
+    assertNotNull(output, "Parameter output must be a non-null PARCOutputStream pointer.");
+    trapIllegalValueIf(blockSize == 0 || blockSize > PARCLZ_MaximumBlockSize,
+                       "The block size must be from 1 to %d, not %zu", PARCLZ_MaximumBlockSize, blockSize);
+
+    PARCLZOutputStream *result = parcObject_CreateInstance(PARCLZOutputStream);
+    if (result == NULL) {
+        return NULL;
+    }
+
+    result->output = parcOutputStream_Acquire(output);
+    result->compressor = parcLZCompressor_Create(level);
+    result->hasher = parcCryptoHasher_Create(PARC_HASH_CRC32C);
+    result->block = parcBuffer_Allocate(blockSize);
+    result->frame = parcBuffer_Allocate(4 + PARCLZ_FrameHeaderLength + parcLZ_CompressBound(blockSize));
+    result->started = false;
+    result->failed = false;
+
+    return result;
+}
+
+PARCOutputStream *
+parcLZOutputStream_AsOutputStream(PARCLZOutputStream *stream)
+{
+    return parcOutputStream_Create(parcLZOutputStream_Acquire(stream), PARCLZOutputStreamAsPARCOutputStream);
+}
+
+size_t
+parcLZOutputStream_Write(PARCLZOutputStream *stream, PARCBuffer *buffer)
+{
+    parcLZOutputStream_OptionalAssertValid(stream);
+
+    size_t result = parcBuffer_Remaining(buffer);
+
+    while (parcBuffer_HasRemaining(buffer)) {
+        size_t length = parcBuffer_Remaining(buffer);
+        if (length > parcBuffer_Remaining(stream->block)) {
+            length = parcBuffer_Remaining(stream->block);
+        }
+        parcBuffer_PutArray(stream->block, length, parcBuffer_Overlay(buffer, length));
+        if (!parcBuffer_HasRemaining(stream->block)) {
+            _parcLZOutputStream_WriteBlock(stream);
+        }
+    }
+
+    return result;
+}
+
+bool
+parcLZOutputStream_Flush(PARCLZOutputStream *stream)
+{
+    parcLZOutputStream_OptionalAssertValid(stream);
+
+    _parcLZOutputStream_WriteBlock(stream);
+
+    bool result = !stream->failed;
+    stream->failed = false;
+
+    return parcOutputStream_Flush(stream->output) && result;
+}
@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Patent rights are not granted under this agreement. Patent rights are
+ *       available under FRAND terms.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX or PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * @file parc_LZOutputStream.h
+ * @ingroup inputoutput
+ * @brief An output stream that compresses what is written to it and writes it to another stream.
+ *
+ * A `PARCLZOutputStream` collects the bytes written to it into blocks, compresses each block with a
+ * `PARCLZCompressor`, and writes it to the underlying `PARCOutputStream` in the framed format described in
+ * parc_LZ.h, with a CRC32C of its bytes computed by a `PARCCryptoHasher`.
+ * A block that does not compress is written uncompressed.
+ *
+ * A block is written when it is full, or early when the stream is flushed (see `parcOutputStream_Flush`).
+ * Releasing the last reference writes the last block and the end of the stream.
+ *
+ * A `PARCLZOutputStream` must not be written to by more than one thread at a time.
+ *
+ * @see PARCLZInputStream
+ *
+ * @copyright 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC).  All rights reserved.
+ */
+#ifndef libparc_parc_LZOutputStream_h
+#define libparc_parc_LZOutputStream_h
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include <parc/algol/parc_Buffer.h>
+#include <parc/algol/parc_OutputStream.h>
+#include <parc/algol/parc_LZ.h>
+
+struct PARCLZOutputStream;
+typedef struct PARCLZOutputStream PARCLZOutputStream;
+
+/**
+ * The mapping of a `PARCLZOutputStream` to the generic `PARCOutputStream`.
+ */
+extern PARCOutputStreamInterface *PARCLZOutputStreamAsPARCOutputStream;
+
+#ifdef PARCLibrary_DISABLE_VALIDATION
+#  define parcLZOutputStream_OptionalAssertValid(_instance_)
+#else
+#  define parcLZOutputStream_OptionalAssertValid(_instance_) parcLZOutputStream_AssertValid(_instance_)
+#endif
+
+/**
+ * Create a `PARCLZOutputStream` that writes compressed blocks to the given `PARCOutputStream`.
+ *
+ * @param [in] output A pointer to a valid `PARCOutputStream`. The stream acquires a reference to it.
+ * @param [in] level The compression level, from `PARCLZ_LevelFastest` to `PARCLZ_LevelBest`.
+ * @param [in] blockSize The number of bytes in each block, from 1 to `PARCLZ_MaximumBlockSize`.
+ *
+ * @return non-NULL A pointer to a valid `PARCLZOutputStream` instance.
+ * @return NULL Memory could not be allocated.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCFileOutputStream *fileOutput = parcFileOutputStream_Create(fd);
+ *     PARCOutputStream *output = parcFileOutputStream_AsOutputStream(fileOutput);
+ *     parcFileOutputStream_Release(&fileOutput);
+ *
+ *     PARCLZOutputStream *compressed = parcLZOutputStream_Create(output, PARCLZ_LevelDefault, 64 * 1024);
+ *     parcOutputStream_Release(&output);
+ *
+ *     parcLZOutputStream_Write(compressed, buffer);
+ *
+ *     parcLZOutputStream_Release(&compressed);
+ * }
+ * @endcode
+ */
+PARCLZOutputStream *parcLZOutputStream_Create(PARCOutputStream *output, int level, size_t blockSize);
+
+/**
+ * Create a `PARCOutputStream` that writes to the given `PARCLZOutputStream`.
+ *
+ * @param [in] stream A pointer to a valid `PARCLZOutputStream`. The new stream acquires a reference to it.
+ *
+ * @return non-NULL A pointer to a valid `PARCOutputStream`.
+ * @return NULL Memory could not be allocated.
+ */
+PARCOutputStream *parcLZOutputStream_AsOutputStream(PARCLZOutputStream *stream);
+
+/**
+ * Increase the number of references to a `PARCLZOutputStream` instance.
+ *
+ * Note that a new `PARCLZOutputStream` is not created,
+ * only that the given `PARCLZOutputStream` reference count is incremented.
+ * Discard the reference by invoking `parcLZOutputStream_Release`.
+ *
+ * @param [in] instance A pointer to a valid `PARCLZOutputStream` instance.
+ *
+ * @return The same value as @p instance.
+ */
+PARCLZOutputStream *parcLZOutputStream_Acquire(const PARCLZOutputStream *instance);
+
+/**
+ * Release a previously acquired reference to the given `PARCLZOutputStream` instance,
+ * decrementing the reference count for the instance.
+ *
+ * The pointer to the instance is set to NULL as a side-effect of this function.
+ *
+ * If the invocation causes the last reference to the instance to be released,
+ * the last block and the end of the stream are written, and the instance is deallocated.
+ *
+ * @param [in,out] instancePtr A pointer to a pointer to the instance to release.
+ */
+void parcLZOutputStream_Release(PARCLZOutputStream **instancePtr);
+
+/**
+ * Determine if an instance of `PARCLZOutputStream` is valid.
+ *
+ * @param [in] instance A pointer to a `PARCLZOutputStream` instance.
+ *
+ * @return true The instance is valid.
+ * @return false The instance is not valid.
+ */
+bool parcLZOutputStream_IsValid(const PARCLZOutputStream *instance);
+
+/**
+ * Assert that the given `PARCLZOutputStream` instance is valid.
+ *
+ * @param [in] instance A pointer to a valid `PARCLZOutputStream` instance.
+ */
+void parcLZOutputStream_AssertValid(const PARCLZOutputStream *instance);
+
+/**
+ * Write the remaining bytes of the given `PARCBuffer` to the stream.
+ *
+ * The buffer's position is set to its limit.
+ *
+ * @param [in] stream A pointer to a valid `PARCLZOutputStream` instance.
+ * @param [in] buffer A pointer to a valid `PARCBuffer` instance.
+ *
+ * @return The number of bytes written.
+ */
+size_t parcLZOutputStream_Write(PARCLZOutputStream *stream, PARCBuffer *buffer);
+
+/**
+ * Compress and write the bytes in the current block, even though it is not full, and flush the underlying stream.
+ *
+ * @param [in] stream A pointer to a valid `PARCLZOutputStream` instance.
+ *
+ * @return true Every block was written to the underlying stream.
+ * @return false A write to the underlying stream failed since the last flush.
+ */
+bool parcLZOutputStream_Flush(PARCLZOutputStream *stream);
+#endif // libparc_parc_LZOutputStream_h
@@ -262,6 +262,42 @@ parcLinkedList_CreateIterator(PARCLinkedList *list)
     return iterator;
 }
 
+PARCCursor
+parcLinkedList_Cursor(const PARCLinkedList *list)
+{
+    PARCCursor result = { .collection = list, .position = NULL, .index = 0 };
+    return result;
+}
+
+bool
+parcLinkedList_CursorHasNext(const PARCCursor *cursor)
+{
+    const _PARCLinkedListNode *node = cursor->position;
+
+    if (node == NULL) {
+        return ((const PARCLinkedList *) cursor->collection)->head != NULL;
+    }
+    return node->next != NULL;
+}
+
+PARCObject *
+parcLinkedList_CursorNext(PARCCursor *cursor)
+{
+    _PARCLinkedListNode *node = cursor->position;
+
+    if (node == NULL) {
+        node = ((const PARCLinkedList *) cursor->collection)->head;
+    } else {
+        node = node->next;
+    }
+    trapOutOfBoundsIf(node == NULL, "No more elements.");
+
+    cursor->position = node;
+    cursor->index++;
+
+    return node->object;
+}
+
 PARCLinkedList *
 parcLinkedList_Create(void)
 {
@@ -104,6 +104,71 @@ void parcLinkedList_AssertValid(const PARCLinkedList *list);
  */
 PARCIterator *parcLinkedList_CreateIterator(PARCLinkedList *list);
 
+/**
+ * Create a `PARCCursor` positioned before the first element of the given `PARCLinkedList`.
+ *
+ * The cursor is returned by value and requires no allocation or release.
+ * The list must not be modified while the cursor is in use.
+ *
+ * @param [in] list A pointer to a valid `PARCLinkedList`.
+ *
+ * @return A `PARCCursor` for use with {@link parcLinkedList_CursorHasNext} and {@link parcLinkedList_CursorNext}.
+ *
+ * Example:
+ * @code
+ * {
+ *    PARCCursor cursor = parcLinkedList_Cursor(list);
+ *
+ *    while (parcLinkedList_CursorHasNext(&cursor)) {
+ *        PARCObject *object = parcLinkedList_CursorNext(&cursor);
+ *    }
+ * }
+ * @endcode
+ */
+PARCCursor parcLinkedList_Cursor(const PARCLinkedList *list);
+
+/**
+ * Return true if a call to {@link parcLinkedList_CursorNext} would return an element.
+ *
+ * @param [in] cursor A pointer to a `PARCCursor` initialised by {@link parcLinkedList_Cursor}.
+ *
+ * @return true There are more elements.
+ * @return false There are no more elements.
+ */
+bool parcLinkedList_CursorHasNext(const PARCCursor *cursor);
+
+/**
+ * Advance the cursor and return the next element of the list.
+ *
+ * If there are no remaining elements, this function induces a trapOutOfBounds.
+ *
+ * @param [in,out] cursor A pointer to a `PARCCursor` initialised by {@link parcLinkedList_Cursor}.
+ *
+ * @return The next element of the list.
+ */
+PARCObject *parcLinkedList_CursorNext(PARCCursor *cursor);
+
+/**
+ * Execute the following statement once for each element of the given `PARCLinkedList`,
+ * assigning each element in turn to the variable @p _element_.
+ *
+ * @param [in] _list_ A pointer to a valid `PARCLinkedList`.
+ * @param [out] _element_ An lvalue that is assigned each element in turn.
+ *
+ * Example:
+ * @code
+ * {
+ *    PARCBuffer *buffer;
+ *    parcLinkedList_ForEach(list, buffer) {
+ *        parcBuffer_Display(buffer, 0);
+ *    }
+ * }
+ * @endcode
+ */
+#define parcLinkedList_ForEach(_list_, _element_) \
+    for (PARCCursor _parcCursor = parcLinkedList_Cursor(_list_); \
+         parcLinkedList_CursorHasNext(&_parcCursor) && ((_element_ = parcLinkedList_CursorNext(&_parcCursor)), true); )
+
 /**
  * Acquire a new reference to an instance of `PARCLinkedList`.
  *
@@ -69,6 +69,39 @@ parcOutputStream_Write(PARCOutputStream *stream, PARCBuffer *buffer)
     return (stream->interface->Write)(stream->instance, buffer);
 }
 
+size_t
+parcOutputStream_WriteBufferChain(PARCOutputStream *stream, PARCBufferChain *chain)
+{
+    if (stream->interface->WriteBufferChain != NULL) {
+        return (stream->interface->WriteBufferChain)(stream->instance, chain);
+    }
+
+    // Write each segment in turn, measuring progress by how far Write advanced the segment's position.
+    size_t result = 0;
+    while (parcBufferChain_GetSegmentCount(chain) > 0) {
+        PARCBuffer *segment = parcBufferChain_GetSegment(chain, 0);
+        size_t position = parcBuffer_Position(segment);
+        (stream->interface->Write)(stream->instance, segment);
+        size_t written = parcBuffer_Position(segment) - position;
+        if (written == 0) {
+            break;
+        }
+        parcBuffer_SetPosition(segment, position);
+        parcBufferChain_Consume(chain, written);
+        result += written;
+    }
+    return result;
+}
+
+bool
+parcOutputStream_Flush(PARCOutputStream *stream)
+{
+    if (stream->interface->Flush != NULL) {
+        return (stream->interface->Flush)(stream->instance);
+    }
+    return true;
+}
+
 size_t
 parcOutputStream_WriteCStrings(PARCOutputStream *stream, ...)
 {
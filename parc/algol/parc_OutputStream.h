@@ -39,6 +39,7 @@
 #define libparc_parc_OutputStream_h
 
 #include <parc/algol/parc_Buffer.h>
+#include <parc/algol/parc_BufferChain.h>
 
 struct parc_output_stream;
 typedef struct parc_output_stream PARCOutputStream;
@@ -49,6 +50,18 @@ typedef struct parc_output_stream_interface {
     PARCOutputStream *(*Acquire)(PARCOutputStream * stream);
 
     void (*Release)(PARCOutputStream **streamPtr);
+
+    /**
+     * Optional. Write every byte of a `PARCBufferChain`, consuming the chain as it is written.
+     * If NULL, {@link parcOutputStream_WriteBufferChain} writes each segment with `Write`.
+     */
+    size_t (*WriteBufferChain)(PARCOutputStream *stream, PARCBufferChain *chain);
+
+    /**
+     * Optional. Pass any bytes the stream holds on to its destination.
+     * If NULL, the stream holds no bytes and {@link parcOutputStream_Flush} does nothing.
+     */
+    bool (*Flush)(PARCOutputStream *stream);
 } PARCOutputStreamInterface;
 
 /**
@@ -97,6 +110,51 @@ PARCOutputStream *parcOutputStream_Create(void *instance, const PARCOutputStream
  */
 size_t parcOutputStream_Write(PARCOutputStream *stream, PARCBuffer *buffer);
 
+/**
+ * Write the contents of the given `PARCBufferChain` to the output stream.
+ *
+ * Streams that support it (e.g. `PARCFileOutputStream`) emit the whole chain with `writev(2)`,
+ * without first copying the segments into one contiguous buffer.
+ * The chain is consumed as a side-effect: the bytes written are removed from it.
+ *
+ * @param [in] stream A pointer to a valid `PARCOutputStream` instance.
+ * @param [in,out] chain A pointer to the `PARCBufferChain` whose contents should be written to @p stream.
+ * @return The number of bytes written
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCBufferChain *message = parcBufferChain_Create();
+ *     parcBufferChain_Append(message, header);
+ *     parcBufferChain_Append(message, payload);
+ *     parcOutputStream_WriteBufferChain(output, message);
+ *     parcBufferChain_Release(&message);
+ * }
+ * @endcode
+ */
+size_t parcOutputStream_WriteBufferChain(PARCOutputStream *stream, PARCBufferChain *chain);
+
+/**
+ * Pass any bytes held by the output stream on to its destination.
+ *
+ * Streams that buffer what is written to them (e.g. `PARCBufferedOutputStream`) write out their buffered bytes;
+ * for other streams this does nothing.
+ *
+ * @param [in] stream A pointer to a valid `PARCOutputStream` instance.
+ *
+ * @return true Every byte written to the stream has been passed on.
+ * @return false An error occurred.
+ *
+ * Example:
+ * @code
+ * {
+ *     parcOutputStream_WriteCString(output, "Hello World\n");
+ *     parcOutputStream_Flush(output);
+ * }
+ * @endcode
+ */
+bool parcOutputStream_Flush(PARCOutputStream *stream);
+
 /**
  * Write a nul-terminated C string to the given `PARCOutputStream`.
  *
@@ -43,6 +43,9 @@
 
 struct PARCProperties {
     PARCHashMap *properties;
+
+    // If not NULL, property names are interned in this pool.
+    PARCInternPool *internPool;
 };
 
 static void
@@ -54,6 +57,9 @@ _parcProperties_Finalize(PARCProperties **instancePtr)
     parcProperties_OptionalAssertValid(instance);
 
     parcHashMap_Release(&instance->properties);
+    if (instance->internPool != NULL) {
+        parcInternPool_Release(&instance->internPool);
+    }
 }
 
 parcObject_ImplementAcquire(parcProperties, PARCProperties);
@@ -77,6 +83,21 @@ parcProperties_Create(void)
 
     if (result != NULL) {
         result->properties = parcHashMap_Create();
+        result->internPool = NULL;
+    }
+
+    return result;
+}
+
+PARCProperties *
+parcProperties_CreateWithInternPool(PARCInternPool *pool)
+{
+    parcInternPool_OptionalAssertValid(pool);
+
+    PARCProperties *result = parcProperties_Create();
+
+    if (result != NULL) {
+        result->internPool = parcInternPool_Acquire(pool);
     }
 
     return result;
@@ -98,6 +119,7 @@ parcProperties_Copy(const PARCProperties *original)
 
     if (result != NULL) {
         result->properties = parcHashMap_Copy(original->properties);
+        result->internPool = (original->internPool == NULL) ? NULL : parcInternPool_Acquire(original->internPool);
     }
 
     return result;
@@ -109,17 +131,13 @@ parcProperties_Display(const PARCProperties *properties, int indentation)
     parcDisplayIndented_PrintLine(indentation, "PARCProperties@%p {", properties);
     trapCannotObtainLockIf(parcHashMap_Lock(properties->properties) == false, "Cannot lock PARCProperties object.");
 
-    PARCIterator *iterator = parcHashMap_CreateKeyIterator(properties->properties);
-    while (parcIterator_HasNext(iterator)) {
-        char *key = parcBuffer_ToString(parcIterator_Next(iterator));
-        const char *value = parcProperties_GetProperty(properties, key);
+    PARCCursor cursor = parcProperties_Cursor(properties);
+    while (parcProperties_CursorHasNext(&cursor)) {
+        const char *value;
+        const char *key = parcProperties_CursorNextProperty(&cursor, &value);
         parcDisplayIndented_PrintLine(indentation + 1, "%s=%s", key, value);
-
-        parcMemory_Deallocate(&key);
     }
 
-    parcIterator_Release(&iterator);
-
     parcHashMap_Unlock(properties->properties);
 
     parcDisplayIndented_PrintLine(indentation, "}");
@@ -166,16 +184,13 @@ parcProperties_ToJSON(const PARCProperties *properties)
 
     trapCannotObtainLockIf(parcHashMap_Lock(properties->properties) == false, "Cannot lock PARCProperties object.");
 
-    PARCIterator *iterator = parcHashMap_CreateKeyIterator(properties->properties);
-    while (parcIterator_HasNext(iterator)) {
-        char *key = parcBuffer_ToString(parcIterator_Next(iterator));
-        const char *value = parcProperties_GetProperty(properties, key);
+    PARCCursor cursor = parcProperties_Cursor(properties);
+    while (parcProperties_CursorHasNext(&cursor)) {
+        const char *value;
+        const char *key = parcProperties_CursorNextProperty(&cursor, &value);
         parcJSON_AddString(result, key, value);
-        parcMemory_Deallocate(&key);
     }
 
-    parcIterator_Release(&iterator);
-
     parcHashMap_Unlock(properties->properties);
     return result;
 }
@@ -185,16 +200,13 @@ parcProperties_BuildString(const PARCProperties *properties, PARCBufferComposer
 {
     trapCannotObtainLockIf(parcHashMap_Lock(properties->properties) == false, "Cannot lock PARCProperties object.");
 
-    PARCIterator *iterator = parcHashMap_CreateKeyIterator(properties->properties);
-    while (parcIterator_HasNext(iterator)) {
-        char *key = parcBuffer_ToString(parcIterator_Next(iterator));
-        const char *value = parcProperties_GetProperty(properties, key);
+    PARCCursor cursor = parcProperties_Cursor(properties);
+    while (parcProperties_CursorHasNext(&cursor)) {
+        const char *value;
+        const char *key = parcProperties_CursorNextProperty(&cursor, &value);
         parcBufferComposer_PutStrings(composer, key, "=", value, "\n", NULL);
-        parcMemory_Deallocate(&key);
     }
 
-    parcIterator_Release(&iterator);
-
     parcHashMap_Unlock(properties->properties);
     return composer;
 }
@@ -228,7 +240,14 @@ parcProperties_SetProperty(PARCProperties *properties, const char *name, const c
     PARCBuffer *key = parcBuffer_AllocateCString(name);
     PARCBuffer *value = parcBuffer_AllocateCString(string);
 
-    parcHashMap_Put(properties->properties, key, value);
+    if (properties->internPool != NULL) {
+        PARCBuffer *interned = parcInternPool_InternBuffer(properties->internPool, key);
+        parcBuffer_Release(&key);
+        key = interned;
+        parcHashMap_PutShared(properties->properties, key, value);
+    } else {
+        parcHashMap_Put(properties->properties, key, value);
+    }
     parcBuffer_Release(&key);
     parcBuffer_Release(&value);
     return result;
@@ -353,3 +372,32 @@ parcProperties_CreateIterator(const PARCProperties *properties)
 
     return iterator;
 }
+
+PARCCursor
+parcProperties_Cursor(const PARCProperties *properties)
+{
+    return parcHashMap_Cursor(properties->properties);
+}
+
+bool
+parcProperties_CursorHasNext(const PARCCursor *cursor)
+{
+    return parcHashMap_CursorHasNext(cursor);
+}
+
+const char *
+parcProperties_CursorNext(PARCCursor *cursor)
+{
+    return parcBuffer_Overlay(parcHashMap_CursorNextKey(cursor), 0);
+}
+
+const char *
+parcProperties_CursorNextProperty(PARCCursor *cursor, const char **valuePtr)
+{
+    PARCObject *key;
+    PARCObject *value;
+    parcHashMap_CursorNext(cursor, &key, &value);
+
+    *valuePtr = parcBuffer_Overlay((PARCBuffer *) value, 0);
+    return parcBuffer_Overlay((PARCBuffer *) key, 0);
+}
@@ -40,6 +40,7 @@
 #include <parc/algol/parc_JSON.h>
 #include <parc/algol/parc_HashCode.h>
 #include <parc/algol/parc_Iterator.h>
+#include <parc/algol/parc_InternPool.h>
 
 struct PARCProperties;
 typedef struct PARCProperties PARCProperties;
@@ -112,6 +113,34 @@ void parcProperties_AssertValid(const PARCProperties *instance);
  */
 PARCProperties *parcProperties_Create(void);
 
+/**
+ * Create an instance of PARCProperties whose property names are interned in the given `PARCInternPool`.
+ *
+ * Instances created from the same pool share a single copy of each property name.
+ *
+ * @param [in] pool A pointer to a valid PARCInternPool instance.
+ *
+ * @return non-NULL A pointer to a valid PARCProperties instance.
+ * @return NULL An error occurred.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCInternPool *pool = parcInternPool_Create();
+ *     PARCProperties *a = parcProperties_CreateWithInternPool(pool);
+ *     PARCProperties *b = parcProperties_CreateWithInternPool(pool);
+ *
+ *     parcProperties_SetProperty(a, "host", "alpha");
+ *     parcProperties_SetProperty(b, "host", "beta");
+ *
+ *     parcProperties_Release(&a);
+ *     parcProperties_Release(&b);
+ *     parcInternPool_Release(&pool);
+ * }
+ * @endcode
+ */
+PARCProperties *parcProperties_CreateWithInternPool(PARCInternPool *pool);
+
 /**
  * Compares @p instance with @p other for order.
  *
@@ -511,4 +540,97 @@ int64_t parcProperties_GetAsInteger(const PARCProperties *properties, const char
  * @endcode
  */
 PARCIterator *parcProperties_CreateIterator(const PARCProperties *properties);
+
+/**
+ * Create a `PARCCursor` positioned before the first property name of the given `PARCProperties`.
+ *
+ * The cursor is returned by value and requires no allocation or release.
+ * The properties must not be modified while the cursor is in use.
+ *
+ * @param [in] properties A pointer to a valid `PARCProperties`.
+ *
+ * @return A `PARCCursor` for use with {@link parcProperties_CursorHasNext} and {@link parcProperties_CursorNext}.
+ *
+ * Example:
+ * @code
+ * {
+ *    PARCCursor cursor = parcProperties_Cursor(properties);
+ *
+ *    while (parcProperties_CursorHasNext(&cursor)) {
+ *        const char *name = parcProperties_CursorNext(&cursor);
+ *    }
+ * }
+ * @endcode
+ */
+PARCCursor parcProperties_Cursor(const PARCProperties *properties);
+
+/**
+ * Return true if a call to {@link parcProperties_CursorNext} or {@link parcProperties_CursorNextProperty}
+ * would return a property.
+ *
+ * @param [in] cursor A pointer to a `PARCCursor` initialised by {@link parcProperties_Cursor}.
+ *
+ * @return true There are more property names.
+ * @return false There are no more property names.
+ */
+bool parcProperties_CursorHasNext(const PARCCursor *cursor);
+
+/**
+ * Advance the cursor and return the next property name.
+ *
+ * If there are no remaining properties, this function induces a trapOutOfBounds.
+ *
+ * @param [in,out] cursor A pointer to a `PARCCursor` initialised by {@link parcProperties_Cursor}.
+ *
+ * @return The nul-terminated name of the next property.
+ */
+const char *parcProperties_CursorNext(PARCCursor *cursor);
+
+/**
+ * Advance the cursor and return both the name and the value of the next property.
+ *
+ * Unlike calling {@link parcProperties_GetProperty} with the name returned by {@link parcProperties_CursorNext},
+ * this performs no allocation or lookup.
+ * If there are no remaining properties, this function induces a trapOutOfBounds.
+ *
+ * @param [in,out] cursor A pointer to a `PARCCursor` initialised by {@link parcProperties_Cursor}.
+ * @param [out] valuePtr Set to the nul-terminated value of the next property.
+ *
+ * @return The nul-terminated name of the next property.
+ *
+ * Example:
+ * @code
+ * {
+ *    PARCCursor cursor = parcProperties_Cursor(properties);
+ *
+ *    while (parcProperties_CursorHasNext(&cursor)) {
+ *        const char *value;
+ *        const char *name = parcProperties_CursorNextProperty(&cursor, &value);
+ *        printf("%s=%s\n", name, value);
+ *    }
+ * }
+ * @endcode
+ */
+const char *parcProperties_CursorNextProperty(PARCCursor *cursor, const char **valuePtr);
+
+/**
+ * Execute the following statement once for each property name in the given `PARCProperties`,
+ * assigning each name in turn to the variable @p _name_.
+ *
+ * @param [in] _properties_ A pointer to a valid `PARCProperties`.
+ * @param [out] _name_ An lvalue of type `const char *` that is assigned each property name in turn.
+ *
+ * Example:
+ * @code
+ * {
+ *    const char *name;
+ *    parcProperties_ForEach(properties, name) {
+ *        printf("%s=%s\n", name, parcProperties_GetProperty(properties, name));
+ *    }
+ * }
+ * @endcode
+ */
+#define parcProperties_ForEach(_properties_, _name_) \
+    for (PARCCursor _parcCursor = parcProperties_Cursor(_properties_); \
+         parcProperties_CursorHasNext(&_parcCursor) && ((_name_ = parcProperties_CursorNext(&_parcCursor)), true); )
 #endif
@@ -37,6 +37,15 @@
 #include <parc/algol/parc_RandomAccessFile.h>
 
 #include <stdio.h>
+#include <errno.h>
+#include <unistd.h>
+
+#ifdef __linux__
+#include <sys/sendfile.h>
+#else
+// Without sendfile(2), parcRandomAccessFile_SendAt copies through a stack buffer of this size.
+#define _parcRandomAccessFile_SendChunkSize 16384
+#endif
 
 struct PARCRandomAccessFile {
     char *fname;
@@ -177,6 +186,124 @@ parcRandomAccessFile_Write(PARCRandomAccessFile *fileHandle, PARCBuffer *buffer)
     return numBytes;
 }
 
+ssize_t
+parcRandomAccessFile_ReadAt(PARCRandomAccessFile *fileHandle, PARCBuffer *buffer, uint64_t offset)
+{
+    parcRandomAccessFile_OptionalAssertValid(fileHandle);
+
+    int fd = fileno(fileHandle->fhandle);
+    size_t length = parcBuffer_Remaining(buffer);
+    if (length == 0) {
+        return 0;
+    }
+    uint8_t *bytes = parcBuffer_Overlay(buffer, 0);
+
+    size_t total = 0;
+    while (total < length) {
+        ssize_t nread = pread(fd, &bytes[total], length - total, (off_t) (offset + total));
+        if (nread < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            if (total == 0) {
+                return -1;
+            }
+            break;
+        }
+        if (nread == 0) {
+            break;
+        }
+        total += nread;
+    }
+    parcBuffer_SetPosition(buffer, parcBuffer_Position(buffer) + total);
+    return (ssize_t) total;
+}
+
+ssize_t
+parcRandomAccessFile_WriteAt(PARCRandomAccessFile *fileHandle, PARCBuffer *buffer, uint64_t offset)
+{
+    parcRandomAccessFile_OptionalAssertValid(fileHandle);
+
+    int fd = fileno(fileHandle->fhandle);
+    size_t length = parcBuffer_Remaining(buffer);
+    if (length == 0) {
+        return 0;
+    }
+    const uint8_t *bytes = parcBuffer_Overlay(buffer, 0);
+
+    size_t total = 0;
+    while (total < length) {
+        ssize_t nwritten = pwrite(fd, &bytes[total], length - total, (off_t) (offset + total));
+        if (nwritten < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            if (total == 0) {
+                return -1;
+            }
+            break;
+        }
+        total += nwritten;
+    }
+    parcBuffer_SetPosition(buffer, parcBuffer_Position(buffer) + total);
+    return (ssize_t) total;
+}
+
+int
+parcRandomAccessFile_GetFileDescriptor(const PARCRandomAccessFile *fileHandle)
+{
+    parcRandomAccessFile_OptionalAssertValid(fileHandle);
+
+    return fileno(fileHandle->fhandle);
+}
+
+ssize_t
+parcRandomAccessFile_SendAt(PARCRandomAccessFile *fileHandle, int fileDescriptor, uint64_t offset, size_t length)
+{
+    parcRandomAccessFile_OptionalAssertValid(fileHandle);
+
+    int fd = fileno(fileHandle->fhandle);
+    if (length == 0) {
+        return 0;
+    }
+
+    size_t total = 0;
+    while (total < length) {
+#ifdef __linux__
+        // The kernel copies straight from the page cache to the destination.
+        off_t position = (off_t) (offset + total);
+        ssize_t nsent = sendfile(fileDescriptor, fd, &position, length - total);
+#else
+        uint8_t chunk[_parcRandomAccessFile_SendChunkSize];
+        size_t chunkLength = length - total < sizeof(chunk) ? length - total : sizeof(chunk);
+        ssize_t nsent = pread(fd, chunk, chunkLength, (off_t) (offset + total));
+        if (nsent > 0) {
+            ssize_t nread = nsent;
+            nsent = write(fileDescriptor, chunk, (size_t) nread);
+            if (nsent >= 0 && nsent < nread) {
+                // The destination is full: report what it took and let the caller wait for it to drain.
+                total += nsent;
+                break;
+            }
+        }
+#endif
+        if (nsent < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            if (total == 0) {
+                return -1;
+            }
+            break;
+        }
+        if (nsent == 0) {
+            break;
+        }
+        total += nsent;
+    }
+    return (ssize_t) total;
+}
+
 size_t
 parcRandomAccessFile_Seek(PARCRandomAccessFile *fileHandle, long offset, PARCRandomAccessFilePosition position)
 {
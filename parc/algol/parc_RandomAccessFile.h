@@ -34,6 +34,7 @@
 #ifndef PARCLibrary_RandomAccessFile
 #define PARCLibrary_RandomAccessFile
 #include <stdbool.h>
+#include <sys/types.h>
 
 #include <parc/algol/parc_JSON.h>
 #include <parc/algol/parc_HashCode.h>
@@ -402,6 +403,118 @@ size_t parcRandomAccessFile_Read(PARCRandomAccessFile *fileHandle, PARCBuffer *b
  */
 size_t parcRandomAccessFile_Write(PARCRandomAccessFile *fileHandle, PARCBuffer *buffer);
 
+/**
+ * Read bytes at @p offset in the file into the provided `PARCBuffer`, until the buffer limit or the end of the file
+ * is reached.
+ *
+ * Unlike `parcRandomAccessFile_Read`, this neither uses nor moves the file's position,
+ * so any number of threads may read from the same `PARCRandomAccessFile` at once.
+ * The buffer's position is advanced past the bytes read.
+ *
+ * Data written by `parcRandomAccessFile_Write` may remain in the file's stdio buffer, unseen by this function,
+ * until the file is sought or closed.
+ *
+ * @param [in] fileHandle A `PARCRandomAccessFile` from which to read.
+ * @param [in,out] buffer A `PARCBuffer` into which data is read.
+ * @param [in] offset The offset in the file of the first byte to read.
+ *
+ * @return The number of bytes read, which is less than the buffer's remaining bytes only at the end of the file.
+ * @return -1 An error occurred before any bytes were read; `errno` is set.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCBuffer *buffer = parcBuffer_Allocate(4096);
+ *     ssize_t numBytes = parcRandomAccessFile_ReadAt(handle, buffer, 8192);
+ *     parcBuffer_Flip(buffer);
+ * }
+ * @endcode
+ *
+ * @see parcRandomAccessFile_WriteAt
+ */
+ssize_t parcRandomAccessFile_ReadAt(PARCRandomAccessFile *fileHandle, PARCBuffer *buffer, uint64_t offset);
+
+/**
+ * Write the remaining bytes of the provided `PARCBuffer` at @p offset in the file.
+ *
+ * Unlike `parcRandomAccessFile_Write`, this neither uses nor moves the file's position,
+ * so any number of threads may write to the same `PARCRandomAccessFile` at once.
+ * The buffer's position is advanced past the bytes written.
+ *
+ * @param [in] fileHandle A `PARCRandomAccessFile` to which data is written.
+ * @param [in,out] buffer A `PARCBuffer` whose remaining bytes are written.
+ * @param [in] offset The offset in the file at which to write the first byte.
+ *
+ * @return The number of bytes written.
+ * @return -1 An error occurred before any bytes were written; `errno` is set.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCBuffer *buffer = parcBuffer_WrapCString("important data to go in the file");
+ *     ssize_t numBytes = parcRandomAccessFile_WriteAt(handle, buffer, 8192);
+ * }
+ * @endcode
+ *
+ * @see parcRandomAccessFile_ReadAt
+ */
+ssize_t parcRandomAccessFile_WriteAt(PARCRandomAccessFile *fileHandle, PARCBuffer *buffer, uint64_t offset);
+
+/**
+ * Get the operating system file descriptor of the given `PARCRandomAccessFile`.
+ *
+ * The descriptor remains owned by the `PARCRandomAccessFile` and is closed by `parcRandomAccessFile_Close`.
+ *
+ * @param [in] fileHandle A pointer to a valid `PARCRandomAccessFile` instance.
+ *
+ * @return The file descriptor of the open file.
+ *
+ * Example:
+ * @code
+ * {
+ *     struct stat statbuf;
+ *     fstat(parcRandomAccessFile_GetFileDescriptor(handle), &statbuf);
+ * }
+ * @endcode
+ */
+int parcRandomAccessFile_GetFileDescriptor(const PARCRandomAccessFile *fileHandle);
+
+/**
+ * Send up to @p length bytes at @p offset in the file to the given file descriptor, typically a socket.
+ *
+ * On Linux the bytes are transferred by `sendfile(2)` from the page cache to the destination
+ * without being copied into user space. Elsewhere they are copied through a small stack buffer.
+ * Like `parcRandomAccessFile_ReadAt`, this neither uses nor moves the file's position.
+ *
+ * If @p fileDescriptor is non-blocking, fewer than @p length bytes may be sent when it cannot take more.
+ * The caller resumes the transfer at `offset + result` once the descriptor is writable again,
+ * for example from a `PARCEvent` of type `PARCEventType_Write`.
+ *
+ * @param [in] fileHandle A `PARCRandomAccessFile` from which to send.
+ * @param [in] fileDescriptor The file descriptor to which the bytes are written.
+ * @param [in] offset The offset in the file of the first byte to send.
+ * @param [in] length The number of bytes to send.
+ *
+ * @return The number of bytes sent, which is less than @p length at the end of the file or when the destination is full.
+ * @return -1 An error occurred before any bytes were sent; `errno` is set, to `EAGAIN` if the destination is full.
+ *
+ * Example:
+ * @code
+ * {
+ *     ssize_t numBytes = parcRandomAccessFile_SendAt(handle, socket, offset, remaining);
+ *     if (numBytes > 0) {
+ *         offset += numBytes;
+ *         remaining -= numBytes;
+ *     } else if (numBytes < 0 && errno == EAGAIN) {
+ *         // wait for the socket to become writable, then call again
+ *     }
+ * }
+ * @endcode
+ *
+ * @see parcEventQueue_WriteFile
+ */
+ssize_t parcRandomAccessFile_SendAt(PARCRandomAccessFile *fileHandle, int fileDescriptor, uint64_t offset, size_t length);
+
 /**
  * Seek to the position in the file specified as an offset from the position.
  *
@@ -116,7 +116,8 @@ parcReadOnlyBuffer_Copy(const PARCReadOnlyBuffer *original)
     PARCReadOnlyBuffer *result = parcObject_CreateInstance(PARCReadOnlyBuffer);
 
     if (result != NULL) {
-        result->buffer = parcBuffer_Copy(original->buffer);
+        // Nothing else can reach the copied content, so it can be frozen: copies of the copy then share it.
+        result->buffer = parcBuffer_Freeze(parcBuffer_Copy(original->buffer));
     }
     return result;
 }
@@ -607,7 +607,7 @@ parcSafeMemory_Reallocate(void *original, size_t newSize)
         _MemoryPrefix *prefix = _parcSafeMemory_GetPrefix(original);
         size_t originalSize = prefix->requestedLength;
 
-        memcpy(result, original, originalSize);
+        memcpy(result, original, (originalSize < newSize) ? originalSize : newSize);
         parcSafeMemory_Deallocate(&original);
     }
     return result;
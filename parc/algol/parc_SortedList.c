@@ -89,6 +89,32 @@ parcSortedList_CreateCompare(PARCSortedListEntryCompareFunction compare)
     return result;
 }
 
+PARCSortedList *
+parcSortedList_CreateFromSorted(PARCSortedListEntryCompareFunction compare, const PARCArrayList *elements)
+{
+    assertNotNull(elements, "The list of elements must be a non-null pointer.");
+
+    if (compare == NULL) {
+        compare = parcObject_Compare;
+    }
+
+    PARCSortedList *result = parcSortedList_CreateCompare(compare);
+
+    if (result != NULL) {
+        size_t count = parcArrayList_Size(elements);
+        for (size_t i = 0; i < count; i++) {
+            PARCObject *element = parcArrayList_Get(elements, i);
+            if (i > 0) {
+                trapIllegalValueIf(compare(parcArrayList_Get(elements, i - 1), element) > 0,
+                                   "Elements must be in ascending order: element %zu is less than element %zu", i, i - 1);
+            }
+            parcLinkedList_Append(result->list, element);
+        }
+    }
+
+    return result;
+}
+
 PARCSortedList *
 parcSortedList_Copy(const PARCSortedList *original)
 {
@@ -226,6 +252,24 @@ parcSortedList_CreateIterator(PARCSortedList *instance)
     return parcLinkedList_CreateIterator(instance->list);
 }
 
+PARCCursor
+parcSortedList_Cursor(const PARCSortedList *instance)
+{
+    return parcLinkedList_Cursor(instance->list);
+}
+
+bool
+parcSortedList_CursorHasNext(const PARCCursor *cursor)
+{
+    return parcLinkedList_CursorHasNext(cursor);
+}
+
+PARCObject *
+parcSortedList_CursorNext(PARCCursor *cursor)
+{
+    return parcLinkedList_CursorNext(cursor);
+}
+
 void
 parcSortedList_Add(PARCSortedList *instance, PARCObject *element)
 {
@@ -40,6 +40,7 @@
 #include <parc/algol/parc_JSON.h>
 #include <parc/algol/parc_HashCode.h>
 #include <parc/algol/parc_Iterator.h>
+#include <parc/algol/parc_ArrayList.h>
 
 struct PARCSortedList;
 typedef struct PARCSortedList PARCSortedList;
@@ -135,6 +136,35 @@ PARCSortedList *parcSortedList_Create(void);
  */
 PARCSortedList *parcSortedList_CreateCompare(PARCSortedListEntryCompareFunction compare);
 
+/**
+ * Create an instance of PARCSortedList from a list of elements that are already in sorted order.
+ *
+ * The elements are appended in O(n) time rather than each being located and inserted with {@link parcSortedList_Add}.
+ * The elements must be in ascending order according to `compare`; an out of order element is trapped.
+ * Each element is acquired by the new PARCSortedList.
+ *
+ * @param [in] compare A pointer to a function that implements the Compare contract, or NULL to use parcObject_Compare.
+ * @param [in] elements A pointer to a `PARCArrayList` of PARCObject instances in ascending order.
+ *
+ * @return non-NULL A pointer to a valid PARCSortedList instance.
+ * @return NULL An error occurred.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCArrayList *elements = parcArrayList_Create((void (*)(void **))parcObject_Release);
+ *     ...
+ *     parcArrayList_Sort(elements, parcObject_Compare);
+ *
+ *     PARCSortedList *a = parcSortedList_CreateFromSorted(NULL, elements);
+ *     parcArrayList_Destroy(&elements);
+ *
+ *     parcSortedList_Release(&a);
+ * }
+ * @endcode
+ */
+PARCSortedList *parcSortedList_CreateFromSorted(PARCSortedListEntryCompareFunction compare, const PARCArrayList *elements);
+
 /**
  * Create an independent copy the given `PARCBuffer`
  *
@@ -472,6 +502,61 @@ parcObject_ImplementIsLocked(parcSortedList, PARCSortedList);
 
 PARCIterator *parcSortedList_CreateIterator(PARCSortedList *instance);
 
+/**
+ * Create a `PARCCursor` positioned before the first (least) element of the given `PARCSortedList`.
+ *
+ * The cursor is returned by value and requires no allocation or release.
+ * The list must not be modified while the cursor is in use.
+ *
+ * @param [in] instance A pointer to a valid `PARCSortedList`.
+ *
+ * @return A `PARCCursor` for use with {@link parcSortedList_CursorHasNext} and {@link parcSortedList_CursorNext}.
+ *
+ * Example:
+ * @code
+ * {
+ *    PARCCursor cursor = parcSortedList_Cursor(list);
+ *
+ *    while (parcSortedList_CursorHasNext(&cursor)) {
+ *        PARCObject *object = parcSortedList_CursorNext(&cursor);
+ *    }
+ * }
+ * @endcode
+ */
+PARCCursor parcSortedList_Cursor(const PARCSortedList *instance);
+
+/**
+ * Return true if a call to {@link parcSortedList_CursorNext} would return an element.
+ *
+ * @param [in] cursor A pointer to a `PARCCursor` initialised by {@link parcSortedList_Cursor}.
+ *
+ * @return true There are more elements.
+ * @return false There are no more elements.
+ */
+bool parcSortedList_CursorHasNext(const PARCCursor *cursor);
+
+/**
+ * Advance the cursor and return the next element of the list in sorted order.
+ *
+ * If there are no remaining elements, this function induces a trapOutOfBounds.
+ *
+ * @param [in,out] cursor A pointer to a `PARCCursor` initialised by {@link parcSortedList_Cursor}.
+ *
+ * @return The next element of the list.
+ */
+PARCObject *parcSortedList_CursorNext(PARCCursor *cursor);
+
+/**
+ * Execute the following statement once for each element of the given `PARCSortedList`, in sorted order,
+ * assigning each element in turn to the variable @p _element_.
+ *
+ * @param [in] _list_ A pointer to a valid `PARCSortedList`.
+ * @param [out] _element_ An lvalue that is assigned each element in turn.
+ */
+#define parcSortedList_ForEach(_list_, _element_) \
+    for (PARCCursor _parcCursor = parcSortedList_Cursor(_list_); \
+         parcSortedList_CursorHasNext(&_parcCursor) && ((_element_ = parcSortedList_CursorNext(&_parcCursor)), true); )
+
 void parcSortedList_Add(PARCSortedList *instance, PARCObject *element);
 
 size_t parcSortedList_Size(const PARCSortedList *list);
@@ -33,11 +33,15 @@
 #include <parc/algol/parc_Memory.h>
 #include <parc/algol/parc_Object.h>
 #include <parc/algol/parc_DisplayIndented.h>
+#include <parc/algol/parc_UTF8.h>
 
 #include <parc/algol/parc_String.h>
 
 struct PARCString {
     char *string;
+
+    // A PARCString is immutable, so its hash code is computed once when it is created.
+    PARCHashCode hashCode;
 };
 
 static void
@@ -69,7 +73,9 @@ parcString_Create(const char *string)
 {
     PARCString *result = parcObject_CreateInstance(PARCString);
     if (result != NULL) {
-        result->string = parcMemory_StringDuplicate(string, strlen(string));
+        size_t length = strlen(string);
+        result->string = parcMemory_StringDuplicate(string, length);
+        result->hashCode = parcHashCode_Hash((uint8_t *) result->string, length);
     }
     return result;
 }
@@ -137,7 +143,7 @@ parcString_Equals(const PARCString *x, const PARCString *y)
         parcString_OptionalAssertValid(x);
         parcString_OptionalAssertValid(y);
 
-        result = strcmp(x->string, y->string) == 0;
+        result = x->hashCode == y->hashCode && strcmp(x->string, y->string) == 0;
     }
 
     return result;
@@ -146,11 +152,7 @@ parcString_Equals(const PARCString *x, const PARCString *y)
 PARCHashCode
 parcString_HashCode(const PARCString *string)
 {
-    PARCHashCode result = 0;
-
-    result = parcHashCode_Hash((uint8_t *) string->string, strlen(string->string));
-
-    return result;
+    return string->hashCode;
 }
 
 bool
@@ -167,6 +169,14 @@ parcString_IsValid(const PARCString *string)
     return result;
 }
 
+bool
+parcString_IsValidUTF8(const PARCString *string)
+{
+    parcString_OptionalAssertValid(string);
+
+    return parcUTF8_IsValid(strlen(string->string), (const uint8_t *) string->string);
+}
+
 PARCJSON *
 parcString_ToJSON(const PARCString *string)
 {
@@ -38,12 +38,12 @@
 #include <stdbool.h>
 #include <string.h>
 
-#include <parc/algol/parc_JSON.h>
-#include <parc/algol/parc_HashCode.h>
-
 struct PARCString;
 typedef struct PARCString PARCString;
 
+#include <parc/algol/parc_JSON.h>
+#include <parc/algol/parc_HashCode.h>
+
 /**
  * Increase the number of references to a `PARCString` instance.
  *
@@ -311,6 +311,33 @@ PARCHashCode parcString_HashCode(const PARCString *instance);
  */
 bool parcString_IsValid(const PARCString *instance);
 
+/**
+ * Determine if the value of a `PARCString` is well-formed UTF-8.
+ *
+ * Overlong encodings, surrogates, code points above U+10FFFF and truncated sequences are not well-formed.
+ *
+ * @param [in] string A pointer to a valid PARCString instance.
+ *
+ * @return true The value of the string is well-formed UTF-8.
+ * @return false The value of the string is not well-formed UTF-8.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCString *a = parcString_Create("caf\xC3\xA9");
+ *
+ *     if (parcString_IsValidUTF8(a)) {
+ *         printf("Instance is valid UTF-8.\n");
+ *     }
+ *
+ *     parcString_Release(&a);
+ * }
+ * @endcode
+ *
+ * @see parcUTF8_IsValid
+ */
+bool parcString_IsValidUTF8(const PARCString *string);
+
 /**
  * Release a previously acquired reference to the given `PARCString` instance,
  * decrementing the reference count for the instance.
@@ -612,6 +612,72 @@ parcTreeMap_Create(void)
     return parcTreeMap_CreateCustom(NULL);
 }
 
+static int
+_parcTreeMap_CompareKeys(PARCTreeMap_CustomCompare *customCompare, const PARCObject *key1, const PARCObject *key2)
+{
+    return (customCompare != NULL) ? customCompare(key1, key2) : parcObject_Compare(key1, key2);
+}
+
+/*
+ * Build a perfectly balanced subtree from the entries in the range [start, end).
+ * Every root-to-leaf path differs in length by at most one,
+ * so colouring only the nodes on the deepest (possibly incomplete) level red
+ * gives every path the same number of black nodes.
+ */
+static _RBNode *
+_rbBuildFromSorted(PARCTreeMap *tree, const PARCArrayList *keyValues, size_t start, size_t end,
+                   _RBNode *parent, size_t depth, size_t redDepth)
+{
+    if (start >= end) {
+        return tree->nil;
+    }
+
+    size_t middle = start + (end - start) / 2;
+    PARCKeyValue *keyValue = parcArrayList_Get(keyValues, middle);
+
+    _RBNode *node = _rbNodeCreate(tree, (depth == redDepth) ? RED : BLACK);
+    node->element = parcKeyValue_Create(parcKeyValue_GetKey(keyValue), parcKeyValue_GetValue(keyValue));
+    node->parent = parent;
+    node->leftChild = _rbBuildFromSorted(tree, keyValues, start, middle, node, depth + 1, redDepth);
+    node->rightChild = _rbBuildFromSorted(tree, keyValues, middle + 1, end, node, depth + 1, redDepth);
+
+    return node;
+}
+
+PARCTreeMap *
+parcTreeMap_CreateFromSorted(PARCTreeMap_CustomCompare *customCompare, const PARCArrayList *keyValues)
+{
+    assertNotNull(keyValues, "The list of PARCKeyValue entries can't be NULL");
+
+    size_t count = parcArrayList_Size(keyValues);
+    for (size_t i = 1; i < count; i++) {
+        PARCKeyValue *previous = parcArrayList_Get(keyValues, i - 1);
+        PARCKeyValue *current = parcArrayList_Get(keyValues, i);
+        trapIllegalValueIf(_parcTreeMap_CompareKeys(customCompare,
+                                                    parcKeyValue_GetKey(previous),
+                                                    parcKeyValue_GetKey(current)) >= 0,
+                           "Keys must be in strictly ascending order: entry %zu is not greater than entry %zu", i, i - 1);
+    }
+
+    PARCTreeMap *tree = parcTreeMap_CreateCustom(customCompare);
+
+    if (count > 0) {
+        // The root (depth 0) is always black, so a single node tree has no red level.
+        size_t deepest = 0;
+        for (size_t n = count; n > 1; n >>= 1) {
+            deepest++;
+        }
+        size_t redDepth = (deepest > 0) ? deepest : SIZE_MAX;
+
+        tree->root = _rbBuildFromSorted(tree, keyValues, 0, count, tree->nil, 0, redDepth);
+        tree->size = (int) count;
+    }
+
+    _rbNodeAssertTreeInvariants(tree);
+
+    return tree;
+}
+
 void
 parcTreeMap_Put(PARCTreeMap *tree, const PARCObject *key, const PARCObject *value)
 {
@@ -1131,3 +1197,52 @@ parcTreeMap_CreateKeyValueIterator(PARCTreeMap *treeMap)
 
     return iterator;
 }
+
+////// Cursor Support //////
+
+/*
+ * The cursor position is the next node to be returned, or NULL when the traversal is complete.
+ */
+PARCCursor
+parcTreeMap_Cursor(const PARCTreeMap *tree)
+{
+    PARCCursor result = { .collection = tree, .position = NULL, .index = 0 };
+
+    if (tree->root != tree->nil) {
+        result.position = _rbMinRelativeNode(tree, tree->root);
+    }
+    return result;
+}
+
+bool
+parcTreeMap_CursorHasNext(const PARCCursor *cursor)
+{
+    return cursor->position != NULL;
+}
+
+PARCKeyValue *
+parcTreeMap_CursorNextEntry(PARCCursor *cursor)
+{
+    const PARCTreeMap *tree = cursor->collection;
+    _RBNode *node = cursor->position;
+
+    trapOutOfBoundsIf(node == NULL, "No more elements.");
+
+    _RBNode *next = _rbNextNode(tree, node);
+    cursor->position = (next == tree->nil) ? NULL : next;
+    cursor->index++;
+
+    return node->element;
+}
+
+PARCObject *
+parcTreeMap_CursorNextKey(PARCCursor *cursor)
+{
+    return parcKeyValue_GetKey(parcTreeMap_CursorNextEntry(cursor));
+}
+
+PARCObject *
+parcTreeMap_CursorNextValue(PARCCursor *cursor)
+{
+    return parcKeyValue_GetValue(parcTreeMap_CursorNextEntry(cursor));
+}
@@ -43,6 +43,7 @@
 #include "parc_Object.h"
 #include "parc_KeyValue.h"
 #include "parc_List.h"
+#include "parc_ArrayList.h"
 #include "parc_Iterator.h"
 
 struct parc_treemap;
@@ -118,6 +119,38 @@ PARCTreeMap *parcTreeMap_Create(void);
  */
 PARCTreeMap *parcTreeMap_CreateCustom(PARCTreeMap_CustomCompare *customCompare);
 
+/**
+ * Create a `PARCTreeMap` from a list of `PARCKeyValue` entries already sorted by key.
+ *
+ * The tree is built bottom-up in O(n) time, without the comparisons and rebalancing
+ * that inserting each entry with {@link parcTreeMap_Put} would cost.
+ * The keys must be in strictly ascending order according to `customCompare`
+ * (or parcObject_Compare if `customCompare` is NULL); duplicate or out of order keys are trapped.
+ *
+ * The keys and values are acquired by the new tree, the `PARCKeyValue` entries themselves are not retained.
+ *
+ * @param [in] customCompare A custom function to compare keys, or NULL to use parcObject_Compare.
+ * @param [in] keyValues A `PARCArrayList` of `PARCKeyValue` pointers sorted by key.
+ * @return Non-NULL An initialized TreeMap containing the entries.
+ *
+ * Example:
+ * @code
+ * {
+ *      PARCArrayList *entries = parcArrayList_Create((void (*)(void **))parcKeyValue_Release);
+ *      ...
+ *      parcArrayList_ParallelSort(entries, (PARCObjectCompare *) parcKeyValue_Compare, 0);
+ *
+ *      PARCTreeMap *tree = parcTreeMap_CreateFromSorted(NULL, entries);
+ *      parcArrayList_Destroy(&entries);
+ *
+ *      ...
+ *
+ *      parcTreeMap_Release(&tree);
+ * }
+ * @endcode
+ */
+PARCTreeMap *parcTreeMap_CreateFromSorted(PARCTreeMap_CustomCompare *customCompare, const PARCArrayList *keyValues);
+
 /**
  * Acquire a reference to a `PARCTreeMap`.
  *
@@ -724,4 +757,111 @@ PARCIterator *parcTreeMap_CreateValueIterator(PARCTreeMap *tree);
  * @endcode
  */
 PARCIterator *parcTreeMap_CreateKeyValueIterator(PARCTreeMap *tree);
+
+/**
+ * Create a `PARCCursor` positioned before the lowest entry of the specified `PARCTreeMap`.
+ *
+ * The cursor is returned by value and requires no allocation or release.
+ * Entries are visited in ascending key order directly from the tree, without copying.
+ * The tree must not be modified while the cursor is in use.
+ *
+ * @param [in] tree A pointer to a valid `PARCTreeMap`.
+ *
+ * @return A `PARCCursor` for use with {@link parcTreeMap_CursorHasNext} and the `parcTreeMap_CursorNext` functions.
+ *
+ * Example:
+ * @code
+ * {
+ *    PARCCursor cursor = parcTreeMap_Cursor(myTreeMap);
+ *
+ *    while (parcTreeMap_CursorHasNext(&cursor)) {
+ *        PARCKeyValue *entry = parcTreeMap_CursorNextEntry(&cursor);
+ *    }
+ * }
+ * @endcode
+ */
+PARCCursor parcTreeMap_Cursor(const PARCTreeMap *tree);
+
+/**
+ * Return true if a call to one of the `parcTreeMap_CursorNext` functions would return an element.
+ *
+ * @param [in] cursor A pointer to a `PARCCursor` initialised by {@link parcTreeMap_Cursor}.
+ *
+ * @return true There are more entries.
+ * @return false There are no more entries.
+ */
+bool parcTreeMap_CursorHasNext(const PARCCursor *cursor);
+
+/**
+ * Advance the cursor and return the next `PARCKeyValue` entry in ascending key order.
+ *
+ * The returned entry is not acquired and remains owned by the tree.
+ * If there are no remaining entries, this function induces a trapOutOfBounds.
+ *
+ * @param [in,out] cursor A pointer to a `PARCCursor` initialised by {@link parcTreeMap_Cursor}.
+ *
+ * @return The next entry.
+ */
+PARCKeyValue *parcTreeMap_CursorNextEntry(PARCCursor *cursor);
+
+/**
+ * Advance the cursor and return the key of the next entry in ascending key order.
+ *
+ * @param [in,out] cursor A pointer to a `PARCCursor` initialised by {@link parcTreeMap_Cursor}.
+ *
+ * @return The key of the next entry.
+ */
+PARCObject *parcTreeMap_CursorNextKey(PARCCursor *cursor);
+
+/**
+ * Advance the cursor and return the value of the next entry in ascending key order.
+ *
+ * @param [in,out] cursor A pointer to a `PARCCursor` initialised by {@link parcTreeMap_Cursor}.
+ *
+ * @return The value of the next entry.
+ */
+PARCObject *parcTreeMap_CursorNextValue(PARCCursor *cursor);
+
+/**
+ * Execute the following statement once for each entry of the given `PARCTreeMap`, in ascending key order,
+ * assigning each `PARCKeyValue` in turn to the variable @p _entry_.
+ *
+ * @param [in] _tree_ A pointer to a valid `PARCTreeMap`.
+ * @param [out] _entry_ An lvalue that is assigned each entry in turn.
+ *
+ * Example:
+ * @code
+ * {
+ *    PARCKeyValue *entry;
+ *    parcTreeMap_ForEach(myTreeMap, entry) {
+ *        PARCObject *key = parcKeyValue_GetKey(entry);
+ *    }
+ * }
+ * @endcode
+ */
+#define parcTreeMap_ForEach(_tree_, _entry_) \
+    for (PARCCursor _parcCursor = parcTreeMap_Cursor(_tree_); \
+         parcTreeMap_CursorHasNext(&_parcCursor) && ((_entry_ = parcTreeMap_CursorNextEntry(&_parcCursor)), true); )
+
+/**
+ * Execute the following statement once for each key of the given `PARCTreeMap`, in ascending order,
+ * assigning each key in turn to the variable @p _key_.
+ *
+ * @param [in] _tree_ A pointer to a valid `PARCTreeMap`.
+ * @param [out] _key_ An lvalue that is assigned each key in turn.
+ */
+#define parcTreeMap_ForEachKey(_tree_, _key_) \
+    for (PARCCursor _parcCursor = parcTreeMap_Cursor(_tree_); \
+         parcTreeMap_CursorHasNext(&_parcCursor) && ((_key_ = parcTreeMap_CursorNextKey(&_parcCursor)), true); )
+
+/**
+ * Execute the following statement once for each value of the given `PARCTreeMap`, in ascending key order,
+ * assigning each value in turn to the variable @p _value_.
+ *
+ * @param [in] _tree_ A pointer to a valid `PARCTreeMap`.
+ * @param [out] _value_ An lvalue that is assigned each value in turn.
+ */
+#define parcTreeMap_ForEachValue(_tree_, _value_) \
+    for (PARCCursor _parcCursor = parcTreeMap_Cursor(_tree_); \
+         parcTreeMap_CursorHasNext(&_parcCursor) && ((_value_ = parcTreeMap_CursorNextValue(&_parcCursor)), true); )
 #endif // libparc_parc_TreeMap_h
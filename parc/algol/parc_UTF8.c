@@ -0,0 +1,250 @@
+/*
+ * Copyright (c) 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Patent rights are not granted under this agreement. Patent rights are
+ *       available under FRAND terms.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX or PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * @copyright 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC).  All rights reserved.
+ */
+#include <config.h>
+
+#include <string.h>
+
+#include <parc/algol/parc_UTF8.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#  include <immintrin.h>
+#  define _PARCUTF8_SSSE3 1
+#endif
+
+/*
+ * Check `length` bytes one encoded sequence at a time, following Table 3-7 of the Unicode Standard:
+ * the lead byte fixes the number of continuation bytes and the range allowed for the first of them.
+ */
+static bool
+_parcUTF8_IsValidScalar(size_t length, const uint8_t bytes[length])
+{
+    size_t i = 0;
+    while (i < length) {
+        while (i + 8 <= length) {
+            uint64_t word;
+            memcpy(&word, &bytes[i], sizeof(word));
+            if (word & 0x8080808080808080ULL) {
+                break;
+            }
+            i += 8;
+        }
+        if (i == length) {
+            break;
+        }
+
+        uint8_t lead = bytes[i];
+        if (lead < 0x80) {
+            i++;
+            continue;
+        }
+
+        size_t continuations;
+        uint8_t low = 0x80;
+        uint8_t high = 0xBF;
+        if (lead >= 0xC2 && lead <= 0xDF) {
+            continuations = 1;
+        } else if (lead >= 0xE0 && lead <= 0xEF) {
+            continuations = 2;
+            if (lead == 0xE0) {
+                low = 0xA0;         // overlong
+            } else if (lead == 0xED) {
+                high = 0x9F;        // surrogates
+            }
+        } else if (lead >= 0xF0 && lead <= 0xF4) {
+            continuations = 3;
+            if (lead == 0xF0) {
+                low = 0x90;         // overlong
+            } else if (lead == 0xF4) {
+                high = 0x8F;        // above U+10FFFF
+            }
+        } else {
+            return false;
+        }
+
+        if (length - i - 1 < continuations) {
+            return false;
+        }
+        if (bytes[i + 1] < low || bytes[i + 1] > high) {
+            return false;
+        }
+        for (size_t k = 2; k <= continuations; k++) {
+            if ((bytes[i + k] & 0xC0) != 0x80) {
+                return false;
+            }
+        }
+        i += continuations + 1;
+    }
+    return true;
+}
+
+#if defined(_PARCUTF8_SSSE3)
+/*
+ * The table-lookup validation of Keiser and Lemire, "Validating UTF-8 In Less Than One Instruction Per Byte" (2021).
+ *
+ * Every error in valid-looking UTF-8 shows up in some pair of adjacent bytes. Three 16-entry tables,
+ * indexed by the high nibble of the previous byte, the low nibble of the previous byte and the high nibble
+ * of the current byte, each give the set of errors that pair could be part of; the errors present are
+ * those in all three sets. Only the missing continuations of 3- and 4-byte sequences need the bytes 2 and 3 back.
+ */
+#define _TooShort    (1 << 0)   // A lead byte followed by ASCII or another lead byte.
+#define _TooLong     (1 << 1)   // ASCII followed by a continuation byte.
+#define _Overlong3   (1 << 2)
+#define _TooLarge    (1 << 3)   // Above U+10FFFF.
+#define _Surrogate   (1 << 4)
+#define _Overlong2   (1 << 5)
+#define _TooLarge1000 (1 << 6)
+#define _Overlong4   (1 << 6)
+#define _TwoConts    (1 << 7)   // Two continuation bytes: an error unless the lead byte 2 or 3 back needs them.
+#define _Carry       (_TooShort | _TooLong | _TwoConts)
+
+__attribute__((target("ssse3")))
+static inline __m128i
+_parcUTF8_HighNibbles(__m128i bytes)
+{
+    return _mm_and_si128(_mm_srli_epi16(bytes, 4), _mm_set1_epi8(0x0F));
+}
+
+__attribute__((target("ssse3")))
+static inline __m128i
+_parcUTF8_CheckBlock(__m128i input, __m128i previous)
+{
+    const __m128i byte1HighTable = _mm_setr_epi8(
+        _TooLong, _TooLong, _TooLong, _TooLong, _TooLong, _TooLong, _TooLong, _TooLong,
+        _TwoConts, _TwoConts, _TwoConts, _TwoConts,
+        _TooShort | _Overlong2,
+        _TooShort,
+        _TooShort | _Overlong3 | _Surrogate,
+        (char) (_TooShort | _TooLarge | _TooLarge1000 | _Overlong4));
+    const __m128i byte1LowTable = _mm_setr_epi8(
+        (char) (_Carry | _Overlong3 | _Overlong2 | _Overlong4),
+        (char) (_Carry | _Overlong2),
+        (char) _Carry,
+        (char) _Carry,
+        (char) (_Carry | _TooLarge),
+        (char) (_Carry | _TooLarge | _TooLarge1000),
+        (char) (_Carry | _TooLarge | _TooLarge1000),
+        (char) (_Carry | _TooLarge | _TooLarge1000),
+        (char) (_Carry | _TooLarge | _TooLarge1000),
+        (char) (_Carry | _TooLarge | _TooLarge1000),
+        (char) (_Carry | _TooLarge | _TooLarge1000),
+        (char) (_Carry | _TooLarge | _TooLarge1000),
+        (char) (_Carry | _TooLarge | _TooLarge1000),
+        (char) (_Carry | _TooLarge | _TooLarge1000 | _Surrogate),
+        (char) (_Carry | _TooLarge | _TooLarge1000),
+        (char) (_Carry | _TooLarge | _TooLarge1000));
+    const __m128i byte2HighTable = _mm_setr_epi8(
+        _TooShort, _TooShort, _TooShort, _TooShort, _TooShort, _TooShort, _TooShort, _TooShort,
+        (char) (_TooLong | _Overlong2 | _TwoConts | _Overlong3 | _TooLarge1000 | _Overlong4),
+        (char) (_TooLong | _Overlong2 | _TwoConts | _Overlong3 | _TooLarge),
+        (char) (_TooLong | _Overlong2 | _TwoConts | _Surrogate | _TooLarge),
+        (char) (_TooLong | _Overlong2 | _TwoConts | _Surrogate | _TooLarge),
+        _TooShort, _TooShort, _TooShort, _TooShort);
+
+    __m128i previous1 = _mm_alignr_epi8(input, previous, 16 - 1);
+    __m128i specialCases = _mm_and_si128(
+        _mm_and_si128(_mm_shuffle_epi8(byte1HighTable, _parcUTF8_HighNibbles(previous1)),
+                      _mm_shuffle_epi8(byte1LowTable, _mm_and_si128(previous1, _mm_set1_epi8(0x0F)))),
+        _mm_shuffle_epi8(byte2HighTable, _parcUTF8_HighNibbles(input)));
+
+    // A byte 2 back of 111_____ or 3 back of 1111____ requires this byte to be a continuation,
+    // which is exactly where the two-continuations "error" must appear.
+    __m128i previous2 = _mm_alignr_epi8(input, previous, 16 - 2);
+    __m128i previous3 = _mm_alignr_epi8(input, previous, 16 - 3);
+    __m128i isThirdByte = _mm_subs_epu8(previous2, _mm_set1_epi8((char) (0xE0 - 0x80)));
+    __m128i isFourthByte = _mm_subs_epu8(previous3, _mm_set1_epi8((char) (0xF0 - 0x80)));
+    __m128i mustBeContinuation = _mm_and_si128(_mm_or_si128(isThirdByte, isFourthByte), _mm_set1_epi8((char) 0x80));
+
+    return _mm_xor_si128(mustBeContinuation, specialCases);
+}
+
+/*
+ * Non-zero where the block ends in the middle of a sequence: a lead byte in one of the last 3 positions
+ * that needs more bytes than remain.
+ */
+__attribute__((target("ssse3")))
+static inline __m128i
+_parcUTF8_IsIncomplete(__m128i input)
+{
+    const __m128i maximum = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                                          (char) (0xF0 - 1), (char) (0xE0 - 1), (char) (0xC0 - 1));
+    return _mm_subs_epu8(input, maximum);
+}
+
+__attribute__((target("ssse3")))
+static bool
+_parcUTF8_IsValidSSSE3(size_t length, const uint8_t bytes[length])
+{
+    __m128i error = _mm_setzero_si128();
+    __m128i previous = _mm_setzero_si128();
+    __m128i previousIncomplete = _mm_setzero_si128();
+
+    size_t i = 0;
+    while (i < length) {
+        __m128i input;
+        if (i + 16 <= length) {
+            input = _mm_loadu_si128((const __m128i *) &bytes[i]);
+        } else {
+            // Pad the last block with ASCII, which ends any sequence still open as the end of the text would.
+            uint8_t last[16] = { 0 };
+            memcpy(last, &bytes[i], length - i);
+            input = _mm_loadu_si128((const __m128i *) last);
+        }
+
+        if (_mm_movemask_epi8(input) == 0) {
+            error = _mm_or_si128(error, previousIncomplete);
+        } else {
+            error = _mm_or_si128(error, _parcUTF8_CheckBlock(input, previous));
+            previousIncomplete = _parcUTF8_IsIncomplete(input);
+        }
+        previous = input;
+        i += 16;
+    }
+    error = _mm_or_si128(error, previousIncomplete);
+
+    return _mm_movemask_epi8(_mm_cmpeq_epi8(error, _mm_setzero_si128())) == 0xFFFF;
+}
+
+static inline bool
+_useSSSE3(void)
+{
+    return __builtin_cpu_supports("ssse3");
+}
+#endif
+
+bool
+parcUTF8_IsValid(size_t length, const uint8_t array[length])
+{
+#if defined(_PARCUTF8_SSSE3)
+    if (_useSSSE3()) {
+        return _parcUTF8_IsValidSSSE3(length, array);
+    }
+#endif
+    return _parcUTF8_IsValidScalar(length, array);
+}
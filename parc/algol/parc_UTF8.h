@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Patent rights are not granted under this agreement. Patent rights are
+ *       available under FRAND terms.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX or PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * @file parc_UTF8.h
+ * @ingroup types
+ * @brief Validate UTF-8 encoded text.
+ *
+ * Text is valid UTF-8 if it is a sequence of complete, shortest-form encodings of Unicode scalar values,
+ * as defined by RFC 3629: no stray continuation bytes, no truncated sequences, no overlong encodings,
+ * no UTF-16 surrogates (U+D800 to U+DFFF) and nothing above U+10FFFF.
+ *
+ * Where the processor has SSSE3 (detected at runtime) the text is checked 16 bytes per step,
+ * classifying each byte and its predecessors with table lookups; runs of ASCII are skipped at the same rate.
+ * Otherwise the text is checked a sequence at a time, skipping ASCII 8 bytes at a time.
+ *
+ * @copyright 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC).  All rights reserved.
+ */
+#ifndef libparc_parc_UTF8_h
+#define libparc_parc_UTF8_h
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * Determine if an array of bytes is valid UTF-8.
+ *
+ * @param [in] length The number of bytes in @p array.
+ * @param [in] array The bytes to check.
+ *
+ * @return true The bytes are valid UTF-8. An empty array is valid.
+ * @return false The bytes are not valid UTF-8.
+ *
+ * Example:
+ * @code
+ * {
+ *     const char *text = "caf\xC3\xA9";
+ *     bool valid = parcUTF8_IsValid(strlen(text), (const uint8_t *) text);
+ * }
+ * @endcode
+ */
+bool parcUTF8_IsValid(size_t length, const uint8_t array[length]);
+#endif // libparc_parc_UTF8_h
@@ -65,10 +65,7 @@ parcVarint_DecodeBuffer(PARCBuffer *buffer, size_t length)
     PARCVarint *result = parcVarint_Create();
     assertNotNull(result, "PARCVarint out of memory.");
 
-    for (size_t i = 0; i < length; i++) {
-        parcVarint_ShiftLeft(result, 8);
-        parcVarint_OrUint8(result, parcBuffer_GetUint8(buffer));
-    }
+    result->value = parcBuffer_GetVarint(buffer, length);
 
     return result;
 }
@@ -83,8 +80,7 @@ parcVarint_DecodeElasticByteBuffer(const PARCBuffer *buffer, size_t length)
     assertNotNull(result, "PARCVarint out of memory.");
 
     for (size_t i = 0; i < length; i++) {
-        parcVarint_ShiftLeft(result, 8);
-        parcVarint_OrUint8(result, parcBuffer_GetAtIndex(buffer, i));
+        result->value = (result->value << 8) | parcBuffer_GetAtIndex(buffer, i);
     }
 
     return result;
@@ -106,8 +102,7 @@ parcVarint_FromElasticByteBuffer(const PARCBuffer *buffer)
     size_t length = parcBuffer_Remaining(buffer);
 
     for (size_t i = 0; i < length; i++) {
-        parcVarint_ShiftLeft(result, 8);
-        parcVarint_OrUint8(result, parcBuffer_GetAtIndex(buffer, i));
+        result->value = (result->value << 8) | parcBuffer_GetAtIndex(buffer, i);
     }
 
     return result;
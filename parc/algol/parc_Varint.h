@@ -82,7 +82,10 @@ PARCVarint *parcVarint_Create(void);
  * {
  *     <#example#>
  * }
- * @endcode */
+ * @endcode
+ *
+ * @see parcBuffer_GetVarint, which decodes the value without allocating.
+ */
 PARCVarint *parcVarint_DecodeBuffer(PARCBuffer *buffer, size_t length);
 
 /**
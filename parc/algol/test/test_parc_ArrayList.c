@@ -29,6 +29,7 @@
 
 #include <stdio.h>
 #include <string.h>
+#include <sys/time.h>
 
 #include <parc/algol/parc_SafeMemory.h>
 #include <parc/testing/parc_ObjectTesting.h>
@@ -40,6 +41,7 @@ LONGBOW_TEST_RUNNER(PARC_ArrayList)
     LONGBOW_RUN_TEST_FIXTURE(Global);
     LONGBOW_RUN_TEST_FIXTURE(Local);
     LONGBOW_RUN_TEST_FIXTURE(Errors);
+    LONGBOW_RUN_TEST_FIXTURE(Performance);
 }
 
 LONGBOW_TEST_RUNNER_SETUP(PARC_ArrayList)
@@ -57,6 +59,43 @@ LONGBOW_TEST_RUNNER_TEARDOWN(PARC_ArrayList)
     return LONGBOW_STATUS_SUCCEEDED;
 }
 
+static int
+_compareIntegers(const void *a, const void *b)
+{
+    intptr_t x = (intptr_t) a;
+    intptr_t y = (intptr_t) b;
+    return (x > y) - (x < y);
+}
+
+static PARCArrayList *
+_createRandomIntegers(size_t count, long modulus)
+{
+    PARCArrayList *array = parcArrayList_Create(NULL);
+    for (size_t i = 0; i < count; i++) {
+        parcArrayList_Add(array, (void *) (intptr_t) (random() % modulus));
+    }
+    return array;
+}
+
+static void
+_assertSorted(const PARCArrayList *array)
+{
+    for (size_t i = 1; i < parcArrayList_Size(array); i++) {
+        assertTrue(_compareIntegers(parcArrayList_Get(array, i - 1), parcArrayList_Get(array, i)) <= 0,
+                   "Elements %zu and %zu are out of order", i - 1, i);
+    }
+}
+
+static intptr_t
+_sumIntegers(const PARCArrayList *array)
+{
+    intptr_t result = 0;
+    for (size_t i = 0; i < parcArrayList_Size(array); i++) {
+        result += (intptr_t) parcArrayList_Get(array, i);
+    }
+    return result;
+}
+
 LONGBOW_TEST_FIXTURE(Global)
 {
     LONGBOW_RUN_TEST_CASE(Global, PARC_ArrayList_Add);
@@ -84,6 +123,12 @@ LONGBOW_TEST_FIXTURE(Global)
     LONGBOW_RUN_TEST_CASE(Global, PARC_ArrayList_InsertAtIndex_First);
     LONGBOW_RUN_TEST_CASE(Global, PARC_ArrayList_InsertAtIndex_Last);
     LONGBOW_RUN_TEST_CASE(Global, PARC_ArrayList_IsEmpty);
+    LONGBOW_RUN_TEST_CASE(Global, PARC_ArrayList_Sort);
+    LONGBOW_RUN_TEST_CASE(Global, PARC_ArrayList_Sort_Empty);
+    LONGBOW_RUN_TEST_CASE(Global, PARC_ArrayList_Sort_Patterns);
+    LONGBOW_RUN_TEST_CASE(Global, PARC_ArrayList_Sort_Objects);
+    LONGBOW_RUN_TEST_CASE(Global, PARC_ArrayList_ParallelSort);
+    LONGBOW_RUN_TEST_CASE(Global, PARC_ArrayList_ParallelSort_Small);
 }
 
 LONGBOW_TEST_FIXTURE_SETUP(Global)
@@ -324,6 +369,17 @@ LONGBOW_TEST_CASE(Local, PARC_ArrayList_EnsureRemaining_NonEmpty)
     parcArrayList_Destroy(&array);
 }
 
+LONGBOW_TEST_CASE(Local, PARC_ArrayList_HeapSort)
+{
+    PARCArrayList *array = _createRandomIntegers(1000, 100);
+
+    // A depth limit of zero forces the heapsort fallback.
+    _parcArrayList_IntroSort(array->array, parcArrayList_Size(array), 0, _compareIntegers);
+    _assertSorted(array);
+
+    parcArrayList_Destroy(&array);
+}
+
 LONGBOW_TEST_CASE(Global, PARC_ArrayList_FromInitialCapacity)
 {
     PARCArrayList *array = parcArrayList_Create_Capacity(NULL, parcArrayList_StdlibFreeFunction, 10);
@@ -606,10 +662,108 @@ LONGBOW_TEST_CASE(Global, PARC_ArrayList_RemoveAndDestroy_AtIndex_Last)
     parcArrayList_Destroy(&array);
 }
 
+LONGBOW_TEST_CASE(Global, PARC_ArrayList_Sort)
+{
+    PARCArrayList *array = _createRandomIntegers(10000, 1000000);
+    intptr_t expectedSum = _sumIntegers(array);
+
+    parcArrayList_Sort(array, _compareIntegers);
+
+    assertTrue(parcArrayList_Size(array) == 10000, "Expected the size to be unchanged, actual %zu", parcArrayList_Size(array));
+    assertTrue(_sumIntegers(array) == expectedSum, "Expected the same elements after sorting");
+    _assertSorted(array);
+
+    parcArrayList_Destroy(&array);
+}
+
+LONGBOW_TEST_CASE(Global, PARC_ArrayList_Sort_Empty)
+{
+    PARCArrayList *array = parcArrayList_Create(NULL);
+    parcArrayList_Sort(array, _compareIntegers);
+    assertTrue(parcArrayList_IsEmpty(array), "Expected an empty list to remain empty");
+
+    parcArrayList_Add(array, (void *) 1);
+    parcArrayList_Sort(array, _compareIntegers);
+    assertTrue(parcArrayList_Get(array, 0) == (void *) 1, "Expected a single element to be unchanged");
+
+    parcArrayList_Destroy(&array);
+}
+
+LONGBOW_TEST_CASE(Global, PARC_ArrayList_Sort_Patterns)
+{
+    size_t count = 5000;
+
+    PARCArrayList *ascending = parcArrayList_Create(NULL);
+    PARCArrayList *descending = parcArrayList_Create(NULL);
+    PARCArrayList *constant = parcArrayList_Create(NULL);
+    PARCArrayList *sawtooth = parcArrayList_Create(NULL);
+    for (size_t i = 0; i < count; i++) {
+        parcArrayList_Add(ascending, (void *) (intptr_t) i);
+        parcArrayList_Add(descending, (void *) (intptr_t) (count - i));
+        parcArrayList_Add(constant, (void *) 7);
+        parcArrayList_Add(sawtooth, (void *) (intptr_t) (i % 17));
+    }
+
+    PARCArrayList *lists[] = { ascending, descending, constant, sawtooth };
+    for (size_t i = 0; i < sizeof(lists) / sizeof(lists[0]); i++) {
+        parcArrayList_Sort(lists[i], _compareIntegers);
+        _assertSorted(lists[i]);
+        parcArrayList_Destroy(&lists[i]);
+    }
+}
+
+LONGBOW_TEST_CASE(Global, PARC_ArrayList_Sort_Objects)
+{
+    PARCArrayList *array = parcArrayList_Create((void (*)(void **))parcBuffer_Release);
+    parcArrayList_Add(array, parcBuffer_WrapCString("c"));
+    parcArrayList_Add(array, parcBuffer_WrapCString("a"));
+    parcArrayList_Add(array, parcBuffer_WrapCString("b"));
+
+    parcArrayList_Sort(array, parcObject_Compare);
+
+    PARCBuffer *expected = parcBuffer_WrapCString("a");
+    assertTrue(parcBuffer_Equals(expected, parcArrayList_Get(array, 0)), "Expected 'a' to be first");
+    parcBuffer_Release(&expected);
+    expected = parcBuffer_WrapCString("c");
+    assertTrue(parcBuffer_Equals(expected, parcArrayList_Get(array, 2)), "Expected 'c' to be last");
+    parcBuffer_Release(&expected);
+
+    parcArrayList_Destroy(&array);
+}
+
+LONGBOW_TEST_CASE(Global, PARC_ArrayList_ParallelSort)
+{
+    size_t threadCounts[] = { 0, 2, 3, 8 };
+
+    for (size_t i = 0; i < sizeof(threadCounts) / sizeof(threadCounts[0]); i++) {
+        PARCArrayList *array = _createRandomIntegers(100000, 1000);
+        intptr_t expectedSum = _sumIntegers(array);
+
+        parcArrayList_ParallelSort(array, _compareIntegers, threadCounts[i]);
+
+        assertTrue(parcArrayList_Size(array) == 100000, "Expected the size to be unchanged, actual %zu", parcArrayList_Size(array));
+        assertTrue(_sumIntegers(array) == expectedSum, "Expected the same elements after sorting with %zu threads", threadCounts[i]);
+        _assertSorted(array);
+
+        parcArrayList_Destroy(&array);
+    }
+}
+
+LONGBOW_TEST_CASE(Global, PARC_ArrayList_ParallelSort_Small)
+{
+    PARCArrayList *array = _createRandomIntegers(100, 1000);
+
+    parcArrayList_ParallelSort(array, _compareIntegers, 4);
+    _assertSorted(array);
+
+    parcArrayList_Destroy(&array);
+}
+
 LONGBOW_TEST_FIXTURE(Local)
 {
     LONGBOW_RUN_TEST_CASE(Local, PARC_ArrayList_EnsureRemaining_Empty);
     LONGBOW_RUN_TEST_CASE(Local, PARC_ArrayList_EnsureRemaining_NonEmpty);
+    LONGBOW_RUN_TEST_CASE(Local, PARC_ArrayList_HeapSort);
 }
 
 LONGBOW_TEST_FIXTURE_SETUP(Local)
@@ -659,6 +813,56 @@ LONGBOW_TEST_CASE_EXPECTS(Errors, PARC_ArrayList_InsertAtIndex_OutOfCapacity, .e
     parcArrayList_InsertAtIndex(array, 200, (void *) 3);
 }
 
+LONGBOW_TEST_FIXTURE_OPTIONS(Performance, .enabled = false)
+{
+    LONGBOW_RUN_TEST_CASE(Performance, PARC_ArrayList_Sort);
+    LONGBOW_RUN_TEST_CASE(Performance, PARC_ArrayList_ParallelSort);
+}
+
+LONGBOW_TEST_FIXTURE_SETUP(Performance)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_FIXTURE_TEARDOWN(Performance)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_CASE(Performance, PARC_ArrayList_Sort)
+{
+    PARCArrayList *array = _createRandomIntegers(4000000, 1L << 30);
+
+    struct timeval start, end, elapsed;
+    gettimeofday(&start, NULL);
+    parcArrayList_Sort(array, _compareIntegers);
+    gettimeofday(&end, NULL);
+    timersub(&end, &start, &elapsed);
+
+    printf("parcArrayList_Sort %zu elements: %ld.%06ld seconds\n",
+           parcArrayList_Size(array), (long) elapsed.tv_sec, (long) elapsed.tv_usec);
+    _assertSorted(array);
+
+    parcArrayList_Destroy(&array);
+}
+
+LONGBOW_TEST_CASE(Performance, PARC_ArrayList_ParallelSort)
+{
+    PARCArrayList *array = _createRandomIntegers(4000000, 1L << 30);
+
+    struct timeval start, end, elapsed;
+    gettimeofday(&start, NULL);
+    parcArrayList_ParallelSort(array, _compareIntegers, 0);
+    gettimeofday(&end, NULL);
+    timersub(&end, &start, &elapsed);
+
+    printf("parcArrayList_ParallelSort %zu elements: %ld.%06ld seconds\n",
+           parcArrayList_Size(array), (long) elapsed.tv_sec, (long) elapsed.tv_usec);
+    _assertSorted(array);
+
+    parcArrayList_Destroy(&array);
+}
+
 int
 main(int argc, char *argv[])
 {
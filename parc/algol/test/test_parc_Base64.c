@@ -31,6 +31,8 @@
 // This permits internal static functions to be visible to this Test Framework.
 #include "../parc_Base64.c"
 #include <parc/algol/parc_SafeMemory.h>
+#include <parc/algol/parc_Memory.h>
+#include <sys/time.h>
 
 LONGBOW_TEST_RUNNER(parc_Base64)
 {
@@ -39,6 +41,7 @@ LONGBOW_TEST_RUNNER(parc_Base64)
     // Never rely on the execution order of tests or share state between them.
     LONGBOW_RUN_TEST_FIXTURE(Global);
     LONGBOW_RUN_TEST_FIXTURE(Local);
+    LONGBOW_RUN_TEST_FIXTURE(Performance);
 }
 
 // The Test Runner calls this function once before any Test Fixtures are run.
@@ -59,6 +62,13 @@ LONGBOW_TEST_FIXTURE(Global)
     LONGBOW_RUN_TEST_CASE(Global, parcBase64_Decode_Linefeeds);
     LONGBOW_RUN_TEST_CASE(Global, parcBase64_Encode);
     LONGBOW_RUN_TEST_CASE(Global, parcBase64_Encode_Binary);
+    LONGBOW_RUN_TEST_CASE(Global, parcBase64_RoundTrip);
+    LONGBOW_RUN_TEST_CASE(Global, parcBase64_Decode_Invalid);
+    LONGBOW_RUN_TEST_CASE(Global, parcBase64_Decode_Truncated);
+    LONGBOW_RUN_TEST_CASE(Global, parcBase64URL_Encode);
+    LONGBOW_RUN_TEST_CASE(Global, parcBase64URL_Decode);
+    LONGBOW_RUN_TEST_CASE(Global, parcBase64Decoder_Update);
+    LONGBOW_RUN_TEST_CASE(Global, parcBase64Decoder_Finish_Truncated);
 }
 
 LONGBOW_TEST_FIXTURE_SETUP(Global)
@@ -227,6 +237,236 @@ LONGBOW_TEST_CASE(Global, parcBase64_Encode_Binary)
     }
 }
 
+/*
+ * The byte-at-a-time encoder this implementation replaced, as a reference for the results and the throughput.
+ */
+static PARCBufferComposer *
+_referenceEncode(PARCBufferComposer *output, size_t length, const uint8_t array[length])
+{
+    for (size_t offset = 0; offset < length; offset += 3) {
+        size_t padLength = 3 - ((length - offset < 3) ? length - offset : 3);
+        uint8_t quantum[3] = { 0, 0, 0 };
+        memcpy(quantum, &array[offset], 3 - padLength);
+
+        for (unsigned index = 0; index < 4; index++) {
+            if (index + padLength < 4) {
+                int sixbit = 0;
+                switch (index) {
+                    case 0:
+                        sixbit = quantum[0] >> 2;
+                        break;
+                    case 1:
+                        sixbit = ((quantum[0] & 0x03) << 4) | (quantum[1] >> 4);
+                        break;
+                    case 2:
+                        sixbit = ((quantum[1] & 0x0F) << 2) | (quantum[2] >> 6);
+                        break;
+                    case 3:
+                        sixbit = quantum[2] & 0x3F;
+                        break;
+                }
+                parcBufferComposer_PutUint8(output, base64code[sixbit]);
+            } else {
+                parcBufferComposer_PutUint8(output, pad);
+            }
+        }
+    }
+    return output;
+}
+
+static void
+_fillArray(size_t length, uint8_t array[length])
+{
+    for (size_t i = 0; i < length; i++) {
+        array[i] = (uint8_t) (i * 167 + (i >> 3));
+    }
+}
+
+LONGBOW_TEST_CASE(Global, parcBase64_RoundTrip)
+{
+    uint8_t plaintext[200];
+    _fillArray(sizeof(plaintext), plaintext);
+
+    for (size_t length = 0; length <= sizeof(plaintext); length++) {
+        PARCBufferComposer *expected = _referenceEncode(parcBufferComposer_Create(), length, plaintext);
+        PARCBufferComposer *encoded = parcBase64_EncodeArray(parcBufferComposer_Create(), length, plaintext);
+        char *expectedString = parcBufferComposer_ToString(expected);
+        char *actualString = parcBufferComposer_ToString(encoded);
+        assertTrue(strcmp(expectedString, actualString) == 0, "Expected the reference encoding of %zu bytes", length);
+        parcMemory_Deallocate(&expectedString);
+        parcMemory_Deallocate(&actualString);
+
+        PARCBuffer *encodedBuffer = parcBufferComposer_ProduceBuffer(encoded);
+        PARCBufferComposer *decoded = parcBase64_Decode(parcBufferComposer_Create(), encodedBuffer);
+        assertNotNull(decoded, "Expected the encoding of %zu bytes to decode", length);
+
+        PARCBuffer *decodedBuffer = parcBufferComposer_ProduceBuffer(decoded);
+        assertTrue(parcBuffer_Remaining(decodedBuffer) == length
+                   && memcmp(parcBuffer_Overlay(decodedBuffer, 0), plaintext, length) == 0,
+                   "Expected %zu bytes to round trip", length);
+
+        parcBuffer_Release(&decodedBuffer);
+        parcBuffer_Release(&encodedBuffer);
+        parcBufferComposer_Release(&decoded);
+        parcBufferComposer_Release(&encoded);
+        parcBufferComposer_Release(&expected);
+    }
+}
+
+LONGBOW_TEST_CASE(Global, parcBase64_Decode_Invalid)
+{
+    // Invalid characters in a quantum, and in the middle of a block long enough for the vector decoder,
+    // including bytes with the high bit set, which must not be used as indices into the decoding tables.
+    const char *invalid[] = {
+        "Zm9v@mFy",
+        "Zm\xC3\xA9",
+        "Zm9vYmFyZm9vYmFyZm9v*mFyZm9vYmFyZm9vYmFy",
+        "Zm9vYmFyZm9vYmFyZm9vYmFy\xC3\xA9mFyZm9vYmFy"
+    };
+
+    for (size_t i = 0; i < sizeof(invalid) / sizeof(invalid[0]); i++) {
+        PARCBufferComposer *output = parcBufferComposer_Create();
+        parcBufferComposer_PutString(output, "prefix");
+
+        PARCBufferComposer *actual = parcBase64_DecodeString(output, invalid[i]);
+        assertNull(actual, "Expected '%s' not to decode", invalid[i]);
+        assertTrue(parcBuffer_Position(parcBufferComposer_GetBuffer(output)) == 6,
+                   "Expected nothing to be appended to the output");
+
+        parcBufferComposer_Release(&output);
+    }
+}
+
+LONGBOW_TEST_CASE(Global, parcBase64_Decode_Truncated)
+{
+    PARCBufferComposer *output = parcBufferComposer_Create();
+
+    assertNull(parcBase64_DecodeString(output, "Zm9vYmF"), "Expected a truncated quantum not to decode");
+    assertTrue(parcBuffer_Position(parcBufferComposer_GetBuffer(output)) == 0, "Expected nothing to be appended");
+
+    parcBufferComposer_Release(&output);
+}
+
+LONGBOW_TEST_CASE(Global, parcBase64URL_Encode)
+{
+    uint8_t bytes[] = { 0xFB, 0xFF, 0xBF };
+
+    PARCBufferComposer *standard = parcBase64_EncodeArray(parcBufferComposer_Create(), 2, bytes);
+    PARCBufferComposer *url = parcBase64URL_EncodeArray(parcBufferComposer_Create(), 2, bytes);
+    PARCBufferComposer *urlLong = parcBase64URL_EncodeArray(parcBufferComposer_Create(), 3, bytes);
+
+    char *actual = parcBufferComposer_ToString(standard);
+    assertTrue(strcmp(actual, "+/8=") == 0, "Expected '+/8=', actual '%s'", actual);
+    parcMemory_Deallocate(&actual);
+
+    actual = parcBufferComposer_ToString(url);
+    assertTrue(strcmp(actual, "-_8") == 0, "Expected '-_8', actual '%s'", actual);
+    parcMemory_Deallocate(&actual);
+
+    actual = parcBufferComposer_ToString(urlLong);
+    assertTrue(strcmp(actual, "-_-_") == 0, "Expected '-_-_', actual '%s'", actual);
+    parcMemory_Deallocate(&actual);
+
+    parcBufferComposer_Release(&standard);
+    parcBufferComposer_Release(&url);
+    parcBufferComposer_Release(&urlLong);
+}
+
+LONGBOW_TEST_CASE(Global, parcBase64URL_Decode)
+{
+    uint8_t plaintext[100];
+    _fillArray(sizeof(plaintext), plaintext);
+
+    for (size_t length = 0; length <= sizeof(plaintext); length++) {
+        PARCBufferComposer *encoded = parcBase64URL_EncodeArray(parcBufferComposer_Create(), length, plaintext);
+        PARCBuffer *encodedBuffer = parcBufferComposer_ProduceBuffer(encoded);
+        assertTrue(parcBuffer_Remaining(encodedBuffer) == (length * 4 + 2) / 3, "Expected unpadded output");
+        assertTrue(parcBuffer_FindAny(encodedBuffer, 3, (const uint8_t *) "+/=") == SIZE_MAX,
+                   "Expected only URL-safe characters");
+
+        PARCBufferComposer *decoded = parcBase64URL_Decode(parcBufferComposer_Create(), encodedBuffer);
+        assertNotNull(decoded, "Expected the encoding of %zu bytes to decode", length);
+        PARCBuffer *decodedBuffer = parcBufferComposer_ProduceBuffer(decoded);
+        assertTrue(parcBuffer_Remaining(decodedBuffer) == length
+                   && memcmp(parcBuffer_Overlay(decodedBuffer, 0), plaintext, length) == 0,
+                   "Expected %zu bytes to round trip", length);
+
+        parcBuffer_Release(&decodedBuffer);
+        parcBuffer_Release(&encodedBuffer);
+        parcBufferComposer_Release(&decoded);
+        parcBufferComposer_Release(&encoded);
+    }
+
+    // Padded input is accepted too.
+    PARCBufferComposer *output = parcBase64URL_DecodeArray(parcBufferComposer_Create(), 4, (const uint8_t *) "-_8=");
+    PARCBuffer *buffer = parcBufferComposer_ProduceBuffer(output);
+    assertTrue(parcBuffer_Remaining(buffer) == 2 && parcBuffer_GetUint16(buffer) == 0xFBFF, "Expected 0xFBFF");
+    parcBuffer_Release(&buffer);
+    parcBufferComposer_Release(&output);
+}
+
+LONGBOW_TEST_CASE(Global, parcBase64Decoder_Update)
+{
+    uint8_t plaintext[1000];
+    _fillArray(sizeof(plaintext), plaintext);
+
+    // Encoded in lines of 76 characters, as in MIME.
+    PARCBufferComposer *encoded = parcBase64_EncodeArray(parcBufferComposer_Create(), sizeof(plaintext), plaintext);
+    PARCBuffer *encodedBuffer = parcBufferComposer_ProduceBuffer(encoded);
+    PARCBufferComposer *lines = parcBufferComposer_Create();
+    while (parcBuffer_HasRemaining(encodedBuffer)) {
+        size_t length = parcBuffer_Remaining(encodedBuffer) < 76 ? parcBuffer_Remaining(encodedBuffer) : 76;
+        parcBufferComposer_PutArray(lines, parcBuffer_Overlay(encodedBuffer, length), length);
+        parcBufferComposer_PutString(lines, "\r\n");
+    }
+    PARCBuffer *input = parcBufferComposer_ProduceBuffer(lines);
+
+    PARCBase64Decoder *decoder = parcBase64Decoder_Create();
+    PARCBufferComposer *output = parcBufferComposer_Create();
+
+    // Feed the decoder in pieces of every size from 1 to 17 bytes.
+    for (size_t piece = 1; parcBuffer_HasRemaining(input); piece = piece % 17 + 1) {
+        size_t length = parcBuffer_Remaining(input) < piece ? parcBuffer_Remaining(input) : piece;
+        assertNotNull(parcBase64Decoder_Update(decoder, output, length, parcBuffer_Overlay(input, length)),
+                      "Expected each piece to decode");
+    }
+    assertNotNull(parcBase64Decoder_Finish(decoder, output), "Expected the input to be complete");
+
+    PARCBuffer *decoded = parcBufferComposer_ProduceBuffer(output);
+    assertTrue(parcBuffer_Remaining(decoded) == sizeof(plaintext)
+               && memcmp(parcBuffer_Overlay(decoded, 0), plaintext, sizeof(plaintext)) == 0,
+               "Expected the pieces to decode to the plaintext");
+
+    parcBuffer_Release(&decoded);
+    parcBuffer_Release(&input);
+    parcBuffer_Release(&encodedBuffer);
+    parcBufferComposer_Release(&output);
+    parcBufferComposer_Release(&lines);
+    parcBufferComposer_Release(&encoded);
+    parcBase64Decoder_Release(&decoder);
+}
+
+LONGBOW_TEST_CASE(Global, parcBase64Decoder_Finish_Truncated)
+{
+    PARCBase64Decoder *decoder = parcBase64Decoder_Create();
+    PARCBase64Decoder *urlDecoder = parcBase64Decoder_CreateURL();
+    PARCBufferComposer *output = parcBufferComposer_Create();
+
+    parcBase64Decoder_Update(decoder, output, 7, (const uint8_t *) "Zm9vYmF");
+    assertNull(parcBase64Decoder_Finish(decoder, output), "Expected an unpadded quantum to be rejected");
+
+    parcBase64Decoder_Update(urlDecoder, output, 7, (const uint8_t *) "Zm9vYmF");
+    assertNotNull(parcBase64Decoder_Finish(urlDecoder, output), "Expected an unpadded quantum to be accepted");
+
+    char *actual = parcBufferComposer_ToString(output);
+    assertTrue(strcmp(actual, "foofooba") == 0, "Expected 'foofooba', actual '%s'", actual);
+    parcMemory_Deallocate(&actual);
+
+    parcBufferComposer_Release(&output);
+    parcBase64Decoder_Release(&decoder);
+    parcBase64Decoder_Release(&urlDecoder);
+}
+
 LONGBOW_TEST_FIXTURE(Local)
 {
     LONGBOW_RUN_TEST_CASE(Local, encodeWithPad_0);
@@ -258,161 +498,148 @@ LONGBOW_TEST_FIXTURE_TEARDOWN(Local)
  */
 LONGBOW_TEST_CASE(Local, encodeWithPad_0)
 {
-    PARCBufferComposer *output = parcBufferComposer_Create();
     uint8_t input[] = "foobar";
-    PARCBufferComposer *truth = parcBufferComposer_Create();
-    parcBufferComposer_PutString(truth, "Zm9v");
-    PARCBuffer *truthBuffer = parcBufferComposer_ProduceBuffer(truth);
-
-    _encodeWithPad(output, input, 0);
-    PARCBuffer *outputBuffer = parcBufferComposer_ProduceBuffer(output);
-    assertTrue(parcBuffer_Equals(truthBuffer, outputBuffer),
-               "Failed 3-byte encode, expected '%s' got '%s'",
-               parcBuffer_ToHexString(truthBuffer),
-               parcBuffer_ToHexString(outputBuffer));
+    uint8_t output[4];
 
-    parcBuffer_Release(&truthBuffer);
-    parcBuffer_Release(&outputBuffer);
-
-    parcBufferComposer_Release(&output);
-    parcBufferComposer_Release(&truth);
+    size_t consumed = _encodeScalar(&_parcBase64_Standard, output, 3, input);
+    assertTrue(consumed == 3, "Expected to consume 3 bytes, actual %zu", consumed);
+    assertTrue(memcmp(output, "Zm9v", 4) == 0, "Failed 3-byte encode, expected 'Zm9v' got '%.4s'", output);
 }
 
 /**
- * This will encode "fo" because we tell it there's 1 pad byte
+ * This will encode "fo", padding the missing byte
  */
 LONGBOW_TEST_CASE(Local, encodeWithPad_1)
 {
-    PARCBufferComposer *output = parcBufferComposer_Create();
     uint8_t input[] = "foobar";
-    PARCBufferComposer *truth = parcBufferComposer_Create();
-    parcBufferComposer_PutString(truth, "Zm8=");
-    PARCBuffer *truthBuffer = parcBufferComposer_ProduceBuffer(truth);
-
-    _encodeWithPad(output, input, 1);
-    PARCBuffer *outputBuffer = parcBufferComposer_ProduceBuffer(output);
+    uint8_t output[4];
 
-    assertTrue(parcBuffer_Equals(truthBuffer, outputBuffer),
-               "Failed 3-byte encode, expected '%s' got '%s'",
-               parcBuffer_ToHexString(truthBuffer),
-               parcBuffer_ToHexString(outputBuffer));
-
-    parcBuffer_Release(&truthBuffer);
-    parcBuffer_Release(&outputBuffer);
+    size_t length = _encodeTail(&_parcBase64_Standard, output, input, 2);
+    assertTrue(length == 4, "Expected 4 characters, actual %zu", length);
+    assertTrue(memcmp(output, "Zm8=", 4) == 0, "Failed 2-byte encode, expected 'Zm8=' got '%.4s'", output);
 
-    parcBufferComposer_Release(&output);
-    parcBufferComposer_Release(&truth);
+    length = _encodeTail(&_parcBase64_URL, output, input, 2);
+    assertTrue(length == 3, "Expected 3 unpadded characters, actual %zu", length);
+    assertTrue(memcmp(output, "Zm8", 3) == 0, "Failed 2-byte encode, expected 'Zm8' got '%.3s'", output);
 }
 
 /**
- * This will encode "f" because we tell it there's 2 pad byte
+ * This will encode "f", padding the 2 missing bytes
  */
 LONGBOW_TEST_CASE(Local, encodeWithPad_2)
 {
-    PARCBufferComposer *output = parcBufferComposer_Create();
     uint8_t input[] = "foobar";
-    PARCBufferComposer *truth = parcBufferComposer_Create();
-    parcBufferComposer_PutString(truth, "Zg==");
-    PARCBuffer *truthBuffer = parcBufferComposer_ProduceBuffer(truth);
-
-    _encodeWithPad(output, input, 2);
-    PARCBuffer *outputBuffer = parcBufferComposer_ProduceBuffer(output);
-
-    assertTrue(parcBuffer_Equals(truthBuffer, outputBuffer),
-               "Failed 3-byte encode, expected '%s' got '%s'",
-               parcBuffer_ToHexString(truthBuffer),
-               parcBuffer_ToHexString(outputBuffer));
-
-    parcBuffer_Release(&truthBuffer);
-    parcBuffer_Release(&outputBuffer);
+    uint8_t output[4];
 
-    parcBufferComposer_Release(&output);
-    parcBufferComposer_Release(&truth);
+    size_t length = _encodeTail(&_parcBase64_Standard, output, input, 1);
+    assertTrue(length == 4, "Expected 4 characters, actual %zu", length);
+    assertTrue(memcmp(output, "Zg==", 4) == 0, "Failed 1-byte encode, expected 'Zg==' got '%.4s'", output);
 }
 
-
 LONGBOW_TEST_CASE(Local, decode_1)
 {
-    PARCBufferComposer *output = parcBufferComposer_Create();
     uint8_t input[] = "Zg==";
-    PARCBufferComposer *truth = parcBufferComposer_Create();
-    parcBufferComposer_PutString(truth, "f");
-    PARCBuffer *truthBuffer = parcBufferComposer_ProduceBuffer(truth);
-
-    bool success = _decode(output, input);
-    assertTrue(success, "Valid base64 failed decode");
+    uint8_t output[3];
 
-    PARCBuffer *outputBuffer = parcBufferComposer_ProduceBuffer(output);
-    assertTrue(parcBuffer_Equals(truthBuffer, outputBuffer),
-               "Failed 3-byte encode, expected '%s' got '%s'",
-               parcBuffer_ToHexString(truthBuffer),
-               parcBuffer_ToHexString(outputBuffer));
-
-    parcBuffer_Release(&truthBuffer);
-    parcBuffer_Release(&outputBuffer);
-
-    parcBufferComposer_Release(&output);
-    parcBufferComposer_Release(&truth);
+    int length = _decodeQuantum(&_parcBase64_Standard, output, input);
+    assertTrue(length == 1, "Valid base64 failed decode");
+    assertTrue(output[0] == 'f', "Expected 'f', got '%c'", output[0]);
 }
 
 LONGBOW_TEST_CASE(Local, decode_2)
 {
-    PARCBufferComposer *output = parcBufferComposer_Create();
     uint8_t input[] = "Zm8=";
-    PARCBufferComposer *truth = parcBufferComposer_Create();
-    parcBufferComposer_PutString(truth, "fo");
-    PARCBuffer *truthBuffer = parcBufferComposer_ProduceBuffer(truth);
+    uint8_t output[3];
 
-    bool success = _decode(output, input);
-    assertTrue(success, "Valid base64 failed decode");
+    int length = _decodeQuantum(&_parcBase64_Standard, output, input);
+    assertTrue(length == 2, "Valid base64 failed decode");
+    assertTrue(memcmp(output, "fo", 2) == 0, "Expected 'fo', got '%.2s'", output);
+}
 
-    PARCBuffer *outputBuffer = parcBufferComposer_ProduceBuffer(output);
+LONGBOW_TEST_CASE(Local, decode_3)
+{
+    uint8_t input[] = "Zm9v";
+    uint8_t output[3];
 
-    assertTrue(parcBuffer_Equals(truthBuffer, outputBuffer),
-               "Failed 3-byte encode, expected '%s' got '%s'",
-               parcBuffer_ToHexString(truthBuffer),
-               parcBuffer_ToHexString(outputBuffer));
+    int length = _decodeQuantum(&_parcBase64_Standard, output, input);
+    assertTrue(length == 3, "Valid base64 failed decode");
+    assertTrue(memcmp(output, "foo", 3) == 0, "Expected 'foo', got '%.3s'", output);
+}
 
-    parcBuffer_Release(&truthBuffer);
-    parcBuffer_Release(&outputBuffer);
+LONGBOW_TEST_CASE(Local, decode_invalid)
+{
+    uint8_t input[] = "@@@@";
+    uint8_t output[3];
 
-    parcBufferComposer_Release(&output);
-    parcBufferComposer_Release(&truth);
+    int length = _decodeQuantum(&_parcBase64_Standard, output, input);
+    assertTrue(length < 0, "Invalid base64 somehow decoded");
 }
 
-LONGBOW_TEST_CASE(Local, decode_3)
+LONGBOW_TEST_FIXTURE_OPTIONS(Performance, .enabled = false)
 {
-    PARCBufferComposer *output = parcBufferComposer_Create();
-    uint8_t input[] = "Zm9v";
-    PARCBufferComposer *truth = parcBufferComposer_Create();
-    parcBufferComposer_PutString(truth, "foo");
-    PARCBuffer *truthBuffer = parcBufferComposer_ProduceBuffer(truth);
-
-    bool success = _decode(output, input);
-    assertTrue(success, "Valid base64 failed decode");
-    PARCBuffer *outputBuffer = parcBufferComposer_ProduceBuffer(output);
+    LONGBOW_RUN_TEST_CASE(Performance, parcBase64_Throughput);
+}
 
-    assertTrue(parcBuffer_Equals(truthBuffer, outputBuffer),
-               "Failed 3-byte encode, expected '%s' got '%s'",
-               parcBuffer_ToHexString(truthBuffer),
-               parcBuffer_ToHexString(outputBuffer));
+LONGBOW_TEST_FIXTURE_SETUP(Performance)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
 
-    parcBuffer_Release(&truthBuffer);
-    parcBuffer_Release(&outputBuffer);
+LONGBOW_TEST_FIXTURE_TEARDOWN(Performance)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
 
-    parcBufferComposer_Release(&output);
-    parcBufferComposer_Release(&truth);
+static double
+_elapsed(const struct timeval *start)
+{
+    struct timeval end, elapsed;
+    gettimeofday(&end, NULL);
+    timersub(&end, start, &elapsed);
+    return elapsed.tv_sec + elapsed.tv_usec / 1000000.0;
 }
 
-LONGBOW_TEST_CASE(Local, decode_invalid)
+LONGBOW_TEST_CASE(Performance, parcBase64_Throughput)
 {
-    PARCBufferComposer *output = parcBufferComposer_Create();
-    uint8_t input[] = "@@@@";
+    size_t length = 1 << 20;
+    int rounds = 20;
+    uint8_t *plaintext = parcMemory_Allocate(length);
+    _fillArray(length, plaintext);
+
+    struct timeval start;
+    gettimeofday(&start, NULL);
+    for (int round = 0; round < rounds; round++) {
+        PARCBufferComposer *output = _referenceEncode(parcBufferComposer_Create(), length, plaintext);
+        parcBufferComposer_Release(&output);
+    }
+    double reference = _elapsed(&start);
 
-    bool success = _decode(output, input);
-    assertFalse(success, "Invalid base64 somehow decoded");
+    gettimeofday(&start, NULL);
+    for (int round = 0; round < rounds; round++) {
+        PARCBufferComposer *output = parcBase64_EncodeArray(parcBufferComposer_Create(), length, plaintext);
+        parcBufferComposer_Release(&output);
+    }
+    double encode = _elapsed(&start);
 
-    parcBufferComposer_Release(&output);
+    PARCBufferComposer *encoded = parcBase64_EncodeArray(parcBufferComposer_Create(), length, plaintext);
+    PARCBuffer *encodedBuffer = parcBufferComposer_ProduceBuffer(encoded);
+    size_t encodedLength = parcBuffer_Remaining(encodedBuffer);
+    const uint8_t *text = parcBuffer_Overlay(encodedBuffer, 0);
+
+    gettimeofday(&start, NULL);
+    for (int round = 0; round < rounds; round++) {
+        PARCBufferComposer *output = parcBase64_DecodeArray(parcBufferComposer_Create(), encodedLength, text);
+        parcBufferComposer_Release(&output);
+    }
+    double decode = _elapsed(&start);
+
+    double megabytes = (double) length * rounds / 1000000.0;
+    printf("base64 %zu bytes x %d: byte-at-a-time encode %.1f MB/s, encode %.1f MB/s, decode %.1f MB/s\n",
+           length, rounds, megabytes / reference, megabytes / encode, megabytes / decode);
+
+    parcBuffer_Release(&encodedBuffer);
+    parcBufferComposer_Release(&encoded);
+    parcMemory_Deallocate(&plaintext);
 }
 
 int
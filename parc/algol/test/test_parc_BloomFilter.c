@@ -0,0 +1,380 @@
+/*
+ * Copyright (c) 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Patent rights are not granted under this agreement. Patent rights are
+ *       available under FRAND terms.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX or PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * @copyright 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC).  All rights reserved.
+ */
+#include "../parc_BloomFilter.c"
+
+#include <stdio.h>
+#include <inttypes.h>
+#include <sys/time.h>
+
+#include <LongBow/testing.h>
+#include <LongBow/debugging.h>
+#include <parc/algol/parc_Memory.h>
+#include <parc/algol/parc_SafeMemory.h>
+
+#include <parc/testing/parc_MemoryTesting.h>
+#include <parc/testing/parc_ObjectTesting.h>
+
+/*
+ * Measure the fraction of elements that were never added but which the filter reports as present.
+ * Elements 0 .. count-1 are the ones that were added.
+ */
+static double
+_measureFalsePositiveRate(const PARCBloomFilter *filter, uint64_t count, uint64_t trials)
+{
+    uint64_t falsePositives = 0;
+    for (uint64_t i = count; i < count + trials; i++) {
+        if (parcBloomFilter_ContainsData(filter, &i, sizeof(i))) {
+            falsePositives++;
+        }
+    }
+    return (double) falsePositives / (double) trials;
+}
+
+LONGBOW_TEST_RUNNER(parc_BloomFilter)
+{
+    LONGBOW_RUN_TEST_FIXTURE(CreateAcquireRelease);
+    LONGBOW_RUN_TEST_FIXTURE(Global);
+    LONGBOW_RUN_TEST_FIXTURE(Performance);
+}
+
+LONGBOW_TEST_RUNNER_SETUP(parc_BloomFilter)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_RUNNER_TEARDOWN(parc_BloomFilter)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_FIXTURE(CreateAcquireRelease)
+{
+    LONGBOW_RUN_TEST_CASE(CreateAcquireRelease, CreateRelease);
+    LONGBOW_RUN_TEST_CASE(CreateAcquireRelease, CreateWithGeometry);
+    LONGBOW_RUN_TEST_CASE(CreateAcquireRelease, Create_Sizing);
+}
+
+LONGBOW_TEST_FIXTURE_SETUP(CreateAcquireRelease)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_FIXTURE_TEARDOWN(CreateAcquireRelease)
+{
+    if (!parcMemoryTesting_ExpectedOutstanding(0, "%s leaked memory.", longBowTestCase_GetFullName(testCase))) {
+        return LONGBOW_STATUS_MEMORYLEAK;
+    }
+
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_CASE(CreateAcquireRelease, CreateRelease)
+{
+    PARCBloomFilter *instance = parcBloomFilter_Create(1000, 0.01);
+    assertNotNull(instance, "Expected non-null result from parcBloomFilter_Create().");
+
+    parcObjectTesting_AssertAcquireReleaseContract(parcBloomFilter_Acquire, instance);
+
+    parcBloomFilter_Release(&instance);
+    assertNull(instance, "Expected null result from parcBloomFilter_Release().");
+}
+
+LONGBOW_TEST_CASE(CreateAcquireRelease, CreateWithGeometry)
+{
+    PARCBloomFilter *instance = parcBloomFilter_CreateWithGeometry(4, 7);
+
+    assertTrue(parcBloomFilter_BitCount(instance) == 4 * 512, "Expected 2048 bits, actual %zu", parcBloomFilter_BitCount(instance));
+    assertTrue(parcBloomFilter_HashCount(instance) == 7, "Expected 7 hashes, actual %u", parcBloomFilter_HashCount(instance));
+    assertTrue(parcBloomFilter_Count(instance) == 0, "Expected an empty filter.");
+
+    parcBloomFilter_Release(&instance);
+}
+
+LONGBOW_TEST_CASE(CreateAcquireRelease, Create_Sizing)
+{
+    // 1% needs about 9.6 bits per element and 7 hashes.
+    PARCBloomFilter *instance = parcBloomFilter_Create(10000, 0.01);
+
+    assertTrue(parcBloomFilter_BitCount(instance) >= 95850, "Expected at least 95850 bits, actual %zu", parcBloomFilter_BitCount(instance));
+    assertTrue(parcBloomFilter_HashCount(instance) == 7, "Expected 7 hashes, actual %u", parcBloomFilter_HashCount(instance));
+
+    parcBloomFilter_Release(&instance);
+}
+
+LONGBOW_TEST_FIXTURE(Global)
+{
+    LONGBOW_RUN_TEST_CASE(Global, parcBloomFilter_AddContains);
+    LONGBOW_RUN_TEST_CASE(Global, parcBloomFilter_AddContainsBuffer);
+    LONGBOW_RUN_TEST_CASE(Global, parcBloomFilter_FalsePositiveRate);
+    LONGBOW_RUN_TEST_CASE(Global, parcBloomFilter_Clear);
+    LONGBOW_RUN_TEST_CASE(Global, parcBloomFilter_Copy);
+    LONGBOW_RUN_TEST_CASE(Global, parcBloomFilter_Equals);
+    LONGBOW_RUN_TEST_CASE(Global, parcBloomFilter_IsValid);
+    LONGBOW_RUN_TEST_CASE(Global, parcBloomFilter_Union);
+    LONGBOW_RUN_TEST_CASE(Global, parcBloomFilter_Union_Mismatch);
+    LONGBOW_RUN_TEST_CASE(Global, parcBloomFilter_ToBuffer);
+    LONGBOW_RUN_TEST_CASE(Global, parcBloomFilter_CreateFromBuffer_Invalid);
+}
+
+LONGBOW_TEST_FIXTURE_SETUP(Global)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_FIXTURE_TEARDOWN(Global)
+{
+    if (!parcMemoryTesting_ExpectedOutstanding(0, "%s mismanaged memory.", longBowTestCase_GetFullName(testCase))) {
+        return LONGBOW_STATUS_MEMORYLEAK;
+    }
+
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_CASE(Global, parcBloomFilter_AddContains)
+{
+    PARCBloomFilter *filter = parcBloomFilter_Create(1000, 0.01);
+
+    for (uint64_t i = 0; i < 1000; i++) {
+        parcBloomFilter_AddData(filter, &i, sizeof(i));
+    }
+    for (uint64_t i = 0; i < 1000; i++) {
+        assertTrue(parcBloomFilter_ContainsData(filter, &i, sizeof(i)), "Expected element %" PRIu64 " to be present.", i);
+    }
+    assertTrue(parcBloomFilter_Count(filter) == 1000, "Expected 1000 additions, actual %zu", parcBloomFilter_Count(filter));
+
+    parcBloomFilter_Release(&filter);
+}
+
+LONGBOW_TEST_CASE(Global, parcBloomFilter_AddContainsBuffer)
+{
+    PARCBloomFilter *filter = parcBloomFilter_Create(100, 0.01);
+    PARCBuffer *present = parcBuffer_WrapCString("lci:/parc/present");
+    PARCBuffer *absent = parcBuffer_WrapCString("lci:/parc/absent");
+
+    parcBloomFilter_AddBuffer(filter, present);
+
+    assertTrue(parcBuffer_Position(present) == 0, "Expected the buffer position to be unchanged.");
+    assertTrue(parcBloomFilter_ContainsBuffer(filter, present), "Expected the added buffer to be present.");
+    assertFalse(parcBloomFilter_ContainsBuffer(filter, absent), "Expected the other buffer to be absent.");
+    assertTrue(parcBloomFilter_ContainsData(filter, "lci:/parc/present", 17), "Expected the same bytes to be present.");
+
+    parcBuffer_Release(&absent);
+    parcBuffer_Release(&present);
+    parcBloomFilter_Release(&filter);
+}
+
+LONGBOW_TEST_CASE(Global, parcBloomFilter_FalsePositiveRate)
+{
+    uint64_t count = 20000;
+    double target = 0.01;
+    PARCBloomFilter *filter = parcBloomFilter_Create(count, target);
+
+    for (uint64_t i = 0; i < count; i++) {
+        parcBloomFilter_AddData(filter, &i, sizeof(i));
+    }
+
+    double measured = _measureFalsePositiveRate(filter, count, 100000);
+    assertTrue(measured < 2 * target, "Expected a false positive rate near %f, actual %f", target, measured);
+
+    parcBloomFilter_Release(&filter);
+}
+
+LONGBOW_TEST_CASE(Global, parcBloomFilter_Clear)
+{
+    PARCBloomFilter *filter = parcBloomFilter_Create(100, 0.01);
+    parcBloomFilter_AddData(filter, "hello", 5);
+
+    parcBloomFilter_Clear(filter);
+
+    assertFalse(parcBloomFilter_ContainsData(filter, "hello", 5), "Expected the element to be gone.");
+    assertTrue(parcBloomFilter_Count(filter) == 0, "Expected a count of 0, actual %zu", parcBloomFilter_Count(filter));
+
+    parcBloomFilter_Release(&filter);
+}
+
+LONGBOW_TEST_CASE(Global, parcBloomFilter_Copy)
+{
+    PARCBloomFilter *filter = parcBloomFilter_Create(100, 0.01);
+    parcBloomFilter_AddData(filter, "hello", 5);
+
+    PARCBloomFilter *copy = parcBloomFilter_Copy(filter);
+    assertTrue(parcBloomFilter_Equals(filter, copy), "Expected the copy to be equal to the original.");
+
+    parcBloomFilter_AddData(copy, "world", 5);
+    assertFalse(parcBloomFilter_ContainsData(filter, "world", 5), "Expected the original to be independent of the copy.");
+
+    parcBloomFilter_Release(&copy);
+    parcBloomFilter_Release(&filter);
+}
+
+LONGBOW_TEST_CASE(Global, parcBloomFilter_Equals)
+{
+    PARCBloomFilter *x = parcBloomFilter_Create(100, 0.01);
+    PARCBloomFilter *y = parcBloomFilter_Create(100, 0.01);
+    PARCBloomFilter *z = parcBloomFilter_Create(100, 0.01);
+    PARCBloomFilter *u1 = parcBloomFilter_Create(100, 0.01);
+    PARCBloomFilter *u2 = parcBloomFilter_Create(1000, 0.01);
+
+    parcBloomFilter_AddData(x, "hello", 5);
+    parcBloomFilter_AddData(y, "hello", 5);
+    parcBloomFilter_AddData(z, "hello", 5);
+    parcBloomFilter_AddData(u1, "world", 5);
+    parcBloomFilter_AddData(u2, "hello", 5);
+
+    parcObjectTesting_AssertEqualsFunction(parcBloomFilter_Equals, x, y, z, u1, u2, NULL);
+
+    parcBloomFilter_Release(&x);
+    parcBloomFilter_Release(&y);
+    parcBloomFilter_Release(&z);
+    parcBloomFilter_Release(&u1);
+    parcBloomFilter_Release(&u2);
+}
+
+LONGBOW_TEST_CASE(Global, parcBloomFilter_IsValid)
+{
+    PARCBloomFilter *instance = parcBloomFilter_Create(100, 0.01);
+    assertTrue(parcBloomFilter_IsValid(instance), "Expected parcBloomFilter_Create to result in a valid instance.");
+
+    parcBloomFilter_Release(&instance);
+    assertFalse(parcBloomFilter_IsValid(instance), "Expected parcBloomFilter_Release to result in an invalid instance.");
+}
+
+LONGBOW_TEST_CASE(Global, parcBloomFilter_Union)
+{
+    PARCBloomFilter *even = parcBloomFilter_Create(1000, 0.01);
+    PARCBloomFilter *odd = parcBloomFilter_Create(1000, 0.01);
+
+    for (uint64_t i = 0; i < 1000; i++) {
+        parcBloomFilter_AddData((i % 2 == 0) ? even : odd, &i, sizeof(i));
+    }
+
+    PARCBloomFilter *result = parcBloomFilter_Union(even, odd);
+    assertTrue(result == even, "Expected the union to be accumulated in the first filter.");
+
+    for (uint64_t i = 0; i < 1000; i++) {
+        assertTrue(parcBloomFilter_ContainsData(even, &i, sizeof(i)), "Expected element %" PRIu64 " to be in the union.", i);
+    }
+    assertTrue(parcBloomFilter_Count(even) == 1000, "Expected 1000 additions, actual %zu", parcBloomFilter_Count(even));
+
+    parcBloomFilter_Release(&odd);
+    parcBloomFilter_Release(&even);
+}
+
+LONGBOW_TEST_CASE_EXPECTS(Global, parcBloomFilter_Union_Mismatch, .event = &LongBowTrapIllegalValue)
+{
+    PARCBloomFilter *small = parcBloomFilter_Create(100, 0.01);
+    PARCBloomFilter *large = parcBloomFilter_Create(100000, 0.01);
+
+    parcBloomFilter_Union(small, large);
+}
+
+LONGBOW_TEST_CASE(Global, parcBloomFilter_ToBuffer)
+{
+    PARCBloomFilter *filter = parcBloomFilter_Create(1000, 0.01);
+    for (uint64_t i = 0; i < 1000; i++) {
+        parcBloomFilter_AddData(filter, &i, sizeof(i));
+    }
+
+    PARCBuffer *buffer = parcBloomFilter_ToBuffer(filter);
+    PARCBloomFilter *actual = parcBloomFilter_CreateFromBuffer(buffer);
+
+    assertNotNull(actual, "Expected the serialized filter to be read back.");
+    assertTrue(parcBloomFilter_Equals(filter, actual), "Expected the filter read back to equal the original.");
+    assertTrue(parcBuffer_Remaining(buffer) == 0, "Expected the whole buffer to be consumed.");
+
+    parcBloomFilter_Release(&actual);
+    parcBuffer_Release(&buffer);
+    parcBloomFilter_Release(&filter);
+}
+
+LONGBOW_TEST_CASE(Global, parcBloomFilter_CreateFromBuffer_Invalid)
+{
+    PARCBuffer *buffer = parcBuffer_WrapCString("this is not a serialized bloom filter");
+
+    PARCBloomFilter *actual = parcBloomFilter_CreateFromBuffer(buffer);
+
+    assertNull(actual, "Expected NULL for a buffer that is not a serialized filter.");
+    assertTrue(parcBuffer_Position(buffer) == 0, "Expected the buffer position to be unchanged.");
+
+    parcBuffer_Release(&buffer);
+}
+
+LONGBOW_TEST_FIXTURE_OPTIONS(Performance, .enabled = false)
+{
+    LONGBOW_RUN_TEST_CASE(Performance, parcBloomFilter_Throughput);
+}
+
+LONGBOW_TEST_FIXTURE_SETUP(Performance)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_FIXTURE_TEARDOWN(Performance)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_CASE(Performance, parcBloomFilter_Throughput)
+{
+    uint64_t count = 1000000;
+    double rates[] = { 0.01, 0.001, 0.0001 };
+
+    for (size_t r = 0; r < sizeof(rates) / sizeof(rates[0]); r++) {
+        PARCBloomFilter *filter = parcBloomFilter_Create(count, rates[r]);
+
+        struct timeval start, end, insert, query;
+        gettimeofday(&start, NULL);
+        for (uint64_t i = 0; i < count; i++) {
+            parcBloomFilter_AddData(filter, &i, sizeof(i));
+        }
+        gettimeofday(&end, NULL);
+        timersub(&end, &start, &insert);
+
+        gettimeofday(&start, NULL);
+        double measured = _measureFalsePositiveRate(filter, count, count);
+        gettimeofday(&end, NULL);
+        timersub(&end, &start, &query);
+
+        printf("parcBloomFilter n=%" PRIu64 " target %f: %zu bits, %u hashes, insert %ld.%06ld s, query %ld.%06ld s, measured %f\n",
+               count, rates[r], parcBloomFilter_BitCount(filter), parcBloomFilter_HashCount(filter),
+               (long) insert.tv_sec, (long) insert.tv_usec, (long) query.tv_sec, (long) query.tv_usec, measured);
+
+        parcBloomFilter_Release(&filter);
+    }
+}
+
+int
+main(int argc, char *argv[argc])
+{
+    LongBowRunner *testRunner = LONGBOW_TEST_RUNNER_CREATE(parc_BloomFilter);
+    int exitStatus = longBowMain(argc, argv, testRunner, NULL);
+    longBowTestRunner_Destroy(&testRunner);
+    exit(exitStatus);
+}
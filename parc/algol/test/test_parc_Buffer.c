@@ -31,12 +31,16 @@
 #include <config.h>
 #include <inttypes.h>
 #include <stdio.h>
+#include <sys/time.h>
+#include <errno.h>
 #include <inttypes.h>
 
 #include <LongBow/unit-test.h>
 #include <LongBow/debugging.h>
 #include <parc/algol/parc_SafeMemory.h>
 #include <parc/testing/parc_ObjectTesting.h>
+#include <parc/algol/parc_HashMap.h>
+#include <parc/algol/parc_Varint.h>
 
 // Include the file(s) containing the functions to be tested.
 // This permits internal static functions to be visible to this Test Framework.
@@ -80,6 +84,7 @@ LONGBOW_TEST_FIXTURE(CreateDestroy)
     LONGBOW_RUN_TEST_CASE(CreateDestroy, parcBuffer_Wrap_NULL);
     LONGBOW_RUN_TEST_CASE(CreateDestroy, parcBuffer_Wrap_WithOffset);
     LONGBOW_RUN_TEST_CASE(CreateDestroy, parcBuffer_AllocateCString);
+    LONGBOW_RUN_TEST_CASE(CreateDestroy, parcBuffer_WrapRecyclableByteArray);
 }
 
 LONGBOW_TEST_FIXTURE_SETUP(CreateDestroy)
@@ -97,6 +102,36 @@ LONGBOW_TEST_FIXTURE_TEARDOWN(CreateDestroy)
     return LONGBOW_STATUS_SUCCEEDED;
 }
 
+static void
+_recycle(void *context, PARCByteArray *array)
+{
+    PARCByteArray **recycled = context;
+    *recycled = array;
+}
+
+LONGBOW_TEST_CASE(CreateDestroy, parcBuffer_WrapRecyclableByteArray)
+{
+    PARCByteArray *array = parcByteArray_Allocate(64);
+    PARCByteArray *recycled = NULL;
+
+    PARCBuffer *buffer = parcBuffer_WrapRecyclableByteArray(array, 40, _recycle, &recycled);
+    assertTrue(parcBuffer_Capacity(buffer) == 40, "Expected capacity 40, actual %zu", parcBuffer_Capacity(buffer));
+    assertTrue(parcBuffer_Limit(buffer) == 40, "Expected limit 40, actual %zu", parcBuffer_Limit(buffer));
+
+    // Derived buffers share the array but do not recycle it.
+    PARCBuffer *duplicate = parcBuffer_Duplicate(buffer);
+    parcBuffer_Release(&duplicate);
+    assertNull(recycled, "Expected a duplicate not to recycle the array");
+
+    parcBuffer_Release(&buffer);
+    assertTrue(recycled == array, "Expected the array to be given to the recycler");
+    assertTrue(parcObject_GetReferenceCount(recycled) == 1, "Expected the recycler to receive the buffer's reference");
+
+    assertNull(parcBuffer_WrapRecyclableByteArray(recycled, 65, _recycle, &recycled), "Expected NULL for a capacity beyond the array");
+
+    parcByteArray_Release(&recycled);
+}
+
 LONGBOW_TEST_CASE(CreateDestroy, parcBuffer_Allocate)
 {
     PARCBuffer *actual = parcBuffer_Allocate(10);
@@ -244,6 +279,11 @@ LONGBOW_TEST_FIXTURE(Global)
     LONGBOW_RUN_TEST_CASE(Global, parcBuffer_HasRemaining);
     LONGBOW_RUN_TEST_CASE(Global, parcBuffer_HashCode);
     LONGBOW_RUN_TEST_CASE(Global, parcBuffer_HashCode_ZeroRemaining);
+    LONGBOW_RUN_TEST_CASE(Global, parcBuffer_Freeze);
+    LONGBOW_RUN_TEST_CASE(Global, parcBuffer_Freeze_HashCode);
+    LONGBOW_RUN_TEST_CASE(Global, parcBuffer_Freeze_Equals);
+    LONGBOW_RUN_TEST_CASE(Global, parcBuffer_Freeze_Copy);
+    LONGBOW_RUN_TEST_CASE(Global, parcBuffer_Freeze_Slice);
     LONGBOW_RUN_TEST_CASE(Global, parcBuffer_Mark);
     LONGBOW_RUN_TEST_CASE(Global, parcBuffer_Resize_Growing);
     LONGBOW_RUN_TEST_CASE(Global, parcBuffer_Resize_Growing_AtLimit);
@@ -251,6 +291,9 @@ LONGBOW_TEST_FIXTURE(Global)
     LONGBOW_RUN_TEST_CASE(Global, parcBuffer_Resize_Shrinking_AtLimit);
     LONGBOW_RUN_TEST_CASE(Global, parcBuffer_Resize_Example);
     LONGBOW_RUN_TEST_CASE(Global, parcBuffer_Resize_Slice);
+    LONGBOW_RUN_TEST_CASE(Global, parcBuffer_MapFile);
+    LONGBOW_RUN_TEST_CASE(Global, parcBuffer_MapFile_NotFound);
+    LONGBOW_RUN_TEST_CASE(Global, parcBuffer_MapFile_Slice);
     LONGBOW_RUN_TEST_CASE(Global, parcBuffer_Overlay);
     LONGBOW_RUN_TEST_CASE(Global, parcBuffer_Position);
     LONGBOW_RUN_TEST_CASE(Global, parcBuffer_PutBuffer);
@@ -274,11 +317,18 @@ LONGBOW_TEST_FIXTURE(Global)
     LONGBOW_RUN_TEST_CASE(Global, parcBuffer_SkipTo);
     LONGBOW_RUN_TEST_CASE(Global, parcBuffer_FindUint8);
     LONGBOW_RUN_TEST_CASE(Global, parcBuffer_FindUint8_NotFound);
+    LONGBOW_RUN_TEST_CASE(Global, parcBuffer_FindByte);
+    LONGBOW_RUN_TEST_CASE(Global, parcBuffer_FindAny);
+    LONGBOW_RUN_TEST_CASE(Global, parcBuffer_FindAny_NotFound);
+    LONGBOW_RUN_TEST_CASE(Global, parcBuffer_SkipOver_Long);
+    LONGBOW_RUN_TEST_CASE(Global, parcBuffer_SkipTo_Reference);
     LONGBOW_RUN_TEST_CASE(Global, parcBuffer_IsValid_True);
     LONGBOW_RUN_TEST_CASE(Global, parcBuffer_ParseNumeric_Decimal);
     LONGBOW_RUN_TEST_CASE(Global, parcBuffer_ParseNumeric_Hexadecimal);
 
     LONGBOW_RUN_TEST_CASE(Global, parcBuffer_ParseHexString);
+    LONGBOW_RUN_TEST_CASE(Global, parcBuffer_ParseHexString_LowerCase);
+    LONGBOW_RUN_TEST_CASE(Global, parcBuffer_ParseHexString_Invalid);
     LONGBOW_RUN_TEST_CASE(Global, parcBuffer_CreateFromArray);
 }
 
@@ -580,6 +630,71 @@ LONGBOW_TEST_CASE(Global, parcBuffer_Resize_Example)
     parcBuffer_Release(&buffer);
 }
 
+static char *
+_createMappableFile(const char *contents)
+{
+    char *pathName = strdup("/tmp/test_parc_Buffer_XXXXXX");
+    int fd = mkstemp(pathName);
+    assertTrue(fd >= 0, "mkstemp failed: %s", strerror(errno));
+    assertTrue(write(fd, contents, strlen(contents)) == (ssize_t) strlen(contents), "write failed: %s", strerror(errno));
+    close(fd);
+
+    return pathName;
+}
+
+LONGBOW_TEST_CASE(Global, parcBuffer_MapFile)
+{
+    char *pathName = _createMappableFile("Hello, mapped World!");
+
+    PARCBuffer *actual = parcBuffer_MapFile(pathName);
+    unlink(pathName);
+    free(pathName);
+
+    assertNotNull(actual, "Expected parcBuffer_MapFile to succeed.");
+    assertTrue(parcByteArray_IsMapped(parcBuffer_Array(actual)), "Expected the buffer to be backed by a mapping.");
+    assertTrue(parcBuffer_Position(actual) == 0, "Expected position 0, actual %zd", parcBuffer_Position(actual));
+    assertTrue(parcBuffer_IsFrozen(actual), "Expected a buffer over a file mapping to be frozen.");
+
+    PARCBuffer *expected = parcBuffer_WrapCString("Hello, mapped World!");
+    assertTrue(parcBuffer_Equals(expected, actual), "Expected the buffer to hold the contents of the file.");
+    assertTrue(parcBuffer_Advise(actual, PARCByteArrayAdvice_Sequential), "Expected advice to be accepted.");
+
+    parcBuffer_Release(&expected);
+    parcBuffer_Release(&actual);
+}
+
+LONGBOW_TEST_CASE(Global, parcBuffer_MapFile_NotFound)
+{
+    PARCBuffer *actual = parcBuffer_MapFile("/tmp/test_parc_Buffer_does_not_exist");
+    assertNull(actual, "Expected NULL for a file that does not exist.");
+
+    actual = parcBuffer_MapFile("/tmp");
+    assertNull(actual, "Expected NULL for a directory.");
+}
+
+LONGBOW_TEST_CASE(Global, parcBuffer_MapFile_Slice)
+{
+    char *pathName = _createMappableFile("Hello, mapped World!");
+    PARCBuffer *buffer = parcBuffer_MapFile(pathName);
+    unlink(pathName);
+    free(pathName);
+
+    parcBuffer_SetPosition(buffer, 7);
+    parcBuffer_SetLimit(buffer, 13);
+    PARCBuffer *slice = parcBuffer_Slice(buffer);
+
+    // The slice shares the mapping and keeps it alive after the original buffer is released.
+    assertTrue(parcBuffer_Array(slice) == parcBuffer_Array(buffer), "Expected the slice to share the mapping.");
+    parcBuffer_Release(&buffer);
+
+    PARCBuffer *expected = parcBuffer_WrapCString("mapped");
+    assertTrue(parcBuffer_Equals(expected, slice), "Expected the slice to hold \"mapped\".");
+    assertTrue(parcBuffer_Advise(slice, PARCByteArrayAdvice_WillNeed), "Expected advice to be accepted.");
+
+    parcBuffer_Release(&expected);
+    parcBuffer_Release(&slice);
+}
+
 LONGBOW_TEST_CASE(Global, parcBuffer_Resize_Slice)
 {
     PARCBuffer *buffer = parcBuffer_WrapCString("Hello World");
@@ -1078,6 +1193,108 @@ LONGBOW_TEST_CASE(Global, parcBuffer_HashCode_ZeroRemaining)
     parcBuffer_Release(&buffer1);
 }
 
+LONGBOW_TEST_CASE(Global, parcBuffer_Freeze)
+{
+    PARCBuffer *buffer = parcBuffer_WrapCString("Hello World");
+    assertFalse(parcBuffer_IsFrozen(buffer), "Expected a new buffer not to be frozen.");
+
+    PARCBuffer *actual = parcBuffer_Freeze(buffer);
+    assertTrue(actual == buffer, "Expected parcBuffer_Freeze to return its argument.");
+    assertTrue(parcBuffer_IsFrozen(buffer), "Expected the buffer to be frozen.");
+
+    // The position and limit of a frozen buffer may still be changed.
+    parcBuffer_SetPosition(buffer, 6);
+    assertTrue(parcBuffer_GetUint8(buffer) == 'W', "Expected to read from a frozen buffer.");
+    parcBuffer_Rewind(buffer);
+    parcBuffer_SetLimit(buffer, 5);
+    assertTrue(parcBuffer_Remaining(buffer) == 5, "Expected 5 bytes remaining, actual %zd", parcBuffer_Remaining(buffer));
+
+    parcBuffer_Release(&buffer);
+}
+
+LONGBOW_TEST_CASE(Global, parcBuffer_Freeze_HashCode)
+{
+    PARCBuffer *buffer = parcBuffer_WrapCString("Hello World");
+    PARCBuffer *frozen = parcBuffer_Freeze(parcBuffer_Flip(parcBuffer_PutArray(parcBuffer_Allocate(11), 11, (uint8_t *) "Hello World")));
+
+    PARCHashCode expected = parcBuffer_HashCode(buffer);
+    PARCHashCode actual = parcBuffer_HashCode(frozen);
+    assertTrue(expected == actual, "Expected %" PRIPARCHashCode ", actual %" PRIPARCHashCode, expected, actual);
+
+    // The cached value follows the position and limit.
+    parcBuffer_SetPosition(buffer, 6);
+    parcBuffer_SetPosition(frozen, 6);
+    expected = parcBuffer_HashCode(buffer);
+    actual = parcBuffer_HashCode(frozen);
+    assertTrue(expected == actual, "Expected %" PRIPARCHashCode ", actual %" PRIPARCHashCode, expected, actual);
+
+    // Writing behind the buffer's back is not detected: the hash code is the cached one.
+    ((uint8_t *) parcBuffer_Overlay(frozen, 0))[0] = 'w';
+    actual = parcBuffer_HashCode(frozen);
+    assertTrue(expected == actual, "Expected the cached hash code %" PRIPARCHashCode ", actual %" PRIPARCHashCode, expected, actual);
+
+    parcBuffer_Release(&buffer);
+    parcBuffer_Release(&frozen);
+}
+
+LONGBOW_TEST_CASE(Global, parcBuffer_Freeze_Equals)
+{
+    PARCBuffer *x = parcBuffer_Freeze(parcBuffer_WrapCString("Hello World"));
+    PARCBuffer *y = parcBuffer_Freeze(parcBuffer_WrapCString("Hello World"));
+    PARCBuffer *z = parcBuffer_Freeze(parcBuffer_WrapCString("Hello Earth"));
+    PARCBuffer *unfrozen = parcBuffer_WrapCString("Hello World");
+    PARCBuffer *shorter = parcBuffer_Freeze(parcBuffer_WrapCString("Hello"));
+
+    parcObjectTesting_AssertEqualsFunction(parcBuffer_Equals, x, y, unfrozen, z, shorter, NULL);
+
+    parcBuffer_Release(&x);
+    parcBuffer_Release(&y);
+    parcBuffer_Release(&z);
+    parcBuffer_Release(&unfrozen);
+    parcBuffer_Release(&shorter);
+}
+
+LONGBOW_TEST_CASE(Global, parcBuffer_Freeze_Copy)
+{
+    PARCBuffer *buffer = parcBuffer_Freeze(parcBuffer_WrapCString("Hello World"));
+    parcBuffer_SetPosition(buffer, 6);
+
+    PARCBuffer *copy = parcBuffer_Copy(buffer);
+
+    assertTrue(parcBuffer_IsFrozen(copy), "Expected the copy of a frozen buffer to be frozen.");
+    assertTrue(parcBuffer_Array(copy) == parcBuffer_Array(buffer), "Expected the copy to share the frozen content.");
+    assertTrue(parcBuffer_Position(copy) == 6, "Expected the copy to have the same position.");
+    assertTrue(parcBuffer_Equals(buffer, copy), "Expected the copy to be equal to the original.");
+    assertTrue(parcBuffer_HashCode(buffer) == parcBuffer_HashCode(copy), "Expected equal hash codes.");
+
+    // The position of the copy is independent of the original.
+    parcBuffer_Rewind(copy);
+    assertTrue(parcBuffer_Position(buffer) == 6, "Expected the original position to be unchanged.");
+
+    parcBuffer_Release(&copy);
+    parcBuffer_Release(&buffer);
+}
+
+LONGBOW_TEST_CASE(Global, parcBuffer_Freeze_Slice)
+{
+    PARCBuffer *buffer = parcBuffer_Freeze(parcBuffer_WrapCString("Hello World"));
+    parcBuffer_SetPosition(buffer, 6);
+
+    PARCBuffer *slice = parcBuffer_Slice(buffer);
+    PARCBuffer *duplicate = parcBuffer_Duplicate(buffer);
+    PARCBuffer *expected = parcBuffer_WrapCString("World");
+
+    assertTrue(parcBuffer_IsFrozen(slice), "Expected the slice of a frozen buffer to be frozen.");
+    assertTrue(parcBuffer_IsFrozen(duplicate), "Expected the duplicate of a frozen buffer to be frozen.");
+    assertTrue(parcBuffer_HashCode(slice) == parcBuffer_HashCode(expected), "Expected the slice's hash code to be that of its content.");
+    assertTrue(parcBuffer_Equals(slice, expected), "Expected the slice to be equal to its content.");
+
+    parcBuffer_Release(&expected);
+    parcBuffer_Release(&duplicate);
+    parcBuffer_Release(&slice);
+    parcBuffer_Release(&buffer);
+}
+
 LONGBOW_TEST_CASE(Global, parcBuffer_ToString)
 {
     uint8_t array[] = { 'h', 'e', 'l', 'l', 'o', ' ', 'w', 'o', 'r', 'l', 'd', 'x' };
@@ -1171,6 +1388,114 @@ LONGBOW_TEST_CASE(Global, parcBuffer_SkipTo_NotFound)
     parcBuffer_Release(&buffer);
 }
 
+LONGBOW_TEST_CASE(Global, parcBuffer_FindByte)
+{
+    PARCBuffer *buffer = parcBuffer_WrapCString("name=value=other");
+    parcBuffer_SetPosition(buffer, 5);
+
+    size_t index = parcBuffer_FindByte(buffer, '=');
+    assertTrue(index == 10, "Expected index to be 10, actual %zu", index);
+    assertTrue(parcBuffer_Position(buffer) == 5, "Expected the position to be unchanged.");
+
+    index = parcBuffer_FindByte(buffer, 'n');
+    assertTrue(index == SIZE_MAX, "Expected bytes before the position to be ignored, actual %zu", index);
+
+    parcBuffer_Release(&buffer);
+}
+
+LONGBOW_TEST_CASE(Global, parcBuffer_FindAny)
+{
+    PARCBuffer *buffer = parcBuffer_WrapCString("{\"a-rather-long-name-for-a-member\":[1,2]}");
+
+    size_t index = parcBuffer_FindAny(buffer, 3, (uint8_t *) ",:]");
+    assertTrue(index == 34, "Expected index to be 34, actual %zu", index);
+    assertTrue(parcBuffer_Position(buffer) == 0, "Expected the position to be unchanged.");
+
+    parcBuffer_Release(&buffer);
+}
+
+LONGBOW_TEST_CASE(Global, parcBuffer_FindAny_NotFound)
+{
+    PARCBuffer *buffer = parcBuffer_WrapCString("Hello World, this is longer than sixteen bytes");
+
+    size_t index = parcBuffer_FindAny(buffer, 3, (uint8_t *) "qjk");
+    assertTrue(index == SIZE_MAX, "Expected SIZE_MAX, actual %zu", index);
+
+    parcBuffer_Release(&buffer);
+}
+
+LONGBOW_TEST_CASE(Global, parcBuffer_SkipOver_Long)
+{
+    char text[100];
+    for (size_t leading = 0; leading < 70; leading++) {
+        memset(text, 0, sizeof(text));
+        for (size_t i = 0; i < leading; i++) {
+            text[i] = " \t\r\n"[i % 4];
+        }
+        text[leading] = '{';
+
+        PARCBuffer *buffer = parcBuffer_WrapCString(text);
+        bool actual = parcBuffer_SkipOver(buffer, 4, (uint8_t *) " \t\r\n");
+
+        assertTrue(actual, "Expected parcBuffer_SkipOver to return true.");
+        assertTrue(parcBuffer_Position(buffer) == leading,
+                   "Expected position %zu, actual %zu", leading, parcBuffer_Position(buffer));
+        parcBuffer_Release(&buffer);
+    }
+}
+
+static size_t
+_skipToReference(const uint8_t *bytes, size_t start, size_t limit, size_t length, const uint8_t set[length], bool member)
+{
+    for (size_t i = start; i < limit; i++) {
+        if ((memchr(set, bytes[i], length) != NULL) == member) {
+            return i;
+        }
+    }
+    return limit;
+}
+
+LONGBOW_TEST_CASE(Global, parcBuffer_SkipTo_Reference)
+{
+    uint8_t bytes[200];
+    srandom(1);
+    for (size_t i = 0; i < sizeof(bytes); i++) {
+        bytes[i] = (uint8_t) ('a' + random() % 20);
+    }
+
+    // Sets of 1, 3, 8 (the largest vectorized set) and 12 bytes, and their complements' worth of skipping.
+    const char *sets[] = { "q", "qrs", "abcdefgh", "abcdefghijkl" };
+
+    for (size_t s = 0; s < sizeof(sets) / sizeof(sets[0]); s++) {
+        size_t length = strlen(sets[s]);
+        const uint8_t *set = (const uint8_t *) sets[s];
+
+        for (size_t start = 0; start < 40; start++) {
+            PARCBuffer *buffer = parcBuffer_Wrap(bytes, sizeof(bytes), start, sizeof(bytes));
+
+            size_t expected = _skipToReference(bytes, start, sizeof(bytes), length, set, true);
+            bool found = parcBuffer_SkipTo(buffer, length, set);
+            assertTrue(parcBuffer_Position(buffer) == expected, "SkipTo '%s' from %zu: expected %zu, actual %zu",
+                       sets[s], start, expected, parcBuffer_Position(buffer));
+            assertTrue(found == (expected < sizeof(bytes)), "SkipTo '%s' from %zu: wrong result", sets[s], start);
+
+            parcBuffer_SetPosition(buffer, start);
+            expected = _skipToReference(bytes, start, sizeof(bytes), length, set, false);
+            found = parcBuffer_SkipOver(buffer, length, set);
+            assertTrue(parcBuffer_Position(buffer) == expected, "SkipOver '%s' from %zu: expected %zu, actual %zu",
+                       sets[s], start, expected, parcBuffer_Position(buffer));
+            assertTrue(found == (expected < sizeof(bytes)), "SkipOver '%s' from %zu: wrong result", sets[s], start);
+
+            parcBuffer_SetPosition(buffer, start);
+            size_t index = parcBuffer_FindAny(buffer, length, set);
+            expected = _skipToReference(bytes, start, sizeof(bytes), length, set, true);
+            assertTrue(index == ((expected < sizeof(bytes)) ? expected : SIZE_MAX), "FindAny '%s' from %zu: wrong index", sets[s], start);
+
+            parcBuffer_Release(&buffer);
+        }
+    }
+}
+
 LONGBOW_TEST_CASE(Global, parcBuffer_FindUint8)
 {
     PARCBuffer *buffer = parcBuffer_WrapCString("Hello World");
@@ -1231,6 +1556,24 @@ LONGBOW_TEST_CASE(Global, parcBuffer_ParseHexString)
     parcBuffer_Release(&buffer);
 }
 
+LONGBOW_TEST_CASE(Global, parcBuffer_ParseHexString_LowerCase)
+{
+    PARCBuffer *buffer = parcBuffer_ParseHexString("00ff7Fa0");
+
+    assertTrue(parcBuffer_Position(buffer) == 4, "Expected the position to be at the end of the decoded bytes.");
+    parcBuffer_Flip(buffer);
+    assertTrue(parcBuffer_GetUint32(buffer) == 0x00FF7FA0, "Expected 0x00FF7FA0");
+
+    parcBuffer_Release(&buffer);
+}
+
+LONGBOW_TEST_CASE(Global, parcBuffer_ParseHexString_Invalid)
+{
+    PARCBuffer *buffer = parcBuffer_ParseHexString("30g0");
+
+    assertNull(buffer, "Expected NULL for a string containing a non-hexadecimal digit.");
+}
+
 LONGBOW_TEST_CASE(Global, parcBuffer_CreateFromArray)
 {
     char *expected = "0123456789ABCDEF";
@@ -1247,8 +1590,19 @@ LONGBOW_TEST_FIXTURE(GettersSetters)
     LONGBOW_RUN_TEST_CASE(GettersSetters, parcPutGetUint16);
     LONGBOW_RUN_TEST_CASE(GettersSetters, parcPutGetUint32);
     LONGBOW_RUN_TEST_CASE(GettersSetters, parcPutGetUint64);
+    LONGBOW_RUN_TEST_CASE(GettersSetters, parcPutGetUint_NetworkOrder);
+    LONGBOW_RUN_TEST_CASE(GettersSetters, parcPutGetUint_LittleEndian);
+    LONGBOW_RUN_TEST_CASE(GettersSetters, parcPutGetUint_Unaligned);
+    LONGBOW_RUN_TEST_CASE(GettersSetters, parcBuffer_GetUintAtIndex);
+    LONGBOW_RUN_TEST_CASE(GettersSetters, parcPutGetUint16Array);
+    LONGBOW_RUN_TEST_CASE(GettersSetters, parcPutGetUint32Array);
+    LONGBOW_RUN_TEST_CASE(GettersSetters, parcPutGetUint64Array);
+    LONGBOW_RUN_TEST_CASE(GettersSetters, parcPutGetVarint);
+    LONGBOW_RUN_TEST_CASE(GettersSetters, parcPutGetLEB128);
+    LONGBOW_RUN_TEST_CASE(GettersSetters, parcGetLEB128Array);
     LONGBOW_RUN_TEST_CASE(GettersSetters, parcBuffer_ToHexString);
     LONGBOW_RUN_TEST_CASE(GettersSetters, parcBuffer_ToHexString_NULLBuffer);
+    LONGBOW_RUN_TEST_CASE(GettersSetters, parcBuffer_ToHexString_Long);
     LONGBOW_RUN_TEST_CASE(GettersSetters, parcBuffer_Display);
     LONGBOW_RUN_TEST_CASE(GettersSetters, parcBuffer_Display_NULL);
 }
@@ -1323,6 +1677,201 @@ LONGBOW_TEST_CASE(GettersSetters, parcPutGetUint64)
     assertTrue(expected == actual, "Expected %" PRIu64 ", actual %" PRIu64 "", expected, actual);
 }
 
+LONGBOW_TEST_CASE(GettersSetters, parcPutGetUint_NetworkOrder)
+{
+    PARCBuffer *buffer = longBowTestCase_GetClipBoardData(testCase);
+
+    parcBuffer_PutUint16(buffer, 0x0102);
+    parcBuffer_PutUint32(buffer, 0x03040506);
+    parcBuffer_PutUint64(buffer, 0x0708090A0B0C0D0EULL);
+    parcBuffer_Flip(buffer);
+
+    assertTrue(parcBuffer_Remaining(buffer) == 14, "Expected 14 bytes, actual %zu", parcBuffer_Remaining(buffer));
+    for (uint8_t i = 0; i < 14; i++) {
+        assertTrue(parcBuffer_GetUint8(buffer) == i + 1, "Expected byte %d to be %d", i, i + 1);
+    }
+}
+
+LONGBOW_TEST_CASE(GettersSetters, parcPutGetUint_LittleEndian)
+{
+    PARCBuffer *buffer = longBowTestCase_GetClipBoardData(testCase);
+
+    parcBuffer_PutUint16LE(buffer, 0x0201);
+    parcBuffer_PutUint32LE(buffer, 0x06050403);
+    parcBuffer_PutUint64LE(buffer, 0x0E0D0C0B0A090807ULL);
+    parcBuffer_Flip(buffer);
+
+    for (uint8_t i = 0; i < 14; i++) {
+        assertTrue(parcBuffer_GetAtIndex(buffer, i) == i + 1, "Expected byte %d to be %d", i, i + 1);
+    }
+
+    uint16_t actual16 = parcBuffer_GetUint16LE(buffer);
+    uint32_t actual32 = parcBuffer_GetUint32LE(buffer);
+    uint64_t actual64 = parcBuffer_GetUint64LE(buffer);
+
+    assertTrue(actual16 == 0x0201, "Expected 0x0201, actual %#x", actual16);
+    assertTrue(actual32 == 0x06050403, "Expected 0x06050403, actual %#x", actual32);
+    assertTrue(actual64 == 0x0E0D0C0B0A090807ULL, "Expected 0x0E0D0C0B0A090807, actual %#" PRIx64, actual64);
+    assertTrue(parcBuffer_Remaining(buffer) == 0, "Expected the buffer to be consumed.");
+}
+
+LONGBOW_TEST_CASE(GettersSetters, parcPutGetUint_Unaligned)
+{
+    uint8_t bytes[] = { 0xFF, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0xFF };
+    PARCBuffer *buffer = parcBuffer_Wrap(bytes, sizeof(bytes), 1, sizeof(bytes) - 1);
+    PARCBuffer *slice = parcBuffer_Slice(buffer);
+
+    uint64_t actual = parcBuffer_GetUint64(slice);
+    assertTrue(actual == 0x1122334455667788ULL, "Expected 0x1122334455667788, actual %#" PRIx64, actual);
+
+    parcBuffer_Rewind(slice);
+    parcBuffer_GetUint8(slice);
+    uint32_t actual32 = parcBuffer_GetUint32(slice);
+    assertTrue(actual32 == 0x22334455, "Expected 0x22334455, actual %#x", actual32);
+
+    parcBuffer_Release(&slice);
+    parcBuffer_Release(&buffer);
+}
+
+LONGBOW_TEST_CASE(GettersSetters, parcBuffer_GetUintAtIndex)
+{
+    uint8_t bytes[] = { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09 };
+    PARCBuffer *buffer = parcBuffer_Wrap(bytes, sizeof(bytes), 0, sizeof(bytes));
+
+    assertTrue(parcBuffer_GetUint16AtIndex(buffer, 7) == 0x0809, "Expected 0x0809 at index 7");
+    assertTrue(parcBuffer_GetUint32AtIndex(buffer, 1) == 0x02030405, "Expected 0x02030405 at index 1");
+    assertTrue(parcBuffer_GetUint64AtIndex(buffer, 1) == 0x0203040506070809ULL, "Expected 0x0203040506070809 at index 1");
+    assertTrue(parcBuffer_Position(buffer) == 0, "Expected the position to be unchanged.");
+
+    parcBuffer_Release(&buffer);
+}
+
+LONGBOW_TEST_CASE(GettersSetters, parcPutGetUint16Array)
+{
+    PARCBuffer *buffer = longBowTestCase_GetClipBoardData(testCase);
+
+    uint16_t expected[] = { 0x0001, 0x1234, 0xFFFE, 0x8000, 0x00FF };
+    parcBuffer_PutUint16Array(buffer, 5, expected);
+    parcBuffer_Flip(buffer);
+
+    assertTrue(parcBuffer_GetUint16AtIndex(buffer, 2) == 0x1234, "Expected network order elements.");
+
+    uint16_t actual[5];
+    parcBuffer_GetUint16Array(buffer, 5, actual);
+    assertTrue(memcmp(expected, actual, sizeof(expected)) == 0, "Expected the array to round trip.");
+    assertTrue(parcBuffer_Remaining(buffer) == 0, "Expected the buffer to be consumed.");
+}
+
+LONGBOW_TEST_CASE(GettersSetters, parcPutGetUint32Array)
+{
+    PARCBuffer *buffer = longBowTestCase_GetClipBoardData(testCase);
+
+    uint32_t expected[] = { 0x00000001, 0x12345678, 0xFFFFFFFE };
+    parcBuffer_PutUint8(buffer, 0);
+    parcBuffer_PutUint32Array(buffer, 3, expected);
+    parcBuffer_Flip(buffer);
+    parcBuffer_GetUint8(buffer);
+
+    uint32_t actual[3];
+    parcBuffer_GetUint32Array(buffer, 3, actual);
+    assertTrue(memcmp(expected, actual, sizeof(expected)) == 0, "Expected the array to round trip.");
+}
+
+LONGBOW_TEST_CASE(GettersSetters, parcPutGetUint64Array)
+{
+    PARCBuffer *buffer = longBowTestCase_GetClipBoardData(testCase);
+
+    uint64_t expected[] = { 1, 0x1234567812345678ULL, UINT64_MAX };
+    parcBuffer_PutUint64Array(buffer, 3, expected);
+    parcBuffer_Flip(buffer);
+
+    assertTrue(parcBuffer_GetUint64(buffer) == 1, "Expected the first element to read as a scalar.");
+    parcBuffer_Rewind(buffer);
+
+    uint64_t actual[3];
+    parcBuffer_GetUint64Array(buffer, 3, actual);
+    assertTrue(memcmp(expected, actual, sizeof(expected)) == 0, "Expected the array to round trip.");
+}
+
+LONGBOW_TEST_CASE(GettersSetters, parcPutGetVarint)
+{
+    PARCBuffer *buffer = longBowTestCase_GetClipBoardData(testCase);
+
+    uint64_t values[] = { 0, 1, 0xFF, 0x100, 0x12345, 0xFFFFFFFF, 1ULL << 40, UINT64_MAX, 0x0102 };
+    size_t lengths[] = { 1, 1, 1, 2, 3, 4, 6, 8, 2 };
+    size_t count = sizeof(values) / sizeof(values[0]);
+
+    for (size_t i = 0; i < count; i++) {
+        assertTrue(parcBuffer_VarintLength(values[i]) == lengths[i],
+                   "Expected length %zu for %" PRIx64 ", actual %zu", lengths[i], values[i], parcBuffer_VarintLength(values[i]));
+        parcBuffer_PutVarint(buffer, values[i]);
+    }
+    parcBuffer_Flip(buffer);
+
+    // The last value is at the end of the buffer, so is read without a whole-word load.
+    assertTrue(parcBuffer_GetUint16AtIndex(buffer, parcBuffer_Limit(buffer) - 2) == 0x0102, "Expected the minimal big-endian encoding.");
+
+    for (size_t i = 0; i < count; i++) {
+        uint64_t actual = parcBuffer_GetVarint(buffer, lengths[i]);
+        assertTrue(actual == values[i], "Expected %" PRIx64 ", actual %" PRIx64, values[i], actual);
+    }
+    assertFalse(parcBuffer_HasRemaining(buffer), "Expected every byte to be consumed.");
+}
+
+LONGBOW_TEST_CASE(GettersSetters, parcPutGetLEB128)
+{
+    PARCBuffer *buffer = longBowTestCase_GetClipBoardData(testCase);
+
+    uint64_t values[] = { 0, 127, 128, 16383, 16384, 1ULL << 35, (1ULL << 56) - 1, 1ULL << 56, UINT64_MAX, 300 };
+    size_t lengths[] = { 1, 1, 2, 2, 3, 6, 8, 9, 10, 2 };
+    size_t count = sizeof(values) / sizeof(values[0]);
+
+    for (size_t i = 0; i < count; i++) {
+        assertTrue(parcBuffer_LEB128Length(values[i]) == lengths[i],
+                   "Expected length %zu for %" PRIx64 ", actual %zu", lengths[i], values[i], parcBuffer_LEB128Length(values[i]));
+        parcBuffer_PutLEB128(buffer, values[i]);
+    }
+    parcBuffer_Flip(buffer);
+
+    assertTrue(parcBuffer_GetAtIndex(buffer, parcBuffer_Limit(buffer) - 2) == 0xAC
+               && parcBuffer_GetAtIndex(buffer, parcBuffer_Limit(buffer) - 1) == 0x02,
+               "Expected 300 to be encoded as 0xAC 0x02");
+
+    for (size_t i = 0; i < count; i++) {
+        size_t position = parcBuffer_Position(buffer);
+        uint64_t actual = parcBuffer_GetLEB128(buffer);
+        assertTrue(actual == values[i], "Expected %" PRIx64 ", actual %" PRIx64, values[i], actual);
+        assertTrue(parcBuffer_Position(buffer) - position == lengths[i], "Expected to consume %zu bytes", lengths[i]);
+    }
+    assertFalse(parcBuffer_HasRemaining(buffer), "Expected every byte to be consumed.");
+
+    uint64_t actual[sizeof(values) / sizeof(values[0])];
+    parcBuffer_GetLEB128Array(parcBuffer_Rewind(buffer), count, actual);
+    assertTrue(memcmp(values, actual, sizeof(values)) == 0, "Expected the array to round trip.");
+    assertFalse(parcBuffer_HasRemaining(buffer), "Expected every byte to be consumed.");
+}
+
+LONGBOW_TEST_CASE(GettersSetters, parcGetLEB128Array)
+{
+    PARCBuffer *buffer = longBowTestCase_GetClipBoardData(testCase);
+
+    // Runs of single-byte values interrupted by longer ones.
+    uint64_t values[60];
+    size_t count = sizeof(values) / sizeof(values[0]);
+    for (size_t i = 0; i < count; i++) {
+        values[i] = (i == 20 || i == 41) ? 1000 + i : i;
+        parcBuffer_PutLEB128(buffer, values[i]);
+    }
+    parcBuffer_Flip(buffer);
+
+    uint64_t actual[sizeof(values) / sizeof(values[0])];
+    parcBuffer_GetLEB128Array(buffer, 3, actual);
+    parcBuffer_GetLEB128Array(buffer, count - 3, &actual[3]);
+
+    assertTrue(memcmp(values, actual, sizeof(values)) == 0, "Expected the array to round trip.");
+    assertFalse(parcBuffer_HasRemaining(buffer), "Expected every byte to be consumed.");
+}
+
 LONGBOW_TEST_CASE(GettersSetters, parcBuffer_ToHexString)
 {
     PARCBuffer *buffer = longBowTestCase_GetClipBoardData(testCase);
@@ -1344,6 +1893,27 @@ LONGBOW_TEST_CASE(GettersSetters, parcBuffer_ToHexString_NULLBuffer)
     parcMemory_Deallocate((void **) &hexString);
 }
 
+LONGBOW_TEST_CASE(GettersSetters, parcBuffer_ToHexString_Long)
+{
+    uint8_t bytes[77];
+    char expected[sizeof(bytes) * 2 + 1];
+    for (size_t i = 0; i < sizeof(bytes); i++) {
+        bytes[i] = (uint8_t) (i * 37 + 11);
+        sprintf(&expected[i * 2], "%02X", bytes[i]);
+    }
+    PARCBuffer *buffer = parcBuffer_Wrap(bytes, sizeof(bytes), 0, sizeof(bytes));
+
+    char *hexString = parcBuffer_ToHexString(buffer);
+    assertTrue(strcmp(expected, hexString) == 0, "Expected %s, actual %s", expected, hexString);
+
+    PARCBuffer *parsed = parcBuffer_Flip(parcBuffer_ParseHexString(hexString));
+    assertTrue(parcBuffer_Equals(buffer, parsed), "Expected the hex string to parse to the original bytes.");
+
+    parcBuffer_Release(&parsed);
+    parcMemory_Deallocate((void **) &hexString);
+    parcBuffer_Release(&buffer);
+}
+
 LONGBOW_TEST_CASE(GettersSetters, parcBuffer_Display)
 {
     PARCBuffer *buffer = longBowTestCase_GetClipBoardData(testCase);
@@ -1362,7 +1932,21 @@ LONGBOW_TEST_CASE(GettersSetters, parcBuffer_Display_NULL)
 LONGBOW_TEST_FIXTURE(Errors)
 {
     LONGBOW_RUN_TEST_CASE(Errors, parcBuffer_GetByte_Underflow);
+    LONGBOW_RUN_TEST_CASE(Errors, parcBuffer_GetUint32_Underflow);
+    LONGBOW_RUN_TEST_CASE(Errors, parcBuffer_GetUint16AtIndex_OutOfBounds);
+    LONGBOW_RUN_TEST_CASE(Errors, parcBuffer_GetUint64AtIndex_Wraparound);
+    LONGBOW_RUN_TEST_CASE(Errors, parcBuffer_GetUint32Array_Wraparound);
+    LONGBOW_RUN_TEST_CASE(Errors, parcBuffer_PutUint16Array_Wraparound);
+    LONGBOW_RUN_TEST_CASE(Errors, parcBuffer_PutUint64_Overflow);
     LONGBOW_RUN_TEST_CASE(Errors, parcBuffer_Mark_mark_exceeds_position);
+    LONGBOW_RUN_TEST_CASE(Errors, parcBuffer_Freeze_PutUint8);
+    LONGBOW_RUN_TEST_CASE(Errors, parcBuffer_Freeze_PutBuffer);
+    LONGBOW_RUN_TEST_CASE(Errors, parcBuffer_Freeze_Resize);
+    LONGBOW_RUN_TEST_CASE(Errors, parcBuffer_MapFile_PutUint8);
+    LONGBOW_RUN_TEST_CASE(Errors, parcBuffer_GetLEB128_Underflow);
+    LONGBOW_RUN_TEST_CASE(Errors, parcBuffer_GetLEB128_TooLong);
+    LONGBOW_RUN_TEST_CASE(Errors, parcBuffer_GetLEB128_Overflow);
+    LONGBOW_RUN_TEST_CASE(Errors, parcBuffer_GetVarint_TooLong);
 }
 
 typedef struct parc_buffer_longbow_clipboard {
@@ -1407,6 +1991,60 @@ LONGBOW_TEST_CASE_EXPECTS(Errors, parcBuffer_GetByte_Underflow, .event = &LongBo
     parcBuffer_GetUint8(buffer); // this will fail.
 }
 
+LONGBOW_TEST_CASE_EXPECTS(Errors, parcBuffer_GetUint32_Underflow, .event = &LongBowTrapOutOfBounds)
+{
+    parcBuffer_LongBowClipBoard *testData = longBowTestCase_GetClipBoardData(testCase);
+    PARCBuffer *buffer = testData->buffer;
+
+    parcBuffer_SetPosition(buffer, 7);
+
+    parcBuffer_GetUint32(buffer); // this will fail.
+}
+
+LONGBOW_TEST_CASE_EXPECTS(Errors, parcBuffer_GetUint16AtIndex_OutOfBounds, .event = &LongBowTrapOutOfBounds)
+{
+    parcBuffer_LongBowClipBoard *testData = longBowTestCase_GetClipBoardData(testCase);
+    PARCBuffer *buffer = testData->buffer;
+
+    parcBuffer_GetUint16AtIndex(buffer, 9); // this will fail.
+}
+
+LONGBOW_TEST_CASE_EXPECTS(Errors, parcBuffer_GetUint64AtIndex_Wraparound, .event = &LongBowTrapOutOfBounds)
+{
+    parcBuffer_LongBowClipBoard *testData = longBowTestCase_GetClipBoardData(testCase);
+    PARCBuffer *buffer = testData->buffer;
+
+    parcBuffer_GetUint64AtIndex(buffer, SIZE_MAX - 2); // index + 8 wraps around to 5, this will fail.
+}
+
+LONGBOW_TEST_CASE_EXPECTS(Errors, parcBuffer_GetUint32Array_Wraparound, .event = &LongBowTrapOutOfBounds)
+{
+    parcBuffer_LongBowClipBoard *testData = longBowTestCase_GetClipBoardData(testCase);
+    PARCBuffer *buffer = testData->buffer;
+
+    uint32_t array[1];
+    parcBuffer_GetUint32Array(buffer, SIZE_MAX / 4 + 2, array); // count * 4 wraps around to 4, this will fail.
+}
+
+LONGBOW_TEST_CASE_EXPECTS(Errors, parcBuffer_PutUint16Array_Wraparound, .event = &LongBowTrapOutOfBounds)
+{
+    parcBuffer_LongBowClipBoard *testData = longBowTestCase_GetClipBoardData(testCase);
+    PARCBuffer *buffer = testData->buffer;
+
+    uint16_t array[1] = { 0 };
+    parcBuffer_PutUint16Array(buffer, SIZE_MAX / 2 + 2, array); // count * 2 wraps around to 2, this will fail.
+}
+
+LONGBOW_TEST_CASE_EXPECTS(Errors, parcBuffer_PutUint64_Overflow, .event = &LongBowAssertEvent)
+{
+    parcBuffer_LongBowClipBoard *testData = longBowTestCase_GetClipBoardData(testCase);
+    PARCBuffer *buffer = testData->buffer;
+
+    parcBuffer_SetPosition(buffer, 3);
+
+    parcBuffer_PutUint64(buffer, 0); // this will fail.
+}
+
 LONGBOW_TEST_CASE_EXPECTS(Errors, parcBuffer_Mark_mark_exceeds_position, .event = &LongBowAssertEvent)
 {
     parcBuffer_LongBowClipBoard *testData = longBowTestCase_GetClipBoardData(testCase);
@@ -1419,6 +2057,90 @@ LONGBOW_TEST_CASE_EXPECTS(Errors, parcBuffer_Mark_mark_exceeds_position, .event
     parcBuffer_Reset(buffer);
 }
 
+LONGBOW_TEST_CASE_EXPECTS(Errors, parcBuffer_Freeze_PutUint8, .event = &LongBowTrapUnexpectedStateEvent)
+{
+    parcBuffer_LongBowClipBoard *testData = longBowTestCase_GetClipBoardData(testCase);
+    PARCBuffer *buffer = parcBuffer_Freeze(testData->buffer);
+
+    parcBuffer_PutUint8(buffer, 0); // this will fail.
+}
+
+LONGBOW_TEST_CASE_EXPECTS(Errors, parcBuffer_MapFile_PutUint8, .event = &LongBowTrapUnexpectedStateEvent)
+{
+    parcBuffer_LongBowClipBoard *testData = longBowTestCase_GetClipBoardData(testCase);
+    parcBuffer_Release(&testData->buffer);
+
+    char *pathName = _createMappableFile("Hello, mapped World!");
+    testData->buffer = parcBuffer_MapFile(pathName);
+    unlink(pathName);
+    free(pathName);
+
+    parcBuffer_PutUint8(testData->buffer, 0); // this will fail.
+}
+
+LONGBOW_TEST_CASE_EXPECTS(Errors, parcBuffer_Freeze_PutBuffer, .event = &LongBowTrapUnexpectedStateEvent)
+{
+    parcBuffer_LongBowClipBoard *testData = longBowTestCase_GetClipBoardData(testCase);
+    PARCBuffer *buffer = parcBuffer_Freeze(testData->buffer);
+
+    parcBuffer_PutBuffer(buffer, buffer); // this will fail.
+}
+
+LONGBOW_TEST_CASE_EXPECTS(Errors, parcBuffer_Freeze_Resize, .event = &LongBowTrapUnexpectedStateEvent)
+{
+    parcBuffer_LongBowClipBoard *testData = longBowTestCase_GetClipBoardData(testCase);
+    PARCBuffer *buffer = parcBuffer_Freeze(testData->buffer);
+
+    parcBuffer_Resize(buffer, 20); // this will fail.
+}
+
+LONGBOW_TEST_CASE_EXPECTS(Errors, parcBuffer_GetLEB128_Underflow, .event = &LongBowTrapOutOfBounds)
+{
+    parcBuffer_LongBowClipBoard *testData = longBowTestCase_GetClipBoardData(testCase);
+    PARCBuffer *buffer = testData->buffer;
+
+    parcBuffer_PutUint8(buffer, 0x80);
+    parcBuffer_PutUint8(buffer, 0x80);
+    parcBuffer_Flip(buffer);
+
+    parcBuffer_GetLEB128(buffer); // this will fail.
+}
+
+LONGBOW_TEST_CASE_EXPECTS(Errors, parcBuffer_GetLEB128_TooLong, .event = &LongBowTrapIllegalValue)
+{
+    parcBuffer_LongBowClipBoard *testData = longBowTestCase_GetClipBoardData(testCase);
+    PARCBuffer *buffer = testData->buffer;
+
+    while (parcBuffer_HasRemaining(buffer)) {
+        parcBuffer_PutUint8(buffer, 0x80);
+    }
+    parcBuffer_Flip(buffer);
+
+    parcBuffer_GetLEB128(buffer); // this will fail.
+}
+
+LONGBOW_TEST_CASE_EXPECTS(Errors, parcBuffer_GetLEB128_Overflow, .event = &LongBowTrapIllegalValue)
+{
+    parcBuffer_LongBowClipBoard *testData = longBowTestCase_GetClipBoardData(testCase);
+    PARCBuffer *buffer = testData->buffer;
+
+    for (int i = 0; i < 9; i++) {
+        parcBuffer_PutUint8(buffer, 0xFF);
+    }
+    parcBuffer_PutUint8(buffer, 0x02); // bit 64, one past UINT64_MAX.
+    parcBuffer_Flip(buffer);
+
+    parcBuffer_GetLEB128(buffer); // this will fail.
+}
+
+LONGBOW_TEST_CASE_EXPECTS(Errors, parcBuffer_GetVarint_TooLong, .event = &LongBowTrapIllegalValue)
+{
+    parcBuffer_LongBowClipBoard *testData = longBowTestCase_GetClipBoardData(testCase);
+    PARCBuffer *buffer = testData->buffer;
+
+    parcBuffer_GetVarint(buffer, 9); // this will fail.
+}
+
 
 LONGBOW_TEST_FIXTURE(Static)
 {
@@ -1475,6 +2197,12 @@ LONGBOW_TEST_CASE(Static, _digittoint)
 LONGBOW_TEST_FIXTURE_OPTIONS(Performance, .enabled = false)
 {
     LONGBOW_RUN_TEST_CASE(Performance, parcBuffer_Create);
+    LONGBOW_RUN_TEST_CASE(Performance, parcBuffer_DecodePacketHeaders);
+    LONGBOW_RUN_TEST_CASE(Performance, parcBuffer_SkipOver);
+    LONGBOW_RUN_TEST_CASE(Performance, parcBuffer_Freeze_HashMapKeys);
+    LONGBOW_RUN_TEST_CASE(Performance, parcBuffer_Varint);
+    LONGBOW_RUN_TEST_CASE(Performance, parcBuffer_LEB128);
+    LONGBOW_RUN_TEST_CASE(Performance, parcBuffer_HexString);
 }
 
 LONGBOW_TEST_FIXTURE_SETUP(Performance)
@@ -1505,6 +2233,360 @@ LONGBOW_TEST_CASE(Performance, parcBuffer_Create)
     }
 }
 
+/*
+ * A stream of packets, each a CCNx-style 8 byte fixed header (version, type, packet length,
+ * hop limit, reserved, flags, header length) followed by three 4 byte TLV headers each with a 64-bit value.
+ */
+#define _packetLength (8 + 3 * (4 + 8))
+
+static PARCBuffer *
+_encodePacketHeaders(size_t packets)
+{
+    PARCBuffer *buffer = parcBuffer_Allocate(packets * _packetLength);
+    for (size_t i = 0; i < packets; i++) {
+        parcBuffer_PutUint8(buffer, 1);
+        parcBuffer_PutUint8(buffer, 2);
+        parcBuffer_PutUint16(buffer, _packetLength);
+        parcBuffer_PutUint8(buffer, 255);
+        parcBuffer_PutUint8(buffer, 0);
+        parcBuffer_PutUint8(buffer, 0);
+        parcBuffer_PutUint8(buffer, 8);
+        for (uint16_t type = 1; type <= 3; type++) {
+            parcBuffer_PutUint16(buffer, type);
+            parcBuffer_PutUint16(buffer, 8);
+            parcBuffer_PutUint64(buffer, i);
+        }
+    }
+    return parcBuffer_Flip(buffer);
+}
+
+static uint64_t
+_decodePacketHeaders_Bytewise(PARCBuffer *buffer)
+{
+    uint64_t sum = 0;
+    while (parcBuffer_HasRemaining(buffer)) {
+        parcBuffer_GetUint8(buffer);
+        parcBuffer_GetUint8(buffer);
+        uint16_t packetLength = (uint16_t) (parcBuffer_GetUint8(buffer) << 8);
+        packetLength |= parcBuffer_GetUint8(buffer);
+        for (int i = 0; i < 4; i++) {
+            parcBuffer_GetUint8(buffer);
+        }
+        sum += packetLength;
+        for (int tlv = 0; tlv < 3; tlv++) {
+            uint32_t typeLength = 0;
+            for (int i = 0; i < 4; i++) {
+                typeLength = typeLength << 8 | parcBuffer_GetUint8(buffer);
+            }
+            uint64_t value = 0;
+            for (int i = 0; i < 8; i++) {
+                value = value << 8 | parcBuffer_GetUint8(buffer);
+            }
+            sum += typeLength + value;
+        }
+    }
+    return sum;
+}
+
+static uint64_t
+_decodePacketHeaders_Word(PARCBuffer *buffer)
+{
+    uint64_t sum = 0;
+    while (parcBuffer_HasRemaining(buffer)) {
+        size_t start = parcBuffer_Position(buffer);
+        uint16_t packetLength = parcBuffer_GetUint16AtIndex(buffer, start + 2);
+        parcBuffer_SetPosition(buffer, start + 8);
+        sum += packetLength;
+        for (int tlv = 0; tlv < 3; tlv++) {
+            uint32_t typeLength = parcBuffer_GetUint32(buffer);
+            uint64_t value = parcBuffer_GetUint64(buffer);
+            sum += typeLength + value;
+        }
+    }
+    return sum;
+}
+
+LONGBOW_TEST_CASE(Performance, parcBuffer_DecodePacketHeaders)
+{
+    size_t packets = 100000;
+    int rounds = 20;
+    PARCBuffer *buffer = _encodePacketHeaders(packets);
+
+    struct timeval start, end, bytewise, word;
+    uint64_t sumBytewise = 0;
+    uint64_t sumWord = 0;
+
+    gettimeofday(&start, NULL);
+    for (int round = 0; round < rounds; round++) {
+        sumBytewise += _decodePacketHeaders_Bytewise(parcBuffer_Rewind(buffer));
+    }
+    gettimeofday(&end, NULL);
+    timersub(&end, &start, &bytewise);
+
+    gettimeofday(&start, NULL);
+    for (int round = 0; round < rounds; round++) {
+        sumWord += _decodePacketHeaders_Word(parcBuffer_Rewind(buffer));
+    }
+    gettimeofday(&end, NULL);
+    timersub(&end, &start, &word);
+
+    assertTrue(sumBytewise == sumWord, "Expected both decoders to agree.");
+
+    double packetCount = (double) packets * rounds;
+    double bytewiseSeconds = bytewise.tv_sec + bytewise.tv_usec / 1000000.0;
+    double wordSeconds = word.tv_sec + word.tv_usec / 1000000.0;
+    printf("decode %zu packet headers x %d: bytewise %.0f packets/s, word %.0f packets/s\n",
+           packets, rounds, packetCount / bytewiseSeconds, packetCount / wordSeconds);
+
+    parcBuffer_Release(&buffer);
+}
+
+LONGBOW_TEST_CASE(Performance, parcBuffer_SkipOver)
+{
+    // Indented, pretty-printed JSON: runs of whitespace between short tokens, and long string values.
+    size_t length = 1 << 20;
+    uint8_t *text = parcMemory_Allocate(length);
+    for (size_t i = 0; i < length; i++) {
+        size_t column = i % 64;
+        text[i] = (column < 12) ? ' ' : (column == 63) ? '\n' : 'x';
+    }
+    PARCBuffer *buffer = parcBuffer_Wrap(text, length, 0, length);
+    const uint8_t *whitespace = (const uint8_t *) " \t\r\n";
+
+    int rounds = 200;
+    size_t tokens = 0;
+    struct timeval start, end, elapsed;
+
+    gettimeofday(&start, NULL);
+    for (int round = 0; round < rounds; round++) {
+        parcBuffer_Rewind(buffer);
+        while (parcBuffer_SkipOver(buffer, 4, whitespace) && parcBuffer_SkipTo(buffer, 4, whitespace)) {
+            tokens++;
+        }
+    }
+    gettimeofday(&end, NULL);
+    timersub(&end, &start, &elapsed);
+
+    double seconds = elapsed.tv_sec + elapsed.tv_usec / 1000000.0;
+    printf("SkipOver/SkipTo %zu tokens: %.1f MB/s\n", tokens, (double) length * rounds / seconds / 1000000.0);
+
+    parcBuffer_Release(&buffer);
+    parcMemory_Deallocate(&text);
+}
+
+/*
+ * Fill a PARCHashMap with `count` keys of `length` bytes, then look each of them up `rounds` times,
+ * returning the elapsed seconds.
+ */
+static double
+_hashMapKeys(size_t count, size_t length, int rounds, bool freeze)
+{
+    PARCBuffer **keys = parcMemory_Allocate(count * sizeof(PARCBuffer *));
+    for (size_t i = 0; i < count; i++) {
+        keys[i] = parcBuffer_Allocate(length);
+        for (size_t j = 0; j < length; j++) {
+            parcBuffer_PutUint8(keys[i], (uint8_t) (i * 31 + j));
+        }
+        parcBuffer_PutUint64(parcBuffer_SetPosition(keys[i], length - sizeof(uint64_t)), i);
+        parcBuffer_Flip(keys[i]);
+        if (freeze) {
+            parcBuffer_Freeze(keys[i]);
+        }
+    }
+
+    struct timeval start, end, elapsed;
+    gettimeofday(&start, NULL);
+
+    PARCHashMap *map = parcHashMap_CreateCapacity((unsigned int) count);
+    for (size_t i = 0; i < count; i++) {
+        parcHashMap_Put(map, keys[i], keys[i]);
+    }
+
+    size_t found = 0;
+    for (int round = 0; round < rounds; round++) {
+        for (size_t i = 0; i < count; i++) {
+            if (parcHashMap_Get(map, keys[i]) != NULL) {
+                found++;
+            }
+        }
+    }
+
+    gettimeofday(&end, NULL);
+    timersub(&end, &start, &elapsed);
+
+    assertTrue(found == count * rounds, "Expected to find every key, found %zu", found);
+
+    parcHashMap_Release(&map);
+    for (size_t i = 0; i < count; i++) {
+        parcBuffer_Release(&keys[i]);
+    }
+    parcMemory_Deallocate(&keys);
+
+    return elapsed.tv_sec + elapsed.tv_usec / 1000000.0;
+}
+
+LONGBOW_TEST_CASE(Performance, parcBuffer_Freeze_HashMapKeys)
+{
+    size_t count = 10000;
+    size_t length = 256;
+    int rounds = 100;
+
+    double plain = _hashMapKeys(count, length, rounds, false);
+    double frozen = _hashMapKeys(count, length, rounds, true);
+
+    double lookups = (double) count * rounds;
+    printf("PARCHashMap %zu keys of %zu bytes x %d: plain %.0f lookups/s, frozen %.0f lookups/s\n",
+           count, length, rounds, lookups / plain, lookups / frozen);
+}
+
+static double
+_seconds(const struct timeval *start, const struct timeval *end)
+{
+    struct timeval elapsed;
+    timersub(end, start, &elapsed);
+    return elapsed.tv_sec + elapsed.tv_usec / 1000000.0;
+}
+
+/*
+ * TLV-like values: mostly small, with a tail of larger ones.
+ */
+static uint64_t
+_varintValue(size_t i)
+{
+    uint64_t x = (uint64_t) i * 0x9E3779B97F4A7C15ULL;
+    switch (i % 10) {
+        case 0:
+            return x >> 24;
+        case 1:
+        case 2:
+            return x >> 50;
+        default:
+            return x >> 57;
+    }
+}
+
+LONGBOW_TEST_CASE(Performance, parcBuffer_Varint)
+{
+    size_t count = 1000000;
+    PARCBuffer *buffer = parcBuffer_Allocate(count * (2 + sizeof(uint64_t)));
+    for (size_t i = 0; i < count; i++) {
+        uint64_t value = _varintValue(i);
+        parcBuffer_PutUint16(buffer, (uint16_t) parcBuffer_VarintLength(value));
+        parcBuffer_PutVarint(buffer, value);
+    }
+    parcBuffer_Flip(buffer);
+
+    struct timeval start, end;
+    uint64_t sumVarint = 0;
+    uint64_t sumValue = 0;
+
+    gettimeofday(&start, NULL);
+    while (parcBuffer_HasRemaining(buffer)) {
+        PARCVarint *varint = parcVarint_DecodeBuffer(buffer, parcBuffer_GetUint16(buffer));
+        sumVarint += parcVarint_AsUint64(varint);
+        parcVarint_Destroy(&varint);
+    }
+    gettimeofday(&end, NULL);
+    double varintSeconds = _seconds(&start, &end);
+
+    parcBuffer_Rewind(buffer);
+    gettimeofday(&start, NULL);
+    while (parcBuffer_HasRemaining(buffer)) {
+        sumValue += parcBuffer_GetVarint(buffer, parcBuffer_GetUint16(buffer));
+    }
+    gettimeofday(&end, NULL);
+    double valueSeconds = _seconds(&start, &end);
+
+    assertTrue(sumVarint == sumValue, "Expected both decoders to agree.");
+    printf("big-endian varint %zu values: PARCVarint %.0f values/s, parcBuffer_GetVarint %.0f values/s\n",
+           count, count / varintSeconds, count / valueSeconds);
+
+    parcBuffer_Release(&buffer);
+}
+
+LONGBOW_TEST_CASE(Performance, parcBuffer_LEB128)
+{
+    size_t count = 1000000;
+    int rounds = 10;
+    uint64_t *values = parcMemory_Allocate(count * sizeof(uint64_t));
+    PARCBuffer *buffer = parcBuffer_Allocate(count * _parcLEB128_MaxLength);
+
+    struct timeval start, end;
+    gettimeofday(&start, NULL);
+    for (size_t i = 0; i < count; i++) {
+        parcBuffer_PutLEB128(buffer, _varintValue(i));
+    }
+    gettimeofday(&end, NULL);
+    double encodeSeconds = _seconds(&start, &end);
+    parcBuffer_Flip(buffer);
+
+    uint64_t sumSingle = 0;
+    gettimeofday(&start, NULL);
+    for (int round = 0; round < rounds; round++) {
+        parcBuffer_Rewind(buffer);
+        for (size_t i = 0; i < count; i++) {
+            sumSingle += parcBuffer_GetLEB128(buffer);
+        }
+    }
+    gettimeofday(&end, NULL);
+    double singleSeconds = _seconds(&start, &end);
+
+    uint64_t sumArray = 0;
+    gettimeofday(&start, NULL);
+    for (int round = 0; round < rounds; round++) {
+        parcBuffer_GetLEB128Array(parcBuffer_Rewind(buffer), count, values);
+        for (size_t i = 0; i < count; i++) {
+            sumArray += values[i];
+        }
+    }
+    gettimeofday(&end, NULL);
+    double arraySeconds = _seconds(&start, &end);
+
+    assertTrue(sumSingle == sumArray, "Expected both decoders to agree.");
+    printf("LEB128 %zu values in %zu bytes: encode %.0f values/s, decode %.0f values/s, array decode %.0f values/s\n",
+           count, parcBuffer_Limit(buffer), count / encodeSeconds,
+           count * rounds / singleSeconds, count * rounds / arraySeconds);
+
+    parcBuffer_Release(&buffer);
+    parcMemory_Deallocate(&values);
+}
+
+LONGBOW_TEST_CASE(Performance, parcBuffer_HexString)
+{
+    size_t length = 1 << 20;
+    int rounds = 20;
+    PARCBuffer *buffer = parcBuffer_Allocate(length);
+    for (size_t i = 0; i < length; i++) {
+        parcBuffer_PutUint8(buffer, (uint8_t) (i * 37 + 11));
+    }
+    parcBuffer_Flip(buffer);
+
+    struct timeval start, end;
+    gettimeofday(&start, NULL);
+    for (int round = 0; round < rounds; round++) {
+        char *hexString = parcBuffer_ToHexString(buffer);
+        parcMemory_Deallocate(&hexString);
+    }
+    gettimeofday(&end, NULL);
+    double toSeconds = _seconds(&start, &end);
+
+    char *hexString = parcBuffer_ToHexString(buffer);
+    gettimeofday(&start, NULL);
+    for (int round = 0; round < rounds; round++) {
+        PARCBuffer *parsed = parcBuffer_ParseHexString(hexString);
+        parcBuffer_Release(&parsed);
+    }
+    gettimeofday(&end, NULL);
+    double parseSeconds = _seconds(&start, &end);
+
+    double megabytes = (double) length * rounds / 1000000.0;
+    printf("hex %zu bytes x %d: ToHexString %.1f MB/s, ParseHexString %.1f MB/s\n",
+           length, rounds, megabytes / toSeconds, megabytes / parseSeconds);
+
+    parcMemory_Deallocate(&hexString);
+    parcBuffer_Release(&buffer);
+}
+
 int
 main(int argc, char *argv[argc])
 {
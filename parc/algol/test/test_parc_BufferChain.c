@@ -0,0 +1,338 @@
+/*
+ * Copyright (c) 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Patent rights are not granted under this agreement. Patent rights are
+ *       available under FRAND terms.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX or PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * @copyright 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC).  All rights reserved.
+ */
+#include "../parc_BufferChain.c"
+
+#include <LongBow/testing.h>
+#include <LongBow/debugging.h>
+#include <parc/algol/parc_Memory.h>
+#include <parc/algol/parc_SafeMemory.h>
+
+#include <parc/testing/parc_MemoryTesting.h>
+#include <parc/testing/parc_ObjectTesting.h>
+
+LONGBOW_TEST_RUNNER(parc_BufferChain)
+{
+    LONGBOW_RUN_TEST_FIXTURE(CreateAcquireRelease);
+    LONGBOW_RUN_TEST_FIXTURE(Global);
+}
+
+LONGBOW_TEST_RUNNER_SETUP(parc_BufferChain)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_RUNNER_TEARDOWN(parc_BufferChain)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_FIXTURE(CreateAcquireRelease)
+{
+    LONGBOW_RUN_TEST_CASE(CreateAcquireRelease, CreateRelease);
+}
+
+LONGBOW_TEST_FIXTURE_SETUP(CreateAcquireRelease)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_FIXTURE_TEARDOWN(CreateAcquireRelease)
+{
+    if (!parcMemoryTesting_ExpectedOutstanding(0, "%s leaked memory.", longBowTestCase_GetFullName(testCase))) {
+        return LONGBOW_STATUS_MEMORYLEAK;
+    }
+
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_CASE(CreateAcquireRelease, CreateRelease)
+{
+    PARCBufferChain *instance = parcBufferChain_Create();
+    assertNotNull(instance, "Expected non-null result from parcBufferChain_Create().");
+
+    parcObjectTesting_AssertAcquireReleaseContract(parcBufferChain_Acquire, instance);
+
+    parcBufferChain_Release(&instance);
+    assertNull(instance, "Expected null result from parcBufferChain_Release().");
+}
+
+LONGBOW_TEST_FIXTURE(Global)
+{
+    LONGBOW_RUN_TEST_CASE(Global, parcBufferChain_Display);
+    LONGBOW_RUN_TEST_CASE(Global, parcBufferChain_IsValid);
+    LONGBOW_RUN_TEST_CASE(Global, parcBufferChain_Append);
+    LONGBOW_RUN_TEST_CASE(Global, parcBufferChain_Append_Empty);
+    LONGBOW_RUN_TEST_CASE(Global, parcBufferChain_Append_ZeroCopy);
+    LONGBOW_RUN_TEST_CASE(Global, parcBufferChain_Prepend);
+    LONGBOW_RUN_TEST_CASE(Global, parcBufferChain_AppendChain);
+    LONGBOW_RUN_TEST_CASE(Global, parcBufferChain_Grow);
+    LONGBOW_RUN_TEST_CASE(Global, parcBufferChain_Slice);
+    LONGBOW_RUN_TEST_CASE(Global, parcBufferChain_Consume);
+    LONGBOW_RUN_TEST_CASE(Global, parcBufferChain_GetIOVec);
+    LONGBOW_RUN_TEST_CASE(Global, parcBufferChain_Equals);
+    LONGBOW_RUN_TEST_CASE(Global, parcBufferChain_ForEach);
+}
+
+LONGBOW_TEST_FIXTURE_SETUP(Global)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_FIXTURE_TEARDOWN(Global)
+{
+    if (!parcMemoryTesting_ExpectedOutstanding(0, "%s mismanaged memory.", longBowTestCase_GetFullName(testCase))) {
+        return LONGBOW_STATUS_MEMORYLEAK;
+    }
+
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+static PARCBufferChain *
+_createChain(const char *segments[])
+{
+    PARCBufferChain *result = parcBufferChain_Create();
+    for (int i = 0; segments[i] != NULL; i++) {
+        PARCBuffer *buffer = parcBuffer_WrapCString((char *) segments[i]);
+        parcBufferChain_Append(result, buffer);
+        parcBuffer_Release(&buffer);
+    }
+    return result;
+}
+
+static void
+_assertChainContents(const PARCBufferChain *chain, const char *expected)
+{
+    PARCBuffer *buffer = parcBufferChain_ToBuffer(chain);
+    char *actual = parcBuffer_ToString(buffer);
+    assertTrue(strcmp(actual, expected) == 0, "Expected '%s', actual '%s'", expected, actual);
+    parcMemory_Deallocate(&actual);
+    parcBuffer_Release(&buffer);
+}
+
+LONGBOW_TEST_CASE(Global, parcBufferChain_Display)
+{
+    PARCBufferChain *chain = _createChain((const char *[]) { "Hello", " World", NULL });
+    parcBufferChain_Display(chain, 0);
+    parcBufferChain_Release(&chain);
+}
+
+LONGBOW_TEST_CASE(Global, parcBufferChain_IsValid)
+{
+    PARCBufferChain *instance = parcBufferChain_Create();
+    assertTrue(parcBufferChain_IsValid(instance), "Expected parcBufferChain_Create to result in a valid instance.");
+
+    parcBufferChain_Release(&instance);
+    assertFalse(parcBufferChain_IsValid(instance), "Expected parcBufferChain_Release to result in an invalid instance.");
+}
+
+LONGBOW_TEST_CASE(Global, parcBufferChain_Append)
+{
+    PARCBufferChain *chain = _createChain((const char *[]) { "Hello", " ", "World", NULL });
+
+    assertTrue(parcBufferChain_GetSegmentCount(chain) == 3, "Expected 3 segments, actual %zu", parcBufferChain_GetSegmentCount(chain));
+    assertTrue(parcBufferChain_Length(chain) == 11, "Expected length 11, actual %zu", parcBufferChain_Length(chain));
+    _assertChainContents(chain, "Hello World");
+
+    parcBufferChain_Release(&chain);
+}
+
+LONGBOW_TEST_CASE(Global, parcBufferChain_Append_Empty)
+{
+    PARCBufferChain *chain = _createChain((const char *[]) { "Hello", "", "World", NULL });
+
+    assertTrue(parcBufferChain_GetSegmentCount(chain) == 2, "Expected empty buffers to be ignored.");
+
+    parcBufferChain_Release(&chain);
+}
+
+LONGBOW_TEST_CASE(Global, parcBufferChain_Append_ZeroCopy)
+{
+    PARCBuffer *buffer = parcBuffer_AllocateCString("xxHello");
+    parcBuffer_SetPosition(buffer, 2);
+
+    PARCBufferChain *chain = parcBufferChain_Create();
+    parcBufferChain_Append(chain, buffer);
+
+    parcBuffer_SetPosition(buffer, 0);
+    assertTrue(parcBufferChain_Length(chain) == 5, "Expected the chain to be unaffected by the buffer's position.");
+
+    parcBuffer_PutAtIndex(buffer, 2, 'J');
+    _assertChainContents(chain, "Jello");
+
+    parcBufferChain_Release(&chain);
+    parcBuffer_Release(&buffer);
+}
+
+LONGBOW_TEST_CASE(Global, parcBufferChain_Prepend)
+{
+    PARCBufferChain *chain = _createChain((const char *[]) { "payload", NULL });
+
+    PARCBuffer *header = parcBuffer_WrapCString("header:");
+    PARCBuffer *fixed = parcBuffer_WrapCString("fixed:");
+    parcBufferChain_Prepend(chain, header);
+    parcBufferChain_Prepend(chain, fixed);
+
+    _assertChainContents(chain, "fixed:header:payload");
+    assertTrue(parcBufferChain_GetSegmentCount(chain) == 3, "Expected 3 segments, actual %zu", parcBufferChain_GetSegmentCount(chain));
+
+    parcBuffer_Release(&header);
+    parcBuffer_Release(&fixed);
+    parcBufferChain_Release(&chain);
+}
+
+LONGBOW_TEST_CASE(Global, parcBufferChain_AppendChain)
+{
+    PARCBufferChain *chain = _createChain((const char *[]) { "a", "b", NULL });
+
+    parcBufferChain_AppendChain(chain, chain);
+
+    _assertChainContents(chain, "abab");
+
+    parcBufferChain_Release(&chain);
+}
+
+LONGBOW_TEST_CASE(Global, parcBufferChain_Grow)
+{
+    PARCBufferChain *chain = parcBufferChain_Create();
+    PARCBuffer *a = parcBuffer_WrapCString("a");
+    PARCBuffer *b = parcBuffer_WrapCString("b");
+
+    for (int i = 0; i < 50; i++) {
+        parcBufferChain_Append(chain, b);
+        parcBufferChain_Prepend(chain, a);
+    }
+
+    assertTrue(parcBufferChain_Length(chain) == 100, "Expected length 100, actual %zu", parcBufferChain_Length(chain));
+    assertTrue(parcBuffer_GetAtIndex(parcBufferChain_GetSegment(chain, 49), 0) == 'a', "Expected the first half to be prepended segments.");
+    assertTrue(parcBuffer_GetAtIndex(parcBufferChain_GetSegment(chain, 50), 0) == 'b', "Expected the second half to be appended segments.");
+
+    parcBuffer_Release(&a);
+    parcBuffer_Release(&b);
+    parcBufferChain_Release(&chain);
+}
+
+LONGBOW_TEST_CASE(Global, parcBufferChain_Slice)
+{
+    PARCBufferChain *chain = _createChain((const char *[]) { "Hello", " ", "World", NULL });
+
+    PARCBufferChain *slice = parcBufferChain_Slice(chain, 3, 6);
+    _assertChainContents(slice, "lo Wor");
+    assertTrue(parcBufferChain_GetSegmentCount(slice) == 3, "Expected 3 segments, actual %zu", parcBufferChain_GetSegmentCount(slice));
+    parcBufferChain_Release(&slice);
+
+    slice = parcBufferChain_Slice(chain, 6, 5);
+    _assertChainContents(slice, "World");
+    assertTrue(parcBufferChain_GetSegmentCount(slice) == 1, "Expected 1 segment, actual %zu", parcBufferChain_GetSegmentCount(slice));
+    parcBufferChain_Release(&slice);
+
+    slice = parcBufferChain_Slice(chain, 11, 0);
+    assertTrue(parcBufferChain_Length(slice) == 0, "Expected an empty slice.");
+    parcBufferChain_Release(&slice);
+
+    _assertChainContents(chain, "Hello World");
+    parcBufferChain_Release(&chain);
+}
+
+LONGBOW_TEST_CASE(Global, parcBufferChain_Consume)
+{
+    PARCBufferChain *chain = _createChain((const char *[]) { "Hello", " ", "World", NULL });
+
+    parcBufferChain_Consume(chain, 3);
+    _assertChainContents(chain, "lo World");
+    assertTrue(parcBufferChain_GetSegmentCount(chain) == 3, "Expected 3 segments, actual %zu", parcBufferChain_GetSegmentCount(chain));
+
+    parcBufferChain_Consume(chain, 3);
+    _assertChainContents(chain, "World");
+    assertTrue(parcBufferChain_GetSegmentCount(chain) == 1, "Expected 1 segment, actual %zu", parcBufferChain_GetSegmentCount(chain));
+
+    parcBufferChain_Consume(chain, 5);
+    assertTrue(parcBufferChain_Length(chain) == 0, "Expected an empty chain.");
+    assertTrue(parcBufferChain_GetSegmentCount(chain) == 0, "Expected no segments.");
+
+    parcBufferChain_Release(&chain);
+}
+
+LONGBOW_TEST_CASE(Global, parcBufferChain_GetIOVec)
+{
+    PARCBufferChain *chain = _createChain((const char *[]) { "Hello", " ", "World", NULL });
+
+    struct iovec iov[2];
+    size_t count = parcBufferChain_GetIOVec(chain, 2, iov);
+
+    assertTrue(count == 2, "Expected 2 elements, actual %zu", count);
+    assertTrue(iov[0].iov_len == 5 && memcmp(iov[0].iov_base, "Hello", 5) == 0, "Expected the first segment.");
+    assertTrue(iov[1].iov_len == 1 && memcmp(iov[1].iov_base, " ", 1) == 0, "Expected the second segment.");
+
+    parcBufferChain_Release(&chain);
+}
+
+LONGBOW_TEST_CASE(Global, parcBufferChain_Equals)
+{
+    PARCBufferChain *x = _createChain((const char *[]) { "Hello", " ", "World", NULL });
+    PARCBufferChain *y = _createChain((const char *[]) { "He", "llo Wo", "rld", NULL });
+    PARCBufferChain *z = _createChain((const char *[]) { "Hello World", NULL });
+    PARCBufferChain *u1 = _createChain((const char *[]) { "Hello", " ", "Worle", NULL });
+    PARCBufferChain *u2 = _createChain((const char *[]) { "Hello", NULL });
+
+    parcObjectTesting_AssertEqualsFunction(parcBufferChain_Equals, x, y, z, u1, u2, NULL);
+
+    parcBufferChain_Release(&x);
+    parcBufferChain_Release(&y);
+    parcBufferChain_Release(&z);
+    parcBufferChain_Release(&u1);
+    parcBufferChain_Release(&u2);
+}
+
+LONGBOW_TEST_CASE(Global, parcBufferChain_ForEach)
+{
+    PARCBufferChain *chain = _createChain((const char *[]) { "Hello", " ", "World", NULL });
+
+    size_t total = 0;
+    size_t count = 0;
+    PARCBuffer *segment;
+    parcBufferChain_ForEach(chain, segment) {
+        total += parcBuffer_Remaining(segment);
+        count++;
+    }
+
+    assertTrue(count == 3, "Expected 3 segments, actual %zu", count);
+    assertTrue(total == 11, "Expected 11 bytes, actual %zu", total);
+
+    parcBufferChain_Release(&chain);
+}
+
+int
+main(int argc, char *argv[argc])
+{
+    LongBowRunner *testRunner = LONGBOW_TEST_RUNNER_CREATE(parc_BufferChain);
+    int exitStatus = longBowMain(argc, argv, testRunner, NULL);
+    longBowTestRunner_Destroy(&testRunner);
+    exit(exitStatus);
+}
@@ -60,6 +60,7 @@ LONGBOW_TEST_FIXTURE(Global)
 {
     LONGBOW_RUN_TEST_CASE(Global, parc_Chunker_CreateFromBuffer);
     LONGBOW_RUN_TEST_CASE(Global, parc_Chunker_ForwardIterator_Buffer);
+    LONGBOW_RUN_TEST_CASE(Global, parc_Chunker_ForwardIterator_BufferTwice);
     LONGBOW_RUN_TEST_CASE(Global, parc_Chunker_ForwardIterator_BufferPartial);
     LONGBOW_RUN_TEST_CASE(Global, parc_Chunker_ForwardIterator_BufferSmall);
     LONGBOW_RUN_TEST_CASE(Global, parc_Chunker_ReverseIterator_Buffer);
@@ -131,6 +132,37 @@ LONGBOW_TEST_CASE(Global, parc_Chunker_ForwardIterator_Buffer)
     parcBuffer_Release(&buffer);
 }
 
+LONGBOW_TEST_CASE(Global, parc_Chunker_ForwardIterator_BufferTwice)
+{
+    PARCBuffer *buffer = parcBuffer_Allocate(1000);
+    for (size_t i = 0; i < 1000; i++) {
+        parcBuffer_PutUint8(buffer, (uint8_t) i);
+    }
+    parcBuffer_Flip(buffer);
+
+    PARCBufferChunker *chunker = parcBufferChunker_Create(buffer, 32);
+
+    // Iterating must not disturb the chunker, so a second iterator sees the same chunks.
+    for (int pass = 0; pass < 2; pass++) {
+        PARCIterator *itr = parcBufferChunker_ForwardIterator(chunker);
+        size_t total = 0;
+        while (parcIterator_HasNext(itr)) {
+            PARCBuffer *payload = (PARCBuffer *) parcIterator_Next(itr);
+            for (size_t i = 0; i < parcBuffer_Remaining(payload); i++) {
+                assertTrue(parcBuffer_GetAtIndex(payload, i) == (uint8_t) (total + i),
+                           "Pass %d: unexpected byte at offset %zu", pass, total + i);
+            }
+            total += parcBuffer_Remaining(payload);
+            parcBuffer_Release(&payload);
+        }
+        assertTrue(total == 1000, "Pass %d: expected 1000 bytes, got %zu", pass, total);
+        parcIterator_Release(&itr);
+    }
+
+    parcBufferChunker_Release(&chunker);
+    parcBuffer_Release(&buffer);
+}
+
 LONGBOW_TEST_CASE(Global, parc_Chunker_ForwardIterator_BufferPartial)
 {
     // Allocate something that's not divisible by the chunk size
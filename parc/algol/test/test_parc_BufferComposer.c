@@ -30,6 +30,7 @@
 #include "../parc_BufferComposer.c"
 
 #include <inttypes.h>
+#include <sys/time.h>
 #include <LongBow/unit-test.h>
 #include <LongBow/debugging.h>
 
@@ -72,6 +73,7 @@ LONGBOW_TEST_RUNNER(parc_BufferComposer)
     // Test Fixtures are run in the order specified, but all tests should be idempotent.
     // Never rely on the execution order of tests or share state between them.
     LONGBOW_RUN_TEST_FIXTURE(Global);
+    LONGBOW_RUN_TEST_FIXTURE(Performance);
 }
 
 // The Test Runner calls this function once before any Test Fixtures are run.
@@ -111,6 +113,16 @@ LONGBOW_TEST_FIXTURE(Global)
     LONGBOW_RUN_TEST_CASE(Global, parcBufferComposer_ProduceBuffer);
     LONGBOW_RUN_TEST_CASE(Global, parcBufferComposer_PutString_Extend);
     LONGBOW_RUN_TEST_CASE(Global, parcBufferComposer_ToString);
+    LONGBOW_RUN_TEST_CASE(Global, parcBufferComposer_Format_Extend);
+    LONGBOW_RUN_TEST_CASE(Global, parcBufferComposer_Format_Full);
+    LONGBOW_RUN_TEST_CASE(Global, parcBufferComposer_Growth);
+    LONGBOW_RUN_TEST_CASE(Global, parcBufferComposer_ProduceBufferChain);
+    LONGBOW_RUN_TEST_CASE(Global, parcBufferComposer_CreateRope);
+    LONGBOW_RUN_TEST_CASE(Global, parcBufferComposer_Rope_ProduceBufferChain);
+    LONGBOW_RUN_TEST_CASE(Global, parcBufferComposer_Rope_ProduceBuffer);
+    LONGBOW_RUN_TEST_CASE(Global, parcBufferComposer_Rope_Equals);
+    LONGBOW_RUN_TEST_CASE(Global, parcBufferComposer_Rope_ToString);
+    LONGBOW_RUN_TEST_CASE(Global, parcBufferComposer_ReserveCommit);
 }
 
 LONGBOW_TEST_FIXTURE_SETUP(Global)
@@ -449,6 +461,236 @@ LONGBOW_TEST_CASE(Global, parcBufferComposer_PutString_Extend)
     parcBufferComposer_Release(&composer);
 }
 
+LONGBOW_TEST_CASE(Global, parcBufferComposer_Format_Extend)
+{
+    PARCBufferComposer *composer = parcBufferComposer_Allocate(8);
+    parcBufferComposer_PutString(composer, "abc");
+    parcBufferComposer_Format(composer, "%s-%d-%s", "hello", 12345, "world");
+
+    char *actual = parcBufferComposer_ToString(composer);
+    assertTrue(strcmp("abchello-12345-world", actual) == 0, "Expected strings to match. Got %s", actual);
+
+    parcMemory_Deallocate((void **) &actual);
+    parcBufferComposer_Release(&composer);
+}
+
+LONGBOW_TEST_CASE(Global, parcBufferComposer_Format_Full)
+{
+    PARCBufferComposer *composer = parcBufferComposer_Allocate(8);
+    parcBufferComposer_PutString(composer, "12345678");
+    parcBufferComposer_Format(composer, "%d", 9);
+
+    char *actual = parcBufferComposer_ToString(composer);
+    assertTrue(strcmp("123456789", actual) == 0, "Expected strings to match. Got %s", actual);
+
+    parcMemory_Deallocate((void **) &actual);
+    parcBufferComposer_Release(&composer);
+}
+
+LONGBOW_TEST_CASE(Global, parcBufferComposer_Growth)
+{
+    PARCBufferComposer *composer = parcBufferComposer_Allocate(16);
+
+    // Geometric growth means the capacity changes only a logarithmic number of times.
+    size_t resizes = 0;
+    size_t capacity = parcBuffer_Capacity(composer->buffer);
+    for (int i = 0; i < 100000; i++) {
+        parcBufferComposer_PutChar(composer, (char) ('a' + i % 26));
+        if (parcBuffer_Capacity(composer->buffer) != capacity) {
+            capacity = parcBuffer_Capacity(composer->buffer);
+            resizes++;
+        }
+    }
+    assertTrue(resizes <= 20, "Expected at most 20 resizes, actual %zd", resizes);
+
+    PARCBuffer *buffer = parcBufferComposer_ProduceBuffer(composer);
+    assertTrue(parcBuffer_Remaining(buffer) == 100000, "Expected 100000 bytes, actual %zd", parcBuffer_Remaining(buffer));
+    for (int i = 0; i < 100000; i++) {
+        assertTrue(parcBuffer_GetUint8(buffer) == (uint8_t) ('a' + i % 26), "Unexpected byte at %d", i);
+    }
+
+    parcBuffer_Release(&buffer);
+    parcBufferComposer_Release(&composer);
+}
+
+LONGBOW_TEST_CASE(Global, parcBufferComposer_ProduceBufferChain)
+{
+    PARCBufferComposer *composer = parcBufferComposer_Create();
+    parcBufferComposer_PutString(composer, "hello world");
+
+    PARCBufferChain *chain = parcBufferComposer_ProduceBufferChain(composer);
+    assertTrue(parcBufferChain_GetSegmentCount(chain) == 1,
+               "Expected 1 segment, actual %zd", parcBufferChain_GetSegmentCount(chain));
+
+    PARCBuffer *expected = parcBuffer_WrapCString("hello world");
+    PARCBuffer *actual = parcBufferChain_ToBuffer(chain);
+    assertTrue(parcBuffer_Equals(expected, actual), "Expected the chain to hold the composed bytes.");
+
+    parcBuffer_Release(&actual);
+    parcBuffer_Release(&expected);
+    parcBufferChain_Release(&chain);
+    parcBufferComposer_Release(&composer);
+}
+
+LONGBOW_TEST_CASE(Global, parcBufferComposer_CreateRope)
+{
+    PARCBufferComposer *composer = parcBufferComposer_CreateRope(16);
+    assertNotNull(composer, "Expected a non-NULL PARCBufferComposer.");
+    parcBufferComposer_AssertValid(composer);
+
+    parcObjectTesting_AssertAcquireReleaseContract(parcBufferComposer_Acquire, composer);
+
+    parcBufferComposer_Release(&composer);
+}
+
+static PARCBufferComposer *
+_composeRope(size_t segmentSize, const char *expected)
+{
+    PARCBufferComposer *composer = parcBufferComposer_CreateRope(segmentSize);
+    for (const char *p = expected; *p != 0; p++) {
+        parcBufferComposer_PutChar(composer, *p);
+    }
+    return composer;
+}
+
+LONGBOW_TEST_CASE(Global, parcBufferComposer_Rope_ProduceBufferChain)
+{
+    const char *expected = "The quick brown fox jumps over the lazy dog";
+    PARCBufferComposer *composer = _composeRope(8, expected);
+
+    PARCBufferChain *chain = parcBufferComposer_ProduceBufferChain(composer);
+    PARCBuffer *lastSegment = parcBufferChain_GetSegment(chain, parcBufferChain_GetSegmentCount(chain) - 1);
+    assertTrue(parcBuffer_Array(lastSegment) == parcBuffer_Array(composer->buffer),
+               "Expected the chain to reference the composer's segment rather than a copy.");
+    assertTrue(parcBufferChain_GetSegmentCount(chain) > 1,
+               "Expected more than one segment, actual %zd", parcBufferChain_GetSegmentCount(chain));
+    assertTrue(parcBufferChain_Length(chain) == strlen(expected),
+               "Expected length %zd, actual %zd", strlen(expected), parcBufferChain_Length(chain));
+
+    PARCBuffer *buffer = parcBufferChain_ToBuffer(chain);
+    char *actual = parcBuffer_ToString(buffer);
+    assertTrue(strcmp(expected, actual) == 0, "Expected strings to match. Got %s", actual);
+
+    parcMemory_Deallocate((void **) &actual);
+    parcBuffer_Release(&buffer);
+    parcBufferChain_Release(&chain);
+    parcBufferComposer_Release(&composer);
+}
+
+LONGBOW_TEST_CASE(Global, parcBufferComposer_Rope_ProduceBuffer)
+{
+    const char *expected = "The quick brown fox jumps over the lazy dog";
+    PARCBufferComposer *composer = _composeRope(8, expected);
+    parcBufferComposer_PutString(composer, "!");
+
+    PARCBuffer *buffer = parcBufferComposer_ProduceBuffer(composer);
+    char *actual = parcBuffer_ToString(buffer);
+    assertTrue(strncmp(expected, actual, strlen(expected)) == 0, "Expected strings to match. Got %s", actual);
+    assertTrue(strcmp(&actual[strlen(expected)], "!") == 0, "Expected the final put to be present. Got %s", actual);
+
+    parcMemory_Deallocate((void **) &actual);
+    parcBuffer_Release(&buffer);
+    parcBufferComposer_Release(&composer);
+}
+
+LONGBOW_TEST_CASE(Global, parcBufferComposer_Rope_Equals)
+{
+    const char *expected = "The quick brown fox jumps over the lazy dog";
+    PARCBufferComposer *x = _composeRope(8, expected);
+    PARCBufferComposer *y = _composeRope(8, expected);
+
+    assertTrue(parcBufferComposer_Equals(x, y), "Expected rope composers with the same contents to be equal.");
+
+    parcBufferComposer_PutChar(y, '!');
+    assertFalse(parcBufferComposer_Equals(x, y), "Expected rope composers with different contents to be unequal.");
+
+    parcBufferComposer_Release(&x);
+    parcBufferComposer_Release(&y);
+}
+
+LONGBOW_TEST_CASE(Global, parcBufferComposer_Rope_ToString)
+{
+    const char *expected = "The quick brown fox jumps over the lazy dog";
+    PARCBufferComposer *composer = _composeRope(8, expected);
+    parcBufferComposer_Format(composer, " %d times", 42);
+
+    char *actual = parcBufferComposer_ToString(composer);
+    assertTrue(strcmp("The quick brown fox jumps over the lazy dog 42 times", actual) == 0, "Expected strings to match. Got %s", actual);
+
+    parcMemory_Deallocate((void **) &actual);
+    parcBufferComposer_Release(&composer);
+}
+
+LONGBOW_TEST_CASE(Global, parcBufferComposer_ReserveCommit)
+{
+    PARCBufferComposer *composer = parcBufferComposer_Create();
+    parcBufferComposer_PutString(composer, "head ");
+
+    char *space = parcBufferComposer_Reserve(composer, 1000);
+    assertNotNull(space, "Expected space for 1000 bytes");
+    assertTrue(parcBuffer_Remaining(parcBufferComposer_GetBuffer(composer)) >= 1000, "Expected at least 1000 bytes remaining");
+    memcpy(space, "tail", 4);
+    parcBufferComposer_Commit(composer, 4);
+
+    char *actual = parcBufferComposer_ToString(composer);
+    assertTrue(strcmp("head tail", actual) == 0, "Expected 'head tail', actual '%s'", actual);
+
+    parcMemory_Deallocate((void **) &actual);
+    parcBufferComposer_Release(&composer);
+}
+
+LONGBOW_TEST_FIXTURE_OPTIONS(Performance, .enabled = false)
+{
+    LONGBOW_RUN_TEST_CASE(Performance, parcBufferComposer_PutString);
+}
+
+LONGBOW_TEST_FIXTURE_SETUP(Performance)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_FIXTURE_TEARDOWN(Performance)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+static double
+_composeStrings(PARCBufferComposer *composer, size_t count)
+{
+    struct timeval start;
+    gettimeofday(&start, NULL);
+    for (size_t i = 0; i < count; i++) {
+        parcBufferComposer_PutString(composer, "{\"key\":");
+        parcBufferComposer_Format(composer, "%zd", i);
+        parcBufferComposer_PutString(composer, "},");
+    }
+    struct timeval end;
+    gettimeofday(&end, NULL);
+    timersub(&end, &start, &end);
+
+    return end.tv_sec + end.tv_usec / 1000000.0;
+}
+
+LONGBOW_TEST_CASE(Performance, parcBufferComposer_PutString)
+{
+    size_t count = 1000000;
+
+    PARCBufferComposer *composer = parcBufferComposer_Create();
+    double elapsed = _composeStrings(composer, count);
+    PARCBuffer *buffer = parcBufferComposer_ProduceBuffer(composer);
+    printf("contiguous: %zd entries, %zd bytes in %f seconds\n", count, parcBuffer_Remaining(buffer), elapsed);
+    parcBuffer_Release(&buffer);
+    parcBufferComposer_Release(&composer);
+
+    composer = parcBufferComposer_CreateRope(64 * 1024);
+    elapsed = _composeStrings(composer, count);
+    PARCBufferChain *chain = parcBufferComposer_ProduceBufferChain(composer);
+    printf("rope:       %zd entries, %zd bytes in %zd segments in %f seconds\n",
+           count, parcBufferChain_Length(chain), parcBufferChain_GetSegmentCount(chain), elapsed);
+    parcBufferChain_Release(&chain);
+    parcBufferComposer_Release(&composer);
+}
+
 int
 main(int argc, char *argv[argc])
 {
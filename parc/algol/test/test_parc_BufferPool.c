@@ -0,0 +1,423 @@
+/*
+ * Copyright (c) 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Patent rights are not granted under this agreement. Patent rights are
+ *       available under FRAND terms.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX or PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * @copyright 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC).  All rights reserved.
+ */
+// Include the file(s) containing the functions to be tested.
+// This permits internal static functions to be visible to this Test Framework.
+#include "../parc_BufferPool.c"
+
+#include <limits.h>
+#include <sys/time.h>
+
+#include <LongBow/testing.h>
+#include <LongBow/debugging.h>
+#include <parc/algol/parc_Memory.h>
+#include <parc/algol/parc_SafeMemory.h>
+
+#include <parc/testing/parc_MemoryTesting.h>
+#include <parc/testing/parc_ObjectTesting.h>
+
+LONGBOW_TEST_RUNNER(parc_BufferPool)
+{
+    LONGBOW_RUN_TEST_FIXTURE(CreateAcquireRelease);
+    LONGBOW_RUN_TEST_FIXTURE(Global);
+    LONGBOW_RUN_TEST_FIXTURE(Performance);
+}
+
+LONGBOW_TEST_RUNNER_SETUP(parc_BufferPool)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_RUNNER_TEARDOWN(parc_BufferPool)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_FIXTURE(CreateAcquireRelease)
+{
+    LONGBOW_RUN_TEST_CASE(CreateAcquireRelease, CreateRelease);
+    LONGBOW_RUN_TEST_CASE(CreateAcquireRelease, CreateRelease_SizeClasses);
+    LONGBOW_RUN_TEST_CASE(CreateAcquireRelease, Release_OutstandingBuffer);
+    LONGBOW_RUN_TEST_CASE(CreateAcquireRelease, Create_KeysExhausted);
+}
+
+LONGBOW_TEST_FIXTURE_SETUP(CreateAcquireRelease)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_FIXTURE_TEARDOWN(CreateAcquireRelease)
+{
+    if (!parcMemoryTesting_ExpectedOutstanding(0, "%s leaked memory.", longBowTestCase_GetFullName(testCase))) {
+        return LONGBOW_STATUS_MEMORYLEAK;
+    }
+
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_CASE(CreateAcquireRelease, CreateRelease)
+{
+    PARCBufferPool *instance = parcBufferPool_Create(64, 65536, 16);
+    assertNotNull(instance, "Expected non-null result from parcBufferPool_Create");
+
+    parcObjectTesting_AssertAcquireReleaseContract(parcBufferPool_Acquire, instance);
+
+    parcBufferPool_Release(&instance);
+    assertNull(instance, "Expected null result from parcBufferPool_Release");
+}
+
+LONGBOW_TEST_CASE(CreateAcquireRelease, CreateRelease_SizeClasses)
+{
+    PARCBufferPool *instance = parcBufferPool_Create(100, 3000, 16);
+
+    assertTrue(instance->minimumSize == 128, "Expected the minimum size rounded up to 128, actual %zu", instance->minimumSize);
+    assertTrue(instance->maximumSize == 4096, "Expected the maximum size rounded up to 4096, actual %zu", instance->maximumSize);
+    assertTrue(instance->classCount == 6, "Expected 6 size classes, actual %zu", instance->classCount);
+    assertTrue(_parcBufferPool_ClassIndex(instance, 1) == 0, "Expected 1 byte in the first class");
+    assertTrue(_parcBufferPool_ClassIndex(instance, 128) == 0, "Expected 128 bytes in the first class");
+    assertTrue(_parcBufferPool_ClassIndex(instance, 129) == 1, "Expected 129 bytes in the second class");
+    assertTrue(_parcBufferPool_ClassIndex(instance, 4096) == 5, "Expected 4096 bytes in the last class");
+
+    parcBufferPool_Release(&instance);
+}
+
+LONGBOW_TEST_CASE(CreateAcquireRelease, Release_OutstandingBuffer)
+{
+    PARCBufferPool *pool = parcBufferPool_Create(64, 1024, 16);
+    PARCBuffer *buffer = parcBufferPool_GetBuffer(pool, 100);
+
+    // The buffer keeps the pool alive until it is released.
+    parcBufferPool_Release(&pool);
+    parcBuffer_PutUint8(buffer, 1);
+    parcBuffer_Release(&buffer);
+}
+
+LONGBOW_TEST_CASE(CreateAcquireRelease, Create_KeysExhausted)
+{
+    // Every pool holds a thread-specific data key, so creating more pools than there are keys must fail cleanly.
+    PARCBufferPool *pools[PTHREAD_KEYS_MAX + 1];
+    size_t count = 0;
+    while (count < PTHREAD_KEYS_MAX + 1 && (pools[count] = parcBufferPool_Create(64, 1024, 16)) != NULL) {
+        count++;
+    }
+
+    assertTrue(count < PTHREAD_KEYS_MAX + 1, "Expected parcBufferPool_Create to return NULL once the keys are exhausted.");
+
+    for (size_t i = 0; i < count; i++) {
+        parcBufferPool_Release(&pools[i]);
+    }
+
+    PARCBufferPool *pool = parcBufferPool_Create(64, 1024, 16);
+    assertNotNull(pool, "Expected releasing the pools to make their keys available again.");
+    parcBufferPool_Release(&pool);
+}
+
+LONGBOW_TEST_FIXTURE(Global)
+{
+    LONGBOW_RUN_TEST_CASE(Global, parcBufferPool_GetBuffer);
+    LONGBOW_RUN_TEST_CASE(Global, parcBufferPool_GetBuffer_Reuse);
+    LONGBOW_RUN_TEST_CASE(Global, parcBufferPool_GetBuffer_Oversize);
+    LONGBOW_RUN_TEST_CASE(Global, parcBufferPool_GetBuffer_SharedBySlice);
+    LONGBOW_RUN_TEST_CASE(Global, parcBufferPool_GetBuffer_Resized);
+    LONGBOW_RUN_TEST_CASE(Global, parcBufferPool_Limit);
+    LONGBOW_RUN_TEST_CASE(Global, parcBufferPool_Drain);
+    LONGBOW_RUN_TEST_CASE(Global, parcBufferPool_Threads);
+    LONGBOW_RUN_TEST_CASE(Global, parcBufferPool_Display);
+}
+
+LONGBOW_TEST_FIXTURE_SETUP(Global)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_FIXTURE_TEARDOWN(Global)
+{
+    if (!parcMemoryTesting_ExpectedOutstanding(0, "%s mismanaged memory.", longBowTestCase_GetFullName(testCase))) {
+        return LONGBOW_STATUS_MEMORYLEAK;
+    }
+
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_CASE(Global, parcBufferPool_GetBuffer)
+{
+    PARCBufferPool *pool = parcBufferPool_Create(64, 4096, 16);
+
+    PARCBuffer *buffer = parcBufferPool_GetBuffer(pool, 1500);
+    assertNotNull(buffer, "Expected non-null result from parcBufferPool_GetBuffer");
+    assertTrue(parcBuffer_Capacity(buffer) == 1500, "Expected capacity 1500, actual %zu", parcBuffer_Capacity(buffer));
+    assertTrue(parcBuffer_Position(buffer) == 0, "Expected position 0");
+    assertTrue(parcBuffer_Limit(buffer) == 1500, "Expected limit 1500");
+    assertTrue(parcByteArray_Capacity(parcBuffer_Array(buffer)) == 2048, "Expected the storage of the 2048 byte class");
+    assertTrue(parcBufferPool_GetOutstanding(pool) == 1, "Expected 1 outstanding buffer");
+
+    parcBuffer_Release(&buffer);
+    assertTrue(parcBufferPool_GetOutstanding(pool) == 0, "Expected no outstanding buffers");
+    assertTrue(parcBufferPool_GetPooled(pool) == 1, "Expected 1 pooled array");
+    assertTrue(parcBufferPool_GetRequests(pool) == 1, "Expected 1 request");
+    assertTrue(parcBufferPool_GetMisses(pool) == 1, "Expected 1 miss");
+
+    parcBufferPool_Release(&pool);
+}
+
+LONGBOW_TEST_CASE(Global, parcBufferPool_GetBuffer_Reuse)
+{
+    PARCBufferPool *pool = parcBufferPool_Create(64, 4096, 16);
+
+    PARCBuffer *buffer = parcBufferPool_GetBuffer(pool, 1500);
+    PARCByteArray *array = parcBuffer_Array(buffer);
+    parcBuffer_Release(&buffer);
+
+    // Any capacity in the same size class reuses the storage.
+    buffer = parcBufferPool_GetBuffer(pool, 1100);
+    assertTrue(parcBuffer_Array(buffer) == array, "Expected the released storage to be reused");
+    assertTrue(parcBuffer_Capacity(buffer) == 1100, "Expected capacity 1100, actual %zu", parcBuffer_Capacity(buffer));
+    assertTrue(parcBufferPool_GetMisses(pool) == 1, "Expected 1 miss, actual %" PRIu64, parcBufferPool_GetMisses(pool));
+    parcBuffer_Release(&buffer);
+
+    // A different size class does not.
+    buffer = parcBufferPool_GetBuffer(pool, 100);
+    assertTrue(parcBuffer_Array(buffer) != array, "Expected new storage for a different size class");
+    assertTrue(parcBufferPool_GetMisses(pool) == 2, "Expected 2 misses, actual %" PRIu64, parcBufferPool_GetMisses(pool));
+    parcBuffer_Release(&buffer);
+
+    assertTrue(parcBufferPool_GetRequests(pool) == 3, "Expected 3 requests");
+    assertTrue(parcBufferPool_GetPooled(pool) == 2, "Expected 2 pooled arrays");
+
+    parcBufferPool_Release(&pool);
+}
+
+LONGBOW_TEST_CASE(Global, parcBufferPool_GetBuffer_Oversize)
+{
+    PARCBufferPool *pool = parcBufferPool_Create(64, 4096, 16);
+
+    PARCBuffer *buffer = parcBufferPool_GetBuffer(pool, 10000);
+    assertTrue(parcBuffer_Capacity(buffer) == 10000, "Expected capacity 10000, actual %zu", parcBuffer_Capacity(buffer));
+    assertTrue(parcBufferPool_GetOutstanding(pool) == 0, "Expected an oversize buffer not to be pooled");
+    parcBuffer_Release(&buffer);
+
+    assertTrue(parcBufferPool_GetMisses(pool) == 1, "Expected an oversize request to be a miss");
+    assertTrue(parcBufferPool_GetPooled(pool) == 0, "Expected nothing pooled");
+
+    parcBufferPool_Release(&pool);
+}
+
+LONGBOW_TEST_CASE(Global, parcBufferPool_GetBuffer_SharedBySlice)
+{
+    PARCBufferPool *pool = parcBufferPool_Create(64, 4096, 16);
+
+    PARCBuffer *buffer = parcBufferPool_GetBuffer(pool, 1000);
+    parcBuffer_PutUint32(buffer, 0x01020304);
+    parcBuffer_Flip(buffer);
+    PARCBuffer *slice = parcBuffer_Slice(buffer);
+    parcBuffer_Release(&buffer);
+
+    // The slice still uses the storage, so it must not be reused.
+    assertTrue(parcBufferPool_GetPooled(pool) == 0, "Expected storage shared by a slice not to be pooled");
+    assertTrue(parcBufferPool_GetDiscards(pool) == 1, "Expected 1 discard");
+    assertTrue(parcBuffer_GetUint32(slice) == 0x01020304, "Expected the slice to be intact");
+
+    buffer = parcBufferPool_GetBuffer(pool, 1000);
+    assertTrue(parcBuffer_Array(buffer) != parcBuffer_Array(slice), "Expected new storage");
+    parcBuffer_Release(&buffer);
+    parcBuffer_Release(&slice);
+
+    parcBufferPool_Release(&pool);
+}
+
+LONGBOW_TEST_CASE(Global, parcBufferPool_GetBuffer_Resized)
+{
+    PARCBufferPool *pool = parcBufferPool_Create(64, 4096, 16);
+
+    PARCBuffer *buffer = parcBufferPool_GetBuffer(pool, 1000);
+    parcBuffer_Resize(buffer, 3000);
+    parcBuffer_Release(&buffer);
+
+    assertTrue(parcBufferPool_GetOutstanding(pool) == 0, "Expected no outstanding buffers");
+    assertTrue(parcBufferPool_GetPooled(pool) == 0, "Expected resized storage not to be pooled");
+
+    parcBufferPool_Release(&pool);
+}
+
+LONGBOW_TEST_CASE(Global, parcBufferPool_Limit)
+{
+    size_t limit = 8;
+    PARCBufferPool *pool = parcBufferPool_Create(4096, 4096, limit);
+
+    // More buffers than the thread cache and the shared free list together can hold.
+    size_t count = 100;
+    PARCBuffer *buffers[count];
+    for (size_t i = 0; i < count; i++) {
+        buffers[i] = parcBufferPool_GetBuffer(pool, 4096);
+    }
+    for (size_t i = 0; i < count; i++) {
+        parcBuffer_Release(&buffers[i]);
+    }
+
+    size_t cacheCapacity = _PARCBufferPool_ThreadCacheBytes / 4096;
+    size_t pooled = parcBufferPool_GetPooled(pool);
+    assertTrue(pooled <= limit + cacheCapacity, "Expected at most %zu pooled arrays, actual %zu", limit + cacheCapacity, pooled);
+    assertTrue(pooled + parcBufferPool_GetDiscards(pool) == count,
+               "Expected every array to be pooled or discarded, %zu + %" PRIu64, pooled, parcBufferPool_GetDiscards(pool));
+
+    parcBufferPool_Release(&pool);
+}
+
+LONGBOW_TEST_CASE(Global, parcBufferPool_Drain)
+{
+    PARCBufferPool *pool = parcBufferPool_Create(64, 4096, 16);
+
+    PARCBuffer *a = parcBufferPool_GetBuffer(pool, 100);
+    PARCBuffer *b = parcBufferPool_GetBuffer(pool, 1000);
+    parcBuffer_Release(&a);
+    parcBuffer_Release(&b);
+
+    size_t freed = parcBufferPool_Drain(pool);
+    assertTrue(freed == 2, "Expected 2 arrays freed, actual %zu", freed);
+    assertTrue(parcBufferPool_GetPooled(pool) == 0, "Expected nothing pooled");
+
+    parcBufferPool_Release(&pool);
+}
+
+static void *
+_getAndRelease(void *context)
+{
+    PARCBufferPool *pool = context;
+    for (int i = 0; i < 10000; i++) {
+        PARCBuffer *buffer = parcBufferPool_GetBuffer(pool, 64 + (i % 900));
+        parcBuffer_PutUint32(buffer, i);
+        parcBuffer_Release(&buffer);
+    }
+    return NULL;
+}
+
+LONGBOW_TEST_CASE(Global, parcBufferPool_Threads)
+{
+    PARCBufferPool *pool = parcBufferPool_Create(64, 1024, 64);
+
+    pthread_t threads[4];
+    for (int i = 0; i < 4; i++) {
+        pthread_create(&threads[i], NULL, _getAndRelease, pool);
+    }
+    for (int i = 0; i < 4; i++) {
+        pthread_join(threads[i], NULL);
+    }
+
+    // The exited threads' caches have been returned to the shared free lists.
+    assertNull(pool->caches, "Expected no thread caches after the threads exited");
+    assertTrue(parcBufferPool_GetRequests(pool) == 40000, "Expected 40000 requests, actual %" PRIu64, parcBufferPool_GetRequests(pool));
+    assertTrue(parcBufferPool_GetOutstanding(pool) == 0, "Expected no outstanding buffers");
+    assertTrue(parcBufferPool_GetMisses(pool) < 100, "Expected few misses, actual %" PRIu64, parcBufferPool_GetMisses(pool));
+
+    parcBufferPool_Release(&pool);
+}
+
+LONGBOW_TEST_CASE(Global, parcBufferPool_Display)
+{
+    PARCBufferPool *pool = parcBufferPool_Create(64, 4096, 16);
+    PARCBuffer *buffer = parcBufferPool_GetBuffer(pool, 100);
+
+    parcBufferPool_Display(pool, 0);
+
+    parcBuffer_Release(&buffer);
+    parcBufferPool_Release(&pool);
+}
+
+LONGBOW_TEST_FIXTURE_OPTIONS(Performance, .enabled = false)
+{
+    LONGBOW_RUN_TEST_CASE(Performance, parcBufferPool_PacketRate);
+}
+
+LONGBOW_TEST_FIXTURE_SETUP(Performance)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_FIXTURE_TEARDOWN(Performance)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+static double
+_elapsed(struct timeval *start)
+{
+    struct timeval end;
+    gettimeofday(&end, NULL);
+    timersub(&end, start, &end);
+    return end.tv_sec + end.tv_usec / 1000000.0;
+}
+
+LONGBOW_TEST_CASE(Performance, parcBufferPool_PacketRate)
+{
+    size_t packets = 4 * 1000 * 1000;
+    size_t window = 32;
+    PARCBuffer *inFlight[window];
+    memset(inFlight, 0, sizeof(inFlight));
+
+    // Packets of mixed sizes, each held for a while, as a forwarder's receive path would.
+    struct timeval start;
+    gettimeofday(&start, NULL);
+    for (size_t i = 0; i < packets; i++) {
+        if (inFlight[i % window] != NULL) {
+            parcBuffer_Release(&inFlight[i % window]);
+        }
+        inFlight[i % window] = parcBuffer_Allocate(100 + (i * 37) % 1400);
+    }
+    for (size_t i = 0; i < window; i++) {
+        parcBuffer_Release(&inFlight[i]);
+    }
+    double seconds = _elapsed(&start);
+    printf("parcBuffer_Allocate:      %6.2f Mpackets/s\n", packets / seconds / 1e6);
+
+    PARCBufferPool *pool = parcBufferPool_Create(64, 2048, 256);
+    gettimeofday(&start, NULL);
+    for (size_t i = 0; i < packets; i++) {
+        if (inFlight[i % window] != NULL) {
+            parcBuffer_Release(&inFlight[i % window]);
+        }
+        inFlight[i % window] = parcBufferPool_GetBuffer(pool, 100 + (i * 37) % 1400);
+    }
+    for (size_t i = 0; i < window; i++) {
+        parcBuffer_Release(&inFlight[i]);
+    }
+    seconds = _elapsed(&start);
+    printf("parcBufferPool_GetBuffer: %6.2f Mpackets/s\n", packets / seconds / 1e6);
+    parcBufferPool_Display(pool, 0);
+
+    parcBufferPool_Release(&pool);
+}
+
+int
+main(int argc, char *argv[])
+{
+    LongBowRunner *testRunner = LONGBOW_TEST_RUNNER_CREATE(parc_BufferPool);
+    int exitStatus = LONGBOW_TEST_MAIN(argc, argv, testRunner);
+    longBowTestRunner_Destroy(&testRunner);
+    exit(exitStatus);
+}
@@ -0,0 +1,383 @@
+/*
+ * Copyright (c) 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Patent rights are not granted under this agreement. Patent rights are
+ *       available under FRAND terms.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX or PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * @author Glenn Scott, Palo Alto Research Center (Xerox PARC)
+ * @copyright 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC).  All rights reserved.
+ */
+// Include the file(s) containing the functions to be tested.
+// This permits internal static functions to be visible to this Test Framework.
+#include "../parc_BufferView.c"
+
+#include <sys/time.h>
+
+#include <LongBow/testing.h>
+#include <LongBow/debugging.h>
+#include <parc/algol/parc_Memory.h>
+#include <parc/algol/parc_SafeMemory.h>
+#include <parc/algol/parc_JSON.h>
+
+#include <parc/testing/parc_MemoryTesting.h>
+
+LONGBOW_TEST_RUNNER(parc_BufferView)
+{
+    LONGBOW_RUN_TEST_FIXTURE(Global);
+    LONGBOW_RUN_TEST_FIXTURE(Errors);
+    LONGBOW_RUN_TEST_FIXTURE(Performance);
+}
+
+LONGBOW_TEST_RUNNER_SETUP(parc_BufferView)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_RUNNER_TEARDOWN(parc_BufferView)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_FIXTURE(Global)
+{
+    LONGBOW_RUN_TEST_CASE(Global, parcBufferView_Wrap);
+    LONGBOW_RUN_TEST_CASE(Global, parcBufferView_WrapCString);
+    LONGBOW_RUN_TEST_CASE(Global, parcBufferView_FromBuffer);
+    LONGBOW_RUN_TEST_CASE(Global, parcBufferView_Slice);
+    LONGBOW_RUN_TEST_CASE(Global, parcBufferView_GetUint);
+    LONGBOW_RUN_TEST_CASE(Global, parcBufferView_Equals);
+    LONGBOW_RUN_TEST_CASE(Global, parcBufferView_EqualsBuffer);
+    LONGBOW_RUN_TEST_CASE(Global, parcBufferView_Compare);
+    LONGBOW_RUN_TEST_CASE(Global, parcBufferView_CompareBuffer);
+    LONGBOW_RUN_TEST_CASE(Global, parcBufferView_HashCode);
+    LONGBOW_RUN_TEST_CASE(Global, parcBufferView_PutInto);
+    LONGBOW_RUN_TEST_CASE(Global, parcBufferView_ToBuffer);
+    LONGBOW_RUN_TEST_CASE(Global, parcBufferView_ToString);
+}
+
+LONGBOW_TEST_FIXTURE_SETUP(Global)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_FIXTURE_TEARDOWN(Global)
+{
+    if (!parcMemoryTesting_ExpectedOutstanding(0, "%s leaked memory.", longBowTestCase_GetFullName(testCase))) {
+        return LONGBOW_STATUS_MEMORYLEAK;
+    }
+
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_CASE(Global, parcBufferView_Wrap)
+{
+    uint8_t array[] = { 1, 2, 3, 4, 5 };
+    PARCBufferView view = parcBufferView_Wrap(array, 1, 3);
+
+    assertTrue(parcBufferView_Remaining(&view) == 3, "Expected 3 bytes remaining, actual %zu", parcBufferView_Remaining(&view));
+    assertTrue(parcBufferView_Position(&view) == 0, "Expected position 0");
+    assertTrue(parcBufferView_GetUint8(&view) == 2, "Expected the view to start at the offset");
+
+    parcBufferView_SetPosition(&view, 3);
+    assertFalse(parcBufferView_HasRemaining(&view), "Expected nothing remaining at the end of the view");
+}
+
+LONGBOW_TEST_CASE(Global, parcBufferView_WrapCString)
+{
+    PARCBufferView view = parcBufferView_WrapCString("Hello");
+
+    assertTrue(parcBufferView_Remaining(&view) == 5, "Expected the terminating nul to be excluded");
+    assertTrue(memcmp(parcBufferView_Overlay(&view, 5), "Hello", 5) == 0, "Expected the characters of the string");
+}
+
+LONGBOW_TEST_CASE(Global, parcBufferView_FromBuffer)
+{
+    PARCBuffer *buffer = parcBuffer_WrapCString("Hello World");
+    parcBuffer_SetPosition(buffer, 6);
+
+    PARCBufferView view = parcBufferView_FromBuffer(buffer);
+    assertTrue(parcBufferView_Remaining(&view) == 5, "Expected the remaining bytes of the buffer");
+    assertTrue(parcBufferView_GetUint8(&view) == 'W', "Expected the view to start at the buffer's position");
+    assertTrue(parcBuffer_Position(buffer) == 6, "Expected the buffer's position to be unchanged");
+
+    parcBuffer_SetPosition(buffer, parcBuffer_Limit(buffer));
+    PARCBufferView empty = parcBufferView_FromBuffer(buffer);
+    assertFalse(parcBufferView_HasRemaining(&empty), "Expected an empty view of an exhausted buffer");
+
+    parcBuffer_Release(&buffer);
+}
+
+LONGBOW_TEST_CASE(Global, parcBufferView_Slice)
+{
+    uint8_t array[] = { 0, 3, 'a', 'b', 'c', 9 };
+    PARCBufferView view = parcBufferView_Wrap(array, 0, sizeof(array));
+
+    uint16_t length = parcBufferView_GetUint16(&view);
+    PARCBufferView value = parcBufferView_Slice(&view, length);
+
+    assertTrue(parcBufferView_Remaining(&value) == 3, "Expected a 3 byte slice");
+    PARCBufferView expected = parcBufferView_WrapCString("abc");
+    assertTrue(parcBufferView_Equals(&expected, &value), "Expected the slice to hold 'abc'");
+    assertTrue(parcBufferView_GetUint8(&view) == 9, "Expected the view to be advanced past the slice");
+}
+
+LONGBOW_TEST_CASE(Global, parcBufferView_GetUint)
+{
+    PARCBuffer *buffer = parcBuffer_Allocate(15);
+    parcBuffer_PutUint8(buffer, 0x12);
+    parcBuffer_PutUint16(buffer, 0x3456);
+    parcBuffer_PutUint32(buffer, 0x789ABCDE);
+    parcBuffer_PutUint64(buffer, 0x0102030405060708ULL);
+    parcBuffer_Flip(buffer);
+
+    PARCBufferView view = parcBufferView_FromBuffer(buffer);
+    assertTrue(parcBufferView_GetUint8(&view) == 0x12, "Expected 0x12");
+    assertTrue(parcBufferView_GetUint16(&view) == 0x3456, "Expected 0x3456");
+    assertTrue(parcBufferView_GetUint32(&view) == 0x789ABCDE, "Expected 0x789ABCDE");
+    assertTrue(parcBufferView_GetUint64(&view) == 0x0102030405060708ULL, "Expected 0x0102030405060708");
+    assertFalse(parcBufferView_HasRemaining(&view), "Expected every byte to be read");
+
+    parcBuffer_Release(&buffer);
+}
+
+LONGBOW_TEST_CASE(Global, parcBufferView_Equals)
+{
+    PARCBufferView x = parcBufferView_WrapCString("abc");
+    PARCBufferView y = parcBufferView_Wrap("xabc", 1, 3);
+    PARCBufferView z = parcBufferView_WrapCString("abd");
+    PARCBufferView longer = parcBufferView_WrapCString("abcd");
+
+    assertTrue(parcBufferView_Equals(&x, &y), "Expected equal views");
+    assertFalse(parcBufferView_Equals(&x, &z), "Expected views with different bytes to differ");
+    assertFalse(parcBufferView_Equals(&x, &longer), "Expected views of different lengths to differ");
+
+    parcBufferView_GetUint8(&longer);
+    parcBufferView_GetUint8(&x);
+    PARCBufferView bcd = parcBufferView_WrapCString("bcd");
+    assertTrue(parcBufferView_Equals(&longer, &bcd), "Expected only the remaining bytes to be compared");
+}
+
+LONGBOW_TEST_CASE(Global, parcBufferView_EqualsBuffer)
+{
+    PARCBuffer *buffer = parcBuffer_WrapCString("name");
+    PARCBufferView view = parcBufferView_WrapCString("name");
+    PARCBufferView other = parcBufferView_WrapCString("names");
+
+    assertTrue(parcBufferView_EqualsBuffer(&view, buffer), "Expected the view to equal the buffer");
+    assertFalse(parcBufferView_EqualsBuffer(&other, buffer), "Expected a longer view to differ");
+    assertFalse(parcBufferView_EqualsBuffer(&view, NULL), "Expected a view not to equal NULL");
+
+    parcBuffer_Release(&buffer);
+}
+
+LONGBOW_TEST_CASE(Global, parcBufferView_Compare)
+{
+    PARCBufferView abc = parcBufferView_WrapCString("abc");
+    PARCBufferView abd = parcBufferView_WrapCString("abd");
+    PARCBufferView ab = parcBufferView_WrapCString("ab");
+
+    assertTrue(parcBufferView_Compare(&abc, &abc) == 0, "Expected a view to equal itself");
+    assertTrue(parcBufferView_Compare(&abc, &abd) < 0, "Expected abc < abd");
+    assertTrue(parcBufferView_Compare(&abd, &abc) > 0, "Expected abd > abc");
+    assertTrue(parcBufferView_Compare(&ab, &abc) < 0, "Expected a prefix to be the lesser");
+    assertTrue(parcBufferView_Compare(&abc, &ab) > 0, "Expected the longer to be the greater");
+}
+
+LONGBOW_TEST_CASE(Global, parcBufferView_CompareBuffer)
+{
+    const char *strings[] = { "", "a", "ab", "abc", "abd", "b" };
+    size_t count = sizeof(strings) / sizeof(strings[0]);
+
+    for (size_t i = 0; i < count; i++) {
+        PARCBuffer *x = parcBuffer_WrapCString((char *) strings[i]);
+        PARCBufferView view = parcBufferView_WrapCString(strings[i]);
+        for (size_t j = 0; j < count; j++) {
+            PARCBuffer *y = parcBuffer_WrapCString((char *) strings[j]);
+            int expected = parcBuffer_Compare(x, y);
+            int actual = parcBufferView_CompareBuffer(&view, y);
+            assertTrue((expected < 0) == (actual < 0) && (expected > 0) == (actual > 0),
+                       "Expected '%s' and '%s' to compare as parcBuffer_Compare does", strings[i], strings[j]);
+            parcBuffer_Release(&y);
+        }
+        assertTrue(parcBufferView_CompareBuffer(&view, NULL) > 0, "Expected NULL to be less than every view");
+        parcBuffer_Release(&x);
+    }
+}
+
+LONGBOW_TEST_CASE(Global, parcBufferView_HashCode)
+{
+    PARCBuffer *buffer = parcBuffer_WrapCString("Hello World");
+    PARCBufferView view = parcBufferView_WrapCString("Hello World");
+    PARCBufferView empty = parcBufferView_WrapCString("");
+
+    assertTrue(parcBufferView_HashCode(&view) == parcBuffer_HashCode(buffer),
+               "Expected the hash code of a buffer with the same bytes");
+    assertTrue(parcBufferView_HashCode(&empty) == 0, "Expected 0 for an empty view, as for an empty buffer");
+
+    parcBuffer_Release(&buffer);
+}
+
+LONGBOW_TEST_CASE(Global, parcBufferView_PutInto)
+{
+    PARCBuffer *buffer = parcBuffer_Allocate(11);
+    PARCBufferView hello = parcBufferView_WrapCString("Hello ");
+    PARCBufferView world = parcBufferView_WrapCString("World");
+
+    parcBufferView_PutInto(&world, parcBufferView_PutInto(&hello, buffer));
+    assertTrue(parcBufferView_Position(&hello) == 0, "Expected the view's position to be unchanged");
+    parcBuffer_Flip(buffer);
+
+    char *actual = parcBuffer_ToString(buffer);
+    assertTrue(strcmp("Hello World", actual) == 0, "Expected 'Hello World', actual '%s'", actual);
+
+    parcMemory_Deallocate(&actual);
+    parcBuffer_Release(&buffer);
+}
+
+LONGBOW_TEST_CASE(Global, parcBufferView_ToBuffer)
+{
+    char string[] = "transient";
+    PARCBufferView view = parcBufferView_WrapCString(string);
+    parcBufferView_GetUint8(&view);
+
+    PARCBuffer *buffer = parcBufferView_ToBuffer(&view);
+    string[1] = 'X';
+
+    PARCBuffer *expected = parcBuffer_WrapCString("ransient");
+    assertTrue(parcBuffer_Equals(expected, buffer), "Expected a copy of the remaining bytes");
+
+    parcBuffer_Release(&expected);
+    parcBuffer_Release(&buffer);
+}
+
+LONGBOW_TEST_CASE(Global, parcBufferView_ToString)
+{
+    PARCBufferView view = parcBufferView_Wrap("Hello World", 6, 5);
+
+    char *actual = parcBufferView_ToString(&view);
+    assertTrue(strcmp("World", actual) == 0, "Expected 'World', actual '%s'", actual);
+
+    parcMemory_Deallocate(&actual);
+}
+
+LONGBOW_TEST_FIXTURE(Errors)
+{
+    LONGBOW_RUN_TEST_CASE(Errors, parcBufferView_GetUint32_Underflow);
+    LONGBOW_RUN_TEST_CASE(Errors, parcBufferView_SetPosition_OutOfBounds);
+}
+
+LONGBOW_TEST_FIXTURE_SETUP(Errors)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_FIXTURE_TEARDOWN(Errors)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_CASE_EXPECTS(Errors, parcBufferView_GetUint32_Underflow, .event = &LongBowTrapOutOfBounds)
+{
+    PARCBufferView view = parcBufferView_WrapCString("abc");
+
+    parcBufferView_GetUint32(&view);
+}
+
+LONGBOW_TEST_CASE_EXPECTS(Errors, parcBufferView_SetPosition_OutOfBounds, .event = &LongBowTrapOutOfBounds)
+{
+    PARCBufferView view = parcBufferView_WrapCString("abc");
+
+    parcBufferView_SetPosition(&view, 4);
+}
+
+LONGBOW_TEST_FIXTURE_OPTIONS(Performance, .enabled = false)
+{
+    LONGBOW_RUN_TEST_CASE(Performance, parcJSON_GetValueByName);
+}
+
+LONGBOW_TEST_FIXTURE_SETUP(Performance)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_FIXTURE_TEARDOWN(Performance)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+static double
+_seconds(const struct timeval *start, const struct timeval *end)
+{
+    struct timeval elapsed;
+    timersub(end, start, &elapsed);
+    return elapsed.tv_sec + elapsed.tv_usec / 1000000.0;
+}
+
+LONGBOW_TEST_CASE(Performance, parcJSON_GetValueByName)
+{
+    PARCJSON *json = parcJSON_ParseString("{ \"name\" : \"value\", \"type\" : 1, \"length\" : 2, \"flags\" : 3 }");
+    size_t count = 1000000;
+
+    // The lookup as it was: wrap the name in a PARCBuffer for each comparison.
+    size_t found = 0;
+    struct timeval start, end;
+    gettimeofday(&start, NULL);
+    for (size_t i = 0; i < count; i++) {
+        PARCBuffer *name = parcBuffer_WrapCString("flags");
+        PARCList *members = parcJSON_GetMembers(json);
+        for (size_t index = 0; index < parcList_Size(members); index++) {
+            if (parcBuffer_Equals(name, parcJSONPair_GetName(parcList_GetAtIndex(members, index)))) {
+                found++;
+                break;
+            }
+        }
+        parcBuffer_Release(&name);
+    }
+    gettimeofday(&end, NULL);
+    double wrapSeconds = _seconds(&start, &end);
+
+    gettimeofday(&start, NULL);
+    for (size_t i = 0; i < count; i++) {
+        if (parcJSON_GetValueByName(json, "flags") != NULL) {
+            found++;
+        }
+    }
+    gettimeofday(&end, NULL);
+    double viewSeconds = _seconds(&start, &end);
+
+    assertTrue(found == count * 2, "Expected every lookup to succeed");
+    printf("parcJSON_GetValueByName: wrapped name %.0f lookups/s, view %.0f lookups/s\n",
+           count / wrapSeconds, count / viewSeconds);
+
+    parcJSON_Release(&json);
+}
+
+int
+main(int argc, char *argv[argc])
+{
+    LongBowRunner *testRunner = LONGBOW_TEST_RUNNER_CREATE(parc_BufferView);
+    int exitStatus = LONGBOW_TEST_MAIN(argc, argv, testRunner);
+    longBowTestRunner_Destroy(&testRunner);
+    exit(exitStatus);
+}
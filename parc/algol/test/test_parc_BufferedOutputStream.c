@@ -0,0 +1,544 @@
+/*
+ * Copyright (c) 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Patent rights are not granted under this agreement. Patent rights are
+ *       available under FRAND terms.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX or PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * @copyright 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC).  All rights reserved.
+ */
+// Include the file(s) containing the functions to be tested.
+// This permits internal static functions to be visible to this Test Framework.
+#include "../parc_BufferedOutputStream.c"
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <unistd.h>
+#include <sys/time.h>
+
+#include <LongBow/testing.h>
+#include <LongBow/debugging.h>
+#include <parc/algol/parc_Memory.h>
+#include <parc/algol/parc_SafeMemory.h>
+#include <parc/algol/parc_BufferComposer.h>
+#include <parc/algol/parc_FileOutputStream.h>
+
+#include <parc/testing/parc_MemoryTesting.h>
+#include <parc/testing/parc_ObjectTesting.h>
+
+/*
+ * An output stream that records what is written to it and how many times it is written to.
+ */
+typedef struct {
+    PARCBufferComposer *composer;
+    size_t writes;
+    size_t chainWrites;
+    size_t flushes;
+} _RecordingStream;
+
+static void
+_recordingStream_Finalize(_RecordingStream **instancePtr)
+{
+    parcBufferComposer_Release(&(*instancePtr)->composer);
+}
+
+parcObject_ExtendPARCObject(_RecordingStream, _recordingStream_Finalize, NULL, NULL, NULL, NULL, NULL, NULL);
+
+static parcObject_ImplementAcquire(_recordingStream, _RecordingStream);
+
+static parcObject_ImplementRelease(_recordingStream, _RecordingStream);
+
+static size_t
+_recordingStream_Write(_RecordingStream *stream, PARCBuffer *buffer)
+{
+    size_t length = parcBuffer_Remaining(buffer);
+    stream->writes++;
+    parcBufferComposer_PutBuffer(stream->composer, buffer);
+    parcBuffer_SetPosition(buffer, parcBuffer_Limit(buffer));
+    return length;
+}
+
+static size_t
+_recordingStream_WriteBufferChain(_RecordingStream *stream, PARCBufferChain *chain)
+{
+    size_t length = parcBufferChain_Length(chain);
+    stream->chainWrites++;
+    for (size_t i = 0; i < parcBufferChain_GetSegmentCount(chain); i++) {
+        parcBufferComposer_PutBuffer(stream->composer, parcBufferChain_GetSegment(chain, i));
+    }
+    parcBufferChain_Consume(chain, length);
+    return length;
+}
+
+static bool
+_recordingStream_Flush(_RecordingStream *stream)
+{
+    stream->flushes++;
+    return true;
+}
+
+static PARCOutputStreamInterface *_RecordingStreamAsPARCOutputStream = &(PARCOutputStreamInterface) {
+    .Acquire = (PARCOutputStream * (*)(PARCOutputStream *))_recordingStream_Acquire,
+    .Release = (void (*)(PARCOutputStream **))_recordingStream_Release,
+    .Write = (size_t (*)(PARCOutputStream *, PARCBuffer *))_recordingStream_Write,
+    .WriteBufferChain = (size_t (*)(PARCOutputStream *, PARCBufferChain *))_recordingStream_WriteBufferChain,
+    .Flush = (bool (*)(PARCOutputStream *))_recordingStream_Flush
+};
+
+static _RecordingStream *
+_recordingStream_Create(PARCOutputStream **outputPtr)
+{
+    _RecordingStream *result = parcObject_CreateInstance(_RecordingStream);
+    result->composer = parcBufferComposer_Create();
+    result->writes = 0;
+    result->chainWrites = 0;
+    result->flushes = 0;
+
+    *outputPtr = parcOutputStream_Create(_recordingStream_Acquire(result), _RecordingStreamAsPARCOutputStream);
+    return result;
+}
+
+static bool
+_recordingStream_Holds(_RecordingStream *stream, const char *expected)
+{
+    char *string = parcBufferComposer_ToString(stream->composer);
+    bool result = strcmp(string, expected) == 0;
+    parcMemory_Deallocate(&string);
+    return result;
+}
+
+static void
+_writeString(PARCBufferedOutputStream *stream, const char *string)
+{
+    PARCBuffer *buffer = parcBuffer_WrapCString((char *) string);
+    parcBufferedOutputStream_Write(stream, buffer);
+    parcBuffer_Release(&buffer);
+}
+
+LONGBOW_TEST_RUNNER(parc_BufferedOutputStream)
+{
+    LONGBOW_RUN_TEST_FIXTURE(CreateAcquireRelease);
+    LONGBOW_RUN_TEST_FIXTURE(Global);
+    LONGBOW_RUN_TEST_FIXTURE(Errors);
+    LONGBOW_RUN_TEST_FIXTURE(Performance);
+}
+
+LONGBOW_TEST_RUNNER_SETUP(parc_BufferedOutputStream)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_RUNNER_TEARDOWN(parc_BufferedOutputStream)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_FIXTURE(CreateAcquireRelease)
+{
+    LONGBOW_RUN_TEST_CASE(CreateAcquireRelease, CreateRelease);
+    LONGBOW_RUN_TEST_CASE(CreateAcquireRelease, CreateRelease_Background);
+    LONGBOW_RUN_TEST_CASE(CreateAcquireRelease, Release_Flushes);
+}
+
+LONGBOW_TEST_FIXTURE_SETUP(CreateAcquireRelease)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_FIXTURE_TEARDOWN(CreateAcquireRelease)
+{
+    if (!parcMemoryTesting_ExpectedOutstanding(0, "%s leaked memory.", longBowTestCase_GetFullName(testCase))) {
+        return LONGBOW_STATUS_MEMORYLEAK;
+    }
+
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_CASE(CreateAcquireRelease, CreateRelease)
+{
+    PARCOutputStream *output;
+    _RecordingStream *recording = _recordingStream_Create(&output);
+
+    PARCBufferedOutputStream *stream = parcBufferedOutputStream_Create(output, 64, 0, false);
+    assertNotNull(stream, "Expected non-null result from parcBufferedOutputStream_Create");
+    parcBufferedOutputStream_AssertValid(stream);
+
+    parcObjectTesting_AssertAcquireReleaseContract(parcBufferedOutputStream_Acquire, stream);
+
+    parcBufferedOutputStream_Release(&stream);
+    assertNull(stream, "Expected parcBufferedOutputStream_Release to set the pointer to NULL");
+
+    parcOutputStream_Release(&output);
+    _recordingStream_Release(&recording);
+}
+
+LONGBOW_TEST_CASE(CreateAcquireRelease, CreateRelease_Background)
+{
+    PARCOutputStream *output;
+    _RecordingStream *recording = _recordingStream_Create(&output);
+
+    PARCBufferedOutputStream *stream = parcBufferedOutputStream_Create(output, 64, 1000, true);
+    assertNotNull(stream, "Expected non-null result from parcBufferedOutputStream_Create");
+    parcBufferedOutputStream_AssertValid(stream);
+
+    parcBufferedOutputStream_Release(&stream);
+
+    parcOutputStream_Release(&output);
+    _recordingStream_Release(&recording);
+}
+
+LONGBOW_TEST_CASE(CreateAcquireRelease, Release_Flushes)
+{
+    PARCOutputStream *output;
+    _RecordingStream *recording = _recordingStream_Create(&output);
+
+    bool background[] = { false, true };
+    for (size_t i = 0; i < 2; i++) {
+        PARCBufferedOutputStream *stream = parcBufferedOutputStream_Create(output, 64, 0, background[i]);
+        _writeString(stream, "Hello");
+        assertTrue(recording->writes == i, "Expected nothing to be written before the stream is released");
+
+        parcBufferedOutputStream_Release(&stream);
+        assertTrue(recording->writes == i + 1, "Expected releasing the stream to write the buffered bytes");
+    }
+    assertTrue(_recordingStream_Holds(recording, "HelloHello"), "Expected the buffered bytes to be written");
+
+    parcOutputStream_Release(&output);
+    _recordingStream_Release(&recording);
+}
+
+LONGBOW_TEST_FIXTURE(Global)
+{
+    LONGBOW_RUN_TEST_CASE(Global, parcBufferedOutputStream_Write_Coalesces);
+    LONGBOW_RUN_TEST_CASE(Global, parcBufferedOutputStream_Write_Full);
+    LONGBOW_RUN_TEST_CASE(Global, parcBufferedOutputStream_Write_Large);
+    LONGBOW_RUN_TEST_CASE(Global, parcBufferedOutputStream_Write_MaximumDelay);
+    LONGBOW_RUN_TEST_CASE(Global, parcBufferedOutputStream_Write_MaximumDelay_Background);
+    LONGBOW_RUN_TEST_CASE(Global, parcBufferedOutputStream_Write_Background_Order);
+    LONGBOW_RUN_TEST_CASE(Global, parcBufferedOutputStream_Flush);
+    LONGBOW_RUN_TEST_CASE(Global, parcBufferedOutputStream_Pending);
+    LONGBOW_RUN_TEST_CASE(Global, parcBufferedOutputStream_AsOutputStream);
+}
+
+LONGBOW_TEST_FIXTURE_SETUP(Global)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_FIXTURE_TEARDOWN(Global)
+{
+    if (!parcMemoryTesting_ExpectedOutstanding(0, "%s leaked memory.", longBowTestCase_GetFullName(testCase))) {
+        return LONGBOW_STATUS_MEMORYLEAK;
+    }
+
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_CASE(Global, parcBufferedOutputStream_Write_Coalesces)
+{
+    PARCOutputStream *output;
+    _RecordingStream *recording = _recordingStream_Create(&output);
+    PARCBufferedOutputStream *stream = parcBufferedOutputStream_Create(output, 4096, 0, false);
+
+    for (int i = 0; i < 100; i++) {
+        _writeString(stream, "0123456789");
+    }
+    assertTrue(recording->writes == 0, "Expected no writes before the buffer is full, got %zu", recording->writes);
+
+    parcBufferedOutputStream_Flush(stream);
+    assertTrue(recording->writes == 1, "Expected 1 write, got %zu", recording->writes);
+    char *string = parcBufferComposer_ToString(recording->composer);
+    assertTrue(strlen(string) == 1000, "Expected 1000 bytes to be written, got %zu", strlen(string));
+    parcMemory_Deallocate(&string);
+
+    parcBufferedOutputStream_Release(&stream);
+    parcOutputStream_Release(&output);
+    _recordingStream_Release(&recording);
+}
+
+LONGBOW_TEST_CASE(Global, parcBufferedOutputStream_Write_Full)
+{
+    PARCOutputStream *output;
+    _RecordingStream *recording = _recordingStream_Create(&output);
+    PARCBufferedOutputStream *stream = parcBufferedOutputStream_Create(output, 16, 0, false);
+
+    // Each buffer holds three 5 byte writes; the fourth write does not fit and sends the first three on.
+    const char *words[] = { "abcde", "fghij", "klmno", "pqrst", "uvwxy" };
+    for (size_t i = 0; i < 5; i++) {
+        _writeString(stream, words[i]);
+    }
+    assertTrue(recording->writes == 1, "Expected 1 write, got %zu", recording->writes);
+    assertTrue(_recordingStream_Holds(recording, "abcdefghijklmno"), "Expected the first three words");
+
+    parcBufferedOutputStream_Flush(stream);
+    assertTrue(recording->writes == 2, "Expected 2 writes, got %zu", recording->writes);
+    assertTrue(_recordingStream_Holds(recording, "abcdefghijklmnopqrstuvwxy"), "Expected all the words in order");
+
+    parcBufferedOutputStream_Release(&stream);
+    parcOutputStream_Release(&output);
+    _recordingStream_Release(&recording);
+}
+
+LONGBOW_TEST_CASE(Global, parcBufferedOutputStream_Write_Large)
+{
+    PARCOutputStream *output;
+    _RecordingStream *recording = _recordingStream_Create(&output);
+    PARCBufferedOutputStream *stream = parcBufferedOutputStream_Create(output, 16, 0, false);
+
+    _writeString(stream, "Hello ");
+
+    PARCBuffer *large = parcBuffer_WrapCString("a string longer than the buffer");
+    size_t written = parcBufferedOutputStream_Write(stream, large);
+    assertTrue(written == 31, "Expected 31, got %zu", written);
+    assertFalse(parcBuffer_HasRemaining(large), "Expected the buffer's position to be set to its limit");
+    parcBuffer_Release(&large);
+
+    assertTrue(recording->writes == 0, "Expected no plain writes, got %zu", recording->writes);
+    assertTrue(recording->chainWrites == 1, "Expected the held bytes and the large write in one chain, got %zu", recording->chainWrites);
+    assertTrue(_recordingStream_Holds(recording, "Hello a string longer than the buffer"), "Expected the bytes in order");
+    assertTrue(parcBufferedOutputStream_Pending(stream) == 0, "Expected nothing to be pending");
+
+    parcBufferedOutputStream_Release(&stream);
+    parcOutputStream_Release(&output);
+    _recordingStream_Release(&recording);
+}
+
+LONGBOW_TEST_CASE(Global, parcBufferedOutputStream_Write_MaximumDelay)
+{
+    PARCOutputStream *output;
+    _RecordingStream *recording = _recordingStream_Create(&output);
+    PARCBufferedOutputStream *stream = parcBufferedOutputStream_Create(output, 4096, 10000, false);
+
+    _writeString(stream, "first ");
+    assertTrue(recording->writes == 0, "Expected the first write to be held");
+
+    usleep(20000);
+    _writeString(stream, "second");
+    assertTrue(recording->writes == 1, "Expected a write after the maximum delay, got %zu", recording->writes);
+    assertTrue(_recordingStream_Holds(recording, "first second"), "Expected both writes");
+
+    parcBufferedOutputStream_Release(&stream);
+    parcOutputStream_Release(&output);
+    _recordingStream_Release(&recording);
+}
+
+LONGBOW_TEST_CASE(Global, parcBufferedOutputStream_Write_MaximumDelay_Background)
+{
+    PARCOutputStream *output;
+    _RecordingStream *recording = _recordingStream_Create(&output);
+    PARCBufferedOutputStream *stream = parcBufferedOutputStream_Create(output, 4096, 10000, true);
+
+    _writeString(stream, "Hello");
+
+    // The background thread writes the held bytes without any further writes or a flush.
+    for (int i = 0; i < 200 && parcBufferedOutputStream_Pending(stream) > 0; i++) {
+        usleep(5000);
+    }
+    assertTrue(parcBufferedOutputStream_Pending(stream) == 0, "Expected the background thread to write the held bytes");
+
+    parcBufferedOutputStream_Release(&stream);
+    assertTrue(_recordingStream_Holds(recording, "Hello"), "Expected the held bytes to be written");
+    parcOutputStream_Release(&output);
+    _recordingStream_Release(&recording);
+}
+
+LONGBOW_TEST_CASE(Global, parcBufferedOutputStream_Write_Background_Order)
+{
+    PARCOutputStream *output;
+    _RecordingStream *recording = _recordingStream_Create(&output);
+    PARCBufferedOutputStream *stream = parcBufferedOutputStream_Create(output, 64, 0, true);
+
+    PARCBufferComposer *expected = parcBufferComposer_Create();
+    for (int i = 0; i < 1000; i++) {
+        char line[32];
+        snprintf(line, sizeof(line), "line %d\n", i);
+        _writeString(stream, line);
+        parcBufferComposer_PutString(expected, line);
+    }
+    parcBufferedOutputStream_Flush(stream);
+
+    char *expectedString = parcBufferComposer_ToString(expected);
+    assertTrue(_recordingStream_Holds(recording, expectedString), "Expected every line, in order");
+    assertTrue(recording->writes < 1000 / 4, "Expected the lines to be coalesced, got %zu writes", recording->writes);
+    parcMemory_Deallocate(&expectedString);
+    parcBufferComposer_Release(&expected);
+
+    parcBufferedOutputStream_Release(&stream);
+    parcOutputStream_Release(&output);
+    _recordingStream_Release(&recording);
+}
+
+LONGBOW_TEST_CASE(Global, parcBufferedOutputStream_Flush)
+{
+    PARCOutputStream *output;
+    _RecordingStream *recording = _recordingStream_Create(&output);
+    PARCBufferedOutputStream *stream = parcBufferedOutputStream_Create(output, 4096, 0, true);
+
+    _writeString(stream, "Hello");
+    bool result = parcBufferedOutputStream_Flush(stream);
+    assertTrue(result, "Expected parcBufferedOutputStream_Flush to succeed");
+    assertTrue(_recordingStream_Holds(recording, "Hello"), "Expected the held bytes to be written by the flush");
+    assertTrue(recording->flushes == 1, "Expected the underlying stream to be flushed");
+
+    // Flushing an empty stream writes nothing.
+    parcBufferedOutputStream_Flush(stream);
+    assertTrue(recording->writes == 1, "Expected 1 write, got %zu", recording->writes);
+
+    parcBufferedOutputStream_Release(&stream);
+    parcOutputStream_Release(&output);
+    _recordingStream_Release(&recording);
+}
+
+LONGBOW_TEST_CASE(Global, parcBufferedOutputStream_Pending)
+{
+    PARCOutputStream *output;
+    _RecordingStream *recording = _recordingStream_Create(&output);
+    PARCBufferedOutputStream *stream = parcBufferedOutputStream_Create(output, 4096, 0, false);
+
+    assertTrue(parcBufferedOutputStream_Pending(stream) == 0, "Expected a new stream to hold nothing");
+    _writeString(stream, "Hello");
+    assertTrue(parcBufferedOutputStream_Pending(stream) == 5, "Expected 5, got %zu", parcBufferedOutputStream_Pending(stream));
+    parcBufferedOutputStream_Flush(stream);
+    assertTrue(parcBufferedOutputStream_Pending(stream) == 0, "Expected 0 after a flush");
+
+    parcBufferedOutputStream_Release(&stream);
+    parcOutputStream_Release(&output);
+    _recordingStream_Release(&recording);
+}
+
+LONGBOW_TEST_CASE(Global, parcBufferedOutputStream_AsOutputStream)
+{
+    PARCOutputStream *output;
+    _RecordingStream *recording = _recordingStream_Create(&output);
+    PARCBufferedOutputStream *stream = parcBufferedOutputStream_Create(output, 4096, 0, false);
+
+    PARCOutputStream *buffered = parcBufferedOutputStream_AsOutputStream(stream);
+    parcBufferedOutputStream_Release(&stream);
+
+    parcOutputStream_WriteCStrings(buffered, "Hello", " ", "World", NULL);
+    assertTrue(recording->writes == 0, "Expected the writes to be held");
+    assertTrue(parcOutputStream_Flush(buffered), "Expected parcOutputStream_Flush to succeed");
+    assertTrue(_recordingStream_Holds(recording, "Hello World"), "Expected the writes after a flush");
+
+    parcOutputStream_Release(&buffered);
+    parcOutputStream_Release(&output);
+    _recordingStream_Release(&recording);
+}
+
+LONGBOW_TEST_FIXTURE(Errors)
+{
+    LONGBOW_RUN_TEST_CASE(Errors, parcBufferedOutputStream_Create_ZeroCapacity);
+}
+
+LONGBOW_TEST_FIXTURE_SETUP(Errors)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_FIXTURE_TEARDOWN(Errors)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_CASE_EXPECTS(Errors, parcBufferedOutputStream_Create_ZeroCapacity, .event = &LongBowTrapIllegalValue)
+{
+    PARCOutputStream *output;
+    _RecordingStream *recording = _recordingStream_Create(&output);
+
+    PARCBufferedOutputStream *stream = parcBufferedOutputStream_Create(output, 0, 0, false);
+
+    parcBufferedOutputStream_Release(&stream);
+    parcOutputStream_Release(&output);
+    _recordingStream_Release(&recording);
+}
+
+LONGBOW_TEST_FIXTURE_OPTIONS(Performance, .enabled = false)
+{
+    LONGBOW_RUN_TEST_CASE(Performance, LogLines);
+}
+
+LONGBOW_TEST_FIXTURE_SETUP(Performance)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_FIXTURE_TEARDOWN(Performance)
+{
+    unlink("tmpfile_BufferedOutputStream");
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+static double
+_seconds(const struct timeval *start, const struct timeval *end)
+{
+    struct timeval elapsed;
+    timersub(end, start, &elapsed);
+    return elapsed.tv_sec + elapsed.tv_usec / 1000000.0;
+}
+
+LONGBOW_TEST_CASE(Performance, LogLines)
+{
+    size_t count = 500000;
+    PARCBuffer *line = parcBuffer_WrapCString("2015-06-01T12:00:00.000000Z host app - - - A typical log entry of about one hundred bytes.\n");
+
+    for (int mode = 0; mode < 3; mode++) {
+        int fd = open("tmpfile_BufferedOutputStream", O_WRONLY | O_CREAT | O_TRUNC, 0600);
+        PARCFileOutputStream *fileOutput = parcFileOutputStream_Create(fd);
+        PARCOutputStream *output = parcFileOutputStream_AsOutputStream(fileOutput);
+        parcFileOutputStream_Release(&fileOutput);
+
+        PARCOutputStream *target = output;
+        if (mode > 0) {
+            PARCBufferedOutputStream *stream = parcBufferedOutputStream_Create(output, 64 * 1024, 0, mode == 2);
+            target = parcBufferedOutputStream_AsOutputStream(stream);
+            parcBufferedOutputStream_Release(&stream);
+        }
+
+        struct timeval start, end;
+        gettimeofday(&start, NULL);
+        for (size_t i = 0; i < count; i++) {
+            parcOutputStream_Write(target, parcBuffer_Rewind(line));
+        }
+        parcOutputStream_Flush(target);
+        gettimeofday(&end, NULL);
+
+        const char *name[] = { "PARCFileOutputStream", "PARCBufferedOutputStream", "PARCBufferedOutputStream (background)" };
+        printf("%-40s %10.0f lines/s\n", name[mode], count / _seconds(&start, &end));
+
+        if (target != output) {
+            parcOutputStream_Release(&target);
+        }
+        parcOutputStream_Release(&output);
+    }
+
+    parcBuffer_Release(&line);
+}
+
+int
+main(int argc, char *argv[argc])
+{
+    LongBowRunner *testRunner = LONGBOW_TEST_RUNNER_CREATE(parc_BufferedOutputStream);
+    int exitStatus = LONGBOW_TEST_MAIN(argc, argv, testRunner);
+    longBowTestRunner_Destroy(&testRunner);
+    exit(exitStatus);
+}
@@ -36,6 +36,8 @@
 #include <LongBow/unit-test.h>
 #include <LongBow/debugging.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <errno.h>
 
 #include <parc/algol/parc_SafeMemory.h>
 #include <parc/testing/parc_ObjectTesting.h>
@@ -75,6 +77,15 @@ LONGBOW_TEST_FIXTURE(Global)
     LONGBOW_RUN_TEST_CASE(Global, parcByteArray_Array);
     LONGBOW_RUN_TEST_CASE(Global, parcByteArray_AddressOfIndex);
     LONGBOW_RUN_TEST_CASE(Global, parcByteArray_Capacity);
+    LONGBOW_RUN_TEST_CASE(Global, parcByteArray_Reallocate);
+    LONGBOW_RUN_TEST_CASE(Global, parcByteArray_Reallocate_Shared);
+    LONGBOW_RUN_TEST_CASE(Global, parcByteArray_Reallocate_Wrapped);
+    LONGBOW_RUN_TEST_CASE(Global, parcByteArray_MapFile);
+    LONGBOW_RUN_TEST_CASE(Global, parcByteArray_MapFile_Offset);
+    LONGBOW_RUN_TEST_CASE(Global, parcByteArray_MapFile_Empty);
+    LONGBOW_RUN_TEST_CASE(Global, parcByteArray_MapFile_BadDescriptor);
+    LONGBOW_RUN_TEST_CASE(Global, parcByteArray_Advise);
+    LONGBOW_RUN_TEST_CASE(Global, parcByteArray_Advise_DontNeed);
     LONGBOW_RUN_TEST_CASE(Global, parcByteArray_Copy_Allocated);
     LONGBOW_RUN_TEST_CASE(Global, parcByteArray_Copy_Wrapped);
     LONGBOW_RUN_TEST_CASE(Global, parcByteArray_Compare);
@@ -277,6 +288,152 @@ LONGBOW_TEST_CASE(Global, parcByteArray_Capacity)
     parcByteArray_Release(&actual);
 }
 
+LONGBOW_TEST_CASE(Global, parcByteArray_Reallocate)
+{
+    uint8_t expected[10] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+    PARCByteArray *array = parcByteArray_Allocate(10);
+    parcByteArray_PutBytes(array, 0, 10, expected);
+
+    assertTrue(parcByteArray_Reallocate(array, 20), "Expected an unshared, allocated array to be reallocated.");
+    assertTrue(parcByteArray_Capacity(array) == 20, "Expected capacity 20, actual %zd", parcByteArray_Capacity(array));
+    assertTrue(memcmp(parcByteArray_Array(array), expected, 10) == 0, "Expected the original contents to be preserved.");
+    for (size_t i = 10; i < 20; i++) {
+        assertTrue(parcByteArray_GetByte(array, i) == 0, "Expected byte %zd to be zero.", i);
+    }
+
+    assertTrue(parcByteArray_Reallocate(array, 5), "Expected an unshared, allocated array to be shrunk.");
+    assertTrue(parcByteArray_Capacity(array) == 5, "Expected capacity 5, actual %zd", parcByteArray_Capacity(array));
+    assertTrue(memcmp(parcByteArray_Array(array), expected, 5) == 0, "Expected the original contents to be preserved.");
+
+    parcByteArray_Release(&array);
+}
+
+LONGBOW_TEST_CASE(Global, parcByteArray_Reallocate_Shared)
+{
+    PARCByteArray *array = parcByteArray_Allocate(10);
+    PARCByteArray *reference = parcByteArray_Acquire(array);
+
+    assertFalse(parcByteArray_Reallocate(array, 20), "Expected a shared array not to be reallocated.");
+    assertTrue(parcByteArray_Capacity(array) == 10, "Expected capacity 10, actual %zd", parcByteArray_Capacity(array));
+
+    parcByteArray_Release(&reference);
+    parcByteArray_Release(&array);
+}
+
+LONGBOW_TEST_CASE(Global, parcByteArray_Reallocate_Wrapped)
+{
+    uint8_t buffer[10];
+    PARCByteArray *array = parcByteArray_Wrap(10, buffer);
+
+    assertFalse(parcByteArray_Reallocate(array, 20), "Expected a wrapped array not to be reallocated.");
+    assertTrue(parcByteArray_Array(array) == buffer, "Expected the wrapped array to be unchanged.");
+
+    parcByteArray_Release(&array);
+}
+
+static int
+_createMappableFile(size_t length)
+{
+    char pathName[] = "/tmp/test_parc_ByteArray_XXXXXX";
+    int fd = mkstemp(pathName);
+    assertTrue(fd >= 0, "mkstemp failed: %s", strerror(errno));
+    unlink(pathName);
+
+    for (size_t i = 0; i < length; i++) {
+        uint8_t byte = (uint8_t) i;
+        assertTrue(write(fd, &byte, 1) == 1, "write failed: %s", strerror(errno));
+    }
+    return fd;
+}
+
+LONGBOW_TEST_CASE(Global, parcByteArray_MapFile)
+{
+    int fd = _createMappableFile(10000);
+    PARCByteArray *array = parcByteArray_MapFile(fd, 0, 10000);
+    close(fd);
+
+    assertNotNull(array, "Expected parcByteArray_MapFile to succeed.");
+    assertTrue(parcByteArray_IsMapped(array), "Expected the array to be mapped.");
+    assertTrue(parcByteArray_Capacity(array) == 10000, "Expected capacity 10000, actual %zd", parcByteArray_Capacity(array));
+    for (size_t i = 0; i < 10000; i++) {
+        assertTrue(parcByteArray_GetByte(array, i) == (uint8_t) i, "Unexpected byte at index %zd", i);
+    }
+
+    parcByteArray_Release(&array);
+}
+
+LONGBOW_TEST_CASE(Global, parcByteArray_MapFile_Offset)
+{
+    int fd = _createMappableFile(10000);
+    PARCByteArray *array = parcByteArray_MapFile(fd, 4099, 100);
+    close(fd);
+
+    assertNotNull(array, "Expected parcByteArray_MapFile to succeed with an unaligned offset.");
+    assertTrue(parcByteArray_Capacity(array) == 100, "Expected capacity 100, actual %zd", parcByteArray_Capacity(array));
+    for (size_t i = 0; i < 100; i++) {
+        assertTrue(parcByteArray_GetByte(array, i) == (uint8_t) (4099 + i), "Unexpected byte at index %zd", i);
+    }
+
+    parcByteArray_Release(&array);
+}
+
+LONGBOW_TEST_CASE(Global, parcByteArray_MapFile_Empty)
+{
+    int fd = _createMappableFile(0);
+    PARCByteArray *array = parcByteArray_MapFile(fd, 0, 0);
+    close(fd);
+
+    assertNotNull(array, "Expected an empty array for an empty region.");
+    assertTrue(parcByteArray_Capacity(array) == 0, "Expected capacity 0, actual %zd", parcByteArray_Capacity(array));
+
+    parcByteArray_Release(&array);
+}
+
+LONGBOW_TEST_CASE(Global, parcByteArray_MapFile_BadDescriptor)
+{
+    PARCByteArray *array = parcByteArray_MapFile(-1, 0, 100);
+    assertNull(array, "Expected NULL for an invalid file descriptor.");
+}
+
+LONGBOW_TEST_CASE(Global, parcByteArray_Advise)
+{
+    int fd = _createMappableFile(10000);
+    PARCByteArray *array = parcByteArray_MapFile(fd, 0, 10000);
+    close(fd);
+
+    assertTrue(parcByteArray_Advise(array, 0, 10000, PARCByteArrayAdvice_Sequential), "Expected sequential advice to be accepted.");
+    assertTrue(parcByteArray_Advise(array, 5000, 10, PARCByteArrayAdvice_Random), "Expected random advice to be accepted.");
+    assertTrue(parcByteArray_Advise(array, 123, 4000, PARCByteArrayAdvice_WillNeed), "Expected willneed advice to be accepted.");
+    assertTrue(parcByteArray_GetByte(array, 9999) == (uint8_t) 9999, "Expected advice not to change the contents.");
+    parcByteArray_Release(&array);
+
+    PARCByteArray *allocated = parcByteArray_Allocate(10);
+    assertFalse(parcByteArray_IsMapped(allocated), "Expected an allocated array not to be mapped.");
+    assertTrue(parcByteArray_Advise(allocated, 0, 10, PARCByteArrayAdvice_DontNeed), "Expected advice to be ignored.");
+    parcByteArray_Release(&allocated);
+}
+
+LONGBOW_TEST_CASE(Global, parcByteArray_Advise_DontNeed)
+{
+    int fd = _createMappableFile(20000);
+    PARCByteArray *array = parcByteArray_MapFile(fd, 0, 20000);
+    close(fd);
+
+    // Touch every page, then discard the middle of the mapping, starting and ending part way through a page.
+    for (size_t i = 0; i < 20000; i++) {
+        assertTrue(parcByteArray_GetByte(array, i) == (uint8_t) i, "Unexpected byte at index %zd", i);
+    }
+    assertTrue(parcByteArray_Advise(array, 1000, 15000, PARCByteArrayAdvice_DontNeed), "Expected dontneed advice to be accepted.");
+    assertTrue(parcByteArray_Advise(array, 5, 10, PARCByteArrayAdvice_DontNeed), "Expected advice within one page to be accepted.");
+
+    // Discarded pages are read again from the file, and the bytes around the range are untouched.
+    for (size_t i = 0; i < 20000; i++) {
+        assertTrue(parcByteArray_GetByte(array, i) == (uint8_t) i, "Unexpected byte at index %zd after dontneed advice", i);
+    }
+
+    parcByteArray_Release(&array);
+}
+
 LONGBOW_TEST_CASE(Global, parcByteArray_CopyOut)
 {
     uint8_t expected[10] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
@@ -430,6 +587,8 @@ LONGBOW_TEST_FIXTURE(Errors)
     LONGBOW_RUN_TEST_CASE(Errors, parcByteArray_Get_overrun);
     LONGBOW_RUN_TEST_CASE(Errors, parcByteArray_CopyIn_overrun);
     LONGBOW_RUN_TEST_CASE(Errors, parcByteArray_CopyOut_overrun);
+    LONGBOW_RUN_TEST_CASE(Errors, parcByteArray_MapFile_PutByte);
+    LONGBOW_RUN_TEST_CASE(Errors, parcByteArray_MapFile_PutBytes);
 }
 
 typedef struct parc_byte_array_longbow_clipboard {
@@ -488,6 +647,32 @@ LONGBOW_TEST_CASE_EXPECTS(Errors, parcByteArray_CopyOut_overrun, .event = &LongB
     parcByteArray_GetBytes(original, 1, 10, actual); // This will fail.
 }
 
+LONGBOW_TEST_CASE_EXPECTS(Errors, parcByteArray_MapFile_PutByte, .event = &LongBowTrapUnexpectedStateEvent)
+{
+    parcByteArray_LongBowClipBoard *testData = longBowTestCase_GetClipBoardData(testCase);
+    parcByteArray_Release(&testData->byteArray);
+
+    int fd = _createMappableFile(100);
+    testData->byteArray = parcByteArray_MapFile(fd, 0, 100);
+    close(fd);
+
+    parcByteArray_PutByte(testData->byteArray, 0, 0xFF); // This will fail.
+}
+
+LONGBOW_TEST_CASE_EXPECTS(Errors, parcByteArray_MapFile_PutBytes, .event = &LongBowTrapUnexpectedStateEvent)
+{
+    uint8_t bytes[10] = { 0 };
+
+    parcByteArray_LongBowClipBoard *testData = longBowTestCase_GetClipBoardData(testCase);
+    parcByteArray_Release(&testData->byteArray);
+
+    int fd = _createMappableFile(100);
+    testData->byteArray = parcByteArray_MapFile(fd, 0, 100);
+    close(fd);
+
+    parcByteArray_PutBytes(testData->byteArray, 0, 10, bytes); // This will fail.
+}
+
 LONGBOW_TEST_CASE_EXPECTS(Errors, parcByteArray_Get_overrun, .event = &LongBowTrapOutOfBounds)
 {
     uint8_t buffer[10] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
@@ -0,0 +1,484 @@
+/*
+ * Copyright (c) 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Patent rights are not granted under this agreement. Patent rights are
+ *       available under FRAND terms.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX or PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * @copyright 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC).  All rights reserved.
+ */
+#include "../parc_Cache.c"
+
+#include <stdio.h>
+#include <inttypes.h>
+#include <sys/time.h>
+
+#include <LongBow/testing.h>
+#include <LongBow/debugging.h>
+#include <parc/algol/parc_Memory.h>
+#include <parc/algol/parc_SafeMemory.h>
+#include <parc/algol/parc_Buffer.h>
+
+#include <parc/testing/parc_MemoryTesting.h>
+#include <parc/testing/parc_ObjectTesting.h>
+
+static PARCBuffer *
+_key(uint32_t value)
+{
+    PARCBuffer *result = parcBuffer_Allocate(sizeof(uint32_t));
+    parcBuffer_PutUint32(result, value);
+    return parcBuffer_Flip(result);
+}
+
+static void
+_put(PARCCache *cache, uint32_t key, uint32_t value)
+{
+    PARCBuffer *k = _key(key);
+    PARCBuffer *v = _key(value);
+    parcCache_Put(cache, k, v);
+    parcBuffer_Release(&v);
+    parcBuffer_Release(&k);
+}
+
+static bool
+_contains(PARCCache *cache, uint32_t key)
+{
+    PARCBuffer *k = _key(key);
+    bool result = parcCache_Get(cache, k) != NULL;
+    parcBuffer_Release(&k);
+    return result;
+}
+
+typedef struct {
+    size_t count;
+    uint32_t lastKey;
+    PARCCacheEvictionReason lastReason;
+} _EvictionLog;
+
+static void
+_recordEviction(const PARCObject *key, const PARCObject *value, PARCCacheEvictionReason reason, void *context)
+{
+    _EvictionLog *log = context;
+    log->count++;
+    log->lastKey = parcBuffer_GetUint32(parcBuffer_Rewind((PARCBuffer *) key));
+    log->lastReason = reason;
+}
+
+LONGBOW_TEST_RUNNER(parc_Cache)
+{
+    LONGBOW_RUN_TEST_FIXTURE(CreateAcquireRelease);
+    LONGBOW_RUN_TEST_FIXTURE(Global);
+    LONGBOW_RUN_TEST_FIXTURE(Performance);
+}
+
+LONGBOW_TEST_RUNNER_SETUP(parc_Cache)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_RUNNER_TEARDOWN(parc_Cache)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_FIXTURE(CreateAcquireRelease)
+{
+    LONGBOW_RUN_TEST_CASE(CreateAcquireRelease, CreateRelease);
+    LONGBOW_RUN_TEST_CASE(CreateAcquireRelease, CreateWithClock);
+}
+
+LONGBOW_TEST_FIXTURE_SETUP(CreateAcquireRelease)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_FIXTURE_TEARDOWN(CreateAcquireRelease)
+{
+    if (!parcMemoryTesting_ExpectedOutstanding(0, "%s leaked memory.", longBowTestCase_GetFullName(testCase))) {
+        return LONGBOW_STATUS_MEMORYLEAK;
+    }
+
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_CASE(CreateAcquireRelease, CreateRelease)
+{
+    PARCCache *instance = parcCache_Create(10);
+    assertNotNull(instance, "Expected non-null result from parcCache_Create().");
+
+    parcObjectTesting_AssertAcquireReleaseContract(parcCache_Acquire, instance);
+
+    parcCache_Release(&instance);
+    assertNull(instance, "Expected null result from parcCache_Release().");
+}
+
+LONGBOW_TEST_CASE(CreateAcquireRelease, CreateWithClock)
+{
+    PARCClock *clock = parcClock_Counter();
+    PARCCache *instance = parcCache_CreateWithClock(10, clock);
+    parcClock_Release(&clock);
+
+    assertTrue(parcCache_IsValid(instance), "Expected parcCache_CreateWithClock to result in a valid instance.");
+    assertTrue(parcCache_Capacity(instance) == 10, "Expected capacity 10, actual %zu", parcCache_Capacity(instance));
+
+    parcCache_Release(&instance);
+}
+
+LONGBOW_TEST_FIXTURE(Global)
+{
+    LONGBOW_RUN_TEST_CASE(Global, parcCache_Display);
+    LONGBOW_RUN_TEST_CASE(Global, parcCache_IsValid);
+    LONGBOW_RUN_TEST_CASE(Global, parcCache_Put_Get);
+    LONGBOW_RUN_TEST_CASE(Global, parcCache_Put_Replace);
+    LONGBOW_RUN_TEST_CASE(Global, parcCache_Remove);
+    LONGBOW_RUN_TEST_CASE(Global, parcCache_Clear);
+    LONGBOW_RUN_TEST_CASE(Global, parcCache_Evict_Capacity);
+    LONGBOW_RUN_TEST_CASE(Global, parcCache_Evict_SecondChance);
+    LONGBOW_RUN_TEST_CASE(Global, parcCache_Evict_Many);
+    LONGBOW_RUN_TEST_CASE(Global, parcCache_TimeToLive);
+    LONGBOW_RUN_TEST_CASE(Global, parcCache_TimeToLive_Overflow);
+    LONGBOW_RUN_TEST_CASE(Global, parcCache_TimeToLive_PreferredForEviction);
+    LONGBOW_RUN_TEST_CASE(Global, parcCache_Statistics);
+}
+
+LONGBOW_TEST_FIXTURE_SETUP(Global)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_FIXTURE_TEARDOWN(Global)
+{
+    if (!parcMemoryTesting_ExpectedOutstanding(0, "%s mismanaged memory.", longBowTestCase_GetFullName(testCase))) {
+        return LONGBOW_STATUS_MEMORYLEAK;
+    }
+
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_CASE(Global, parcCache_Display)
+{
+    PARCCache *cache = parcCache_Create(10);
+    _put(cache, 1, 100);
+    parcCache_Display(cache, 0);
+    parcCache_Release(&cache);
+}
+
+LONGBOW_TEST_CASE(Global, parcCache_IsValid)
+{
+    PARCCache *instance = parcCache_Create(10);
+    assertTrue(parcCache_IsValid(instance), "Expected parcCache_Create to result in a valid instance.");
+
+    parcCache_Release(&instance);
+    assertFalse(parcCache_IsValid(instance), "Expected parcCache_Release to result in an invalid instance.");
+}
+
+LONGBOW_TEST_CASE(Global, parcCache_Put_Get)
+{
+    PARCCache *cache = parcCache_Create(10);
+    PARCBuffer *key = _key(1);
+    PARCBuffer *value = _key(100);
+
+    parcCache_Put(cache, key, value);
+
+    assertTrue(parcCache_Size(cache) == 1, "Expected size 1, actual %zu", parcCache_Size(cache));
+    const PARCBuffer *actual = parcCache_Get(cache, key);
+    assertTrue(parcBuffer_Equals(value, actual), "Expected the value that was put.");
+
+    PARCBuffer *absent = _key(2);
+    assertNull(parcCache_Get(cache, absent), "Expected NULL for an absent key.");
+    parcBuffer_Release(&absent);
+
+    parcBuffer_Release(&value);
+    parcBuffer_Release(&key);
+    parcCache_Release(&cache);
+}
+
+LONGBOW_TEST_CASE(Global, parcCache_Put_Replace)
+{
+    PARCCache *cache = parcCache_Create(10);
+    PARCBuffer *key = _key(1);
+    PARCBuffer *value1 = _key(100);
+    PARCBuffer *value2 = _key(200);
+
+    parcCache_Put(cache, key, value1);
+    parcCache_Put(cache, key, value2);
+
+    assertTrue(parcCache_Size(cache) == 1, "Expected size 1, actual %zu", parcCache_Size(cache));
+    assertTrue(parcBuffer_Equals(value2, parcCache_Get(cache, key)), "Expected the replacement value.");
+
+    parcBuffer_Release(&value2);
+    parcBuffer_Release(&value1);
+    parcBuffer_Release(&key);
+    parcCache_Release(&cache);
+}
+
+LONGBOW_TEST_CASE(Global, parcCache_Remove)
+{
+    PARCCache *cache = parcCache_Create(10);
+    _put(cache, 1, 100);
+    _put(cache, 2, 200);
+
+    PARCBuffer *key = _key(1);
+    assertTrue(parcCache_Remove(cache, key), "Expected parcCache_Remove to find the key.");
+    assertFalse(parcCache_Remove(cache, key), "Expected a second parcCache_Remove to not find the key.");
+    parcBuffer_Release(&key);
+
+    assertFalse(_contains(cache, 1), "Expected the removed key to be absent.");
+    assertTrue(_contains(cache, 2), "Expected the other key to be present.");
+    assertTrue(parcCache_Size(cache) == 1, "Expected size 1, actual %zu", parcCache_Size(cache));
+
+    parcCache_Release(&cache);
+}
+
+LONGBOW_TEST_CASE(Global, parcCache_Clear)
+{
+    PARCCache *cache = parcCache_Create(10);
+    for (uint32_t i = 0; i < 10; i++) {
+        _put(cache, i, i);
+    }
+
+    parcCache_Clear(cache);
+    assertTrue(parcCache_Size(cache) == 0, "Expected an empty cache, actual size %zu", parcCache_Size(cache));
+
+    _put(cache, 1, 1);
+    assertTrue(_contains(cache, 1), "Expected the cache to be usable after parcCache_Clear.");
+
+    parcCache_Release(&cache);
+}
+
+LONGBOW_TEST_CASE(Global, parcCache_Evict_Capacity)
+{
+    PARCCache *cache = parcCache_Create(3);
+    _EvictionLog log = { 0 };
+    parcCache_SetEvictionCallback(cache, _recordEviction, &log);
+
+    _put(cache, 1, 1);
+    _put(cache, 2, 2);
+    _put(cache, 3, 3);
+    _put(cache, 4, 4);
+
+    assertTrue(parcCache_Size(cache) == 3, "Expected size 3, actual %zu", parcCache_Size(cache));
+    assertTrue(log.count == 1, "Expected 1 eviction callback, actual %zu", log.count);
+    assertTrue(log.lastKey == 1, "Expected the oldest key to be evicted, actual %u", log.lastKey);
+    assertTrue(log.lastReason == PARCCacheEvictionReason_Capacity, "Expected a capacity eviction.");
+    assertFalse(_contains(cache, 1), "Expected key 1 to be evicted.");
+    assertTrue(parcCache_GetEvictions(cache) == 1, "Expected 1 eviction, actual %" PRIu64, parcCache_GetEvictions(cache));
+
+    parcCache_Release(&cache);
+}
+
+LONGBOW_TEST_CASE(Global, parcCache_Evict_SecondChance)
+{
+    PARCCache *cache = parcCache_Create(3);
+    _EvictionLog log = { 0 };
+    parcCache_SetEvictionCallback(cache, _recordEviction, &log);
+
+    _put(cache, 1, 1);
+    _put(cache, 2, 2);
+    _put(cache, 3, 3);
+
+    // Reading key 1 gives it a second chance, so key 2 is the victim.
+    assertTrue(_contains(cache, 1), "Expected key 1 to be present.");
+    _put(cache, 4, 4);
+
+    assertTrue(log.lastKey == 2, "Expected key 2 to be evicted, actual %u", log.lastKey);
+    assertTrue(_contains(cache, 1), "Expected key 1 to survive.");
+    assertTrue(_contains(cache, 3), "Expected key 3 to survive.");
+    assertTrue(_contains(cache, 4), "Expected key 4 to be present.");
+
+    parcCache_Release(&cache);
+}
+
+LONGBOW_TEST_CASE(Global, parcCache_Evict_Many)
+{
+    PARCCache *cache = parcCache_Create(100);
+
+    for (uint32_t i = 0; i < 10000; i++) {
+        _put(cache, i, i);
+        // Keep a small hot set referenced.
+        _contains(cache, i % 10);
+        assertTrue(parcCache_Size(cache) <= 100, "Expected the size to be bounded, actual %zu", parcCache_Size(cache));
+    }
+
+    for (uint32_t i = 0; i < 10; i++) {
+        assertTrue(_contains(cache, i), "Expected hot key %u to survive.", i);
+    }
+    assertTrue(parcCache_GetEvictions(cache) == 10000 - 100,
+               "Expected %d evictions, actual %" PRIu64, 10000 - 100, parcCache_GetEvictions(cache));
+
+    parcCache_Release(&cache);
+}
+
+LONGBOW_TEST_CASE(Global, parcCache_TimeToLive)
+{
+    // The counter clock advances by one on every reading.
+    PARCClock *clock = parcClock_Counter();
+    PARCCache *cache = parcCache_CreateWithClock(10, clock);
+    parcClock_Release(&clock);
+
+    _EvictionLog log = { 0 };
+    parcCache_SetEvictionCallback(cache, _recordEviction, &log);
+
+    PARCBuffer *key = _key(1);
+    PARCBuffer *value = _key(100);
+
+    parcCache_PutWithTimeToLive(cache, key, value, 3);           // t = 1, expires at t = 4
+
+    assertNotNull(parcCache_Get(cache, key), "Expected a hit at t = 2");
+    assertNotNull(parcCache_Get(cache, key), "Expected a hit at t = 3");
+    assertNull(parcCache_Get(cache, key), "Expected a miss at t = 4");
+
+    assertTrue(parcCache_Size(cache) == 0, "Expected the expired entry to be removed, size %zu", parcCache_Size(cache));
+    assertTrue(parcCache_GetExpirations(cache) == 1, "Expected 1 expiration, actual %" PRIu64, parcCache_GetExpirations(cache));
+    assertTrue(log.count == 1 && log.lastReason == PARCCacheEvictionReason_Expired, "Expected an expiry eviction callback.");
+
+    parcBuffer_Release(&value);
+    parcBuffer_Release(&key);
+    parcCache_Release(&cache);
+}
+
+LONGBOW_TEST_CASE(Global, parcCache_TimeToLive_Overflow)
+{
+    PARCClock *clock = parcClock_Counter();
+    PARCCache *cache = parcCache_CreateWithClock(10, clock);
+    parcClock_Release(&clock);
+
+    PARCBuffer *key = _key(1);
+    PARCBuffer *value = _key(100);
+
+    // now + UINT64_MAX wraps around, which must not make the entry expire at once.
+    parcCache_PutWithTimeToLive(cache, key, value, UINT64_MAX);
+
+    assertNotNull(parcCache_Get(cache, key), "Expected a hit for an entry with the largest time to live.");
+    assertNotNull(parcCache_Get(cache, key), "Expected a hit for an entry with the largest time to live.");
+    assertTrue(parcCache_GetExpirations(cache) == 0, "Expected no expirations, actual %" PRIu64, parcCache_GetExpirations(cache));
+
+    parcBuffer_Release(&value);
+    parcBuffer_Release(&key);
+    parcCache_Release(&cache);
+}
+
+LONGBOW_TEST_CASE(Global, parcCache_TimeToLive_PreferredForEviction)
+{
+    PARCClock *clock = parcClock_Counter();
+    PARCCache *cache = parcCache_CreateWithClock(2, clock);
+    parcClock_Release(&clock);
+
+    _EvictionLog log = { 0 };
+    parcCache_SetEvictionCallback(cache, _recordEviction, &log);
+
+    PARCBuffer *key1 = _key(1);
+    PARCBuffer *key2 = _key(2);
+    PARCBuffer *key3 = _key(3);
+
+    parcCache_Put(cache, key1, key1);
+    parcCache_PutWithTimeToLive(cache, key2, key2, 1);
+    parcCache_Get(cache, key1);
+    parcCache_Put(cache, key3, key3);
+
+    assertTrue(log.lastKey == 2, "Expected the expired key 2 to be evicted, actual %u", log.lastKey);
+    assertTrue(log.lastReason == PARCCacheEvictionReason_Expired, "Expected an expiry eviction.");
+    assertNotNull(parcCache_Get(cache, key1), "Expected key 1 to survive.");
+
+    parcBuffer_Release(&key3);
+    parcBuffer_Release(&key2);
+    parcBuffer_Release(&key1);
+    parcCache_Release(&cache);
+}
+
+LONGBOW_TEST_CASE(Global, parcCache_Statistics)
+{
+    PARCCache *cache = parcCache_Create(10);
+
+    _put(cache, 1, 1);
+    _contains(cache, 1);
+    _contains(cache, 1);
+    _contains(cache, 2);
+
+    assertTrue(parcCache_GetHits(cache) == 2, "Expected 2 hits, actual %" PRIu64, parcCache_GetHits(cache));
+    assertTrue(parcCache_GetMisses(cache) == 1, "Expected 1 miss, actual %" PRIu64, parcCache_GetMisses(cache));
+    assertTrue(parcCache_GetEvictions(cache) == 0, "Expected 0 evictions, actual %" PRIu64, parcCache_GetEvictions(cache));
+    assertTrue(parcCache_GetExpirations(cache) == 0, "Expected 0 expirations, actual %" PRIu64, parcCache_GetExpirations(cache));
+
+    parcCache_Release(&cache);
+}
+
+LONGBOW_TEST_FIXTURE_OPTIONS(Performance, .enabled = false)
+{
+    LONGBOW_RUN_TEST_CASE(Performance, parcCache_PutGet);
+}
+
+LONGBOW_TEST_FIXTURE_SETUP(Performance)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_FIXTURE_TEARDOWN(Performance)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_CASE(Performance, parcCache_PutGet)
+{
+    size_t capacity = 100000;
+    size_t keyCount = 4 * capacity;
+    PARCCache *cache = parcCache_Create(capacity);
+
+    PARCBuffer **keys = parcMemory_Allocate(keyCount * sizeof(PARCBuffer *));
+    for (size_t i = 0; i < keyCount; i++) {
+        keys[i] = _key((uint32_t) i);
+    }
+
+    struct timeval start, end, elapsed;
+    gettimeofday(&start, NULL);
+    for (size_t round = 0; round < 10; round++) {
+        for (size_t i = 0; i < keyCount; i++) {
+            // Skew the lookups so that a quarter of the keys receive most of the traffic.
+            PARCBuffer *key = keys[(i % 4 == 0) ? i : i % capacity];
+            if (parcCache_Get(cache, key) == NULL) {
+                parcCache_Put(cache, key, key);
+            }
+        }
+    }
+    gettimeofday(&end, NULL);
+    timersub(&end, &start, &elapsed);
+
+    printf("parcCache %zu operations: %ld.%06ld seconds, hits %" PRIu64 " misses %" PRIu64 " evictions %" PRIu64 "\n",
+           10 * keyCount, (long) elapsed.tv_sec, (long) elapsed.tv_usec,
+           parcCache_GetHits(cache), parcCache_GetMisses(cache), parcCache_GetEvictions(cache));
+
+    for (size_t i = 0; i < keyCount; i++) {
+        parcBuffer_Release(&keys[i]);
+    }
+    parcMemory_Deallocate((void **) &keys);
+    parcCache_Release(&cache);
+}
+
+int
+main(int argc, char *argv[argc])
+{
+    LongBowRunner *testRunner = LONGBOW_TEST_RUNNER_CREATE(parc_Cache);
+    int exitStatus = longBowMain(argc, argv, testRunner, NULL);
+    longBowTestRunner_Destroy(&testRunner);
+    exit(exitStatus);
+}
@@ -0,0 +1,479 @@
+/*
+ * Copyright (c) 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Patent rights are not granted under this agreement. Patent rights are
+ *       available under FRAND terms.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX or PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * @copyright 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC).  All rights reserved.
+ */
+
+// Include the file(s) containing the functions to be tested.
+// This permits internal static functions to be visible to this Test Framework.
+#include "../parc_ContentDefinedChunker.c"
+
+#include <sys/time.h>
+
+#include <LongBow/testing.h>
+#include <LongBow/debugging.h>
+#include <parc/algol/parc_Memory.h>
+#include <parc/algol/parc_SafeMemory.h>
+#include <parc/algol/parc_Chunker.h>
+
+#include <parc/testing/parc_MemoryTesting.h>
+#include <parc/testing/parc_ObjectTesting.h>
+
+LONGBOW_TEST_RUNNER(parc_ContentDefinedChunker)
+{
+    LONGBOW_RUN_TEST_FIXTURE(CreateAcquireRelease);
+    LONGBOW_RUN_TEST_FIXTURE(Global);
+    LONGBOW_RUN_TEST_FIXTURE(Performance);
+}
+
+LONGBOW_TEST_RUNNER_SETUP(parc_ContentDefinedChunker)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_RUNNER_TEARDOWN(parc_ContentDefinedChunker)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+/**
+ * Fill a buffer with reproducible pseudo-random bytes (xorshift64).
+ */
+static PARCBuffer *
+_createRandomBuffer(size_t length, uint64_t seed)
+{
+    PARCBuffer *buffer = parcBuffer_Allocate(length);
+    uint8_t *bytes = parcBuffer_Overlay(buffer, 0);
+    uint64_t x = seed;
+    for (size_t i = 0; i < length; i++) {
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+        bytes[i] = (uint8_t) x;
+    }
+    return buffer;
+}
+
+/**
+ * Collect the chunks produced by an iterator, releasing the iterator.
+ */
+static PARCBuffer **
+_collect(PARCIterator *iterator, size_t *countP)
+{
+    size_t capacity = 16;
+    size_t count = 0;
+    PARCBuffer **chunks = parcMemory_Allocate(capacity * sizeof(PARCBuffer *));
+    while (parcIterator_HasNext(iterator)) {
+        if (count == capacity) {
+            capacity *= 2;
+            chunks = parcMemory_Reallocate(chunks, capacity * sizeof(PARCBuffer *));
+        }
+        chunks[count++] = parcIterator_Next(iterator);
+    }
+    parcIterator_Release(&iterator);
+    *countP = count;
+    return chunks;
+}
+
+static void
+_releaseAll(PARCBuffer **chunks, size_t count)
+{
+    for (size_t i = 0; i < count; i++) {
+        parcBuffer_Release(&chunks[i]);
+    }
+    parcMemory_Deallocate(&chunks);
+}
+
+LONGBOW_TEST_FIXTURE(CreateAcquireRelease)
+{
+    LONGBOW_RUN_TEST_CASE(CreateAcquireRelease, CreateRelease);
+    LONGBOW_RUN_TEST_CASE(CreateAcquireRelease, CreateFromFile);
+}
+
+LONGBOW_TEST_FIXTURE_SETUP(CreateAcquireRelease)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_FIXTURE_TEARDOWN(CreateAcquireRelease)
+{
+    if (!parcMemoryTesting_ExpectedOutstanding(0, "%s leaked memory.", longBowTestCase_GetFullName(testCase))) {
+        return LONGBOW_STATUS_MEMORYLEAK;
+    }
+
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_CASE(CreateAcquireRelease, CreateRelease)
+{
+    PARCBuffer *data = _createRandomBuffer(4096, 1);
+    PARCContentDefinedChunker *instance = parcContentDefinedChunker_Create(data, 256, 1000, 4096);
+    assertNotNull(instance, "Expected non-null result from parcContentDefinedChunker_Create");
+    assertTrue(instance->averageSize == 512, "Expected the average size to be rounded down to 512, actual %zu", instance->averageSize);
+
+    parcObjectTesting_AssertAcquireReleaseContract(parcContentDefinedChunker_Acquire, instance);
+
+    parcContentDefinedChunker_Release(&instance);
+    assertNull(instance, "Expected null result from parcContentDefinedChunker_Release");
+    parcBuffer_Release(&data);
+}
+
+LONGBOW_TEST_CASE(CreateAcquireRelease, CreateFromFile)
+{
+    PARCBuffer *data = _createRandomBuffer(100000, 2);
+
+    FILE *fp = fopen("/tmp/content_defined_chunker.tmp", "w");
+    fwrite(parcBuffer_Overlay(data, 0), 1, parcBuffer_Remaining(data), fp);
+    fclose(fp);
+
+    PARCFile *file = parcFile_Create("/tmp/content_defined_chunker.tmp");
+    PARCContentDefinedChunker *fromFile = parcContentDefinedChunker_CreateFromFile(file, 512, 2048, 8192);
+    assertNotNull(fromFile, "Expected non-null result from parcContentDefinedChunker_CreateFromFile");
+    parcFile_Release(&file);
+    unlink("/tmp/content_defined_chunker.tmp");
+
+    PARCContentDefinedChunker *fromBuffer = parcContentDefinedChunker_Create(data, 512, 2048, 8192);
+
+    size_t fileCount;
+    PARCBuffer **fileChunks = _collect(parcContentDefinedChunker_ForwardIterator(fromFile), &fileCount);
+    size_t bufferCount;
+    PARCBuffer **bufferChunks = _collect(parcContentDefinedChunker_ForwardIterator(fromBuffer), &bufferCount);
+
+    assertTrue(fileCount == bufferCount, "Expected %zu chunks from the file, actual %zu", bufferCount, fileCount);
+    for (size_t i = 0; i < fileCount; i++) {
+        assertTrue(parcBuffer_Equals(fileChunks[i], bufferChunks[i]), "Expected chunk %zu of the file to equal chunk %zu of the buffer", i, i);
+    }
+
+    _releaseAll(fileChunks, fileCount);
+    _releaseAll(bufferChunks, bufferCount);
+    parcContentDefinedChunker_Release(&fromFile);
+    parcContentDefinedChunker_Release(&fromBuffer);
+    parcBuffer_Release(&data);
+}
+
+LONGBOW_TEST_FIXTURE(Global)
+{
+    LONGBOW_RUN_TEST_CASE(Global, parcContentDefinedChunker_ForwardIterator);
+    LONGBOW_RUN_TEST_CASE(Global, parcContentDefinedChunker_ForwardIterator_Empty);
+    LONGBOW_RUN_TEST_CASE(Global, parcContentDefinedChunker_ForwardIterator_Small);
+    LONGBOW_RUN_TEST_CASE(Global, parcContentDefinedChunker_ForwardIterator_Uniform);
+    LONGBOW_RUN_TEST_CASE(Global, parcContentDefinedChunker_ForwardIterator_Twice);
+    LONGBOW_RUN_TEST_CASE(Global, parcContentDefinedChunker_ReverseIterator);
+    LONGBOW_RUN_TEST_CASE(Global, parcContentDefinedChunker_AsChunker);
+    LONGBOW_RUN_TEST_CASE(Global, parcContentDefinedChunker_FindBoundary_Deterministic);
+    LONGBOW_RUN_TEST_CASE(Global, parcContentDefinedChunker_InsertionResistance);
+}
+
+LONGBOW_TEST_FIXTURE_SETUP(Global)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_FIXTURE_TEARDOWN(Global)
+{
+    if (!parcMemoryTesting_ExpectedOutstanding(0, "%s mismanaged memory.", longBowTestCase_GetFullName(testCase))) {
+        return LONGBOW_STATUS_MEMORYLEAK;
+    }
+
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_CASE(Global, parcContentDefinedChunker_ForwardIterator)
+{
+    size_t length = 1024 * 1024;
+    PARCBuffer *data = _createRandomBuffer(length, 3);
+    PARCContentDefinedChunker *chunker = parcContentDefinedChunker_Create(data, 1024, 4096, 16384);
+
+    size_t count;
+    PARCBuffer **chunks = _collect(parcContentDefinedChunker_ForwardIterator(chunker), &count);
+
+    size_t offset = 0;
+    for (size_t i = 0; i < count; i++) {
+        size_t size = parcBuffer_Remaining(chunks[i]);
+        if (i + 1 < count) {
+            assertTrue(size >= 1024 && size <= 16384, "Expected chunk %zu to be between the minimum and maximum size, actual %zu", i, size);
+        }
+        assertTrue(memcmp(parcBuffer_Overlay(chunks[i], 0), parcByteArray_AddressOfIndex(parcBuffer_Array(data), offset), size) == 0,
+                   "Expected chunk %zu to be the data at offset %zu", i, offset);
+        offset += size;
+    }
+    assertTrue(offset == length, "Expected the chunks to cover all %zu bytes, actual %zu", length, offset);
+
+    size_t average = length / count;
+    assertTrue(average > 2048 && average < 8192, "Expected an average chunk size near 4096, actual %zu", average);
+    assertTrue(parcBuffer_Position(data) == 0 && parcBuffer_Limit(data) == length, "Expected the data to be unmodified");
+
+    _releaseAll(chunks, count);
+    parcContentDefinedChunker_Release(&chunker);
+    parcBuffer_Release(&data);
+}
+
+LONGBOW_TEST_CASE(Global, parcContentDefinedChunker_ForwardIterator_Empty)
+{
+    PARCBuffer *data = parcBuffer_Allocate(0);
+    PARCContentDefinedChunker *chunker = parcContentDefinedChunker_Create(data, 64, 256, 1024);
+
+    PARCIterator *iterator = parcContentDefinedChunker_ForwardIterator(chunker);
+    assertFalse(parcIterator_HasNext(iterator), "Expected no chunks from empty data");
+    parcIterator_Release(&iterator);
+
+    parcContentDefinedChunker_Release(&chunker);
+    parcBuffer_Release(&data);
+}
+
+LONGBOW_TEST_CASE(Global, parcContentDefinedChunker_ForwardIterator_Small)
+{
+    PARCBuffer *data = _createRandomBuffer(100, 4);
+    PARCContentDefinedChunker *chunker = parcContentDefinedChunker_Create(data, 128, 256, 1024);
+
+    size_t count;
+    PARCBuffer **chunks = _collect(parcContentDefinedChunker_ForwardIterator(chunker), &count);
+    assertTrue(count == 1, "Expected data shorter than the minimum size to be one chunk, actual %zu", count);
+    assertTrue(parcBuffer_Equals(chunks[0], data), "Expected the chunk to be all of the data");
+
+    _releaseAll(chunks, count);
+    parcContentDefinedChunker_Release(&chunker);
+    parcBuffer_Release(&data);
+}
+
+LONGBOW_TEST_CASE(Global, parcContentDefinedChunker_ForwardIterator_Uniform)
+{
+    // Data with no content to find a boundary in is cut at the maximum size.
+    size_t length = 10000;
+    PARCBuffer *data = parcBuffer_Allocate(length);
+    memset(parcBuffer_Overlay(data, 0), 0, length);
+    PARCContentDefinedChunker *chunker = parcContentDefinedChunker_Create(data, 256, 1024, 4096);
+
+    size_t count;
+    PARCBuffer **chunks = _collect(parcContentDefinedChunker_ForwardIterator(chunker), &count);
+    assertTrue(count == 3, "Expected 3 chunks, actual %zu", count);
+    assertTrue(parcBuffer_Remaining(chunks[0]) == 4096, "Expected the first chunk at the maximum size");
+    assertTrue(parcBuffer_Remaining(chunks[2]) == length - 2 * 4096, "Expected the last chunk to hold the remainder");
+
+    _releaseAll(chunks, count);
+    parcContentDefinedChunker_Release(&chunker);
+    parcBuffer_Release(&data);
+}
+
+LONGBOW_TEST_CASE(Global, parcContentDefinedChunker_ForwardIterator_Twice)
+{
+    PARCBuffer *data = _createRandomBuffer(200000, 5);
+    PARCContentDefinedChunker *chunker = parcContentDefinedChunker_Create(data, 512, 2048, 8192);
+
+    size_t firstCount;
+    PARCBuffer **first = _collect(parcContentDefinedChunker_ForwardIterator(chunker), &firstCount);
+    size_t secondCount;
+    PARCBuffer **second = _collect(parcContentDefinedChunker_ForwardIterator(chunker), &secondCount);
+
+    assertTrue(firstCount == secondCount, "Expected the same number of chunks each time");
+    for (size_t i = 0; i < firstCount; i++) {
+        assertTrue(parcBuffer_Equals(first[i], second[i]), "Expected chunk %zu to be the same each time", i);
+    }
+
+    _releaseAll(first, firstCount);
+    _releaseAll(second, secondCount);
+    parcContentDefinedChunker_Release(&chunker);
+    parcBuffer_Release(&data);
+}
+
+LONGBOW_TEST_CASE(Global, parcContentDefinedChunker_ReverseIterator)
+{
+    PARCBuffer *data = _createRandomBuffer(300000, 6);
+    PARCContentDefinedChunker *chunker = parcContentDefinedChunker_Create(data, 512, 2048, 8192);
+
+    size_t forwardCount;
+    PARCBuffer **forward = _collect(parcContentDefinedChunker_ForwardIterator(chunker), &forwardCount);
+    size_t reverseCount;
+    PARCBuffer **reverse = _collect(parcContentDefinedChunker_ReverseIterator(chunker), &reverseCount);
+
+    assertTrue(forwardCount == reverseCount, "Expected %zu chunks in reverse, actual %zu", forwardCount, reverseCount);
+    for (size_t i = 0; i < forwardCount; i++) {
+        assertTrue(parcBuffer_Equals(forward[i], reverse[reverseCount - 1 - i]),
+                   "Expected chunk %zu to be the same in both directions", i);
+    }
+
+    _releaseAll(forward, forwardCount);
+    _releaseAll(reverse, reverseCount);
+    parcContentDefinedChunker_Release(&chunker);
+    parcBuffer_Release(&data);
+}
+
+LONGBOW_TEST_CASE(Global, parcContentDefinedChunker_AsChunker)
+{
+    PARCBuffer *data = _createRandomBuffer(50000, 7);
+    PARCContentDefinedChunker *instance = parcContentDefinedChunker_Create(data, 256, 1024, 4096);
+    PARCChunker *chunker = parcChunker_Create(instance, PARCContentDefinedChunkerAsChunker);
+
+    size_t total = 0;
+    PARCIterator *iterator = parcChunker_ForwardIterator(chunker);
+    while (parcIterator_HasNext(iterator)) {
+        PARCBuffer *chunk = parcIterator_Next(iterator);
+        total += parcBuffer_Remaining(chunk);
+        parcBuffer_Release(&chunk);
+    }
+    parcIterator_Release(&iterator);
+    assertTrue(total == 50000, "Expected the chunks to cover all of the data, actual %zu", total);
+
+    parcChunker_Release(&chunker);
+    parcBuffer_Release(&data);
+}
+
+LONGBOW_TEST_CASE(Global, parcContentDefinedChunker_FindBoundary_Deterministic)
+{
+    // The boundaries of existing data must not change between releases.
+    PARCBuffer *data = _createRandomBuffer(65536, 8);
+    PARCContentDefinedChunker *chunker = parcContentDefinedChunker_Create(data, 256, 1024, 4096);
+
+    const uint8_t *bytes = parcBuffer_Overlay(data, 0);
+    size_t offsets[8];
+    size_t offset = 0;
+    for (size_t i = 0; i < 8; i++) {
+        offset += parcContentDefinedChunker_FindBoundary(chunker, &bytes[offset], 65536 - offset);
+        offsets[i] = offset;
+    }
+
+    static const size_t expected[8] = { 1854, 2912, 3739, 4803, 5085, 6205, 7285, 8550 };
+    for (size_t i = 0; i < 8; i++) {
+        assertTrue(offsets[i] == expected[i], "Expected boundary %zu at %zu, actual %zu", i, expected[i], offsets[i]);
+    }
+
+    parcContentDefinedChunker_Release(&chunker);
+    parcBuffer_Release(&data);
+}
+
+/**
+ * Return how many of the chunks in @p chunks have an equal chunk in @p others.
+ */
+static size_t
+_countShared(PARCBuffer **chunks, size_t count, PARCBuffer **others, size_t otherCount)
+{
+    size_t shared = 0;
+    for (size_t i = 0; i < count; i++) {
+        for (size_t j = 0; j < otherCount; j++) {
+            if (parcBuffer_Equals(chunks[i], others[j])) {
+                shared++;
+                break;
+            }
+        }
+    }
+    return shared;
+}
+
+LONGBOW_TEST_CASE(Global, parcContentDefinedChunker_InsertionResistance)
+{
+    size_t length = 256 * 1024;
+    PARCBuffer *original = _createRandomBuffer(length, 9);
+
+    // The same data with one byte inserted at the front.
+    PARCBuffer *edited = parcBuffer_Allocate(length + 1);
+    parcBuffer_PutUint8(edited, 0x5A);
+    parcBuffer_PutBuffer(edited, original);
+    parcBuffer_Flip(edited);
+    parcBuffer_Rewind(original);
+
+    PARCContentDefinedChunker *originalChunker = parcContentDefinedChunker_Create(original, 512, 2048, 8192);
+    PARCContentDefinedChunker *editedChunker = parcContentDefinedChunker_Create(edited, 512, 2048, 8192);
+
+    size_t originalCount;
+    PARCBuffer **originalChunks = _collect(parcContentDefinedChunker_ForwardIterator(originalChunker), &originalCount);
+    size_t editedCount;
+    PARCBuffer **editedChunks = _collect(parcContentDefinedChunker_ForwardIterator(editedChunker), &editedCount);
+
+    // A fixed-size chunker would share none; only the chunks around the edit should differ.
+    size_t shared = _countShared(originalChunks, originalCount, editedChunks, editedCount);
+    assertTrue(shared + 2 >= originalCount, "Expected all but the first chunks to be unchanged, %zu of %zu shared", shared, originalCount);
+
+    _releaseAll(originalChunks, originalCount);
+    _releaseAll(editedChunks, editedCount);
+    parcContentDefinedChunker_Release(&originalChunker);
+    parcContentDefinedChunker_Release(&editedChunker);
+    parcBuffer_Release(&original);
+    parcBuffer_Release(&edited);
+}
+
+LONGBOW_TEST_FIXTURE_OPTIONS(Performance, .enabled = false)
+{
+    LONGBOW_RUN_TEST_CASE(Performance, parcContentDefinedChunker_Throughput);
+}
+
+LONGBOW_TEST_FIXTURE_SETUP(Performance)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_FIXTURE_TEARDOWN(Performance)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+static double
+_elapsed(struct timeval *start)
+{
+    struct timeval end;
+    gettimeofday(&end, NULL);
+    timersub(&end, start, &end);
+    return end.tv_sec + end.tv_usec / 1000000.0;
+}
+
+LONGBOW_TEST_CASE(Performance, parcContentDefinedChunker_Throughput)
+{
+    size_t length = 256 * 1024 * 1024;
+    PARCBuffer *data = _createRandomBuffer(length, 10);
+    double megabytes = length / (1024.0 * 1024.0);
+
+    size_t averages[] = { 2048, 8192, 65536 };
+    for (size_t i = 0; i < sizeof(averages) / sizeof(averages[0]); i++) {
+        size_t average = averages[i];
+        PARCContentDefinedChunker *chunker = parcContentDefinedChunker_Create(data, average / 4, average, average * 8);
+
+        struct timeval start;
+        gettimeofday(&start, NULL);
+        size_t count = 0;
+        PARCIterator *iterator = parcContentDefinedChunker_ForwardIterator(chunker);
+        while (parcIterator_HasNext(iterator)) {
+            PARCBuffer *chunk = parcIterator_Next(iterator);
+            parcBuffer_Release(&chunk);
+            count++;
+        }
+        parcIterator_Release(&iterator);
+        double seconds = _elapsed(&start);
+
+        printf("average %6zu: %8.1f MB/s, %zu chunks of %zu bytes on average\n", average, megabytes / seconds, count, length / count);
+        parcContentDefinedChunker_Release(&chunker);
+    }
+
+    parcBuffer_Release(&data);
+}
+
+int
+main(int argc, char *argv[])
+{
+    LongBowRunner *testRunner = LONGBOW_TEST_RUNNER_CREATE(parc_ContentDefinedChunker);
+    int exitStatus = LONGBOW_TEST_MAIN(argc, argv, testRunner);
+    longBowTestRunner_Destroy(&testRunner);
+    exit(exitStatus);
+}
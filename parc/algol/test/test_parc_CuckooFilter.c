@@ -0,0 +1,465 @@
+/*
+ * Copyright (c) 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Patent rights are not granted under this agreement. Patent rights are
+ *       available under FRAND terms.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX or PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * @copyright 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC).  All rights reserved.
+ */
+#include "../parc_CuckooFilter.c"
+
+#include <stdio.h>
+#include <inttypes.h>
+#include <sys/time.h>
+
+#include <LongBow/testing.h>
+#include <LongBow/debugging.h>
+#include <parc/algol/parc_Memory.h>
+#include <parc/algol/parc_SafeMemory.h>
+
+#include <parc/testing/parc_MemoryTesting.h>
+#include <parc/testing/parc_ObjectTesting.h>
+
+static double
+_measureFalsePositiveRate(const PARCCuckooFilter *filter, uint64_t count, uint64_t trials)
+{
+    uint64_t falsePositives = 0;
+    for (uint64_t i = count; i < count + trials; i++) {
+        if (parcCuckooFilter_ContainsData(filter, &i, sizeof(i))) {
+            falsePositives++;
+        }
+    }
+    return (double) falsePositives / (double) trials;
+}
+
+LONGBOW_TEST_RUNNER(parc_CuckooFilter)
+{
+    LONGBOW_RUN_TEST_FIXTURE(CreateAcquireRelease);
+    LONGBOW_RUN_TEST_FIXTURE(Global);
+    LONGBOW_RUN_TEST_FIXTURE(Performance);
+}
+
+LONGBOW_TEST_RUNNER_SETUP(parc_CuckooFilter)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_RUNNER_TEARDOWN(parc_CuckooFilter)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_FIXTURE(CreateAcquireRelease)
+{
+    LONGBOW_RUN_TEST_CASE(CreateAcquireRelease, CreateRelease);
+    LONGBOW_RUN_TEST_CASE(CreateAcquireRelease, Create_Capacity);
+}
+
+LONGBOW_TEST_FIXTURE_SETUP(CreateAcquireRelease)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_FIXTURE_TEARDOWN(CreateAcquireRelease)
+{
+    if (!parcMemoryTesting_ExpectedOutstanding(0, "%s leaked memory.", longBowTestCase_GetFullName(testCase))) {
+        return LONGBOW_STATUS_MEMORYLEAK;
+    }
+
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_CASE(CreateAcquireRelease, CreateRelease)
+{
+    PARCCuckooFilter *instance = parcCuckooFilter_Create(1000);
+    assertNotNull(instance, "Expected non-null result from parcCuckooFilter_Create().");
+
+    parcObjectTesting_AssertAcquireReleaseContract(parcCuckooFilter_Acquire, instance);
+
+    parcCuckooFilter_Release(&instance);
+    assertNull(instance, "Expected null result from parcCuckooFilter_Release().");
+}
+
+LONGBOW_TEST_CASE(CreateAcquireRelease, Create_Capacity)
+{
+    PARCCuckooFilter *instance = parcCuckooFilter_Create(1000);
+
+    size_t capacity = parcCuckooFilter_Capacity(instance);
+    assertTrue(capacity >= 1000 / 0.95, "Expected room for 1000 elements, actual capacity %zu", capacity);
+    assertTrue((capacity & (capacity - 1)) == 0, "Expected a power of two capacity, actual %zu", capacity);
+    assertTrue(parcCuckooFilter_Count(instance) == 0, "Expected an empty filter.");
+
+    parcCuckooFilter_Release(&instance);
+}
+
+LONGBOW_TEST_FIXTURE(Global)
+{
+    LONGBOW_RUN_TEST_CASE(Global, parcCuckooFilter_AddContains);
+    LONGBOW_RUN_TEST_CASE(Global, parcCuckooFilter_AddContainsBuffer);
+    LONGBOW_RUN_TEST_CASE(Global, parcCuckooFilter_Remove);
+    LONGBOW_RUN_TEST_CASE(Global, parcCuckooFilter_Remove_Duplicates);
+    LONGBOW_RUN_TEST_CASE(Global, parcCuckooFilter_FalsePositiveRate);
+    LONGBOW_RUN_TEST_CASE(Global, parcCuckooFilter_Fill);
+    LONGBOW_RUN_TEST_CASE(Global, parcCuckooFilter_Clear);
+    LONGBOW_RUN_TEST_CASE(Global, parcCuckooFilter_Copy);
+    LONGBOW_RUN_TEST_CASE(Global, parcCuckooFilter_Equals);
+    LONGBOW_RUN_TEST_CASE(Global, parcCuckooFilter_IsValid);
+    LONGBOW_RUN_TEST_CASE(Global, parcCuckooFilter_Union);
+    LONGBOW_RUN_TEST_CASE(Global, parcCuckooFilter_Union_Mismatch);
+    LONGBOW_RUN_TEST_CASE(Global, parcCuckooFilter_Union_Full);
+    LONGBOW_RUN_TEST_CASE(Global, parcCuckooFilter_ToBuffer);
+    LONGBOW_RUN_TEST_CASE(Global, parcCuckooFilter_CreateFromBuffer_Invalid);
+}
+
+LONGBOW_TEST_FIXTURE_SETUP(Global)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_FIXTURE_TEARDOWN(Global)
+{
+    if (!parcMemoryTesting_ExpectedOutstanding(0, "%s mismanaged memory.", longBowTestCase_GetFullName(testCase))) {
+        return LONGBOW_STATUS_MEMORYLEAK;
+    }
+
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_CASE(Global, parcCuckooFilter_AddContains)
+{
+    PARCCuckooFilter *filter = parcCuckooFilter_Create(1000);
+
+    for (uint64_t i = 0; i < 1000; i++) {
+        assertTrue(parcCuckooFilter_AddData(filter, &i, sizeof(i)), "Expected element %" PRIu64 " to be added.", i);
+    }
+    for (uint64_t i = 0; i < 1000; i++) {
+        assertTrue(parcCuckooFilter_ContainsData(filter, &i, sizeof(i)), "Expected element %" PRIu64 " to be present.", i);
+    }
+    assertTrue(parcCuckooFilter_Count(filter) == 1000, "Expected 1000 elements, actual %zu", parcCuckooFilter_Count(filter));
+
+    parcCuckooFilter_Release(&filter);
+}
+
+LONGBOW_TEST_CASE(Global, parcCuckooFilter_AddContainsBuffer)
+{
+    PARCCuckooFilter *filter = parcCuckooFilter_Create(100);
+    PARCBuffer *present = parcBuffer_WrapCString("lci:/parc/present");
+    PARCBuffer *absent = parcBuffer_WrapCString("lci:/parc/absent");
+
+    parcCuckooFilter_AddBuffer(filter, present);
+
+    assertTrue(parcBuffer_Position(present) == 0, "Expected the buffer position to be unchanged.");
+    assertTrue(parcCuckooFilter_ContainsBuffer(filter, present), "Expected the added buffer to be present.");
+    assertFalse(parcCuckooFilter_ContainsBuffer(filter, absent), "Expected the other buffer to be absent.");
+
+    assertTrue(parcCuckooFilter_RemoveBuffer(filter, present), "Expected the added buffer to be removed.");
+    assertFalse(parcCuckooFilter_ContainsBuffer(filter, present), "Expected the removed buffer to be absent.");
+
+    parcBuffer_Release(&absent);
+    parcBuffer_Release(&present);
+    parcCuckooFilter_Release(&filter);
+}
+
+LONGBOW_TEST_CASE(Global, parcCuckooFilter_Remove)
+{
+    PARCCuckooFilter *filter = parcCuckooFilter_Create(1000);
+
+    for (uint64_t i = 0; i < 1000; i++) {
+        parcCuckooFilter_AddData(filter, &i, sizeof(i));
+    }
+    for (uint64_t i = 0; i < 1000; i += 2) {
+        assertTrue(parcCuckooFilter_RemoveData(filter, &i, sizeof(i)), "Expected element %" PRIu64 " to be removed.", i);
+    }
+
+    assertTrue(parcCuckooFilter_Count(filter) == 500, "Expected 500 elements, actual %zu", parcCuckooFilter_Count(filter));
+    for (uint64_t i = 1; i < 1000; i += 2) {
+        assertTrue(parcCuckooFilter_ContainsData(filter, &i, sizeof(i)), "Expected element %" PRIu64 " to remain.", i);
+    }
+    assertFalse(parcCuckooFilter_RemoveData(filter, "absent", 6), "Expected removing an absent element to fail.");
+
+    parcCuckooFilter_Release(&filter);
+}
+
+LONGBOW_TEST_CASE(Global, parcCuckooFilter_Remove_Duplicates)
+{
+    PARCCuckooFilter *filter = parcCuckooFilter_Create(100);
+
+    parcCuckooFilter_AddData(filter, "hello", 5);
+    parcCuckooFilter_AddData(filter, "hello", 5);
+
+    parcCuckooFilter_RemoveData(filter, "hello", 5);
+    assertTrue(parcCuckooFilter_ContainsData(filter, "hello", 5), "Expected the second copy to remain.");
+
+    parcCuckooFilter_RemoveData(filter, "hello", 5);
+    assertFalse(parcCuckooFilter_ContainsData(filter, "hello", 5), "Expected both copies to be removed.");
+
+    parcCuckooFilter_Release(&filter);
+}
+
+LONGBOW_TEST_CASE(Global, parcCuckooFilter_FalsePositiveRate)
+{
+    uint64_t count = 20000;
+    PARCCuckooFilter *filter = parcCuckooFilter_Create(count);
+
+    for (uint64_t i = 0; i < count; i++) {
+        parcCuckooFilter_AddData(filter, &i, sizeof(i));
+    }
+
+    // Two buckets of four 16-bit fingerprints give a rate of about 8 / 65536.
+    double measured = _measureFalsePositiveRate(filter, count, 100000);
+    assertTrue(measured < 2 * 8.0 / 65536, "Expected a false positive rate near %f, actual %f", 8.0 / 65536, measured);
+
+    parcCuckooFilter_Release(&filter);
+}
+
+LONGBOW_TEST_CASE(Global, parcCuckooFilter_Fill)
+{
+    PARCCuckooFilter *filter = parcCuckooFilter_Create(1000);
+    size_t capacity = parcCuckooFilter_Capacity(filter);
+
+    uint64_t added = 0;
+    while (parcCuckooFilter_AddData(filter, &added, sizeof(added))) {
+        added++;
+    }
+
+    assertTrue(added >= capacity * 9 / 10, "Expected to fill at least 90%% of %zu slots, filled %" PRIu64, capacity, added);
+    assertTrue(parcCuckooFilter_Count(filter) == added, "Expected %" PRIu64 " elements, actual %zu", added, parcCuckooFilter_Count(filter));
+
+    // Every accepted element must still be found, including the one left over by the failed placement.
+    for (uint64_t i = 0; i < added; i++) {
+        assertTrue(parcCuckooFilter_ContainsData(filter, &i, sizeof(i)), "Expected element %" PRIu64 " to be present.", i);
+    }
+
+    // Removing an element makes room again.
+    uint64_t first = 0;
+    parcCuckooFilter_RemoveData(filter, &first, sizeof(first));
+    assertTrue(parcCuckooFilter_AddData(filter, &first, sizeof(first)), "Expected an addition to succeed after a removal.");
+
+    parcCuckooFilter_Release(&filter);
+}
+
+LONGBOW_TEST_CASE(Global, parcCuckooFilter_Clear)
+{
+    PARCCuckooFilter *filter = parcCuckooFilter_Create(100);
+    parcCuckooFilter_AddData(filter, "hello", 5);
+
+    parcCuckooFilter_Clear(filter);
+
+    assertFalse(parcCuckooFilter_ContainsData(filter, "hello", 5), "Expected the element to be gone.");
+    assertTrue(parcCuckooFilter_Count(filter) == 0, "Expected a count of 0, actual %zu", parcCuckooFilter_Count(filter));
+
+    parcCuckooFilter_Release(&filter);
+}
+
+LONGBOW_TEST_CASE(Global, parcCuckooFilter_Copy)
+{
+    PARCCuckooFilter *filter = parcCuckooFilter_Create(100);
+    parcCuckooFilter_AddData(filter, "hello", 5);
+
+    PARCCuckooFilter *copy = parcCuckooFilter_Copy(filter);
+    assertTrue(parcCuckooFilter_Equals(filter, copy), "Expected the copy to be equal to the original.");
+
+    parcCuckooFilter_RemoveData(copy, "hello", 5);
+    assertTrue(parcCuckooFilter_ContainsData(filter, "hello", 5), "Expected the original to be independent of the copy.");
+
+    parcCuckooFilter_Release(&copy);
+    parcCuckooFilter_Release(&filter);
+}
+
+LONGBOW_TEST_CASE(Global, parcCuckooFilter_Equals)
+{
+    PARCCuckooFilter *x = parcCuckooFilter_Create(100);
+    PARCCuckooFilter *y = parcCuckooFilter_Create(100);
+    PARCCuckooFilter *z = parcCuckooFilter_Create(100);
+    PARCCuckooFilter *u1 = parcCuckooFilter_Create(100);
+    PARCCuckooFilter *u2 = parcCuckooFilter_Create(1000);
+
+    parcCuckooFilter_AddData(x, "hello", 5);
+    parcCuckooFilter_AddData(y, "hello", 5);
+    parcCuckooFilter_AddData(z, "hello", 5);
+    parcCuckooFilter_AddData(u1, "world", 5);
+    parcCuckooFilter_AddData(u2, "hello", 5);
+
+    parcObjectTesting_AssertEqualsFunction(parcCuckooFilter_Equals, x, y, z, u1, u2, NULL);
+
+    parcCuckooFilter_Release(&x);
+    parcCuckooFilter_Release(&y);
+    parcCuckooFilter_Release(&z);
+    parcCuckooFilter_Release(&u1);
+    parcCuckooFilter_Release(&u2);
+}
+
+LONGBOW_TEST_CASE(Global, parcCuckooFilter_IsValid)
+{
+    PARCCuckooFilter *instance = parcCuckooFilter_Create(100);
+    assertTrue(parcCuckooFilter_IsValid(instance), "Expected parcCuckooFilter_Create to result in a valid instance.");
+
+    parcCuckooFilter_Release(&instance);
+    assertFalse(parcCuckooFilter_IsValid(instance), "Expected parcCuckooFilter_Release to result in an invalid instance.");
+}
+
+LONGBOW_TEST_CASE(Global, parcCuckooFilter_Union)
+{
+    PARCCuckooFilter *even = parcCuckooFilter_Create(1000);
+    PARCCuckooFilter *odd = parcCuckooFilter_Create(1000);
+
+    for (uint64_t i = 0; i < 1000; i++) {
+        parcCuckooFilter_AddData((i % 2 == 0) ? even : odd, &i, sizeof(i));
+    }
+
+    assertTrue(parcCuckooFilter_Union(even, odd), "Expected every element to fit in the union.");
+
+    for (uint64_t i = 0; i < 1000; i++) {
+        assertTrue(parcCuckooFilter_ContainsData(even, &i, sizeof(i)), "Expected element %" PRIu64 " to be in the union.", i);
+    }
+    assertTrue(parcCuckooFilter_Count(even) == 1000, "Expected 1000 elements, actual %zu", parcCuckooFilter_Count(even));
+
+    // Elements of the union can be removed like any other.
+    uint64_t odd1 = 1;
+    assertTrue(parcCuckooFilter_RemoveData(even, &odd1, sizeof(odd1)), "Expected an element from the other filter to be removed.");
+
+    parcCuckooFilter_Release(&odd);
+    parcCuckooFilter_Release(&even);
+}
+
+LONGBOW_TEST_CASE_EXPECTS(Global, parcCuckooFilter_Union_Mismatch, .event = &LongBowTrapIllegalValue)
+{
+    PARCCuckooFilter *small = parcCuckooFilter_Create(100);
+    PARCCuckooFilter *large = parcCuckooFilter_Create(100000);
+
+    parcCuckooFilter_Union(small, large);
+}
+
+LONGBOW_TEST_CASE(Global, parcCuckooFilter_Union_Full)
+{
+    PARCCuckooFilter *filter = parcCuckooFilter_Create(1000);
+    PARCCuckooFilter *other = parcCuckooFilter_Create(1000);
+
+    size_t capacity = parcCuckooFilter_Capacity(filter);
+    for (uint64_t i = 0; i < capacity / 2; i++) {
+        parcCuckooFilter_AddData(filter, &i, sizeof(i));
+    }
+    for (uint64_t i = capacity; i < 2 * capacity; i++) {
+        if (!parcCuckooFilter_AddData(other, &i, sizeof(i))) {
+            break;
+        }
+    }
+
+    PARCCuckooFilter *before = parcCuckooFilter_Copy(filter);
+
+    assertFalse(parcCuckooFilter_Union(filter, other), "Expected the union not to fit.");
+    assertTrue(parcCuckooFilter_Equals(filter, before), "Expected a failed union to leave the filter unchanged.");
+
+    parcCuckooFilter_Release(&before);
+    parcCuckooFilter_Release(&other);
+    parcCuckooFilter_Release(&filter);
+}
+
+LONGBOW_TEST_CASE(Global, parcCuckooFilter_ToBuffer)
+{
+    PARCCuckooFilter *filter = parcCuckooFilter_Create(1000);
+    for (uint64_t i = 0; i < 1000; i++) {
+        parcCuckooFilter_AddData(filter, &i, sizeof(i));
+    }
+
+    PARCBuffer *buffer = parcCuckooFilter_ToBuffer(filter);
+    PARCCuckooFilter *actual = parcCuckooFilter_CreateFromBuffer(buffer);
+
+    assertNotNull(actual, "Expected the serialized filter to be read back.");
+    assertTrue(parcCuckooFilter_Equals(filter, actual), "Expected the filter read back to equal the original.");
+    assertTrue(parcBuffer_Remaining(buffer) == 0, "Expected the whole buffer to be consumed.");
+
+    parcCuckooFilter_Release(&actual);
+    parcBuffer_Release(&buffer);
+    parcCuckooFilter_Release(&filter);
+}
+
+LONGBOW_TEST_CASE(Global, parcCuckooFilter_CreateFromBuffer_Invalid)
+{
+    PARCBuffer *buffer = parcBuffer_WrapCString("this is not a serialized cuckoo filter");
+
+    PARCCuckooFilter *actual = parcCuckooFilter_CreateFromBuffer(buffer);
+
+    assertNull(actual, "Expected NULL for a buffer that is not a serialized filter.");
+    assertTrue(parcBuffer_Position(buffer) == 0, "Expected the buffer position to be unchanged.");
+
+    parcBuffer_Release(&buffer);
+}
+
+LONGBOW_TEST_FIXTURE_OPTIONS(Performance, .enabled = false)
+{
+    LONGBOW_RUN_TEST_CASE(Performance, parcCuckooFilter_Throughput);
+}
+
+LONGBOW_TEST_FIXTURE_SETUP(Performance)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_FIXTURE_TEARDOWN(Performance)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_CASE(Performance, parcCuckooFilter_Throughput)
+{
+    uint64_t count = 1000000;
+    PARCCuckooFilter *filter = parcCuckooFilter_Create(count);
+
+    struct timeval start, end, insert, query, removal;
+    gettimeofday(&start, NULL);
+    for (uint64_t i = 0; i < count; i++) {
+        parcCuckooFilter_AddData(filter, &i, sizeof(i));
+    }
+    gettimeofday(&end, NULL);
+    timersub(&end, &start, &insert);
+
+    gettimeofday(&start, NULL);
+    double measured = _measureFalsePositiveRate(filter, count, count);
+    gettimeofday(&end, NULL);
+    timersub(&end, &start, &query);
+
+    gettimeofday(&start, NULL);
+    for (uint64_t i = 0; i < count; i++) {
+        parcCuckooFilter_RemoveData(filter, &i, sizeof(i));
+    }
+    gettimeofday(&end, NULL);
+    timersub(&end, &start, &removal);
+
+    printf("parcCuckooFilter n=%" PRIu64 ": %zu slots, insert %ld.%06ld s, query %ld.%06ld s, remove %ld.%06ld s, measured %f\n",
+           count, parcCuckooFilter_Capacity(filter),
+           (long) insert.tv_sec, (long) insert.tv_usec, (long) query.tv_sec, (long) query.tv_usec,
+           (long) removal.tv_sec, (long) removal.tv_usec, measured);
+
+    parcCuckooFilter_Release(&filter);
+}
+
+int
+main(int argc, char *argv[argc])
+{
+    LongBowRunner *testRunner = LONGBOW_TEST_RUNNER_CREATE(parc_CuckooFilter);
+    int exitStatus = longBowMain(argc, argv, testRunner, NULL);
+    longBowTestRunner_Destroy(&testRunner);
+    exit(exitStatus);
+}
@@ -145,6 +145,8 @@ LONGBOW_TEST_FIXTURE(Global)
     LONGBOW_RUN_TEST_CASE(Global, parcDeque_Display_NULL);
 
     LONGBOW_RUN_TEST_CASE(Global, parcDeque_Iterator);
+    LONGBOW_RUN_TEST_CASE(Global, parcDeque_Cursor);
+    LONGBOW_RUN_TEST_CASE(Global, parcDeque_ForEach);
 }
 
 LONGBOW_TEST_FIXTURE_SETUP(Global)
@@ -482,6 +484,44 @@ LONGBOW_TEST_CASE(Global, parcDeque_Iterator)
     parcDeque_Release(&x);
 }
 
+LONGBOW_TEST_CASE(Global, parcDeque_Cursor)
+{
+    PARCDeque *x = parcDeque_Create();
+    for (size_t i = 0; i < 100; i++) {
+        parcDeque_Append(x, (void *) i);
+    }
+
+    PARCCursor cursor = parcDeque_Cursor(x);
+    size_t expected = 0;
+    while (parcDeque_CursorHasNext(&cursor)) {
+        size_t actual = (size_t) parcDeque_CursorNext(&cursor);
+        assertTrue(expected == actual, "Expected %zd, actual %zd", expected, actual);
+        expected++;
+    }
+    assertTrue(expected == 100, "Expected 100 elements, actual %zd", expected);
+
+    parcDeque_Release(&x);
+}
+
+LONGBOW_TEST_CASE(Global, parcDeque_ForEach)
+{
+    PARCDeque *x = parcDeque_Create();
+    for (size_t i = 0; i < 100; i++) {
+        parcDeque_Append(x, (void *) i);
+    }
+
+    size_t expected = 0;
+    void *element;
+    parcDeque_ForEach(x, element) {
+        size_t actual = (size_t) element;
+        assertTrue(expected == actual, "Expected %zd, actual %zd", expected, actual);
+        expected++;
+    }
+    assertTrue(expected == 100, "Expected 100 elements, actual %zd", expected);
+
+    parcDeque_Release(&x);
+}
+
 LONGBOW_TEST_FIXTURE(Local)
 {
     LONGBOW_RUN_TEST_CASE(Local, _parcDequeNode_Create);
@@ -34,6 +34,8 @@
 
 #include <parc/algol/parc_SafeMemory.h>
 #include <parc/algol/parc_EventBuffer.h>
+#include <parc/algol/parc_BufferComposer.h>
+#include <parc/algol/parc_Object.h>
 
 // Include the file(s) containing the functions to be tested.
 // This permits internal static functions to be visible to this Test Framework.
@@ -65,7 +67,12 @@ LONGBOW_TEST_FIXTURE(Global)
     LONGBOW_RUN_TEST_CASE(Global, parc_EventBuffer_GetLength_Append);
     LONGBOW_RUN_TEST_CASE(Global, parc_EventBuffer_Prepend_Pullup);
     LONGBOW_RUN_TEST_CASE(Global, parc_EventBuffer_ReadIntoBuffer);
+    LONGBOW_RUN_TEST_CASE(Global, parc_EventBuffer_ReadIntoPooledBuffer);
     LONGBOW_RUN_TEST_CASE(Global, parc_EventBuffer_AppendBuffer);
+    LONGBOW_RUN_TEST_CASE(Global, parc_EventBuffer_AppendBufferReference);
+    LONGBOW_RUN_TEST_CASE(Global, parc_EventBuffer_AppendBufferReference_Destroy);
+    LONGBOW_RUN_TEST_CASE(Global, parc_EventBuffer_PeekAsBuffers);
+    LONGBOW_RUN_TEST_CASE(Global, parc_EventBuffer_PeekAsBuffers_Limits);
     LONGBOW_RUN_TEST_CASE(Global, parc_EventBuffer_Read);
     LONGBOW_RUN_TEST_CASE(Global, parc_EventBuffer_WriteToFileDescriptor);
     LONGBOW_RUN_TEST_CASE(Global, parc_EventBuffer_ReadFromFileDescriptor);
@@ -180,6 +187,134 @@ LONGBOW_TEST_CASE(Global, parc_EventBuffer_ReadIntoBuffer)
     parcEventScheduler_Destroy(&parcEventScheduler);
 }
 
+LONGBOW_TEST_CASE(Global, parc_EventBuffer_ReadIntoPooledBuffer)
+{
+    PARCEventBuffer *parcEventBuffer = parcEventBuffer_Create();
+    assertNotNull(parcEventBuffer, "parcEventBuffer_Create returned a null reference");
+    char sourceData[_dataLength];
+    for (int i = 0; i < _dataLength; i++) {
+        sourceData[i] = (char) i;
+    }
+    parcEventBuffer_Append(parcEventBuffer, sourceData, _dataLength);
+
+    PARCBufferPool *pool = parcBufferPool_Create(64, 4096, 16);
+
+    PARCBuffer *buffer = parcEventBuffer_ReadIntoPooledBuffer(parcEventBuffer, pool, 1500);
+    assertNotNull(buffer, "parcEventBuffer_ReadIntoPooledBuffer returned a null reference");
+    assertTrue(parcBuffer_Remaining(buffer) == 1500, "Expected 1500 bytes, actual %zu", parcBuffer_Remaining(buffer));
+    assertTrue(memcmp(parcBuffer_Overlay(buffer, 0), sourceData, 1500) == 0, "Expected the first 1500 bytes of the event buffer");
+    assertTrue(parcEventBuffer_GetLength(parcEventBuffer) == _dataLength - 1500, "Expected the bytes to be removed from the event buffer");
+    parcBuffer_Release(&buffer);
+
+    // Asking for more than is available returns what there is.
+    buffer = parcEventBuffer_ReadIntoPooledBuffer(parcEventBuffer, pool, _dataLength);
+    assertTrue(parcBuffer_Remaining(buffer) == _dataLength - 1500, "Expected the rest of the event buffer, actual %zu", parcBuffer_Remaining(buffer));
+    parcBuffer_Release(&buffer);
+
+    buffer = parcEventBuffer_ReadIntoPooledBuffer(parcEventBuffer, pool, 1500);
+    assertNull(buffer, "Expected NULL from an empty event buffer");
+
+    parcBufferPool_Release(&pool);
+    parcEventBuffer_Destroy(&parcEventBuffer);
+}
+
+LONGBOW_TEST_CASE(Global, parc_EventBuffer_AppendBufferReference)
+{
+    PARCEventBuffer *parcEventBuffer = parcEventBuffer_Create();
+    PARCBuffer *buffer = parcBuffer_Flip(parcBuffer_PutArray(parcBuffer_Allocate(1000), 5, (uint8_t *) "Hello"));
+    parcBuffer_Freeze(buffer);
+
+    int result = parcEventBuffer_AppendBufferReference(parcEventBuffer, buffer);
+    assertTrue(result == 0, "Expected parcEventBuffer_AppendBufferReference to succeed");
+    assertTrue(parcEventBuffer_GetLength(parcEventBuffer) == 5, "Expected the remaining bytes to be appended");
+    assertTrue(parcObject_GetReferenceCount(buffer) == 2, "Expected the event buffer to hold a reference");
+    assertTrue(parcEventBuffer_Pullup(parcEventBuffer, -1) == parcBuffer_Overlay(buffer, 0),
+               "Expected the event buffer to refer to the buffer's bytes rather than a copy");
+
+    parcEventBuffer_Read(parcEventBuffer, NULL, 5);
+    assertTrue(parcObject_GetReferenceCount(buffer) == 1, "Expected the reference to be released once the bytes are drained");
+
+    parcBuffer_Release(&buffer);
+    parcEventBuffer_Destroy(&parcEventBuffer);
+}
+
+LONGBOW_TEST_CASE(Global, parc_EventBuffer_AppendBufferReference_Destroy)
+{
+    PARCEventBuffer *parcEventBuffer = parcEventBuffer_Create();
+    PARCBuffer *buffer = parcBuffer_Flip(parcBuffer_PutArray(parcBuffer_Allocate(5), 5, (uint8_t *) "Hello"));
+
+    parcEventBuffer_AppendBufferReference(parcEventBuffer, buffer);
+    parcBuffer_Release(&buffer);
+
+    // The event buffer holds the last reference, which it releases when it is destroyed.
+    parcEventBuffer_Destroy(&parcEventBuffer);
+}
+
+/*
+ * Build an event buffer of three segments: "Hello ", "World" and "!".
+ */
+static PARCEventBuffer *
+_createSegmentedEventBuffer(void)
+{
+    PARCEventBuffer *parcEventBuffer = parcEventBuffer_Create();
+    parcEventBuffer_Append(parcEventBuffer, "Hello ", 6);
+
+    PARCBuffer *world = parcBuffer_WrapCString("World");
+    parcEventBuffer_AppendBufferReference(parcEventBuffer, world);
+    parcBuffer_Release(&world);
+
+    PARCBuffer *bang = parcBuffer_WrapCString("!");
+    parcEventBuffer_AppendBufferReference(parcEventBuffer, bang);
+    parcBuffer_Release(&bang);
+
+    return parcEventBuffer;
+}
+
+LONGBOW_TEST_CASE(Global, parc_EventBuffer_PeekAsBuffers)
+{
+    PARCEventBuffer *parcEventBuffer = _createSegmentedEventBuffer();
+
+    PARCBuffer *buffers[8];
+    size_t count = parcEventBuffer_PeekAsBuffers(parcEventBuffer, SIZE_MAX, 8, buffers);
+    assertTrue(count == 3, "Expected a buffer for each of the 3 segments, actual %zu", count);
+
+    PARCBufferComposer *composer = parcBufferComposer_Create();
+    for (size_t i = 0; i < count; i++) {
+        parcBufferComposer_PutBuffer(composer, buffers[i]);
+        parcBuffer_Release(&buffers[i]);
+    }
+    char *actual = parcBufferComposer_ToString(composer);
+    assertTrue(strcmp("Hello World!", actual) == 0, "Expected 'Hello World!', actual '%s'", actual);
+    assertTrue(parcEventBuffer_GetLength(parcEventBuffer) == 12, "Expected the event buffer to be unchanged");
+
+    parcMemory_Deallocate(&actual);
+    parcBufferComposer_Release(&composer);
+    parcEventBuffer_Destroy(&parcEventBuffer);
+}
+
+LONGBOW_TEST_CASE(Global, parc_EventBuffer_PeekAsBuffers_Limits)
+{
+    PARCEventBuffer *parcEventBuffer = _createSegmentedEventBuffer();
+    PARCBuffer *buffers[8];
+
+    size_t count = parcEventBuffer_PeekAsBuffers(parcEventBuffer, 8, 8, buffers);
+    assertTrue(count == 2, "Expected 8 bytes to span 2 segments, actual %zu", count);
+    assertTrue(parcBuffer_Remaining(buffers[1]) == 2, "Expected the last buffer to be limited to the length");
+    parcBuffer_Release(&buffers[0]);
+    parcBuffer_Release(&buffers[1]);
+
+    count = parcEventBuffer_PeekAsBuffers(parcEventBuffer, SIZE_MAX, 1, buffers);
+    assertTrue(count == 1, "Expected at most 1 buffer, actual %zu", count);
+    assertTrue(parcBuffer_Remaining(buffers[0]) == 6, "Expected the first segment");
+    parcBuffer_Release(&buffers[0]);
+
+    parcEventBuffer_Read(parcEventBuffer, NULL, 12);
+    count = parcEventBuffer_PeekAsBuffers(parcEventBuffer, SIZE_MAX, 8, buffers);
+    assertTrue(count == 0, "Expected no buffers from an empty event buffer, actual %zu", count);
+
+    parcEventBuffer_Destroy(&parcEventBuffer);
+}
+
 LONGBOW_TEST_CASE(Global, parc_EventBuffer_AppendBuffer)
 {
     PARCEventScheduler *parcEventScheduler = parcEventScheduler_Create();
@@ -0,0 +1,623 @@
+/*
+ * Copyright (c) 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Patent rights are not granted under this agreement. Patent rights are
+ *       available under FRAND terms.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX or PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * @copyright 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC).  All rights reserved.
+ */
+// Include the file(s) containing the functions to be tested.
+// This permits internal static functions to be visible to this Test Framework.
+#include "../parc_EventFrameDecoder.c"
+
+#include <stdio.h>
+#include <sys/time.h>
+
+#include <LongBow/testing.h>
+#include <LongBow/debugging.h>
+#include <parc/algol/parc_Memory.h>
+#include <parc/algol/parc_SafeMemory.h>
+#include <parc/algol/parc_EventScheduler.h>
+
+#include <parc/testing/parc_MemoryTesting.h>
+
+/*
+ * A 1-byte type, a reserved byte and a 2-byte big-endian payload length.
+ */
+static const PARCEventFrameDecoderConfig _testConfig = {
+    .headerLength         = 4,
+    .typeOffset           = 0,
+    .typeLength           = 1,
+    .lengthOffset         = 2,
+    .lengthLength         = 2,
+    .byteOrder            = PARCEventFrameDecoderByteOrder_BigEndian,
+    .lengthIncludesHeader = false,
+    .maximumFrameLength   = 1024
+};
+
+/*
+ * Records the frames and errors a decoder reports.
+ */
+typedef struct {
+    PARCEventQueue *queue;
+    size_t batches;
+    size_t frames;
+    uint32_t types[256];
+    PARCBuffer *payloads[256];
+    bool allInPlace;
+    size_t errors;
+    PARCEventFrameDecoderError error;
+} _Recorder;
+
+static bool
+_recorder_IsInInput(_Recorder *recorder, const void *pointer)
+{
+    struct evbuffer *input = internal_parcEventQueue_GetEvInputBuffer(recorder->queue);
+    struct evbuffer_iovec extents[16];
+    int count = evbuffer_peek(input, -1, NULL, extents, 16);
+    for (int i = 0; i < count && i < 16; i++) {
+        const uint8_t *base = extents[i].iov_base;
+        if ((const uint8_t *) pointer >= base && (const uint8_t *) pointer < base + extents[i].iov_len) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void
+_recorder_OnFrames(PARCEventFrameDecoder *decoder, size_t count, const PARCEventFrame frames[count], void *userData)
+{
+    _Recorder *recorder = userData;
+    recorder->batches++;
+    for (size_t i = 0; i < count; i++) {
+        if (parcBuffer_HasRemaining(frames[i].buffer) && !_recorder_IsInInput(recorder, parcBuffer_Overlay(frames[i].buffer, 0))) {
+            recorder->allInPlace = false;
+        }
+        if (recorder->frames < 256) {
+            recorder->types[recorder->frames] = frames[i].type;
+            recorder->payloads[recorder->frames] = parcBuffer_Copy(frames[i].buffer);
+        }
+        recorder->frames++;
+    }
+}
+
+static void
+_recorder_OnError(PARCEventFrameDecoder *decoder, PARCEventFrameDecoderError error, void *userData)
+{
+    _Recorder *recorder = userData;
+    recorder->errors++;
+    recorder->error = error;
+}
+
+static void
+_recorder_Init(_Recorder *recorder, PARCEventQueue *queue)
+{
+    memset(recorder, 0, sizeof(_Recorder));
+    recorder->queue = queue;
+    recorder->allInPlace = true;
+}
+
+static void
+_recorder_Fini(_Recorder *recorder)
+{
+    for (size_t i = 0; i < recorder->frames && i < 256; i++) {
+        parcBuffer_Release(&recorder->payloads[i]);
+    }
+}
+
+static void
+_recorder_AssertPayload(_Recorder *recorder, size_t index, uint32_t type, const char *payload)
+{
+    assertTrue(recorder->types[index] == type, "Frame %zu: expected type %u, actual %u", index, type, recorder->types[index]);
+    PARCBuffer *buffer = recorder->payloads[index];
+    assertTrue(parcBuffer_Remaining(buffer) == strlen(payload),
+               "Frame %zu: expected a payload of %zu bytes, actual %zu", index, strlen(payload), parcBuffer_Remaining(buffer));
+    if (parcBuffer_HasRemaining(buffer)) {
+        assertTrue(memcmp(parcBuffer_Overlay(buffer, 0), payload, strlen(payload)) == 0, "Frame %zu: wrong payload", index);
+    }
+}
+
+static size_t
+_encodeFrame(uint8_t *frame, uint8_t type, const char *payload)
+{
+    size_t length = strlen(payload);
+    frame[0] = type;
+    frame[1] = 0;
+    frame[2] = (uint8_t) (length >> 8);
+    frame[3] = (uint8_t) length;
+    memcpy(&frame[4], payload, length);
+    return length + 4;
+}
+
+static void
+_appendFrame(struct evbuffer *input, uint8_t type, const char *payload)
+{
+    uint8_t frame[1024];
+    evbuffer_add(input, frame, _encodeFrame(frame, type, payload));
+}
+
+LONGBOW_TEST_RUNNER(parc_EventFrameDecoder)
+{
+    LONGBOW_RUN_TEST_FIXTURE(CreateAcquireRelease);
+    LONGBOW_RUN_TEST_FIXTURE(Global);
+    LONGBOW_RUN_TEST_FIXTURE(Errors);
+    LONGBOW_RUN_TEST_FIXTURE(Performance);
+}
+
+LONGBOW_TEST_RUNNER_SETUP(parc_EventFrameDecoder)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_RUNNER_TEARDOWN(parc_EventFrameDecoder)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_FIXTURE(CreateAcquireRelease)
+{
+    LONGBOW_RUN_TEST_CASE(CreateAcquireRelease, CreateDestroy);
+}
+
+LONGBOW_TEST_FIXTURE_SETUP(CreateAcquireRelease)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_FIXTURE_TEARDOWN(CreateAcquireRelease)
+{
+    if (!parcMemoryTesting_ExpectedOutstanding(0, "%s leaked memory.", longBowTestCase_GetFullName(testCase))) {
+        return LONGBOW_STATUS_MEMORYLEAK;
+    }
+
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_CASE(CreateAcquireRelease, CreateDestroy)
+{
+    PARCEventFrameDecoder *decoder = parcEventFrameDecoder_Create(&_testConfig, _recorder_OnFrames, NULL, NULL);
+    assertNotNull(decoder, "Expected non-null result from parcEventFrameDecoder_Create");
+    parcEventFrameDecoder_AssertValid(decoder);
+    assertTrue(parcEventFrameDecoder_GetError(decoder) == PARCEventFrameDecoderError_None, "Expected no error");
+    assertTrue(parcEventFrameDecoder_GetFrameCount(decoder) == 0, "Expected no frames");
+
+    parcEventFrameDecoder_Destroy(&decoder);
+    assertNull(decoder, "Expected parcEventFrameDecoder_Destroy to set the pointer to NULL");
+}
+
+LONGBOW_TEST_FIXTURE(Global)
+{
+    LONGBOW_RUN_TEST_CASE(Global, parcEventFrameDecoder_Decode);
+    LONGBOW_RUN_TEST_CASE(Global, parcEventFrameDecoder_Decode_Partial);
+    LONGBOW_RUN_TEST_CASE(Global, parcEventFrameDecoder_Decode_Spanning);
+    LONGBOW_RUN_TEST_CASE(Global, parcEventFrameDecoder_Decode_Batches);
+    LONGBOW_RUN_TEST_CASE(Global, parcEventFrameDecoder_Decode_LittleEndianWholeFrame);
+    LONGBOW_RUN_TEST_CASE(Global, parcEventFrameDecoder_Decode_FrameTooLong);
+    LONGBOW_RUN_TEST_CASE(Global, parcEventFrameDecoder_Decode_FrameTooShort);
+    LONGBOW_RUN_TEST_CASE(Global, parcEventFrameDecoder_Attach);
+}
+
+typedef struct {
+    PARCEventScheduler *scheduler;
+    PARCEventQueue *queue;
+    struct evbuffer *input;
+} _Fixture;
+
+LONGBOW_TEST_FIXTURE_SETUP(Global)
+{
+    _Fixture *fixture = parcMemory_AllocateAndClear(sizeof(_Fixture));
+    fixture->scheduler = parcEventScheduler_Create();
+    fixture->queue = parcEventQueue_Create(fixture->scheduler, -1, 0);
+    fixture->input = internal_parcEventQueue_GetEvInputBuffer(fixture->queue);
+    // The queue only appends to its input while reading its socket; let the tests append to it instead.
+    evbuffer_unfreeze(fixture->input, 0);
+    longBowTestCase_SetClipBoardData(testCase, fixture);
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_FIXTURE_TEARDOWN(Global)
+{
+    _Fixture *fixture = longBowTestCase_GetClipBoardData(testCase);
+    parcEventQueue_Destroy(&fixture->queue);
+    parcEventScheduler_Destroy(&fixture->scheduler);
+    parcMemory_Deallocate((void **) &fixture);
+
+    if (!parcMemoryTesting_ExpectedOutstanding(0, "%s leaked memory.", longBowTestCase_GetFullName(testCase))) {
+        return LONGBOW_STATUS_MEMORYLEAK;
+    }
+
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_CASE(Global, parcEventFrameDecoder_Decode)
+{
+    _Fixture *fixture = longBowTestCase_GetClipBoardData(testCase);
+    _Recorder recorder;
+    _recorder_Init(&recorder, fixture->queue);
+    PARCEventFrameDecoder *decoder = parcEventFrameDecoder_Create(&_testConfig, _recorder_OnFrames, _recorder_OnError, &recorder);
+
+    _appendFrame(fixture->input, 1, "Hello");
+    _appendFrame(fixture->input, 2, "");
+    _appendFrame(fixture->input, 3, "World");
+
+    size_t count = parcEventFrameDecoder_Decode(decoder, fixture->queue);
+    assertTrue(count == 3, "Expected 3 frames, actual %zu", count);
+    assertTrue(recorder.batches == 1, "Expected the frames in one batch, actual %zu batches", recorder.batches);
+    assertTrue(recorder.allInPlace, "Expected contiguous frames to be wrapped in place");
+    _recorder_AssertPayload(&recorder, 0, 1, "Hello");
+    _recorder_AssertPayload(&recorder, 1, 2, "");
+    _recorder_AssertPayload(&recorder, 2, 3, "World");
+
+    assertTrue(evbuffer_get_length(fixture->input) == 0, "Expected the frames to be removed from the input");
+    assertTrue(parcEventFrameDecoder_GetFrameCount(decoder) == 3, "Expected a frame count of 3");
+
+    parcEventFrameDecoder_Destroy(&decoder);
+    _recorder_Fini(&recorder);
+}
+
+LONGBOW_TEST_CASE(Global, parcEventFrameDecoder_Decode_Partial)
+{
+    _Fixture *fixture = longBowTestCase_GetClipBoardData(testCase);
+    _Recorder recorder;
+    _recorder_Init(&recorder, fixture->queue);
+    PARCEventFrameDecoder *decoder = parcEventFrameDecoder_Create(&_testConfig, _recorder_OnFrames, _recorder_OnError, &recorder);
+
+    uint8_t frame[64];
+    size_t length = _encodeFrame(frame, 7, "Hello World");
+
+    evbuffer_add(fixture->input, frame, 2);
+    size_t count = parcEventFrameDecoder_Decode(decoder, fixture->queue);
+    assertTrue(count == 0, "Expected no frames from part of a header, actual %zu", count);
+
+    evbuffer_add(fixture->input, &frame[2], 6);
+    count = parcEventFrameDecoder_Decode(decoder, fixture->queue);
+    assertTrue(count == 0, "Expected no frames from part of a payload, actual %zu", count);
+    assertTrue(evbuffer_get_length(fixture->input) == 8, "Expected an incomplete frame to be left in the input");
+
+    evbuffer_add(fixture->input, &frame[8], length - 8);
+    count = parcEventFrameDecoder_Decode(decoder, fixture->queue);
+    assertTrue(count == 1, "Expected the completed frame, actual %zu", count);
+    _recorder_AssertPayload(&recorder, 0, 7, "Hello World");
+
+    parcEventFrameDecoder_Destroy(&decoder);
+    _recorder_Fini(&recorder);
+}
+
+LONGBOW_TEST_CASE(Global, parcEventFrameDecoder_Decode_Spanning)
+{
+    _Fixture *fixture = longBowTestCase_GetClipBoardData(testCase);
+    _Recorder recorder;
+    _recorder_Init(&recorder, fixture->queue);
+    PARCEventFrameDecoder *decoder = parcEventFrameDecoder_Create(&_testConfig, _recorder_OnFrames, _recorder_OnError, &recorder);
+
+    // Two segments: the first frame and the start of the second, then the rest of the second.
+    static uint8_t frames[64];
+    size_t first = _encodeFrame(frames, 1, "Hello");
+    size_t second = _encodeFrame(&frames[first], 2, "World");
+    evbuffer_add_reference(fixture->input, frames, first + 3, NULL, NULL);
+    evbuffer_add_reference(fixture->input, &frames[first + 3], second - 3, NULL, NULL);
+
+    size_t count = parcEventFrameDecoder_Decode(decoder, fixture->queue);
+    assertTrue(count == 2, "Expected 2 frames, actual %zu", count);
+    assertFalse(recorder.allInPlace, "Expected the frame spanning segments to be copied");
+    _recorder_AssertPayload(&recorder, 0, 1, "Hello");
+    _recorder_AssertPayload(&recorder, 1, 2, "World");
+
+    parcEventFrameDecoder_Destroy(&decoder);
+    _recorder_Fini(&recorder);
+}
+
+LONGBOW_TEST_CASE(Global, parcEventFrameDecoder_Decode_Batches)
+{
+    _Fixture *fixture = longBowTestCase_GetClipBoardData(testCase);
+    _Recorder recorder;
+    _recorder_Init(&recorder, fixture->queue);
+    PARCEventFrameDecoder *decoder = parcEventFrameDecoder_Create(&_testConfig, _recorder_OnFrames, _recorder_OnError, &recorder);
+
+    size_t frames = 3 * PARCEventFrameDecoder_BatchSize + 8;
+    for (size_t i = 0; i < frames; i++) {
+        _appendFrame(fixture->input, (uint8_t) i, "payload");
+    }
+
+    size_t count = parcEventFrameDecoder_Decode(decoder, fixture->queue);
+    assertTrue(count == frames, "Expected %zu frames, actual %zu", frames, count);
+    assertTrue(recorder.batches == 4, "Expected 4 batches, actual %zu", recorder.batches);
+    for (size_t i = 0; i < frames; i++) {
+        _recorder_AssertPayload(&recorder, i, (uint8_t) i, "payload");
+    }
+
+    parcEventFrameDecoder_Destroy(&decoder);
+    _recorder_Fini(&recorder);
+}
+
+LONGBOW_TEST_CASE(Global, parcEventFrameDecoder_Decode_LittleEndianWholeFrame)
+{
+    _Fixture *fixture = longBowTestCase_GetClipBoardData(testCase);
+    _Recorder recorder;
+    _recorder_Init(&recorder, fixture->queue);
+
+    // A 4-byte little-endian frame length, header included, and no type.
+    PARCEventFrameDecoderConfig config = {
+        .headerLength         = 4,
+        .lengthOffset         = 0,
+        .lengthLength         = 4,
+        .byteOrder            = PARCEventFrameDecoderByteOrder_LittleEndian,
+        .lengthIncludesHeader = true,
+        .maximumFrameLength   = 64
+    };
+    PARCEventFrameDecoder *decoder = parcEventFrameDecoder_Create(&config, _recorder_OnFrames, _recorder_OnError, &recorder);
+
+    uint8_t frame[] = { 9, 0, 0, 0, 'H', 'e', 'l', 'l', 'o' };
+    evbuffer_add(fixture->input, frame, sizeof(frame));
+
+    size_t count = parcEventFrameDecoder_Decode(decoder, fixture->queue);
+    assertTrue(count == 1, "Expected 1 frame, actual %zu", count);
+    _recorder_AssertPayload(&recorder, 0, 0, "Hello");
+
+    parcEventFrameDecoder_Destroy(&decoder);
+    _recorder_Fini(&recorder);
+}
+
+LONGBOW_TEST_CASE(Global, parcEventFrameDecoder_Decode_FrameTooLong)
+{
+    _Fixture *fixture = longBowTestCase_GetClipBoardData(testCase);
+    _Recorder recorder;
+    _recorder_Init(&recorder, fixture->queue);
+    PARCEventFrameDecoder *decoder = parcEventFrameDecoder_Create(&_testConfig, _recorder_OnFrames, _recorder_OnError, &recorder);
+
+    _appendFrame(fixture->input, 1, "Hello");
+    uint8_t header[] = { 2, 0, 0x04, 0x00 };   // A 1024-byte payload is too long for a 1024-byte frame.
+    evbuffer_add(fixture->input, header, sizeof(header));
+    _appendFrame(fixture->input, 3, "World");
+
+    size_t count = parcEventFrameDecoder_Decode(decoder, fixture->queue);
+    assertTrue(count == 1, "Expected the frame before the bad header, actual %zu", count);
+    _recorder_AssertPayload(&recorder, 0, 1, "Hello");
+    assertTrue(recorder.errors == 1, "Expected the error callback to be called once, actual %zu", recorder.errors);
+    assertTrue(recorder.error == PARCEventFrameDecoderError_FrameTooLong, "Expected PARCEventFrameDecoderError_FrameTooLong");
+    assertTrue(parcEventFrameDecoder_GetError(decoder) == PARCEventFrameDecoderError_FrameTooLong,
+               "Expected the decoder to have failed");
+    assertTrue(evbuffer_get_length(fixture->input) == 0, "Expected the input to be discarded");
+
+    // Later input is discarded without being decoded.
+    _appendFrame(fixture->input, 4, "Again");
+    count = parcEventFrameDecoder_Decode(decoder, fixture->queue);
+    assertTrue(count == 0, "Expected no frames from a failed decoder, actual %zu", count);
+    assertTrue(recorder.errors == 1, "Expected the error callback to be called only once, actual %zu", recorder.errors);
+    assertTrue(evbuffer_get_length(fixture->input) == 0, "Expected the input to be discarded");
+
+    parcEventFrameDecoder_Destroy(&decoder);
+    _recorder_Fini(&recorder);
+}
+
+LONGBOW_TEST_CASE(Global, parcEventFrameDecoder_Decode_FrameTooShort)
+{
+    _Fixture *fixture = longBowTestCase_GetClipBoardData(testCase);
+    _Recorder recorder;
+    _recorder_Init(&recorder, fixture->queue);
+
+    PARCEventFrameDecoderConfig config = _testConfig;
+    config.lengthIncludesHeader = true;
+    PARCEventFrameDecoder *decoder = parcEventFrameDecoder_Create(&config, _recorder_OnFrames, _recorder_OnError, &recorder);
+
+    uint8_t header[] = { 1, 0, 0, 3 };
+    evbuffer_add(fixture->input, header, sizeof(header));
+
+    size_t count = parcEventFrameDecoder_Decode(decoder, fixture->queue);
+    assertTrue(count == 0, "Expected no frames, actual %zu", count);
+    assertTrue(recorder.error == PARCEventFrameDecoderError_FrameTooShort, "Expected PARCEventFrameDecoderError_FrameTooShort");
+
+    parcEventFrameDecoder_Destroy(&decoder);
+    _recorder_Fini(&recorder);
+}
+
+LONGBOW_TEST_CASE(Global, parcEventFrameDecoder_Attach)
+{
+    _Fixture *fixture = longBowTestCase_GetClipBoardData(testCase);
+    PARCEventQueuePair *pair = parcEventQueue_CreateConnectedPair(fixture->scheduler);
+    PARCEventQueue *up = parcEventQueue_GetConnectedUpQueue(pair);
+    PARCEventQueue *down = parcEventQueue_GetConnectedDownQueue(pair);
+
+    _Recorder recorder;
+    _recorder_Init(&recorder, down);
+    PARCEventFrameDecoder *decoder = parcEventFrameDecoder_Create(&_testConfig, _recorder_OnFrames, _recorder_OnError, &recorder);
+    parcEventFrameDecoder_Attach(decoder, down, NULL);
+
+    uint8_t frames[64];
+    size_t length = _encodeFrame(frames, 1, "Hello");
+    length += _encodeFrame(&frames[length], 2, "World");
+    parcEventQueue_Write(up, frames, length);
+
+    parcEventScheduler_Start(fixture->scheduler, PARCEventSchedulerDispatchType_NonBlocking);
+
+    assertTrue(recorder.frames == 2, "Expected 2 frames, actual %zu", recorder.frames);
+    _recorder_AssertPayload(&recorder, 0, 1, "Hello");
+    _recorder_AssertPayload(&recorder, 1, 2, "World");
+
+    parcEventQueue_DestroyConnectedPair(&pair);
+    parcEventFrameDecoder_Destroy(&decoder);
+    _recorder_Fini(&recorder);
+}
+
+LONGBOW_TEST_FIXTURE(Errors)
+{
+    LONGBOW_RUN_TEST_CASE(Errors, parcEventFrameDecoder_Create_BadLengthField);
+    LONGBOW_RUN_TEST_CASE(Errors, parcEventFrameDecoder_Create_FieldOutsideHeader);
+    LONGBOW_RUN_TEST_CASE(Errors, parcEventFrameDecoder_Create_MaximumTooSmall);
+}
+
+LONGBOW_TEST_FIXTURE_SETUP(Errors)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_FIXTURE_TEARDOWN(Errors)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_CASE_EXPECTS(Errors, parcEventFrameDecoder_Create_BadLengthField, .event = &LongBowTrapIllegalValue)
+{
+    PARCEventFrameDecoderConfig config = _testConfig;
+    config.lengthLength = 3;
+    PARCEventFrameDecoder *decoder = parcEventFrameDecoder_Create(&config, _recorder_OnFrames, NULL, NULL);
+    parcEventFrameDecoder_Destroy(&decoder);
+}
+
+LONGBOW_TEST_CASE_EXPECTS(Errors, parcEventFrameDecoder_Create_FieldOutsideHeader, .event = &LongBowTrapIllegalValue)
+{
+    PARCEventFrameDecoderConfig config = _testConfig;
+    config.lengthOffset = 3;
+    PARCEventFrameDecoder *decoder = parcEventFrameDecoder_Create(&config, _recorder_OnFrames, NULL, NULL);
+    parcEventFrameDecoder_Destroy(&decoder);
+}
+
+LONGBOW_TEST_CASE_EXPECTS(Errors, parcEventFrameDecoder_Create_MaximumTooSmall, .event = &LongBowTrapIllegalValue)
+{
+    PARCEventFrameDecoderConfig config = _testConfig;
+    config.maximumFrameLength = 2;
+    PARCEventFrameDecoder *decoder = parcEventFrameDecoder_Create(&config, _recorder_OnFrames, NULL, NULL);
+    parcEventFrameDecoder_Destroy(&decoder);
+}
+
+LONGBOW_TEST_FIXTURE_OPTIONS(Performance, .enabled = false)
+{
+    LONGBOW_RUN_TEST_CASE(Performance, FramesPerSecond);
+}
+
+LONGBOW_TEST_FIXTURE_SETUP(Performance)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_FIXTURE_TEARDOWN(Performance)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+static double
+_seconds(const struct timeval *start, const struct timeval *end)
+{
+    struct timeval elapsed;
+    timersub(end, start, &elapsed);
+    return elapsed.tv_sec + elapsed.tv_usec / 1000000.0;
+}
+
+static size_t _performanceBytes;
+
+static void
+_performance_OnFrames(PARCEventFrameDecoder *decoder, size_t count, const PARCEventFrame frames[count], void *userData)
+{
+    for (size_t i = 0; i < count; i++) {
+        _performanceBytes += parcBuffer_Remaining(frames[i].buffer);
+    }
+}
+
+/*
+ * The framing loop a protocol handler writes by hand: pull up each header,
+ * then read each whole frame into a buffer of its own and handle it alone.
+ */
+static size_t
+_performance_DecodeByHand(struct evbuffer *input)
+{
+    size_t result = 0;
+    while (evbuffer_get_length(input) >= 4) {
+        uint8_t *header = evbuffer_pullup(input, 4);
+        size_t frameLength = 4 + (((size_t) header[2] << 8) | header[3]);
+        if (evbuffer_get_length(input) < frameLength) {
+            break;
+        }
+        PARCBuffer *frame = parcBuffer_Allocate(frameLength);
+        evbuffer_remove(input, parcBuffer_Overlay(frame, 0), frameLength);
+        parcBuffer_SetPosition(frame, 4);
+        PARCEventFrame event = { .type = header[0], .buffer = frame };
+        _performance_OnFrames(NULL, 1, &event, NULL);
+        parcBuffer_Release(&frame);
+        result++;
+    }
+    return result;
+}
+
+LONGBOW_TEST_CASE(Performance, FramesPerSecond)
+{
+    PARCEventScheduler *scheduler = parcEventScheduler_Create();
+    PARCEventQueue *queue = parcEventQueue_Create(scheduler, -1, 0);
+    struct evbuffer *input = internal_parcEventQueue_GetEvInputBuffer(queue);
+    evbuffer_unfreeze(input, 0);
+
+    // 64-byte payloads, arriving in 16 KiB reads that split frames across them.
+    char payload[65];
+    memset(payload, 'x', 64);
+    payload[64] = 0;
+    size_t frameLength = 68;
+    size_t streamFrames = 4096;
+    uint8_t *stream = parcMemory_Allocate(streamFrames * frameLength);
+    for (size_t i = 0; i < streamFrames; i++) {
+        _encodeFrame(&stream[i * frameLength], (uint8_t) i, payload);
+    }
+    size_t readLength = 16 * 1024;
+    size_t rounds = 250;
+
+    PARCEventFrameDecoder *decoder = parcEventFrameDecoder_Create(&_testConfig, _performance_OnFrames, NULL, NULL);
+
+    for (int mode = 0; mode < 2; mode++) {
+        size_t frames = 0;
+        _performanceBytes = 0;
+
+        struct timeval start, end;
+        gettimeofday(&start, NULL);
+        for (size_t round = 0; round < rounds; round++) {
+            for (size_t offset = 0; offset < streamFrames * frameLength; offset += readLength) {
+                size_t length = streamFrames * frameLength - offset;
+                evbuffer_add(input, &stream[offset], (length < readLength) ? length : readLength);
+                if (mode == 0) {
+                    frames += _performance_DecodeByHand(input);
+                } else {
+                    frames += parcEventFrameDecoder_Decode(decoder, queue);
+                }
+            }
+        }
+        gettimeofday(&end, NULL);
+
+        double seconds = _seconds(&start, &end);
+        assertTrue(frames == rounds * streamFrames, "Expected %zu frames, actual %zu", rounds * streamFrames, frames);
+        assertTrue(_performanceBytes == frames * 64, "Expected %zu payload bytes, actual %zu", frames * 64, _performanceBytes);
+        printf("%-14s %zu frames in %.3fs, %.2fM frames/s\n",
+               (mode == 0) ? "by hand" : "frame decoder", frames, seconds, frames / seconds / 1000000.0);
+    }
+
+    parcEventFrameDecoder_Destroy(&decoder);
+    parcMemory_Deallocate((void **) &stream);
+    parcEventQueue_Destroy(&queue);
+    parcEventScheduler_Destroy(&scheduler);
+}
+
+int
+main(int argc, char *argv[argc])
+{
+    LongBowRunner *testRunner = LONGBOW_TEST_RUNNER_CREATE(parc_EventFrameDecoder);
+    int exitStatus = LONGBOW_TEST_MAIN(argc, argv, testRunner);
+    longBowTestRunner_Destroy(&testRunner);
+    exit(exitStatus);
+}
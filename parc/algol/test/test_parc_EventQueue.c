@@ -27,6 +27,7 @@
 #include <config.h>
 #include <stdio.h>
 #include <pthread.h>
+#include <fcntl.h>
 
 #include <arpa/inet.h>
 
@@ -34,6 +35,7 @@
 
 #include <parc/algol/parc_SafeMemory.h>
 #include <parc/algol/parc_EventQueue.h>
+#include <parc/algol/parc_File.h>
 
 // Include the file(s) containing the functions to be tested.
 // This permits internal static functions to be visible to this Test Framework.
@@ -71,6 +73,9 @@ LONGBOW_TEST_FIXTURE(Global)
     LONGBOW_RUN_TEST_CASE(Global, parc_EventQueue_Finished);
     LONGBOW_RUN_TEST_CASE(Global, parc_EventQueue_SetWatermark);
     LONGBOW_RUN_TEST_CASE(Global, parc_EventQueue_ReadWrite);
+    LONGBOW_RUN_TEST_CASE(Global, parc_EventQueue_WriteBufferChain);
+    LONGBOW_RUN_TEST_CASE(Global, parc_EventQueue_WriteBufferChain_Failure);
+    LONGBOW_RUN_TEST_CASE(Global, parc_EventQueue_WriteFile);
     LONGBOW_RUN_TEST_CASE(Global, parc_EventQueue_SetPriority);
     LONGBOW_RUN_TEST_CASE(Global, parc_EventQueue_Printf);
     LONGBOW_RUN_TEST_CASE(Global, parc_EventQueue_GetEvBuffer);
@@ -289,6 +294,139 @@ LONGBOW_TEST_CASE(Global, parc_EventQueue_ReadWrite)
     parcEventScheduler_Destroy(&parcEventScheduler);
 }
 
+LONGBOW_TEST_CASE(Global, parc_EventQueue_WriteBufferChain)
+{
+    PARCEventScheduler *parcEventScheduler = parcEventScheduler_Create();
+    PARCEventQueue *parcEventQueue = parcEventQueue_Create(parcEventScheduler, 0, 0);
+
+    PARCBuffer *header = parcBuffer_WrapCString("Hello ");
+    PARCBuffer *payload = parcBuffer_WrapCString("World\n");
+    PARCBufferChain *chain = parcBufferChain_Create();
+    parcBufferChain_Append(chain, header);
+    parcBufferChain_Append(chain, payload);
+
+    int result = parcEventQueue_WriteBufferChain(parcEventQueue, chain);
+    assertTrue(result == 0, "parcEventQueue_WriteBufferChain failed.");
+
+    // The queue holds its own references to the segments.
+    parcBufferChain_Release(&chain);
+
+    struct evbuffer *output = internal_parcEventQueue_GetEvOutputBuffer(parcEventQueue);
+    assertTrue(evbuffer_get_length(output) == 12, "Expected 12 bytes queued, actual %zu", evbuffer_get_length(output));
+
+    // The output buffer's start is frozen by the bufferevent, so inspect it in place.
+    struct evbuffer_iovec vec[4];
+    int count = evbuffer_peek(output, -1, NULL, vec, 4);
+    assertTrue(count == 2, "Expected the segments to be queued without coalescing, actual %d chunks", count);
+    char actual[64] = { 0 };
+    memcpy(actual, vec[0].iov_base, vec[0].iov_len);
+    memcpy(actual + vec[0].iov_len, vec[1].iov_base, vec[1].iov_len);
+    assertTrue(strncmp(actual, "Hello World\n", 12) == 0, "Expected 'Hello World\\n', actual '%s'", actual);
+    assertTrue(parcObject_GetReferenceCount(parcBuffer_Array(header)) == 2, "Expected the queue to reference the header's storage.");
+
+    parcEventQueue_Destroy(&parcEventQueue);
+    parcEventScheduler_Destroy(&parcEventScheduler);
+
+    assertTrue(parcObject_GetReferenceCount(parcBuffer_Array(header)) == 1, "Expected the queue to release its references when done.");
+    parcBuffer_Release(&header);
+    parcBuffer_Release(&payload);
+}
+
+LONGBOW_TEST_CASE(Global, parc_EventQueue_WriteBufferChain_Failure)
+{
+    PARCEventScheduler *parcEventScheduler = parcEventScheduler_Create();
+    PARCEventQueue *parcEventQueue = parcEventQueue_Create(parcEventScheduler, 0, 0);
+
+    PARCBuffer *header = parcBuffer_WrapCString("Hello ");
+    PARCBuffer *payload = parcBuffer_WrapCString("World\n");
+    PARCBufferChain *chain = parcBufferChain_Create();
+    parcBufferChain_Append(chain, header);
+    parcBufferChain_Append(chain, payload);
+
+    parcEventQueue_Write(parcEventQueue, "pre", 3);
+
+    // Refuse additions to the output, so that the chain cannot be queued.
+    struct evbuffer *output = internal_parcEventQueue_GetEvOutputBuffer(parcEventQueue);
+    evbuffer_freeze(output, 0);
+
+    int result = parcEventQueue_WriteBufferChain(parcEventQueue, chain);
+    assertTrue(result == -1, "Expected parcEventQueue_WriteBufferChain to fail.");
+    parcBufferChain_Release(&chain);
+
+    assertTrue(evbuffer_get_length(output) == 3, "Expected no part of the chain to be queued, actual %zu bytes", evbuffer_get_length(output));
+    assertTrue(parcObject_GetReferenceCount(parcBuffer_Array(header)) == 1, "Expected the queue to hold no references to the segments.");
+    assertTrue(parcObject_GetReferenceCount(parcBuffer_Array(payload)) == 1, "Expected the queue to hold no references to the segments.");
+
+    evbuffer_unfreeze(output, 0);
+
+    parcEventQueue_Destroy(&parcEventQueue);
+    parcEventScheduler_Destroy(&parcEventScheduler);
+    parcBuffer_Release(&header);
+    parcBuffer_Release(&payload);
+}
+
+LONGBOW_TEST_CASE(Global, parc_EventQueue_WriteFile)
+{
+    char *fname = "tmpfile_eventqueue";
+    size_t fileSize = 1024 * 1024;
+
+    PARCFile *file = parcFile_Create(fname);
+    parcFile_CreateNewFile(file);
+    FILE *fp = fopen(fname, "w");
+    for (size_t i = 0; i < fileSize; i++) {
+        fputc((int) (i % 251), fp);
+    }
+    fclose(fp);
+    PARCRandomAccessFile *handle = parcRandomAccessFile_Open(file);
+    parcFile_Release(&file);
+
+    int fds[2];
+    int result = socketpair(AF_LOCAL, SOCK_STREAM, 0, fds);
+    assertFalse(result, "Socketpair creation failed.\n");
+    fcntl(fds[0], F_SETFL, O_NONBLOCK);
+    fcntl(fds[1], F_SETFL, O_NONBLOCK);
+
+    // A small send buffer forces the transfer to be resumed many times.
+    int sendBufferSize = 16 * 1024;
+    setsockopt(fds[0], SOL_SOCKET, SO_SNDBUF, &sendBufferSize, sizeof(sendBufferSize));
+
+    PARCEventScheduler *parcEventScheduler = parcEventScheduler_Create();
+    PARCEventQueue *parcEventQueue = parcEventQueue_Create(parcEventScheduler, fds[0], PARCEventQueueOption_CloseOnFree);
+
+    result = parcEventQueue_WriteFile(parcEventQueue, handle, fileSize, 1);
+    assertTrue(result == -1, "Expected a range past the end of the file to be refused.");
+
+    size_t offset = 4096;
+    size_t length = fileSize - offset - 1;
+    result = parcEventQueue_WriteFile(parcEventQueue, handle, offset, length);
+    assertTrue(result == 0, "parcEventQueue_WriteFile failed.");
+    assertTrue(parcObject_GetReferenceCount(handle) == 2, "Expected the queue to reference the file.");
+    parcEventQueue_Enable(parcEventQueue, PARCEventType_Write);
+
+    uint8_t buffer[64 * 1024];
+    size_t received = 0;
+    for (int passes = 0; received < length && passes < 100000; passes++) {
+        parcEventScheduler_Start(parcEventScheduler, PARCEventSchedulerDispatchType_NonBlocking);
+        ssize_t nread;
+        while ((nread = read(fds[1], buffer, sizeof(buffer))) > 0) {
+            for (ssize_t i = 0; i < nread; i++) {
+                assertTrue(buffer[i] == (offset + received + i) % 251, "Wrong byte at offset %zu", offset + received + i);
+            }
+            received += nread;
+        }
+    }
+    assertTrue(received == length, "Expected %zu bytes, actual %zu", length, received);
+    assertTrue(parcObject_GetReferenceCount(handle) == 1, "Expected the queue to release the file when done.");
+
+    parcEventQueue_Destroy(&parcEventQueue);
+    parcEventScheduler_Destroy(&parcEventScheduler);
+    close(fds[1]);
+
+    parcRandomAccessFile_Close(handle);
+    parcRandomAccessFile_Release(&handle);
+    unlink(fname);
+}
+
 static int _test_writeMaxPriority_event_called = 0;
 static void
 _test_writeMaxPriority_callback(PARCEventQueue *parcEventQueue, PARCEventType event, void *data)
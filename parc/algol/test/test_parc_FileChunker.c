@@ -33,12 +33,16 @@
 // This permits internal static functions to be visible to this Test Framework.
 #include "../parc_FileChunker.c"
 
+#include <sys/time.h>
+
 #include <LongBow/unit-test.h>
 #include <parc/algol/parc_SafeMemory.h>
 
 LONGBOW_TEST_RUNNER(parc_FileChunker)
 {
     LONGBOW_RUN_TEST_FIXTURE(Global);
+    LONGBOW_RUN_TEST_FIXTURE(Errors);
+    LONGBOW_RUN_TEST_FIXTURE(Performance);
 }
 
 // The Test Runner calls this function once before any Test Fixtures are run.
@@ -63,6 +67,10 @@ LONGBOW_TEST_FIXTURE(Global)
     LONGBOW_RUN_TEST_CASE(Global, parc_Chunker_ReverseIterator_File);
     LONGBOW_RUN_TEST_CASE(Global, parc_Chunker_ReverseIterator_FilePartial);
     LONGBOW_RUN_TEST_CASE(Global, parc_Chunker_ReverseIterator_FileSmall);
+    LONGBOW_RUN_TEST_CASE(Global, parc_Chunker_ForwardIterator_Mapped);
+    LONGBOW_RUN_TEST_CASE(Global, parc_Chunker_ReverseIterator_Mapped);
+    LONGBOW_RUN_TEST_CASE(Global, parc_Chunker_ForwardIterator_Windowed);
+    LONGBOW_RUN_TEST_CASE(Global, parc_Chunker_ReverseIterator_Windowed);
 }
 
 LONGBOW_TEST_FIXTURE_SETUP(Global)
@@ -404,6 +412,268 @@ LONGBOW_TEST_CASE(Global, parc_Chunker_ReverseIterator_FileSmall)
     parcBuffer_Release(&buffer);
 }
 
+static uint8_t
+_patternByte(size_t offset)
+{
+    return (uint8_t) (offset % 251);
+}
+
+static void
+_createPatternFile(char *fname, size_t length)
+{
+    PARCBuffer *buffer = parcBuffer_Allocate(length);
+    for (size_t i = 0; i < length; i++) {
+        parcBuffer_PutUint8(buffer, _patternByte(i));
+    }
+    parcBuffer_Flip(buffer);
+
+    _deleteFile(fname);
+    _createFile(fname, buffer);
+    parcBuffer_Release(&buffer);
+}
+
+/**
+ * Iterate over the chunks of a file of `length` pattern bytes and check each chunk's size and contents,
+ * returning the number of chunks.
+ */
+static size_t
+_verifyChunks(size_t length, size_t chunkSize, bool forward)
+{
+    _createPatternFile("/tmp/file_chunker.tmp", length);
+
+    PARCFile *file = parcFile_Create("/tmp/file_chunker.tmp");
+    PARCFileChunker *chunker = parcFileChunker_Create(file, chunkSize);
+
+    PARCIterator *itr = forward ? parcFileChunker_ForwardIterator(chunker) : parcFileChunker_ReverseIterator(chunker);
+
+    size_t count = 0;
+    size_t covered = 0;
+    size_t offset = forward ? 0 : length;
+    while (parcIterator_HasNext(itr)) {
+        PARCBuffer *payload = (PARCBuffer *) parcIterator_Next(itr);
+        size_t size = parcBuffer_Remaining(payload);
+        assertTrue(size > 0 && size <= chunkSize, "Unexpected chunk size %zu", size);
+
+        if (!forward) {
+            offset -= size;
+        }
+        for (size_t i = 0; i < size; i++) {
+            uint8_t actual = parcBuffer_GetAtIndex(payload, i);
+            assertTrue(actual == _patternByte(offset + i), "Chunk %zu: expected %d at offset %zu, got %d",
+                       count, _patternByte(offset + i), offset + i, actual);
+        }
+        if (forward) {
+            offset += size;
+        }
+
+        covered += size;
+        count++;
+        parcBuffer_Release(&payload);
+    }
+    assertTrue(covered == length, "Expected the chunks to cover %zu bytes, covered %zu", length, covered);
+
+    parcIterator_Release(&itr);
+    parcFileChunker_Release(&chunker);
+    parcFile_Release(&file);
+    _deleteFile("/tmp/file_chunker.tmp");
+
+    return count;
+}
+
+LONGBOW_TEST_CASE(Global, parc_Chunker_ForwardIterator_Mapped)
+{
+    size_t count = _verifyChunks(100000, 4096, true);
+    assertTrue(count == 25, "Expected 25 chunks, got %zu", count);
+}
+
+LONGBOW_TEST_CASE(Global, parc_Chunker_ReverseIterator_Mapped)
+{
+    size_t count = _verifyChunks(100000, 4096, false);
+    assertTrue(count == 25, "Expected 25 chunks, got %zu", count);
+}
+
+LONGBOW_TEST_CASE(Global, parc_Chunker_ForwardIterator_Windowed)
+{
+    // Span several read windows, ending in a partial chunk.
+    _parcFileChunker_MapFiles = false;
+    size_t count = _verifyChunks(3 * _parcFileChunker_WindowSize + 1000, 3000, true);
+    _parcFileChunker_MapFiles = true;
+
+    size_t expected = (3 * _parcFileChunker_WindowSize + 1000 + 2999) / 3000;
+    assertTrue(count == expected, "Expected %zu chunks, got %zu", expected, count);
+}
+
+LONGBOW_TEST_CASE(Global, parc_Chunker_ReverseIterator_Windowed)
+{
+    _parcFileChunker_MapFiles = false;
+    size_t count = _verifyChunks(3 * _parcFileChunker_WindowSize + 1000, 3000, false);
+    _parcFileChunker_MapFiles = true;
+
+    size_t expected = (3 * _parcFileChunker_WindowSize + 1000 + 2999) / 3000;
+    assertTrue(count == expected, "Expected %zu chunks, got %zu", expected, count);
+}
+
+LONGBOW_TEST_FIXTURE(Errors)
+{
+    LONGBOW_RUN_TEST_CASE(Errors, parc_Chunker_ForwardIterator_Truncated);
+}
+
+typedef struct {
+    PARCFile *file;
+    PARCFileChunker *chunker;
+    PARCIterator *iterator;
+} _FileChunkerClipBoard;
+
+LONGBOW_TEST_FIXTURE_SETUP(Errors)
+{
+    _FileChunkerClipBoard *testData = calloc(1, sizeof(_FileChunkerClipBoard));
+    longBowTestCase_SetClipBoardData(testCase, testData);
+
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_FIXTURE_TEARDOWN(Errors)
+{
+    _FileChunkerClipBoard *testData = longBowTestCase_GetClipBoardData(testCase);
+    if (testData->iterator != NULL) {
+        parcIterator_Release(&testData->iterator);
+    }
+    if (testData->chunker != NULL) {
+        parcFileChunker_Release(&testData->chunker);
+    }
+    if (testData->file != NULL) {
+        parcFile_Release(&testData->file);
+    }
+    free(testData);
+
+    _parcFileChunker_MapFiles = true;
+    _deleteFile("/tmp/file_chunker.tmp");
+
+    uint32_t outstandingAllocations = parcSafeMemory_ReportAllocation(STDERR_FILENO);
+    if (outstandingAllocations != 0) {
+        printf("%s leaks memory by %d allocations\n", longBowTestCase_GetName(testCase), outstandingAllocations);
+        return LONGBOW_STATUS_MEMORYLEAK;
+    }
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_CASE_EXPECTS(Errors, parc_Chunker_ForwardIterator_Truncated, .event = &LongBowTrapUnrecoverableState)
+{
+    _FileChunkerClipBoard *testData = longBowTestCase_GetClipBoardData(testCase);
+
+    _parcFileChunker_MapFiles = false;
+    _createPatternFile("/tmp/file_chunker.tmp", 100000);
+
+    testData->file = parcFile_Create("/tmp/file_chunker.tmp");
+    testData->chunker = parcFileChunker_Create(testData->file, 4096);
+    testData->iterator = parcFileChunker_ForwardIterator(testData->chunker);
+
+    // The iterator expects 100000 bytes, but the file no longer has them.
+    assertTrue(truncate("/tmp/file_chunker.tmp", 50000) == 0, "truncate failed: %s", strerror(errno));
+
+    PARCBuffer *payload = parcIterator_Next(testData->iterator); // this will fail.
+    parcBuffer_Release(&payload);
+}
+
+LONGBOW_TEST_FIXTURE_OPTIONS(Performance, .enabled = false)
+{
+    LONGBOW_RUN_TEST_CASE(Performance, parcFileChunker_Throughput);
+}
+
+LONGBOW_TEST_FIXTURE_SETUP(Performance)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_FIXTURE_TEARDOWN(Performance)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+/**
+ * The chunker's original strategy: a seek, an allocation and a read for every chunk.
+ */
+static uint64_t
+_chunkBySeekAndRead(PARCFile *file, size_t length, size_t chunkSize)
+{
+    uint64_t sum = 0;
+    PARCRandomAccessFile *fhandle = parcRandomAccessFile_Open(file);
+    for (size_t position = 0; position < length; position += chunkSize) {
+        size_t size = (length - position < chunkSize) ? length - position : chunkSize;
+        parcRandomAccessFile_Seek(fhandle, position, PARCRandomAccessFilePosition_Start);
+        PARCBuffer *chunk = parcBuffer_Allocate(size);
+        parcRandomAccessFile_Read(fhandle, chunk);
+        parcBuffer_Flip(chunk);
+        for (size_t i = 0; i < size; i += 64) {
+            sum += parcBuffer_GetAtIndex(chunk, i);
+        }
+        parcBuffer_Release(&chunk);
+    }
+    parcRandomAccessFile_Release(&fhandle);
+    return sum;
+}
+
+static uint64_t
+_chunkByIterator(PARCFile *file, size_t chunkSize)
+{
+    uint64_t sum = 0;
+    PARCFileChunker *chunker = parcFileChunker_Create(file, chunkSize);
+    PARCIterator *itr = parcFileChunker_ForwardIterator(chunker);
+    while (parcIterator_HasNext(itr)) {
+        PARCBuffer *chunk = (PARCBuffer *) parcIterator_Next(itr);
+        size_t size = parcBuffer_Remaining(chunk);
+        for (size_t i = 0; i < size; i += 64) {
+            sum += parcBuffer_GetAtIndex(chunk, i);
+        }
+        parcBuffer_Release(&chunk);
+    }
+    parcIterator_Release(&itr);
+    parcFileChunker_Release(&chunker);
+    return sum;
+}
+
+static double
+_elapsed(struct timeval *start)
+{
+    struct timeval end;
+    gettimeofday(&end, NULL);
+    timersub(&end, start, &end);
+    return end.tv_sec + end.tv_usec / 1000000.0;
+}
+
+LONGBOW_TEST_CASE(Performance, parcFileChunker_Throughput)
+{
+    size_t length = 256 * 1024 * 1024;
+    size_t chunkSize = 4096;
+    _createPatternFile("/tmp/file_chunker_perf.tmp", length);
+    PARCFile *file = parcFile_Create("/tmp/file_chunker_perf.tmp");
+
+    struct timeval start;
+    double megabytes = length / (1024.0 * 1024.0);
+
+    gettimeofday(&start, NULL);
+    uint64_t expected = _chunkBySeekAndRead(file, length, chunkSize);
+    double seconds = _elapsed(&start);
+    printf("seek+allocate+read: %8.1f MB/s\n", megabytes / seconds);
+
+    gettimeofday(&start, NULL);
+    uint64_t actual = _chunkByIterator(file, chunkSize);
+    seconds = _elapsed(&start);
+    printf("mapped:             %8.1f MB/s\n", megabytes / seconds);
+    assertTrue(expected == actual, "Expected the same checksum from both strategies");
+
+    _parcFileChunker_MapFiles = false;
+    gettimeofday(&start, NULL);
+    actual = _chunkByIterator(file, chunkSize);
+    seconds = _elapsed(&start);
+    printf("windowed:           %8.1f MB/s\n", megabytes / seconds);
+    _parcFileChunker_MapFiles = true;
+    assertTrue(expected == actual, "Expected the same checksum from both strategies");
+
+    parcFile_Release(&file);
+    _deleteFile("/tmp/file_chunker_perf.tmp");
+}
+
 int
 main(int argc, char *argv[])
 {
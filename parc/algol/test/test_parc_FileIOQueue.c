@@ -0,0 +1,473 @@
+/*
+ * Copyright (c) 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Patent rights are not granted under this agreement. Patent rights are
+ *       available under FRAND terms.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX or PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * @copyright 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC).  All rights reserved.
+ */
+// Include the file(s) containing the functions to be tested.
+// This permits internal static functions to be visible to this Test Framework.
+#include "../parc_FileIOQueue.c"
+
+#include <poll.h>
+#include <stdio.h>
+#include <sys/time.h>
+
+#include <LongBow/testing.h>
+#include <LongBow/debugging.h>
+#include <parc/algol/parc_Memory.h>
+#include <parc/algol/parc_SafeMemory.h>
+
+#include <parc/testing/parc_MemoryTesting.h>
+#include <parc/testing/parc_ObjectTesting.h>
+
+#define _fileName "tmpfile_FileIOQueue"
+#define _fileLength 4096
+
+static uint8_t
+_byteAt(uint64_t offset)
+{
+    return (uint8_t) (offset * 7 + (offset >> 8));
+}
+
+/*
+ * Create a file of `length` bytes, where the byte at each offset is `_byteAt(offset)`, and open it.
+ */
+static PARCRandomAccessFile *
+_createFile(const char *name, size_t length)
+{
+    FILE *fp = fopen(name, "w");
+    for (size_t offset = 0; offset < length; offset++) {
+        fputc(_byteAt(offset), fp);
+    }
+    fclose(fp);
+
+    PARCFile *file = parcFile_Create(name);
+    PARCRandomAccessFile *result = parcRandomAccessFile_Open(file);
+    parcFile_Release(&file);
+    return result;
+}
+
+static bool
+_holdsBytesAt(PARCBuffer *buffer, uint64_t offset)
+{
+    for (size_t i = 0; i < parcBuffer_Remaining(buffer); i++) {
+        if (parcBuffer_GetAtIndex(buffer, parcBuffer_Position(buffer) + i) != _byteAt(offset + i)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+LONGBOW_TEST_RUNNER(parc_FileIOQueue)
+{
+    LONGBOW_RUN_TEST_FIXTURE(CreateAcquireRelease);
+    LONGBOW_RUN_TEST_FIXTURE(Global);
+    LONGBOW_RUN_TEST_FIXTURE(Errors);
+    LONGBOW_RUN_TEST_FIXTURE(Performance);
+}
+
+LONGBOW_TEST_RUNNER_SETUP(parc_FileIOQueue)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_RUNNER_TEARDOWN(parc_FileIOQueue)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_FIXTURE(CreateAcquireRelease)
+{
+    LONGBOW_RUN_TEST_CASE(CreateAcquireRelease, CreateRelease);
+    LONGBOW_RUN_TEST_CASE(CreateAcquireRelease, Release_Outstanding);
+}
+
+LONGBOW_TEST_FIXTURE_SETUP(CreateAcquireRelease)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_FIXTURE_TEARDOWN(CreateAcquireRelease)
+{
+    unlink(_fileName);
+    if (!parcMemoryTesting_ExpectedOutstanding(0, "%s leaked memory.", longBowTestCase_GetFullName(testCase))) {
+        return LONGBOW_STATUS_MEMORYLEAK;
+    }
+
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_CASE(CreateAcquireRelease, CreateRelease)
+{
+    PARCFileIOQueue *instance = parcFileIOQueue_Create(4, NULL);
+    assertNotNull(instance, "Expected non-null result from parcFileIOQueue_Create");
+    assertTrue(parcFileIOQueue_IsValid(instance), "Expected a valid instance");
+
+    parcObjectTesting_AssertAcquireReleaseContract(parcFileIOQueue_Acquire, instance);
+
+    parcFileIOQueue_Release(&instance);
+    assertNull(instance, "Expected null result from parcFileIOQueue_Release");
+}
+
+LONGBOW_TEST_CASE(CreateAcquireRelease, Release_Outstanding)
+{
+    PARCRandomAccessFile *file = _createFile(_fileName, _fileLength);
+    PARCFileIOQueue *queue = parcFileIOQueue_Create(2, NULL);
+
+    PARCFileIORequest requests[64];
+    for (size_t i = 0; i < 64; i++) {
+        requests[i] = (PARCFileIORequest) {
+            .operation = PARCFileIOOperation_Read, .file = file, .offset = i * 64, .length = 64
+        };
+    }
+    parcFileIOQueue_Submit(queue, 64, requests);
+
+    // Releasing the queue discards the pending requests and the unreaped completions.
+    parcFileIOQueue_Release(&queue);
+    parcRandomAccessFile_Release(&file);
+}
+
+LONGBOW_TEST_FIXTURE(Global)
+{
+    LONGBOW_RUN_TEST_CASE(Global, parcFileIOQueue_Submit_Read);
+    LONGBOW_RUN_TEST_CASE(Global, parcFileIOQueue_Submit_ReadIntoBuffer);
+    LONGBOW_RUN_TEST_CASE(Global, parcFileIOQueue_Submit_ReadPastEnd);
+    LONGBOW_RUN_TEST_CASE(Global, parcFileIOQueue_Submit_Write);
+    LONGBOW_RUN_TEST_CASE(Global, parcFileIOQueue_Reap);
+    LONGBOW_RUN_TEST_CASE(Global, parcFileIOQueue_Notifier);
+}
+
+LONGBOW_TEST_FIXTURE_SETUP(Global)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_FIXTURE_TEARDOWN(Global)
+{
+    unlink(_fileName);
+    if (!parcMemoryTesting_ExpectedOutstanding(0, "%s leaked memory.", longBowTestCase_GetFullName(testCase))) {
+        return LONGBOW_STATUS_MEMORYLEAK;
+    }
+
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_CASE(Global, parcFileIOQueue_Submit_Read)
+{
+    PARCRandomAccessFile *file = _createFile(_fileName, _fileLength);
+    PARCFileIOQueue *queue = parcFileIOQueue_Create(4, NULL);
+
+    size_t count = _fileLength / 256;
+    PARCFileIORequest requests[count];
+    for (size_t i = 0; i < count; i++) {
+        requests[i] = (PARCFileIORequest) {
+            .operation = PARCFileIOOperation_Read, .file = file, .offset = (count - 1 - i) * 256, .length = 256,
+            .context = &requests[i]
+        };
+    }
+    size_t submitted = parcFileIOQueue_Submit(queue, count, requests);
+    assertTrue(submitted == count, "Expected %zu requests to be submitted, actual %zu", count, submitted);
+
+    PARCFileIOCompletion completions[count];
+    size_t completed = parcFileIOQueue_Wait(queue, count, count, completions);
+    assertTrue(completed == count, "Expected %zu completions, actual %zu", count, completed);
+    assertTrue(parcFileIOQueue_Outstanding(queue) == 0, "Expected nothing outstanding");
+
+    for (size_t i = 0; i < completed; i++) {
+        PARCFileIORequest *request = completions[i].context;
+        assertTrue(completions[i].offset == request->offset, "Expected the offset of the request");
+        assertTrue(completions[i].result == 256, "Expected 256 bytes to be read, actual %zd", completions[i].result);
+        assertTrue(parcBuffer_Position(completions[i].buffer) == 0 && parcBuffer_Remaining(completions[i].buffer) == 256,
+                   "Expected a buffer holding the bytes read");
+        assertTrue(_holdsBytesAt(completions[i].buffer, completions[i].offset), "Expected the bytes at offset %" PRIu64, completions[i].offset);
+        parcBuffer_Release(&completions[i].buffer);
+    }
+
+    parcFileIOQueue_Release(&queue);
+    parcRandomAccessFile_Release(&file);
+}
+
+LONGBOW_TEST_CASE(Global, parcFileIOQueue_Submit_ReadIntoBuffer)
+{
+    PARCRandomAccessFile *file = _createFile(_fileName, _fileLength);
+    PARCFileIOQueue *queue = parcFileIOQueue_Create(1, NULL);
+
+    PARCBuffer *buffer = parcBuffer_Allocate(100);
+    parcBuffer_SetPosition(buffer, 20);
+    PARCFileIORequest request = { .operation = PARCFileIOOperation_Read, .file = file, .offset = 1000, .buffer = buffer };
+    parcFileIOQueue_Submit(queue, 1, &request);
+    parcBuffer_Release(&buffer);
+
+    PARCFileIOCompletion completion;
+    parcFileIOQueue_Wait(queue, 1, 1, &completion);
+    assertTrue(completion.result == 80, "Expected 80 bytes to be read, actual %zd", completion.result);
+    assertFalse(parcBuffer_HasRemaining(completion.buffer), "Expected the buffer's position to be advanced");
+
+    parcBuffer_SetPosition(completion.buffer, 20);
+    assertTrue(_holdsBytesAt(completion.buffer, 1000), "Expected the bytes at offset 1000");
+
+    parcBuffer_Release(&completion.buffer);
+    parcFileIOQueue_Release(&queue);
+    parcRandomAccessFile_Release(&file);
+}
+
+LONGBOW_TEST_CASE(Global, parcFileIOQueue_Submit_ReadPastEnd)
+{
+    PARCRandomAccessFile *file = _createFile(_fileName, _fileLength);
+    PARCFileIOQueue *queue = parcFileIOQueue_Create(1, NULL);
+
+    PARCFileIORequest request = {
+        .operation = PARCFileIOOperation_Read, .file = file, .offset = _fileLength - 10, .length = 100
+    };
+    parcFileIOQueue_Submit(queue, 1, &request);
+
+    PARCFileIOCompletion completion;
+    parcFileIOQueue_Wait(queue, 1, 1, &completion);
+    assertTrue(completion.result == 10, "Expected 10 bytes to be read, actual %zd", completion.result);
+    assertTrue(parcBuffer_Remaining(completion.buffer) == 10, "Expected the buffer to hold the 10 bytes read");
+
+    parcBuffer_Release(&completion.buffer);
+    parcFileIOQueue_Release(&queue);
+    parcRandomAccessFile_Release(&file);
+}
+
+LONGBOW_TEST_CASE(Global, parcFileIOQueue_Submit_Write)
+{
+    PARCRandomAccessFile *file = _createFile(_fileName, _fileLength);
+    PARCFileIOQueue *queue = parcFileIOQueue_Create(4, NULL);
+
+    PARCFileIORequest requests[16];
+    for (size_t i = 0; i < 16; i++) {
+        PARCBuffer *buffer = parcBuffer_Allocate(16);
+        for (size_t j = 0; j < 16; j++) {
+            parcBuffer_PutUint8(buffer, (uint8_t) i);
+        }
+        requests[i] = (PARCFileIORequest) {
+            .operation = PARCFileIOOperation_Write, .file = file, .offset = i * 16, .buffer = parcBuffer_Flip(buffer)
+        };
+    }
+    parcFileIOQueue_Submit(queue, 16, requests);
+    for (size_t i = 0; i < 16; i++) {
+        parcBuffer_Release(&requests[i].buffer);
+    }
+
+    PARCFileIOCompletion completions[16];
+    size_t completed = parcFileIOQueue_Wait(queue, 16, 16, completions);
+    assertTrue(completed == 16, "Expected 16 completions, actual %zu", completed);
+    for (size_t i = 0; i < completed; i++) {
+        assertTrue(completions[i].operation == PARCFileIOOperation_Write, "Expected a write completion");
+        assertTrue(completions[i].result == 16, "Expected 16 bytes to be written, actual %zd", completions[i].result);
+        parcBuffer_Release(&completions[i].buffer);
+    }
+
+    PARCBuffer *buffer = parcBuffer_Allocate(256);
+    parcRandomAccessFile_ReadAt(file, buffer, 0);
+    for (size_t i = 0; i < 256; i++) {
+        assertTrue(parcBuffer_GetAtIndex(buffer, i) == i / 16, "Expected %zu at offset %zu", i / 16, i);
+    }
+
+    parcBuffer_Release(&buffer);
+    parcFileIOQueue_Release(&queue);
+    parcRandomAccessFile_Release(&file);
+}
+
+LONGBOW_TEST_CASE(Global, parcFileIOQueue_Reap)
+{
+    PARCRandomAccessFile *file = _createFile(_fileName, _fileLength);
+    PARCFileIOQueue *queue = parcFileIOQueue_Create(2, NULL);
+
+    PARCFileIOCompletion completions[8];
+    assertTrue(parcFileIOQueue_Reap(queue, 8, completions) == 0, "Expected no completions from an idle queue");
+    assertTrue(parcFileIOQueue_Wait(queue, 8, 8, completions) == 0, "Expected an idle queue not to wait");
+
+    PARCFileIORequest requests[8];
+    for (size_t i = 0; i < 8; i++) {
+        requests[i] = (PARCFileIORequest) { .operation = PARCFileIOOperation_Read, .file = file, .offset = i, .length = 1 };
+    }
+    parcFileIOQueue_Submit(queue, 8, requests);
+
+    size_t reaped = 0;
+    while (reaped < 8) {
+        size_t count = parcFileIOQueue_Reap(queue, 3, completions);
+        assertTrue(count <= 3, "Expected at most 3 completions, actual %zu", count);
+        for (size_t i = 0; i < count; i++) {
+            parcBuffer_Release(&completions[i].buffer);
+        }
+        reaped += count;
+    }
+    assertTrue(parcFileIOQueue_Outstanding(queue) == 0, "Expected nothing outstanding");
+
+    parcFileIOQueue_Release(&queue);
+    parcRandomAccessFile_Release(&file);
+}
+
+LONGBOW_TEST_CASE(Global, parcFileIOQueue_Notifier)
+{
+    PARCRandomAccessFile *file = _createFile(_fileName, _fileLength);
+    PARCNotifier *notifier = parcNotifier_Create();
+    PARCFileIOQueue *queue = parcFileIOQueue_Create(2, notifier);
+
+    PARCFileIORequest request = { .operation = PARCFileIOOperation_Read, .file = file, .offset = 0, .length = 16 };
+    parcFileIOQueue_Submit(queue, 1, &request);
+
+    struct pollfd pfd = { .fd = parcNotifier_Socket(notifier), .events = POLLIN };
+    int ready = poll(&pfd, 1, 5000);
+    assertTrue(ready == 1, "Expected the notifier's socket to become readable");
+
+    parcNotifier_PauseEvents(notifier);
+    PARCFileIOCompletion completion;
+    size_t count = parcFileIOQueue_Reap(queue, 1, &completion);
+    assertTrue(count == 1, "Expected a completion once notified");
+    parcNotifier_StartEvents(notifier);
+
+    parcBuffer_Release(&completion.buffer);
+    parcFileIOQueue_Release(&queue);
+    parcNotifier_Release(&notifier);
+    parcRandomAccessFile_Release(&file);
+}
+
+LONGBOW_TEST_FIXTURE(Errors)
+{
+    LONGBOW_RUN_TEST_CASE(Errors, parcFileIOQueue_Create_NoThreads);
+}
+
+LONGBOW_TEST_FIXTURE_SETUP(Errors)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_FIXTURE_TEARDOWN(Errors)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_CASE_EXPECTS(Errors, parcFileIOQueue_Create_NoThreads, .event = &LongBowTrapIllegalValue)
+{
+    PARCFileIOQueue *queue = parcFileIOQueue_Create(0, NULL);
+
+    parcFileIOQueue_Release(&queue);
+}
+
+LONGBOW_TEST_FIXTURE_OPTIONS(Performance, .enabled = false)
+{
+    LONGBOW_RUN_TEST_CASE(Performance, RandomReadIOPS);
+}
+
+LONGBOW_TEST_FIXTURE_SETUP(Performance)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_FIXTURE_TEARDOWN(Performance)
+{
+    unlink(_fileName);
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+static double
+_seconds(const struct timeval *start, const struct timeval *end)
+{
+    struct timeval elapsed;
+    timersub(end, start, &elapsed);
+    return elapsed.tv_sec + elapsed.tv_usec / 1000000.0;
+}
+
+LONGBOW_TEST_CASE(Performance, RandomReadIOPS)
+{
+    size_t fileLength = 64 * 1024 * 1024;
+    size_t blockSize = 4096;
+    size_t count = 200000;
+    size_t batch = 64;
+    PARCRandomAccessFile *file = _createFile(_fileName, fileLength);
+
+    uint64_t *offsets = parcMemory_Allocate(count * sizeof(uint64_t));
+    uint64_t state = 88172645463325252ULL;
+    for (size_t i = 0; i < count; i++) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        offsets[i] = (state % (fileLength / blockSize)) * blockSize;
+    }
+    PARCBuffer *buffer = parcBuffer_Allocate(blockSize);
+
+    struct timeval start, end;
+    gettimeofday(&start, NULL);
+    for (size_t i = 0; i < count; i++) {
+        parcRandomAccessFile_Seek(file, (long) offsets[i], PARCRandomAccessFilePosition_Start);
+        parcRandomAccessFile_Read(file, parcBuffer_Clear(buffer));
+    }
+    gettimeofday(&end, NULL);
+    printf("Seek and Read:    %8.0f reads/s\n", count / _seconds(&start, &end));
+
+    gettimeofday(&start, NULL);
+    for (size_t i = 0; i < count; i++) {
+        parcRandomAccessFile_ReadAt(file, parcBuffer_Clear(buffer), offsets[i]);
+    }
+    gettimeofday(&end, NULL);
+    printf("ReadAt:           %8.0f reads/s\n", count / _seconds(&start, &end));
+
+    size_t threadCounts[] = { 1, 4, 16 };
+    for (size_t t = 0; t < sizeof(threadCounts) / sizeof(threadCounts[0]); t++) {
+        PARCFileIOQueue *queue = parcFileIOQueue_Create(threadCounts[t], NULL);
+        PARCFileIORequest requests[batch];
+        PARCFileIOCompletion completions[batch];
+
+        gettimeofday(&start, NULL);
+        for (size_t i = 0; i < count; i += batch) {
+            size_t n = (count - i < batch) ? count - i : batch;
+            for (size_t j = 0; j < n; j++) {
+                requests[j] = (PARCFileIORequest) {
+                    .operation = PARCFileIOOperation_Read, .file = file, .offset = offsets[i + j], .length = blockSize
+                };
+            }
+            parcFileIOQueue_Submit(queue, n, requests);
+            for (size_t done = 0; done < n; ) {
+                size_t reaped = parcFileIOQueue_Wait(queue, 1, batch, completions);
+                for (size_t j = 0; j < reaped; j++) {
+                    parcBuffer_Release(&completions[j].buffer);
+                }
+                done += reaped;
+            }
+        }
+        gettimeofday(&end, NULL);
+        printf("FileIOQueue (%2zu threads, batches of %zu): %8.0f reads/s\n", threadCounts[t], batch, count / _seconds(&start, &end));
+
+        parcFileIOQueue_Release(&queue);
+    }
+
+    parcBuffer_Release(&buffer);
+    parcMemory_Deallocate(&offsets);
+    parcRandomAccessFile_Release(&file);
+}
+
+int
+main(int argc, char *argv[argc])
+{
+    LongBowRunner *testRunner = LONGBOW_TEST_RUNNER_CREATE(parc_FileIOQueue);
+    int exitStatus = LONGBOW_TEST_MAIN(argc, argv, testRunner);
+    longBowTestRunner_Destroy(&testRunner);
+    exit(exitStatus);
+}
@@ -40,6 +40,8 @@
 #include <LongBow/unit-test.h>
 #include <LongBow/debugging.h>
 
+#include <inttypes.h>
+
 #include <parc/algol/parc_File.h>
 #include <parc/algol/parc_SafeMemory.h>
 
@@ -67,6 +69,9 @@ LONGBOW_TEST_FIXTURE(Global)
 {
     LONGBOW_RUN_TEST_CASE(Global, parcFileInputStream_Open);
     LONGBOW_RUN_TEST_CASE(Global, parcFileInputStream_ReadFile);
+    LONGBOW_RUN_TEST_CASE(Global, parcFileInputStream_Map);
+    LONGBOW_RUN_TEST_CASE(Global, parcFileInputStream_Read_EndOfFile);
+    LONGBOW_RUN_TEST_CASE(Global, parcFileInputStream_ReadIntoPooledBuffer);
 }
 
 LONGBOW_TEST_FIXTURE_SETUP(Global)
@@ -110,6 +115,78 @@ LONGBOW_TEST_CASE(Global, parcFileInputStream_ReadFile)
     parcFile_Release(&file);
 }
 
+LONGBOW_TEST_CASE(Global, parcFileInputStream_Map)
+{
+    PARCFile *file = parcFile_Create("test_parc_FileInputStream");
+    PARCFileInputStream *stream = parcFileInputStream_Open(file);
+    PARCBuffer *expected = parcBuffer_Flip(parcFileInputStream_ReadFile(stream));
+    parcFileInputStream_Release(&stream);
+
+    stream = parcFileInputStream_Open(file);
+    PARCBuffer *actual = parcFileInputStream_Map(stream);
+    parcFileInputStream_Release(&stream);
+
+    assertNotNull(actual, "Expected non-null result from parcFileInputStream_Map");
+    assertTrue(parcByteArray_IsMapped(parcBuffer_Array(actual)), "Expected the buffer to be backed by a mapping.");
+    assertTrue(parcBuffer_IsFrozen(actual), "Expected the mapped buffer to be frozen.");
+    assertTrue(parcBuffer_Equals(expected, actual), "Expected the mapped file to equal the file read into memory.");
+
+    parcBuffer_Release(&actual);
+    parcBuffer_Release(&expected);
+    parcFile_Release(&file);
+}
+
+LONGBOW_TEST_CASE(Global, parcFileInputStream_Read_EndOfFile)
+{
+    PARCFile *file = parcFile_Create("test_parc_FileInputStream");
+    PARCFileInputStream *stream = parcFileInputStream_Open(file);
+    PARCBuffer *contents = parcFileInputStream_ReadFile(stream);
+    parcFileInputStream_Release(&stream);
+
+    // A buffer larger than the file cannot be filled, and reading must stop at the end of the file.
+    stream = parcFileInputStream_Open(file);
+    PARCBuffer *buffer = parcBuffer_Allocate(parcBuffer_Capacity(contents) + 100);
+    bool filled = parcFileInputStream_Read(stream, buffer);
+
+    assertFalse(filled, "Expected the buffer not to be filled");
+    assertTrue(parcBuffer_Position(buffer) == parcBuffer_Capacity(contents),
+               "Expected %zu bytes read, actual %zu", parcBuffer_Capacity(contents), parcBuffer_Position(buffer));
+
+    parcBuffer_Release(&buffer);
+    parcBuffer_Release(&contents);
+    parcFileInputStream_Release(&stream);
+    parcFile_Release(&file);
+}
+
+LONGBOW_TEST_CASE(Global, parcFileInputStream_ReadIntoPooledBuffer)
+{
+    PARCFile *file = parcFile_Create("test_parc_FileInputStream");
+    PARCFileInputStream *stream = parcFileInputStream_Open(file);
+    PARCBuffer *expected = parcBuffer_Flip(parcFileInputStream_ReadFile(stream));
+    parcFileInputStream_Release(&stream);
+
+    PARCBufferPool *pool = parcBufferPool_Create(64, 1024, 16);
+    PARCBuffer *actual = parcBuffer_Allocate(parcBuffer_Remaining(expected));
+
+    stream = parcFileInputStream_Open(file);
+    PARCBuffer *chunk;
+    while ((chunk = parcFileInputStream_ReadIntoPooledBuffer(stream, pool, 100)) != NULL) {
+        assertTrue(parcBuffer_Remaining(chunk) <= 100, "Expected at most 100 bytes, actual %zu", parcBuffer_Remaining(chunk));
+        parcBuffer_PutBuffer(actual, chunk);
+        parcBuffer_Release(&chunk);
+    }
+    parcFileInputStream_Release(&stream);
+    parcBuffer_Flip(actual);
+
+    assertTrue(parcBuffer_Equals(expected, actual), "Expected the pooled reads to equal the file");
+    assertTrue(parcBufferPool_GetMisses(pool) == 1, "Expected one miss, actual %" PRIu64, parcBufferPool_GetMisses(pool));
+
+    parcBuffer_Release(&actual);
+    parcBuffer_Release(&expected);
+    parcBufferPool_Release(&pool);
+    parcFile_Release(&file);
+}
+
 int
 main(int argc, char *argv[argc])
 {
@@ -118,6 +118,8 @@ LONGBOW_TEST_CASE(AcquireRelease, parcFileOutputStream_AcquireRelease)
 LONGBOW_TEST_FIXTURE(Global)
 {
     LONGBOW_RUN_TEST_CASE(Global, parcFileOutputStream_Write);
+    LONGBOW_RUN_TEST_CASE(Global, parcFileOutputStream_WriteBufferChain);
+    LONGBOW_RUN_TEST_CASE(Global, parcFileOutputStream_WriteBufferChain_OutputStream);
 }
 
 LONGBOW_TEST_FIXTURE_SETUP(Global)
@@ -154,6 +156,74 @@ LONGBOW_TEST_CASE(Global, parcFileOutputStream_Write)
     unlink("/tmp/test_parc_FileOutputStream");
 }
 
+static char *
+_readFile(const char *path, size_t *lengthPtr)
+{
+    static char contents[1024];
+    int fd = open(path, O_RDONLY);
+    ssize_t length = read(fd, contents, sizeof(contents) - 1);
+    close(fd);
+    contents[length < 0 ? 0 : length] = 0;
+    *lengthPtr = (length < 0) ? 0 : (size_t) length;
+    return contents;
+}
+
+LONGBOW_TEST_CASE(Global, parcFileOutputStream_WriteBufferChain)
+{
+    PARCFileOutputStream *stream =
+        parcFileOutputStream_Create(open("/tmp/test_parc_FileOutputStream", O_CREAT | O_WRONLY | O_TRUNC, 0600));
+
+    PARCBufferChain *chain = parcBufferChain_Create();
+    for (int i = 0; i < 100; i++) {
+        PARCBuffer *segment = parcBuffer_WrapCString("0123456789");
+        parcBufferChain_Append(chain, segment);
+        parcBuffer_Release(&segment);
+    }
+
+    size_t written = parcFileOutputStream_WriteBufferChain(stream, chain);
+    parcFileOutputStream_Release(&stream);
+
+    assertTrue(written == 1000, "Expected 1000 bytes written, actual %zu", written);
+    assertTrue(parcBufferChain_Length(chain) == 0, "Expected the chain to be consumed.");
+
+    size_t length;
+    char *contents = _readFile("/tmp/test_parc_FileOutputStream", &length);
+    assertTrue(length == 1000, "Expected a 1000 byte file, actual %zu", length);
+    assertTrue(strncmp(&contents[990], "0123456789", 10) == 0, "Expected the segments to be written in order.");
+
+    parcBufferChain_Release(&chain);
+    unlink("/tmp/test_parc_FileOutputStream");
+}
+
+LONGBOW_TEST_CASE(Global, parcFileOutputStream_WriteBufferChain_OutputStream)
+{
+    PARCFileOutputStream *fileStream =
+        parcFileOutputStream_Create(open("/tmp/test_parc_FileOutputStream", O_CREAT | O_WRONLY | O_TRUNC, 0600));
+    PARCOutputStream *stream = parcFileOutputStream_AsOutputStream(fileStream);
+    parcFileOutputStream_Release(&fileStream);
+
+    PARCBuffer *header = parcBuffer_WrapCString("Hello ");
+    PARCBuffer *payload = parcBuffer_WrapCString("World");
+    PARCBufferChain *chain = parcBufferChain_Create();
+    parcBufferChain_Append(chain, payload);
+    parcBufferChain_Prepend(chain, header);
+
+    size_t written = parcOutputStream_WriteBufferChain(stream, chain);
+    parcOutputStream_Release(&stream);
+
+    assertTrue(written == 11, "Expected 11 bytes written, actual %zu", written);
+    assertTrue(parcBuffer_Position(header) == 0, "Expected the appended buffers to be unchanged.");
+
+    size_t length;
+    char *contents = _readFile("/tmp/test_parc_FileOutputStream", &length);
+    assertTrue(strcmp(contents, "Hello World") == 0, "Expected 'Hello World', actual '%s'", contents);
+
+    parcBufferChain_Release(&chain);
+    parcBuffer_Release(&header);
+    parcBuffer_Release(&payload);
+    unlink("/tmp/test_parc_FileOutputStream");
+}
+
 LONGBOW_TEST_FIXTURE(Local)
 {
 }
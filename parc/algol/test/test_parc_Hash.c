@@ -28,6 +28,7 @@
 
 #include <LongBow/testing.h>
 #include <stdio.h>
+#include <inttypes.h>
 
 #include <parc/algol/parc_SafeMemory.h>
 
@@ -62,9 +63,11 @@ LONGBOW_TEST_FIXTURE(Global)
     LONGBOW_RUN_TEST_CASE(Global, parcHash32Bit_Hash);
 
     LONGBOW_RUN_TEST_CASE(Global, parc_Hash32_Data);
+    LONGBOW_RUN_TEST_CASE(Global, parc_Hash32_Data_TestVectors);
     LONGBOW_RUN_TEST_CASE(Global, parc_Hash32_Int32);
     LONGBOW_RUN_TEST_CASE(Global, parc_Hash32_Int64);
     LONGBOW_RUN_TEST_CASE(Global, parc_Hash64_Data);
+    LONGBOW_RUN_TEST_CASE(Global, parc_Hash64_Data_TestVectors);
     LONGBOW_RUN_TEST_CASE(Global, parc_Hash64_Int32);
     LONGBOW_RUN_TEST_CASE(Global, parc_Hash64_Int64);
 }
@@ -148,6 +151,31 @@ LONGBOW_TEST_CASE(Global, parc_Hash32_Data)
     assertTrue(hash1 == hash4, "Hash different for same content");
 }
 
+/*
+ * FNV-1a treats each byte as unsigned. Bytes of 0x80 and above must not be sign-extended.
+ */
+LONGBOW_TEST_CASE(Global, parc_Hash32_Data_TestVectors)
+{
+    struct {
+        const char *data;
+        size_t length;
+        uint32_t expected;
+    } vectors[] = {
+        { "",                 0, 0x811C9DC5 },
+        { "a",                1, 0xE40C292C },
+        { "foobar",           6, 0xBF9CF968 },
+        { "\x80",             1, 0x850B939F },
+        { "\xFF",             1, 0x7A0B824E },
+        { "\xDE\xAD\xBE\xEF", 4, 0x045D4BB3 },
+    };
+
+    for (size_t i = 0; i < sizeof(vectors) / sizeof(vectors[0]); i++) {
+        uint32_t actual = parcHash32_Data(vectors[i].data, vectors[i].length);
+        assertTrue(actual == vectors[i].expected,
+                   "Vector %zu: expected 0x%08X, actual 0x%08X", i, vectors[i].expected, actual);
+    }
+}
+
 LONGBOW_TEST_CASE(Global, parc_Hash32_Int32)
 {
     uint32_t data1 = 12345;
@@ -206,6 +234,28 @@ LONGBOW_TEST_CASE(Global, parc_Hash64_Data)
     assertTrue(hash1 == hash4, "Hash different for same content");
 }
 
+LONGBOW_TEST_CASE(Global, parc_Hash64_Data_TestVectors)
+{
+    struct {
+        const char *data;
+        size_t length;
+        uint64_t expected;
+    } vectors[] = {
+        { "",                 0, 0xCBF29CE484222325ULL },
+        { "a",                1, 0xAF63DC4C8601EC8CULL },
+        { "foobar",           6, 0x85944171F73967E8ULL },
+        { "\x80",             1, 0xAF643D4C8602915FULL },
+        { "\xFF",             1, 0xAF64724C8602EB6EULL },
+        { "\xDE\xAD\xBE\xEF", 4, 0x277045760CDD0993ULL },
+    };
+
+    for (size_t i = 0; i < sizeof(vectors) / sizeof(vectors[0]); i++) {
+        uint64_t actual = parcHash64_Data(vectors[i].data, vectors[i].length);
+        assertTrue(actual == vectors[i].expected,
+                   "Vector %zu: expected 0x%016" PRIX64 ", actual 0x%016" PRIX64, i, vectors[i].expected, actual);
+    }
+}
+
 LONGBOW_TEST_CASE(Global, parc_Hash64_Int32)
 {
     uint32_t data1 = 12345;
@@ -29,6 +29,7 @@
  * @copyright 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC).  All rights reserved.
  */
 #include "../parc_HashMap.c"
+#include <inttypes.h>
 
 #include <LongBow/unit-test.h>
 #include <parc/algol/parc_SafeMemory.h>
@@ -299,6 +300,7 @@ LONGBOW_TEST_CASE(ObjectContract, parcHashMap_ToString)
 LONGBOW_TEST_FIXTURE(Global)
 {
     LONGBOW_RUN_TEST_CASE(Global, parcHashMap_Put);
+    LONGBOW_RUN_TEST_CASE(Global, parcHashMap_PutShared);
     LONGBOW_RUN_TEST_CASE(Global, parcHashMap_PutN);
     LONGBOW_RUN_TEST_CASE(Global, parcHashMap_Put_Replace);
     LONGBOW_RUN_TEST_CASE(Global, parcHashMap_Get_NoValue);
@@ -313,6 +315,11 @@ LONGBOW_TEST_FIXTURE(Global)
     LONGBOW_RUN_TEST_CASE(Global, parcHashMap_KeyIterator_HasNext);
     LONGBOW_RUN_TEST_CASE(Global, parcHashMap_KeyIterator_Next);
     LONGBOW_RUN_TEST_CASE(Global, parcHashMap_KeyIterator_Remove);
+    LONGBOW_RUN_TEST_CASE(Global, parcHashMap_Cursor);
+    LONGBOW_RUN_TEST_CASE(Global, parcHashMap_Cursor_Empty);
+    LONGBOW_RUN_TEST_CASE(Global, parcHashMap_CursorNext);
+    LONGBOW_RUN_TEST_CASE(Global, parcHashMap_ForEachKey);
+    LONGBOW_RUN_TEST_CASE(Global, parcHashMap_ForEachValue);
 }
 
 LONGBOW_TEST_FIXTURE_SETUP(Global)
@@ -355,6 +362,27 @@ LONGBOW_TEST_CASE(Global, parcHashMap_Put)
     parcHashMap_Release(&instance);
 }
 
+LONGBOW_TEST_CASE(Global, parcHashMap_PutShared)
+{
+    PARCHashMap *instance = parcHashMap_Create();
+
+    PARCBuffer *key = parcBuffer_WrapCString("key1");
+    PARCBuffer *value = parcBuffer_WrapCString("value1");
+
+    size_t keyReferences = parcObject_GetReferenceCount(key);
+
+    parcHashMap_PutShared(instance, key, value);
+    assertTrue(keyReferences + 1 == parcObject_GetReferenceCount(key), "Expected key reference to be incremented by 1.");
+
+    PARCCursor cursor = parcHashMap_Cursor(instance);
+    assertTrue(parcHashMap_CursorNextKey(&cursor) == key, "Expected the map to hold the given key instance.");
+
+    parcBuffer_Release(&key);
+    parcBuffer_Release(&value);
+
+    parcHashMap_Release(&instance);
+}
+
 LONGBOW_TEST_CASE(Global, parcHashMap_PutN)
 {
     size_t testRunSize = 100;
@@ -695,6 +723,129 @@ LONGBOW_TEST_CASE(Global, parcHashMap_KeyIterator_Remove)
     parcHashMap_Release(&instance);
 }
 
+LONGBOW_TEST_CASE(Global, parcHashMap_Cursor)
+{
+    PARCHashMap *instance = parcHashMap_CreateCapacity(7);
+
+    size_t expectedCount = 50;
+    for (size_t i = 0; i < expectedCount; i++) {
+        PARCBuffer *key = parcBuffer_Flip(parcBuffer_PutUint64(parcBuffer_Allocate(sizeof(uint64_t)), i));
+        PARCBuffer *value = parcBuffer_Flip(parcBuffer_PutUint64(parcBuffer_Allocate(sizeof(uint64_t)), i * 2));
+        parcHashMap_Put(instance, key, value);
+        parcBuffer_Release(&key);
+        parcBuffer_Release(&value);
+    }
+
+    size_t count = 0;
+    PARCCursor cursor = parcHashMap_Cursor(instance);
+    while (parcHashMap_CursorHasNext(&cursor)) {
+        PARCBuffer *key = parcHashMap_CursorNextKey(&cursor);
+        assertTrue(parcBuffer_Remaining(key) > 0, "The same key appeared more than once in the traversal");
+        uint64_t actual = parcBuffer_GetUint64(key);
+        assertTrue(actual < expectedCount, "Unexpected key %" PRIu64, actual);
+        count++;
+    }
+    assertTrue(count == expectedCount, "Expected %zd keys, actual %zd", expectedCount, count);
+
+    parcHashMap_Release(&instance);
+}
+
+LONGBOW_TEST_CASE(Global, parcHashMap_Cursor_Empty)
+{
+    PARCHashMap *instance = parcHashMap_Create();
+
+    PARCCursor cursor = parcHashMap_Cursor(instance);
+    assertFalse(parcHashMap_CursorHasNext(&cursor), "Expected a cursor on an empty map to not HaveNext");
+
+    parcHashMap_Release(&instance);
+}
+
+LONGBOW_TEST_CASE(Global, parcHashMap_CursorNext)
+{
+    // Most buckets of a large map holding few entries are empty.
+    PARCHashMap *instance = parcHashMap_CreateCapacity(1000);
+
+    size_t expectedCount = 5;
+    for (size_t i = 0; i < expectedCount; i++) {
+        PARCBuffer *key = parcBuffer_Flip(parcBuffer_PutUint64(parcBuffer_Allocate(sizeof(uint64_t)), i));
+        PARCBuffer *value = parcBuffer_Flip(parcBuffer_PutUint64(parcBuffer_Allocate(sizeof(uint64_t)), i * 2));
+        parcHashMap_Put(instance, key, value);
+        parcBuffer_Release(&key);
+        parcBuffer_Release(&value);
+    }
+
+    size_t count = 0;
+    PARCCursor cursor = parcHashMap_Cursor(instance);
+    while (parcHashMap_CursorHasNext(&cursor)) {
+        PARCObject *key;
+        PARCObject *value;
+        parcHashMap_CursorNext(&cursor, &key, &value);
+        uint64_t k = parcBuffer_GetUint64(parcBuffer_Rewind(key));
+        uint64_t v = parcBuffer_GetUint64(parcBuffer_Rewind(value));
+        assertTrue(v == k * 2, "Expected the value %" PRIu64 " for key %" PRIu64 ", actual %" PRIu64, k * 2, k, v);
+        count++;
+    }
+    assertTrue(count == expectedCount, "Expected %zd entries, actual %zd", expectedCount, count);
+
+    parcHashMap_Release(&instance);
+}
+
+LONGBOW_TEST_CASE(Global, parcHashMap_ForEachKey)
+{
+    PARCHashMap *instance = parcHashMap_Create();
+
+    PARCBuffer *key1 = parcBuffer_WrapCString("key1");
+    PARCBuffer *value1 = parcBuffer_WrapCString("1");
+    PARCBuffer *key2 = parcBuffer_WrapCString("key2");
+    PARCBuffer *value2 = parcBuffer_WrapCString("2");
+
+    parcHashMap_Put(instance, key1, value1);
+    parcHashMap_Put(instance, key2, value2);
+
+    size_t count = 0;
+    PARCBuffer *key;
+    parcHashMap_ForEachKey(instance, key) {
+        assertTrue(parcBuffer_Equals(key, key1) || parcBuffer_Equals(key, key2), "Unexpected key in the traversal");
+        count++;
+    }
+    assertTrue(count == 2, "Expected 2 keys, actual %zd", count);
+
+    parcBuffer_Release(&key1);
+    parcBuffer_Release(&value1);
+    parcBuffer_Release(&key2);
+    parcBuffer_Release(&value2);
+
+    parcHashMap_Release(&instance);
+}
+
+LONGBOW_TEST_CASE(Global, parcHashMap_ForEachValue)
+{
+    PARCHashMap *instance = parcHashMap_Create();
+
+    PARCBuffer *key1 = parcBuffer_WrapCString("key1");
+    PARCBuffer *value1 = parcBuffer_WrapCString("1");
+    PARCBuffer *key2 = parcBuffer_WrapCString("key2");
+    PARCBuffer *value2 = parcBuffer_WrapCString("2");
+
+    parcHashMap_Put(instance, key1, value1);
+    parcHashMap_Put(instance, key2, value2);
+
+    size_t count = 0;
+    PARCBuffer *value;
+    parcHashMap_ForEachValue(instance, value) {
+        assertTrue(value == value1 || value == value2, "Unexpected value in the traversal");
+        count++;
+    }
+    assertTrue(count == 2, "Expected 2 values, actual %zd", count);
+
+    parcBuffer_Release(&key1);
+    parcBuffer_Release(&value1);
+    parcBuffer_Release(&key2);
+    parcBuffer_Release(&value2);
+
+    parcHashMap_Release(&instance);
+}
+
 LONGBOW_TEST_FIXTURE(Static)
 {
     LONGBOW_RUN_TEST_CASE(Static, parcHashMapEntry);
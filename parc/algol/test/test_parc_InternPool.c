@@ -0,0 +1,495 @@
+/*
+ * Copyright (c) 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Patent rights are not granted under this agreement. Patent rights are
+ *       available under FRAND terms.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX or PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * @copyright 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC).  All rights reserved.
+ */
+#include "../parc_InternPool.c"
+
+#include <stdio.h>
+#include <inttypes.h>
+#include <sys/time.h>
+
+#include <LongBow/testing.h>
+#include <LongBow/debugging.h>
+#include <parc/algol/parc_Memory.h>
+#include <parc/algol/parc_SafeMemory.h>
+
+#include <parc/testing/parc_MemoryTesting.h>
+#include <parc/testing/parc_ObjectTesting.h>
+
+LONGBOW_TEST_RUNNER(parc_InternPool)
+{
+    LONGBOW_RUN_TEST_FIXTURE(CreateAcquireRelease);
+    LONGBOW_RUN_TEST_FIXTURE(Global);
+    LONGBOW_RUN_TEST_FIXTURE(Errors);
+    LONGBOW_RUN_TEST_FIXTURE(Performance);
+}
+
+LONGBOW_TEST_RUNNER_SETUP(parc_InternPool)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_RUNNER_TEARDOWN(parc_InternPool)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_FIXTURE(CreateAcquireRelease)
+{
+    LONGBOW_RUN_TEST_CASE(CreateAcquireRelease, CreateRelease);
+    LONGBOW_RUN_TEST_CASE(CreateAcquireRelease, Release_OutstandingInstances);
+}
+
+LONGBOW_TEST_FIXTURE_SETUP(CreateAcquireRelease)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_FIXTURE_TEARDOWN(CreateAcquireRelease)
+{
+    if (!parcMemoryTesting_ExpectedOutstanding(0, "%s leaked memory.", longBowTestCase_GetFullName(testCase))) {
+        return LONGBOW_STATUS_MEMORYLEAK;
+    }
+
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_CASE(CreateAcquireRelease, CreateRelease)
+{
+    PARCInternPool *instance = parcInternPool_Create();
+    assertNotNull(instance, "Expected non-null result from parcInternPool_Create().");
+
+    parcObjectTesting_AssertAcquireReleaseContract(parcInternPool_Acquire, instance);
+
+    parcInternPool_Release(&instance);
+    assertNull(instance, "Expected null result from parcInternPool_Release().");
+}
+
+LONGBOW_TEST_CASE(CreateAcquireRelease, Release_OutstandingInstances)
+{
+    PARCInternPool *pool = parcInternPool_Create();
+    PARCString *string = parcInternPool_InternCString(pool, "outlives the pool");
+
+    parcInternPool_Release(&pool);
+
+    assertTrue(strcmp(parcString_GetString(string), "outlives the pool") == 0,
+               "Expected an interned instance to remain valid after the pool is released.");
+    parcString_Release(&string);
+}
+
+LONGBOW_TEST_FIXTURE(Global)
+{
+    LONGBOW_RUN_TEST_CASE(Global, parcInternPool_Display);
+    LONGBOW_RUN_TEST_CASE(Global, parcInternPool_IsValid);
+    LONGBOW_RUN_TEST_CASE(Global, parcInternPool_InternCString);
+    LONGBOW_RUN_TEST_CASE(Global, parcInternPool_InternString);
+    LONGBOW_RUN_TEST_CASE(Global, parcInternPool_InternBuffer);
+    LONGBOW_RUN_TEST_CASE(Global, parcInternPool_InternBuffer_Independent);
+    LONGBOW_RUN_TEST_CASE(Global, parcInternPool_InternBuffer_CString);
+    LONGBOW_RUN_TEST_CASE(Global, parcInternPool_InternBuffer_Frozen);
+    LONGBOW_RUN_TEST_CASE(Global, parcInternPool_Kinds);
+    LONGBOW_RUN_TEST_CASE(Global, parcInternPool_Grow);
+    LONGBOW_RUN_TEST_CASE(Global, parcInternPool_Purge);
+    LONGBOW_RUN_TEST_CASE(Global, parcInternPool_Statistics);
+    LONGBOW_RUN_TEST_CASE(Global, parcInternPool_Concurrent);
+}
+
+LONGBOW_TEST_FIXTURE_SETUP(Global)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_FIXTURE_TEARDOWN(Global)
+{
+    if (!parcMemoryTesting_ExpectedOutstanding(0, "%s mismanaged memory.", longBowTestCase_GetFullName(testCase))) {
+        return LONGBOW_STATUS_MEMORYLEAK;
+    }
+
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_CASE(Global, parcInternPool_Display)
+{
+    PARCInternPool *pool = parcInternPool_Create();
+    PARCString *string = parcInternPool_InternCString(pool, "name");
+
+    parcInternPool_Display(pool, 0);
+
+    parcString_Release(&string);
+    parcInternPool_Release(&pool);
+}
+
+LONGBOW_TEST_CASE(Global, parcInternPool_IsValid)
+{
+    PARCInternPool *instance = parcInternPool_Create();
+    assertTrue(parcInternPool_IsValid(instance), "Expected parcInternPool_Create to result in a valid instance.");
+
+    parcInternPool_Release(&instance);
+    assertFalse(parcInternPool_IsValid(instance), "Expected parcInternPool_Release to result in an invalid instance.");
+}
+
+LONGBOW_TEST_CASE(Global, parcInternPool_InternCString)
+{
+    PARCInternPool *pool = parcInternPool_Create();
+
+    PARCString *a = parcInternPool_InternCString(pool, "lci:/parc");
+    PARCString *b = parcInternPool_InternCString(pool, "lci:/parc");
+    PARCString *c = parcInternPool_InternCString(pool, "lci:/xerox");
+
+    assertTrue(a == b, "Expected equal strings to be the same instance.");
+    assertTrue(a != c, "Expected different strings to be different instances.");
+    assertTrue(strcmp(parcString_GetString(a), "lci:/parc") == 0, "Expected the content to be preserved.");
+    assertTrue(parcInternPool_Size(pool) == 2, "Expected 2 instances, actual %zu", parcInternPool_Size(pool));
+
+    parcString_Release(&a);
+    parcString_Release(&b);
+    parcString_Release(&c);
+    parcInternPool_Release(&pool);
+}
+
+LONGBOW_TEST_CASE(Global, parcInternPool_InternString)
+{
+    PARCInternPool *pool = parcInternPool_Create();
+
+    PARCString *first = parcString_Create("name");
+    PARCString *second = parcString_Create("name");
+
+    PARCString *a = parcInternPool_InternString(pool, first);
+    PARCString *b = parcInternPool_InternString(pool, second);
+
+    assertTrue(a == first, "Expected the first instance to become the canonical instance.");
+    assertTrue(b == first, "Expected an equal instance to map to the canonical instance.");
+
+    parcString_Release(&first);
+    parcString_Release(&second);
+    parcString_Release(&a);
+    parcString_Release(&b);
+    parcInternPool_Release(&pool);
+}
+
+LONGBOW_TEST_CASE(Global, parcInternPool_InternBuffer)
+{
+    PARCInternPool *pool = parcInternPool_Create();
+
+    PARCBuffer *x = parcBuffer_WrapCString("segment");
+    PARCBuffer *y = parcBuffer_WrapCString("xxsegment");
+    parcBuffer_SetPosition(y, 2);
+
+    PARCBuffer *a = parcInternPool_InternBuffer(pool, x);
+    PARCBuffer *b = parcInternPool_InternBuffer(pool, y);
+
+    assertTrue(a == b, "Expected buffers with the same remaining bytes to be the same instance.");
+    assertTrue(a != x, "Expected the canonical buffer to be a copy.");
+    assertTrue(parcBuffer_Equals(a, x), "Expected the canonical buffer to have the same content.");
+    assertTrue(parcBuffer_Position(y) == 2, "Expected the position of the argument to be unchanged.");
+
+    parcBuffer_Release(&x);
+    parcBuffer_Release(&y);
+    parcBuffer_Release(&a);
+    parcBuffer_Release(&b);
+    parcInternPool_Release(&pool);
+}
+
+LONGBOW_TEST_CASE(Global, parcInternPool_InternBuffer_Independent)
+{
+    PARCInternPool *pool = parcInternPool_Create();
+
+    PARCBuffer *x = parcBuffer_AllocateCString("segment");
+    PARCBuffer *a = parcInternPool_InternBuffer(pool, x);
+
+    parcBuffer_PutUint8(x, 'S');
+
+    assertTrue(parcBuffer_GetAtIndex(a, 0) == 's', "Expected the canonical buffer to be unaffected by changes to the argument.");
+
+    parcBuffer_Release(&x);
+    parcBuffer_Release(&a);
+    parcInternPool_Release(&pool);
+}
+
+LONGBOW_TEST_CASE(Global, parcInternPool_InternBuffer_CString)
+{
+    PARCInternPool *pool = parcInternPool_Create();
+
+    PARCBuffer *x = parcBuffer_WrapCString("xxsegmentyy");
+    parcBuffer_SetPosition(x, 2);
+    parcBuffer_SetLimit(x, 9);
+
+    PARCBuffer *a = parcInternPool_InternBuffer(pool, x);
+
+    assertTrue(strcmp(parcBuffer_Overlay(a, 0), "segment") == 0, "Expected the canonical buffer to be nul-terminated.");
+    assertTrue(parcBuffer_Remaining(a) == 7, "Expected 7 remaining bytes, actual %zu", parcBuffer_Remaining(a));
+
+    parcBuffer_Release(&x);
+    parcBuffer_Release(&a);
+    parcInternPool_Release(&pool);
+}
+
+LONGBOW_TEST_CASE(Global, parcInternPool_InternBuffer_Frozen)
+{
+    PARCInternPool *pool = parcInternPool_Create();
+    PARCBuffer *x = parcBuffer_WrapCString("segment");
+
+    PARCBuffer *canonical = parcInternPool_InternBuffer(pool, x);
+    assertTrue(parcBuffer_IsFrozen(canonical), "Expected the canonical buffer to be frozen.");
+    assertTrue(parcBuffer_HashCode(canonical) == parcBuffer_HashCode(x),
+               "Expected the canonical buffer to have the same hash code as its content.");
+
+    parcBuffer_Release(&canonical);
+    parcBuffer_Release(&x);
+    parcInternPool_Release(&pool);
+}
+
+LONGBOW_TEST_CASE(Global, parcInternPool_Kinds)
+{
+    PARCInternPool *pool = parcInternPool_Create();
+
+    PARCBuffer *x = parcBuffer_WrapCString("name");
+    PARCBuffer *buffer = parcInternPool_InternBuffer(pool, x);
+    PARCString *string = parcInternPool_InternCString(pool, "name");
+
+    assertTrue((void *) buffer != (void *) string, "Expected a string and a buffer with the same content to be distinct.");
+    assertTrue(parcInternPool_Size(pool) == 2, "Expected 2 instances, actual %zu", parcInternPool_Size(pool));
+
+    parcBuffer_Release(&x);
+    parcBuffer_Release(&buffer);
+    parcString_Release(&string);
+    parcInternPool_Release(&pool);
+}
+
+LONGBOW_TEST_CASE(Global, parcInternPool_Grow)
+{
+    PARCInternPool *pool = parcInternPool_Create();
+
+    size_t count = 10 * _PARCInternPool_InitialBucketCount;
+    PARCString **strings = parcMemory_Allocate(count * sizeof(PARCString *));
+    for (size_t i = 0; i < count; i++) {
+        char name[32];
+        sprintf(name, "name-%zu", i);
+        strings[i] = parcInternPool_InternCString(pool, name);
+    }
+
+    assertTrue(parcInternPool_Size(pool) == count, "Expected %zu instances, actual %zu", count, parcInternPool_Size(pool));
+    for (size_t i = 0; i < count; i++) {
+        char name[32];
+        sprintf(name, "name-%zu", i);
+        PARCString *again = parcInternPool_InternCString(pool, name);
+        assertTrue(again == strings[i], "Expected %s to be found after the pool grew.", name);
+        parcString_Release(&again);
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        parcString_Release(&strings[i]);
+    }
+    parcMemory_Deallocate((void **) &strings);
+    parcInternPool_Release(&pool);
+}
+
+LONGBOW_TEST_CASE(Global, parcInternPool_Purge)
+{
+    PARCInternPool *pool = parcInternPool_Create();
+
+    PARCString *kept = parcInternPool_InternCString(pool, "kept");
+    PARCString *dropped = parcInternPool_InternCString(pool, "dropped");
+    parcString_Release(&dropped);
+
+    size_t count = parcInternPool_Purge(pool);
+
+    assertTrue(count == 1, "Expected 1 instance to be dropped, actual %zu", count);
+    assertTrue(parcInternPool_Size(pool) == 1, "Expected 1 instance to remain, actual %zu", parcInternPool_Size(pool));
+
+    PARCString *again = parcInternPool_InternCString(pool, "kept");
+    assertTrue(again == kept, "Expected the referenced instance to be kept.");
+
+    parcString_Release(&again);
+    parcString_Release(&kept);
+    parcInternPool_Release(&pool);
+}
+
+LONGBOW_TEST_CASE(Global, parcInternPool_Statistics)
+{
+    PARCInternPool *pool = parcInternPool_Create();
+
+    PARCString *a = parcInternPool_InternCString(pool, "12345");
+    PARCString *b = parcInternPool_InternCString(pool, "12345");
+    PARCString *c = parcInternPool_InternCString(pool, "12345");
+    PARCString *d = parcInternPool_InternCString(pool, "other");
+
+    assertTrue(parcInternPool_GetLookups(pool) == 4, "Expected 4 lookups, actual %" PRIu64, parcInternPool_GetLookups(pool));
+    assertTrue(parcInternPool_GetHits(pool) == 2, "Expected 2 hits, actual %" PRIu64, parcInternPool_GetHits(pool));
+    assertTrue(parcInternPool_GetBytesSaved(pool) == 10, "Expected 10 bytes saved, actual %" PRIu64, parcInternPool_GetBytesSaved(pool));
+
+    parcString_Release(&a);
+    parcString_Release(&b);
+    parcString_Release(&c);
+    parcString_Release(&d);
+    parcInternPool_Release(&pool);
+}
+
+#define _ConcurrentThreads 4
+#define _ConcurrentNames 1000
+
+static void *
+_internNames(void *arg)
+{
+    PARCInternPool *pool = arg;
+    for (int i = 0; i < _ConcurrentNames; i++) {
+        char name[32];
+        sprintf(name, "name-%d", i);
+        PARCString *string = parcInternPool_InternCString(pool, name);
+        parcString_Release(&string);
+    }
+    return NULL;
+}
+
+LONGBOW_TEST_CASE(Global, parcInternPool_Concurrent)
+{
+    PARCInternPool *pool = parcInternPool_Create();
+
+    pthread_t threads[_ConcurrentThreads];
+    for (int i = 0; i < _ConcurrentThreads; i++) {
+        pthread_create(&threads[i], NULL, _internNames, pool);
+    }
+    for (int i = 0; i < _ConcurrentThreads; i++) {
+        pthread_join(threads[i], NULL);
+    }
+
+    assertTrue(parcInternPool_Size(pool) == _ConcurrentNames,
+               "Expected %d instances, actual %zu", _ConcurrentNames, parcInternPool_Size(pool));
+    assertTrue(parcInternPool_GetHits(pool) == (_ConcurrentThreads - 1) * _ConcurrentNames,
+               "Expected %d hits, actual %" PRIu64, (_ConcurrentThreads - 1) * _ConcurrentNames, parcInternPool_GetHits(pool));
+
+    parcInternPool_Release(&pool);
+}
+
+LONGBOW_TEST_FIXTURE(Errors)
+{
+    LONGBOW_RUN_TEST_CASE(Errors, parcInternPool_InternBuffer_Modify);
+}
+
+typedef struct {
+    PARCInternPool *pool;
+    PARCBuffer *canonical;
+} _InternPoolClipBoard;
+
+LONGBOW_TEST_FIXTURE_SETUP(Errors)
+{
+    _InternPoolClipBoard *testData = calloc(1, sizeof(_InternPoolClipBoard));
+    testData->pool = parcInternPool_Create();
+
+    PARCBuffer *name = parcBuffer_WrapCString("segment");
+    testData->canonical = parcInternPool_InternBuffer(testData->pool, name);
+    parcBuffer_Release(&name);
+
+    longBowTestCase_SetClipBoardData(testCase, testData);
+
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_FIXTURE_TEARDOWN(Errors)
+{
+    _InternPoolClipBoard *testData = longBowTestCase_GetClipBoardData(testCase);
+    parcBuffer_Release(&testData->canonical);
+    parcInternPool_Release(&testData->pool);
+    free(testData);
+
+    if (!parcMemoryTesting_ExpectedOutstanding(0, "%s mismanaged memory.", longBowTestCase_GetFullName(testCase))) {
+        return LONGBOW_STATUS_MEMORYLEAK;
+    }
+
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_CASE_EXPECTS(Errors, parcInternPool_InternBuffer_Modify, .event = &LongBowTrapUnexpectedStateEvent)
+{
+    _InternPoolClipBoard *testData = longBowTestCase_GetClipBoardData(testCase);
+
+    parcBuffer_PutUint8(testData->canonical, 'S'); // this will fail.
+}
+
+LONGBOW_TEST_FIXTURE_OPTIONS(Performance, .enabled = false)
+{
+    LONGBOW_RUN_TEST_CASE(Performance, parcInternPool_Equals);
+}
+
+LONGBOW_TEST_FIXTURE_SETUP(Performance)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_FIXTURE_TEARDOWN(Performance)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_CASE(Performance, parcInternPool_Equals)
+{
+    size_t count = 1000000;
+    const char *name = "lci:/parc/algol/a-moderately-long-name-segment";
+
+    PARCInternPool *pool = parcInternPool_Create();
+    PARCBuffer *plainX = parcBuffer_WrapCString((char *) name);
+    PARCBuffer *plainY = parcBuffer_WrapCString((char *) name);
+    PARCBuffer *internedX = parcInternPool_InternBuffer(pool, plainX);
+    PARCBuffer *internedY = parcInternPool_InternBuffer(pool, plainY);
+
+    struct timeval start, end, plain, interned;
+    size_t matches = 0;
+
+    gettimeofday(&start, NULL);
+    for (size_t i = 0; i < count; i++) {
+        matches += parcBuffer_Equals(plainX, plainY);
+    }
+    gettimeofday(&end, NULL);
+    timersub(&end, &start, &plain);
+
+    gettimeofday(&start, NULL);
+    for (size_t i = 0; i < count; i++) {
+        matches += parcBuffer_Equals(internedX, internedY);
+    }
+    gettimeofday(&end, NULL);
+    timersub(&end, &start, &interned);
+
+    printf("parcBuffer_Equals x %zu: plain %ld.%06ld s, interned %ld.%06ld s (%zu matches)\n", count,
+           (long) plain.tv_sec, (long) plain.tv_usec, (long) interned.tv_sec, (long) interned.tv_usec, matches);
+    parcInternPool_Display(pool, 0);
+
+    parcBuffer_Release(&internedX);
+    parcBuffer_Release(&internedY);
+    parcBuffer_Release(&plainX);
+    parcBuffer_Release(&plainY);
+    parcInternPool_Release(&pool);
+}
+
+int
+main(int argc, char *argv[argc])
+{
+    LongBowRunner *testRunner = LONGBOW_TEST_RUNNER_CREATE(parc_InternPool);
+    int exitStatus = longBowMain(argc, argv, testRunner, NULL);
+    longBowTestRunner_Destroy(&testRunner);
+    exit(exitStatus);
+}
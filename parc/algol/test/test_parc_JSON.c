@@ -85,6 +85,7 @@ LONGBOW_TEST_FIXTURE(JSON)
     LONGBOW_RUN_TEST_CASE(JSON, parcJSON_GetByPath_DeadEndPath);
     LONGBOW_RUN_TEST_CASE(JSON, parcJSON_ParseString);
     LONGBOW_RUN_TEST_CASE(JSON, parcJSON_ParseBuffer_WithExcess);
+    LONGBOW_RUN_TEST_CASE(JSON, parcJSON_ParseBufferWithInternPool);
     LONGBOW_RUN_TEST_CASE(JSON, parcJSON_Display);
     LONGBOW_RUN_TEST_CASE(JSON, parcJSON_AddString);
     LONGBOW_RUN_TEST_CASE(JSON, parcJSON_AddObject);
@@ -510,6 +511,28 @@ LONGBOW_TEST_CASE(JSON, parcJSON_ParseString)
     parcJSON_Release(&json);
 }
 
+LONGBOW_TEST_CASE(JSON, parcJSON_ParseBufferWithInternPool)
+{
+    PARCInternPool *pool = parcInternPool_Create();
+
+    PARCBuffer *buffer1 = parcBuffer_WrapCString("{ \"host\" : \"alpha\", \"port\" : 1 }");
+    PARCBuffer *buffer2 = parcBuffer_WrapCString("{ \"host\" : \"beta\", \"port\" : 2 }");
+    PARCJSON *json1 = parcJSON_ParseBufferWithInternPool(buffer1, pool);
+    PARCJSON *json2 = parcJSON_ParseBufferWithInternPool(buffer2, pool);
+
+    PARCBuffer *name1 = parcJSONPair_GetName(parcJSON_GetPairByName(json1, "host"));
+    PARCBuffer *name2 = parcJSONPair_GetName(parcJSON_GetPairByName(json2, "host"));
+    assertTrue(name1 == name2, "Expected both documents to share the interned name.");
+    assertTrue(parcInternPool_Size(pool) == 2, "Expected 2 interned names, actual %zu", parcInternPool_Size(pool));
+    assertTrue(parcInternPool_GetHits(pool) == 2, "Expected 2 hits, actual %" PRIu64, parcInternPool_GetHits(pool));
+
+    parcJSON_Release(&json1);
+    parcJSON_Release(&json2);
+    parcBuffer_Release(&buffer1);
+    parcBuffer_Release(&buffer2);
+    parcInternPool_Release(&pool);
+}
+
 LONGBOW_TEST_CASE(JSON, parcJSON_ParseBuffer_WithExcess)
 {
     char *string = "{ \"string\" : \"string\", \"null\" : null, \"true\" : true, \"false\" : false, \"integer\" : 31415, \"float\" : 3.141500, \"array\" : [ null, false, true, 31415, \"string\", [ null, false, true, 31415, \"string\" ], {  } ] }Xhowdy";
@@ -66,6 +66,7 @@ LONGBOW_TEST_FIXTURE(JSONPair)
 {
     LONGBOW_RUN_TEST_CASE(JSONPair, parcJSONPair_CreateAcquireRelease);
     LONGBOW_RUN_TEST_CASE(JSONPair, parcJSONPair_BuildString);
+    LONGBOW_RUN_TEST_CASE(JSONPair, parcJSONPair_BuildString_EscapedName);
     LONGBOW_RUN_TEST_CASE(JSONPair, parcJSONPair_ToString);
     LONGBOW_RUN_TEST_CASE(JSONPair, parcJSONPair_Display);
     LONGBOW_RUN_TEST_CASE(JSONPair, parcJSONPair_Equals);
@@ -178,6 +179,25 @@ LONGBOW_TEST_CASE(JSONPair, parcJSONPair_BuildString)
     parcJSONPair_Release(&pair);
 }
 
+LONGBOW_TEST_CASE(JSONPair, parcJSONPair_BuildString_EscapedName)
+{
+    PARCJSONPair *pair = parcJSONPair_CreateFromInteger("a \"quoted\"\tname", 1);
+
+    PARCBufferComposer *composer = parcBufferComposer_Create();
+    parcJSONPair_BuildString(pair, composer, true);
+    PARCBuffer *tempBuffer = parcBufferComposer_ProduceBuffer(composer);
+    char *actual = parcBuffer_ToString(tempBuffer);
+    parcBuffer_Release(&tempBuffer);
+    parcBufferComposer_Release(&composer);
+
+    char *expected = "\"a \\\"quoted\\\"\\tname\":1";
+    assertTrue(strcmp(expected, actual) == 0,
+               "Expected '%s' actual '%s'", expected, actual);
+    parcMemory_Deallocate((void **) &actual);
+
+    parcJSONPair_Release(&pair);
+}
+
 LONGBOW_TEST_CASE(JSONPair, parcJSONPair_ToString)
 {
     PARCBuffer *name = parcBuffer_WrapCString("name");
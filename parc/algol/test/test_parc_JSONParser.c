@@ -129,6 +129,8 @@ LONGBOW_TEST_FIXTURE(JSONParse)
     LONGBOW_RUN_TEST_CASE(JSONParse, parcJSONString_Parser);
     LONGBOW_RUN_TEST_CASE(JSONParse, parcJSONParser_RequireString_Fail);
     LONGBOW_RUN_TEST_CASE(JSONParse, parcJSONString_Parser_Quoted);
+    LONGBOW_RUN_TEST_CASE(JSONParse, parcJSONString_Parser_Long);
+    LONGBOW_RUN_TEST_CASE(JSONParse, parcJSONString_Parser_Invalid);
     LONGBOW_RUN_TEST_CASE(JSONParse, parcJSON_Parse);
 
     LONGBOW_RUN_TEST_CASE(JSONParse, parcJSON_ParseFile);
@@ -204,6 +206,64 @@ LONGBOW_TEST_CASE(JSONParse, parcJSONString_Parser_Quoted)
     parcBuffer_Release(&buffer);
 }
 
+LONGBOW_TEST_CASE(JSONParse, parcJSONString_Parser_Long)
+{
+    // Put an escape sequence at every offset across the 16 and 32 byte boundaries of a long string.
+    for (size_t offset = 0; offset < 70; offset++) {
+        char input[100];
+        char expected[100];
+        memset(input, 'x', sizeof(input));
+        memset(expected, 'x', sizeof(expected));
+        input[0] = '"';
+        memcpy(&input[1 + offset], "\\n", 2);
+        expected[offset] = '\n';
+        memcpy(&input[80], "\xC3\xA9\" tail", 9);
+        memcpy(&expected[78], "\xC3\xA9", 3);
+
+        PARCBuffer *buffer = parcBuffer_WrapCString(input);
+        PARCJSONParser *parser = parcJSONParser_Create(buffer);
+
+        PARCBuffer *actual = parcJSONParser_ParseString(parser);
+        assertNotNull(actual, "Expected the string with an escape at offset %zu to parse", offset);
+        assertTrue(parcBuffer_Remaining(actual) == strlen(expected),
+                   "Expected %zu bytes, actual %zu", strlen(expected), parcBuffer_Remaining(actual));
+        assertTrue(memcmp(parcBuffer_Overlay(actual, 0), expected, strlen(expected)) == 0,
+                   "Expected the escape at offset %zu to be replaced", offset);
+        assertTrue(parcJSONParser_PeekNextChar(parser) == 't',
+                   "Expected the parser to be positioned after the closing quote");
+
+        parcBuffer_Release(&actual);
+        parcJSONParser_Release(&parser);
+        parcBuffer_Release(&buffer);
+    }
+}
+
+LONGBOW_TEST_CASE(JSONParse, parcJSONString_Parser_Invalid)
+{
+    char *bad[] = {
+        "\"0123456789abcdef0123456789abcdef\x01\"",       // A control character after the first 32 bytes.
+        "\"0123456789abcdef0123456789abcdef\x7F\"",
+        "\"0123456789abcdef0123456789abcdef",             // Not terminated.
+        "\"0123456789abcdef0123456789abcdef\\",           // An escape that is not terminated.
+        "\"0123456789abcdef\xC0\xAF\"",                   // Overlong encoding of '/'.
+        "\"0123456789abcde\xED\xA0\x80\"",                // A surrogate across a block boundary.
+        "\"caf\xC3\"",                                    // Truncated sequence.
+        "\"\\n\xFF\"",                                    // Escaped and invalid.
+        NULL
+    };
+
+    for (int i = 0; bad[i] != NULL; i++) {
+        PARCBuffer *buffer = parcBuffer_WrapCString(bad[i]);
+        PARCJSONParser *parser = parcJSONParser_Create(buffer);
+
+        PARCBuffer *actual = parcJSONParser_ParseString(parser);
+        assertNull(actual, "Expected bad string %d to fail", i);
+
+        parcJSONParser_Release(&parser);
+        parcBuffer_Release(&buffer);
+    }
+}
+
 LONGBOW_TEST_CASE(JSONParse, parcJSON_Parse)
 {
     char *expected = "{ \"string\" : \"string\", \"null\" : null, \"true\" : true, \"false\" : false, \"integer\" : 31415, \"float\" : 3.141500, \"array\" : [ null, false, true, 31415, \"string\", [ null, false, true, 31415, \"string\" ], {  } ] }";
@@ -38,6 +38,9 @@
 #include "../parc_ArrayList.h"
 #include "../parc_SafeMemory.h"
 #include "../parc_Memory.h"
+#include "../parc_StdlibMemory.h"
+
+#include <sys/time.h>
 
 #include <parc/testing/parc_ObjectTesting.h>
 
@@ -50,6 +53,7 @@ LONGBOW_TEST_RUNNER(parc_JSONValue)
     LONGBOW_RUN_TEST_FIXTURE(JSONValue_CreateAcquireRelease);
     LONGBOW_RUN_TEST_FIXTURE(JSONValue);
     LONGBOW_RUN_TEST_FIXTURE(JSONValueParsing);
+    LONGBOW_RUN_TEST_FIXTURE(Performance);
 }
 
 // The Test Runner calls this function once before any Test Fixtures are run.
@@ -789,6 +793,7 @@ LONGBOW_TEST_FIXTURE(JSONValueParsing)
     LONGBOW_RUN_TEST_CASE(JSONValueParsing, _parcJSONValue_FalseParser);
     LONGBOW_RUN_TEST_CASE(JSONValueParsing, _parcJSONValue_FalseParser_Bad);
     LONGBOW_RUN_TEST_CASE(JSONValueParsing, _parcJSONValue_StringParser);
+    LONGBOW_RUN_TEST_CASE(JSONValueParsing, _parcJSONValue_StringParser_Long);
     LONGBOW_RUN_TEST_CASE(JSONValueParsing, parcJSONValue_ObjectParser);
     LONGBOW_RUN_TEST_CASE(JSONValueParsing, parcJSONValue_ObjectParser_Bad_Pair);
     LONGBOW_RUN_TEST_CASE(JSONValueParsing, parcJSONValue_ObjectParser_Bad_Pair2);
@@ -942,11 +947,43 @@ LONGBOW_TEST_CASE(JSONValueParsing, _parcJSONValue_StringParser)
     parcBuffer_Release(&buffer);
 }
 
+LONGBOW_TEST_CASE(JSONValueParsing, _parcJSONValue_StringParser_Long)
+{
+    // Every special character at every offset across the 16 and 32 byte boundaries must survive a round trip.
+    const char *specials = "\"\\\b\f\n\r\t/";
+    for (const char *special = specials; *special != 0; special++) {
+        for (size_t offset = 0; offset < 70; offset++) {
+            char string[80];
+            memset(string, 'x', sizeof(string));
+            string[offset] = *special;
+            memcpy(&string[75], "\xE2\x82\xAC", 4);
+
+            PARCJSONValue *value = parcJSONValue_CreateFromCString(string);
+            char *json = parcJSONValue_ToString(value);
+
+            PARCBuffer *buffer = parcBuffer_WrapCString(json);
+            PARCJSONParser *parser = parcJSONParser_Create(buffer);
+            PARCJSONValue *actual = _parcJSONValue_StringParser(parser);
+
+            assertTrue(parcJSONValue_Equals(value, actual),
+                       "Expected '%s' to round trip with 0x%02x at offset %zu", json, *special, offset);
+
+            parcJSONValue_Release(&actual);
+            parcJSONParser_Release(&parser);
+            parcBuffer_Release(&buffer);
+            parcMemory_Deallocate((void **) &json);
+            parcJSONValue_Release(&value);
+        }
+    }
+}
+
 LONGBOW_TEST_CASE(JSONValueParsing, _parcJSONValue_StringParser_BAD)
 {
     char *bad[] = {
         "\"\t\"",
         "\"",
+        "\"\xC0\xAF\"",
+        "\"0123456789abcdef0123456789abcde\xF4\x90\x80\x80\"",
         NULL
     };
 
@@ -1366,6 +1403,78 @@ LONGBOW_TEST_CASE(Static, _parseOptionalExponent)
     }
 }
 
+LONGBOW_TEST_FIXTURE_OPTIONS(Performance, .enabled = false)
+{
+    LONGBOW_RUN_TEST_CASE(Performance, StringParseAndBuild);
+}
+
+LONGBOW_TEST_FIXTURE_SETUP(Performance)
+{
+    parcMemory_SetInterface(&PARCStdlibMemoryAsPARCMemory);
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_FIXTURE_TEARDOWN(Performance)
+{
+    parcMemory_SetInterface(&PARCSafeMemoryAsPARCMemory);
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+static double
+_seconds(const struct timeval *start, const struct timeval *end)
+{
+    struct timeval elapsed;
+    timersub(end, start, &elapsed);
+    return elapsed.tv_sec + elapsed.tv_usec / 1000000.0;
+}
+
+LONGBOW_TEST_CASE(Performance, StringParseAndBuild)
+{
+    // A 64 KiB string of text with a newline and a non-ASCII character in every line of 80 bytes.
+    size_t length = 64 * 1024;
+    char *string = parcMemory_Allocate(length + 1);
+    for (size_t i = 0; i < length; i++) {
+        string[i] = (char) ('a' + i % 26);
+    }
+    for (size_t i = 0; i + 80 <= length; i += 80) {
+        memcpy(&string[i + 76], "\xC3\xA9\n", 3);
+    }
+    string[length] = 0;
+
+    PARCJSONValue *value = parcJSONValue_CreateFromCString(string);
+    char *json = parcJSONValue_ToString(value);
+    PARCBuffer *input = parcBuffer_WrapCString(json);
+
+    int rounds = 2000;
+    struct timeval start, end;
+
+    gettimeofday(&start, NULL);
+    for (int round = 0; round < rounds; round++) {
+        PARCBufferComposer *composer = parcBufferComposer_Create();
+        parcJSONValue_BuildString(value, composer, false);
+        parcBufferComposer_Release(&composer);
+    }
+    gettimeofday(&end, NULL);
+    printf("Build %.0f MB/s\n", rounds * (double) length / _seconds(&start, &end) / 1000000.0);
+
+    gettimeofday(&start, NULL);
+    for (int round = 0; round < rounds; round++) {
+        parcBuffer_Rewind(input);
+        PARCJSONParser *parser = parcJSONParser_Create(input);
+        PARCJSONValue *actual = _parcJSONValue_StringParser(parser);
+        assertNotNull(actual, "Expected the string to parse");
+        parcJSONValue_Release(&actual);
+        parcJSONParser_Release(&parser);
+    }
+    gettimeofday(&end, NULL);
+    printf("Parse %.0f MB/s\n", rounds * (double) length / _seconds(&start, &end) / 1000000.0);
+
+    parcBuffer_Release(&input);
+    parcMemory_Deallocate((void **) &json);
+    parcJSONValue_Release(&value);
+    parcMemory_Deallocate((void **) &string);
+}
+
 int
 main(int argc, char *argv[])
 {
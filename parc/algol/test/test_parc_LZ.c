@@ -0,0 +1,510 @@
+/*
+ * Copyright (c) 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Patent rights are not granted under this agreement. Patent rights are
+ *       available under FRAND terms.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX or PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * @copyright 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC).  All rights reserved.
+ */
+// Include the file(s) containing the functions to be tested.
+// This permits internal static functions to be visible to this Test Framework.
+#include "../parc_LZ.c"
+
+#include <stdio.h>
+#include <sys/time.h>
+
+#include <LongBow/testing.h>
+#include <LongBow/debugging.h>
+#include <parc/algol/parc_Memory.h>
+#include <parc/algol/parc_SafeMemory.h>
+
+#include <parc/testing/parc_MemoryTesting.h>
+#include <parc/testing/parc_ObjectTesting.h>
+
+static uint64_t
+_nextRandom(uint64_t *state)
+{
+    *state ^= *state << 13;
+    *state ^= *state >> 7;
+    *state ^= *state << 17;
+    return *state;
+}
+
+/*
+ * Fill `array` with lines in the format of `parcLogFormatSyslog_FormatEntry`.
+ */
+static void
+_fillLogLines(size_t length, uint8_t array[length])
+{
+    static const char *levels[] = { "Info", "Debug", "Notice", "Warning", "Error" };
+    static const char *messages[] = {
+        "connection %d accepted from 10.0.%d.%d",
+        "interest for ccnx:/parc/chunk=%d satisfied in %d us by face %d",
+        "content object store: %d objects, %d bytes, %d evictions",
+        "timer %d fired %d ms late on thread %d",
+    };
+    uint64_t state = 0x5DEECE66DULL;
+    long seconds = 1433160000;
+    long microseconds = 0;
+
+    size_t offset = 0;
+    while (offset < length) {
+        char message[128];
+        uint64_t r = _nextRandom(&state);
+        snprintf(message, sizeof(message), messages[r % 4], (int) (r >> 8) % 10000, (int) (r >> 24) % 256, (int) (r >> 32) % 64);
+
+        microseconds += (long) ((r >> 40) % 5000);
+        seconds += microseconds / 1000000;
+        microseconds %= 1000000;
+
+        char line[256];
+        int lineLength = snprintf(line, sizeof(line), "<%s> 1 %ld.%06ld hostname.parc.com metis %d %d [ %s ]\n",
+                                  levels[(r >> 16) % 5], seconds, microseconds, 4242, (int) (r >> 48) % 100, message);
+        size_t count = (size_t) lineLength < length - offset ? (size_t) lineLength : length - offset;
+        memcpy(array + offset, line, count);
+        offset += count;
+    }
+}
+
+static void
+_fillRandom(size_t length, uint8_t array[length])
+{
+    uint64_t state = 88172645463325252ULL;
+    for (size_t i = 0; i < length; i++) {
+        array[i] = (uint8_t) _nextRandom(&state);
+    }
+}
+
+/*
+ * Compress and decompress `length` bytes at `input` and assert that the result is the same.
+ * Return the compressed length.
+ */
+static size_t
+_assertRoundTrip(PARCLZCompressor *compressor, size_t length, const uint8_t *input)
+{
+    size_t bound = parcLZ_CompressBound(length);
+    uint8_t *compressed = parcMemory_Allocate(bound);
+    uint8_t *decompressed = parcMemory_Allocate(length + 1);
+
+    size_t compressedLength = parcLZCompressor_Compress(compressor, length, input, bound, compressed);
+    assertTrue(compressedLength > 0 && compressedLength <= bound,
+               "Expected a compressed length from 1 to %zu, got %zu", bound, compressedLength);
+
+    size_t decompressedLength = parcLZ_Decompress(compressedLength, compressed, length + 1, decompressed);
+    assertTrue(decompressedLength == length, "Expected %zu bytes, got %zu (level %d)",
+               length, decompressedLength, parcLZCompressor_GetLevel(compressor));
+    assertTrue(memcmp(input, decompressed, length) == 0, "Expected the original bytes (level %d, length %zu)",
+               parcLZCompressor_GetLevel(compressor), length);
+
+    parcMemory_Deallocate(&decompressed);
+    parcMemory_Deallocate(&compressed);
+    return compressedLength;
+}
+
+LONGBOW_TEST_RUNNER(parc_LZ)
+{
+    LONGBOW_RUN_TEST_FIXTURE(CreateAcquireRelease);
+    LONGBOW_RUN_TEST_FIXTURE(Global);
+    LONGBOW_RUN_TEST_FIXTURE(Errors);
+    LONGBOW_RUN_TEST_FIXTURE(Performance);
+}
+
+LONGBOW_TEST_RUNNER_SETUP(parc_LZ)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_RUNNER_TEARDOWN(parc_LZ)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_FIXTURE(CreateAcquireRelease)
+{
+    LONGBOW_RUN_TEST_CASE(CreateAcquireRelease, CreateRelease);
+}
+
+LONGBOW_TEST_FIXTURE_SETUP(CreateAcquireRelease)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_FIXTURE_TEARDOWN(CreateAcquireRelease)
+{
+    if (!parcMemoryTesting_ExpectedOutstanding(0, "%s leaked memory.", longBowTestCase_GetFullName(testCase))) {
+        return LONGBOW_STATUS_MEMORYLEAK;
+    }
+
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_CASE(CreateAcquireRelease, CreateRelease)
+{
+    PARCLZCompressor *compressor = parcLZCompressor_Create(PARCLZ_LevelDefault);
+    assertNotNull(compressor, "Expected non-null result from parcLZCompressor_Create");
+    parcLZCompressor_AssertValid(compressor);
+    assertTrue(parcLZCompressor_GetLevel(compressor) == PARCLZ_LevelDefault, "Expected the level given to Create");
+
+    parcObjectTesting_AssertAcquireReleaseContract(parcLZCompressor_Acquire, compressor);
+
+    parcLZCompressor_Release(&compressor);
+    assertNull(compressor, "Expected parcLZCompressor_Release to set the pointer to NULL");
+}
+
+LONGBOW_TEST_FIXTURE(Global)
+{
+    LONGBOW_RUN_TEST_CASE(Global, parcLZ_RoundTrip);
+    LONGBOW_RUN_TEST_CASE(Global, parcLZ_RoundTrip_Short);
+    LONGBOW_RUN_TEST_CASE(Global, parcLZ_Compress_LogLines);
+    LONGBOW_RUN_TEST_CASE(Global, parcLZ_Compress_Random);
+    LONGBOW_RUN_TEST_CASE(Global, parcLZ_Compress_Levels);
+    LONGBOW_RUN_TEST_CASE(Global, parcLZ_Compress_Independent);
+    LONGBOW_RUN_TEST_CASE(Global, parcLZ_Compress_TooSmall);
+    LONGBOW_RUN_TEST_CASE(Global, parcLZ_Decompress_Truncated);
+    LONGBOW_RUN_TEST_CASE(Global, parcLZ_Decompress_Malformed);
+    LONGBOW_RUN_TEST_CASE(Global, parcLZ_Decompress_TooSmall);
+}
+
+LONGBOW_TEST_FIXTURE_SETUP(Global)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_FIXTURE_TEARDOWN(Global)
+{
+    if (!parcMemoryTesting_ExpectedOutstanding(0, "%s leaked memory.", longBowTestCase_GetFullName(testCase))) {
+        return LONGBOW_STATUS_MEMORYLEAK;
+    }
+
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_CASE(Global, parcLZ_RoundTrip)
+{
+    size_t length = 200000;
+    uint8_t *input = parcMemory_Allocate(length);
+
+    for (int level = PARCLZ_LevelFastest; level <= PARCLZ_LevelBest; level++) {
+        PARCLZCompressor *compressor = parcLZCompressor_Create(level);
+
+        _fillLogLines(length, input);
+        _assertRoundTrip(compressor, length, input);
+
+        _fillRandom(length, input);
+        _assertRoundTrip(compressor, length, input);
+
+        // Long runs: matches at offset 1, and matches longer than 255 + 15 bytes.
+        memset(input, 'a', length);
+        memset(input + length / 2, 'b', 1000);
+        _assertRoundTrip(compressor, length, input);
+
+        // Random data repeated at the largest offset, and just beyond it.
+        for (size_t distance = _MaximumOffset; distance <= _MaximumOffset + 1; distance++) {
+            _fillRandom(distance, input);
+            memcpy(input + distance, input, distance);
+            _assertRoundTrip(compressor, 2 * distance, input);
+        }
+
+        parcLZCompressor_Release(&compressor);
+    }
+
+    parcMemory_Deallocate(&input);
+}
+
+LONGBOW_TEST_CASE(Global, parcLZ_RoundTrip_Short)
+{
+    uint8_t input[64];
+    _fillLogLines(sizeof(input), input);
+    memcpy(input + 32, input, 32);
+
+    PARCLZCompressor *compressor = parcLZCompressor_Create(PARCLZ_LevelDefault);
+    for (size_t length = 0; length <= sizeof(input); length++) {
+        _assertRoundTrip(compressor, length, input);
+    }
+    parcLZCompressor_Release(&compressor);
+}
+
+LONGBOW_TEST_CASE(Global, parcLZ_Compress_LogLines)
+{
+    size_t length = 64 * 1024;
+    uint8_t *input = parcMemory_Allocate(length);
+    _fillLogLines(length, input);
+
+    PARCLZCompressor *compressor = parcLZCompressor_Create(PARCLZ_LevelFastest);
+    size_t compressedLength = _assertRoundTrip(compressor, length, input);
+    assertTrue(compressedLength < length / 2, "Expected log lines to compress to less than half, got %zu of %zu",
+               compressedLength, length);
+    parcLZCompressor_Release(&compressor);
+
+    parcMemory_Deallocate(&input);
+}
+
+LONGBOW_TEST_CASE(Global, parcLZ_Compress_Random)
+{
+    size_t length = 64 * 1024;
+    uint8_t *input = parcMemory_Allocate(length);
+    _fillRandom(length, input);
+
+    PARCLZCompressor *compressor = parcLZCompressor_Create(PARCLZ_LevelBest);
+    size_t compressedLength = _assertRoundTrip(compressor, length, input);
+    assertTrue(compressedLength <= parcLZ_CompressBound(length), "Expected at most the bound");
+    assertTrue(compressedLength > length, "Expected random bytes not to compress, got %zu of %zu", compressedLength, length);
+    parcLZCompressor_Release(&compressor);
+
+    parcMemory_Deallocate(&input);
+}
+
+LONGBOW_TEST_CASE(Global, parcLZ_Compress_Levels)
+{
+    size_t length = 256 * 1024;
+    uint8_t *input = parcMemory_Allocate(length);
+    _fillLogLines(length, input);
+
+    PARCLZCompressor *fastest = parcLZCompressor_Create(PARCLZ_LevelFastest);
+    PARCLZCompressor *best = parcLZCompressor_Create(PARCLZ_LevelBest);
+    size_t fastestLength = _assertRoundTrip(fastest, length, input);
+    size_t bestLength = _assertRoundTrip(best, length, input);
+    assertTrue(bestLength < fastestLength, "Expected level 9 to compress better than level 1, got %zu and %zu",
+               bestLength, fastestLength);
+    parcLZCompressor_Release(&best);
+    parcLZCompressor_Release(&fastest);
+
+    parcMemory_Deallocate(&input);
+}
+
+LONGBOW_TEST_CASE(Global, parcLZ_Compress_Independent)
+{
+    // Compressing the same block twice must not refer back to the first copy.
+    size_t length = 4096;
+    uint8_t *input = parcMemory_Allocate(length);
+    _fillRandom(length, input);
+
+    PARCLZCompressor *compressor = parcLZCompressor_Create(PARCLZ_LevelBest);
+    size_t first = _assertRoundTrip(compressor, length, input);
+    size_t second = _assertRoundTrip(compressor, length, input);
+    assertTrue(first == second, "Expected the same compressed length, got %zu and %zu", first, second);
+
+    // Force the position base to wrap.
+    compressor->base = UINT32_MAX - 100;
+    _assertRoundTrip(compressor, length, input);
+    assertTrue(compressor->base == 1 + length, "Expected the tables to be reset, base is %u", compressor->base);
+    _assertRoundTrip(compressor, length, input);
+    parcLZCompressor_Release(&compressor);
+
+    parcMemory_Deallocate(&input);
+}
+
+LONGBOW_TEST_CASE(Global, parcLZ_Compress_TooSmall)
+{
+    uint8_t input[1000];
+    _fillRandom(sizeof(input), input);
+    uint8_t output[500];
+
+    PARCLZCompressor *compressor = parcLZCompressor_Create(PARCLZ_LevelDefault);
+    size_t compressedLength = parcLZCompressor_Compress(compressor, sizeof(input), input, sizeof(output), output);
+    assertTrue(compressedLength == 0, "Expected 0 when the output is too small, got %zu", compressedLength);
+    parcLZCompressor_Release(&compressor);
+}
+
+LONGBOW_TEST_CASE(Global, parcLZ_Decompress_Truncated)
+{
+    size_t length = 8192;
+    uint8_t *input = parcMemory_Allocate(length);
+    _fillLogLines(length, input);
+
+    size_t bound = parcLZ_CompressBound(length);
+    uint8_t *compressed = parcMemory_Allocate(bound);
+    uint8_t *output = parcMemory_Allocate(length);
+
+    PARCLZCompressor *compressor = parcLZCompressor_Create(PARCLZ_LevelDefault);
+    size_t compressedLength = parcLZCompressor_Compress(compressor, length, input, bound, compressed);
+    parcLZCompressor_Release(&compressor);
+
+    // Every prefix either fails or decompresses to a prefix of the original.
+    for (size_t prefix = 0; prefix < compressedLength; prefix++) {
+        size_t result = parcLZ_Decompress(prefix, compressed, length, output);
+        assertTrue(result == SIZE_MAX || (result <= length && memcmp(input, output, result) == 0),
+                   "Expected a failure or a prefix of the original for %zu bytes, got %zu", prefix, result);
+    }
+
+    parcMemory_Deallocate(&output);
+    parcMemory_Deallocate(&compressed);
+    parcMemory_Deallocate(&input);
+}
+
+LONGBOW_TEST_CASE(Global, parcLZ_Decompress_Malformed)
+{
+    uint8_t output[256];
+
+    // A match at offset 0.
+    uint8_t zeroOffset[] = { 0x10, 'a', 0x00, 0x00 };
+    assertTrue(parcLZ_Decompress(sizeof(zeroOffset), zeroOffset, sizeof(output), output) == SIZE_MAX,
+               "Expected a match at offset 0 to fail");
+
+    // A match before the start of the output.
+    uint8_t farOffset[] = { 0x10, 'a', 0x02, 0x00 };
+    assertTrue(parcLZ_Decompress(sizeof(farOffset), farOffset, sizeof(output), output) == SIZE_MAX,
+               "Expected a match before the start of the output to fail");
+
+    // A literal length running past the end of the input.
+    uint8_t longLiterals[] = { 0xF0, 0xFF, 0x10, 'a' };
+    assertTrue(parcLZ_Decompress(sizeof(longLiterals), longLiterals, sizeof(output), output) == SIZE_MAX,
+               "Expected literals past the end of the input to fail");
+
+    // Random input never reads or writes out of bounds.
+    uint8_t random[512];
+    uint64_t state = 1;
+    for (int trial = 0; trial < 10000; trial++) {
+        size_t length = _nextRandom(&state) % sizeof(random);
+        for (size_t i = 0; i < length; i++) {
+            random[i] = (uint8_t) _nextRandom(&state);
+        }
+        size_t result = parcLZ_Decompress(length, random, sizeof(output), output);
+        assertTrue(result == SIZE_MAX || result <= sizeof(output), "Expected a failure or a length in bounds, got %zu", result);
+    }
+}
+
+LONGBOW_TEST_CASE(Global, parcLZ_Decompress_TooSmall)
+{
+    uint8_t input[1000];
+    memset(input, 'x', sizeof(input));
+    uint8_t compressed[parcLZ_CompressBound(sizeof(input))];
+
+    PARCLZCompressor *compressor = parcLZCompressor_Create(PARCLZ_LevelDefault);
+    size_t compressedLength = parcLZCompressor_Compress(compressor, sizeof(input), input, sizeof(compressed), compressed);
+    parcLZCompressor_Release(&compressor);
+
+    uint8_t output[999];
+    size_t result = parcLZ_Decompress(compressedLength, compressed, sizeof(output), output);
+    assertTrue(result == SIZE_MAX, "Expected a failure when the output is too small, got %zu", result);
+}
+
+LONGBOW_TEST_FIXTURE(Errors)
+{
+    LONGBOW_RUN_TEST_CASE(Errors, parcLZCompressor_Create_LevelTooLow);
+    LONGBOW_RUN_TEST_CASE(Errors, parcLZCompressor_Create_LevelTooHigh);
+}
+
+LONGBOW_TEST_FIXTURE_SETUP(Errors)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_FIXTURE_TEARDOWN(Errors)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_CASE_EXPECTS(Errors, parcLZCompressor_Create_LevelTooLow, .event = &LongBowTrapIllegalValue)
+{
+    PARCLZCompressor *compressor = parcLZCompressor_Create(0);
+
+    parcLZCompressor_Release(&compressor);
+}
+
+LONGBOW_TEST_CASE_EXPECTS(Errors, parcLZCompressor_Create_LevelTooHigh, .event = &LongBowTrapIllegalValue)
+{
+    PARCLZCompressor *compressor = parcLZCompressor_Create(PARCLZ_LevelBest + 1);
+
+    parcLZCompressor_Release(&compressor);
+}
+
+LONGBOW_TEST_FIXTURE_OPTIONS(Performance, .enabled = false)
+{
+    LONGBOW_RUN_TEST_CASE(Performance, LogCorpus);
+}
+
+LONGBOW_TEST_FIXTURE_SETUP(Performance)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_FIXTURE_TEARDOWN(Performance)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+static double
+_seconds(const struct timeval *start, const struct timeval *end)
+{
+    struct timeval elapsed;
+    timersub(end, start, &elapsed);
+    return elapsed.tv_sec + elapsed.tv_usec / 1000000.0;
+}
+
+LONGBOW_TEST_CASE(Performance, LogCorpus)
+{
+    size_t length = 32 * 1024 * 1024;
+    size_t blockSize = 64 * 1024;
+    size_t blocks = length / blockSize;
+
+    uint8_t *input = parcMemory_Allocate(length);
+    _fillLogLines(length, input);
+    size_t bound = parcLZ_CompressBound(blockSize);
+    uint8_t *compressed = parcMemory_Allocate(blocks * bound);
+    size_t *compressedLengths = parcMemory_Allocate(blocks * sizeof(size_t));
+    uint8_t *output = parcMemory_Allocate(blockSize);
+
+    printf("Log corpus of %zu MiB in %zu KiB blocks\n", length >> 20, blockSize >> 10);
+    int levels[] = { 1, 2, 3, 5, 7, 9 };
+    for (size_t l = 0; l < sizeof(levels) / sizeof(levels[0]); l++) {
+        PARCLZCompressor *compressor = parcLZCompressor_Create(levels[l]);
+
+        struct timeval start, end;
+        gettimeofday(&start, NULL);
+        size_t total = 0;
+        for (size_t b = 0; b < blocks; b++) {
+            compressedLengths[b] = parcLZCompressor_Compress(compressor, blockSize, input + b * blockSize, bound, compressed + b * bound);
+            total += compressedLengths[b];
+        }
+        gettimeofday(&end, NULL);
+        double compressSeconds = _seconds(&start, &end);
+
+        gettimeofday(&start, NULL);
+        for (size_t b = 0; b < blocks; b++) {
+            parcLZ_Decompress(compressedLengths[b], compressed + b * bound, blockSize, output);
+        }
+        gettimeofday(&end, NULL);
+        double decompressSeconds = _seconds(&start, &end);
+
+        printf("level %d: ratio %5.2f  compress %7.1f MB/s  decompress %7.1f MB/s\n",
+               levels[l], (double) length / total, length / compressSeconds / 1e6, length / decompressSeconds / 1e6);
+
+        parcLZCompressor_Release(&compressor);
+    }
+
+    parcMemory_Deallocate(&output);
+    parcMemory_Deallocate(&compressedLengths);
+    parcMemory_Deallocate(&compressed);
+    parcMemory_Deallocate(&input);
+}
+
+int
+main(int argc, char *argv[argc])
+{
+    LongBowRunner *testRunner = LONGBOW_TEST_RUNNER_CREATE(parc_LZ);
+    int exitStatus = LONGBOW_TEST_MAIN(argc, argv, testRunner);
+    longBowTestRunner_Destroy(&testRunner);
+    exit(exitStatus);
+}
@@ -0,0 +1,375 @@
+/*
+ * Copyright (c) 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Patent rights are not granted under this agreement. Patent rights are
+ *       available under FRAND terms.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX or PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * @copyright 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC).  All rights reserved.
+ */
+// Include the file(s) containing the functions to be tested.
+// This permits internal static functions to be visible to this Test Framework.
+#include "../parc_LZInputStream.c"
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <stdio.h>
+#include <unistd.h>
+
+#include <LongBow/testing.h>
+#include <LongBow/debugging.h>
+#include <parc/algol/parc_Memory.h>
+#include <parc/algol/parc_SafeMemory.h>
+#include <parc/algol/parc_BufferComposer.h>
+#include <parc/algol/parc_FileOutputStream.h>
+#include <parc/algol/parc_FileInputStream.h>
+#include <parc/algol/parc_LZOutputStream.h>
+
+#include <parc/testing/parc_MemoryTesting.h>
+#include <parc/testing/parc_ObjectTesting.h>
+
+#define _fileName "tmpfile_LZInputStream"
+
+/*
+ * Write `content` to the test file through a `PARCLZOutputStream`.
+ */
+static void
+_writeCompressed(PARCBuffer *content, int level, size_t blockSize)
+{
+    PARCFileOutputStream *fileOutput = parcFileOutputStream_Create(open(_fileName, O_WRONLY | O_CREAT | O_TRUNC, 0600));
+    PARCOutputStream *output = parcFileOutputStream_AsOutputStream(fileOutput);
+    parcFileOutputStream_Release(&fileOutput);
+
+    PARCLZOutputStream *stream = parcLZOutputStream_Create(output, level, blockSize);
+    parcOutputStream_Release(&output);
+    parcLZOutputStream_Write(stream, content);
+    parcBuffer_Rewind(content);
+    parcLZOutputStream_Release(&stream);
+}
+
+static PARCLZInputStream *
+_openCompressed(void)
+{
+    PARCFileInputStream *fileInput = parcFileInputStream_Create(open(_fileName, O_RDONLY));
+    PARCInputStream *input = parcInputStream(fileInput, PARCFileInputStreamAsPARCInputStream);
+
+    PARCLZInputStream *result = parcLZInputStream_Create(input);
+    parcInputStream_Release(&input);
+    return result;
+}
+
+/*
+ * Read the whole stream, `readSize` bytes at a time.
+ */
+static PARCBuffer *
+_readAll(PARCLZInputStream *stream, size_t readSize)
+{
+    PARCBufferComposer *composer = parcBufferComposer_Create();
+    PARCBuffer *buffer = parcBuffer_Allocate(readSize);
+    size_t count;
+    while ((count = parcLZInputStream_Read(stream, parcBuffer_Clear(buffer))) > 0) {
+        assertTrue(count == readSize || parcBuffer_HasRemaining(buffer), "Expected a short read only at the end of the stream");
+        parcBufferComposer_PutBuffer(composer, parcBuffer_Flip(buffer));
+    }
+    parcBuffer_Release(&buffer);
+
+    PARCBuffer *result = parcBufferComposer_ProduceBuffer(composer);
+    parcBufferComposer_Release(&composer);
+    return result;
+}
+
+static PARCBuffer *
+_logLines(size_t count)
+{
+    PARCBufferComposer *composer = parcBufferComposer_Create();
+    for (size_t i = 0; i < count; i++) {
+        parcBufferComposer_Format(composer, "<Info> 1 %zu hostname app 4242 %zu [ line %zu ]\n", 1433160000 + i / 10, i % 7, i);
+    }
+    PARCBuffer *result = parcBufferComposer_ProduceBuffer(composer);
+    parcBufferComposer_Release(&composer);
+    return result;
+}
+
+/*
+ * Overwrite the byte at `offset` in the test file, or truncate the file to `offset` bytes.
+ */
+static void
+_damageFile(off_t offset, bool truncate)
+{
+    int fd = open(_fileName, O_RDWR);
+    if (truncate) {
+        assertTrue(ftruncate(fd, offset) == 0, "Expected ftruncate to succeed");
+    } else {
+        uint8_t byte;
+        assertTrue(pread(fd, &byte, 1, offset) == 1, "Expected to read the byte");
+        byte ^= 0x55;
+        assertTrue(pwrite(fd, &byte, 1, offset) == 1, "Expected to write the byte");
+    }
+    close(fd);
+}
+
+LONGBOW_TEST_RUNNER(parc_LZInputStream)
+{
+    LONGBOW_RUN_TEST_FIXTURE(CreateAcquireRelease);
+    LONGBOW_RUN_TEST_FIXTURE(Global);
+}
+
+LONGBOW_TEST_RUNNER_SETUP(parc_LZInputStream)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_RUNNER_TEARDOWN(parc_LZInputStream)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_FIXTURE(CreateAcquireRelease)
+{
+    LONGBOW_RUN_TEST_CASE(CreateAcquireRelease, CreateRelease);
+}
+
+LONGBOW_TEST_FIXTURE_SETUP(CreateAcquireRelease)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_FIXTURE_TEARDOWN(CreateAcquireRelease)
+{
+    unlink(_fileName);
+    if (!parcMemoryTesting_ExpectedOutstanding(0, "%s leaked memory.", longBowTestCase_GetFullName(testCase))) {
+        return LONGBOW_STATUS_MEMORYLEAK;
+    }
+
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_CASE(CreateAcquireRelease, CreateRelease)
+{
+    PARCBuffer *empty = parcBuffer_Allocate(0);
+    _writeCompressed(empty, PARCLZ_LevelDefault, 4096);
+    parcBuffer_Release(&empty);
+
+    PARCLZInputStream *stream = _openCompressed();
+    assertNotNull(stream, "Expected non-null result from parcLZInputStream_Create");
+    parcLZInputStream_AssertValid(stream);
+
+    parcObjectTesting_AssertAcquireReleaseContract(parcLZInputStream_Acquire, stream);
+
+    parcLZInputStream_Release(&stream);
+    assertNull(stream, "Expected parcLZInputStream_Release to set the pointer to NULL");
+}
+
+LONGBOW_TEST_FIXTURE(Global)
+{
+    LONGBOW_RUN_TEST_CASE(Global, parcLZInputStream_Read_Empty);
+    LONGBOW_RUN_TEST_CASE(Global, parcLZInputStream_Read_RoundTrip);
+    LONGBOW_RUN_TEST_CASE(Global, parcLZInputStream_Read_Stored);
+    LONGBOW_RUN_TEST_CASE(Global, parcLZInputStream_Read_BadMagic);
+    LONGBOW_RUN_TEST_CASE(Global, parcLZInputStream_Read_BadChecksum);
+    LONGBOW_RUN_TEST_CASE(Global, parcLZInputStream_Read_BadPayload);
+    LONGBOW_RUN_TEST_CASE(Global, parcLZInputStream_Read_Truncated);
+    LONGBOW_RUN_TEST_CASE(Global, parcLZInputStream_AsInputStream);
+}
+
+LONGBOW_TEST_FIXTURE_SETUP(Global)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_FIXTURE_TEARDOWN(Global)
+{
+    unlink(_fileName);
+    if (!parcMemoryTesting_ExpectedOutstanding(0, "%s leaked memory.", longBowTestCase_GetFullName(testCase))) {
+        return LONGBOW_STATUS_MEMORYLEAK;
+    }
+
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_CASE(Global, parcLZInputStream_Read_Empty)
+{
+    PARCBuffer *empty = parcBuffer_Allocate(0);
+    _writeCompressed(empty, PARCLZ_LevelDefault, 4096);
+    parcBuffer_Release(&empty);
+
+    PARCLZInputStream *stream = _openCompressed();
+    PARCBuffer *buffer = parcBuffer_Allocate(16);
+    assertTrue(parcLZInputStream_Read(stream, buffer) == 0, "Expected an empty stream");
+    assertFalse(parcLZInputStream_IsCorrupted(stream), "Expected an empty stream not to be corrupted");
+    parcBuffer_Release(&buffer);
+    parcLZInputStream_Release(&stream);
+}
+
+LONGBOW_TEST_CASE(Global, parcLZInputStream_Read_RoundTrip)
+{
+    PARCBuffer *content = _logLines(5000);
+
+    size_t blockSizes[] = { 1, 1000, 64 * 1024 };
+    size_t readSizes[] = { 1, 333, 100000 };
+    for (size_t b = 0; b < sizeof(blockSizes) / sizeof(blockSizes[0]); b++) {
+        int level = (b == 0) ? PARCLZ_LevelBest : PARCLZ_LevelFastest + (int) b;
+        _writeCompressed(content, level, blockSizes[b]);
+
+        for (size_t r = 0; r < sizeof(readSizes) / sizeof(readSizes[0]); r++) {
+            PARCLZInputStream *stream = _openCompressed();
+            PARCBuffer *read = _readAll(stream, readSizes[r]);
+            assertFalse(parcLZInputStream_IsCorrupted(stream), "Expected the stream not to be corrupted");
+            assertTrue(parcBuffer_Equals(content, read), "Expected the original content (block size %zu, read size %zu)",
+                       blockSizes[b], readSizes[r]);
+            parcBuffer_Release(&read);
+            parcLZInputStream_Release(&stream);
+        }
+    }
+
+    parcBuffer_Release(&content);
+}
+
+LONGBOW_TEST_CASE(Global, parcLZInputStream_Read_Stored)
+{
+    PARCBuffer *content = parcBuffer_Allocate(10000);
+    uint32_t state = 1;
+    while (parcBuffer_HasRemaining(content)) {
+        state = state * 1103515245 + 12345;
+        parcBuffer_PutUint8(content, (uint8_t) (state >> 16));
+    }
+    parcBuffer_Flip(content);
+    _writeCompressed(content, PARCLZ_LevelDefault, 4096);
+
+    PARCLZInputStream *stream = _openCompressed();
+    PARCBuffer *read = _readAll(stream, 4096);
+    assertFalse(parcLZInputStream_IsCorrupted(stream), "Expected the stream not to be corrupted");
+    assertTrue(parcBuffer_Equals(content, read), "Expected the original content");
+    parcBuffer_Release(&read);
+    parcLZInputStream_Release(&stream);
+
+    parcBuffer_Release(&content);
+}
+
+LONGBOW_TEST_CASE(Global, parcLZInputStream_Read_BadMagic)
+{
+    PARCBuffer *content = _logLines(10);
+    _writeCompressed(content, PARCLZ_LevelDefault, 4096);
+    parcBuffer_Release(&content);
+    _damageFile(0, false);
+
+    PARCLZInputStream *stream = _openCompressed();
+    PARCBuffer *read = _readAll(stream, 4096);
+    assertTrue(parcBuffer_Remaining(read) == 0, "Expected no bytes from a stream with the wrong magic");
+    assertTrue(parcLZInputStream_IsCorrupted(stream), "Expected the stream to be corrupted");
+    parcBuffer_Release(&read);
+    parcLZInputStream_Release(&stream);
+}
+
+LONGBOW_TEST_CASE(Global, parcLZInputStream_Read_BadChecksum)
+{
+    PARCBuffer *content = _logLines(1000);
+    _writeCompressed(content, PARCLZ_LevelDefault, 4096);
+    _damageFile(4 + 8, false);
+
+    PARCLZInputStream *stream = _openCompressed();
+    PARCBuffer *read = _readAll(stream, 100);
+    assertTrue(parcBuffer_Remaining(read) == 0, "Expected no bytes from a block that fails its checksum");
+    assertTrue(parcLZInputStream_IsCorrupted(stream), "Expected the stream to be corrupted");
+    parcBuffer_Release(&read);
+    parcLZInputStream_Release(&stream);
+
+    parcBuffer_Release(&content);
+}
+
+LONGBOW_TEST_CASE(Global, parcLZInputStream_Read_BadPayload)
+{
+    PARCBuffer *content = _logLines(1000);
+    _writeCompressed(content, PARCLZ_LevelDefault, 4096);
+
+    // Damage each of the first bytes of the first payload in turn: the damage is always detected.
+    for (off_t offset = 4 + PARCLZ_FrameHeaderLength; offset < 4 + PARCLZ_FrameHeaderLength + 64; offset++) {
+        _damageFile(offset, false);
+        PARCLZInputStream *stream = _openCompressed();
+        PARCBuffer *read = _readAll(stream, 4096);
+        assertTrue(parcBuffer_Remaining(read) == 0, "Expected no bytes from a damaged block");
+        assertTrue(parcLZInputStream_IsCorrupted(stream), "Expected the stream to be corrupted");
+        parcBuffer_Release(&read);
+        parcLZInputStream_Release(&stream);
+        _damageFile(offset, false);
+    }
+
+    parcBuffer_Release(&content);
+}
+
+LONGBOW_TEST_CASE(Global, parcLZInputStream_Read_Truncated)
+{
+    PARCBuffer *content = _logLines(1000);
+    _writeCompressed(content, PARCLZ_LevelDefault, 4096);
+
+    struct stat statbuf;
+    stat(_fileName, &statbuf);
+    _damageFile(statbuf.st_size - 1, true);
+
+    // Every complete block is returned; the missing end of the stream is reported.
+    PARCLZInputStream *stream = _openCompressed();
+    PARCBuffer *read = _readAll(stream, 4096);
+    assertTrue(parcBuffer_Remaining(read) == parcBuffer_Remaining(content), "Expected every block, got %zu of %zu bytes",
+               parcBuffer_Remaining(read), parcBuffer_Remaining(content));
+    assertTrue(parcLZInputStream_IsCorrupted(stream), "Expected a stream without its end to be corrupted");
+    parcBuffer_Release(&read);
+    parcLZInputStream_Release(&stream);
+
+    _damageFile(statbuf.st_size / 2, true);
+    stream = _openCompressed();
+    read = _readAll(stream, 4096);
+    assertTrue(parcBuffer_Remaining(read) < parcBuffer_Remaining(content), "Expected only the complete blocks");
+    assertTrue(parcBuffer_Remaining(read) % 4096 == 0, "Expected only the complete blocks, got %zu bytes", parcBuffer_Remaining(read));
+    assertTrue(parcLZInputStream_IsCorrupted(stream), "Expected a truncated stream to be corrupted");
+    parcBuffer_Release(&read);
+    parcLZInputStream_Release(&stream);
+
+    parcBuffer_Release(&content);
+}
+
+LONGBOW_TEST_CASE(Global, parcLZInputStream_AsInputStream)
+{
+    PARCBuffer *content = parcBuffer_WrapCString("Hello World");
+    _writeCompressed(content, PARCLZ_LevelDefault, 4096);
+    parcBuffer_Release(&content);
+
+    PARCLZInputStream *stream = _openCompressed();
+    PARCInputStream *input = parcLZInputStream_AsInputStream(stream);
+    parcLZInputStream_Release(&stream);
+
+    PARCBuffer *buffer = parcBuffer_Allocate(32);
+    size_t count = parcInputStream_Read(input, buffer);
+    assertTrue(count == 11, "Expected 11 bytes, got %zu", count);
+    assertTrue(memcmp(parcBuffer_Overlay(parcBuffer_Flip(buffer), 0), "Hello World", 11) == 0, "Expected the original content");
+    parcBuffer_Release(&buffer);
+    parcInputStream_Release(&input);
+}
+
+int
+main(int argc, char *argv[argc])
+{
+    LongBowRunner *testRunner = LONGBOW_TEST_RUNNER_CREATE(parc_LZInputStream);
+    int exitStatus = LONGBOW_TEST_MAIN(argc, argv, testRunner);
+    longBowTestRunner_Destroy(&testRunner);
+    exit(exitStatus);
+}
@@ -0,0 +1,315 @@
+/*
+ * Copyright (c) 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Patent rights are not granted under this agreement. Patent rights are
+ *       available under FRAND terms.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX or PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * @copyright 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC).  All rights reserved.
+ */
+// Include the file(s) containing the functions to be tested.
+// This permits internal static functions to be visible to this Test Framework.
+#include "../parc_LZOutputStream.c"
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <unistd.h>
+
+#include <LongBow/testing.h>
+#include <LongBow/debugging.h>
+#include <parc/algol/parc_Memory.h>
+#include <parc/algol/parc_SafeMemory.h>
+#include <parc/algol/parc_FileOutputStream.h>
+#include <parc/algol/parc_FileInputStream.h>
+
+#include <parc/testing/parc_MemoryTesting.h>
+#include <parc/testing/parc_ObjectTesting.h>
+
+#define _fileName "tmpfile_LZOutputStream"
+
+static PARCOutputStream *
+_openOutput(void)
+{
+    PARCFileOutputStream *fileOutput = parcFileOutputStream_Create(open(_fileName, O_WRONLY | O_CREAT | O_TRUNC, 0600));
+    PARCOutputStream *result = parcFileOutputStream_AsOutputStream(fileOutput);
+    parcFileOutputStream_Release(&fileOutput);
+    return result;
+}
+
+/*
+ * Read the whole file written by the test.
+ */
+static PARCBuffer *
+_readOutput(void)
+{
+    PARCFileInputStream *fileInput = parcFileInputStream_Create(open(_fileName, O_RDONLY));
+    PARCBuffer *result = parcBuffer_Flip(parcFileInputStream_ReadFile(fileInput));
+    parcFileInputStream_Release(&fileInput);
+    return result;
+}
+
+/*
+ * Check the stream magic and the end of the stream, and count the frames between them, and their bytes uncompressed.
+ * `stored` is set to the number of frames that are stored uncompressed.
+ */
+static size_t
+_countFrames(PARCBuffer *written, size_t *length, size_t *stored)
+{
+    assertTrue(parcBuffer_Remaining(written) >= 8, "Expected at least the magic and the end of the stream");
+    assertTrue(memcmp(parcBuffer_Overlay(written, 4), PARCLZ_StreamMagic, 4) == 0, "Expected the stream magic");
+
+    size_t result = 0;
+    *length = 0;
+    *stored = 0;
+    uint32_t payloadWord;
+    while ((payloadWord = parcBuffer_GetUint32(written)) != 0) {
+        *length += parcBuffer_GetUint32(written);
+        parcBuffer_GetUint32(written);
+        if (payloadWord & PARCLZ_FrameStored) {
+            (*stored)++;
+        }
+        parcBuffer_SetPosition(written, parcBuffer_Position(written) + (payloadWord & ~PARCLZ_FrameStored));
+        result++;
+    }
+    assertFalse(parcBuffer_HasRemaining(written), "Expected nothing after the end of the stream");
+    return result;
+}
+
+static void
+_writeLines(PARCLZOutputStream *stream, size_t count)
+{
+    for (size_t i = 0; i < count; i++) {
+        char line[64];
+        snprintf(line, sizeof(line), "<Info> 1 %zu hostname app 4242 %zu [ line %zu ]\n", 1433160000 + i, i % 7, i);
+        PARCBuffer *buffer = parcBuffer_WrapCString(line);
+        parcLZOutputStream_Write(stream, buffer);
+        parcBuffer_Release(&buffer);
+    }
+}
+
+LONGBOW_TEST_RUNNER(parc_LZOutputStream)
+{
+    LONGBOW_RUN_TEST_FIXTURE(CreateAcquireRelease);
+    LONGBOW_RUN_TEST_FIXTURE(Global);
+    LONGBOW_RUN_TEST_FIXTURE(Errors);
+}
+
+LONGBOW_TEST_RUNNER_SETUP(parc_LZOutputStream)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_RUNNER_TEARDOWN(parc_LZOutputStream)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_FIXTURE(CreateAcquireRelease)
+{
+    LONGBOW_RUN_TEST_CASE(CreateAcquireRelease, CreateRelease);
+}
+
+LONGBOW_TEST_FIXTURE_SETUP(CreateAcquireRelease)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_FIXTURE_TEARDOWN(CreateAcquireRelease)
+{
+    unlink(_fileName);
+    if (!parcMemoryTesting_ExpectedOutstanding(0, "%s leaked memory.", longBowTestCase_GetFullName(testCase))) {
+        return LONGBOW_STATUS_MEMORYLEAK;
+    }
+
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_CASE(CreateAcquireRelease, CreateRelease)
+{
+    PARCOutputStream *output = _openOutput();
+    PARCLZOutputStream *stream = parcLZOutputStream_Create(output, PARCLZ_LevelDefault, 4096);
+    parcOutputStream_Release(&output);
+    assertNotNull(stream, "Expected non-null result from parcLZOutputStream_Create");
+    parcLZOutputStream_AssertValid(stream);
+
+    parcObjectTesting_AssertAcquireReleaseContract(parcLZOutputStream_Acquire, stream);
+
+    parcLZOutputStream_Release(&stream);
+    assertNull(stream, "Expected parcLZOutputStream_Release to set the pointer to NULL");
+
+    // An empty stream is the magic and the end of the stream.
+    PARCBuffer *written = _readOutput();
+    size_t length, stored;
+    assertTrue(_countFrames(written, &length, &stored) == 0, "Expected no frames");
+    parcBuffer_Release(&written);
+}
+
+LONGBOW_TEST_FIXTURE(Global)
+{
+    LONGBOW_RUN_TEST_CASE(Global, parcLZOutputStream_Write);
+    LONGBOW_RUN_TEST_CASE(Global, parcLZOutputStream_Write_Incompressible);
+    LONGBOW_RUN_TEST_CASE(Global, parcLZOutputStream_Flush);
+    LONGBOW_RUN_TEST_CASE(Global, parcLZOutputStream_AsOutputStream);
+}
+
+LONGBOW_TEST_FIXTURE_SETUP(Global)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_FIXTURE_TEARDOWN(Global)
+{
+    unlink(_fileName);
+    if (!parcMemoryTesting_ExpectedOutstanding(0, "%s leaked memory.", longBowTestCase_GetFullName(testCase))) {
+        return LONGBOW_STATUS_MEMORYLEAK;
+    }
+
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_CASE(Global, parcLZOutputStream_Write)
+{
+    PARCOutputStream *output = _openOutput();
+    PARCLZOutputStream *stream = parcLZOutputStream_Create(output, PARCLZ_LevelDefault, 4096);
+    parcOutputStream_Release(&output);
+
+    PARCBuffer *buffer = parcBuffer_Allocate(10000);
+    parcBuffer_Flip(parcBuffer_SetPosition(buffer, 10000));
+    size_t written = parcLZOutputStream_Write(stream, buffer);
+    assertTrue(written == 10000, "Expected 10000, got %zu", written);
+    assertFalse(parcBuffer_HasRemaining(buffer), "Expected the buffer's position to be set to its limit");
+    parcBuffer_Release(&buffer);
+    parcLZOutputStream_Release(&stream);
+
+    PARCBuffer *file = _readOutput();
+    size_t length, stored;
+    size_t frames = _countFrames(file, &length, &stored);
+    assertTrue(frames == 3, "Expected two full blocks and a partial one, got %zu", frames);
+    assertTrue(length == 10000, "Expected 10000 bytes in the frames, got %zu", length);
+    assertTrue(stored == 0, "Expected every block to be compressed");
+    assertTrue(parcBuffer_Limit(file) < 200, "Expected zeros to compress well, got %zu bytes", parcBuffer_Limit(file));
+    parcBuffer_Release(&file);
+}
+
+LONGBOW_TEST_CASE(Global, parcLZOutputStream_Write_Incompressible)
+{
+    PARCOutputStream *output = _openOutput();
+    PARCLZOutputStream *stream = parcLZOutputStream_Create(output, PARCLZ_LevelDefault, 4096);
+    parcOutputStream_Release(&output);
+
+    PARCBuffer *buffer = parcBuffer_Allocate(4096);
+    uint32_t state = 1;
+    while (parcBuffer_HasRemaining(buffer)) {
+        state = state * 1103515245 + 12345;
+        parcBuffer_PutUint8(buffer, (uint8_t) (state >> 16));
+    }
+    parcLZOutputStream_Write(stream, parcBuffer_Flip(buffer));
+    parcBuffer_Release(&buffer);
+    parcLZOutputStream_Release(&stream);
+
+    PARCBuffer *file = _readOutput();
+    size_t length, stored;
+    assertTrue(_countFrames(file, &length, &stored) == 1, "Expected one frame");
+    assertTrue(stored == 1, "Expected the incompressible block to be stored");
+    assertTrue(parcBuffer_Limit(file) == 4 + PARCLZ_FrameHeaderLength + 4096 + 4,
+               "Expected no growth beyond the framing, got %zu bytes", parcBuffer_Limit(file));
+    parcBuffer_Release(&file);
+}
+
+LONGBOW_TEST_CASE(Global, parcLZOutputStream_Flush)
+{
+    PARCOutputStream *output = _openOutput();
+    PARCLZOutputStream *stream = parcLZOutputStream_Create(output, PARCLZ_LevelDefault, 64 * 1024);
+    parcOutputStream_Release(&output);
+
+    _writeLines(stream, 10);
+    PARCBuffer *file = _readOutput();
+    assertTrue(parcBuffer_Limit(file) == 0, "Expected nothing to be written before the block is full");
+    parcBuffer_Release(&file);
+
+    assertTrue(parcLZOutputStream_Flush(stream), "Expected parcLZOutputStream_Flush to succeed");
+    file = _readOutput();
+    assertTrue(parcBuffer_Limit(file) > 4 + PARCLZ_FrameHeaderLength, "Expected the partial block to be written");
+    parcBuffer_Release(&file);
+
+    _writeLines(stream, 10);
+    parcLZOutputStream_Release(&stream);
+
+    file = _readOutput();
+    size_t length, stored;
+    assertTrue(_countFrames(file, &length, &stored) == 2, "Expected a frame for each flush");
+    parcBuffer_Release(&file);
+}
+
+LONGBOW_TEST_CASE(Global, parcLZOutputStream_AsOutputStream)
+{
+    PARCOutputStream *output = _openOutput();
+    PARCLZOutputStream *stream = parcLZOutputStream_Create(output, PARCLZ_LevelFastest, 4096);
+    parcOutputStream_Release(&output);
+
+    PARCOutputStream *compressed = parcLZOutputStream_AsOutputStream(stream);
+    parcLZOutputStream_Release(&stream);
+
+    parcOutputStream_WriteCStrings(compressed, "Hello", " ", "World", NULL);
+    parcOutputStream_Release(&compressed);
+
+    PARCBuffer *file = _readOutput();
+    size_t length, stored;
+    assertTrue(_countFrames(file, &length, &stored) == 1, "Expected one frame");
+    assertTrue(length == 11, "Expected 11 bytes, got %zu", length);
+    parcBuffer_Release(&file);
+}
+
+LONGBOW_TEST_FIXTURE(Errors)
+{
+    LONGBOW_RUN_TEST_CASE(Errors, parcLZOutputStream_Create_ZeroBlockSize);
+}
+
+LONGBOW_TEST_FIXTURE_SETUP(Errors)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_FIXTURE_TEARDOWN(Errors)
+{
+    unlink(_fileName);
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_CASE_EXPECTS(Errors, parcLZOutputStream_Create_ZeroBlockSize, .event = &LongBowTrapIllegalValue)
+{
+    PARCOutputStream *output = _openOutput();
+    PARCLZOutputStream *stream = parcLZOutputStream_Create(output, PARCLZ_LevelDefault, 0);
+
+    parcLZOutputStream_Release(&stream);
+    parcOutputStream_Release(&output);
+}
+
+int
+main(int argc, char *argv[argc])
+{
+    LongBowRunner *testRunner = LONGBOW_TEST_RUNNER_CREATE(parc_LZOutputStream);
+    int exitStatus = LONGBOW_TEST_MAIN(argc, argv, testRunner);
+    longBowTestRunner_Destroy(&testRunner);
+    exit(exitStatus);
+}
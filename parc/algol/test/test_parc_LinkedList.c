@@ -157,6 +157,9 @@ LONGBOW_TEST_FIXTURE(Global)
     LONGBOW_RUN_TEST_CASE(Global, parcLinkedList_CreateIterator_RemoveHead);
     LONGBOW_RUN_TEST_CASE(Global, parcLinkedList_CreateIterator_RemoveMiddle);
     LONGBOW_RUN_TEST_CASE(Global, parcLinkedList_CreateIterator_RemoveTail);
+    LONGBOW_RUN_TEST_CASE(Global, parcLinkedList_Cursor);
+    LONGBOW_RUN_TEST_CASE(Global, parcLinkedList_Cursor_Empty);
+    LONGBOW_RUN_TEST_CASE(Global, parcLinkedList_ForEach);
 
     LONGBOW_RUN_TEST_CASE(Global, parcLinkedList_SetEquals_True);
     LONGBOW_RUN_TEST_CASE(Global, parcLinkedList_SetEquals_False);
@@ -774,6 +777,67 @@ LONGBOW_TEST_CASE(Global, parcLinkedList_CreateIterator)
     parcLinkedList_Release(&x);
 }
 
+LONGBOW_TEST_CASE(Global, parcLinkedList_Cursor)
+{
+    PARCLinkedList *x = parcLinkedList_Create();
+
+    uint32_t expectedCount = 10;
+    for (uint32_t i = 0; i < expectedCount; i++) {
+        PARCBuffer *object = parcBuffer_Allocate(sizeof(int));
+        parcBuffer_PutUint32(object, i);
+        parcBuffer_Flip(object);
+        parcLinkedList_Append(x, object);
+        parcBuffer_Release(&object);
+    }
+
+    PARCCursor cursor = parcLinkedList_Cursor(x);
+    uint32_t expected = 0;
+    while (parcLinkedList_CursorHasNext(&cursor)) {
+        PARCBuffer *buffer = (PARCBuffer *) parcLinkedList_CursorNext(&cursor);
+        uint32_t actual = parcBuffer_GetUint32(buffer);
+        assertTrue(expected == actual, "Expected %d, actual %d", expected, actual);
+        expected++;
+    }
+    assertTrue(expected == expectedCount, "Expected %d elements, actual %d", expectedCount, expected);
+
+    parcLinkedList_Release(&x);
+}
+
+LONGBOW_TEST_CASE(Global, parcLinkedList_Cursor_Empty)
+{
+    PARCLinkedList *x = parcLinkedList_Create();
+
+    PARCCursor cursor = parcLinkedList_Cursor(x);
+    assertFalse(parcLinkedList_CursorHasNext(&cursor), "Expected a cursor on an empty list to not HaveNext");
+
+    parcLinkedList_Release(&x);
+}
+
+LONGBOW_TEST_CASE(Global, parcLinkedList_ForEach)
+{
+    PARCLinkedList *x = parcLinkedList_Create();
+
+    uint32_t expectedCount = 10;
+    for (uint32_t i = 0; i < expectedCount; i++) {
+        PARCBuffer *object = parcBuffer_Allocate(sizeof(int));
+        parcBuffer_PutUint32(object, i);
+        parcBuffer_Flip(object);
+        parcLinkedList_Append(x, object);
+        parcBuffer_Release(&object);
+    }
+
+    uint32_t expected = 0;
+    PARCBuffer *buffer;
+    parcLinkedList_ForEach(x, buffer) {
+        uint32_t actual = parcBuffer_GetUint32(buffer);
+        assertTrue(expected == actual, "Expected %d, actual %d", expected, actual);
+        expected++;
+    }
+    assertTrue(expected == expectedCount, "Expected %d elements, actual %d", expectedCount, expected);
+
+    parcLinkedList_Release(&x);
+}
+
 LONGBOW_TEST_CASE(Global, parcLinkedList_CreateIterator_Remove)
 {
     PARCLinkedList *x = parcLinkedList_Create();
@@ -1025,6 +1089,7 @@ LONGBOW_TEST_FIXTURE_OPTIONS(Performance, .enabled = false)
     LONGBOW_RUN_TEST_CASE(Performance, parcLinkedList_Append);
     LONGBOW_RUN_TEST_CASE(Performance, parcLinkedList_N2);
     LONGBOW_RUN_TEST_CASE(Performance, parcLinkedList_CreateIterator);
+    LONGBOW_RUN_TEST_CASE(Performance, parcLinkedList_ForEach);
 }
 
 LONGBOW_TEST_FIXTURE_SETUP(Performance)
@@ -1103,6 +1168,30 @@ LONGBOW_TEST_CASE(Performance, parcLinkedList_CreateIterator)
 }
 
 
+LONGBOW_TEST_CASE(Performance, parcLinkedList_ForEach)
+{
+    PARCLinkedList *x = parcLinkedList_Create();
+
+    uint32_t expectedCount = 100000;
+    for (uint32_t i = 0; i < expectedCount; i++) {
+        PARCBuffer *object = parcBuffer_Allocate(sizeof(int));
+        parcBuffer_PutUint32(object, i);
+        parcBuffer_Flip(object);
+        parcLinkedList_Append(x, object);
+        parcBuffer_Release(&object);
+    }
+
+    uint32_t expected = 0;
+    PARCBuffer *buffer;
+    parcLinkedList_ForEach(x, buffer) {
+        uint32_t actual = parcBuffer_GetUint32(buffer);
+        assertTrue(expected == actual, "Expected %d, actual %d", expected, actual);
+        expected++;
+    }
+
+    parcLinkedList_Release(&x);
+}
+
 int
 main(int argc, char *argv[])
 {
@@ -204,6 +204,10 @@ LONGBOW_TEST_FIXTURE(Specialized)
     LONGBOW_RUN_TEST_CASE(Specialized, parcProperties_GetPropertyDefault);
     LONGBOW_RUN_TEST_CASE(Specialized, parcProperties_GetAsBoolean_true);
     LONGBOW_RUN_TEST_CASE(Specialized, parcProperties_GetAsBoolean_false);
+    LONGBOW_RUN_TEST_CASE(Specialized, parcProperties_Cursor);
+    LONGBOW_RUN_TEST_CASE(Specialized, parcProperties_CursorNextProperty);
+    LONGBOW_RUN_TEST_CASE(Specialized, parcProperties_CreateWithInternPool);
+    LONGBOW_RUN_TEST_CASE(Specialized, parcProperties_ForEach);
 }
 
 LONGBOW_TEST_FIXTURE_SETUP(Specialized)
@@ -280,6 +284,85 @@ LONGBOW_TEST_CASE(Specialized, parcProperties_GetAsBoolean_false)
     parcProperties_Release(&instance);
 }
 
+LONGBOW_TEST_CASE(Specialized, parcProperties_Cursor)
+{
+    PARCProperties *instance = parcProperties_Create();
+    parcProperties_SetProperty(instance, "foo", "bar");
+    parcProperties_SetProperty(instance, "bar", "baz");
+
+    size_t count = 0;
+    PARCCursor cursor = parcProperties_Cursor(instance);
+    while (parcProperties_CursorHasNext(&cursor)) {
+        const char *name = parcProperties_CursorNext(&cursor);
+        assertTrue(strcmp(name, "foo") == 0 || strcmp(name, "bar") == 0, "Unexpected property name '%s'", name);
+        count++;
+    }
+    assertTrue(count == 2, "Expected 2 properties, actual %zd", count);
+
+    parcProperties_Release(&instance);
+}
+
+LONGBOW_TEST_CASE(Specialized, parcProperties_CursorNextProperty)
+{
+    PARCProperties *instance = parcProperties_Create();
+    parcProperties_SetProperty(instance, "foo", "bar");
+    parcProperties_SetProperty(instance, "bar", "baz");
+
+    size_t count = 0;
+    PARCCursor cursor = parcProperties_Cursor(instance);
+    while (parcProperties_CursorHasNext(&cursor)) {
+        const char *value;
+        const char *name = parcProperties_CursorNextProperty(&cursor, &value);
+        assertTrue(strcmp(value, parcProperties_GetProperty(instance, name)) == 0,
+                   "Expected the value of '%s' to be '%s', actual '%s'", name, parcProperties_GetProperty(instance, name), value);
+        count++;
+    }
+    assertTrue(count == 2, "Expected 2 properties, actual %zd", count);
+
+    parcProperties_Release(&instance);
+}
+
+LONGBOW_TEST_CASE(Specialized, parcProperties_CreateWithInternPool)
+{
+    PARCInternPool *pool = parcInternPool_Create();
+    PARCProperties *a = parcProperties_CreateWithInternPool(pool);
+    PARCProperties *b = parcProperties_CreateWithInternPool(pool);
+
+    parcProperties_SetProperty(a, "host", "alpha");
+    parcProperties_SetProperty(b, "host", "beta");
+
+    PARCCursor cursorA = parcProperties_Cursor(a);
+    PARCCursor cursorB = parcProperties_Cursor(b);
+    assertTrue(parcProperties_CursorNext(&cursorA) == parcProperties_CursorNext(&cursorB),
+               "Expected both instances to share the interned property name.");
+
+    assertTrue(strcmp(parcProperties_GetProperty(a, "host"), "alpha") == 0, "Expected the value of a to be unchanged.");
+    assertTrue(strcmp(parcProperties_GetProperty(b, "host"), "beta") == 0, "Expected the value of b to be unchanged.");
+    assertTrue(parcInternPool_GetHits(pool) == 1, "Expected 1 hit.");
+
+    parcProperties_Release(&a);
+    parcProperties_Release(&b);
+    parcInternPool_Release(&pool);
+}
+
+LONGBOW_TEST_CASE(Specialized, parcProperties_ForEach)
+{
+    PARCProperties *instance = parcProperties_Create();
+    parcProperties_SetProperty(instance, "foo", "bar");
+    parcProperties_SetProperty(instance, "bar", "baz");
+
+    size_t count = 0;
+    const char *name;
+    parcProperties_ForEach(instance, name) {
+        const char *value = parcProperties_GetProperty(instance, name);
+        assertNotNull(value, "Expected a value for property '%s'", name);
+        count++;
+    }
+    assertTrue(count == 2, "Expected 2 properties, actual %zd", count);
+
+    parcProperties_Release(&instance);
+}
+
 int
 main(int argc, char *argv[argc])
 {
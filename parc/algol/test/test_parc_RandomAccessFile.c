@@ -206,6 +206,9 @@ LONGBOW_TEST_FIXTURE(Specialization)
     LONGBOW_RUN_TEST_CASE(Object, parcRandomAccessFile_Read);
     LONGBOW_RUN_TEST_CASE(Object, parcRandomAccessFile_Write);
     LONGBOW_RUN_TEST_CASE(Object, parcRandomAccessFile_Seek);
+    LONGBOW_RUN_TEST_CASE(Object, parcRandomAccessFile_ReadAt);
+    LONGBOW_RUN_TEST_CASE(Object, parcRandomAccessFile_WriteAt);
+    LONGBOW_RUN_TEST_CASE(Object, parcRandomAccessFile_SendAt);
 }
 
 LONGBOW_TEST_FIXTURE_SETUP(Specialization)
@@ -293,6 +296,138 @@ LONGBOW_TEST_CASE(Object, parcRandomAccessFile_Write)
     parcFile_Release(&file);
 }
 
+LONGBOW_TEST_CASE(Object, parcRandomAccessFile_ReadAt)
+{
+    char *fname = "tmpfile";
+
+    PARCFile *file = parcFile_Create(fname);
+
+    parcFile_CreateNewFile(file);
+    FILE *fp = fopen(fname, "w");
+
+    uint8_t data[128];
+    for (int i = 0; i < 128; i++) {
+        data[i] = i;
+    }
+    fwrite(data, 1, 128, fp);
+    fclose(fp);
+
+    PARCRandomAccessFile *instance = parcRandomAccessFile_Open(file);
+    parcFile_Release(&file);
+
+    PARCBuffer *buffer = parcBuffer_Allocate(32);
+    ssize_t numBytes = parcRandomAccessFile_ReadAt(instance, buffer, 64);
+    assertTrue(numBytes == 32, "Expected 32 bytes to be read, but got %zd", numBytes);
+    assertFalse(parcBuffer_HasRemaining(buffer), "Expected the buffer's position to be advanced");
+    parcBuffer_Flip(buffer);
+    assertTrue(memcmp(&data[64], parcBuffer_Overlay(buffer, 0), 32) == 0, "Expected the bytes at offset 64");
+
+    // The file's own position is unaffected.
+    parcBuffer_Clear(buffer);
+    parcRandomAccessFile_Read(instance, buffer);
+    parcBuffer_Flip(buffer);
+    assertTrue(memcmp(data, parcBuffer_Overlay(buffer, 0), 32) == 0, "Expected parcRandomAccessFile_Read to start at 0");
+
+    // Reading stops at the end of the file.
+    parcBuffer_Clear(buffer);
+    numBytes = parcRandomAccessFile_ReadAt(instance, buffer, 112);
+    assertTrue(numBytes == 16, "Expected 16 bytes to be read, but got %zd", numBytes);
+    parcBuffer_Clear(buffer);
+    numBytes = parcRandomAccessFile_ReadAt(instance, buffer, 1000);
+    assertTrue(numBytes == 0, "Expected 0 bytes to be read past the end of the file, but got %zd", numBytes);
+
+    parcBuffer_Release(&buffer);
+    parcRandomAccessFile_Close(instance);
+    parcRandomAccessFile_Release(&instance);
+}
+
+LONGBOW_TEST_CASE(Object, parcRandomAccessFile_WriteAt)
+{
+    char *fname = "tmpfile";
+
+    PARCFile *file = parcFile_Create(fname);
+
+    parcFile_CreateNewFile(file);
+
+    PARCRandomAccessFile *instance = parcRandomAccessFile_Open(file);
+    PARCBuffer *second = parcBuffer_WrapCString("World");
+    PARCBuffer *first = parcBuffer_WrapCString("Hello ");
+
+    ssize_t numBytes = parcRandomAccessFile_WriteAt(instance, second, 6);
+    assertTrue(numBytes == 5, "Expected 5 bytes to be written, but got %zd", numBytes);
+    numBytes = parcRandomAccessFile_WriteAt(instance, first, 0);
+    assertTrue(numBytes == 6, "Expected 6 bytes to be written, but got %zd", numBytes);
+    assertFalse(parcBuffer_HasRemaining(first), "Expected the buffer's position to be advanced");
+
+    PARCBuffer *buffer = parcBuffer_Allocate(11);
+    parcRandomAccessFile_ReadAt(instance, buffer, 0);
+    parcBuffer_Flip(buffer);
+    assertTrue(memcmp("Hello World", parcBuffer_Overlay(buffer, 0), 11) == 0, "Expected the bytes written");
+
+    parcBuffer_Release(&buffer);
+    parcBuffer_Release(&first);
+    parcBuffer_Release(&second);
+    parcRandomAccessFile_Close(instance);
+    parcRandomAccessFile_Release(&instance);
+    parcFile_Release(&file);
+}
+
+LONGBOW_TEST_CASE(Object, parcRandomAccessFile_SendAt)
+{
+    char *fname = "tmpfile";
+
+    PARCFile *file = parcFile_Create(fname);
+
+    parcFile_CreateNewFile(file);
+    FILE *fp = fopen(fname, "w");
+
+    uint8_t data[128];
+    for (int i = 0; i < 128; i++) {
+        data[i] = i;
+    }
+    fwrite(data, 1, 128, fp);
+    fclose(fp);
+
+    PARCRandomAccessFile *instance = parcRandomAccessFile_Open(file);
+    parcFile_Release(&file);
+
+    int fds[2];
+    assertTrue(pipe(fds) == 0, "pipe failed: %s", strerror(errno));
+
+    ssize_t numBytes = parcRandomAccessFile_SendAt(instance, fds[1], 32, 64);
+    assertTrue(numBytes == 64, "Expected 64 bytes to be sent, but got %zd", numBytes);
+
+    uint8_t received[128];
+    ssize_t numRead = read(fds[0], received, sizeof(received));
+    assertTrue(numRead == 64, "Expected 64 bytes to be received, but got %zd", numRead);
+    assertTrue(memcmp(&data[32], received, 64) == 0, "Expected the bytes at offset 32");
+
+    // The file's own position is unaffected.
+    PARCBuffer *buffer = parcBuffer_Allocate(32);
+    parcRandomAccessFile_Read(instance, buffer);
+    parcBuffer_Flip(buffer);
+    assertTrue(memcmp(data, parcBuffer_Overlay(buffer, 0), 32) == 0, "Expected parcRandomAccessFile_Read to start at 0");
+    parcBuffer_Release(&buffer);
+
+    // Sending stops at the end of the file.
+    numBytes = parcRandomAccessFile_SendAt(instance, fds[1], 112, 64);
+    assertTrue(numBytes == 16, "Expected 16 bytes to be sent, but got %zd", numBytes);
+    numRead = read(fds[0], received, sizeof(received));
+    assertTrue(numRead == 16, "Expected 16 bytes to be received, but got %zd", numRead);
+    assertTrue(memcmp(&data[112], received, 16) == 0, "Expected the last 16 bytes");
+    numBytes = parcRandomAccessFile_SendAt(instance, fds[1], 1000, 64);
+    assertTrue(numBytes == 0, "Expected 0 bytes to be sent past the end of the file, but got %zd", numBytes);
+
+    // An invalid destination is an error.
+    numBytes = parcRandomAccessFile_SendAt(instance, -1, 0, 64);
+    assertTrue(numBytes == -1, "Expected -1 for an invalid destination, but got %zd", numBytes);
+
+    close(fds[0]);
+    close(fds[1]);
+    parcRandomAccessFile_Close(instance);
+    parcRandomAccessFile_Release(&instance);
+}
+
 LONGBOW_TEST_CASE(Object, parcRandomAccessFile_Seek)
 {
     char *fname = "tmpfile";
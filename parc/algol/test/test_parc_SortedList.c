@@ -238,6 +238,9 @@ LONGBOW_TEST_FIXTURE(Specialization)
     LONGBOW_RUN_TEST_CASE(Specialization, parcSortedList_Add);
     LONGBOW_RUN_TEST_CASE(Specialization, parcSortedList_Remove);
     LONGBOW_RUN_TEST_CASE(Specialization, parcSortedList_GetAtIndex);
+    LONGBOW_RUN_TEST_CASE(Specialization, parcSortedList_Cursor);
+    LONGBOW_RUN_TEST_CASE(Specialization, parcSortedList_ForEach);
+    LONGBOW_RUN_TEST_CASE(Specialization, parcSortedList_CreateFromSorted);
 }
 
 LONGBOW_TEST_FIXTURE_SETUP(Specialization)
@@ -372,6 +375,88 @@ LONGBOW_TEST_CASE(Specialization, parcSortedList_GetAtIndex)
     parcSortedList_Release(&instance);
 }
 
+LONGBOW_TEST_CASE(Specialization, parcSortedList_Cursor)
+{
+    PARCSortedList *instance = parcSortedList_Create();
+    PARCBuffer *element1 = parcBuffer_WrapCString("1");
+    PARCBuffer *element2 = parcBuffer_WrapCString("2");
+    PARCBuffer *element3 = parcBuffer_WrapCString("3");
+
+    parcSortedList_Add(instance, element3);
+    parcSortedList_Add(instance, element1);
+    parcSortedList_Add(instance, element2);
+
+    PARCBuffer *expected[] = { element1, element2, element3 };
+
+    size_t index = 0;
+    PARCCursor cursor = parcSortedList_Cursor(instance);
+    while (parcSortedList_CursorHasNext(&cursor)) {
+        PARCBuffer *actual = parcSortedList_CursorNext(&cursor);
+        assertTrue(parcBuffer_Equals(expected[index], actual), "Got the wrong value at index %zd", index);
+        index++;
+    }
+    assertTrue(index == 3, "Expected 3 elements, actual %zd", index);
+
+    parcBuffer_Release(&element1);
+    parcBuffer_Release(&element2);
+    parcBuffer_Release(&element3);
+    parcSortedList_Release(&instance);
+}
+
+LONGBOW_TEST_CASE(Specialization, parcSortedList_ForEach)
+{
+    PARCSortedList *instance = parcSortedList_Create();
+    PARCBuffer *element1 = parcBuffer_WrapCString("1");
+    PARCBuffer *element2 = parcBuffer_WrapCString("2");
+    PARCBuffer *element3 = parcBuffer_WrapCString("3");
+
+    parcSortedList_Add(instance, element2);
+    parcSortedList_Add(instance, element3);
+    parcSortedList_Add(instance, element1);
+
+    PARCBuffer *expected[] = { element1, element2, element3 };
+
+    size_t index = 0;
+    PARCBuffer *actual;
+    parcSortedList_ForEach(instance, actual) {
+        assertTrue(parcBuffer_Equals(expected[index], actual), "Got the wrong value at index %zd", index);
+        index++;
+    }
+    assertTrue(index == 3, "Expected 3 elements, actual %zd", index);
+
+    parcBuffer_Release(&element1);
+    parcBuffer_Release(&element2);
+    parcBuffer_Release(&element3);
+    parcSortedList_Release(&instance);
+}
+
+LONGBOW_TEST_CASE(Specialization, parcSortedList_CreateFromSorted)
+{
+    PARCArrayList *elements = parcArrayList_Create((void (*)(void **))parcBuffer_Release);
+    parcArrayList_Add(elements, parcBuffer_WrapCString("3"));
+    parcArrayList_Add(elements, parcBuffer_WrapCString("1"));
+    parcArrayList_Add(elements, parcBuffer_WrapCString("2"));
+    parcArrayList_Add(elements, parcBuffer_WrapCString("2"));
+    parcArrayList_Sort(elements, parcObject_Compare);
+
+    PARCSortedList *instance = parcSortedList_CreateFromSorted(NULL, elements);
+
+    PARCSortedList *expected = parcSortedList_Create();
+    for (size_t i = 0; i < parcArrayList_Size(elements); i++) {
+        parcSortedList_Add(expected, parcArrayList_Get(elements, i));
+    }
+    assertTrue(parcSortedList_Equals(expected, instance), "Expected the bulk built list to equal the incrementally built list");
+
+    PARCBuffer *element = parcBuffer_WrapCString("0");
+    parcSortedList_Add(instance, element);
+    assertTrue(parcBuffer_Equals(element, parcSortedList_GetAtIndex(instance, 0)), "Expected Add to keep the list sorted");
+    parcBuffer_Release(&element);
+
+    parcSortedList_Release(&expected);
+    parcSortedList_Release(&instance);
+    parcArrayList_Destroy(&elements);
+}
+
 int
 main(int argc, char *argv[argc])
 {
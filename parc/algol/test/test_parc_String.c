@@ -97,6 +97,7 @@ LONGBOW_TEST_FIXTURE(Global)
     LONGBOW_RUN_TEST_CASE(Global, parcString_Equals);
     LONGBOW_RUN_TEST_CASE(Global, parcString_HashCode);
     LONGBOW_RUN_TEST_CASE(Global, parcString_IsValid);
+    LONGBOW_RUN_TEST_CASE(Global, parcString_IsValidUTF8);
     LONGBOW_RUN_TEST_CASE(Global, parcString_ToJSON);
     LONGBOW_RUN_TEST_CASE(Global, parcString_ToString);
 }
@@ -188,6 +189,17 @@ LONGBOW_TEST_CASE(Global, parcString_IsValid)
     assertFalse(parcString_IsValid(instance), "Expected parcString_Release to result in an invalid instance.");
 }
 
+LONGBOW_TEST_CASE(Global, parcString_IsValidUTF8)
+{
+    PARCString *instance = parcString_Create("Hello W\xC3\xB6rld \xE2\x82\xAC \xF0\x9F\x98\x80");
+    assertTrue(parcString_IsValidUTF8(instance), "Expected a well-formed string to be valid UTF-8.");
+    parcString_Release(&instance);
+
+    instance = parcString_Create("Hello W\xF6rld");
+    assertFalse(parcString_IsValidUTF8(instance), "Expected a Latin-1 string to be invalid UTF-8.");
+    parcString_Release(&instance);
+}
+
 LONGBOW_TEST_CASE(Global, parcString_ToJSON)
 {
     PARCString *instance = parcString_Create("Hello World");
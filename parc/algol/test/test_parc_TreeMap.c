@@ -180,6 +180,15 @@ LONGBOW_TEST_FIXTURE(Global)
     LONGBOW_RUN_TEST_CASE(Global, PARC_TreeMap_KeyIterator);
     LONGBOW_RUN_TEST_CASE(Global, PARC_TreeMap_Remove_Using_Iterator);
     LONGBOW_RUN_TEST_CASE(Global, PARC_TreeMap_Remove_Element_Using_Iterator);
+    LONGBOW_RUN_TEST_CASE(Global, PARC_TreeMap_Cursor);
+    LONGBOW_RUN_TEST_CASE(Global, PARC_TreeMap_Cursor_Empty);
+    LONGBOW_RUN_TEST_CASE(Global, PARC_TreeMap_ForEach);
+    LONGBOW_RUN_TEST_CASE(Global, PARC_TreeMap_ForEachKey);
+    LONGBOW_RUN_TEST_CASE(Global, PARC_TreeMap_ForEachValue);
+    LONGBOW_RUN_TEST_CASE(Global, PARC_TreeMap_CreateFromSorted);
+    LONGBOW_RUN_TEST_CASE(Global, PARC_TreeMap_CreateFromSorted_Empty);
+    LONGBOW_RUN_TEST_CASE(Global, PARC_TreeMap_CreateFromSorted_Custom);
+    LONGBOW_RUN_TEST_CASE(Global, PARC_TreeMap_CreateFromSorted_OutOfOrder);
 }
 
 #define N_TEST_ELEMENTS 42
@@ -1454,6 +1463,210 @@ LONGBOW_TEST_CASE(Global, PARC_TreeMap_Remove_Element_Using_Iterator)
     assertTrue(parcTreeMap_Equals(tree1, tree2), "Expect the trees to be equal after remove.");
 }
 
+LONGBOW_TEST_CASE(Global, PARC_TreeMap_Cursor)
+{
+    TestData *data = longBowTestCase_GetClipBoardData(testCase);
+    PARCTreeMap *tree1 = data->testMap1;
+
+    int idx1[15] = { 8, 4, 12, 2, 6, 10, 14, 1, 3, 5, 7, 9, 11, 13, 15 };
+
+    for (int i = 0; i < 15; i++) {
+        // Add some elements to the tree
+        parcTreeMap_Put(tree1, data->k[idx1[i]], data->v[idx1[i]]);
+    }
+
+    PARCCursor cursor = parcTreeMap_Cursor(tree1);
+
+    int idx = 1;
+    while (parcTreeMap_CursorHasNext(&cursor)) {
+        PARCKeyValue *kv = parcTreeMap_CursorNextEntry(&cursor);
+        assertTrue(_int_Equals((_Int *) parcKeyValue_GetKey(kv), data->k[idx]),
+                   "Expected value %d got %d",
+                   data->k[idx]->value,
+                   ((_Int *) parcKeyValue_GetKey(kv))->value);
+        idx++;
+    }
+    assertTrue(idx == 16, "Expected 15 entries, actual %d", idx - 1);
+}
+
+LONGBOW_TEST_CASE(Global, PARC_TreeMap_Cursor_Empty)
+{
+    TestData *data = longBowTestCase_GetClipBoardData(testCase);
+    PARCTreeMap *tree1 = data->testMap1;
+
+    PARCCursor cursor = parcTreeMap_Cursor(tree1);
+    assertFalse(parcTreeMap_CursorHasNext(&cursor), "Expected a cursor on an empty tree to not HaveNext");
+}
+
+LONGBOW_TEST_CASE(Global, PARC_TreeMap_ForEach)
+{
+    TestData *data = longBowTestCase_GetClipBoardData(testCase);
+    PARCTreeMap *tree1 = data->testMap1;
+
+    int idx1[15] = { 8, 4, 12, 2, 6, 10, 14, 1, 3, 5, 7, 9, 11, 13, 15 };
+
+    for (int i = 0; i < 15; i++) {
+        parcTreeMap_Put(tree1, data->k[idx1[i]], data->v[idx1[i]]);
+    }
+
+    int idx = 1;
+    PARCKeyValue *kv;
+    parcTreeMap_ForEach(tree1, kv) {
+        assertTrue(_int_Equals((_Int *) parcKeyValue_GetValue(kv), data->v[idx]),
+                   "Expected value %d got %d",
+                   data->v[idx]->value,
+                   ((_Int *) parcKeyValue_GetValue(kv))->value);
+        idx++;
+    }
+    assertTrue(idx == 16, "Expected 15 entries, actual %d", idx - 1);
+}
+
+LONGBOW_TEST_CASE(Global, PARC_TreeMap_ForEachKey)
+{
+    TestData *data = longBowTestCase_GetClipBoardData(testCase);
+    PARCTreeMap *tree1 = data->testMap1;
+
+    int idx1[15] = { 8, 4, 12, 2, 6, 10, 14, 1, 3, 5, 7, 9, 11, 13, 15 };
+
+    for (int i = 0; i < 15; i++) {
+        parcTreeMap_Put(tree1, data->k[idx1[i]], data->v[idx1[i]]);
+    }
+
+    int idx = 1;
+    _Int *key;
+    parcTreeMap_ForEachKey(tree1, key) {
+        assertTrue(_int_Equals(key, data->k[idx]), "Expected value %d got %d", data->k[idx]->value, key->value);
+        idx++;
+    }
+    assertTrue(idx == 16, "Expected 15 keys, actual %d", idx - 1);
+}
+
+LONGBOW_TEST_CASE(Global, PARC_TreeMap_ForEachValue)
+{
+    TestData *data = longBowTestCase_GetClipBoardData(testCase);
+    PARCTreeMap *tree1 = data->testMap1;
+
+    int idx1[15] = { 8, 4, 12, 2, 6, 10, 14, 1, 3, 5, 7, 9, 11, 13, 15 };
+
+    for (int i = 0; i < 15; i++) {
+        parcTreeMap_Put(tree1, data->k[idx1[i]], data->v[idx1[i]]);
+    }
+
+    int idx = 1;
+    _Int *value;
+    parcTreeMap_ForEachValue(tree1, value) {
+        assertTrue(_int_Equals(value, data->v[idx]), "Expected value %d got %d", data->v[idx]->value, value->value);
+        idx++;
+    }
+    assertTrue(idx == 16, "Expected 15 values, actual %d", idx - 1);
+}
+
+// Returns the number of black nodes on every path below node, or -1 if the paths disagree or a red node has a red child.
+static int
+_blackHeight(const PARCTreeMap *tree, const _RBNode *node)
+{
+    if (node == tree->nil) {
+        return 1;
+    }
+    if (_rbNodeColor(node) == RED) {
+        if (_rbNodeColor(node->leftChild) == RED || _rbNodeColor(node->rightChild) == RED) {
+            return -1;
+        }
+    }
+    int left = _blackHeight(tree, node->leftChild);
+    int right = _blackHeight(tree, node->rightChild);
+    if (left < 0 || left != right) {
+        return -1;
+    }
+    return left + (_rbNodeColor(node) == BLACK ? 1 : 0);
+}
+
+static PARCArrayList *
+_createSortedKeyValues(TestData *data, int count)
+{
+    PARCArrayList *keyValues = parcArrayList_Create((void (*)(void **))parcKeyValue_Release);
+    for (int i = 0; i < count; i++) {
+        parcArrayList_Add(keyValues, parcKeyValue_Create(data->k[i], data->v[i]));
+    }
+    return keyValues;
+}
+
+LONGBOW_TEST_CASE(Global, PARC_TreeMap_CreateFromSorted)
+{
+    TestData *data = longBowTestCase_GetClipBoardData(testCase);
+
+    for (int count = 1; count <= N_TEST_ELEMENTS; count++) {
+        PARCArrayList *keyValues = _createSortedKeyValues(data, count);
+        PARCTreeMap *tree = parcTreeMap_CreateFromSorted(NULL, keyValues);
+        parcArrayList_Destroy(&keyValues);
+
+        assertTrue(parcTreeMap_Size(tree) == count, "Expected size %d, actual %zd", count, parcTreeMap_Size(tree));
+        assertTrue(_rbNodeColor(tree->root) == BLACK, "The root must be black");
+        assertTrue(_blackHeight(tree, tree->root) > 0, "Red-black properties violated for %d elements", count);
+
+        PARCTreeMap *expected = parcTreeMap_Create();
+        for (int i = 0; i < count; i++) {
+            parcTreeMap_Put(expected, data->k[i], data->v[i]);
+        }
+        assertTrue(parcTreeMap_Equals(expected, tree), "Expected the bulk built tree to equal the incrementally built tree");
+        parcTreeMap_Release(&expected);
+
+        // The tree must remain a valid red-black tree under further modification.
+        for (int i = 0; i < count; i += 2) {
+            parcTreeMap_RemoveAndRelease(tree, data->k[i]);
+        }
+        assertTrue(_blackHeight(tree, tree->root) > 0, "Red-black properties violated after removal for %d elements", count);
+        assertTrue(parcTreeMap_Size(tree) == count / 2, "Expected size %d, actual %zd", count / 2, parcTreeMap_Size(tree));
+
+        parcTreeMap_Release(&tree);
+    }
+}
+
+LONGBOW_TEST_CASE(Global, PARC_TreeMap_CreateFromSorted_Empty)
+{
+    PARCArrayList *keyValues = parcArrayList_Create((void (*)(void **))parcKeyValue_Release);
+    PARCTreeMap *tree = parcTreeMap_CreateFromSorted(NULL, keyValues);
+    parcArrayList_Destroy(&keyValues);
+
+    assertTrue(parcTreeMap_Size(tree) == 0, "Expected an empty tree, actual size %zd", parcTreeMap_Size(tree));
+    assertNull(parcTreeMap_GetFirstKey(tree), "Expected no first key in an empty tree");
+
+    parcTreeMap_Release(&tree);
+}
+
+LONGBOW_TEST_CASE(Global, PARC_TreeMap_CreateFromSorted_Custom)
+{
+    TestData *data = longBowTestCase_GetClipBoardData(testCase);
+
+    PARCArrayList *keyValues = _createSortedKeyValues(data, N_TEST_ELEMENTS);
+    PARCTreeMap *tree = parcTreeMap_CreateFromSorted((PARCTreeMap_CustomCompare *) _int_Compare, keyValues);
+    parcArrayList_Destroy(&keyValues);
+
+    for (int i = 0; i < N_TEST_ELEMENTS; i++) {
+        _Int *value = parcTreeMap_Get(tree, data->k[i]);
+        assertTrue(_int_Equals(value, data->v[i]), "Expected value %d for key %d", data->v[i]->value, i);
+    }
+
+    parcTreeMap_Put(tree, data->k[3], data->v[5]);
+    assertTrue(_int_Equals(parcTreeMap_Get(tree, data->k[3]), data->v[5]), "Expected Put to replace the bulk built value");
+
+    parcTreeMap_Release(&tree);
+}
+
+LONGBOW_TEST_CASE_EXPECTS(Global, PARC_TreeMap_CreateFromSorted_OutOfOrder, .event = &LongBowTrapIllegalValue)
+{
+    TestData *data = longBowTestCase_GetClipBoardData(testCase);
+
+    PARCArrayList *keyValues = parcArrayList_Create((void (*)(void **))parcKeyValue_Release);
+    parcArrayList_Add(keyValues, parcKeyValue_Create(data->k[2], data->v[2]));
+    parcArrayList_Add(keyValues, parcKeyValue_Create(data->k[1], data->v[1]));
+
+    PARCTreeMap *tree = parcTreeMap_CreateFromSorted(NULL, keyValues);
+
+    parcTreeMap_Release(&tree);
+    parcArrayList_Destroy(&keyValues);
+}
+
 LONGBOW_TEST_FIXTURE(Local)
 {
     //LONGBOW_RUN_TEST_CASE(Local, PARC_TreeMap_EnsureRemaining_NonEmpty);
@@ -0,0 +1,225 @@
+/*
+ * Copyright (c) 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Patent rights are not granted under this agreement. Patent rights are
+ *       available under FRAND terms.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX or PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * @copyright 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC).  All rights reserved.
+ */
+// Include the file(s) containing the functions to be tested.
+// This permits internal static functions to be visible to this Test Framework.
+#include "../parc_UTF8.c"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/time.h>
+
+#include <LongBow/testing.h>
+#include <LongBow/debugging.h>
+
+typedef struct {
+    const char *name;
+    const char *bytes;
+    bool valid;
+} _TestCase;
+
+static const _TestCase _cases[] = {
+    { "empty",                  "",                         true  },
+    { "ASCII",                  "Hello World",              true  },
+    { "2-byte",                 "caf\xC3\xA9",              true  },
+    { "3-byte",                 "\xE2\x82\xAC",             true  },
+    { "4-byte",                 "\xF0\x9F\x98\x80",         true  },
+    { "largest 2-byte",         "\xDF\xBF",                 true  },
+    { "before surrogates",      "\xED\x9F\xBF",             true  },
+    { "after surrogates",       "\xEE\x80\x80",             true  },
+    { "U+10FFFF",               "\xF4\x8F\xBF\xBF",         true  },
+    { "stray continuation",     "a\x80" "b",                false },
+    { "truncated 2-byte",       "\xC3",                     false },
+    { "truncated 3-byte",       "\xE2\x82",                 false },
+    { "truncated 4-byte",       "\xF0\x9F\x98",             false },
+    { "lead then ASCII",        "\xE2" "ab",                false },
+    { "overlong 2-byte",        "\xC0\xAF",                 false },
+    { "overlong 2-byte C1",     "\xC1\xBF",                 false },
+    { "overlong 3-byte",        "\xE0\x80\xAF",             false },
+    { "overlong 4-byte",        "\xF0\x80\x80\xAF",         false },
+    { "surrogate",              "\xED\xA0\x80",             false },
+    { "above U+10FFFF",         "\xF4\x90\x80\x80",         false },
+    { "F5 lead",                "\xF5\x80\x80\x80",         false },
+    { "FF",                     "\xFF",                     false },
+    { "extra continuation",     "\xC3\xA9\xA9",             false },
+};
+
+LONGBOW_TEST_RUNNER(parc_UTF8)
+{
+    LONGBOW_RUN_TEST_FIXTURE(Global);
+    LONGBOW_RUN_TEST_FIXTURE(Performance);
+}
+
+LONGBOW_TEST_RUNNER_SETUP(parc_UTF8)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_RUNNER_TEARDOWN(parc_UTF8)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_FIXTURE(Global)
+{
+    LONGBOW_RUN_TEST_CASE(Global, parcUTF8_IsValid);
+    LONGBOW_RUN_TEST_CASE(Global, parcUTF8_IsValid_AtEveryOffset);
+    LONGBOW_RUN_TEST_CASE(Global, parcUTF8_IsValid_MatchesScalar);
+}
+
+LONGBOW_TEST_FIXTURE_SETUP(Global)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_FIXTURE_TEARDOWN(Global)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_CASE(Global, parcUTF8_IsValid)
+{
+    for (size_t i = 0; i < sizeof(_cases) / sizeof(_cases[0]); i++) {
+        const uint8_t *bytes = (const uint8_t *) _cases[i].bytes;
+        size_t length = strlen(_cases[i].bytes);
+        assertTrue(parcUTF8_IsValid(length, bytes) == _cases[i].valid,
+                   "Expected %s to be %s", _cases[i].name, _cases[i].valid ? "valid" : "invalid");
+        assertTrue(_parcUTF8_IsValidScalar(length, bytes) == _cases[i].valid,
+                   "Expected %s to be %s without vector instructions", _cases[i].name, _cases[i].valid ? "valid" : "invalid");
+    }
+}
+
+LONGBOW_TEST_CASE(Global, parcUTF8_IsValid_AtEveryOffset)
+{
+    // Place each case at every offset in ASCII text, so that it straddles each block boundary and the end.
+    uint8_t text[80];
+    for (size_t i = 0; i < sizeof(_cases) / sizeof(_cases[0]); i++) {
+        size_t length = strlen(_cases[i].bytes);
+        for (size_t offset = 0; offset + length <= 40; offset++) {
+            for (size_t end = offset + length; end <= 40; end += 7) {
+                memset(text, 'x', sizeof(text));
+                memcpy(&text[offset], _cases[i].bytes, length);
+                assertTrue(parcUTF8_IsValid(end, text) == _cases[i].valid,
+                           "Expected %s at offset %zu of %zu bytes to be %s",
+                           _cases[i].name, offset, end, _cases[i].valid ? "valid" : "invalid");
+            }
+        }
+    }
+}
+
+LONGBOW_TEST_CASE(Global, parcUTF8_IsValid_MatchesScalar)
+{
+    // Random mixtures of ASCII, lead and continuation bytes, mostly invalid but often only barely.
+    static const uint8_t alphabet[] = {
+        'a', 'b', 0x00, 0x7F, 0x80, 0x8F, 0x90, 0x9F, 0xA0, 0xBF, 0xC0, 0xC2, 0xDF,
+        0xE0, 0xE1, 0xED, 0xEF, 0xF0, 0xF1, 0xF4, 0xF5, 0xFF
+    };
+    srandom(1);
+    uint8_t text[64];
+    size_t valid = 0;
+    for (int trial = 0; trial < 200000; trial++) {
+        size_t length = (size_t) (random() % sizeof(text));
+        for (size_t i = 0; i < length; i++) {
+            text[i] = alphabet[random() % sizeof(alphabet)];
+        }
+        bool expected = _parcUTF8_IsValidScalar(length, text);
+        valid += expected;
+        assertTrue(parcUTF8_IsValid(length, text) == expected, "Disagreement with the scalar validator, trial %d", trial);
+    }
+    assertTrue(valid > 0, "Expected some random texts to be valid");
+}
+
+LONGBOW_TEST_FIXTURE_OPTIONS(Performance, .enabled = false)
+{
+    LONGBOW_RUN_TEST_CASE(Performance, Validate);
+}
+
+LONGBOW_TEST_FIXTURE_SETUP(Performance)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_FIXTURE_TEARDOWN(Performance)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+static double
+_seconds(const struct timeval *start, const struct timeval *end)
+{
+    struct timeval elapsed;
+    timersub(end, start, &elapsed);
+    return elapsed.tv_sec + elapsed.tv_usec / 1000000.0;
+}
+
+LONGBOW_TEST_CASE(Performance, Validate)
+{
+    // 1 MiB of ASCII, and of text in which every fourth character is a 2-, 3- or 4-byte sequence.
+    size_t length = 1024 * 1024;
+    uint8_t *ascii = malloc(length);
+    uint8_t *mixed = malloc(length);
+    memset(ascii, 'x', length);
+    static const char *sequences[] = { "abc", "\xC3\xA9", "\xE2\x82\xAC", "\xF0\x9F\x98\x80" };
+    size_t filled = 0;
+    for (size_t i = 0; filled + 4 <= length; i++) {
+        const char *sequence = sequences[i % 4];
+        memcpy(&mixed[filled], sequence, strlen(sequence));
+        filled += strlen(sequence);
+    }
+    memset(&mixed[filled], 'x', length - filled);
+
+    int rounds = 200;
+    const char *names[] = { "ASCII", "mixed" };
+    uint8_t *texts[] = { ascii, mixed };
+    for (int t = 0; t < 2; t++) {
+        for (int vector = 0; vector < 2; vector++) {
+            struct timeval start, end;
+            gettimeofday(&start, NULL);
+            for (int round = 0; round < rounds; round++) {
+                bool valid = vector ? parcUTF8_IsValid(length, texts[t]) : _parcUTF8_IsValidScalar(length, texts[t]);
+                assertTrue(valid, "Expected the %s text to be valid", names[t]);
+            }
+            gettimeofday(&end, NULL);
+            double seconds = _seconds(&start, &end);
+            printf("%-6s %-7s %.0f MB/s\n", names[t], vector ? "vector" : "scalar", rounds * (double) length / seconds / 1000000.0);
+        }
+    }
+
+    free(ascii);
+    free(mixed);
+}
+
+int
+main(int argc, char *argv[argc])
+{
+    LongBowRunner *testRunner = LONGBOW_TEST_RUNNER_CREATE(parc_UTF8);
+    int exitStatus = LONGBOW_TEST_MAIN(argc, argv, testRunner);
+    longBowTestRunner_Destroy(&testRunner);
+    exit(exitStatus);
+}
@@ -0,0 +1,279 @@
+/*
+ * Copyright (c) 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Patent rights are not granted under this agreement. Patent rights are
+ *       available under FRAND terms.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX or PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * @copyright 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC).  All rights reserved.
+ */
+#include <config.h>
+
+#include <pthread.h>
+
+#include <LongBow/runtime.h>
+
+#include <parc/algol/parc_Object.h>
+#include <parc/algol/parc_Memory.h>
+
+#include <parc/concurrent/parc_ConcurrentCache.h>
+
+#define _PARCConcurrentCache_DefaultStripeCount 16
+
+typedef struct {
+    pthread_mutex_t lock;
+    PARCCache *cache;
+} _PARCConcurrentCacheStripe;
+
+struct PARCConcurrentCache {
+    size_t stripeCount;
+    _PARCConcurrentCacheStripe *stripes;
+};
+
+/*
+ * Select a stripe from the high bits of a multiplicative hash, so that the keys within a stripe
+ * remain evenly spread over the stripe's own buckets, which are indexed by the low bits.
+ */
+static _PARCConcurrentCacheStripe *
+_parcConcurrentCache_Stripe(const PARCConcurrentCache *cache, const PARCObject *key)
+{
+    uint64_t mixed = (uint64_t) parcObject_HashCode(key) * 0x9E3779B97F4A7C15ULL;
+    return &cache->stripes[(mixed >> 32) % cache->stripeCount];
+}
+
+static void
+_parcConcurrentCache_Finalize(PARCConcurrentCache **instancePtr)
+{
+    assertNotNull(instancePtr, "Parameter must be a non-null pointer to a PARCConcurrentCache pointer.");
+    PARCConcurrentCache *cache = *instancePtr;
+
+    for (size_t i = 0; i < cache->stripeCount; i++) {
+        parcCache_Release(&cache->stripes[i].cache);
+        pthread_mutex_destroy(&cache->stripes[i].lock);
+    }
+    parcMemory_Deallocate((void **) &cache->stripes);
+}
+
+parcObject_ImplementAcquire(parcConcurrentCache, PARCConcurrentCache);
+
+parcObject_ImplementRelease(parcConcurrentCache, PARCConcurrentCache);
+
+parcObject_ExtendPARCObject(PARCConcurrentCache, _parcConcurrentCache_Finalize, NULL, NULL, NULL, NULL, NULL, NULL);
+
+void
+parcConcurrentCache_AssertValid(const PARCConcurrentCache *instance)
+{
+    assertTrue(parcConcurrentCache_IsValid(instance),
+               "PARCConcurrentCache is not valid.");
+}
+
+bool
+parcConcurrentCache_IsValid(const PARCConcurrentCache *instance)
+{
+    bool result = false;
+
+    if (instance != NULL) {
+        result = instance->stripeCount > 0 && instance->stripes != NULL;
+    }
+
+    return result;
+}
+
+PARCConcurrentCache *
+parcConcurrentCache_CreateWithClock(size_t capacity, size_t stripeCount, const PARCClock *clock)
+{
+    trapIllegalValueIf(capacity == 0, "The capacity of a PARCConcurrentCache must be greater than zero.");
+
+    if (stripeCount == 0) {
+        stripeCount = _PARCConcurrentCache_DefaultStripeCount;
+    }
+    if (stripeCount > capacity) {
+        stripeCount = capacity;
+    }
+
+    PARCConcurrentCache *result = parcObject_CreateInstance(PARCConcurrentCache);
+
+    if (result != NULL) {
+        result->stripeCount = stripeCount;
+        result->stripes = parcMemory_Allocate(stripeCount * sizeof(_PARCConcurrentCacheStripe));
+        assertNotNull(result->stripes, "parcMemory_Allocate(%zu) returned NULL", stripeCount * sizeof(_PARCConcurrentCacheStripe));
+
+        size_t stripeCapacity = (capacity + stripeCount - 1) / stripeCount;
+        for (size_t i = 0; i < stripeCount; i++) {
+            pthread_mutex_init(&result->stripes[i].lock, NULL);
+            result->stripes[i].cache = parcCache_CreateWithClock(stripeCapacity, clock);
+        }
+    }
+
+    return result;
+}
+
+PARCConcurrentCache *
+parcConcurrentCache_Create(size_t capacity, size_t stripeCount)
+{
+    PARCClock *clock = parcClock_Monotonic();
+    PARCConcurrentCache *result = parcConcurrentCache_CreateWithClock(capacity, stripeCount, clock);
+    parcClock_Release(&clock);
+
+    return result;
+}
+
+void
+parcConcurrentCache_SetEvictionCallback(PARCConcurrentCache *cache, PARCCacheEvictionCallback *callback, void *context)
+{
+    parcConcurrentCache_OptionalAssertValid(cache);
+
+    for (size_t i = 0; i < cache->stripeCount; i++) {
+        pthread_mutex_lock(&cache->stripes[i].lock);
+        parcCache_SetEvictionCallback(cache->stripes[i].cache, callback, context);
+        pthread_mutex_unlock(&cache->stripes[i].lock);
+    }
+}
+
+void
+parcConcurrentCache_PutWithTimeToLive(PARCConcurrentCache *cache, const PARCObject *key, const PARCObject *value, uint64_t timeToLive)
+{
+    parcConcurrentCache_OptionalAssertValid(cache);
+
+    _PARCConcurrentCacheStripe *stripe = _parcConcurrentCache_Stripe(cache, key);
+
+    pthread_mutex_lock(&stripe->lock);
+    parcCache_PutWithTimeToLive(stripe->cache, key, value, timeToLive);
+    pthread_mutex_unlock(&stripe->lock);
+}
+
+void
+parcConcurrentCache_Put(PARCConcurrentCache *cache, const PARCObject *key, const PARCObject *value)
+{
+    parcConcurrentCache_PutWithTimeToLive(cache, key, value, 0);
+}
+
+PARCObject *
+parcConcurrentCache_Get(PARCConcurrentCache *cache, const PARCObject *key)
+{
+    parcConcurrentCache_OptionalAssertValid(cache);
+
+    PARCObject *result = NULL;
+
+    _PARCConcurrentCacheStripe *stripe = _parcConcurrentCache_Stripe(cache, key);
+
+    pthread_mutex_lock(&stripe->lock);
+    const PARCObject *value = parcCache_Get(stripe->cache, key);
+    if (value != NULL) {
+        result = parcObject_Acquire(value);
+    }
+    pthread_mutex_unlock(&stripe->lock);
+
+    return result;
+}
+
+bool
+parcConcurrentCache_Remove(PARCConcurrentCache *cache, const PARCObject *key)
+{
+    parcConcurrentCache_OptionalAssertValid(cache);
+
+    _PARCConcurrentCacheStripe *stripe = _parcConcurrentCache_Stripe(cache, key);
+
+    pthread_mutex_lock(&stripe->lock);
+    bool result = parcCache_Remove(stripe->cache, key);
+    pthread_mutex_unlock(&stripe->lock);
+
+    return result;
+}
+
+void
+parcConcurrentCache_Clear(PARCConcurrentCache *cache)
+{
+    parcConcurrentCache_OptionalAssertValid(cache);
+
+    for (size_t i = 0; i < cache->stripeCount; i++) {
+        pthread_mutex_lock(&cache->stripes[i].lock);
+        parcCache_Clear(cache->stripes[i].cache);
+        pthread_mutex_unlock(&cache->stripes[i].lock);
+    }
+}
+
+/*
+ * Sum a per-stripe quantity, locking each stripe in turn.
+ */
+static uint64_t
+_parcConcurrentCache_Sum(const PARCConcurrentCache *cache, uint64_t (*getter)(const PARCCache *cache))
+{
+    parcConcurrentCache_OptionalAssertValid(cache);
+
+    uint64_t result = 0;
+    for (size_t i = 0; i < cache->stripeCount; i++) {
+        pthread_mutex_lock(&cache->stripes[i].lock);
+        result += getter(cache->stripes[i].cache);
+        pthread_mutex_unlock(&cache->stripes[i].lock);
+    }
+    return result;
+}
+
+static uint64_t
+_parcConcurrentCache_StripeSize(const PARCCache *cache)
+{
+    return parcCache_Size(cache);
+}
+
+static uint64_t
+_parcConcurrentCache_StripeCapacity(const PARCCache *cache)
+{
+    return parcCache_Capacity(cache);
+}
+
+size_t
+parcConcurrentCache_Size(const PARCConcurrentCache *cache)
+{
+    return (size_t) _parcConcurrentCache_Sum(cache, _parcConcurrentCache_StripeSize);
+}
+
+size_t
+parcConcurrentCache_Capacity(const PARCConcurrentCache *cache)
+{
+    return (size_t) _parcConcurrentCache_Sum(cache, _parcConcurrentCache_StripeCapacity);
+}
+
+uint64_t
+parcConcurrentCache_GetHits(const PARCConcurrentCache *cache)
+{
+    return _parcConcurrentCache_Sum(cache, parcCache_GetHits);
+}
+
+uint64_t
+parcConcurrentCache_GetMisses(const PARCConcurrentCache *cache)
+{
+    return _parcConcurrentCache_Sum(cache, parcCache_GetMisses);
+}
+
+uint64_t
+parcConcurrentCache_GetEvictions(const PARCConcurrentCache *cache)
+{
+    return _parcConcurrentCache_Sum(cache, parcCache_GetEvictions);
+}
+
+uint64_t
+parcConcurrentCache_GetExpirations(const PARCConcurrentCache *cache)
+{
+    return _parcConcurrentCache_Sum(cache, parcCache_GetExpirations);
+}
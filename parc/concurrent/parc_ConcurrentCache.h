@@ -0,0 +1,400 @@
+/*
+ * Copyright (c) 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Patent rights are not granted under this agreement. Patent rights are
+ *       available under FRAND terms.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX or PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * @file parc_ConcurrentCache.h
+ * @brief A thread-safe, lock-striped bounded key/value cache.
+ *
+ * A `PARCConcurrentCache` partitions its entries across a number of stripes by key hash.
+ * Each stripe is an independent `PARCCache` guarded by its own mutex, so threads operating
+ * on keys in different stripes do not contend.
+ *
+ * The capacity is divided evenly between the stripes, so eviction is per-stripe:
+ * an entry may be evicted from a full stripe while other stripes have room.
+ *
+ * Unlike `parcCache_Get`, `parcConcurrentCache_Get` returns a reference that the caller must release,
+ * since another thread may evict the entry as soon as the stripe is unlocked.
+ *
+ * @copyright 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC).  All rights reserved.
+ */
+#ifndef PARCLibrary_parc_ConcurrentCache
+#define PARCLibrary_parc_ConcurrentCache
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <parc/algol/parc_Cache.h>
+
+struct PARCConcurrentCache;
+typedef struct PARCConcurrentCache PARCConcurrentCache;
+
+#ifdef PARCLibrary_DISABLE_VALIDATION
+#  define parcConcurrentCache_OptionalAssertValid(_instance_)
+#else
+#  define parcConcurrentCache_OptionalAssertValid(_instance_) parcConcurrentCache_AssertValid(_instance_)
+#endif
+
+/**
+ * Create a `PARCConcurrentCache` holding approximately @p capacity entries across @p stripeCount stripes,
+ * with time-to-live measured by `parcClock_Monotonic()`.
+ *
+ * Each stripe holds at most @p capacity divided by @p stripeCount entries, rounded up.
+ *
+ * @param [in] capacity The maximum number of entries. Must be greater than zero.
+ * @param [in] stripeCount The number of independently locked stripes, or 0 for a default.
+ *
+ * @return non-NULL A pointer to a valid PARCConcurrentCache instance.
+ * @return NULL An error occurred.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCConcurrentCache *cache = parcConcurrentCache_Create(100000, 16);
+ *
+ *     parcConcurrentCache_Release(&cache);
+ * }
+ * @endcode
+ */
+PARCConcurrentCache *parcConcurrentCache_Create(size_t capacity, size_t stripeCount);
+
+/**
+ * Create a `PARCConcurrentCache` with time-to-live measured by the given `PARCClock`.
+ *
+ * The clock is shared by all stripes and must be safe to call from multiple threads.
+ *
+ * @param [in] capacity The maximum number of entries. Must be greater than zero.
+ * @param [in] stripeCount The number of independently locked stripes, or 0 for a default.
+ * @param [in] clock A pointer to a valid PARCClock instance.
+ *
+ * @return non-NULL A pointer to a valid PARCConcurrentCache instance.
+ * @return NULL An error occurred.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCClock *clock = parcClock_Counter();
+ *     PARCConcurrentCache *cache = parcConcurrentCache_CreateWithClock(100000, 16, clock);
+ *     parcClock_Release(&clock);
+ *
+ *     parcConcurrentCache_Release(&cache);
+ * }
+ * @endcode
+ */
+PARCConcurrentCache *parcConcurrentCache_CreateWithClock(size_t capacity, size_t stripeCount, const PARCClock *clock);
+
+/**
+ * Increase the number of references to a `PARCConcurrentCache` instance.
+ *
+ * @param [in] instance A pointer to a valid PARCConcurrentCache instance.
+ *
+ * @return The same value as @p instance.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCConcurrentCache *a = parcConcurrentCache_Create(10, 0);
+ *
+ *     PARCConcurrentCache *b = parcConcurrentCache_Acquire(a);
+ *
+ *     parcConcurrentCache_Release(&a);
+ *     parcConcurrentCache_Release(&b);
+ * }
+ * @endcode
+ */
+PARCConcurrentCache *parcConcurrentCache_Acquire(const PARCConcurrentCache *instance);
+
+/**
+ * Release a previously acquired reference to the given `PARCConcurrentCache` instance,
+ * decrementing the reference count for the instance.
+ *
+ * The pointer to the instance is set to NULL as a side-effect of this function.
+ *
+ * @param [in,out] instancePtr A pointer to a pointer to the instance to release.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCConcurrentCache *a = parcConcurrentCache_Create(10, 0);
+ *
+ *     parcConcurrentCache_Release(&a);
+ * }
+ * @endcode
+ */
+void parcConcurrentCache_Release(PARCConcurrentCache **instancePtr);
+
+/**
+ * Determine if an instance of `PARCConcurrentCache` is valid.
+ *
+ * @param [in] instance A pointer to a PARCConcurrentCache instance.
+ *
+ * @return true The instance is valid.
+ * @return false The instance is not valid.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCConcurrentCache *a = parcConcurrentCache_Create(10, 0);
+ *
+ *     if (parcConcurrentCache_IsValid(a)) {
+ *         printf("Instance is valid.\n");
+ *     }
+ *
+ *     parcConcurrentCache_Release(&a);
+ * }
+ * @endcode
+ */
+bool parcConcurrentCache_IsValid(const PARCConcurrentCache *instance);
+
+/**
+ * Assert that the given `PARCConcurrentCache` instance is valid.
+ *
+ * @param [in] instance A pointer to a valid PARCConcurrentCache instance.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCConcurrentCache *a = parcConcurrentCache_Create(10, 0);
+ *
+ *     parcConcurrentCache_AssertValid(a);
+ *
+ *     parcConcurrentCache_Release(&a);
+ * }
+ * @endcode
+ */
+void parcConcurrentCache_AssertValid(const PARCConcurrentCache *instance);
+
+/**
+ * Set the function to call when an entry is evicted from any stripe.
+ *
+ * The callback is invoked while the stripe's lock is held, possibly from several threads at once.
+ * It must not call back into the cache.
+ *
+ * @param [in] cache A pointer to a valid PARCConcurrentCache instance.
+ * @param [in] callback The function to call, or NULL to disable the callback.
+ * @param [in] context An opaque pointer passed to every invocation of @p callback.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCConcurrentCache *cache = parcConcurrentCache_Create(10, 0);
+ *     parcConcurrentCache_SetEvictionCallback(cache, _evicted, NULL);
+ *
+ *     parcConcurrentCache_Release(&cache);
+ * }
+ * @endcode
+ */
+void parcConcurrentCache_SetEvictionCallback(PARCConcurrentCache *cache, PARCCacheEvictionCallback *callback, void *context);
+
+/**
+ * Associate the specified value with the specified key, with no time-to-live.
+ *
+ * @param [in] cache A pointer to a valid PARCConcurrentCache instance.
+ * @param [in] key A pointer to a valid PARCObject to use as the key.
+ * @param [in] value A pointer to a valid PARCObject to use as the value.
+ *
+ * Example:
+ * @code
+ * {
+ *     parcConcurrentCache_Put(cache, key, value);
+ * }
+ * @endcode
+ *
+ * @see parcCache_Put
+ */
+void parcConcurrentCache_Put(PARCConcurrentCache *cache, const PARCObject *key, const PARCObject *value);
+
+/**
+ * Associate the specified value with the specified key, expiring after @p timeToLive clock units.
+ *
+ * @param [in] cache A pointer to a valid PARCConcurrentCache instance.
+ * @param [in] key A pointer to a valid PARCObject to use as the key.
+ * @param [in] value A pointer to a valid PARCObject to use as the value.
+ * @param [in] timeToLive The lifetime of the entry in clock units, or zero for no expiry.
+ *
+ * Example:
+ * @code
+ * {
+ *     parcConcurrentCache_PutWithTimeToLive(cache, key, value, 5000);
+ * }
+ * @endcode
+ *
+ * @see parcCache_PutWithTimeToLive
+ */
+void parcConcurrentCache_PutWithTimeToLive(PARCConcurrentCache *cache, const PARCObject *key, const PARCObject *value, uint64_t timeToLive);
+
+/**
+ * Get a reference to the value associated with the given key.
+ *
+ * The caller must release the returned value.
+ *
+ * @param [in] cache A pointer to a valid PARCConcurrentCache instance.
+ * @param [in] key A pointer to a valid PARCObject.
+ *
+ * @return non-NULL An acquired reference to the value associated with @p key.
+ * @return NULL The cache has no unexpired entry for @p key.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCBuffer *value = parcConcurrentCache_Get(cache, key);
+ *     if (value != NULL) {
+ *         ...
+ *         parcBuffer_Release(&value);
+ *     }
+ * }
+ * @endcode
+ */
+PARCObject *parcConcurrentCache_Get(PARCConcurrentCache *cache, const PARCObject *key);
+
+/**
+ * Remove the entry for the given key, if present.
+ *
+ * @param [in] cache A pointer to a valid PARCConcurrentCache instance.
+ * @param [in] key A pointer to a valid PARCObject.
+ *
+ * @return true An entry for @p key was removed.
+ * @return false The cache has no entry for @p key.
+ *
+ * Example:
+ * @code
+ * {
+ *     parcConcurrentCache_Remove(cache, key);
+ * }
+ * @endcode
+ */
+bool parcConcurrentCache_Remove(PARCConcurrentCache *cache, const PARCObject *key);
+
+/**
+ * Remove all entries from the given `PARCConcurrentCache`.
+ *
+ * @param [in] cache A pointer to a valid PARCConcurrentCache instance.
+ *
+ * Example:
+ * @code
+ * {
+ *     parcConcurrentCache_Clear(cache);
+ * }
+ * @endcode
+ */
+void parcConcurrentCache_Clear(PARCConcurrentCache *cache);
+
+/**
+ * Get the number of entries across all stripes.
+ *
+ * The stripes are examined one at a time, so the result is approximate while other threads are modifying the cache.
+ *
+ * @param [in] cache A pointer to a valid PARCConcurrentCache instance.
+ *
+ * @return The number of entries.
+ *
+ * Example:
+ * @code
+ * {
+ *     size_t size = parcConcurrentCache_Size(cache);
+ * }
+ * @endcode
+ */
+size_t parcConcurrentCache_Size(const PARCConcurrentCache *cache);
+
+/**
+ * Get the total capacity of all stripes.
+ *
+ * @param [in] cache A pointer to a valid PARCConcurrentCache instance.
+ *
+ * @return The capacity of the cache.
+ *
+ * Example:
+ * @code
+ * {
+ *     size_t capacity = parcConcurrentCache_Capacity(cache);
+ * }
+ * @endcode
+ */
+size_t parcConcurrentCache_Capacity(const PARCConcurrentCache *cache);
+
+/**
+ * Get the number of lookups, across all stripes, that found an unexpired entry.
+ *
+ * @param [in] cache A pointer to a valid PARCConcurrentCache instance.
+ *
+ * @return The number of hits.
+ *
+ * Example:
+ * @code
+ * {
+ *     uint64_t hits = parcConcurrentCache_GetHits(cache);
+ * }
+ * @endcode
+ */
+uint64_t parcConcurrentCache_GetHits(const PARCConcurrentCache *cache);
+
+/**
+ * Get the number of lookups, across all stripes, that did not find an unexpired entry.
+ *
+ * @param [in] cache A pointer to a valid PARCConcurrentCache instance.
+ *
+ * @return The number of misses.
+ *
+ * Example:
+ * @code
+ * {
+ *     uint64_t misses = parcConcurrentCache_GetMisses(cache);
+ * }
+ * @endcode
+ */
+uint64_t parcConcurrentCache_GetMisses(const PARCConcurrentCache *cache);
+
+/**
+ * Get the number of entries, across all stripes, evicted to make room for new entries.
+ *
+ * @param [in] cache A pointer to a valid PARCConcurrentCache instance.
+ *
+ * @return The number of capacity evictions.
+ *
+ * Example:
+ * @code
+ * {
+ *     uint64_t evictions = parcConcurrentCache_GetEvictions(cache);
+ * }
+ * @endcode
+ */
+uint64_t parcConcurrentCache_GetEvictions(const PARCConcurrentCache *cache);
+
+/**
+ * Get the number of entries, across all stripes, evicted because their time-to-live elapsed.
+ *
+ * @param [in] cache A pointer to a valid PARCConcurrentCache instance.
+ *
+ * @return The number of expirations.
+ *
+ * Example:
+ * @code
+ * {
+ *     uint64_t expirations = parcConcurrentCache_GetExpirations(cache);
+ * }
+ * @endcode
+ */
+uint64_t parcConcurrentCache_GetExpirations(const PARCConcurrentCache *cache);
+#endif
@@ -0,0 +1,318 @@
+/*
+ * Copyright (c) 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Patent rights are not granted under this agreement. Patent rights are
+ *       available under FRAND terms.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX or PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * @copyright 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC).  All rights reserved.
+ */
+#include "../parc_ConcurrentCache.c"
+
+#include <stdio.h>
+#include <inttypes.h>
+
+#include <LongBow/testing.h>
+#include <LongBow/debugging.h>
+#include <parc/algol/parc_Memory.h>
+#include <parc/algol/parc_SafeMemory.h>
+#include <parc/algol/parc_Buffer.h>
+
+#include <parc/testing/parc_MemoryTesting.h>
+#include <parc/testing/parc_ObjectTesting.h>
+
+static PARCBuffer *
+_key(uint32_t value)
+{
+    PARCBuffer *result = parcBuffer_Allocate(sizeof(uint32_t));
+    parcBuffer_PutUint32(result, value);
+    return parcBuffer_Flip(result);
+}
+
+LONGBOW_TEST_RUNNER(parc_ConcurrentCache)
+{
+    LONGBOW_RUN_TEST_FIXTURE(CreateAcquireRelease);
+    LONGBOW_RUN_TEST_FIXTURE(Global);
+    LONGBOW_RUN_TEST_FIXTURE(Threads);
+}
+
+LONGBOW_TEST_RUNNER_SETUP(parc_ConcurrentCache)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_RUNNER_TEARDOWN(parc_ConcurrentCache)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_FIXTURE(CreateAcquireRelease)
+{
+    LONGBOW_RUN_TEST_CASE(CreateAcquireRelease, CreateRelease);
+}
+
+LONGBOW_TEST_FIXTURE_SETUP(CreateAcquireRelease)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_FIXTURE_TEARDOWN(CreateAcquireRelease)
+{
+    if (!parcMemoryTesting_ExpectedOutstanding(0, "%s leaked memory.", longBowTestCase_GetFullName(testCase))) {
+        return LONGBOW_STATUS_MEMORYLEAK;
+    }
+
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_CASE(CreateAcquireRelease, CreateRelease)
+{
+    PARCConcurrentCache *instance = parcConcurrentCache_Create(100, 4);
+    assertNotNull(instance, "Expected non-null result from parcConcurrentCache_Create().");
+
+    parcObjectTesting_AssertAcquireReleaseContract(parcConcurrentCache_Acquire, instance);
+
+    parcConcurrentCache_Release(&instance);
+    assertNull(instance, "Expected null result from parcConcurrentCache_Release().");
+}
+
+LONGBOW_TEST_FIXTURE(Global)
+{
+    LONGBOW_RUN_TEST_CASE(Global, parcConcurrentCache_IsValid);
+    LONGBOW_RUN_TEST_CASE(Global, parcConcurrentCache_Capacity);
+    LONGBOW_RUN_TEST_CASE(Global, parcConcurrentCache_Put_Get);
+    LONGBOW_RUN_TEST_CASE(Global, parcConcurrentCache_Remove_Clear);
+    LONGBOW_RUN_TEST_CASE(Global, parcConcurrentCache_TimeToLive);
+    LONGBOW_RUN_TEST_CASE(Global, parcConcurrentCache_Evict);
+}
+
+LONGBOW_TEST_FIXTURE_SETUP(Global)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_FIXTURE_TEARDOWN(Global)
+{
+    if (!parcMemoryTesting_ExpectedOutstanding(0, "%s mismanaged memory.", longBowTestCase_GetFullName(testCase))) {
+        return LONGBOW_STATUS_MEMORYLEAK;
+    }
+
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_CASE(Global, parcConcurrentCache_IsValid)
+{
+    PARCConcurrentCache *instance = parcConcurrentCache_Create(100, 0);
+    assertTrue(parcConcurrentCache_IsValid(instance), "Expected parcConcurrentCache_Create to result in a valid instance.");
+
+    parcConcurrentCache_Release(&instance);
+    assertFalse(parcConcurrentCache_IsValid(instance), "Expected parcConcurrentCache_Release to result in an invalid instance.");
+}
+
+LONGBOW_TEST_CASE(Global, parcConcurrentCache_Capacity)
+{
+    PARCConcurrentCache *instance = parcConcurrentCache_Create(100, 8);
+    assertTrue(parcConcurrentCache_Capacity(instance) >= 100,
+               "Expected a capacity of at least 100, actual %zu", parcConcurrentCache_Capacity(instance));
+    parcConcurrentCache_Release(&instance);
+
+    // There are never more stripes than entries.
+    instance = parcConcurrentCache_Create(2, 8);
+    assertTrue(parcConcurrentCache_Capacity(instance) == 2,
+               "Expected a capacity of 2, actual %zu", parcConcurrentCache_Capacity(instance));
+    parcConcurrentCache_Release(&instance);
+}
+
+LONGBOW_TEST_CASE(Global, parcConcurrentCache_Put_Get)
+{
+    PARCConcurrentCache *cache = parcConcurrentCache_Create(100, 4);
+
+    for (uint32_t i = 0; i < 50; i++) {
+        PARCBuffer *key = _key(i);
+        parcConcurrentCache_Put(cache, key, key);
+        parcBuffer_Release(&key);
+    }
+    assertTrue(parcConcurrentCache_Size(cache) == 50, "Expected size 50, actual %zu", parcConcurrentCache_Size(cache));
+
+    for (uint32_t i = 0; i < 50; i++) {
+        PARCBuffer *key = _key(i);
+        PARCBuffer *value = parcConcurrentCache_Get(cache, key);
+        assertTrue(parcBuffer_Equals(key, value), "Expected the value that was put for key %u", i);
+        parcBuffer_Release(&value);
+        parcBuffer_Release(&key);
+    }
+
+    PARCBuffer *absent = _key(1000);
+    assertNull(parcConcurrentCache_Get(cache, absent), "Expected NULL for an absent key.");
+    parcBuffer_Release(&absent);
+
+    assertTrue(parcConcurrentCache_GetHits(cache) == 50, "Expected 50 hits, actual %" PRIu64, parcConcurrentCache_GetHits(cache));
+    assertTrue(parcConcurrentCache_GetMisses(cache) == 1, "Expected 1 miss, actual %" PRIu64, parcConcurrentCache_GetMisses(cache));
+
+    parcConcurrentCache_Release(&cache);
+}
+
+LONGBOW_TEST_CASE(Global, parcConcurrentCache_Remove_Clear)
+{
+    PARCConcurrentCache *cache = parcConcurrentCache_Create(100, 4);
+
+    PARCBuffer *key1 = _key(1);
+    PARCBuffer *key2 = _key(2);
+    parcConcurrentCache_Put(cache, key1, key1);
+    parcConcurrentCache_Put(cache, key2, key2);
+
+    assertTrue(parcConcurrentCache_Remove(cache, key1), "Expected parcConcurrentCache_Remove to find the key.");
+    assertFalse(parcConcurrentCache_Remove(cache, key1), "Expected a second parcConcurrentCache_Remove to not find the key.");
+    assertTrue(parcConcurrentCache_Size(cache) == 1, "Expected size 1, actual %zu", parcConcurrentCache_Size(cache));
+
+    parcConcurrentCache_Clear(cache);
+    assertTrue(parcConcurrentCache_Size(cache) == 0, "Expected size 0, actual %zu", parcConcurrentCache_Size(cache));
+
+    parcBuffer_Release(&key2);
+    parcBuffer_Release(&key1);
+    parcConcurrentCache_Release(&cache);
+}
+
+LONGBOW_TEST_CASE(Global, parcConcurrentCache_TimeToLive)
+{
+    PARCClock *clock = parcClock_Counter();
+    PARCConcurrentCache *cache = parcConcurrentCache_CreateWithClock(100, 4, clock);
+    parcClock_Release(&clock);
+
+    PARCBuffer *key = _key(1);
+    parcConcurrentCache_PutWithTimeToLive(cache, key, key, 2);   // t = 1, expires at t = 3
+
+    PARCBuffer *value = parcConcurrentCache_Get(cache, key);     // t = 2
+    assertNotNull(value, "Expected a hit before the entry expires.");
+    parcBuffer_Release(&value);
+
+    assertNull(parcConcurrentCache_Get(cache, key), "Expected a miss after the entry expires.");
+    assertTrue(parcConcurrentCache_GetExpirations(cache) == 1,
+               "Expected 1 expiration, actual %" PRIu64, parcConcurrentCache_GetExpirations(cache));
+
+    parcBuffer_Release(&key);
+    parcConcurrentCache_Release(&cache);
+}
+
+static void
+_countEviction(const PARCObject *key, const PARCObject *value, PARCCacheEvictionReason reason, void *context)
+{
+    size_t *count = context;
+    (*count)++;
+}
+
+LONGBOW_TEST_CASE(Global, parcConcurrentCache_Evict)
+{
+    PARCConcurrentCache *cache = parcConcurrentCache_Create(64, 4);
+    size_t evicted = 0;
+    parcConcurrentCache_SetEvictionCallback(cache, _countEviction, &evicted);
+
+    for (uint32_t i = 0; i < 1000; i++) {
+        PARCBuffer *key = _key(i);
+        parcConcurrentCache_Put(cache, key, key);
+        parcBuffer_Release(&key);
+    }
+
+    size_t size = parcConcurrentCache_Size(cache);
+    assertTrue(size <= parcConcurrentCache_Capacity(cache), "Expected the size to be bounded, actual %zu", size);
+    assertTrue(evicted == 1000 - size, "Expected %zu eviction callbacks, actual %zu", 1000 - size, evicted);
+    assertTrue(parcConcurrentCache_GetEvictions(cache) == evicted,
+               "Expected %zu evictions, actual %" PRIu64, evicted, parcConcurrentCache_GetEvictions(cache));
+
+    parcConcurrentCache_Release(&cache);
+}
+
+LONGBOW_TEST_FIXTURE(Threads)
+{
+    LONGBOW_RUN_TEST_CASE(Threads, parcConcurrentCache_PutGet);
+}
+
+LONGBOW_TEST_FIXTURE_SETUP(Threads)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_FIXTURE_TEARDOWN(Threads)
+{
+    if (!parcMemoryTesting_ExpectedOutstanding(0, "%s mismanaged memory.", longBowTestCase_GetFullName(testCase))) {
+        return LONGBOW_STATUS_MEMORYLEAK;
+    }
+
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+typedef struct {
+    PARCConcurrentCache *cache;
+    uint32_t base;
+} _Worker;
+
+static void *
+_worker(void *arg)
+{
+    _Worker *worker = arg;
+
+    for (uint32_t i = 0; i < 20000; i++) {
+        PARCBuffer *key = _key(worker->base + (i % 500));
+        PARCBuffer *value = parcConcurrentCache_Get(worker->cache, key);
+        if (value == NULL) {
+            parcConcurrentCache_Put(worker->cache, key, key);
+        } else {
+            assertTrue(parcBuffer_Equals(key, value), "Expected the cached value to equal its key.");
+            parcBuffer_Release(&value);
+        }
+        parcBuffer_Release(&key);
+    }
+
+    return NULL;
+}
+
+LONGBOW_TEST_CASE(Threads, parcConcurrentCache_PutGet)
+{
+    PARCConcurrentCache *cache = parcConcurrentCache_Create(1000, 8);
+
+    pthread_t threads[4];
+    _Worker workers[4];
+    for (int i = 0; i < 4; i++) {
+        workers[i] = (_Worker) { .cache = cache, .base = (uint32_t) i * 250 };
+        pthread_create(&threads[i], NULL, _worker, &workers[i]);
+    }
+    for (int i = 0; i < 4; i++) {
+        pthread_join(threads[i], NULL);
+    }
+
+    assertTrue(parcConcurrentCache_Size(cache) <= parcConcurrentCache_Capacity(cache),
+               "Expected the size to be bounded, actual %zu", parcConcurrentCache_Size(cache));
+    assertTrue(parcConcurrentCache_GetHits(cache) + parcConcurrentCache_GetMisses(cache) == 4 * 20000,
+               "Expected every lookup to be counted.");
+
+    parcConcurrentCache_Release(&cache);
+}
+
+int
+main(int argc, char *argv[argc])
+{
+    LongBowRunner *testRunner = LONGBOW_TEST_RUNNER_CREATE(parc_ConcurrentCache);
+    int exitStatus = longBowMain(argc, argv, testRunner, NULL);
+    longBowTestRunner_Destroy(&testRunner);
+    exit(exitStatus);
+}
@@ -41,6 +41,7 @@
 #include <parc/algol/parc_Time.h>
 
 #include <parc/algol/parc_FileOutputStream.h>
+#include <parc/algol/parc_BufferedOutputStream.h>
 
 PARCLogReporter *
 parcLogReporterFile_Create(PARCOutputStream *output)
@@ -52,6 +53,18 @@ parcLogReporterFile_Create(PARCOutputStream *output)
     return result;
 }
 
+PARCLogReporter *
+parcLogReporterFile_CreateBuffered(PARCOutputStream *output, size_t capacity, uint64_t maximumDelay)
+{
+    PARCBufferedOutputStream *buffered = parcBufferedOutputStream_Create(output, capacity, maximumDelay, true);
+    PARCOutputStream *bufferedOutput = parcBufferedOutputStream_AsOutputStream(buffered);
+    parcBufferedOutputStream_Release(&buffered);
+
+    PARCLogReporter *result = parcLogReporterFile_Create(bufferedOutput);
+    parcOutputStream_Release(&bufferedOutput);
+    return result;
+}
+
 PARCLogReporter *
 parcLogReporterFile_Acquire(const PARCLogReporter *reporter)
 {
@@ -72,4 +85,10 @@ parcLogReporterFile_Report(PARCLogReporter *reporter, const PARCLogEntry *entry)
     PARCBuffer *formatted = parcLogFormatSyslog_FormatEntry(entry);
     parcOutputStream_Write(output, formatted);
     parcBuffer_Release(&formatted);
+
+    // Don't leave an error waiting in a buffer: the process may be about to fail.
+    PARCLogLevel level = parcLogEntry_GetLevel(entry);
+    if (level != PARCLogLevel_Off && level <= PARCLogLevel_Error) {
+        parcOutputStream_Flush(output);
+    }
 }
@@ -62,6 +62,40 @@
  */
 PARCLogReporter *parcLogReporterFile_Create(PARCOutputStream *output);
 
+/**
+ * Create a new instance of `PARCLogReporter` that collects the entries it reports in a buffer,
+ * and writes them to the given {@link PARCOutputStream} together.
+ *
+ * Entries are written by a background thread when the buffer is full, or when the oldest entry in the buffer
+ * has waited for @p maximumDelay microseconds. An entry at `PARCLogLevel_Error` or more severe is written
+ * at once, along with any entries before it.
+ * Releasing the last reference to the reporter writes any entries still in the buffer.
+ *
+ * @param [in] output A pointer to a valid `PARCOutputStream` instance.
+ * @param [in] capacity The size of the buffer in bytes.
+ * @param [in] maximumDelay The longest time, in microseconds, an entry waits in the buffer, or 0 for no limit.
+ *
+ * @return NULL Memory could not be allocated.
+ * @return non-NULL A pointer to a valid `PARCLogReporter` instance.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCFileOutputStream *fileOutput = parcFileOutputStream_Create(dup(STDOUT_FILENO));
+ *     PARCOutputStream *out = parcFileOutputStream_AsOutputStream(fileOutput);
+ *     parcFileOutputStream_Release(&fileOutput);
+ *
+ *     PARCLogReporter *reporter = parcLogReporterFile_CreateBuffered(out, 64 * 1024, 100000);
+ *     parcOutputStream_Release(&out);
+ *
+ *     parcLogReporter_Release(&reporter);
+ * }
+ * @endcode
+ *
+ * @see parcBufferedOutputStream_Create
+ */
+PARCLogReporter *parcLogReporterFile_CreateBuffered(PARCOutputStream *output, size_t capacity, uint64_t maximumDelay);
+
 /**
  * Increase the number of references to a `PARCLogReporter` instance.
  *
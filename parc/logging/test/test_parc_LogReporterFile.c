@@ -29,6 +29,9 @@
 // This permits internal static functions to be visible to this Test Runner.
 #include "../parc_LogReporterFile.c"
 
+#include <fcntl.h>
+#include <unistd.h>
+
 #include <parc/algol/parc_OutputStream.h>
 #include <parc/algol/parc_FileOutputStream.h>
 #include <parc/testing/parc_ObjectTesting.h>
@@ -64,6 +67,7 @@ LONGBOW_TEST_FIXTURE(Global)
     LONGBOW_RUN_TEST_CASE(Global, parcLogReporterFile_AcquireRelease);
     LONGBOW_RUN_TEST_CASE(Global, parcLogReporterFile_Create);
     LONGBOW_RUN_TEST_CASE(Global, parcLogReporterFile_Report);
+    LONGBOW_RUN_TEST_CASE(Global, parcLogReporterFile_CreateBuffered_Report);
 }
 
 LONGBOW_TEST_FIXTURE_SETUP(Global)
@@ -136,6 +140,54 @@ LONGBOW_TEST_CASE(Global, parcLogReporterFile_Report)
     parcLogReporter_Release(&reporter);
 }
 
+static void
+_reportPayload(PARCLogReporter *reporter, PARCLogLevel level, char *message)
+{
+    struct timeval timeStamp;
+    gettimeofday(&timeStamp, NULL);
+    PARCBuffer *payload = parcBuffer_AllocateCString(message);
+    PARCLogEntry *entry =
+        parcLogEntry_Create(level, "hostname", "applicationname", "processid", 1234, timeStamp, payload);
+
+    parcLogReporter_Report(reporter, entry);
+    parcLogEntry_Release(&entry);
+    parcBuffer_Release(&payload);
+}
+
+LONGBOW_TEST_CASE(Global, parcLogReporterFile_CreateBuffered_Report)
+{
+    int fds[2];
+    assertTrue(pipe(fds) == 0, "Expected pipe() to succeed");
+    fcntl(fds[0], F_SETFL, O_NONBLOCK);
+
+    PARCFileOutputStream *fileOutput = parcFileOutputStream_Create(fds[1]);
+    PARCOutputStream *out = parcFileOutputStream_AsOutputStream(fileOutput);
+    parcFileOutputStream_Release(&fileOutput);
+
+    PARCLogReporter *reporter = parcLogReporterFile_CreateBuffered(out, 4096, 0);
+    parcOutputStream_Release(&out);
+
+    char text[4096];
+    _reportPayload(reporter, PARCLogLevel_Info, "first");
+    assertTrue(read(fds[0], text, sizeof(text)) == -1, "Expected the Info entry to be held in the buffer");
+
+    _reportPayload(reporter, PARCLogLevel_Error, "second");
+    ssize_t length = read(fds[0], text, sizeof(text) - 1);
+    assertTrue(length > 0, "Expected the Error entry to be written at once");
+    text[length] = 0;
+    assertNotNull(strstr(text, "first"), "Expected the held entry to be written before the Error entry");
+    assertNotNull(strstr(text, "second"), "Expected the Error entry to be written");
+
+    _reportPayload(reporter, PARCLogLevel_Debug, "third");
+    parcLogReporter_Release(&reporter);
+    length = read(fds[0], text, sizeof(text) - 1);
+    assertTrue(length > 0, "Expected releasing the reporter to write the held entry");
+    text[length] = 0;
+    assertNotNull(strstr(text, "third"), "Expected the held entry to be written");
+
+    close(fds[0]);
+}
+
 LONGBOW_TEST_FIXTURE(Static)
 {
 }
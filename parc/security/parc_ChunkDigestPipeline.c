@@ -0,0 +1,293 @@
+/*
+ * Copyright (c) 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Patent rights are not granted under this agreement. Patent rights are
+ *       available under FRAND terms.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX or PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * @copyright 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC).  All rights reserved.
+ */
+#include <config.h>
+
+#include <pthread.h>
+
+#include <LongBow/runtime.h>
+
+#include <parc/algol/parc_Object.h>
+#include <parc/algol/parc_Memory.h>
+#include <parc/algol/parc_Buffer.h>
+#include <parc/algol/parc_Iterator.h>
+
+#include <parc/security/parc_CryptoHasher.h>
+#include <parc/security/parc_ChunkDigestPipeline.h>
+
+/*
+ * Chunks are numbered in the order they are read from the chunker.
+ * A chunk's digest is stored in slot (number % capacity) until the caller takes it,
+ * so at most `capacity` chunks are in flight between the chunker and the caller.
+ *
+ * Each worker, holding the mutex, waits for a free slot, reads the next chunk from the iterator
+ * and numbers it; then it hashes the chunk without the mutex held, and stores the digest in the chunk's slot.
+ * Reading the iterator under the mutex keeps the chunker single-threaded,
+ * and reading a chunk is cheap compared to hashing it.
+ */
+struct PARCChunkDigestPipeline {
+    PARCChunker *chunker;
+    PARCIterator *iterator;
+    PARCCryptoHashType hashType;
+
+    pthread_mutex_t mutex;
+    pthread_cond_t slotAvailable;  // Signalled when the caller takes a digest.
+    pthread_cond_t digestAvailable; // Signalled when a worker stores a digest, or the last worker finishes.
+
+    PARCCryptoHash **slots;
+    size_t capacity;
+
+    size_t nextRead;    // The number of the next chunk to read from the iterator.
+    size_t nextDeliver; // The number of the next digest to return to the caller.
+    bool exhausted;     // The iterator has no more chunks.
+    bool cancelled;
+
+    pthread_t *workers;
+    size_t threadCount;
+    size_t runningWorkers;
+};
+
+static void *
+_parcChunkDigestPipeline_Worker(void *arg)
+{
+    PARCChunkDigestPipeline *pipeline = arg;
+    PARCCryptoHasher *hasher = parcCryptoHasher_Create(pipeline->hashType);
+
+    pthread_mutex_lock(&pipeline->mutex);
+    while (true) {
+        while (!pipeline->cancelled && !pipeline->exhausted
+               && pipeline->nextRead - pipeline->nextDeliver >= pipeline->capacity) {
+            pthread_cond_wait(&pipeline->slotAvailable, &pipeline->mutex);
+        }
+        if (pipeline->cancelled || pipeline->exhausted) {
+            break;
+        }
+        if (!parcIterator_HasNext(pipeline->iterator)) {
+            pipeline->exhausted = true;
+            break;
+        }
+        PARCBuffer *chunk = parcIterator_Next(pipeline->iterator);
+        size_t number = pipeline->nextRead++;
+        pthread_mutex_unlock(&pipeline->mutex);
+
+        parcCryptoHasher_Init(hasher);
+        parcCryptoHasher_UpdateBuffer(hasher, chunk);
+        PARCCryptoHash *digest = parcCryptoHasher_Finalize(hasher);
+        parcBuffer_Release(&chunk);
+
+        pthread_mutex_lock(&pipeline->mutex);
+        if (pipeline->cancelled) {
+            parcCryptoHash_Release(&digest);
+        } else {
+            pipeline->slots[number % pipeline->capacity] = digest;
+            if (number == pipeline->nextDeliver) {
+                pthread_cond_broadcast(&pipeline->digestAvailable);
+            }
+        }
+    }
+    pipeline->runningWorkers--;
+    pthread_cond_broadcast(&pipeline->digestAvailable);
+    pthread_cond_broadcast(&pipeline->slotAvailable);
+    pthread_mutex_unlock(&pipeline->mutex);
+
+    parcCryptoHasher_Release(&hasher);
+    return NULL;
+}
+
+static void
+_parcChunkDigestPipeline_Finalize(PARCChunkDigestPipeline **instancePtr)
+{
+    assertNotNull(instancePtr, "Parameter must be a non-null pointer to a PARCChunkDigestPipeline pointer.");
+    PARCChunkDigestPipeline *pipeline = *instancePtr;
+
+    parcChunkDigestPipeline_Cancel(pipeline);
+    for (size_t i = 0; i < pipeline->threadCount; i++) {
+        pthread_join(pipeline->workers[i], NULL);
+    }
+    parcMemory_Deallocate(&pipeline->workers);
+
+    for (size_t i = 0; i < pipeline->capacity; i++) {
+        if (pipeline->slots[i] != NULL) {
+            parcCryptoHash_Release(&pipeline->slots[i]);
+        }
+    }
+    parcMemory_Deallocate(&pipeline->slots);
+
+    parcIterator_Release(&pipeline->iterator);
+    parcChunker_Release(&pipeline->chunker);
+
+    pthread_cond_destroy(&pipeline->digestAvailable);
+    pthread_cond_destroy(&pipeline->slotAvailable);
+    pthread_mutex_destroy(&pipeline->mutex);
+}
+
+parcObject_ImplementAcquire(parcChunkDigestPipeline, PARCChunkDigestPipeline);
+
+parcObject_ImplementRelease(parcChunkDigestPipeline, PARCChunkDigestPipeline);
+
+parcObject_ExtendPARCObject(PARCChunkDigestPipeline, _parcChunkDigestPipeline_Finalize, NULL, NULL, NULL, NULL, NULL, NULL);
+
+bool
+parcChunkDigestPipeline_IsValid(const PARCChunkDigestPipeline *instance)
+{
+    bool result = false;
+
+    if (instance != NULL) {
+        result = instance->slots != NULL && instance->capacity > 0 && instance->iterator != NULL;
+    }
+
+    return result;
+}
+
+void
+parcChunkDigestPipeline_AssertValid(const PARCChunkDigestPipeline *instance)
+{
+    assertTrue(parcChunkDigestPipeline_IsValid(instance),
+               "PARCChunkDigestPipeline is not valid.");
+}
+
+PARCChunkDigestPipeline *
+parcChunkDigestPipeline_Create(const PARCChunker *chunker, PARCCryptoHashType hashType, size_t threadCount, size_t capacity)
+{
+    trapIllegalValueIf(threadCount == 0, "The number of threads must be at least 1");
+    trapIllegalValueIf(capacity == 0, "The capacity must be at least 1");
+
+    PARCChunkDigestPipeline *result = parcObject_CreateInstance(PARCChunkDigestPipeline);
+    if (result == NULL) {
+        return NULL;
+    }
+
+    result->chunker = parcChunker_Acquire(chunker);
+    result->iterator = parcChunker_ForwardIterator(chunker);
+    result->hashType = hashType;
+
+    pthread_mutex_init(&result->mutex, NULL);
+    pthread_cond_init(&result->slotAvailable, NULL);
+    pthread_cond_init(&result->digestAvailable, NULL);
+
+    result->capacity = capacity;
+    result->slots = parcMemory_AllocateAndClear(capacity * sizeof(PARCCryptoHash *));
+    result->nextRead = 0;
+    result->nextDeliver = 0;
+    result->exhausted = false;
+    result->cancelled = false;
+
+    result->workers = parcMemory_AllocateAndClear(threadCount * sizeof(pthread_t));
+    result->threadCount = 0;
+    result->runningWorkers = 0;
+
+    for (size_t i = 0; i < threadCount; i++) {
+        pthread_mutex_lock(&result->mutex);
+        result->runningWorkers++;
+        pthread_mutex_unlock(&result->mutex);
+
+        if (pthread_create(&result->workers[i], NULL, _parcChunkDigestPipeline_Worker, result) != 0) {
+            pthread_mutex_lock(&result->mutex);
+            result->runningWorkers--;
+            pthread_mutex_unlock(&result->mutex);
+            break;
+        }
+        result->threadCount++;
+    }
+
+    if (result->threadCount == 0) {
+        parcChunkDigestPipeline_Release(&result);
+    }
+
+    return result;
+}
+
+PARCCryptoHash *
+parcChunkDigestPipeline_Next(PARCChunkDigestPipeline *pipeline)
+{
+    parcChunkDigestPipeline_OptionalAssertValid(pipeline);
+
+    PARCCryptoHash *result = NULL;
+
+    pthread_mutex_lock(&pipeline->mutex);
+    while (true) {
+        size_t slot = pipeline->nextDeliver % pipeline->capacity;
+        if (pipeline->cancelled) {
+            break;
+        }
+        if (pipeline->slots[slot] != NULL) {
+            result = pipeline->slots[slot];
+            pipeline->slots[slot] = NULL;
+            pipeline->nextDeliver++;
+            pthread_cond_broadcast(&pipeline->slotAvailable);
+            break;
+        }
+        // Every chunk read has been delivered and no more will be read.
+        if (pipeline->nextDeliver == pipeline->nextRead && (pipeline->exhausted || pipeline->runningWorkers == 0)) {
+            break;
+        }
+        pthread_cond_wait(&pipeline->digestAvailable, &pipeline->mutex);
+    }
+    pthread_mutex_unlock(&pipeline->mutex);
+
+    return result;
+}
+
+void
+parcChunkDigestPipeline_Cancel(PARCChunkDigestPipeline *pipeline)
+{
+    parcChunkDigestPipeline_OptionalAssertValid(pipeline);
+
+    pthread_mutex_lock(&pipeline->mutex);
+    pipeline->cancelled = true;
+    pthread_cond_broadcast(&pipeline->slotAvailable);
+    pthread_cond_broadcast(&pipeline->digestAvailable);
+    pthread_mutex_unlock(&pipeline->mutex);
+}
+
+bool
+parcChunkDigestPipeline_IsCancelled(const PARCChunkDigestPipeline *pipeline)
+{
+    parcChunkDigestPipeline_OptionalAssertValid(pipeline);
+
+    PARCChunkDigestPipeline *mutable = (PARCChunkDigestPipeline *) pipeline;
+    pthread_mutex_lock(&mutable->mutex);
+    bool result = pipeline->cancelled;
+    pthread_mutex_unlock(&mutable->mutex);
+
+    return result;
+}
+
+size_t
+parcChunkDigestPipeline_GetCount(const PARCChunkDigestPipeline *pipeline)
+{
+    parcChunkDigestPipeline_OptionalAssertValid(pipeline);
+
+    PARCChunkDigestPipeline *mutable = (PARCChunkDigestPipeline *) pipeline;
+    pthread_mutex_lock(&mutable->mutex);
+    size_t result = pipeline->nextDeliver;
+    pthread_mutex_unlock(&mutable->mutex);
+
+    return result;
+}
@@ -0,0 +1,222 @@
+/*
+ * Copyright (c) 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Patent rights are not granted under this agreement. Patent rights are
+ *       available under FRAND terms.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX or PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * @file parc_ChunkDigestPipeline.h
+ * @ingroup security
+ * @brief Compute the digests of the chunks of a `PARCChunker` on multiple threads.
+ *
+ * Hashing the chunks of a large file one after another on a single thread is limited by the
+ * speed of the hash function.
+ * A `PARCChunkDigestPipeline` iterates forward over the chunks of any `PARCChunker`,
+ * hands them to a set of worker threads, each with its own `PARCCryptoHasher`,
+ * and returns the resulting `PARCCryptoHash` instances to the caller in chunk order.
+ *
+ * The number of chunks in flight (read from the chunker but not yet returned to the caller)
+ * is bounded by the pipeline's capacity.
+ * When the caller falls behind, the workers stop reading chunks until it catches up,
+ * so memory use is bounded however large the input.
+ *
+ * The pipeline may be cancelled at any time, from any thread.
+ * Releasing the last reference to a pipeline cancels it and waits for its threads to finish.
+ *
+ * @copyright 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC).  All rights reserved.
+ */
+#ifndef libparc_parc_ChunkDigestPipeline_h
+#define libparc_parc_ChunkDigestPipeline_h
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include <parc/algol/parc_Chunker.h>
+#include <parc/security/parc_CryptoHash.h>
+#include <parc/security/parc_CryptoHashType.h>
+
+struct PARCChunkDigestPipeline;
+typedef struct PARCChunkDigestPipeline PARCChunkDigestPipeline;
+
+#ifdef PARCLibrary_DISABLE_VALIDATION
+#  define parcChunkDigestPipeline_OptionalAssertValid(_instance_)
+#else
+#  define parcChunkDigestPipeline_OptionalAssertValid(_instance_) parcChunkDigestPipeline_AssertValid(_instance_)
+#endif
+
+/**
+ * Create a `PARCChunkDigestPipeline` and start computing the digests of the chunks of the given `PARCChunker`.
+ *
+ * @param [in] chunker A pointer to a valid `PARCChunker` instance. The pipeline acquires a reference to it.
+ * @param [in] hashType The type of digest to compute for each chunk.
+ * @param [in] threadCount The number of worker threads, at least 1.
+ * @param [in] capacity The maximum number of chunks in flight, at least 1.
+ *
+ * @return non-NULL A pointer to a valid `PARCChunkDigestPipeline` instance.
+ * @return NULL An error occurred.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCFileChunker *fileChunker = parcFileChunker_Create(file, 4096);
+ *     PARCChunker *chunker = parcChunker_Create(fileChunker, PARCFileChunkerAsChunker);
+ *
+ *     PARCChunkDigestPipeline *pipeline = parcChunkDigestPipeline_Create(chunker, PARC_HASH_SHA256, 4, 64);
+ *
+ *     PARCCryptoHash *digest;
+ *     while ((digest = parcChunkDigestPipeline_Next(pipeline)) != NULL) {
+ *         // use the digest of the next chunk
+ *         parcCryptoHash_Release(&digest);
+ *     }
+ *
+ *     parcChunkDigestPipeline_Release(&pipeline);
+ *     parcChunker_Release(&chunker); // also releases fileChunker
+ * }
+ * @endcode
+ */
+PARCChunkDigestPipeline *parcChunkDigestPipeline_Create(const PARCChunker *chunker, PARCCryptoHashType hashType,
+                                                        size_t threadCount, size_t capacity);
+
+/**
+ * Increase the number of references to a `PARCChunkDigestPipeline` instance.
+ *
+ * Note that a new `PARCChunkDigestPipeline` is not created,
+ * only that the given `PARCChunkDigestPipeline` reference count is incremented.
+ * Discard the reference by invoking `parcChunkDigestPipeline_Release`.
+ *
+ * @param [in] instance A pointer to a valid `PARCChunkDigestPipeline` instance.
+ *
+ * @return The same value as @p instance.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCChunkDigestPipeline *a = parcChunkDigestPipeline_Create(chunker, PARC_HASH_SHA256, 4, 64);
+ *
+ *     PARCChunkDigestPipeline *b = parcChunkDigestPipeline_Acquire(a);
+ *
+ *     parcChunkDigestPipeline_Release(&a);
+ *     parcChunkDigestPipeline_Release(&b);
+ * }
+ * @endcode
+ */
+PARCChunkDigestPipeline *parcChunkDigestPipeline_Acquire(const PARCChunkDigestPipeline *instance);
+
+/**
+ * Release a previously acquired reference to the given `PARCChunkDigestPipeline` instance,
+ * decrementing the reference count for the instance.
+ *
+ * The pointer to the instance is set to NULL as a side-effect of this function.
+ *
+ * If the invocation causes the last reference to the instance to be released,
+ * the pipeline is cancelled, its threads are joined and the instance is deallocated.
+ *
+ * @param [in,out] instancePtr A pointer to a pointer to the instance to release.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCChunkDigestPipeline *pipeline = parcChunkDigestPipeline_Create(chunker, PARC_HASH_SHA256, 4, 64);
+ *
+ *     parcChunkDigestPipeline_Release(&pipeline);
+ * }
+ * @endcode
+ */
+void parcChunkDigestPipeline_Release(PARCChunkDigestPipeline **instancePtr);
+
+/**
+ * Determine if an instance of `PARCChunkDigestPipeline` is valid.
+ *
+ * @param [in] instance A pointer to a `PARCChunkDigestPipeline` instance.
+ *
+ * @return true The instance is valid.
+ * @return false The instance is not valid.
+ */
+bool parcChunkDigestPipeline_IsValid(const PARCChunkDigestPipeline *instance);
+
+/**
+ * Assert that the given `PARCChunkDigestPipeline` instance is valid.
+ *
+ * @param [in] instance A pointer to a valid `PARCChunkDigestPipeline` instance.
+ */
+void parcChunkDigestPipeline_AssertValid(const PARCChunkDigestPipeline *instance);
+
+/**
+ * Get the digest of the next chunk, waiting until it has been computed.
+ *
+ * Digests are returned in the order of the chunks, whatever order the workers finish them in.
+ *
+ * @param [in] pipeline A pointer to a valid `PARCChunkDigestPipeline` instance.
+ *
+ * @return non-NULL The digest of the next chunk, which must be released via {@link parcCryptoHash_Release}.
+ * @return NULL There are no more chunks, or the pipeline has been cancelled.
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCCryptoHash *digest;
+ *     while ((digest = parcChunkDigestPipeline_Next(pipeline)) != NULL) {
+ *         parcCryptoHash_Release(&digest);
+ *     }
+ * }
+ * @endcode
+ */
+PARCCryptoHash *parcChunkDigestPipeline_Next(PARCChunkDigestPipeline *pipeline);
+
+/**
+ * Cancel the given `PARCChunkDigestPipeline`.
+ *
+ * The workers stop reading chunks, digests not yet returned are discarded,
+ * and any current or later call to {@link parcChunkDigestPipeline_Next} returns NULL.
+ * This may be called from any thread.
+ *
+ * @param [in] pipeline A pointer to a valid `PARCChunkDigestPipeline` instance.
+ *
+ * Example:
+ * @code
+ * {
+ *     parcChunkDigestPipeline_Cancel(pipeline);
+ * }
+ * @endcode
+ */
+void parcChunkDigestPipeline_Cancel(PARCChunkDigestPipeline *pipeline);
+
+/**
+ * Determine if the given `PARCChunkDigestPipeline` has been cancelled.
+ *
+ * @param [in] pipeline A pointer to a valid `PARCChunkDigestPipeline` instance.
+ *
+ * @return true The pipeline has been cancelled.
+ * @return false The pipeline has not been cancelled.
+ */
+bool parcChunkDigestPipeline_IsCancelled(const PARCChunkDigestPipeline *pipeline);
+
+/**
+ * Get the number of digests returned so far by {@link parcChunkDigestPipeline_Next}.
+ *
+ * @param [in] pipeline A pointer to a valid `PARCChunkDigestPipeline` instance.
+ *
+ * @return The number of digests returned so far.
+ */
+size_t parcChunkDigestPipeline_GetCount(const PARCChunkDigestPipeline *pipeline);
+#endif // libparc_parc_ChunkDigestPipeline_h
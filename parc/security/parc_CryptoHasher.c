@@ -226,6 +226,21 @@ parcCryptoHasher_UpdateBuffer(PARCCryptoHasher *digester, const PARCBuffer *buff
     return (success == 1) ? 0 : -1;
 }
 
+int
+parcCryptoHasher_UpdateBufferChain(PARCCryptoHasher *digester, const PARCBufferChain *chain)
+{
+    assertNotNull(digester, "Parameter must be non-null");
+
+    PARCBuffer *segment;
+    parcBufferChain_ForEach(chain, segment) {
+        void *bytes = parcBuffer_Overlay(segment, 0);
+        if (digester->functor.hasher_update(digester->hasher_ctx, bytes, parcBuffer_Remaining(segment)) != 1) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
 PARCCryptoHash *
 parcCryptoHasher_Finalize(PARCCryptoHasher *digester)
 {
@@ -41,6 +41,7 @@
 #define libparc_parc_CryptoHasher_h
 
 #include <parc/algol/parc_Buffer.h>
+#include <parc/algol/parc_BufferChain.h>
 #include <parc/security/parc_CryptoHash.h>
 
 struct parc_crypto_hasher;
@@ -275,6 +276,31 @@ int parcCryptoHasher_UpdateBytes(PARCCryptoHasher *hasher, const void *buffer, s
  */
 int parcCryptoHasher_UpdateBuffer(PARCCryptoHasher *hasher, const PARCBuffer *buffer);
 
+/**
+ * Add the bytes of each segment of the `PARCBufferChain` to the digest, in order,
+ * without first copying them into a contiguous buffer.
+ *
+ * The chain and its segments are unchanged.
+ *
+ * @param [in] hasher A `PARCCryptoHasher` instance.
+ * @param [in] chain A `PARCBufferChain` instance containing the bytes to add to the digest.
+ *
+ * @return 0 Successfully added bytes to the digest internally.
+ * @return -1 Some failure occurred
+ *
+ * Example:
+ * @code
+ * {
+ *     PARCCryptoHasher *digester = parcCryptoHasher_Create(PARC_HASH_SHA256);
+ *     parcCryptoHasher_Init(digester);
+ *     parcCryptoHasher_UpdateBufferChain(digester, message);
+ *     PARCCryptoHash *hash = parcCryptoHasher_Finalize(digester);
+ *     parcCryptoHasher_Release(&digester);
+ * }
+ * @endcode
+ */
+int parcCryptoHasher_UpdateBufferChain(PARCCryptoHasher *hasher, const PARCBufferChain *chain);
+
 /**
  * Finalize the digest.  Appends the digest to the output buffer, which
  * the user must allocate.
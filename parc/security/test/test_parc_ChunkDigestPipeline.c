@@ -0,0 +1,317 @@
+/*
+ * Copyright (c) 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Patent rights are not granted under this agreement. Patent rights are
+ *       available under FRAND terms.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX or PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * @copyright 2015, Xerox Corporation (Xerox)and Palo Alto Research Center (PARC).  All rights reserved.
+ */
+#include "../parc_ChunkDigestPipeline.c"
+
+#include <stdio.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+#include <LongBow/testing.h>
+#include <LongBow/debugging.h>
+#include <parc/algol/parc_Memory.h>
+#include <parc/algol/parc_SafeMemory.h>
+#include <parc/algol/parc_BufferChunker.h>
+#include <parc/testing/parc_MemoryTesting.h>
+#include <parc/testing/parc_ObjectTesting.h>
+
+LONGBOW_TEST_RUNNER(parc_ChunkDigestPipeline)
+{
+    LONGBOW_RUN_TEST_FIXTURE(CreateAcquireRelease);
+    LONGBOW_RUN_TEST_FIXTURE(Global);
+    LONGBOW_RUN_TEST_FIXTURE(Performance);
+}
+
+LONGBOW_TEST_RUNNER_SETUP(parc_ChunkDigestPipeline)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_RUNNER_TEARDOWN(parc_ChunkDigestPipeline)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+static PARCChunker *
+_createChunker(size_t length, size_t chunkSize)
+{
+    PARCBuffer *data = parcBuffer_Allocate(length);
+    for (size_t i = 0; i < length; i++) {
+        parcBuffer_PutUint8(data, (uint8_t) ((i * 31) ^ (i >> 8)));
+    }
+    parcBuffer_Flip(data);
+
+    PARCBufferChunker *bufferChunker = parcBufferChunker_Create(data, chunkSize);
+    parcBuffer_Release(&data);
+
+    // The PARCChunker takes over the reference to the PARCBufferChunker.
+    return parcChunker_Create(bufferChunker, PARCBufferChunkerAsChunker);
+}
+
+LONGBOW_TEST_FIXTURE(CreateAcquireRelease)
+{
+    LONGBOW_RUN_TEST_CASE(CreateAcquireRelease, CreateRelease);
+    LONGBOW_RUN_TEST_CASE(CreateAcquireRelease, Release_Unconsumed);
+}
+
+LONGBOW_TEST_FIXTURE_SETUP(CreateAcquireRelease)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_FIXTURE_TEARDOWN(CreateAcquireRelease)
+{
+    if (!parcMemoryTesting_ExpectedOutstanding(0, "%s leaked memory.", longBowTestCase_GetFullName(testCase))) {
+        return LONGBOW_STATUS_MEMORYLEAK;
+    }
+
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_CASE(CreateAcquireRelease, CreateRelease)
+{
+    PARCChunker *chunker = _createChunker(10000, 1000);
+
+    PARCChunkDigestPipeline *instance = parcChunkDigestPipeline_Create(chunker, PARC_HASH_SHA256, 2, 4);
+    assertNotNull(instance, "Expected non-null result from parcChunkDigestPipeline_Create().");
+    parcChunkDigestPipeline_AssertValid(instance);
+
+    parcObjectTesting_AssertAcquireReleaseContract(parcChunkDigestPipeline_Acquire, instance);
+
+    parcChunkDigestPipeline_Release(&instance);
+    assertNull(instance, "Expected null result from parcChunkDigestPipeline_Release().");
+
+    parcChunker_Release(&chunker);
+}
+
+LONGBOW_TEST_CASE(CreateAcquireRelease, Release_Unconsumed)
+{
+    // The workers fill the queue and block; releasing the pipeline must still stop them and free everything.
+    PARCChunker *chunker = _createChunker(100000, 100);
+
+    PARCChunkDigestPipeline *pipeline = parcChunkDigestPipeline_Create(chunker, PARC_HASH_SHA256, 4, 8);
+    PARCCryptoHash *digest = parcChunkDigestPipeline_Next(pipeline);
+    assertNotNull(digest, "Expected a digest for the first chunk.");
+    parcCryptoHash_Release(&digest);
+
+    parcChunkDigestPipeline_Release(&pipeline);
+    parcChunker_Release(&chunker);
+}
+
+LONGBOW_TEST_FIXTURE(Global)
+{
+    LONGBOW_RUN_TEST_CASE(Global, parcChunkDigestPipeline_Next);
+    LONGBOW_RUN_TEST_CASE(Global, parcChunkDigestPipeline_Next_SingleThread);
+    LONGBOW_RUN_TEST_CASE(Global, parcChunkDigestPipeline_Next_CapacityOne);
+    LONGBOW_RUN_TEST_CASE(Global, parcChunkDigestPipeline_Next_MoreThreadsThanChunks);
+    LONGBOW_RUN_TEST_CASE(Global, parcChunkDigestPipeline_Cancel);
+    LONGBOW_RUN_TEST_CASE(Global, parcChunkDigestPipeline_Cancel_FromAnotherThread);
+}
+
+LONGBOW_TEST_FIXTURE_SETUP(Global)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_FIXTURE_TEARDOWN(Global)
+{
+    if (!parcMemoryTesting_ExpectedOutstanding(0, "%s leaked memory.", longBowTestCase_GetFullName(testCase))) {
+        return LONGBOW_STATUS_MEMORYLEAK;
+    }
+
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+/**
+ * Check that the pipeline produces, in order, the same digests as hashing each chunk on this thread.
+ */
+static void
+_assertDigestsInOrder(size_t length, size_t chunkSize, size_t threadCount, size_t capacity)
+{
+    PARCChunker *chunker = _createChunker(length, chunkSize);
+    PARCChunkDigestPipeline *pipeline = parcChunkDigestPipeline_Create(chunker, PARC_HASH_SHA256, threadCount, capacity);
+
+    // A chunker supports one iterator at a time, so iterate over an identical one for the expected digests.
+    PARCChunker *reference = _createChunker(length, chunkSize);
+    PARCCryptoHasher *hasher = parcCryptoHasher_Create(PARC_HASH_SHA256);
+    PARCIterator *iterator = parcChunker_ForwardIterator(reference);
+    size_t count = 0;
+    while (parcIterator_HasNext(iterator)) {
+        PARCBuffer *chunk = parcIterator_Next(iterator);
+        parcCryptoHasher_Init(hasher);
+        parcCryptoHasher_UpdateBuffer(hasher, chunk);
+        PARCCryptoHash *expected = parcCryptoHasher_Finalize(hasher);
+        parcBuffer_Release(&chunk);
+
+        PARCCryptoHash *actual = parcChunkDigestPipeline_Next(pipeline);
+        assertNotNull(actual, "Expected a digest for chunk %zu", count);
+        assertTrue(parcCryptoHash_Equals(expected, actual), "Expected the digest of chunk %zu to match", count);
+
+        parcCryptoHash_Release(&actual);
+        parcCryptoHash_Release(&expected);
+        count++;
+    }
+    parcIterator_Release(&iterator);
+    parcCryptoHasher_Release(&hasher);
+    parcChunker_Release(&reference);
+
+    assertNull(parcChunkDigestPipeline_Next(pipeline), "Expected NULL after the last chunk.");
+    assertNull(parcChunkDigestPipeline_Next(pipeline), "Expected NULL to be returned again after the last chunk.");
+    assertTrue(parcChunkDigestPipeline_GetCount(pipeline) == count,
+               "Expected %zu digests, actual %zu", count, parcChunkDigestPipeline_GetCount(pipeline));
+    assertFalse(parcChunkDigestPipeline_IsCancelled(pipeline), "Expected the pipeline not to be cancelled.");
+
+    parcChunkDigestPipeline_Release(&pipeline);
+    parcChunker_Release(&chunker);
+}
+
+LONGBOW_TEST_CASE(Global, parcChunkDigestPipeline_Next)
+{
+    _assertDigestsInOrder(100000, 1000, 4, 16);
+}
+
+LONGBOW_TEST_CASE(Global, parcChunkDigestPipeline_Next_SingleThread)
+{
+    _assertDigestsInOrder(100000, 1000, 1, 16);
+}
+
+LONGBOW_TEST_CASE(Global, parcChunkDigestPipeline_Next_CapacityOne)
+{
+    _assertDigestsInOrder(100000, 1000, 4, 1);
+}
+
+LONGBOW_TEST_CASE(Global, parcChunkDigestPipeline_Next_MoreThreadsThanChunks)
+{
+    _assertDigestsInOrder(2500, 1000, 8, 16);
+}
+
+LONGBOW_TEST_CASE(Global, parcChunkDigestPipeline_Cancel)
+{
+    PARCChunker *chunker = _createChunker(100000, 100);
+    PARCChunkDigestPipeline *pipeline = parcChunkDigestPipeline_Create(chunker, PARC_HASH_SHA256, 4, 8);
+
+    for (int i = 0; i < 10; i++) {
+        PARCCryptoHash *digest = parcChunkDigestPipeline_Next(pipeline);
+        assertNotNull(digest, "Expected a digest for chunk %d", i);
+        parcCryptoHash_Release(&digest);
+    }
+
+    parcChunkDigestPipeline_Cancel(pipeline);
+    assertTrue(parcChunkDigestPipeline_IsCancelled(pipeline), "Expected the pipeline to be cancelled.");
+    assertNull(parcChunkDigestPipeline_Next(pipeline), "Expected NULL from a cancelled pipeline.");
+    assertTrue(parcChunkDigestPipeline_GetCount(pipeline) == 10,
+               "Expected 10 digests, actual %zu", parcChunkDigestPipeline_GetCount(pipeline));
+
+    parcChunkDigestPipeline_Release(&pipeline);
+    parcChunker_Release(&chunker);
+}
+
+static void *
+_cancelAfterDelay(void *pipeline)
+{
+    usleep(10000);
+    parcChunkDigestPipeline_Cancel(pipeline);
+    return NULL;
+}
+
+LONGBOW_TEST_CASE(Global, parcChunkDigestPipeline_Cancel_FromAnotherThread)
+{
+    PARCChunker *chunker = _createChunker(1000000, 16);
+    PARCChunkDigestPipeline *pipeline = parcChunkDigestPipeline_Create(chunker, PARC_HASH_SHA256, 2, 4);
+
+    pthread_t canceller;
+    pthread_create(&canceller, NULL, _cancelAfterDelay, pipeline);
+
+    size_t count = 0;
+    PARCCryptoHash *digest;
+    while ((digest = parcChunkDigestPipeline_Next(pipeline)) != NULL) {
+        parcCryptoHash_Release(&digest);
+        count++;
+    }
+    pthread_join(canceller, NULL);
+
+    assertTrue(parcChunkDigestPipeline_IsCancelled(pipeline) || count == 1000000 / 16,
+               "Expected the pipeline to stop only when cancelled or finished.");
+
+    parcChunkDigestPipeline_Release(&pipeline);
+    parcChunker_Release(&chunker);
+}
+
+LONGBOW_TEST_FIXTURE_OPTIONS(Performance, .enabled = false)
+{
+    LONGBOW_RUN_TEST_CASE(Performance, parcChunkDigestPipeline_Throughput);
+}
+
+LONGBOW_TEST_FIXTURE_SETUP(Performance)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_FIXTURE_TEARDOWN(Performance)
+{
+    return LONGBOW_STATUS_SUCCEEDED;
+}
+
+LONGBOW_TEST_CASE(Performance, parcChunkDigestPipeline_Throughput)
+{
+    size_t length = 256 * 1024 * 1024;
+    size_t chunkSize = 8192;
+    PARCChunker *chunker = _createChunker(length, chunkSize);
+    double megabytes = length / (1024.0 * 1024.0);
+
+    for (size_t threads = 1; threads <= 8; threads *= 2) {
+        struct timeval start;
+        gettimeofday(&start, NULL);
+
+        PARCChunkDigestPipeline *pipeline = parcChunkDigestPipeline_Create(chunker, PARC_HASH_SHA256, threads, 4 * threads);
+        PARCCryptoHash *digest;
+        while ((digest = parcChunkDigestPipeline_Next(pipeline)) != NULL) {
+            parcCryptoHash_Release(&digest);
+        }
+        parcChunkDigestPipeline_Release(&pipeline);
+
+        struct timeval end;
+        gettimeofday(&end, NULL);
+        timersub(&end, &start, &end);
+        double seconds = end.tv_sec + end.tv_usec / 1000000.0;
+
+        printf("%zu thread(s): %8.1f MB/s\n", threads, megabytes / seconds);
+    }
+
+    parcChunker_Release(&chunker);
+}
+
+int
+main(int argc, char *argv[argc])
+{
+    LongBowRunner *testRunner = LONGBOW_TEST_RUNNER_CREATE(parc_ChunkDigestPipeline);
+    int exitStatus = longBowMain(argc, argv, testRunner, NULL);
+    longBowTestRunner_Destroy(&testRunner);
+    exit(exitStatus);
+}
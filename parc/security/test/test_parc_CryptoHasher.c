@@ -97,6 +97,7 @@ LONGBOW_TEST_FIXTURE(Global)
 
     LONGBOW_RUN_TEST_CASE(Global, parcCryptoHasher_Bytes_256);
     LONGBOW_RUN_TEST_CASE(Global, parcCryptoHasher_Buffer_256);
+    LONGBOW_RUN_TEST_CASE(Global, parcCryptoHasher_BufferChain_256);
 
     LONGBOW_RUN_TEST_CASE(Global, parcCryptoHasher_Bytes_512);
     LONGBOW_RUN_TEST_CASE(Global, parcCryptoHasher_Buffer_512);
@@ -206,6 +207,46 @@ LONGBOW_TEST_CASE(Global, parcCryptoHasher_Buffer_256)
     close(fd_truth);
 }
 
+LONGBOW_TEST_CASE(Global, parcCryptoHasher_BufferChain_256)
+{
+    int fd_buffer = open("test_digest_bytes_128.bin", O_RDONLY);
+    int fd_truth = open("test_digest_bytes_128.sha256", O_RDONLY);
+    assertFalse(fd_buffer < 0, "Could not open %s: %s", "test_digest_bytes_128.bin", strerror(errno));
+    assertFalse(fd_truth < 0, "Could not open %s: %s", "test_digest_bytes_128.sha256", strerror(errno));
+
+    uint8_t scratch[bufferLength];
+
+    ssize_t read_length = read(fd_buffer, scratch, bufferLength);
+    PARCBuffer *bb_to_digest = parcBuffer_Wrap(scratch, read_length, 0, read_length);
+
+    // Hash the bytes as three uneven segments.
+    PARCBufferChain *chain = parcBufferChain_Create();
+    parcBufferChain_Append(chain, parcBuffer_SetLimit(bb_to_digest, 7));
+    parcBufferChain_Append(chain, parcBuffer_SetLimit(parcBuffer_SetPosition(bb_to_digest, 7), 100));
+    parcBufferChain_Append(chain, parcBuffer_SetLimit(parcBuffer_SetPosition(bb_to_digest, 100), read_length));
+
+    uint8_t truth[bufferLength];
+    ssize_t truth_length = read(fd_truth, truth, bufferLength);
+    PARCCryptoHash *digestTruth = parcCryptoHash_CreateFromArray(PARC_HASH_SHA256, truth, truth_length);
+
+    PARCCryptoHasher *digester = parcCryptoHasher_Create(PARC_HASH_SHA256);
+    parcCryptoHasher_Init(digester);
+    parcCryptoHasher_UpdateBufferChain(digester, chain);
+    PARCCryptoHash *digestTest = parcCryptoHasher_Finalize(digester);
+
+    assertTrue(parcCryptoHash_Equals(digestTruth, digestTest),
+               "sha256 digest of 128-byte buffer using UpdateBufferChain does not match");
+
+    parcCryptoHasher_Release(&digester);
+    parcBufferChain_Release(&chain);
+    parcBuffer_Release(&bb_to_digest);
+    parcCryptoHash_Release(&digestTruth);
+    parcCryptoHash_Release(&digestTest);
+
+    close(fd_buffer);
+    close(fd_truth);
+}
+
 // ==== 512
 
 LONGBOW_TEST_CASE(Global, parcCryptoHasher_Bytes_512)